@@ -41,13 +41,34 @@ extern OPS_Stream *opserrPtr;
 class Domain;
 class Element;
 
-extern double   ops_Dt;                // current delta T for current domain doing an update
-extern int ops_Creep;
-extern Domain  *ops_TheActiveDomain;   // current domain undergoing an update
-extern Element *ops_TheActiveElement;  // current element undergoing an update
+// The update state is thread-local so that elements can be updated
+// concurrently (see Domain::update), and so that models can be analyzed
+// on different threads of one process
+extern thread_local double   ops_Dt;                // current delta T for current domain doing an update
+extern thread_local int      ops_Creep;
+extern thread_local Domain  *ops_TheActiveDomain;   // current domain undergoing an update
+extern thread_local Element *ops_TheActiveElement;  // current element undergoing an update
 
 // global variable for initial state analysis
 // added: Chris McGann, University of Washington
-extern bool  ops_InitialStateAnalysis;
+extern thread_local bool  ops_InitialStateAnalysis;
+
+// The update state of the calling thread, captured when it is made; a
+// task run on a pool thread on behalf of another sets it first
+struct ops_UpdateState {
+  double   dt           = ops_Dt;
+  int      creep        = ops_Creep;
+  bool     initialState = ops_InitialStateAnalysis;
+  Domain  *domain       = ops_TheActiveDomain;
+  Element *element      = ops_TheActiveElement;
+
+  void set() const {
+    ops_Dt                   = dt;
+    ops_Creep                = creep;
+    ops_InitialStateAnalysis = initialState;
+    ops_TheActiveDomain      = domain;
+    ops_TheActiveElement     = element;
+  }
+};
 
 #endif
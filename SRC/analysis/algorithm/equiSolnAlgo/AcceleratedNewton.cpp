@@ -37,6 +37,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <Profiler.h>
 #include <Matrix.h>
 #include <Vector.h>
 #include <ID.h>
@@ -201,7 +202,10 @@ AcceleratedNewton::solveCurrentStep(void)
     numIterations++;
 
     // Check convergence criteria
-    result = theTest->test();
+    {
+      OPS_PROFILE(ConvergenceTest, *theTest);
+      result = theTest->test();
+    }
 
     if (result == -1) {
       // Let the accelerator update the tangent if needed
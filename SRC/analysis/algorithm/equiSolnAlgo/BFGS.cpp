@@ -28,6 +28,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <Profiler.h>
 #include <ID.h>
 #include <elementAPI.h>
 
@@ -343,11 +344,17 @@ BFGS::solveCurrentStep(void)
         if (theIntegrator->formUnbalance() < 0)
           return SolutionAlgorithm::BadFormResidual;
 
-        result = localTest->test(); 
+        {
+          OPS_PROFILE(ConvergenceTest, *localTest);
+          result = localTest->test();
+        }
         
       } while (result == ConvergenceTest::Continue && nBFGS <= numberLoops);
 
-      result = theTest->test();
+      {
+        OPS_PROFILE(ConvergenceTest, *theTest);
+        result = theTest->test();
+      }
 
       this->record(count++);
 
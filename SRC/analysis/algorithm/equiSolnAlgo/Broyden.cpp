@@ -31,6 +31,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <Profiler.h>
 #include <ID.h>
 #include <math.h>
 #include <elementAPI.h>
@@ -326,12 +327,18 @@ Broyden::solveCurrentStep(void)
           opserr << "the Integrator failed in formUnbalance()\n";        
         }            
         
-        result = localTest->test() ;
+        {
+          OPS_PROFILE(ConvergenceTest, *localTest);
+          result = localTest->test();
+        }
         
       } while ( result == -1 && nBroyden <= numberLoops );
 
 
-      result = theTest->test();
+      {
+        OPS_PROFILE(ConvergenceTest, *theTest);
+        result = theTest->test();
+      }
       this->record(count++);
 
     } while (result == ConvergenceTest::Continue);
@@ -528,7 +535,10 @@ Broyden::Print(OPS_Stream &s, int flag)
             return -2;
         }        
         
-        result = theTest->test();
+        {
+          OPS_PROFILE(ConvergenceTest, *theTest);
+          result = theTest->test();
+        }
         this->record(nBroyden++);
 
       const Vector &du = BroydengetX( theIntegrator, theSOE, nBroyden )  ;
@@ -36,6 +36,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <Profiler.h>
 #include <Matrix.h>
 #include <Vector.h>
 #include <ID.h>
@@ -202,7 +203,10 @@ KrylovNewton::solveCurrentStep(void)
     // Increase current dimension of Krylov subspace
     dim++;
 
-    result = theTest->test();
+    {
+      OPS_PROFILE(ConvergenceTest, *theTest);
+      result = theTest->test();
+    }
     this->record(k++);
 
   }  while (result == ConvergenceTest::Continue);
@@ -35,6 +35,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <Profiler.h>
 
 #include <elementAPI.h>
 void *
@@ -144,7 +145,10 @@ ModifiedNewton::solveCurrentStep(void)
       if (theIncIntegratorr->formUnbalance() < 0)
         return SolutionAlgorithm::BadFormResidual;
 
-      result = theTest->test();
+      {
+        OPS_PROFILE(ConvergenceTest, *theTest);
+        result = theTest->test();
+      }
       numIterations++;
       this->record(numIterations);
 
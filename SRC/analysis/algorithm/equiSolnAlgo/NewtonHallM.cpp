@@ -30,6 +30,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <Profiler.h>
 #include <ID.h>
 
 #include <elementAPI.h>
@@ -184,7 +185,10 @@ NewtonHallM::solveCurrentStep(void)
         return -2;
       }        
       
-      result = theTest->test();
+      {
+        OPS_PROFILE(ConvergenceTest, *theTest);
+        result = theTest->test();
+      }
       numIterations++;
       this->record(numIterations);
       
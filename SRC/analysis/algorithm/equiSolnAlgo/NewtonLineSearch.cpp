@@ -33,6 +33,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <Profiler.h>
 #include <ID.h>
 
 
@@ -150,7 +151,10 @@ NewtonLineSearch::solveCurrentStep(void)
 
         // do a line search only if convergence criteria not met
         theOtherTest->start();
-        result = theOtherTest->test();
+        {
+          OPS_PROFILE(ConvergenceTest, *theOtherTest);
+          result = theOtherTest->test();
+        }
 
         if (result < 1) {
           //new residual 
@@ -165,7 +169,10 @@ NewtonLineSearch::solveCurrentStep(void)
 
         this->record(0);
           
-        result = theTest->test();
+        {
+          OPS_PROFILE(ConvergenceTest, *theTest);
+          result = theTest->test();
+        }
 
     }  while (result == ConvergenceTest::Continue);
 
@@ -36,6 +36,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <Profiler.h>
 #include <ID.h>
 
 
@@ -206,7 +207,10 @@ NewtonRaphson::solveCurrentStep()
       //
       // 2.4 Test on updated residual
       //
-      result = theTest->test();
+      {
+        OPS_PROFILE(ConvergenceTest, *theTest);
+        result = theTest->test();
+      }
       numIterations++;
       this->record(numIterations);
 
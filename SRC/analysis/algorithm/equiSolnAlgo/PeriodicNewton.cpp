@@ -39,6 +39,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <Profiler.h>
 
 // Constructor
 PeriodicNewton::PeriodicNewton(int theTangentToUse, int mc)
@@ -124,7 +125,10 @@ PeriodicNewton::solveCurrentStep(void)
         }        
 
         this->record(count++);
-        result = theTest->test();
+        {
+          OPS_PROFILE(ConvergenceTest, *theTest);
+          result = theTest->test();
+        }
         
         iter++;
         if (iter > maxCount) {
@@ -38,10 +38,19 @@
 #include <elementAPI.h>
 #include <Node.h>
 #include <NodeIter.h>
+#include <Recorder.h>
+#include <NodeRecorder.h>
+#include <EnvelopeNodeRecorder.h>
+#include <NodeRecorderRMS.h>
+#include <NodeData.h>
+#include <classTags.h>
+#include <ID.h>
+#include <threads/global_pool.hpp>
 #include <vector>
 #include <algorithm>
 #include <cmath>
 #include <string>
+#include <cstring>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -90,12 +99,35 @@ namespace {
 		return true;
 	}
 
+	// true if the i-th of the node_ndf DOFs of a node takes a modal displacement.
+	// exclude any dof >= node_ndf (if ndf > node_ndf... in case node is U-only)
+	// exclude any dof >= ndf (if node_ndf > ndf... in case the node has more DOFs than U and R)
+	// we also need to exclude pressure dofs... easy in 3D because node_ndf is 4,
+	// but in 2D it is 3, as in U-R...
+	inline bool is_modal_dof(int ndf, int node_ndf, int i) {
+		if (i >= node_ndf || i >= ndf)
+			return false;
+		if (ndf == 6 && node_ndf == 4 && i == 3)
+			return false;
+		return true;
+	}
+
+	// the CQC correlation coefficient of two modes with the same damping ratio
+	// (Der Kiureghian, 1981)
+	inline double cqc_rho(double wi, double wj, double zeta) {
+		double r = wj / wi;
+		double a = 8.0 * zeta * zeta * (1.0 + r) * r * std::sqrt(r);
+		double b = (1.0 - r * r) * (1.0 - r * r) + 4.0 * zeta * zeta * r * (1.0 + r) * (1.0 + r);
+		return b > 0.0 ? a / b : 1.0;
+	}
+
 }
 
 int
 OPS_ADD_RUNTIME_VXV(OPS_ResponseSpectrumAnalysis)
 {
 	// responseSpectrum $tsTag $dir <-scale $scale>
+	//     <-combine SRSS|CQC> <-damp $damp> <-directions $dir2 ...>
 
 	// some kudos
 	static bool first_done = false;
@@ -123,6 +155,9 @@ OPS_ADD_RUNTIME_VXV(OPS_ResponseSpectrumAnalysis)
 	std::vector<double> Sa;
 	int mode_id = 0;
 	bool single_mode = false;
+	ResponseSpectrumAnalysis::ModalCombination combination = ResponseSpectrumAnalysis::NoCombination;
+	double damp = 0.05;
+	std::vector<int> directions;
 
 	// make sure eigenvalue and modal properties have been called before
 	DomainModalProperties modal_props;
@@ -135,9 +170,9 @@ OPS_ADD_RUNTIME_VXV(OPS_ResponseSpectrumAnalysis)
 	// parse
 	int nargs = OPS_GetNumRemainingInputArgs();
 	if (nargs < 2) {
-		opserr << "ResponseSpectrumAnalysis $tsTag $dir <-scale $scale> <-damp $damp>\n"
+		opserr << "ResponseSpectrumAnalysis $tsTag $dir <-scale $scale> <-combine SRSS|CQC> <-damp $damp> <-directions $dirs>\n"
 			<< "or\n"
-			<< "ResponseSpectrumAnalysis $dir -Tn $TnValues -fn $fnValues -Sa $SaValues <-scale $scale> <-damp $damp>\n"
+			<< "ResponseSpectrumAnalysis $dir -Tn $TnValues -fn $fnValues -Sa $SaValues <-scale $scale> <-combine SRSS|CQC> <-damp $damp> <-directions $dirs>\n"
 			"Error: at least 2 arguments should be provided.\n";
 		return -1;
 	}
@@ -220,6 +255,69 @@ OPS_ADD_RUNTIME_VXV(OPS_ResponseSpectrumAnalysis)
 				return -1;
 			}
 		}
+		else if (strcmp(value, "-combine") == 0) {
+			if (OPS_GetNumRemainingInputArgs() > 0) {
+				const char* type = OPS_GetString();
+				if (strcmp(type, "SRSS") == 0 || strcmp(type, "srss") == 0) {
+					combination = ResponseSpectrumAnalysis::SRSS;
+				}
+				else if (strcmp(type, "CQC") == 0 || strcmp(type, "cqc") == 0) {
+					combination = ResponseSpectrumAnalysis::CQC;
+				}
+				else {
+					opserr << "ResponseSpectrumAnalysis Error: unknown modal combination " << type << ", want SRSS or CQC.\n";
+					return -1;
+				}
+			}
+			else {
+				opserr << "ResponseSpectrumAnalysis Error: modal combination requested but not provided.\n";
+				return -1;
+			}
+		}
+		else if (strcmp(value, "-damp") == 0) {
+			if (OPS_GetNumRemainingInputArgs() > 0) {
+				if (OPS_GetDouble(&numData, &damp) < 0 || damp < 0.0) {
+					opserr << "ResponseSpectrumAnalysis Error: Failed to get a non-negative damping ratio.\n";
+					return -1;
+				}
+			}
+			else {
+				opserr << "ResponseSpectrumAnalysis Error: damping ratio requested but not provided.\n";
+				return -1;
+			}
+		}
+		else if (strcmp(value, "-directions") == 0) {
+			// expanded list like {*}$the_list, or *the_list in python
+			directions.clear();
+			while (OPS_GetNumRemainingInputArgs() > 0) {
+				int item;
+				auto old_num_rem = OPS_GetNumRemainingInputArgs();
+				if (OPS_GetIntInput(&numData, &item) < 0) {
+					auto new_num_rem = OPS_GetNumRemainingInputArgs();
+					if (new_num_rem < old_num_rem)
+						OPS_ResetCurrentInputArg(-1);
+					break;
+				}
+				directions.push_back(item);
+			}
+			// try Tcl list (it's a string after all...)
+			if (directions.size() == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+				std::string list_string = OPS_GetString();
+				std::vector<double> items;
+				if (!string_to_list_of_doubles(list_string, ' ', items)) {
+					opserr << "ResponseSpectrumAnalysis Error: cannot parse the directions list.\n";
+					return -1;
+				}
+				for (double item : items)
+					directions.push_back(static_cast<int>(item));
+			}
+			for (int item : directions) {
+				if (item < 1 || item > ndf) {
+					opserr << "ResponseSpectrumAnalysis Error: provided direction (" << item << ") should be in the range 1-" << ndf << ".\n";
+					return -1;
+				}
+			}
+		}
 		else if (strcmp(value, "-Tn") == 0 || strcmp(value, "-fn") == 0) {
 			// first try expanded list like {*}$the_list,
 			// also used in python like *the_list
@@ -305,6 +403,17 @@ OPS_ADD_RUNTIME_VXV(OPS_ResponseSpectrumAnalysis)
 	// ok, create the response spectrum analysis and run it here... 
 	// no need to store it
 	ResponseSpectrumAnalysis rsa(theAnalysisModel, ts, Tn, Sa, dir, scale);
+	if (combination != ResponseSpectrumAnalysis::NoCombination) {
+		if (single_mode) {
+			opserr << "ResponseSpectrumAnalysis Error: -mode and -combine cannot be used together.\n";
+			return -1;
+		}
+		rsa.setCombination(combination, damp, directions);
+	}
+	else if (directions.size() > 0) {
+		opserr << "ResponseSpectrumAnalysis Error: -directions requires -combine.\n";
+		return -1;
+	}
 	int result;
 	if (single_mode)
 		result = rsa.analyze(mode_id);
@@ -329,6 +438,9 @@ ResponseSpectrumAnalysis::ResponseSpectrumAnalysis(
 	, m_direction(theDirection)
 	, m_scale(scale)
 	, m_current_mode(0)
+	, m_combination(NoCombination)
+	, m_damping(0.05)
+	, m_directions(1, theDirection)
 {
 
 }
@@ -337,6 +449,21 @@ ResponseSpectrumAnalysis::~ResponseSpectrumAnalysis()
 {
 }
 
+void ResponseSpectrumAnalysis::setCombination(
+	ModalCombination combination,
+	double damping,
+	const std::vector<int>& directions
+)
+{
+	m_combination = combination;
+	m_damping = damping;
+	m_directions.assign(1, m_direction);
+	for (int dir : directions) {
+		if (std::find(m_directions.begin(), m_directions.end(), dir) == m_directions.end())
+			m_directions.push_back(dir);
+	}
+}
+
 int ResponseSpectrumAnalysis::analyze()
 {
 	// get the domain
@@ -357,6 +484,17 @@ int ResponseSpectrumAnalysis::analyze()
 	error_code = check();
 	if (error_code < 0) return error_code;
 
+	// combine all modes in memory and produce a single analysis step
+	if (m_combination != NoCombination) {
+		error_code = checkRecorders();
+		if (error_code < 0) return error_code;
+		error_code = beginMode();
+		if (error_code < 0) return error_code;
+		error_code = solveCombined();
+		if (error_code < 0) return error_code;
+		return endMode();
+	}
+
 	// loop over all required eigen-modes, compute the modal displacement
 	// and save the results.
 	// we just compute modal displacements without doing any (SRSS, CQC, etc..)
@@ -473,6 +611,49 @@ int ResponseSpectrumAnalysis::check()
 	return 0;
 }
 
+int ResponseSpectrumAnalysis::checkRecorders()
+{
+	// get the domain
+	Domain* domain = m_model->getDomainPtr();
+
+	// the combined step only holds combined nodal displacements. any other
+	// response (velocities, reactions, element responses, drifts...) computed
+	// from them is not the combination of the modal responses, so refuse to
+	// record it at all.
+	ID tags;
+	domain->getRecorderTags(tags);
+	for (int i = 0; i < tags.Size(); ++i) {
+		Recorder* recorder = domain->getRecorder(tags(i));
+		if (recorder == nullptr)
+			continue;
+		NodeData data = NodeData::Unknown;
+		switch (recorder->getClassTag()) {
+		case RECORDER_TAGS_NodeRecorder:
+			data = static_cast<NodeRecorder*>(recorder)->getDataFlag();
+			break;
+		case RECORDER_TAGS_EnvelopeNodeRecorder:
+			data = static_cast<EnvelopeNodeRecorder*>(recorder)->getDataFlag();
+			break;
+		case RECORDER_TAGS_NodeRecorderRMS:
+			data = static_cast<NodeRecorderRMS*>(recorder)->getDataFlag();
+			break;
+		case RECORDER_TAGS_MaxNodeDispRecorder:
+			data = NodeData::Disp;
+			break;
+		default:
+			break;
+		}
+		if (data != NodeData::Disp && data != NodeData::DisplTrial) {
+			opserr << "ResponseSpectrumAnalysis::analyze() - the " << recorder->getClassType()
+				<< " " << tags(i) << " cannot record the step of combined modes, which holds the combined nodal displacements only.\n"
+				"Record disp only, or run without -combine to record each mode and combine the responses.\n";
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
 int ResponseSpectrumAnalysis::beginMode()
 {
 	// new step... (do nothing)
@@ -528,13 +709,7 @@ int ResponseSpectrumAnalysis::solveMode()
 
 	// compute modal acceleration for this mode using the 
 	// provided response spectrum function (time series)
-	double lambda = mp.eigenvalues()(m_current_mode);
-	double omega = std::sqrt(lambda);
-	double freq = omega / 2.0 / M_PI;
-	double period = 1.0 / freq;
-	double mga = getSa(period);
-	double Vscale = mp.eigenVectorScaleFactors()(m_current_mode);
-	double MPF = mp.modalParticipationFactors()(m_current_mode, exdof);
+	double factor = getModalFactor(mp, m_current_mode, exdof);
 
 	// loop over all nodes and compute the modal displacements
 	Node* node;
@@ -542,25 +717,21 @@ int ResponseSpectrumAnalysis::solveMode()
 	while ((node = theNodes()) != 0) {
 
 		// get the nodal eigenvector, according to the ndf of modal properties
-		// and its scaling
 		const Matrix& node_evec = node->getEigenvectors();
 		int node_ndf = node_evec.noRows();
+		if (node_evec.noCols() <= m_current_mode) {
+			opserr << "ResponseSpectrumAnalysis::solveMode() - node " << node->getTag()
+				<< " has no eigenvector for mode " << m_current_mode + 1 << ", its displacements are not set.\n";
+			continue;
+		}
 
 		// for each DOF...
 		for (int i = 0; i < std::min(node_ndf, ndf); ++i) {
-			// exclude any dof >= node_ndf (if ndf > node_ndf... in case node is U-only)
-			// exclude any dof >= ndf (if node_ndf > ndf... in case the node has more DOFs than U and R)
-
-			// we also need to exclude pressure dofs... easy in 3D because node_ndf is 4,
-			// but in 2D it is 3, as in U-R...
-			if (ndf == 6 && node_ndf == 4 && i == 3)
+			if (!is_modal_dof(ndf, node_ndf, i))
 				continue;
 
-			// eigenvector
-			double V = node_evec(i, m_current_mode) * Vscale;
-
 			// compute modal displacements for the i-th DOF
-			double u_modal = V * MPF * mga / lambda;
+			double u_modal = node_evec(i, m_current_mode) * factor;
 
 			// save this displacement at the i-th dof as new trial displacement
 			node->setTrialDisp(u_modal, i);
@@ -571,6 +742,122 @@ int ResponseSpectrumAnalysis::solveMode()
 	return 0;
 }
 
+int ResponseSpectrumAnalysis::solveCombined()
+{
+	// get the domain
+	Domain* domain = m_model->getDomainPtr();
+
+	// get the modal properties once for all modes
+	DomainModalProperties mp;
+	if (domain->getModalProperties(mp) < 0) {
+		opserr << "ResponseSpectrumAnalysis::solveCombined() - failed to get modal properties" << endln;
+		return -1;
+	}
+
+	// size info
+	int ndf = mp.totalMass().Size();
+	int num_eigen = mp.eigenvalues().Size();
+	int num_dir = static_cast<int>(m_directions.size());
+
+	// modal factors for each direction, so that the modal displacement at a DOF
+	// is its eigenvector component times the factor. the spectrum is evaluated
+	// here, on this thread only.
+	std::vector<double> factors(num_dir * num_eigen);
+	for (int d = 0; d < num_dir; ++d)
+		for (int m = 0; m < num_eigen; ++m)
+			factors[d * num_eigen + m] = getModalFactor(mp, m, m_directions[d] - 1);
+
+	// correlation coefficients of the modes (upper triangle only)
+	std::vector<double> rho;
+	if (m_combination == CQC) {
+		rho.resize(num_eigen * num_eigen);
+		for (int i = 0; i < num_eigen; ++i) {
+			double wi = std::sqrt(mp.eigenvalues()(i));
+			for (int j = i + 1; j < num_eigen; ++j)
+				rho[i * num_eigen + j] = cqc_rho(wi, std::sqrt(mp.eigenvalues()(j)), m_damping);
+		}
+	}
+
+	// the nodes to combine, leaving out (and reporting) the ones without
+	// the eigenvectors of all modes
+	std::vector<Node*> nodes;
+	nodes.reserve(domain->getNumNodes());
+	Node* node;
+	NodeIter& theNodes = domain->getNodes();
+	while ((node = theNodes()) != 0) {
+		if (node->getEigenvectors().noCols() < num_eigen) {
+			opserr << "ResponseSpectrumAnalysis::solveCombined() - node " << node->getTag()
+				<< " has no eigenvectors for all " << num_eigen << " modes, its displacements are not set.\n";
+			continue;
+		}
+		nodes.push_back(node);
+	}
+
+	// combine the modes of the nodes from first to last. each node is set by
+	// one block only, and the modal responses of a DOF are formed in a
+	// work vector instead of being stored for all modes.
+	auto combine = [&](std::size_t first, std::size_t last) {
+		std::vector<double> u(num_eigen);
+		for (std::size_t n = first; n < last; ++n) {
+			Node* node = nodes[n];
+			const Matrix& node_evec = node->getEigenvectors();
+			int node_ndf = node_evec.noRows();
+			for (int i = 0; i < std::min(node_ndf, ndf); ++i) {
+				if (!is_modal_dof(ndf, node_ndf, i))
+					continue;
+				double sum_dir = 0.0;
+				for (int d = 0; d < num_dir; ++d) {
+					const double* f = &factors[d * num_eigen];
+					double sum = 0.0;
+					for (int m = 0; m < num_eigen; ++m) {
+						u[m] = node_evec(i, m) * f[m];
+						sum += u[m] * u[m];
+					}
+					if (m_combination == CQC) {
+						double cross = 0.0;
+						for (int m = 0; m < num_eigen; ++m) {
+							const double* rho_m = &rho[m * num_eigen];
+							double row = 0.0;
+							for (int k = m + 1; k < num_eigen; ++k)
+								row += rho_m[k] * u[k];
+							cross += u[m] * row;
+						}
+						sum = std::max(0.0, sum + 2.0 * cross);
+					}
+					sum_dir += sum;
+				}
+				node->setTrialDisp(std::sqrt(sum_dir), i);
+			}
+		}
+	};
+
+	const std::size_t num_nodes = nodes.size();
+	if (domain->getNumThreads() > 1 && !OpenSees::in_thread_pool() && num_nodes > 1) {
+		OpenSees::thread_pool& pool = OpenSees::global_thread_pool();
+		const std::size_t num_blocks = std::min<std::size_t>(num_nodes, 4 * pool.get_thread_count());
+		pool.submit_blocks<std::size_t>(0, num_nodes, combine, num_blocks).wait();
+	}
+	else {
+		combine(0, num_nodes);
+	}
+
+	return 0;
+}
+
+double ResponseSpectrumAnalysis::getModalFactor(const DomainModalProperties& mp, int mode, int exdof) const
+{
+	// modal acceleration from the response spectrum function
+	double lambda = mp.eigenvalues()(mode);
+	double omega = std::sqrt(lambda);
+	double freq = omega / 2.0 / M_PI;
+	double period = 1.0 / freq;
+	double mga = getSa(period) * m_scale;
+	// eigenvector scaling
+	double Vscale = mp.eigenVectorScaleFactors()(mode);
+	double MPF = mp.modalParticipationFactors()(mode, exdof);
+	return Vscale * MPF * mga / lambda;
+}
+
 double ResponseSpectrumAnalysis::getSa(double T) const
 {
 	// use the time series if provided
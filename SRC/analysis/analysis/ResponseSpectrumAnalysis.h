@@ -36,6 +36,7 @@
 #include <vector>
 class AnalysisModel;
 class TimeSeries;
+class DomainModalProperties;
 
 class ResponseSpectrumAnalysis
 {
@@ -50,16 +51,42 @@ public:
 	);
 	~ResponseSpectrumAnalysis();
 
+public:
+	// how analyze() combines the modal responses.
+	// with NoCombination each mode is a separate analysis step, otherwise
+	// the modal displacements of all modes are combined in memory and
+	// committed as a single step. any other response would follow from the
+	// combined displacements instead of being combined itself, so the
+	// combined step fails if recorders other than node disp recorders are set.
+	enum ModalCombination {
+		NoCombination,
+		SRSS,
+		CQC
+	};
+
+	// set the modal combination, the damping ratio used by CQC, and the
+	// directions excited by the spectrum besides the one given to the
+	// constructor. the combined responses of all directions are combined
+	// by SRSS.
+	void setCombination(
+		ModalCombination combination,
+		double damping,
+		const std::vector<int>& directions
+	);
+
 public:
 	int analyze();
 	int analyze(int mode_id);
 
 private:
 	int check();
+	int checkRecorders();
 	int beginMode();
 	int endMode();
 	int solveMode();
+	int solveCombined();
 	double getSa(double T) const;
+	double getModalFactor(const DomainModalProperties& mp, int mode, int exdof) const;
 
 private:
 	// the model
@@ -70,10 +97,16 @@ private:
 	std::vector<double> m_Sa;
 	// the direction 1 to 3 (for 2D models) or 1 to 6 (for 3D models)
 	int m_direction;
-	// the scale factor for the computed displacement field
+	// the scale factor for the computed displacement field. it multiplies the
+	// spectral acceleration of every mode, for each mode on its own
+	// (-mode or no -combine) as well as for the combination.
 	double m_scale;
 	// current mode
 	int m_current_mode;
+	// modal combination (see setCombination)
+	ModalCombination m_combination;
+	double m_damping;
+	std::vector<int> m_directions;
 };
 
 #endif
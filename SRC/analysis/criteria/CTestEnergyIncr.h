@@ -46,6 +46,8 @@ public:
     // destructor
     ~CTestEnergyIncr();
 
+    const char *getClassType(void) const {return "CTestEnergyIncr";}
+
     ConvergenceTest *getCopy(int iterations);
 
     void setTolerance(double newTol);
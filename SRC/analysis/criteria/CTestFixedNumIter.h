@@ -46,6 +46,8 @@ public:
     // destructor
     ~CTestFixedNumIter();
 
+    const char *getClassType(void) const {return "CTestFixedNumIter";}
+
     ConvergenceTest *getCopy(int iterations);
 
     int setEquiSolnAlgo(EquiSolnAlgo &theAlgo);
@@ -46,6 +46,8 @@ public:
     // destructor
     ~CTestNormDispIncr();
 
+    const char *getClassType(void) const {return "CTestNormDispIncr";}
+
     ConvergenceTest *getCopy(int iterations);
 
     void setTolerance(double newTol);
@@ -46,6 +46,8 @@ public:
     // destructor
     ~CTestNormUnbalance();
 
+    const char *getClassType(void) const {return "CTestNormUnbalance";}
+
     ConvergenceTest  *getCopy(int interations);
 
     void setTolerance(double newTol);
@@ -46,6 +46,8 @@ public:
     // destructor
     ~CTestRelativeEnergyIncr();
 
+    const char *getClassType(void) const {return "CTestRelativeEnergyIncr";}
+
     ConvergenceTest *getCopy(int iterations);
 
     void setTolerance(double newTol);
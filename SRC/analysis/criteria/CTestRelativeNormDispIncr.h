@@ -47,6 +47,8 @@ public:
     // destructor
     ~CTestRelativeNormDispIncr();
 
+    const char *getClassType(void) const {return "CTestRelativeNormDispIncr";}
+
     ConvergenceTest *getCopy(int iterations);
 
     void setTolerance(double newTol);
@@ -48,6 +48,8 @@ public:
     // destructor
     ~CTestRelativeNormUnbalance();
 
+    const char *getClassType(void) const {return "CTestRelativeNormUnbalance";}
+
     ConvergenceTest *getCopy(int interations);
 
     void setTolerance(double newTol);
@@ -47,6 +47,8 @@ public:
     // destructor
     ~CTestRelativeTotalNormDispIncr();
 
+    const char *getClassType(void) const {return "CTestRelativeTotalNormDispIncr";}
+
     ConvergenceTest *getCopy(int iterations);
 
     void setTolerance(double newTol);
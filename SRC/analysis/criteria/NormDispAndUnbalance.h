@@ -50,6 +50,8 @@ public:
     // destructor
     ~NormDispAndUnbalance();
 
+    const char *getClassType(void) const {return "NormDispAndUnbalance";}
+
     ConvergenceTest *getCopy(int iterations);
 
     void setTolerance(double newTol);
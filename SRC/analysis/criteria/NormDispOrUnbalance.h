@@ -49,6 +49,8 @@ public:
     // destructor
     ~NormDispOrUnbalance();
 
+    const char *getClassType(void) const {return "NormDispOrUnbalance";}
+
     ConvergenceTest *getCopy(int iterations);
 
     void setTolerance(double newTol);
@@ -33,14 +33,31 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <TransientIntegrator.h>
+#include <memory>
 
 #define MAX_NUM_DOF 256
 
+namespace {
+// Work areas used to return the tangent and unbalance of DOF_Groups with
+// at most MAX_NUM_DOF dof. There is one set per thread so that models
+// analyzed on different threads do not share them.
+struct WorkArea {
+  WorkArea(int n) : tangent(n, n), unbalance(n) {}
+  Matrix tangent;
+  Vector unbalance;
+};
 
-// static variables initialisation
-Matrix **DOF_Group::theMatrices; // array of pointers to class wide matrices
-Vector **DOF_Group::theVectors;  // array of pointers to class widde vectors
-int DOF_Group::numDOFs(0);       // number of objects
+WorkArea &
+getWorkArea(int numDOF)
+{
+  thread_local std::unique_ptr<WorkArea> theAreas[MAX_NUM_DOF+1];
+
+  if (theAreas[numDOF] == nullptr)
+    theAreas[numDOF] = std::make_unique<WorkArea>(numDOF);
+
+  return *theAreas[numDOF];
+}
+} // namespace
 
 
 //  DOF_Group(Node *);
@@ -48,7 +65,7 @@ int DOF_Group::numDOFs(0);       // number of objects
 
 DOF_Group::DOF_Group(int tag, Node *node)
 :TaggedObject(tag),
- unbalance(0), tangent(0), myNode(node), 
+ myNode(node), theUnbalance(nullptr), theTangent(nullptr), 
  myID(node->getNumberDOF()), 
  numDOF(node->getNumberDOF())
 {
@@ -71,46 +88,19 @@ DOF_Group::DOF_Group(int tag, Node *node)
     for (int i=0; i<numDOF; i++)
 	myID(i) = -2;
     
-    // if this is the first DOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }    
-    
-    // set the pointers for the tangent and residual
-    if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-
-	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
-	unbalance = new Vector(numDOF);
-	tangent = new Matrix(numDOF, numDOF);
+    // objects with at most MAX_NUM_DOF dof use the thread-local work
+    // areas to return the tangent and unbalance; larger ones create
+    // their own
+    if (numDOF > MAX_NUM_DOF) {
+	theUnbalance = new Vector(numDOF);
+	theTangent = new Matrix(numDOF, numDOF);
     }
-    
-    numDOFs++;
 }
 
 
 DOF_Group::DOF_Group(int tag, int ndof)
 :TaggedObject(tag),
- unbalance(0), tangent(0), myNode(0), 
+ myNode(0), theUnbalance(nullptr), theTangent(nullptr), 
  myID(ndof), 
  numDOF(ndof)
 {
@@ -126,38 +116,13 @@ DOF_Group::DOF_Group(int tag, int ndof)
     for (int i=0; i<numDOF; i++)
 	myID(i) = -2;
     
-    // if this is the first DOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i]  = 0;
-	}
-    }    
-
-    // set the pointers for the tangent and residual
-    if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent   = theMatrices[numDOF];
-	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent   = theMatrices[numDOF];
-	}
-    } else {
-	// create matrices and vectors for each object instance
-	unbalance = new Vector(numDOF);
-	tangent   = new Matrix(numDOF, numDOF);
+    // objects with at most MAX_NUM_DOF dof use the thread-local work
+    // areas to return the tangent and unbalance; larger ones create
+    // their own
+    if (numDOF > MAX_NUM_DOF) {
+	theUnbalance = new Vector(numDOF);
+	theTangent = new Matrix(numDOF, numDOF);
     }
-    numDOFs++;
 }
 
 // ~DOF_Group();    
@@ -165,33 +130,16 @@ DOF_Group::DOF_Group(int tag, int ndof)
 
 DOF_Group::~DOF_Group()
 {
-  numDOFs--;
-
-  int numDOF = unbalance->Size();
-
   // set the pointer in the associated Node to 0, to stop
   // segmentation fault if node tries to use this object after destroyed
   if (myNode != 0) 
     myNode->setDOF_GroupPtr(0);
 
   // delete tangent and residual if created specially
-  if (numDOF > MAX_NUM_DOF) {
-      if (tangent != 0) delete tangent;
-      if (unbalance != 0) delete unbalance;
-  }
-
-  // if this is the last FE_Element, clean up the
-  // storage for the matrix and vector objects
-  if (numDOFs == 0) {
-    for (int i=0; i<MAX_NUM_DOF; i++) {
-        if (theVectors[i] != nullptr)
-            delete theVectors[i];
-        if (theMatrices[i] != nullptr)
-            delete theMatrices[i];
-    }
-    delete [] theMatrices;
-    delete [] theVectors;
-  }
+  if (theTangent != nullptr)
+    delete theTangent;
+  if (theUnbalance != nullptr)
+    delete theUnbalance;
 }    
 
 // void setID(int index, int value);
@@ -273,13 +221,13 @@ DOF_Group::getTangent(Integrator *theIntegrator)
 {	
   if (theIntegrator != nullptr)
       theIntegrator->formNodTangent(this);    
-  return *tangent;
+  return this->getTangentWork();
 }
 
 void  
 DOF_Group::zeroTangent(void)
 {
-  tangent->Zero();
+  this->getTangentWork().Zero();
 }
 
 
@@ -289,7 +237,7 @@ DOF_Group::addMtoTang(double fact)
   // if there is no associated node, subclass should 
   // implement this method (ie addMtoTang())
   assert(myNode != nullptr);
-  tangent->addMatrix(1.0, myNode->getMass(), fact);
+  this->getTangentWork().addMatrix(1.0, myNode->getMass(), fact);
 }
 
 
@@ -299,7 +247,7 @@ DOF_Group::addCtoTang(double fact)
   // if there is no associated node, subclass should 
   // implement this method (ie addCtoTang())
   assert(myNode != nullptr);
-  tangent->addMatrix(1.0, myNode->getDamp(), fact);
+  this->getTangentWork().addMatrix(1.0, myNode->getDamp(), fact);
 }
 
 
@@ -307,7 +255,7 @@ DOF_Group::addCtoTang(double fact)
 void
 DOF_Group::zeroUnbalance(void) 
 {
-  unbalance->Zero();
+  this->getUnbalanceWork().Zero();
 }
 
 
@@ -317,7 +265,7 @@ DOF_Group::getUnbalance(Integrator *theIntegrator)
   if (theIntegrator != nullptr)
     theIntegrator->formNodUnbalance(this);
 
-  return *unbalance;
+  return this->getUnbalanceWork();
 }
 
 
@@ -327,7 +275,7 @@ DOF_Group::addPtoUnbalance(double fact)
   // if there is no associated node, subclass should 
   // implement this method (ie addPtoUnbalance())
   assert(myNode != nullptr);
-  unbalance->addVector(1.0, myNode->getUnbalancedLoad(), fact);
+  this->getUnbalanceWork().addVector(1.0, myNode->getUnbalancedLoad(), fact);
 }
 
 
@@ -337,7 +285,7 @@ DOF_Group::addPIncInertiaToUnbalance(double fact)
   // if there is no associated node, subclass should 
   // implement this method (ie addPIncInertiaToUnbalance())
   assert(myNode != nullptr);
-  unbalance->addVector(1.0, myNode->getUnbalancedLoadIncInertia(), fact);
+  this->getUnbalanceWork().addVector(1.0, myNode->getUnbalancedLoadIncInertia(), fact);
 }
 
 
@@ -360,7 +308,7 @@ DOF_Group::addM_Force(const Vector &Udotdot, double fact)
 	else accel(i) = 0.0;
     }
 
-    unbalance->addMatrixVector(1.0, myNode->getMass(), accel, fact);
+    this->getUnbalanceWork().addMatrixVector(1.0, myNode->getMass(), accel, fact);
 }
 
 
@@ -369,7 +317,7 @@ const Vector &
 DOF_Group::getTangForce(const Vector &Udotdot, double fact)
 {
   opserr << "DOF_Group::getTangForce() - not yet implemented";
-  return *unbalance;
+  return this->getUnbalanceWork();
 }
 
 
@@ -379,7 +327,7 @@ DOF_Group::getM_Force(const Vector &Udotdot, double fact)
     if (myNode == 0) {
 	opserr << "DOF_Group::getM_Force() - no Node associated";	
 	opserr << " subclass should not call this method \n";	    
-	return *unbalance;
+	return this->getUnbalanceWork();
     }
 
     Vector accel(numDOF);
@@ -391,9 +339,9 @@ DOF_Group::getM_Force(const Vector &Udotdot, double fact)
 	else accel(i) = 0.0;
     }
 	
-    unbalance->addMatrixVector(0.0, myNode->getMass(), accel, fact);
+    this->getUnbalanceWork().addMatrixVector(0.0, myNode->getMass(), accel, fact);
     
-    return *unbalance;
+    return this->getUnbalanceWork();
 }
 
 
@@ -412,8 +360,8 @@ DOF_Group::getC_Force(const Vector &Udotdot, double fact)
       else accel(i) = 0.0;
   }
       
-  unbalance->addMatrixVector(0.0, myNode->getDamp(), accel, fact);
-  return *unbalance;
+  this->getUnbalanceWork().addMatrixVector(0.0, myNode->getDamp(), accel, fact);
+  return this->getUnbalanceWork();
 }
 
 
@@ -447,7 +395,7 @@ void
 DOF_Group::setNodeDisp(const Vector &u)
 {
   assert(myNode != nullptr); 
-  Vector &disp = *unbalance;
+  Vector &disp = this->getUnbalanceWork();
   disp = myNode->getTrialDisp();
   int i;
   
@@ -471,7 +419,7 @@ DOF_Group::setNodeVel(const Vector &udot)
 {
   assert(myNode != nullptr);
 
-  Vector &vel = *unbalance;
+  Vector &vel = this->getUnbalanceWork();
   vel = myNode->getTrialVel();
   int i;
   
@@ -495,7 +443,7 @@ DOF_Group::setNodeAccel(const Vector &udotdot)
 
   assert(myNode != nullptr);
 
-  Vector &accel = *unbalance;;
+  Vector &accel = this->getUnbalanceWork();;
   accel = myNode->getTrialAccel();
   int i;
   
@@ -519,7 +467,7 @@ DOF_Group::incrNodeDisp(const Vector &u)
 {
   assert(myNode != nullptr);
 
-  Vector &disp = *unbalance;
+  Vector &disp = this->getUnbalanceWork();
 
   assert(disp.Size() != 0);
 
@@ -545,7 +493,7 @@ DOF_Group::incrNodeVel(const Vector &udot)
 {
   assert(myNode != nullptr);
     
-  Vector &vel = *unbalance;
+  Vector &vel = this->getUnbalanceWork();
   
   // get vel for my dof out of vector udot
   for (int i=0; i<numDOF; i++) {
@@ -570,7 +518,7 @@ DOF_Group::incrNodeAccel(const Vector &udotdot)
 
   assert(myNode != nullptr);
 
-  Vector &accel = *unbalance;
+  Vector &accel = this->getUnbalanceWork();
   
   // get disp for the unconstrained dof
   for (int i=0; i<numDOF; i++) {
@@ -611,7 +559,7 @@ void
 DOF_Group::setEigenvector(int mode, const Vector &theVector)
 {
   assert(myNode != nullptr);
-  Vector &eigenvector = *unbalance;
+  Vector &eigenvector = this->getUnbalanceWork();
   
   // get disp for the unconstrained dof
   for (int i=0; i<numDOF; i++) {
@@ -646,7 +594,7 @@ void
 DOF_Group::addLocalM_Force(const Vector &accel, double fact)
 {
   assert(myNode != nullptr);
-  unbalance->addMatrixVector(1.0, myNode->getMass(), accel, fact);
+  this->getUnbalanceWork().addMatrixVector(1.0, myNode->getMass(), accel, fact);
 }
 
 
@@ -654,7 +602,7 @@ DOF_Group::addLocalM_Force(const Vector &accel, double fact)
 const Vector &
 DOF_Group::getDispSensitivity(int gradNumber)
 {
-  Vector &result = *unbalance;
+  Vector &result = this->getUnbalanceWork();
   for (int i=0; i<numDOF; i++) {
     result(i) = myNode->getDispSensitivity(i+1,gradNumber);
   }
@@ -664,7 +612,7 @@ DOF_Group::getDispSensitivity(int gradNumber)
 const Vector &
 DOF_Group::getVelSensitivity(int gradNumber)
 {
-    Vector &result = *unbalance;
+    Vector &result = this->getUnbalanceWork();
     for (int i=0; i<numDOF; i++)
       result(i) = myNode->getVelSensitivity(i+1,gradNumber);
 
@@ -674,7 +622,7 @@ DOF_Group::getVelSensitivity(int gradNumber)
 const Vector &
 DOF_Group::getAccSensitivity(int gradNumber)
 {
-    Vector &result = *unbalance;
+    Vector &result = this->getUnbalanceWork();
     for (int i=0; i<numDOF; i++)
       result(i) = myNode->getAccSensitivity(i+1,gradNumber);
 
@@ -686,7 +634,7 @@ DOF_Group::getAccSensitivity(int gradNumber)
 int 
 DOF_Group::saveDispSensitivity(const Vector &v, int gradNum, int numGrads)
 {
-  Vector &dudh = *unbalance;
+  Vector &dudh = this->getUnbalanceWork();
 
   for (int i = 0; i < numDOF; i++) {
     int loc = myID(i);
@@ -702,7 +650,7 @@ DOF_Group::saveDispSensitivity(const Vector &v, int gradNum, int numGrads)
 int 
 DOF_Group::saveVelSensitivity(const Vector &v, int gradNum, int numGrads)
 {
-  Vector &dudh = *unbalance;
+  Vector &dudh = this->getUnbalanceWork();
 
   for (int i = 0; i < numDOF; i++) {
     int loc = myID(i);
@@ -718,7 +666,7 @@ DOF_Group::saveVelSensitivity(const Vector &v, int gradNum, int numGrads)
 int 
 DOF_Group::saveAccSensitivity(const Vector &v, int gradNum, int numGrads)
 {
-  Vector &dudh = *unbalance;
+  Vector &dudh = this->getUnbalanceWork();
 
   for (int i = 0; i < numDOF; i++) {
     int loc = myID(i);
@@ -759,7 +707,7 @@ DOF_Group::addM_ForceSensitivity(const Vector &Udotdot, double fact)
       else accel(i) = 0.0;
   }
       
-  unbalance->addMatrixVector(1.0, myNode->getMassSensitivity(), accel, fact);
+  this->getUnbalanceWork().addMatrixVector(1.0, myNode->getMassSensitivity(), accel, fact);
 }
 
 void
@@ -776,7 +724,7 @@ DOF_Group::addD_Force(const Vector &Udot, double fact)
       else vel(i) = 0.0;
   }
 
-  unbalance->addMatrixVector(1.0, myNode->getDamp(), vel, fact);
+  this->getUnbalanceWork().addMatrixVector(1.0, myNode->getDamp(), vel, fact);
 }
 
 void
@@ -793,7 +741,7 @@ DOF_Group::addD_ForceSensitivity(const Vector &Udot, double fact)
       else vel(i) = 0.0;
   }
 
-  unbalance->addMatrixVector(1.0, myNode->getDampSensitivity(), vel, fact);
+  this->getUnbalanceWork().addMatrixVector(1.0, myNode->getDampSensitivity(), vel, fact);
 }
 
 // AddingSensitivity:END //////////////////////////////////////////
@@ -835,7 +783,23 @@ DOF_Group::getDampingBetaForce(int mode, double beta)
   for (int i=0; i<numDOF; i++)
     eigenvector(i) = eigenVectors(i,mode);
 
-  unbalance->addMatrixVector(0.0, mass, eigenvector, -beta);
-  return *unbalance;
+  this->getUnbalanceWork().addMatrixVector(0.0, mass, eigenvector, -beta);
+  return this->getUnbalanceWork();
+}
+
+
+Matrix &
+DOF_Group::getTangentWork()
+{
+    if (theTangent != nullptr)
+      return *theTangent;
+    return getWorkArea(numDOF).tangent;
 }
 
+Vector &
+DOF_Group::getUnbalanceWork()
+{
+    if (theUnbalance != nullptr)
+      return *theUnbalance;
+    return getWorkArea(numDOF).unbalance;
+}
@@ -126,20 +126,20 @@ class DOF_Group: public TaggedObject
    protected:
     void  addLocalM_Force(const Vector &Udotdot, double fact = 1.0);     
 
+    // return the tangent and unbalance storage; these are the
+    // thread-local work areas unless the object owns its own
+    Matrix &getTangentWork();
+    Vector &getUnbalanceWork();
+
     // protected variables - a copy for each object of the class            
-    Vector *unbalance;
-    Matrix *tangent;
     Node   *myNode;
     
   private:
     // private variables - a copy for each object of the class        
+    Vector *theUnbalance;
+    Matrix *theTangent;
     ID 	myID;
     int numDOF;
-
-    // static variables - single copy for all objects of the class	    
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numDOFs;          // number of objects    
 };
 
 #endif
@@ -536,8 +536,8 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
 #endif // TRANSF_INCREMENTAL_MP
 
   Matrix *T = this->getT();
-  // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  // this->getUnbalanceWork() = (*T) * (*modUnbalance);
+  this->getUnbalanceWork().addMatrixVector(0.0, *T, *modUnbalance, 1.0);
 
   const Vector &disp = myNode->getTrialDisp();
 
@@ -545,16 +545,16 @@ TransformationDOF_Group::setNodeDisp(const Vector &u)
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
 #ifdef TRANSF_INCREMENTAL_MP
-      (*unbalance)(i) = 0.0; // don't enfore the SP here as in incrNodeDisp!
+      this->getUnbalanceWork()(i) = 0.0; // don't enfore the SP here as in incrNodeDisp!
 #else
-      (*unbalance)(i) = disp(i);
+      this->getUnbalanceWork()(i) = disp(i);
 #endif // TRANSF_INCREMENTAL_MP
   }
 
 #ifdef TRANSF_INCREMENTAL_MP
-  myNode->incrTrialDisp(*unbalance);
+  myNode->incrTrialDisp(this->getUnbalanceWork());
 #else
-  myNode->setTrialDisp(*unbalance);
+  myNode->setTrialDisp(this->getUnbalanceWork());
 #endif // #ifdef TRANSF_INCREMENTAL_MP
 }
 
@@ -591,16 +591,16 @@ TransformationDOF_Group::setNodeVel(const Vector &u)
   }
 
   Matrix *T = this->getT();
-  // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  // this->getUnbalanceWork() = (*T) * (*modUnbalance);
+  this->getUnbalanceWork().addMatrixVector(0.0, *T, *modUnbalance, 1.0);
 
   const Vector &vel = myNode->getTrialVel();
   int numDOF = myNode->getNumberDOF();
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
-      (*unbalance)(i) = vel(i);
+      this->getUnbalanceWork()(i) = vel(i);
   }
-  myNode->setTrialVel(*unbalance);
+  myNode->setTrialVel(this->getUnbalanceWork());
 }
 
 
@@ -638,15 +638,15 @@ TransformationDOF_Group::setNodeAccel(const Vector &u)
   }
 
     Matrix *T = this->getT();
-    // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    // this->getUnbalanceWork() = (*T) * (*modUnbalance);
+    this->getUnbalanceWork().addMatrixVector(0.0, *T, *modUnbalance, 1.0);
     const Vector &accel = myNode->getTrialAccel();
     int numDOF = myNode->getNumberDOF();
     for (int i=0; i<numDOF; i++) {
       if (theSPs[i] != 0)
-	(*unbalance)(i) = accel(i);
+	this->getUnbalanceWork()(i) = accel(i);
     }
-    myNode->setTrialAccel(*unbalance);
+    myNode->setTrialAccel(this->getUnbalanceWork());
 }
 
 
@@ -678,15 +678,15 @@ TransformationDOF_Group::incrNodeDisp(const Vector &u)
 #endif // TRANSF_INCREMENTAL_MP
 
    Matrix *T = this->getT();
-   // *unbalance = (*T) * (*modUnbalance);
-   unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+   // this->getUnbalanceWork() = (*T) * (*modUnbalance);
+   this->getUnbalanceWork().addMatrixVector(0.0, *T, *modUnbalance, 1.0);
    
    int numDOF = myNode->getNumberDOF();
    for (int i=0; i<numDOF; i++) {
      if (theSPs[i] != 0)
-       (*unbalance)(i) = 0.0;
+       this->getUnbalanceWork()(i) = 0.0;
    }
-   myNode->incrTrialDisp(*unbalance);
+   myNode->incrTrialDisp(this->getUnbalanceWork());
 }
 
 
@@ -709,15 +709,15 @@ TransformationDOF_Group::incrNodeVel(const Vector &u)
   }    
   Matrix *T = this->getT();
   
-  // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  // this->getUnbalanceWork() = (*T) * (*modUnbalance);
+  this->getUnbalanceWork().addMatrixVector(0.0, *T, *modUnbalance, 1.0);
   
   int numDOF = myNode->getNumberDOF();
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
-      (*unbalance)(i) = 0.0;
+      this->getUnbalanceWork()(i) = 0.0;
   }
-  myNode->incrTrialVel(*unbalance);
+  myNode->incrTrialVel(this->getUnbalanceWork());
 }
 
 
@@ -740,14 +740,14 @@ TransformationDOF_Group::incrNodeAccel(const Vector &u)
   }    
   Matrix *T = this->getT();
 
-  // *unbalance = (*T) * (*modUnbalance);
-  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+  // this->getUnbalanceWork() = (*T) * (*modUnbalance);
+  this->getUnbalanceWork().addMatrixVector(0.0, *T, *modUnbalance, 1.0);
   int numDOF = myNode->getNumberDOF();
   for (int i=0; i<numDOF; i++) {
     if (theSPs[i] != 0)
-      (*unbalance)(i) = 0.0;
+      this->getUnbalanceWork()(i) = 0.0;
   }
-  myNode->incrTrialAccel(*unbalance);
+  myNode->incrTrialAccel(this->getUnbalanceWork());
 }
 
 const Vector & 
@@ -874,9 +874,9 @@ TransformationDOF_Group::setEigenvector(int mode, const Vector &u)
   Matrix *T = this->getT();
 
     if (T != 0) {
-      // *unbalance = (*T) * (*modUnbalance);
-      unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
-      myNode->setEigenvector(mode, *unbalance);
+      // this->getUnbalanceWork() = (*T) * (*modUnbalance);
+      this->getUnbalanceWork().addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+      myNode->setEigenvector(mode, this->getUnbalanceWork());
     } else
       myNode->setEigenvector(mode, *modUnbalance);
 }
@@ -1071,13 +1071,13 @@ TransformationDOF_Group::enforceSPs(int doMP)
 	Matrix *T = this->getT();
 	if (T != 0) {
 	  
-	  // *unbalance = (*T) * (*modUnbalance);
-	  unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+	  // this->getUnbalanceWork() = (*T) * (*modUnbalance);
+	  this->getUnbalanceWork().addMatrixVector(0.0, *T, *modUnbalance, 1.0);
 	  
 	  const ID &constrainedDOF = theMP->getConstrainedDOFs();
 	  for (int i=0; i<constrainedDOF.Size(); i++) {
 	    int cDOF = constrainedDOF(i);
-	    myNode->setTrialDisp((*unbalance)(cDOF), cDOF);
+	    myNode->setTrialDisp(this->getUnbalanceWork()(cDOF), cDOF);
 	  }
 	}
       }
@@ -1226,14 +1226,14 @@ TransformationDOF_Group::saveDispSensitivity(const Vector &u,
   Matrix *T = this->getT();
   if (T != 0) {
     
-    // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    // this->getUnbalanceWork() = (*T) * (*modUnbalance);
+    this->getUnbalanceWork().addMatrixVector(0.0, *T, *modUnbalance, 1.0);
     
   } else
-    *unbalance = *modUnbalance;
+    this->getUnbalanceWork() = *modUnbalance;
 
 
-  myNode->saveDispSensitivity(*unbalance, gradNum, numGrads);
+  myNode->saveDispSensitivity(this->getUnbalanceWork(), gradNum, numGrads);
   
   return 0;
 }
@@ -1257,14 +1257,14 @@ TransformationDOF_Group::saveVelSensitivity(const Vector &u,
   Matrix *T = this->getT();
   if (T != 0) {
     
-    // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    // this->getUnbalanceWork() = (*T) * (*modUnbalance);
+    this->getUnbalanceWork().addMatrixVector(0.0, *T, *modUnbalance, 1.0);
     
   } else
-    *unbalance = *modUnbalance;
+    this->getUnbalanceWork() = *modUnbalance;
 
 
-  myNode->saveVelSensitivity(*unbalance, gradNum, numGrads);
+  myNode->saveVelSensitivity(this->getUnbalanceWork(), gradNum, numGrads);
   
   return 0;
 }
@@ -1288,14 +1288,14 @@ TransformationDOF_Group::saveAccSensitivity(const Vector &u,
   Matrix *T = this->getT();
   if (T != 0) {
     
-    // *unbalance = (*T) * (*modUnbalance);
-    unbalance->addMatrixVector(0.0, *T, *modUnbalance, 1.0);
+    // this->getUnbalanceWork() = (*T) * (*modUnbalance);
+    this->getUnbalanceWork().addMatrixVector(0.0, *T, *modUnbalance, 1.0);
     
   } else
-    *unbalance = *modUnbalance;
+    this->getUnbalanceWork() = *modUnbalance;
 
 
-  myNode->saveAccelSensitivity(*unbalance, gradNum, numGrads);
+  myNode->saveAccelSensitivity(this->getUnbalanceWork(), gradNum, numGrads);
   
   return 0;
 }
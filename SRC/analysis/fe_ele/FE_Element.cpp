@@ -38,13 +38,32 @@
 #include <AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <Profiler.h>
+#include <memory>
 
 #define MAX_NUM_DOF 64
 
-// static variables initialisation
-Matrix **FE_Element::theMatrices; // pointers to class wide matrices
-Vector **FE_Element::theVectors;  // pointers to class widde vectors
-int FE_Element::numFEs(0);           // number of objects
+namespace {
+// Work areas used to return the tangent and residual of FE_Elements with
+// at most MAX_NUM_DOF dof. There is one set per thread so that the
+// contributions of several FE_Elements may be formed concurrently.
+struct WorkArea {
+  WorkArea(int n) : tangent(n, n), residual(n) {}
+  Matrix tangent;
+  Vector residual;
+};
+
+WorkArea &
+getWorkArea(int numDOF)
+{
+  thread_local std::unique_ptr<WorkArea> theAreas[MAX_NUM_DOF+1];
+
+  if (theAreas[numDOF] == nullptr)
+    theAreas[numDOF] = std::make_unique<WorkArea>(numDOF);
+
+  return *theAreas[numDOF];
+}
+} // namespace
 
 //  FE_Element(Element *, Integrator *theIntegrator);
 //        construictor that take the corresponding model element.
@@ -73,38 +92,13 @@ FE_Element::FE_Element(int tag, Element *ele)
         myDOF_Groups(i) = dofGrpPtr->getTag();
     }
 
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-        theMatrices = new Matrix *[MAX_NUM_DOF+1];
-        theVectors  = new Vector *[MAX_NUM_DOF+1];
-
-        for (int i=0; i<MAX_NUM_DOF; i++) {
-            theMatrices[i] = nullptr;
-            theVectors[i]  = nullptr;
-        }
-    }
-
     if (ele->isSubdomain() == false) {
 
-        // if Elements are not subdomains, set up pointers to
-        // objects to return tangent Matrix and residual Vector.
-        if (numDOF <= MAX_NUM_DOF) {
-            // use class wide objects
-            if (theVectors[numDOF] == nullptr) {
-                theVectors[numDOF] = new Vector(numDOF);
-                theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-                theResidual = theVectors[numDOF];
-                theTangent = theMatrices[numDOF];
-
-            } else {
-                theResidual = theVectors[numDOF];
-                theTangent = theMatrices[numDOF];
-            }
-
-        } else {
-            // create matrices and vectors for each object instance
+        // if Elements are not subdomains, objects with at most
+        // MAX_NUM_DOF dof use the thread-local work areas to return
+        // the tangent Matrix and residual Vector; larger ones
+        // create their own.
+        if (numDOF > MAX_NUM_DOF) {
             theResidual = new Vector(numDOF);
             theTangent  = new Matrix(numDOF, numDOF);
         }
@@ -117,9 +111,6 @@ FE_Element::FE_Element(int tag, Element *ele)
         Subdomain *theSub = (Subdomain *)ele;
         theSub->setFE_ElementPtr(this);
     }
-
-    // increment number of FE_Elements by 1
-    numFEs++;
 }
 
 
@@ -129,20 +120,6 @@ FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
    myEle(nullptr), theResidual(nullptr), theTangent(nullptr), theIntegrator(nullptr)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
-    numFEs++;
-
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-        theMatrices = new Matrix *[MAX_NUM_DOF+1];
-        theVectors  = new Vector *[MAX_NUM_DOF+1];
-
-        for (int i=0; i<MAX_NUM_DOF; i++) {
-          theMatrices[i] = nullptr;
-          theVectors[i]  = nullptr;
-        }
-    }
 
     // as subtypes have no access to the tangent or residual we don't set them
     // this way we can detect if subclass does not provide all methods it should
@@ -154,29 +131,11 @@ FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
 //        destructor.
 FE_Element::~FE_Element()
 {
-    // decrement number of FE_Elements
-    numFEs--;
-
     // delete tangent and residual if created specially
-    if (numDOF > MAX_NUM_DOF) {
-        if (theTangent != nullptr)
-          delete theTangent;
-        if (theResidual != nullptr) 
-          delete theResidual;
-    }
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numFEs == 0) {
-        for (int i=0; i<MAX_NUM_DOF; i++) {
-            if (theVectors[i] != nullptr)
-                delete theVectors[i];
-            if (theMatrices[i] != nullptr)
-                delete theMatrices[i];
-        }
-        delete [] theMatrices;
-        delete [] theVectors;
-    }
+    if (theTangent != nullptr)
+      delete theTangent;
+    if (theResidual != nullptr) 
+      delete theResidual;
 }
 
 
@@ -242,7 +201,7 @@ FE_Element::getTangent(Integrator *theNewIntegrator)
     if (theNewIntegrator != nullptr)
       theNewIntegrator->formEleTangent(this);
 
-    return *theTangent;
+    return this->getTangentWork();
 
   } else {
     Subdomain *theSub = (Subdomain *)myEle;
@@ -259,7 +218,7 @@ FE_Element::zeroTangent()
 {
     assert(myEle != nullptr);
     assert(myEle->isSubdomain() == false);
-    theTangent->Zero();
+    this->getTangentWork().Zero();
 }
 
 void
@@ -271,8 +230,9 @@ FE_Element::addKtToTang(double fact)
     // check for a quick return
     if (fact == 0.0)
         return;
-    else
-        theTangent->addMatrix(myEle->getTangentStiff(),fact);
+
+    OPS_PROFILE(ElementTangent, *myEle);
+    this->getTangentWork().addMatrix(myEle->getTangentStiff(),fact);
 }
 
 void
@@ -285,7 +245,7 @@ FE_Element::addCtoTang(double fact)
     if (fact == 0.0)
       return;
     else
-      theTangent->addMatrix(myEle->getDamp(),fact);
+      this->getTangentWork().addMatrix(myEle->getDamp(),fact);
 }
 
 void
@@ -298,7 +258,7 @@ FE_Element::addMtoTang(double fact)
     if (fact == 0.0)
       return;
     else
-      theTangent->addMatrix(myEle->getMass(),fact);
+      this->getTangentWork().addMatrix(myEle->getMass(),fact);
   }
 }
 
@@ -314,7 +274,7 @@ FE_Element::addKiToTang(double fact)
       return;
 
     else // if (myEle->isSubdomain() == false)
-      theTangent->addMatrix(myEle->getInitialStiff(), fact);
+      this->getTangentWork().addMatrix(myEle->getInitialStiff(), fact);
   }
 }
 
@@ -329,7 +289,7 @@ FE_Element::addKgToTang(double fact)
       return;
 
     else
-      theTangent->addMatrix(myEle->getGeometricTangentStiff(), fact);
+      this->getTangentWork().addMatrix(myEle->getGeometricTangentStiff(), fact);
   }
 }
 
@@ -344,7 +304,7 @@ FE_Element::addKpToTang(double fact, int numP)
     else if (myEle->isSubdomain() == false) {
       const Matrix *thePrevMat = myEle->getPreviousK(numP);
       if (thePrevMat != nullptr)
-        theTangent->addMatrix(*thePrevMat, fact);
+        this->getTangentWork().addMatrix(*thePrevMat, fact);
 
     } else {
       opserr << "WARNING FE_Element::addKpToTang() - ";
@@ -372,13 +332,13 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
     theIntegrator = theNewIntegrator;
 
     if (theIntegrator == nullptr)
-      return *theResidual;
+      return this->getResidualWork();
 
     assert(myEle != nullptr);
 
     if (myEle->isSubdomain() == false) {
       theNewIntegrator->formEleResidual(this);
-      return *theResidual;
+      return this->getResidualWork();
 
     } else {
       Subdomain *theSub = (Subdomain *)myEle;
@@ -393,7 +353,7 @@ FE_Element::zeroResidual()
   assert(myEle != nullptr);
   assert(myEle->isSubdomain() == false);
 
-  theResidual->Zero();
+  this->getResidualWork().Zero();
 }
 
 
@@ -408,8 +368,9 @@ FE_Element::addRtoResidual(double fact)
     return;
 
   else {
+    OPS_PROFILE(ElementResidual, *myEle);
     const Vector &eleResisting = myEle->getResistingForce();
-    theResidual->addVector(1.0, eleResisting, -fact);
+    this->getResidualWork().addVector(1.0, eleResisting, -fact);
   }
 }
 
@@ -425,8 +386,9 @@ FE_Element::addRIncInertiaToResidual(double fact)
       return;
 
   else {
+    OPS_PROFILE(ElementResidual, *myEle);
     const Vector &eleResisting = myEle->getResistingForceIncInertia();
-    theResidual->addVector(1.0, eleResisting, -fact);
+    this->getResidualWork().addVector(1.0, eleResisting, -fact);
   }
 }
 
@@ -437,11 +399,11 @@ FE_Element::getTangForce(const Vector &disp, double fact)
     assert(myEle != nullptr);
 
     // zero out the force vector
-    theResidual->Zero();
+    this->getResidualWork().Zero();
 
     // check for a quick return
     if (fact == 0.0)
-      return *theResidual;
+      return this->getResidualWork();
 
     // get the components we need out of the vector
     // and place in a temporary vector
@@ -457,12 +419,12 @@ FE_Element::getTangForce(const Vector &disp, double fact)
     if (myEle->isSubdomain() == false) {
       // form the tangent again and then add the force
       theIntegrator->formEleTangent(this);
-      theResidual->addMatrixVector(1.0, *theTangent,tmp,fact);
+      this->getResidualWork().addMatrixVector(1.0, this->getTangentWork(),tmp,fact);
 
     } else {
-      theResidual->addMatrixVector(1.0, ((Subdomain *)myEle)->getTang(),tmp,fact);
+      this->getResidualWork().addMatrixVector(1.0, ((Subdomain *)myEle)->getTang(),tmp,fact);
     }
-    return *theResidual;
+    return this->getResidualWork();
 }
 
 
@@ -473,11 +435,11 @@ FE_Element::getK_Force(const Vector &disp, double fact)
     assert(myEle != nullptr);
 
     // zero out the force vector
-    theResidual->Zero();
+    this->getResidualWork().Zero();
 
     // check for a quick return
     if (fact == 0.0)
-        return *theResidual;
+        return this->getResidualWork();
 
     // get the components we need out of the vector
     // and place in a temporary vector
@@ -490,9 +452,9 @@ FE_Element::getK_Force(const Vector &disp, double fact)
         tmp(i) = 0.0;
     }
 
-    theResidual->addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact);
+    this->getResidualWork().addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact);
 
-    return *theResidual;
+    return this->getResidualWork();
 }
 
 
@@ -502,11 +464,11 @@ FE_Element::getKi_Force(const Vector &disp, double fact)
     assert(myEle != nullptr);
 
     // zero out the force vector
-    theResidual->Zero();
+    this->getResidualWork().Zero();
 
     // check for a quick return
     if (fact == 0.0)
-      return *theResidual;
+      return this->getResidualWork();
 
     // get the components we need out of the vector
     // and place in a temporary vector
@@ -519,9 +481,9 @@ FE_Element::getKi_Force(const Vector &disp, double fact)
         tmp(i) = 0.0;
     }
 
-    theResidual->addMatrixVector(1.0, myEle->getInitialStiff(), tmp, fact);
+    this->getResidualWork().addMatrixVector(1.0, myEle->getInitialStiff(), tmp, fact);
 
-    return *theResidual;
+    return this->getResidualWork();
 
 }
 
@@ -531,11 +493,11 @@ FE_Element::getM_Force(const Vector &disp, double fact)
     assert(myEle != nullptr);
 
     // zero out the force vector
-    theResidual->Zero();
+    this->getResidualWork().Zero();
 
     // check for a quick return
     if (fact == 0.0)
-        return *theResidual;
+        return this->getResidualWork();
 
     // get the components we need out of the vector
     // and place in a temporary vector
@@ -548,9 +510,9 @@ FE_Element::getM_Force(const Vector &disp, double fact)
         tmp(i) = 0.0;
     }
 
-    theResidual->addMatrixVector(1.0, myEle->getMass(), tmp, fact);
+    this->getResidualWork().addMatrixVector(1.0, myEle->getMass(), tmp, fact);
 
-    return *theResidual;
+    return this->getResidualWork();
 }
 
 const Vector &
@@ -559,11 +521,11 @@ FE_Element::getC_Force(const Vector &disp, double fact)
   assert(myEle != nullptr);
 
   // zero out the force vector
-  theResidual->Zero();
+  this->getResidualWork().Zero();
 
   // check for a quick return
   if (fact == 0.0)
-      return *theResidual;
+      return this->getResidualWork();
 
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -576,9 +538,9 @@ FE_Element::getC_Force(const Vector &disp, double fact)
       tmp(i) = 0.0;
   }
 
-  theResidual->addMatrixVector(1.0, myEle->getDamp(), tmp, fact);
+  this->getResidualWork().addMatrixVector(1.0, myEle->getDamp(), tmp, fact);
 
-  return *theResidual;
+  return this->getResidualWork();
 }
 
 
@@ -595,18 +557,18 @@ FE_Element::getLastResponse()
     assert(myEle != nullptr);
 
     if (theIntegrator != nullptr) {
-      if (theIntegrator->getLastResponse(*theResidual,myID) < 0) {
+      if (theIntegrator->getLastResponse(this->getResidualWork(),myID) < 0) {
         opserr << "WARNING FE_Element::getLastResponse()";
         opserr << " - the Integrator had problems with getLastResponse()\n";
       }
     }
     else {
-      theResidual->Zero();
+      this->getResidualWork().Zero();
       opserr << "WARNING  FE_Element::getLastResponse()";
       opserr << " No Integrator yet passed\n";
     }
 
-    Vector &result = *theResidual;
+    Vector &result = this->getResidualWork();
     return result;
 }
 
@@ -631,7 +593,7 @@ FE_Element::addM_Force(const Vector &accel, double fact)
             tmp(i) = 0.0;
     }
 
-    theResidual->addMatrixVector(1.0, myEle->getMass(), tmp, fact);
+    this->getResidualWork().addMatrixVector(1.0, myEle->getMass(), tmp, fact);
 
 }
 
@@ -656,7 +618,7 @@ FE_Element::addD_Force(const Vector &accel, double fact)
         tmp(i) = 0.0;
   }
 
-  theResidual->addMatrixVector(1.0, myEle->getDamp(), tmp, fact);
+  this->getResidualWork().addMatrixVector(1.0, myEle->getDamp(), tmp, fact);
 }
 
 void
@@ -680,7 +642,7 @@ FE_Element::addK_Force(const Vector &disp, double fact)
         tmp(i) = 0.0;
   }
 
-  theResidual->addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact);
+  this->getResidualWork().addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact);
 }
 
 void
@@ -705,7 +667,7 @@ FE_Element::addKg_Force(const Vector &disp, double fact)
         tmp(i) = 0.0;
   }
 
-  theResidual->addMatrixVector(1.0, myEle->getGeometricTangentStiff(), tmp, fact);
+  this->getResidualWork().addMatrixVector(1.0, myEle->getGeometricTangentStiff(), tmp, fact);
 }
 
 
@@ -719,7 +681,7 @@ FE_Element::addLocalM_Force(const Vector &accel, double fact)
   if (fact == 0.0)
     return;
 
-  theResidual->addMatrixVector(1.0, myEle->getMass(), accel, fact);
+  this->getResidualWork().addMatrixVector(1.0, myEle->getMass(), accel, fact);
 }
 
 void
@@ -732,7 +694,7 @@ FE_Element::addLocalD_Force(const Vector &accel, double fact)
   if (fact == 0.0)
       return;
 
-  if (theResidual->addMatrixVector(1.0, myEle->getDamp(), accel, fact) < 0){
+  if (this->getResidualWork().addMatrixVector(1.0, myEle->getDamp(), accel, fact) < 0){
     opserr << "WARNING FE_Element::addLocalD_Force() - ";
     opserr << "- addMatrixVector returned error\n";
   }
@@ -750,7 +712,7 @@ FE_Element::getElement()
 void
 FE_Element::addResistingForceSensitivity(int gradNumber, double fact)
 {
-  theResidual->addVector(1.0, myEle->getResistingForceSensitivity(gradNumber), -fact);
+  this->getResidualWork().addVector(1.0, myEle->getResistingForceSensitivity(gradNumber), -fact);
 }
 
 void
@@ -767,7 +729,7 @@ FE_Element::addM_ForceSensitivity(int gradNumber, const Vector &vect, double fac
       tmp(i) = 0.0;
     }
   }
-  if (theResidual->addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),tmp,fact) < 0) {
+  if (this->getResidualWork().addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),tmp,fact) < 0) {
     opserr << "WARNING FE_Element::addM_ForceSensitivity() - ";
     opserr << "- addMatrixVector returned error\n";
   }
@@ -793,7 +755,7 @@ FE_Element::addD_ForceSensitivity(int gradNumber, const Vector &vect, double fac
         else
           tmp(i) = 0.0;
       }
-      if (theResidual->addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber), tmp, fact) < 0){
+      if (this->getResidualWork().addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber), tmp, fact) < 0){
         opserr << "WARNING FE_Element::addD_ForceSensitivity() - ";
         opserr << "- addMatrixVector returned error\n";
       }
@@ -813,7 +775,7 @@ FE_Element::addLocalD_ForceSensitivity(int gradNumber, const Vector &accel, doub
         if (fact == 0.0)
             return;
         if (myEle->isSubdomain() == false) {
-            if (theResidual->addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber),
+            if (this->getResidualWork().addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber),
                                              accel, fact) < 0){
 
               opserr << "WARNING FE_Element::addLocalD_ForceSensitivity() - ";
@@ -841,7 +803,7 @@ FE_Element::addLocalM_ForceSensitivity(int gradNumber, const Vector &accel, doub
     if (fact == 0.0)
         return;
 
-    if (theResidual->addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber), accel, fact) < 0) {
+    if (this->getResidualWork().addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber), accel, fact) < 0) {
       opserr << "WARNING FE_Element::addLocalD_ForceSensitivity() - ";
       opserr << "- addMatrixVector returned error\n";
     }
@@ -870,6 +832,14 @@ FE_Element::updateElement()
   return 0;
 }
 
+bool
+FE_Element::isThreadSafe() const
+{
+  return myEle != nullptr 
+      && myEle->isSubdomain() == false
+      && myEle->isThreadSafe();
+}
+
 #if 0
 void FE_Element::activate()
 {
@@ -893,3 +863,20 @@ bool FE_Element::isActive()
     }
 }
 #endif
+
+
+Matrix &
+FE_Element::getTangentWork()
+{
+    if (theTangent != nullptr)
+      return *theTangent;
+    return getWorkArea(numDOF).tangent;
+}
+
+Vector &
+FE_Element::getResidualWork()
+{
+    if (theResidual != nullptr)
+      return *theResidual;
+    return getWorkArea(numDOF).residual;
+}
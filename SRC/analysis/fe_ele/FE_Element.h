@@ -83,6 +83,10 @@ class FE_Element: public TaggedObject
 
     virtual int updateElement();
 
+    // true if the contributions of this object may be formed
+    // concurrently with those of other FE_Elements
+    virtual bool isThreadSafe() const;
+
     virtual Integrator   *getLastIntegrator();
     virtual const Vector &getLastResponse();
     Element *getElement();
@@ -115,13 +119,10 @@ class FE_Element: public TaggedObject
     Matrix        *theTangent;
     Integrator    *theIntegrator; // need for Subdomain
 
-    //
-    // static variables
-    //
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numFEs;           // number of objects
-
+    // return the tangent and residual storage; these are the
+    // thread-local work areas unless the object owns its own
+    Matrix &getTangentWork();
+    Vector &getResidualWork();
 };
 
 #endif
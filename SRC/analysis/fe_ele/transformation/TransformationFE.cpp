@@ -383,6 +383,15 @@ TransformationFE::getTangent(Integrator *theNewIntegrator)
 }
 
 
+bool
+TransformationFE::isThreadSafe() const
+{
+  // the transformed tangent and residual are returned in class-wide
+  // storage
+  return false;
+}
+
+
 const Vector &
 TransformationFE::getResidual(Integrator *theNewIntegrator)
 
@@ -68,6 +68,7 @@ class TransformationFE: public FE_Element
     
     const Vector &getLastResponse(void);
     int addSP(SP_Constraint &theSP);
+    bool isThreadSafe() const;
 
 
     // AddingSensitivity:BEGIN ////////////////////////////////////
@@ -60,6 +60,13 @@ ConstraintHandler::doneNumberingDOF(void)
   return 0;
 }
 
+int
+ConstraintHandler::handleElements(const std::vector<int> &eleTags,
+                                  std::vector<FE_Element *> &created)
+{
+  return -1;
+}
+
 void 
 ConstraintHandler::setLinks(Domain &theDomain, 
 			    AnalysisModel &theModel,
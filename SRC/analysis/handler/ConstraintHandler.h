@@ -39,6 +39,7 @@
 // What: "@(#) ConstraintHandler.h, revA"
 
 #include <MovableObject.h>
+#include <vector>
 
 class AnalysisMethod;
 class ID;
@@ -46,6 +47,7 @@ class Domain;
 class AnalysisModel;
 class Integrator;
 class FEM_ObjectBroker;
+class FE_Element;
 
 class ConstraintHandler : public MovableObject
 {
@@ -64,6 +66,15 @@ class ConstraintHandler : public MovableObject
     virtual int doneNumberingDOF(void);
     virtual void clearAll(void) =0;    
 
+    // Bring the FE_Elements of the elements with the given tags in line
+    // with the Domain (removing those of elements no longer in it and
+    // creating them for elements added since handle()), leaving the
+    // DOF_Groups and their numbering as they are. The FE_Elements created
+    // are returned in created. A handler which cannot do this returns a
+    // negative number, and the model must then be handle()'d again.
+    virtual int handleElements(const std::vector<int> &eleTags,
+                               std::vector<FE_Element *> &created);
+
   protected:
     Domain *getDomainPtr(void) const;
     AnalysisModel *getAnalysisModelPtr(void) const;
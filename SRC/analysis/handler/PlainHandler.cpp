@@ -213,7 +213,8 @@ PlainHandler::handle(const ID *nodesLast)
     ElementIter &theEle = theDomain->getElements();
     Element *elePtr;
 
-    int numFe = 0;    
+    theFEs.clear();
+    numFe = 0;    
     FE_Element *fePtr;
     while ((elePtr = theEle()) != nullptr) {
 
@@ -233,6 +234,7 @@ PlainHandler::handle(const ID *nodesLast)
 
 	  theModel->addFE_Element(fePtr);
 	  theSub->setFE_ElementPtr(fePtr);
+	  theFEs[elePtr->getTag()] = fePtr;
 
 	}
 
@@ -241,15 +243,67 @@ PlainHandler::handle(const ID *nodesLast)
 	// just a regular element .. create an FE_Element for it & add to AnalysisModel
         fePtr = new FE_Element(numFe++, elePtr);
 	theModel->addFE_Element(fePtr);
+	theFEs[elePtr->getTag()] = fePtr;
       }
     }
     return count3;
 }
 
 
+int
+PlainHandler::handleElements(const std::vector<int> &eleTags,
+                             std::vector<FE_Element *> &created)
+{
+    Domain *theDomain = this->getDomainPtr();
+    AnalysisModel *theModel = this->getAnalysisModelPtr();
+    if (theDomain == nullptr || theModel == nullptr)
+	return -1;
+
+    for (int eleTag : eleTags) {
+	// drop the FE_Element of the element previously in the domain
+	// with this tag; the element itself may already be deleted
+	auto found = theFEs.find(eleTag);
+	if (found != theFEs.end()) {
+	    FE_Element *fePtr = theModel->removeFE_Element(found->second->getTag());
+	    theFEs.erase(found);
+	    for (auto it = created.begin(); it != created.end(); it++)
+		if (*it == fePtr) {
+		    created.erase(it);
+		    break;
+		}
+	    delete fePtr;
+	}
+
+	Element *elePtr = theDomain->getElement(eleTag);
+	if (elePtr == nullptr)
+	    continue;
+
+	// subdomains and elements on nodes without DOF_Groups (i.e.
+	// nodes added since handle()) need the whole model handled
+	if (elePtr->isSubdomain() == true)
+	    return -1;
+	const ID &nodes = elePtr->getExternalNodes();
+	for (int i=0; i<nodes.Size(); i++) {
+	    Node *nodPtr = theDomain->getNode(nodes(i));
+	    if (nodPtr == nullptr || nodPtr->getDOF_GroupPtr() == nullptr)
+		return -1;
+	}
+
+	FE_Element *fePtr = new FE_Element(numFe++, elePtr);
+	theModel->addFE_Element(fePtr);
+	fePtr->setID();
+	theFEs[eleTag] = fePtr;
+	created.push_back(fePtr);
+    }
+
+    return 0;
+}
+
 void 
 PlainHandler::clearAll(void)
 {
+  theFEs.clear();
+
   // for the nodes reset the DOF_Group pointers to 0
   Domain *theDomain = this->getDomainPtr();
   if (theDomain == nullptr)
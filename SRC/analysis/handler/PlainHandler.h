@@ -31,6 +31,7 @@
 #define PlainHandler_h
 
 #include <ConstraintHandler.h>
+#include <unordered_map>
 
 class FE_Element;
 class DOF_Group;
@@ -43,6 +44,8 @@ class PlainHandler : public ConstraintHandler
 
     int handle(const ID *nodesNumberedLast =nullptr);
     void clearAll(void);    
+    int handleElements(const std::vector<int> &eleTags,
+                       std::vector<FE_Element *> &created);
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -51,7 +54,10 @@ class PlainHandler : public ConstraintHandler
   protected:
     
   private:
-
+    // the FE_Element created for each element (by element tag), and
+    // the tag for the next FE_Element
+    std::unordered_map<int, FE_Element *> theFEs;
+    int numFe = 0;
 };
 
 #endif
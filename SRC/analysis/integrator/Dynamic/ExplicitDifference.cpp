@@ -1,5 +1,6 @@
 #include <ExplicitDifference.h>
 #include <FE_Element.h>
+#include <Element.h>
 #include <FE_EleIter.h>
 #include <LinearSOE.h>
 #include <AnalysisModel.h>
@@ -10,6 +11,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <classTags.h>
 #define OPS_Export 
 
 
@@ -30,7 +32,7 @@ ExplicitDifference::ExplicitDifference()
 	: TransientIntegrator(INTEGRATOR_TAGS_ExplicitDifference),
 	deltaT(0.0),
 	alphaM(0.0), betaK(0.0), betaKi(0.0), betaKc(0.0),
-	updateCount(0), c2(0.0), c3(0.0),
+	updateCount(0), massStamp(-1), c2(0.0), c3(0.0),
     Ut(0), Utdot(0), Utdotdot(0),
 	Udot(0), Utdotdot1(0), U(0), Utdot1(0)
 {
@@ -43,7 +45,7 @@ ExplicitDifference::ExplicitDifference(
 	: TransientIntegrator(INTEGRATOR_TAGS_ExplicitDifference),
 	deltaT(0.0),
 	alphaM(_alphaM), betaK(_betaK), betaKi(_betaKi), betaKc(_betaKc),
-	updateCount(0), c2(0.0), c3(0.0),
+	updateCount(0), massStamp(-1), c2(0.0), c3(0.0),
 	Ut(0), Utdot(0), Utdotdot(0),
 	Udot(0), Utdotdot1(0), U(0), Utdot1(0)
 {
@@ -121,6 +123,32 @@ int ExplicitDifference::newStep(double _deltaT)
 }
 
 
+int ExplicitDifference::formTangent(int statFlag)
+{
+	LinearSOE *theLinSOE = this->getLinearSOE();
+	AnalysisModel *theModel = this->getAnalysisModel();
+	if (theLinSOE == 0 || theModel == 0)
+		return this->TransientIntegrator::formTangent(statFlag);
+
+	// the tangent is just the mass; a DiagonalSOE keeps only its diagonal
+	// and DiagonalDirectSolver replaces that by its inverse on the first
+	// solve, so once it is formed there is nothing left to do each step
+	// (modal damping adds a matrix to the tangent, so it is excluded);
+	// adding or removing elements changes the numbering stamp of the
+	// model, even when the SOE keeps its size
+	bool cacheMass = theLinSOE->getClassTag() == LinSOE_TAGS_DiagonalSOE
+		&& theModel->inclModalDampingMatrix() == false;
+
+	if (cacheMass && massStamp == theModel->getNumberingStamp())
+		return 0;
+
+	int result = this->TransientIntegrator::formTangent(statFlag);
+	massStamp = (cacheMass && result == 0) ? theModel->getNumberingStamp() : -1;
+
+	return result;
+}
+
+
 int ExplicitDifference::formEleTangent(FE_Element *theEle)
 {
 	theEle->zeroTangent();
@@ -131,6 +159,31 @@ int ExplicitDifference::formEleTangent(FE_Element *theEle)
 }
 
 
+int ExplicitDifference::formEleResidual(FE_Element *theEle)
+{
+	theEle->zeroResidual();
+
+	// newStep() sets the nodal accelerations to zero, so the inertia
+	// force M*a vanishes; elements that declare no velocity dependent
+	// forces other than Rayleigh damping, and have none, skip it
+	Element *theElement = theEle->getElement();
+	if (theElement != 0 && theElement->hasOnlyRayleighDamping()
+		&& theElement->hasRayleighDamping() == false)
+		theEle->addRtoResidual();
+	else
+		theEle->addRIncInertiaToResidual();
+
+	return 0;
+}
+
+
+bool ExplicitDifference::isThreadSafe(void) const
+{
+	// the element contributions use no state of the integrator
+	return true;
+}
+
+
 int ExplicitDifference::formNodTangent(DOF_Group *theDof)
 {
 	theDof->zeroTangent();
@@ -149,6 +202,8 @@ int ExplicitDifference::domainChanged()
 	const Vector &x = theLinSOE->getX();
 	int size = x.Size();
 
+	// the SOE has been resized, so the mass must be formed again
+	massStamp = -1;
 
 
 	// if damping factors exist set them in the element & node of the domain
@@ -18,8 +18,17 @@ public:
 
 	                                                 
 
+	// with a DiagonalSOE the lumped mass is assembled (and inverted by
+	// the solver) only once after each domainChanged(); later calls
+	// leave the SOE as it is
+	int formTangent(int statFlag);
+
 	int formEleTangent(FE_Element *theEle);
 
+	// the nodal accelerations are zero while the residual is formed, so
+	// elements without Rayleigh damping only need getResistingForce()
+	int formEleResidual(FE_Element *theEle);
+
 	int formNodTangent(DOF_Group *theDof);
 	
 	const Vector & getVel(void);    //added for Modal damping
@@ -37,6 +46,8 @@ public:
 
 
 protected:
+	bool isThreadSafe(void) const;
+
 private:
 	double deltaT;
 	static double deltaT1;
@@ -46,6 +57,8 @@ private:
 	double betaKc;
 
 	int updateCount;
+	int massStamp;        // numbering stamp of the model whose lumped mass
+	                      // the DiagonalSOE holds, or -1
 	double c2, c3;
 	Vector *U, *Ut;
 	Vector  *Utdotdot, *Utdotdot1;
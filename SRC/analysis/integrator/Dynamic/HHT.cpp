@@ -217,6 +217,12 @@ int HHT::formEleTangent(FE_Element *theEle)
 }
 
 
+bool HHT::isThreadSafe(void) const
+{
+    return true;
+}
+
+
 int HHT::formNodTangent(DOF_Group *theDof)
 {
     theDof->zeroTangent();
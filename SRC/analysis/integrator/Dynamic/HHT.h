@@ -49,6 +49,7 @@ public:
     // to the system of equation object.
     int formEleTangent(FE_Element *theEle);
     int formNodTangent(DOF_Group *theDof);
+    bool isThreadSafe(void) const;
     
     int domainChanged(void);
     int newStep(double deltaT);
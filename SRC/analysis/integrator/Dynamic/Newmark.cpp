@@ -524,6 +524,13 @@ int Newmark::revertToStart()
     return 0;
 }
 
+bool
+Newmark::isThreadSafe(void) const
+{
+  // the sensitivity residual shares work vectors across elements
+  return sensitivityFlag == 0;
+}
+
 int Newmark::formEleResidual(FE_Element* theEle)
 {
   if (sensitivityFlag == 0) {  // no sensitivity
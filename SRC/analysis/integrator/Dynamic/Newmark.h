@@ -58,6 +58,7 @@ public:
     virtual int formNodTangent(DOF_Group *theDof)   final;
     virtual int formEleResidual(FE_Element* theEle) final;
     virtual int formNodUnbalance(DOF_Group* theDof) final;
+    virtual bool isThreadSafe(void) const;
     
     int domainChanged();    
     int newStep(double deltaT);
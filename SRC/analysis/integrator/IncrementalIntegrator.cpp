@@ -33,6 +33,13 @@
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <Domain.h>
+#include <ID.h>
+#include <OPS_Globals.h>
+#include <threads/global_pool.hpp>
+#include <Profiler.h>
+#include <algorithm>
+#include <cstdint>
 #include <cmath>
 
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
@@ -40,7 +47,8 @@ IncrementalIntegrator::IncrementalIntegrator(int clasTag)
  statusFlag(CURRENT_TANGENT), //theEigenSOE(0), 
  eigenVectors(0), eigenValues(0), dampingForces(0),isDiagonal(false),diagMass(0),
  mV(0),tmpV1(0),tmpV2(0),
- theSOE(0), theAnalysisModel(0), theTest(0)
+ theSOE(0), theAnalysisModel(0), theTest(0),
+ colorStamp(-1)
 {
   
 }
@@ -67,6 +75,7 @@ IncrementalIntegrator::setLinks(AnalysisModel &theModel, LinearSOE &theLinSOE, C
     theAnalysisModel = &theModel;
     theSOE = &theLinSOE;
     theTest = theConvergenceTest;
+    colorStamp = -1;
 }
 
 
@@ -85,22 +94,41 @@ IncrementalIntegrator::formTangent(int statFlag)
     // zero the A matrix of the linearSOE
     theSOE->zeroA();
 
-    // the loops to form and add the tangents are broken into two for 
-    // efficiency when performing parallel computations - CHANGE
-
     // loop through the FE_Elements adding their contributions to the tangent
+    if (this->formElementTangent() < 0)
+        result = -3;
+
+    return result;
+}
+
+int
+IncrementalIntegrator::formElementTangent(void)
+{
+    if (this->useThreadedAssembly())
+        return this->assembleThreaded(true);
+
+    int result = 0;
     FE_Element *elePtr;
     FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
-    while((elePtr = theEles2()) != nullptr)
-        if (theSOE->addA(elePtr->getTangent(this), elePtr->getID()) < 0) {
+    while((elePtr = theEles2()) != nullptr) {
+        const Matrix &theTangent = elePtr->getTangent(this);
+        OPS_PROFILE(SystemAssemble, *theSOE);
+        if (theSOE->addA(theTangent, elePtr->getID()) < 0) {
             opserr << "WARNING IncrementalIntegrator::formTangent -";
             opserr << " failed in addA for ID " << elePtr->getID();            
             result = -3;
         }
+    }
 
     return result;
 }
 
+bool
+IncrementalIntegrator::isThreadSafe(void) const
+{
+    return false;
+}
+
 int 
 IncrementalIntegrator::formTangent(int statFlag, double iFact, double cFact)
 {
@@ -220,6 +248,9 @@ IncrementalIntegrator::formNodalUnbalance(void)
 int 
 IncrementalIntegrator::formElementResidual(void)
 {
+    if (this->useThreadedAssembly())
+        return this->assembleThreaded(false);
+
     // loop through the FE_Elements and add the residual
     FE_Element *elePtr;
 
@@ -237,6 +268,137 @@ IncrementalIntegrator::formElementResidual(void)
     return res;            
 }
 
+
+bool
+IncrementalIntegrator::useThreadedAssembly(void) const
+{
+    return theSOE != nullptr && theAnalysisModel != nullptr
+        && theSOE->getNumThreads() > 1
+        && theSOE->isThreadSafe()
+        && this->isThreadSafe()
+        && !OpenSees::in_thread_pool();
+}
+
+//
+// Greedy coloring of the FE_Elements so that the elements of any one
+// color can be assembled concurrently. Each equation keeps a bit mask
+// of the colors already touching it; elements that cannot be given one
+// of the 64 available colors, or which are not thread-safe, are
+// assembled serially.
+//
+void
+IncrementalIntegrator::buildColors(void)
+{
+    serialFEs.clear();
+    colorFEs.clear();
+
+    std::vector<std::uint64_t> eqnColors(theAnalysisModel->getNumEqn(), 0);
+
+    FE_Element *elePtr;
+    FE_EleIter &theEles = theAnalysisModel->getFEs();
+    while ((elePtr = theEles()) != nullptr) {
+        if (!elePtr->isThreadSafe()) {
+            serialFEs.push_back(elePtr);
+            continue;
+        }
+
+        const ID &id = elePtr->getID();
+        std::uint64_t used = 0;
+        for (int i = 0; i < id.Size(); i++)
+            if (id(i) >= 0 && id(i) < (int)eqnColors.size())
+                used |= eqnColors[id(i)];
+
+        if (~used == 0) {
+            serialFEs.push_back(elePtr);
+            continue;
+        }
+
+        int color = 0;
+        while (used & (std::uint64_t(1) << color))
+            color++;
+
+        for (int i = 0; i < id.Size(); i++)
+            if (id(i) >= 0 && id(i) < (int)eqnColors.size())
+                eqnColors[id(i)] |= std::uint64_t(1) << color;
+
+        if (color >= (int)colorFEs.size())
+            colorFEs.resize(color + 1);
+        colorFEs[color].push_back(elePtr);
+    }
+
+    colorStamp = theAnalysisModel->getNumberingStamp();
+}
+
+int
+IncrementalIntegrator::assembleThreaded(bool tangent)
+{
+    if (colorStamp != theAnalysisModel->getNumberingStamp())
+        this->buildColors();
+
+    int result = 0;
+
+    for (FE_Element *elePtr : serialFEs) {
+        if (tangent) {
+            const Matrix &theTangent = elePtr->getTangent(this);
+            OPS_PROFILE(SystemAssemble, *theSOE);
+            if (theSOE->addA(theTangent, elePtr->getID()) < 0) {
+                opserr << "WARNING IncrementalIntegrator::formTangent -";
+                opserr << " failed in addA for ID " << elePtr->getID();            
+                result = -3;
+            }
+        } else {
+            if (theSOE->addB(elePtr->getResidual(this), elePtr->getID()) < 0) {
+                opserr << "WARNING IncrementalIntegrator::formElementResidual -";
+                opserr << " failed in addB for ID " << elePtr->getID();
+                result = -2;
+            }
+        }
+    }
+
+    OpenSees::thread_pool &pool = OpenSees::global_thread_pool();
+    const ops_UpdateState state;
+
+    // colors are assembled one after another; within a color no two
+    // elements write to the same entries of the system
+    for (const std::vector<FE_Element *> &theFEs : colorFEs) {
+        const std::size_t numFE = theFEs.size();
+        if (numFE == 0)
+            continue;
+
+        const std::size_t numBlocks = std::min<std::size_t>(numFE, 4*pool.get_thread_count());
+        OpenSees::multi_future<int> status = pool.submit_blocks<std::size_t>(0, numFE,
+          [&](std::size_t first, std::size_t last) -> int {
+            state.set();
+
+            int res = 0;
+            for (std::size_t i = first; i < last; i++) {
+                FE_Element *elePtr = theFEs[i];
+                if (tangent) {
+                    const Matrix &theTangent = elePtr->getTangent(this);
+                    OPS_PROFILE(SystemAssemble, *theSOE);
+                    if (theSOE->addA(theTangent, elePtr->getID()) < 0)
+                        res = -3;
+                } else {
+                    if (theSOE->addB(elePtr->getResidual(this), elePtr->getID()) < 0)
+                        res = -2;
+                }
+            }
+            return res;
+          }, numBlocks);
+
+        for (int res : status.get())
+            if (res < 0)
+                result = res;
+    }
+
+    if (result < 0) {
+        opserr << "WARNING IncrementalIntegrator::" 
+               << (tangent ? "formTangent" : "formElementResidual")
+               << " - failed to assemble one or more elements\n";
+    }
+    return result;
+}
+
 /*
 int
 IncrementalIntegrator::setModalDampingFactors(const Vector &factors)
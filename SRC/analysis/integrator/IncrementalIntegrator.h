@@ -32,6 +32,7 @@
 
 
 #include <Integrator.h>
+#include <vector>
 
 class LinearSOE;
 // class EigenSOE;
@@ -103,6 +104,11 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance();
     virtual int  formElementResidual();
+    int          formElementTangent();
+
+    // true if formEleTangent() and formEleResidual() may be invoked
+    // concurrently for different FE_Elements
+    virtual bool isThreadSafe(void) const;
 
     LinearSOE       *getLinearSOE() const;
     AnalysisModel   *getAnalysisModel() const;
@@ -127,6 +133,15 @@ class IncrementalIntegrator : public Integrator
     AnalysisModel *theAnalysisModel;
     ConvergenceTest *theTest;
 
+    // FE_Elements grouped for threaded assembly; no two elements of
+    // the same color share an equation
+    bool useThreadedAssembly(void) const;
+    int  assembleThreaded(bool tangent);
+    void buildColors(void);
+    int  colorStamp;
+    std::vector<FE_Element *> serialFEs;
+    std::vector<std::vector<FE_Element *>> colorFEs;
+
     // method introduced for domain decomposition
     // This is private here because it should only be called by
     // classes using the `Integrator` interface (where it is public), 
@@ -96,6 +96,13 @@ StaticIntegrator::formEleTangent(FE_Element *theEle)
   return 0;
 }
 
+bool
+StaticIntegrator::isThreadSafe(void) const
+{
+  // element sensitivities are not covered by Element::isThreadSafe
+  return residualType != ResidualType::StaticSensitivity;
+}
+
 int
 StaticIntegrator::formEleResidual(FE_Element *theEle)
 {
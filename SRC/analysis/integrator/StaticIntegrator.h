@@ -60,6 +60,7 @@ class StaticIntegrator : public IncrementalIntegrator
     virtual int formNodTangent(DOF_Group *theDof)     final;
     virtual int formNodUnbalance(DOF_Group *theDof)   final;    
     virtual int formEleTangentSensitivity(FE_Element *theEle,int gradNumber); 
+    virtual bool isThreadSafe(void) const;
 
   protected:
     enum class ResidualType {
@@ -97,13 +97,9 @@ TransientIntegrator::formTangent(int statFlag)
     }    
 
     // loop through the FE_Elements getting them to add the tangent    
-    FE_EleIter &theEles2 = theModel->getFEs();    
-    FE_Element *elePtr;    
-    while((elePtr = theEles2()) != nullptr) {
-      if (theLinSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
-          opserr << "TransientIntegrator::formTangent() - failed to addA:ele\n";
-          result = -2;
-      }
+    if (this->formElementTangent() < 0) {
+      opserr << "TransientIntegrator::formTangent() - failed to addA:ele\n";
+      result = -2;
     }
     return result;
 }
@@ -57,7 +57,7 @@ AnalysisModel::AnalysisModel(int theClassTag)
 :MovableObject(theClassTag),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0), numberingStamp(0)
 {
     theFEs     = new ArrayOfTaggedObjects(1024);
     theDOFs    = new ArrayOfTaggedObjects(1024);
@@ -71,7 +71,7 @@ AnalysisModel::AnalysisModel()
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0), numberingStamp(0)
 {
   theFEs     = new ArrayOfTaggedObjects(256);
   theDOFs    = new ArrayOfTaggedObjects(256);
@@ -84,7 +84,7 @@ AnalysisModel::AnalysisModel(TaggedObjectStorage &theFes, TaggedObjectStorage &t
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0), numberingStamp(0)
 {
   theFEs     = &theFes;
   theDOFs    = &theDofs;
@@ -153,6 +153,7 @@ AnalysisModel::addFE_Element(FE_Element *theElement)
   if (result == true) {
     theElement->setAnalysisModel(*this);
     numFE_Ele++;
+    numberingStamp++;
     return true;  // o.k.
   } else
     return false;
@@ -163,6 +164,30 @@ AnalysisModel::addFE_Element(FE_Element *theElement)
 
 
 
+// FE_Element *removeFE_Element(int tag);
+//        Method to remove an element from the model; the caller is
+//        responsible for deleting the returned FE_Element.
+
+FE_Element *
+AnalysisModel::removeFE_Element(int tag)
+{
+  if (theFEs == 0)
+    return 0;
+
+  TaggedObject *mc = theFEs->removeComponent(tag);
+  if (mc == 0)
+    return 0;
+
+  // any cached graph includes the connectivity of the element
+  if (myDOFGraph != 0)
+    delete myDOFGraph;
+  myDOFGraph = 0;
+
+  numFE_Ele--;
+  numberingStamp++;
+  return (FE_Element *)mc;
+}
+
 
 // void addDOF_Group(DOF_Group *);
 //        Method to add an element to the model.
@@ -213,6 +238,7 @@ AnalysisModel::clearAll(void)
     numFE_Ele =0;
     numDOF_Grp = 0;
     numEqn = 0;    
+    numberingStamp++;
 }
 
 void
@@ -222,6 +248,7 @@ AnalysisModel::clearDOFGraph(void)
     delete myDOFGraph;
 
   myDOFGraph = nullptr;
+  numberingStamp++;
 }
 
 void
@@ -273,6 +300,13 @@ void
 AnalysisModel::setNumEqn(int theNumEqn)
 {
     numEqn = theNumEqn;
+    numberingStamp++;
+}
+
+int
+AnalysisModel::getNumberingStamp(void) const
+{
+    return numberingStamp;
 }
 
 int 
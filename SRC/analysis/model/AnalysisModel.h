@@ -59,6 +59,7 @@ class AnalysisModel: public MovableObject
     // methods to populate/depopulate the AnalysisModel
     VIRTUAL bool addFE_Element(FE_Element *theFE_Ele);
     VIRTUAL bool addDOF_Group(DOF_Group *theDOF_Grp); // called by Handler
+    VIRTUAL FE_Element *removeFE_Element(int tag);    // called by Handler
     VIRTUAL void clearAll(void);
     VIRTUAL void clearDOFGraph(void);                 // called by Numberer and Analysis
     VIRTUAL void clearDOFGroupGraph(void); 
@@ -73,6 +74,10 @@ class AnalysisModel: public MovableObject
     VIRTUAL int    getNumEqn(void) const ; 
     VIRTUAL Graph &getDOFGraph(void);
     VIRTUAL Graph &getDOFGroupGraph(void);
+
+    // changes whenever FE_Elements are added or the equations are
+    // renumbered; used to invalidate data cached on the connectivity
+    int getNumberingStamp(void) const;
     
     // methods to update the response quantities at the DOF_Groups,
     // which in turn set the new nodal trial response quantities.
@@ -129,6 +134,7 @@ class AnalysisModel: public MovableObject
     int numFE_Ele;             // number of FE_Elements objects added
     int numDOF_Grp;            // number of DOF_Group objects added
     int numEqn;                // numEqn set by the ConstraintHandler typically
+    int numberingStamp;
 
     TaggedObjectStorage  *theFEs;
     TaggedObjectStorage  *theDOFs;
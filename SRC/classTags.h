@@ -1169,6 +1169,8 @@ enum {
 #define SOLVER_TAGS_CuSP                                31
 #define SOLVER_TAGS_PFEMQuasiSolver                     32
 #define SOLVER_TAGS_PFEMDiaSolver                       33
+#define SOLVER_TAGS_SupernodalSolver                    34
+#define SOLVER_TAGS_AmgclSolver                         35
 
 #define RECORDER_TAGS_ElementRecorder		1
 #define RECORDER_TAGS_NodeRecorder		2
@@ -1206,6 +1208,7 @@ enum {
 #define OPS_STREAM_TAGS_ChannelStream           9
 #define OPS_STREAM_TAGS_DataTurbineStream      10
 #define OPS_STREAM_TAGS_DataFileStreamAdd      11
+#define OPS_STREAM_TAGS_ColumnarFileStream     12
 
 
 #define DomDecompALGORITHM_TAGS_DomainDecompAlgo 1
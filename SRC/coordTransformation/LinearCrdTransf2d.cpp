@@ -39,8 +39,8 @@
 #include <LinearCrdTransf2d.h>
 
 // initialize static variables
-Matrix LinearCrdTransf2d::Tlg(6, 6);
-Matrix LinearCrdTransf2d::kg(6, 6);
+thread_local Matrix LinearCrdTransf2d::Tlg(6, 6);
+thread_local Matrix LinearCrdTransf2d::kg(6, 6);
 
 // constructor:
 LinearCrdTransf2d::LinearCrdTransf2d(int tag)
@@ -251,7 +251,7 @@ LinearCrdTransf2d::getBasicTrialDisp(void)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[6];
+  static thread_local double ug[6];
   for (int i = 0; i < 3; i++) {
     ug[i]     = disp1(i);
     ug[i + 3] = disp2(i);
@@ -267,7 +267,7 @@ LinearCrdTransf2d::getBasicTrialDisp(void)
       ug[j + 3] -= nodeJInitialDisp[j];
   }
 
-  static Vector ub(3);
+  static thread_local Vector ub(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -304,13 +304,13 @@ LinearCrdTransf2d::getBasicIncrDisp(void)
   const Vector &disp1 = nodeIPtr->getIncrDisp();
   const Vector &disp2 = nodeJPtr->getIncrDisp();
 
-  static double dug[6];
+  static thread_local double dug[6];
   for (int i = 0; i < 3; i++) {
     dug[i]     = disp1(i);
     dug[i + 3] = disp2(i);
   }
 
-  static Vector dub(3);
+  static thread_local Vector dub(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -347,13 +347,13 @@ LinearCrdTransf2d::getBasicIncrDeltaDisp(void)
   const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
   const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
 
-  static double Dug[6];
+  static thread_local double Dug[6];
   for (int i = 0; i < 3; i++) {
     Dug[i]     = disp1(i);
     Dug[i + 3] = disp2(i);
   }
 
-  static Vector Dub(3);
+  static thread_local Vector Dub(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -390,13 +390,13 @@ LinearCrdTransf2d::getBasicTrialVel(void)
   const Vector &vel1 = nodeIPtr->getTrialVel();
   const Vector &vel2 = nodeJPtr->getTrialVel();
 
-  static double vg[6];
+  static thread_local double vg[6];
   for (int i = 0; i < 3; i++) {
     vg[i]     = vel1(i);
     vg[i + 3] = vel2(i);
   }
 
-  static Vector vb(3);
+  static thread_local Vector vb(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -433,13 +433,13 @@ LinearCrdTransf2d::getBasicTrialAccel(void)
   const Vector &accel1 = nodeIPtr->getTrialAccel();
   const Vector &accel2 = nodeJPtr->getTrialAccel();
 
-  static double ag[6];
+  static thread_local double ag[6];
   for (int i = 0; i < 3; i++) {
     ag[i]     = accel1(i);
     ag[i + 3] = accel2(i);
   }
 
-  static Vector ab(3);
+  static thread_local Vector ab(3);
 
   double oneOverL = 1.0 / L;
   double sl       = sinTheta * oneOverL;
@@ -473,7 +473,7 @@ const Vector &
 LinearCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
   // transform resisting forces from the basic system to local coordinates
-  static double pl[6];
+  static thread_local double pl[6];
 
   double q0 = pb(0);
   double q1 = pb(1);
@@ -495,7 +495,7 @@ LinearCrdTransf2d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
   pl[4] += p0(2);
 
   // transform resisting forces  from local to global coordinates
-  static Vector pg(6);
+  static thread_local Vector pg(6);
 
   pg(0) = cosTheta * pl[0] - sinTheta * pl[1];
   pg(1) = sinTheta * pl[0] + cosTheta * pl[1];
@@ -609,7 +609,7 @@ LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const Vector &pb,
 const Matrix &
 LinearCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 {
-  static double tmp[6][6];
+  static thread_local double tmp[6][6];
   double oneOverL = 1.0 / L;
   double kb00, kb01, kb02, kb10, kb11, kb12, kb20, kb21, kb22;
 
@@ -735,7 +735,7 @@ LinearCrdTransf2d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
 const Matrix &
 LinearCrdTransf2d::getInitialGlobalStiffMatrix(const Matrix &kb)
 {
-  static double tmp[6][6];
+  static thread_local double tmp[6][6];
   double oneOverL = 1.0 / L;
   double kb00, kb01, kb02, kb10, kb11, kb12, kb20, kb21, kb22;
 
@@ -39,8 +39,8 @@
 #include <TaggedObject.h>
 
 // initialize static variables
-Matrix LinearCrdTransf3d::Tlg(12, 12);
-Matrix LinearCrdTransf3d::kg(12, 12);
+thread_local Matrix LinearCrdTransf3d::Tlg(12, 12);
+thread_local Matrix LinearCrdTransf3d::kg(12, 12);
 
 // constructor:
 LinearCrdTransf3d::LinearCrdTransf3d(int tag, const Vector &vecInLocXZPlane)
@@ -348,7 +348,7 @@ LinearCrdTransf3d::getBasicTrialDisp(void)
   const Vector &disp1 = nodeIPtr->getTrialDisp();
   const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-  static double ug[12];
+  static thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -366,9 +366,9 @@ LinearCrdTransf3d::getBasicTrialDisp(void)
 
   double oneOverL = 1.0 / L;
 
-  static Vector ub(6);
+  static thread_local Vector ub(6);
 
-  static double ul[12];
+  static thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -386,7 +386,7 @@ LinearCrdTransf3d::getBasicTrialDisp(void)
   ul[10] = R[1][0] * ug[9] + R[1][1] * ug[10] + R[1][2] * ug[11];
   ul[11] = R[2][0] * ug[9] + R[2][1] * ug[10] + R[2][2] * ug[11];
 
-  static double Wu[3];
+  static thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
     Wu[1] = -nodeIOffset[2] * ug[3] + nodeIOffset[0] * ug[5];
@@ -427,7 +427,7 @@ LinearCrdTransf3d::getBasicIncrDisp(void)
   const Vector &disp1 = nodeIPtr->getIncrDisp();
   const Vector &disp2 = nodeJPtr->getIncrDisp();
 
-  static double ug[12];
+  static thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -435,9 +435,9 @@ LinearCrdTransf3d::getBasicIncrDisp(void)
 
   double oneOverL = 1.0 / L;
 
-  static Vector ub(6);
+  static thread_local Vector ub(6);
 
-  static double ul[12];
+  static thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -455,7 +455,7 @@ LinearCrdTransf3d::getBasicIncrDisp(void)
   ul[10] = R[1][0] * ug[9] + R[1][1] * ug[10] + R[1][2] * ug[11];
   ul[11] = R[2][0] * ug[9] + R[2][1] * ug[10] + R[2][2] * ug[11];
 
-  static double Wu[3];
+  static thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
     Wu[1] = -nodeIOffset[2] * ug[3] + nodeIOffset[0] * ug[5];
@@ -496,7 +496,7 @@ LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
   const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
   const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
 
-  static double ug[12];
+  static thread_local double ug[12];
   for (int i = 0; i < 6; i++) {
     ug[i]     = disp1(i);
     ug[i + 6] = disp2(i);
@@ -504,9 +504,9 @@ LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
 
   double oneOverL = 1.0 / L;
 
-  static Vector ub(6);
+  static thread_local Vector ub(6);
 
-  static double ul[12];
+  static thread_local double ul[12];
 
   ul[0] = R[0][0] * ug[0] + R[0][1] * ug[1] + R[0][2] * ug[2];
   ul[1] = R[1][0] * ug[0] + R[1][1] * ug[1] + R[1][2] * ug[2];
@@ -524,7 +524,7 @@ LinearCrdTransf3d::getBasicIncrDeltaDisp(void)
   ul[10] = R[1][0] * ug[9] + R[1][1] * ug[10] + R[1][2] * ug[11];
   ul[11] = R[2][0] * ug[9] + R[2][1] * ug[10] + R[2][2] * ug[11];
 
-  static double Wu[3];
+  static thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ug[4] - nodeIOffset[1] * ug[5];
     Wu[1] = -nodeIOffset[2] * ug[3] + nodeIOffset[0] * ug[5];
@@ -565,7 +565,7 @@ LinearCrdTransf3d::getBasicTrialVel(void)
   const Vector &vel1 = nodeIPtr->getTrialVel();
   const Vector &vel2 = nodeJPtr->getTrialVel();
 
-  static double vg[12];
+  static thread_local double vg[12];
   for (int i = 0; i < 6; i++) {
     vg[i]     = vel1(i);
     vg[i + 6] = vel2(i);
@@ -573,9 +573,9 @@ LinearCrdTransf3d::getBasicTrialVel(void)
 
   double oneOverL = 1.0 / L;
 
-  static Vector vb(6);
+  static thread_local Vector vb(6);
 
-  static double vl[12];
+  static thread_local double vl[12];
 
   vl[0] = R[0][0] * vg[0] + R[0][1] * vg[1] + R[0][2] * vg[2];
   vl[1] = R[1][0] * vg[0] + R[1][1] * vg[1] + R[1][2] * vg[2];
@@ -593,7 +593,7 @@ LinearCrdTransf3d::getBasicTrialVel(void)
   vl[10] = R[1][0] * vg[9] + R[1][1] * vg[10] + R[1][2] * vg[11];
   vl[11] = R[2][0] * vg[9] + R[2][1] * vg[10] + R[2][2] * vg[11];
 
-  static double Wu[3];
+  static thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * vg[4] - nodeIOffset[1] * vg[5];
     Wu[1] = -nodeIOffset[2] * vg[3] + nodeIOffset[0] * vg[5];
@@ -634,7 +634,7 @@ LinearCrdTransf3d::getBasicTrialAccel(void)
   const Vector &accel1 = nodeIPtr->getTrialAccel();
   const Vector &accel2 = nodeJPtr->getTrialAccel();
 
-  static double ag[12];
+  static thread_local double ag[12];
   for (int i = 0; i < 6; i++) {
     ag[i]     = accel1(i);
     ag[i + 6] = accel2(i);
@@ -642,9 +642,9 @@ LinearCrdTransf3d::getBasicTrialAccel(void)
 
   double oneOverL = 1.0 / L;
 
-  static Vector ab(6);
+  static thread_local Vector ab(6);
 
-  static double al[12];
+  static thread_local double al[12];
 
   al[0] = R[0][0] * ag[0] + R[0][1] * ag[1] + R[0][2] * ag[2];
   al[1] = R[1][0] * ag[0] + R[1][1] * ag[1] + R[1][2] * ag[2];
@@ -662,7 +662,7 @@ LinearCrdTransf3d::getBasicTrialAccel(void)
   al[10] = R[1][0] * ag[9] + R[1][1] * ag[10] + R[1][2] * ag[11];
   al[11] = R[2][0] * ag[9] + R[2][1] * ag[10] + R[2][2] * ag[11];
 
-  static double Wu[3];
+  static thread_local double Wu[3];
   if (nodeIOffset) {
     Wu[0] = nodeIOffset[2] * ag[4] - nodeIOffset[1] * ag[5];
     Wu[1] = -nodeIOffset[2] * ag[3] + nodeIOffset[0] * ag[5];
@@ -700,7 +700,7 @@ const Vector &
 LinearCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 {
   // transform resisting forces from the basic system to local coordinates
-  static double pl[12];
+  static thread_local double pl[12];
 
   double q0 = pb(0);
   double q1 = pb(1);
@@ -731,7 +731,7 @@ LinearCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
   pl[8] += p0(4);
 
   // transform resisting forces  from local to global coordinates
-  static Vector pg(12);
+  static thread_local Vector pg(12);
 
   pg(0) = R[0][0] * pl[0] + R[1][0] * pl[1] + R[2][0] * pl[2];
   pg(1) = R[0][1] * pl[0] + R[1][1] * pl[1] + R[2][1] * pl[2];
@@ -767,9 +767,9 @@ LinearCrdTransf3d::getGlobalResistingForce(const Vector &pb, const Vector &p0)
 const Matrix &
 LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 {
-  static double kb[6][6];    // Basic stiffness
-  static double kl[12][12];  // Local stiffness
-  static double tmp[12][12]; // Temporary storage
+  static thread_local double kb[6][6];    // Basic stiffness
+  static thread_local double kl[12][12];  // Local stiffness
+  static thread_local double tmp[12][12]; // Temporary storage
   const double oneOverL = 1.0 / L;
 
   for (int i = 0; i < 6; i++)
@@ -809,7 +809,7 @@ LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
     kl[11][i] = tmp[2][i];
   }
 
-  static double RWI[3][3];
+  static thread_local double RWI[3][3];
 
   if (nodeIOffset) {
     // Compute RWI
@@ -826,7 +826,7 @@ LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
     RWI[2][2] = -R[2][0] * nodeIOffset[1] + R[2][1] * nodeIOffset[0];
   }
 
-  static double RWJ[3][3];
+  static thread_local double RWJ[3][3];
 
   if (nodeJOffset) {
     // Compute RWJ
@@ -928,9 +928,9 @@ LinearCrdTransf3d::getGlobalStiffMatrix(const Matrix &KB, const Vector &pb)
 const Matrix &
 LinearCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
 {
-  static double kb[6][6];    // Basic stiffness
-  static double kl[12][12];  // Local stiffness
-  static double tmp[12][12]; // Temporary storage
+  static thread_local double kb[6][6];    // Basic stiffness
+  static thread_local double kl[12][12];  // Local stiffness
+  static thread_local double tmp[12][12]; // Temporary storage
   double oneOverL = 1.0 / L;
 
   int i, j;
@@ -971,7 +971,7 @@ LinearCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
     kl[11][i] = tmp[2][i];
   }
 
-  static double RWI[3][3];
+  static thread_local double RWI[3][3];
 
   if (nodeIOffset) {
     // Compute RWI
@@ -988,7 +988,7 @@ LinearCrdTransf3d::getInitialGlobalStiffMatrix(const Matrix &KB)
     RWI[2][2] = -R[2][0] * nodeIOffset[1] + R[2][1] * nodeIOffset[0];
   }
 
-  static double RWJ[3][3];
+  static thread_local double RWJ[3][3];
 
   if (nodeJOffset) {
     // Compute RWJ
@@ -40,7 +40,7 @@
 #include <OPS_Globals.h>
 #include <ID.h>
 
-int FE_Datastore::lastDbTag(0);
+std::atomic<int> FE_Datastore::lastDbTag(0);
 
 // FE_Datastore(int tag, int noExtNodes);
 // 	constructor that takes the FE_Datastore's unique tag and the number
@@ -150,8 +150,12 @@ FE_Datastore::restoreState(int commitTag)
     ID maxlastDbTag(1);
     if (this->recvID(0,0,maxlastDbTag) < 0) {
       opserr << "FE_Datastore::restoreState - failed to get max lastDbTag data from database - problems may ariise\n";
-    } else
-      lastDbTag = maxlastDbTag(0);
+    } else {
+      // never hand out again a tag that objects of another Domain may hold
+      int last = lastDbTag.load();
+      while (last < maxlastDbTag(0) && !lastDbTag.compare_exchange_weak(last, maxlastDbTag(0)))
+        ;
+    }
 
   }
     
@@ -188,6 +192,5 @@ FE_Datastore::getData(const char *table, char *column[], int commitTag, Vector &
 int
 FE_Datastore::getDbTag(void)
 {
-  lastDbTag++;
-  return lastDbTag;
+  return ++lastDbTag;
 }
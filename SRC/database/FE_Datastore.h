@@ -40,6 +40,7 @@
 // What: "@(#) FE_Datastore.h, revA"
 
 #include <Channel.h>
+#include <atomic>
 
 class Domain;
 class FEM_ObjectBroker;
@@ -86,7 +87,7 @@ class FE_Datastore: public Channel
   private:
     FEM_ObjectBroker *theObjectBroker;
     Domain *theDomain;
-    static int lastDbTag;
+    static std::atomic<int> lastDbTag;   // shared by the datastores of all threads
 
 };
 
@@ -0,0 +1,361 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <MemoryDatastore.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <Message.h>
+#include <OPS_Globals.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+#if !defined(_WIN32)
+#  include <unistd.h>
+#endif
+
+namespace {
+
+enum Kind {
+  MessageRecord,
+  MatrixRecord,
+  VectorRecord,
+  IDRecord
+};
+
+struct Key {
+  int kind;
+  int size;
+  int dbTag;
+  int commitTag;
+
+  bool operator==(const Key &other) const {
+    return dbTag == other.dbTag && commitTag == other.commitTag
+        && size  == other.size  && kind      == other.kind;
+  }
+};
+
+struct KeyHash {
+  std::size_t operator()(const Key &key) const {
+    uint64_t hash = (uint64_t(uint32_t(key.dbTag)) << 32) | uint32_t(key.commitTag);
+    hash ^= ((uint64_t(uint32_t(key.size)) << 2) | uint32_t(key.kind))*0x9e3779b97f4a7c15ULL;
+    return static_cast<std::size_t>(hash ^ (hash >> 29));
+  }
+};
+
+typedef std::vector<char> Record;
+
+//
+// A checkpoint file is a header followed by the records, each after a
+// header of its own, in no particular order.
+//
+const char     fileMagic[8]  = {'O','P','S','C','K','P','T','\0'};
+const uint32_t fileVersion   = 1;
+const uint32_t fileByteOrder = 0x01020304;
+
+struct FileHeader {
+  char     magic[8];
+  uint32_t version;
+  uint32_t byteOrder;     // as written, to catch files from other machines
+  uint64_t numRecords;
+  uint64_t numBytes;      // in all records
+};
+
+struct RecordHeader {
+  int32_t  kind;
+  int32_t  size;
+  int32_t  dbTag;
+  int32_t  commitTag;
+  uint64_t numBytes;
+};
+
+} // namespace
+
+
+// A record is only written in place while no other index holds it, and
+// an index only while no other datastore or Handle holds it.
+class MemoryDatastore::Records
+{
+  public:
+    std::unordered_map<Key, std::shared_ptr<Record>, KeyHash> map;
+    std::size_t numBytes = 0;
+};
+
+
+MemoryDatastore::MemoryDatastore(Domain &theDomain, FEM_ObjectBroker &theBroker)
+  :FE_Datastore(theDomain, theBroker),
+   records(std::make_shared<Records>())
+{
+
+}
+
+
+MemoryDatastore::~MemoryDatastore()
+{
+
+}
+
+
+MemoryDatastore::Handle
+MemoryDatastore::share(void) const
+{
+  return records;
+}
+
+
+void
+MemoryDatastore::assign(const Handle &theRecords)
+{
+  // the records are copied before they are written to while shared
+  if (theRecords != nullptr)
+    records = std::const_pointer_cast<Records>(theRecords);
+  else
+    records = std::make_shared<Records>();
+}
+
+
+std::size_t
+MemoryDatastore::getNumBytes(void) const
+{
+  return records->numBytes;
+}
+
+
+std::size_t
+MemoryDatastore::getNumBytes(const Handle &theRecords)
+{
+  return theRecords != nullptr ? theRecords->numBytes : 0;
+}
+
+
+int
+MemoryDatastore::write(const Handle &theRecords, const char *fileName)
+{
+  if (theRecords == nullptr)
+    return -1;
+
+  // write the whole file under another name, so that a run stopped while
+  // writing leaves the last checkpoint in place
+  const std::string partName = std::string(fileName) + ".part";
+  FILE *file = fopen(partName.c_str(), "wb");
+  if (file == nullptr) {
+    opserr << "WARNING - MemoryDatastore::write() - could not open " << partName.c_str() << "\n";
+    return -1;
+  }
+  std::vector<char> buffer(1 << 20);
+  setvbuf(file, buffer.data(), _IOFBF, buffer.size());
+
+  FileHeader header;
+  memcpy(header.magic, fileMagic, sizeof(fileMagic));
+  header.version    = fileVersion;
+  header.byteOrder  = fileByteOrder;
+  header.numRecords = theRecords->map.size();
+  header.numBytes   = theRecords->numBytes;
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+  for (auto it = theRecords->map.begin(); ok && it != theRecords->map.end(); ++it) {
+    const RecordHeader recordHeader{it->first.kind, it->first.size,
+                                    it->first.dbTag, it->first.commitTag,
+                                    it->second->size()};
+    ok = fwrite(&recordHeader, sizeof(recordHeader), 1, file) == 1
+      && fwrite(it->second->data(), 1, it->second->size(), file) == it->second->size();
+  }
+
+  ok = fflush(file) == 0 && ok;
+#if !defined(_WIN32)
+  // the data must be on disk before the name is
+  ok = ok && fsync(fileno(file)) == 0;
+#endif
+  ok = fclose(file) == 0 && ok;
+
+#if defined(_WIN32)
+  if (ok)
+    remove(fileName);
+#endif
+  if (!ok || rename(partName.c_str(), fileName) != 0) {
+    opserr << "WARNING - MemoryDatastore::write() - failed to write " << fileName << "\n";
+    remove(partName.c_str());
+    return -1;
+  }
+  return 0;
+}
+
+
+MemoryDatastore::Handle
+MemoryDatastore::read(const char *fileName)
+{
+  FILE *file = fopen(fileName, "rb");
+  if (file == nullptr) {
+    opserr << "WARNING - MemoryDatastore::read() - could not open " << fileName << "\n";
+    return nullptr;
+  }
+  std::vector<char> buffer(1 << 20);
+  setvbuf(file, buffer.data(), _IOFBF, buffer.size());
+
+  FileHeader header;
+  if (fread(&header, sizeof(header), 1, file) != 1
+      || memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0) {
+    opserr << "WARNING - MemoryDatastore::read() - " << fileName << " is not a checkpoint file\n";
+    fclose(file);
+    return nullptr;
+  }
+  if (header.version != fileVersion || header.byteOrder != fileByteOrder) {
+    opserr << "WARNING - MemoryDatastore::read() - " << fileName
+           << " was written by version " << int(header.version)
+           << " or on a machine of another byte order\n";
+    fclose(file);
+    return nullptr;
+  }
+
+  std::shared_ptr<Records> records = std::make_shared<Records>();
+  records->map.reserve(header.numRecords);
+  bool ok = true;
+  for (uint64_t i = 0; ok && i < header.numRecords; i++) {
+    RecordHeader recordHeader;
+    ok = fread(&recordHeader, sizeof(recordHeader), 1, file) == 1
+      && recordHeader.numBytes <= header.numBytes;
+    if (!ok)
+      break;
+
+    std::shared_ptr<Record> record = std::make_shared<Record>(recordHeader.numBytes);
+    ok = fread(record->data(), 1, record->size(), file) == record->size();
+
+    const Key key{recordHeader.kind, recordHeader.size, recordHeader.dbTag, recordHeader.commitTag};
+    records->map[key] = record;
+    records->numBytes += record->size();
+  }
+  fclose(file);
+
+  if (!ok || records->numBytes != header.numBytes) {
+    opserr << "WARNING - MemoryDatastore::read() - " << fileName << " is truncated\n";
+    return nullptr;
+  }
+  return records;
+}
+
+
+int
+MemoryDatastore::store(int kind, int dbTag, int commitTag,
+                       const void *data, int size, std::size_t numBytes)
+{
+  if (records.use_count() > 1)
+    records = std::make_shared<Records>(*records);
+
+  std::shared_ptr<Record> &record = records->map[Key{kind, size, dbTag, commitTag}];
+  if (record == nullptr || record.use_count() > 1) {
+    if (record != nullptr)
+      records->numBytes -= record->size();
+    record = std::make_shared<Record>(numBytes);
+    records->numBytes += numBytes;
+  }
+
+  if (numBytes != 0)
+    memcpy(record->data(), data, numBytes);
+
+  return 0;
+}
+
+
+int
+MemoryDatastore::fetch(int kind, int dbTag, int commitTag,
+                       void *data, int size, std::size_t numBytes) const
+{
+  auto found = records->map.find(Key{kind, size, dbTag, commitTag});
+  if (found == records->map.end())
+    return -1;
+
+  if (numBytes != 0)
+    memcpy(data, found->second->data(), numBytes);
+
+  return 0;
+}
+
+
+int
+MemoryDatastore::sendMsg(int dbTag, int commitTag,
+                         const Message &theMessage,
+                         ChannelAddress *theAddress)
+{
+  Message &message = const_cast<Message &>(theMessage);
+  const int size = message.getSize();
+  return this->store(MessageRecord, dbTag, commitTag, message.getData(), size, size);
+}
+
+
+int
+MemoryDatastore::recvMsg(int dbTag, int commitTag,
+                         Message &theMessage,
+                         ChannelAddress *theAddress)
+{
+  const int size = theMessage.getSize();
+  return this->fetch(MessageRecord, dbTag, commitTag,
+                     const_cast<char *>(theMessage.getData()), size, size);
+}
+
+
+int
+MemoryDatastore::sendMatrix(int dbTag, int commitTag,
+                            const Matrix &theMatrix,
+                            ChannelAddress *theAddress)
+{
+  const int size = theMatrix.numRows*theMatrix.numCols;
+  return this->store(MatrixRecord, dbTag, commitTag, theMatrix.data, size, size*sizeof(double));
+}
+
+
+int
+MemoryDatastore::recvMatrix(int dbTag, int commitTag,
+                            Matrix &theMatrix,
+                            ChannelAddress *theAddress)
+{
+  const int size = theMatrix.numRows*theMatrix.numCols;
+  return this->fetch(MatrixRecord, dbTag, commitTag, theMatrix.data, size, size*sizeof(double));
+}
+
+
+int
+MemoryDatastore::sendVector(int dbTag, int commitTag,
+                            const Vector &theVector,
+                            ChannelAddress *theAddress)
+{
+  const int size = theVector.sz;
+  return this->store(VectorRecord, dbTag, commitTag, theVector.theData, size, size*sizeof(double));
+}
+
+
+int
+MemoryDatastore::recvVector(int dbTag, int commitTag,
+                            Vector &theVector,
+                            ChannelAddress *theAddress)
+{
+  const int size = theVector.sz;
+  return this->fetch(VectorRecord, dbTag, commitTag, theVector.theData, size, size*sizeof(double));
+}
+
+
+int
+MemoryDatastore::sendID(int dbTag, int commitTag,
+                        const ID &theID,
+                        ChannelAddress *theAddress)
+{
+  const int size = theID.sz;
+  return this->store(IDRecord, dbTag, commitTag, theID.data, size, size*sizeof(int));
+}
+
+
+int
+MemoryDatastore::recvID(int dbTag, int commitTag,
+                        ID &theID,
+                        ChannelAddress *theAddress)
+{
+  const int size = theID.sz;
+  return this->fetch(IDRecord, dbTag, commitTag, theID.data, size, size*sizeof(int));
+}
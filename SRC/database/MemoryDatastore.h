@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: MemoryDatastore is an FE_Datastore that keeps what the
+// objects of a Domain send in sendSelf() in memory, as binary records
+// keyed by their kind, size, dbTag and commitTag. commitState() followed
+// by restoreState() brings a Domain back to the committed state it had
+// without rebuilding it, at the cost of one copy of that state.
+//
+// The records can be shared: share() hands out the records currently
+// held, and assign() makes them the contents of this or another
+// MemoryDatastore. Sharing copies nothing; a datastore copies the index
+// of the records it shares the first time it is written to, and a record
+// itself only when it is overwritten. Many analyses can so start from
+// one committed state, e.g. every record of an incremental dynamic
+// analysis from the state after gravity loads.
+//
+// Shared records can also be written to a single binary file, which
+// read() turns back into records; since they no longer change once
+// shared, the file can be written by another thread while the analysis
+// goes on.
+//
+// Written: cmp
+//
+#ifndef MemoryDatastore_h
+#define MemoryDatastore_h
+
+#include <FE_Datastore.h>
+#include <memory>
+#include <cstddef>
+
+class MemoryDatastore: public FE_Datastore
+{
+  public:
+    MemoryDatastore(Domain &theDomain, FEM_ObjectBroker &theBroker);
+    ~MemoryDatastore();
+
+    class Records;
+    typedef std::shared_ptr<const Records> Handle;
+
+    // the records held, which stay as they are when this is written to
+    Handle share(void) const;
+    // replace the records held with shared ones
+    void   assign(const Handle &records);
+    // the number of bytes held in records
+    std::size_t getNumBytes(void) const;
+    static std::size_t getNumBytes(const Handle &records);
+
+    // write records to a checkpoint file, replacing it only once the
+    // whole file is written, or read them back; read() returns nullptr,
+    // with a message, for a file that is missing, truncated or made by
+    // an incompatible version
+    static int    write(const Handle &records, const char *fileName);
+    static Handle read(const char *fileName);
+
+    // methods for sending and receiving the data
+    int sendMsg(int dbTag, int commitTag,
+                const Message &,
+                ChannelAddress *theAddress =0);
+    int recvMsg(int dbTag, int commitTag,
+                Message &,
+                ChannelAddress *theAddress =0);
+
+    int sendMatrix(int dbTag, int commitTag,
+                   const Matrix &theMatrix,
+                   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag,
+                   Matrix &theMatrix,
+                   ChannelAddress *theAddress =0);
+
+    int sendVector(int dbTag, int commitTag,
+                   const Vector &theVector,
+                   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag,
+                   Vector &theVector,
+                   ChannelAddress *theAddress =0);
+
+    int sendID(int dbTag, int commitTag,
+               const ID &theID,
+               ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+               ID &theID,
+               ChannelAddress *theAddress =0);
+
+  private:
+    int store(int kind, int dbTag, int commitTag, const void *data, int size, std::size_t numBytes);
+    int fetch(int kind, int dbTag, int commitTag, void *data, int size, std::size_t numBytes) const;
+
+    std::shared_ptr<Records> records;
+};
+
+#endif
@@ -48,8 +48,8 @@
 #include <FEM_ObjectBroker.h>
 #include <stdbool.h>
 
-double ops_Dt;
-Domain * ops_TheActiveDomain;
+thread_local double ops_Dt;
+thread_local Domain * ops_TheActiveDomain;
 #include <StandardStream.h>
 StandardStream sserr;
 OPS_Stream *opserrPtr = &sserr;
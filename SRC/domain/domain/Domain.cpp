@@ -29,6 +29,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include <map>
+#include <algorithm>
 #include <OPS_Globals.h>
 #include <Domain.h>
 #include <DummyStream.h>
@@ -69,15 +70,18 @@
 #include <FEM_ObjectBroker.h>
 
 #include <DomainModalProperties.h>
+#include <threads/global_pool.hpp>
+#include <Profiler.h>
+#include <NodalStateStore.h>
 
 //
 // global variables
 //
 
-Domain       *ops_TheActiveDomain = nullptr;
-double        ops_Dt = 0.0;
-bool          ops_InitialStateAnalysis = false;
-int           ops_Creep = 0;
+thread_local Domain *ops_TheActiveDomain = nullptr;
+thread_local double  ops_Dt = 0.0;
+thread_local bool    ops_InitialStateAnalysis = false;
+thread_local int     ops_Creep = 0;
 
 Domain::Domain()
 :theRecorders(0), numRecorders(0),
@@ -91,7 +95,10 @@ Domain::Domain()
  theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0), theModalDampingFactors(0), inclModalMatrix(false),
  lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), threadListsBuilt(false),
+ theNodalStore(nullptr), nodalStoreBuilt(false),
+ onlyElementsChanged(false)
 {
   
     // initialize the arrays for storing the domain components
@@ -134,7 +141,10 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0), paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0), paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), threadListsBuilt(false),
+ theNodalStore(nullptr), nodalStoreBuilt(false),
+ onlyElementsChanged(false)
 {
     // init the arrays for storing the domain components
     theElements     = new MapOfTaggedObjects();
@@ -185,7 +195,10 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  theBounds(6), theEigenvalues(nullptr), theEigenvalueSetTime(0), 
  theModalProperties(nullptr), theModalDampingFactors(nullptr), inclModalMatrix(false),
  lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), threadListsBuilt(false),
+ theNodalStore(nullptr), nodalStoreBuilt(false),
+ onlyElementsChanged(false)
 {
     // check that the containers are empty
     if (theElements->getNumComponents() != 0 ||
@@ -231,7 +244,10 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  theModalProperties(0),
  theModalDampingFactors(0), inclModalMatrix(false),
  lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ paramIndex(0), paramSize(0), numParameters(0),
+ numThreads(1), threadListsBuilt(false),
+ theNodalStore(nullptr), nodalStoreBuilt(false),
+ onlyElementsChanged(false)
 {
     // init the arrays for storing the domain components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -291,6 +307,9 @@ Domain::~Domain()
 
   if (thePCs != nullptr)
     delete thePCs;
+
+  if (theNodalStore != nullptr)
+    delete theNodalStore;
   
   if (theMPs != nullptr)
     delete theMPs;
@@ -404,7 +423,7 @@ Domain::addElement(Element *element)
 #endif
 
     // mark the Domain as having been changed
-    this->domainChange();
+    this->elementChange(eleTag);
 
   } else 
     opserr << "Domain::addElement - element " << eleTag << "could not be added to container\n";      
@@ -482,6 +501,18 @@ Domain::addNode(Node * node)
 }
 
 
+int
+Domain::reserve(int numNodes, int numElements)
+{
+  int result = 0;
+  if (numNodes > 0 && theNodes->setSize(theNodes->getNumComponents() + numNodes) < 0)
+    result = -1;
+  if (numElements > 0 && theElements->setSize(theElements->getNumComponents() + numElements) < 0)
+    result = -1;
+  return result;
+}
+
+
 // void addSP_Constraint(SP_Constraint *);
 //	Method to add a constraint to the model.
 //
@@ -925,6 +956,9 @@ Domain::clearAll(void) {
   // clean out the containers
   theElements->clearAll();
   theNodes->clearAll();
+  if (theNodalStore != nullptr)
+    theNodalStore->clear();
+  nodalStoreBuilt = false;
   theSPs->clearAll();
   thePCs->clearAll();
   theMPs->clearAll();
@@ -975,6 +1009,11 @@ Domain::clearAll(void) {
   hasDomainChangedFlag = false;
   nodeGraphBuiltFlag = false;
   eleGraphBuiltFlag = false;
+  threadListsBuilt = false;
+  threadSafeElements.clear();
+  serialElements.clear();
+  onlyElementsChanged = false;
+  changedElements.clear();
   
   dbEle =0; dbNod =0; dbSPs =0; dbPCs = 0; 
   dbMPs =0; dbLPs = 0; dbParam = 0;
@@ -1006,7 +1045,7 @@ Domain::removeElement(int tag)
       return nullptr;
 
   // otherwise mark the domain as having changed
-  this->domainChange();
+  this->elementChange(tag);
   
   // perform a downward cast to an Element (safe as only Element added to
   // this container, 0 the Elements DomainPtr and return the result of the cast  
@@ -1036,6 +1075,10 @@ Domain::removeNode(int tag)
   Node *result = (Node *)mc;
   // result->setDomain(0);
 
+  // the node may outlive the domain's nodal state store
+  if (theNodalStore != nullptr)
+    theNodalStore->release(*result);
+
   return result;
 }
 
@@ -1895,8 +1938,10 @@ Domain::record(bool fromAnalysis)
 
   // invoke record on all recorders
   for (int i=0; i<numRecorders; i++)
-    if (theRecorders[i] != 0)
+    if (theRecorders[i] != 0) {
+      OPS_PROFILE(RecorderRecord, *theRecorders[i]);
       res += theRecorders[i]->record(commitTag, currentTime);
+    }
   
   // update the commitTag
   commitTag++;
@@ -1910,10 +1955,18 @@ Domain::commit(void)
     // 
     // first invoke commit on all nodes and elements in the domain
     //
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != nullptr) {
-      nodePtr->commitState();
+    if (theNodalStore != nullptr) {
+      if (!nodalStoreBuilt) {
+        theNodalStore->build(*this);
+        nodalStoreBuilt = true;
+      }
+      theNodalStore->commitState();
+    } else {
+      Node *nodePtr;
+      NodeIter &theNodeIter = this->getNodes();
+      while ((nodePtr = theNodeIter()) != nullptr) {
+        nodePtr->commitState();
+      }
     }
 
     Element *elePtr;
@@ -1928,8 +1981,10 @@ Domain::commit(void)
 
     // invoke record on all recorders
     for (int i=0; i<numRecorders; i++)
-      if (theRecorders[i] != 0)
+      if (theRecorders[i] != 0) {
+        OPS_PROFILE(RecorderRecord, *theRecorders[i]);
 	theRecorders[i]->record(commitTag, currentTime);
+      }
 
     // update the commitTag
     commitTag++;
@@ -1942,10 +1997,18 @@ Domain::revertToLastCommit(void)
     // 
     // first invoke revertToLastCommit  on all nodes and elements in the domain
     // 
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != nullptr)
+    if (theNodalStore != nullptr) {
+      if (!nodalStoreBuilt) {
+        theNodalStore->build(*this);
+        nodalStoreBuilt = true;
+      }
+      theNodalStore->revertToLastCommit();
+    } else {
+      Node *nodePtr;
+      NodeIter &theNodeIter = this->getNodes();
+      while ((nodePtr = theNodeIter()) != nullptr)
 	nodePtr->revertToLastCommit();
+    }
     
     Element *elePtr;
     ElementIter &theElemIter = this->getElements();    
@@ -2006,6 +2069,9 @@ Domain::update(void)
   ops_Dt = dT;
   ops_TheActiveDomain = this;
 
+  if (numThreads > 1 && !OpenSees::in_thread_pool())
+    return this->updateThreaded();
+
   int ok = 0;
 
   // invoke update on all the ele's
@@ -2014,6 +2080,7 @@ Domain::update(void)
 
   while ((theEle = theEles()) != nullptr) {
     ops_TheActiveElement = theEle;
+    OPS_PROFILE(ElementUpdate, *theEle);
     ok += theEle->update();
   }
 
@@ -2021,6 +2088,115 @@ Domain::update(void)
 }
 
 
+int
+Domain::updateThreaded(void)
+{
+  if (!threadListsBuilt) {
+    threadSafeElements.clear();
+    serialElements.clear();
+
+    ElementIter &theEles = this->getElements();
+    Element *theEle;
+    while ((theEle = theEles()) != nullptr) {
+      if (theEle->isThreadSafe())
+        threadSafeElements.push_back(theEle);
+      else
+        serialElements.push_back(theEle);
+    }
+    threadListsBuilt = true;
+  }
+
+  int ok = 0;
+
+  // elements that have not declared themselves thread-safe are
+  // updated on the calling thread before the parallel sweep
+  for (Element *theEle : serialElements) {
+    ops_TheActiveElement = theEle;
+    OPS_PROFILE(ElementUpdate, *theEle);
+    ok += theEle->update();
+  }
+
+  const std::size_t numEle = threadSafeElements.size();
+  if (numEle == 0)
+    return ok;
+
+  OpenSees::thread_pool &pool = OpenSees::global_thread_pool();
+
+  // use several blocks per thread so that workers which finish
+  // early pick up the remaining work
+  const std::size_t numBlocks = std::min<std::size_t>(numEle, 4*pool.get_thread_count());
+
+  const ops_UpdateState state;
+  OpenSees::multi_future<int> status = pool.submit_blocks<std::size_t>(0, numEle, 
+    [&](std::size_t first, std::size_t last) -> int {
+      // the update globals are thread-local and must be set
+      // on each worker
+      state.set();
+
+      int res = 0;
+      for (std::size_t i = first; i < last; i++) {
+        Element *theEle = threadSafeElements[i];
+        ops_TheActiveElement = theEle;
+        OPS_PROFILE(ElementUpdate, *theEle);
+        res += theEle->update();
+      }
+      return res;
+    }, numBlocks);
+
+  for (int res : status.get())
+    ok += res;
+
+  return ok;
+}
+
+
+void
+Domain::setNumThreads(int n)
+{
+  numThreads = n > 1 ? n : 1;
+  if (numThreads > 1)
+    OpenSees::set_thread_count(numThreads);
+}
+
+int
+Domain::getNumThreads(void) const
+{
+  return numThreads;
+}
+
+int
+Domain::setNodalStateStorage(bool contiguous)
+{
+  if (contiguous) {
+    if (theNodalStore == nullptr)
+      theNodalStore = new NodalStateStore();
+    theNodalStore->build(*this);
+    nodalStoreBuilt = true;
+    return 0;
+  }
+
+  if (theNodalStore == nullptr)
+    return 0;
+
+  // hand the state back to the nodes before the store goes away
+  Node *nodePtr;
+  NodeIter &theNodeIter = this->getNodes();
+  while ((nodePtr = theNodeIter()) != nullptr)
+    theNodalStore->release(*nodePtr);
+
+  delete theNodalStore;
+  theNodalStore = nullptr;
+  nodalStoreBuilt = false;
+  return 0;
+}
+
+const NodalStateStore *
+Domain::getNodalStateStore(void) const
+{
+  // until it is built the store does not hold the state of the nodes
+  return nodalStoreBuilt ? theNodalStore : nullptr;
+}
+
 int
 Domain::update(double newTime, double dT)
 {
@@ -2203,6 +2379,41 @@ void
 Domain::domainChange(void)
 {
     hasDomainChangedFlag = true;
+    threadListsBuilt = false;
+    nodalStoreBuilt = false;
+    onlyElementsChanged = false;
+}
+
+void
+Domain::elementChange(int eleTag)
+{
+    // the tags gathered so far are kept; they are only dropped once the
+    // analysis has taken them, or rebuilt the model in full
+    bool onlyElements = onlyElementsChanged;
+    this->domainChange();
+
+    // once the changes are a sizable part of the model there is
+    // nothing to gain from handling them one at a time
+    if (onlyElements && 4*changedElements.size() < (size_t)theElements->getNumComponents() + 64) {
+      changedElements.push_back(eleTag);
+      onlyElementsChanged = true;
+    }
+}
+
+bool
+Domain::getElementChanges(std::vector<int> &eleTags) const
+{
+    if (!onlyElementsChanged)
+      return false;
+    eleTags = changedElements;
+    return true;
+}
+
+void
+Domain::resetElementChanges(void)
+{
+    changedElements.clear();
+    onlyElementsChanged = true;
 }
 
 
@@ -3499,10 +3710,10 @@ Domain::getRecorder(int tag)
 {
   Recorder* res = nullptr;
 
-  // invoke record on all recorders
+  // removed recorders leave their slot empty
   for (int i = 0; i < numRecorders; i++) {
     if (theRecorders[i] == 0)
-      break;
+      continue;
     if (theRecorders[i]->getTag() == tag) {
       res = theRecorders[i];
       break;
@@ -3512,6 +3723,21 @@ Domain::getRecorder(int tag)
   return res;
 }
 
+void
+Domain::getRecorderTags(ID& rtags) const
+{
+    int numTags = 0;
+    for (int i=0; i<numRecorders; i++)
+      if (theRecorders[i] != nullptr)
+        numTags++;
+
+    rtags.resize(numTags);
+    int loc = 0;
+    for (int i=0; i<numRecorders; i++)
+      if (theRecorders[i] != nullptr)
+        rtags(loc++) = theRecorders[i]->getTag();
+}
+
 
 
 #if 0
@@ -32,6 +32,7 @@
 
 #include <OPS_Stream.h>
 #include <Vector.h>
+#include <vector>
 
 enum class NodeData: int;
 class Element;
@@ -71,6 +72,7 @@ class FEM_ObjectBroker;
 class TaggedObjectStorage;
 
 class DomainModalProperties;
+class NodalStateStore;
 
 class Domain
 {
@@ -101,6 +103,10 @@ class Domain
     virtual  bool addMP_Constraint(MP_Constraint *); 
     virtual  bool addLoadPattern(LoadPattern *);            
     virtual  bool addParameter(Parameter *);            
+
+    // lets the storage make room for numNodes more nodes and numElements
+    // more elements before they are added in bulk
+    virtual  int  reserve(int numNodes, int numElements);
     
     // methods to add components to a LoadPattern object
     virtual  bool addSP_Constraint(SP_Constraint *, int loadPatternTag); 
@@ -185,6 +191,10 @@ class Domain
     virtual  int  revertToStart(void);    
     virtual  int  update(void);
     virtual  int  update(double newTime, double dT);
+    void setNumThreads(int numThreads);
+    int  getNumThreads(void) const;
+    int  setNodalStateStorage(bool contiguous);
+    const NodalStateStore *getNodalStateStore(void) const;
     virtual  int  updateParameter(int tag, int value);
     virtual  int  updateParameter(int tag, double value);    
     
@@ -208,6 +218,12 @@ class Domain
     virtual void domainChange(void);
     virtual void setDomainChangeStamp(int newStamp);
 
+    // tags of the elements added or removed since the last call to
+    // resetElementChanges(); returns false if anything else which
+    // changes the analysis model has been added or removed since then
+    bool getElementChanges(std::vector<int> &eleTags) const;
+    void resetElementChanges(void);
+
 
     // methods for output
     virtual int  addRecorder(Recorder &theRecorder);    	
@@ -236,6 +252,7 @@ class Domain
     virtual int calculateNodalReactions(int flag);
     
     Recorder* getRecorder(int tag);
+    void getRecorderTags(ID& rtags) const;
 
 #if 0
     virtual int activateElements(const ID& elementList);
@@ -245,6 +262,7 @@ class Domain
 
     virtual int buildEleGraph(Graph *theEleGraph);
     virtual int buildNodeGraph(Graph *theNodeGraph);
+    int updateThreaded(void);
 
     Recorder **theRecorders;
     int numRecorders;    
@@ -306,6 +324,23 @@ class Domain
     enum {paramSize_grow = 20};
     int paramSize;
     int numParameters;
+
+    // threaded element update; the element lists are
+    // rebuilt whenever the domain changes
+    int numThreads;
+    bool threadListsBuilt;
+    std::vector<Element*> threadSafeElements;
+    std::vector<Element*> serialElements;
+
+    // contiguous nodal state; the store is rebuilt at the next
+    // commit or revert after the domain changes
+    NodalStateStore *theNodalStore;
+    bool nodalStoreBuilt;
+
+    // elements added or removed since resetElementChanges()
+    void elementChange(int eleTag);
+    std::vector<int> changedElements;
+    bool onlyElementsChanged;
 };
 
 #endif
@@ -276,7 +276,7 @@ HeapNode::~HeapNode()
     if (incrDeltaDisp != 0)
       delete incrDeltaDisp;
 
-    if (disp != 0)
+    if (disp != 0 && !sharedState)
       delete [] disp;
 
 
@@ -287,7 +287,7 @@ HeapNode::~HeapNode()
     if (trialVel != 0)
       delete trialVel;
 
-    if (vel != 0)
+    if (vel != 0 && !sharedState)
       delete [] vel;
 
     //
@@ -300,7 +300,7 @@ HeapNode::~HeapNode()
     if (totalAccel != 0)
       delete totalAccel;
 
-    if (accel != 0)
+    if (accel != 0 && !sharedState)
       delete [] accel;
 
     //
@@ -1100,7 +1100,14 @@ HeapNode::sendSelf(int cTag, Channel &theChannel)
       return res;
     }
 
-    res = theChannel.sendVector(dataTag, cTag, *Crd);
+    // the coordinates go with the Rayleigh factor of the mass
+    const int numberCrd = Crd->Size();
+    Vector crdData(numberCrd+1);
+    for (int i=0; i<numberCrd; i++)
+      crdData(i) = (*Crd)(i);
+    crdData(numberCrd) = alphaM;
+
+    res = theChannel.sendVector(dataTag, cTag, crdData);
     if (res < 0) {
       opserr << " Node::sendSelf() - failed to send Vecor data\n";
       return res;
@@ -1186,10 +1193,14 @@ HeapNode::recvSelf(int cTag, Channel &theChannel,
     if (Crd == nullptr)
       Crd = new Vector(numberCrd);
 
-    if (theChannel.recvVector(dataTag, cTag, *Crd) < 0) {
+    Vector crdData(numberCrd+1);
+    if (theChannel.recvVector(dataTag, cTag, crdData) < 0) {
       opserr << "Node::recvSelf() - failed to receive the Coordinate vector\n";
       return -2;
     }
+    for (int i=0; i<numberCrd; i++)
+      (*Crd)(i) = crdData(i);
+    alphaM = crdData(numberCrd);
 
     if (commitDisp == nullptr)
       this->createDisp();
@@ -1215,6 +1226,10 @@ HeapNode::recvSelf(int cTag, Channel &theChannel,
       trialDisp->Zero();
     }
 
+    // the increments are not sent; they start again from the committed state
+    incrDisp->Zero();
+    incrDeltaDisp->Zero();
+
 
     if (data(3) == 0) {
       // create the vel vectors if node is a total blank
@@ -1230,6 +1245,11 @@ HeapNode::recvSelf(int cTag, Channel &theChannel,
       // set the trial quantity
       for (int i=0; i<numberDOF; i++)
       vel[i] = vel[i+numberDOF];  // set trial equal committed
+
+    } else if (commitVel != nullptr) {
+      // not formed when sent, e.g. before any dynamic analysis
+      commitVel->Zero();
+      trialVel->Zero();
     }
 
     if (data(4) == 0) {
@@ -1246,6 +1266,10 @@ HeapNode::recvSelf(int cTag, Channel &theChannel,
       // set the trial values
       for (int i=0; i<numberDOF; i++)
         accel[i] = accel[i+numberDOF];  // set trial equal committed
+
+    } else if (commitAccel != nullptr) {
+      commitAccel->Zero();
+      trialAccel->Zero();
     }
 
     if (data(5) == 0) {
@@ -1257,6 +1281,8 @@ HeapNode::recvSelf(int cTag, Channel &theChannel,
       opserr << "Node::recvSelf() - failed to receive Mass data\n";
       return -6;
       }
+    } else if (mass != nullptr) {
+      mass->Zero();
     }
 
     if (data(12) == 0) {
@@ -1286,6 +1312,8 @@ HeapNode::recvSelf(int cTag, Channel &theChannel,
       opserr << "Node::recvSelf() - failed to receive Load data\n";
       return res;
       }
+    } else if (unbalLoad != nullptr) {
+      unbalLoad->Zero();
     }
 
 
@@ -1356,6 +1384,79 @@ HeapNode::createAccel()
   return 0;
 }
 
+void
+HeapNode::getStateSize(int &dispSize, int &velSize, int &accelSize) const
+{
+  dispSize  = 4*numberDOF;
+  velSize   = 2*numberDOF;
+  accelSize = 3*numberDOF;
+}
+
+int
+HeapNode::setStateStorage(double *newDisp, double *newVel, double *newAccel)
+{
+  const bool shared = (newDisp != nullptr && newVel != nullptr && newAccel != nullptr);
+  if (!shared) {
+    newDisp  = new double[4*numberDOF]{};
+    newVel   = new double[2*numberDOF]{};
+    newAccel = new double[3*numberDOF]{};
+  }
+
+  if (disp != nullptr) {
+    for (int i=0; i<4*numberDOF; i++)
+      newDisp[i] = disp[i];
+    if (!sharedState)
+      delete [] disp;
+  }
+  if (vel != nullptr) {
+    for (int i=0; i<2*numberDOF; i++)
+      newVel[i] = vel[i];
+    if (!sharedState)
+      delete [] vel;
+  }
+  if (accel != nullptr) {
+    for (int i=0; i<3*numberDOF; i++)
+      newAccel[i] = accel[i];
+    if (!sharedState)
+      delete [] accel;
+  }
+  disp  = newDisp;
+  vel   = newVel;
+  accel = newAccel;
+  sharedState = shared;
+
+  if (trialDisp == nullptr) {
+    trialDisp     = new Vector(disp, numberDOF);
+    commitDisp    = new Vector(&disp[numberDOF], numberDOF);
+    incrDisp      = new Vector(&disp[2*numberDOF], numberDOF);
+    incrDeltaDisp = new Vector(&disp[3*numberDOF], numberDOF);
+  } else {
+    trialDisp->setData(disp, numberDOF);
+    commitDisp->setData(&disp[numberDOF], numberDOF);
+    incrDisp->setData(&disp[2*numberDOF], numberDOF);
+    incrDeltaDisp->setData(&disp[3*numberDOF], numberDOF);
+  }
+
+  if (trialVel == nullptr) {
+    commitVel = new Vector(&vel[numberDOF], numberDOF);
+    trialVel  = new Vector(vel, numberDOF);
+  } else {
+    commitVel->setData(&vel[numberDOF], numberDOF);
+    trialVel->setData(vel, numberDOF);
+  }
+
+  if (trialAccel == nullptr) {
+    trialAccel  = new Vector(accel, numberDOF);
+    commitAccel = new Vector(&accel[numberDOF], numberDOF);
+    totalAccel  = new Vector(&accel[2*numberDOF], numberDOF);
+  } else {
+    trialAccel->setData(accel, numberDOF);
+    commitAccel->setData(&accel[numberDOF], numberDOF);
+    totalAccel->setData(&accel[2*numberDOF], numberDOF);
+  }
+  return 0;
+}
+
 void
 HeapNode::Print(OPS_Stream &s, int flag)
 {
@@ -73,6 +73,9 @@ class HeapNode : public Node
     virtual int incrTrialAccel(const Vector &) override final;
 
     // Dynamics
+    virtual void getStateSize(int &dispSize, int &velSize, int &accelSize) const override final;
+    virtual int  setStateStorage(double *disp, double *vel, double *accel) override final;
+
     virtual const Matrix &getMass() override final;
     virtual const Matrix &getDamp() override final;
     virtual int setMass(const Matrix &theMass) override final;
@@ -142,6 +145,7 @@ class HeapNode : public Node
   private:
     double *disp;
     double *vel, *accel;               // double arrays holding the vel and accel values
+    bool sharedState = false;          // true if the arrays are owned by a NodalStateStore
     Vector *trialDisp, *commitDisp, *incrDisp, *incrDeltaDisp;
     Vector *commitVel, *commitAccel;   // committed quantities
     Vector *trialVel,   *trialAccel;   // trial quantities
@@ -0,0 +1,162 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <NodalStateStore.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+
+int
+NodalStateStore::build(Domain &theDomain)
+{
+  std::vector<Block> newBlocks;
+  std::size_t numDisp = 0,
+              numVel = 0,
+              numAccel = 0;
+
+  int newUniformDOF = 0;
+
+  Node *theNode;
+  NodeIter &theNodes = theDomain.getNodes();
+  while ((theNode = theNodes()) != nullptr) {
+    int dispSize, velSize, accelSize;
+    theNode->getStateSize(dispSize, velSize, accelSize);
+    const int ndf = theNode->getNumberDOF();
+    if (newBlocks.empty())
+      newUniformDOF = ndf;
+    else if (ndf != newUniformDOF)
+      newUniformDOF = -1;
+    newBlocks.push_back({ndf, numDisp, numVel, numAccel});
+    numDisp  += dispSize;
+    numVel   += velSize;
+    numAccel += accelSize;
+  }
+
+  auto newArrays = std::make_shared<Arrays>();
+  std::vector<double> &newDisp  = newArrays->disp,
+                      &newVel   = newArrays->vel,
+                      &newAccel = newArrays->accel;
+  newDisp.assign(numDisp, 0.0);
+  newVel.assign(numVel, 0.0);
+  newAccel.assign(numAccel, 0.0);
+
+  // the nodes copy their current state (which may be in the old
+  // arrays) into the new arrays before the old ones are dropped;
+  // the old arrays are freed once no one else shares them
+  int result = 0;
+  std::size_t i = 0;
+  NodeIter &theNodes2 = theDomain.getNodes();
+  while ((theNode = theNodes2()) != nullptr) {
+    const Block &block = newBlocks[i++];
+    if (theNode->setStateStorage(newDisp.data()  + block.disp,
+                                 newVel.data()   + block.vel,
+                                 newAccel.data() + block.accel) < 0)
+      result = -1;
+  }
+
+  blocks.swap(newBlocks);
+  uniformDOF = newUniformDOF;
+  arrays = std::move(newArrays);
+  return result;
+}
+
+void
+NodalStateStore::release(Node &theNode)
+{
+  theNode.setStateStorage(nullptr, nullptr, nullptr);
+}
+
+void
+NodalStateStore::clear(void)
+{
+  blocks.clear();
+  uniformDOF = -1;
+  arrays.reset();
+}
+
+void
+NodalStateStore::commitState(void)
+{
+  // set commit = trial and incr = 0
+  for (const Block &block : blocks) {
+    const int n = block.ndf;
+
+    double *u = arrays->disp.data() + block.disp;
+    for (int i=0; i<n; i++) {
+      u[n+i]   = u[i];
+      u[2*n+i] = 0.0;
+      u[3*n+i] = 0.0;
+    }
+
+    double *v = arrays->vel.data() + block.vel;
+    for (int i=0; i<n; i++)
+      v[n+i] = v[i];
+
+    double *a = arrays->accel.data() + block.accel;
+    for (int i=0; i<n; i++)
+      a[n+i] = a[i];
+  }
+}
+
+void
+NodalStateStore::revertToLastCommit(void)
+{
+  // set trial = commit and incr = 0
+  for (const Block &block : blocks) {
+    const int n = block.ndf;
+
+    double *u = arrays->disp.data() + block.disp;
+    for (int i=0; i<n; i++) {
+      u[i]     = u[n+i];
+      u[2*n+i] = 0.0;
+      u[3*n+i] = 0.0;
+    }
+
+    double *v = arrays->vel.data() + block.vel;
+    for (int i=0; i<n; i++)
+      v[i] = v[n+i];
+
+    double *a = arrays->accel.data() + block.accel;
+    for (int i=0; i<n; i++)
+      a[i] = a[n+i];
+  }
+}
+
+const double *
+NodalStateStore::getValues(NodeData type, int &ndf, std::size_t &stride) const
+{
+  if (blocks.empty() || uniformDOF <= 0)
+    return nullptr;
+
+  // the place of each kind of value in the blocks follows Node
+  const int n = uniformDOF;
+  const std::vector<double> &disp  = arrays->disp,
+                            &vel   = arrays->vel,
+                            &accel = arrays->accel;
+  const double *values = nullptr;
+  switch (type) {
+    case NodeData::DisplTrial:    values = disp.data();        stride = 4*n; break;
+    case NodeData::Disp:          values = disp.data() + n;    stride = 4*n; break;
+    case NodeData::IncrDisp:      values = disp.data() + 2*n;  stride = 4*n; break;
+    case NodeData::IncrDeltaDisp: values = disp.data() + 3*n;  stride = 4*n; break;
+    case NodeData::VelocTrial:    values = vel.data();         stride = 2*n; break;
+    case NodeData::Vel:           values = vel.data() + n;     stride = 2*n; break;
+    case NodeData::AccelTrial:    values = accel.data();       stride = 2*n; break;
+    case NodeData::Accel:         values = accel.data() + n;   stride = 2*n; break;
+    default:
+      return nullptr;
+  }
+  ndf = n;
+  return values;
+}
+
+std::shared_ptr<const void>
+NodalStateStore::getOwner(void) const
+{
+  return arrays;
+}
@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: NodalStateStore holds the displacement, velocity and
+// acceleration arrays of all the nodes in a Domain in three contiguous
+// arrays. Each node keeps its own layout within its block (e.g., the
+// displacement block of a node with n dof holds the trial, committed,
+// incremental and incremental-delta values, n at a time), and the
+// blocks are placed one after another in the order the Domain iterates
+// its nodes. Nodes continue to hand out Vectors that are views into
+// their blocks, so nothing outside of the Domain sees the difference.
+//
+// With the state in one place, commitState() and revertToLastCommit()
+// for the whole Domain are a single pass over each array instead of a
+// virtual call on, and a few small scattered allocations for, each node.
+//
+// The updates of the analysis (DOF_Group::setNodeDisp, incrNodeDisp and
+// the like) still go through the Node interface one DOF_Group at a time;
+// they write into the store, but are not streamed over it.
+//
+// Written: cmp
+//
+#ifndef NodalStateStore_h
+#define NodalStateStore_h
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <NodeData.h>
+
+class Domain;
+class Node;
+
+class NodalStateStore
+{
+  public:
+    // Move the state of every node in the Domain into the store,
+    // replacing the storage from any previous call.
+    int  build(Domain &theDomain);
+
+    // Move the state of a node back to storage owned by the node,
+    // e.g., before it is removed from the Domain.
+    void release(Node &theNode);
+
+    // Drop the stored state; any nodes still using it must already
+    // have been released or destroyed.
+    void clear(void);
+
+    // Equivalent to invoking Node::commitState() and
+    // Node::revertToLastCommit() on every node in the store.
+    void commitState(void);
+    void revertToLastCommit(void);
+
+    // When every node has the same number of dof, returns the first of the
+    // values of the given kind (e.g., NodeData::Disp for the committed
+    // displacements); those of the i'th node start at i*stride from it.
+    // Returns nullptr for kinds that are not stored or for mixed dof.
+    const double *getValues(NodeData type, int &ndf, std::size_t &stride) const;
+
+    // Shares ownership of the arrays returned by getValues(), which stay
+    // allocated while a copy is held, even after the store is built
+    // again or destroyed; the nodes no longer write to them after that.
+    std::shared_ptr<const void> getOwner(void) const;
+
+  private:
+    struct Block {
+      int ndf;
+      std::size_t disp, vel, accel; // offsets of the blocks of a node
+    };
+    std::vector<Block>  blocks;
+    int uniformDOF = -1;             // dof of every node, or -1 if mixed
+    struct Arrays {
+      std::vector<double> disp, vel, accel;
+    };
+    std::shared_ptr<Arrays> arrays;
+};
+
+#endif
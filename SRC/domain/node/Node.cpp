@@ -35,6 +35,8 @@
 #include <FEM_ObjectBroker.h>
 #include <DOF_Group.h>
 #include <string.h>
+#include <memory>
+#include <vector>
 #include <Information.h>
 #include <Parameter.h>
 
@@ -50,8 +52,25 @@
 
 #include <OPS_Globals.h>
 
-Matrix **Node::theMatrices = nullptr;
-int Node::numMatrices = 0;
+namespace {
+// Work matrices returned by getMass(), getDamp() and their sensitivities
+// when a node has no matrix of its own. There is one per number of dof
+// and per thread, so that models analyzed on different threads do not
+// share them.
+Matrix &
+getWorkMatrix(int numDOF)
+{
+  thread_local std::vector<std::unique_ptr<Matrix>> theMatrices;
+
+  if (static_cast<int>(theMatrices.size()) <= numDOF)
+    theMatrices.resize(numDOF+1);
+
+  if (theMatrices[numDOF] == nullptr)
+    theMatrices[numDOF] = std::make_unique<Matrix>(numDOF, numDOF);
+
+  return *theMatrices[numDOF];
+}
+} // namespace
 
 
 // for FEM_Object Broker to use
@@ -63,7 +82,7 @@ Node::Node(int theClassTag)
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
- index(-1), reaction(0)//, displayLocation(0)
+ reaction(0)//, displayLocation(0)
 {
   // for FEM_ObjectBroker, recvSelf() must be invoked on object
 
@@ -86,7 +105,7 @@ Node::Node(int tag, int theClassTag)
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
   R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
- index(-1), reaction(0)//, displayLocation(0)
+ reaction(0)//, displayLocation(0)
 {
   // for subclasses - they must implement all the methods with
   // their own data structures.
@@ -109,7 +128,7 @@ Node::Node(int tag, int ndof, double Crd1, Vector *dLoc)
  incrDeltaDisp(0),
  disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
- index(-1), reaction(0)//, displayLocation(0)
+ reaction(0)//, displayLocation(0)
 {
   this->createDisp();
   // AddingSensitivity:BEGIN /////////////////////////////////////////
@@ -151,8 +170,6 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
   Crd = new Vector(2);
   (*Crd)(0) = Crd1;
   (*Crd)(1) = Crd2;
-
-  index = -1;
 }
 
 
@@ -183,8 +200,6 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
   (*Crd)(0) = Crd1;
   (*Crd)(1) = Crd2;
   (*Crd)(2) = Crd3;
-
-  index = -1;
 }
 
 
@@ -246,8 +261,6 @@ Node::Node(const Node &otherNode, bool copyMass)
   if (otherNode.R != 0) {
     R = new Matrix(*(otherNode.R));
   }
-
-  index = -1;
 }
 
 
@@ -287,13 +300,13 @@ Node::~Node()
     if (unbalLoad != 0)
       delete unbalLoad;
 
-    if (disp != 0)
+    if (disp != 0 && !sharedDisp)
       delete [] disp;
 
-    if (vel != 0)
+    if (vel != 0 && !sharedVelAccel)
       delete [] vel;
 
-    if (accel != 0)
+    if (accel != 0 && !sharedVelAccel)
       delete [] accel;
 
     if (mass != 0)
@@ -845,14 +858,11 @@ Node::revertToStart()
 const Matrix &
 Node::getMass(void)
 {
-    if (index == -1) {
-      setGlobalMatrices();
-    }
-
     // make sure it was created before we return it
     if (mass == 0) {
-      theMatrices[index]->Zero();
-      return *theMatrices[index];
+      Matrix &result = getWorkMatrix(numberDOF);
+      result.Zero();
+      return result;
     } else
       return *mass;
 }
@@ -868,16 +878,13 @@ Node::setRayleighDampingFactor(double alpham) {
 const Matrix &
 Node::getDamp(void)
 {
-    if (index == -1) {
-      setGlobalMatrices();
-    }
-
     // make sure it was created before we return it
     if (mass == 0 || alphaM == 0.0) {
-      theMatrices[index]->Zero();
-      return *theMatrices[index];
+      Matrix &result = getWorkMatrix(numberDOF);
+      result.Zero();
+      return result;
     } else {
-      Matrix &result = *theMatrices[index];
+      Matrix &result = getWorkMatrix(numberDOF);
       result = *mass;
       result *= alphaM;
       return result;
@@ -888,16 +895,13 @@ Node::getDamp(void)
 const Matrix &
 Node::getDampSensitivity(void)
 {
-    if (index == -1) {
-      setGlobalMatrices();
-    }
-
     // make sure it was created before we return it
     if (mass == 0 || alphaM == 0.0) {
-      theMatrices[index]->Zero();
-      return *theMatrices[index];
+      Matrix &result = getWorkMatrix(numberDOF);
+      result.Zero();
+      return result;
     } else {
-      Matrix &result = *theMatrices[index];
+      Matrix &result = getWorkMatrix(numberDOF);
         result.Zero();
       //result = *mass;
       //result *= alphaM;
@@ -1112,7 +1116,14 @@ Node::sendSelf(int cTag, Channel &theChannel)
       return res;
     }
 
-    res = theChannel.sendVector(dataTag, cTag, *Crd);
+    // the coordinates go with the Rayleigh factor of the mass
+    const int numberCrd = Crd->Size();
+    Vector crdData(numberCrd+1);
+    for (int i=0; i<numberCrd; i++)
+      crdData(i) = (*Crd)(i);
+    crdData(numberCrd) = alphaM;
+
+    res = theChannel.sendVector(dataTag, cTag, crdData);
     if (res < 0) {
       opserr << " Node::sendSelf() - failed to send Vecor data\n";
       return res;
@@ -1198,10 +1209,14 @@ Node::recvSelf(int cTag, Channel &theChannel,
     if (Crd == nullptr)
       Crd = new Vector(numberCrd);
 
-    if (theChannel.recvVector(dataTag, cTag, *Crd) < 0) {
+    Vector crdData(numberCrd+1);
+    if (theChannel.recvVector(dataTag, cTag, crdData) < 0) {
       opserr << "Node::recvSelf() - failed to receive the Coordinate vector\n";
       return -2;
     }
+    for (int i=0; i<numberCrd; i++)
+      (*Crd)(i) = crdData(i);
+    alphaM = crdData(numberCrd);
 
     if (commitDisp == nullptr)
       this->createDisp();
@@ -1227,6 +1242,10 @@ Node::recvSelf(int cTag, Channel &theChannel,
       trialDisp->Zero();
     }
 
+    // the increments are not sent; they start again from the committed state
+    incrDisp->Zero();
+    incrDeltaDisp->Zero();
+
 
     if (data(3) == 0) {
       // create the vel vectors if node is a total blank
@@ -1242,6 +1261,11 @@ Node::recvSelf(int cTag, Channel &theChannel,
       // set the trial quantity
       for (int i=0; i<numberDOF; i++)
       vel[i] = vel[i+numberDOF];  // set trial equal committed
+
+    } else if (commitVel != nullptr) {
+      // not formed when sent, e.g. before any dynamic analysis
+      commitVel->Zero();
+      trialVel->Zero();
     }
 
     if (data(4) == 0) {
@@ -1258,6 +1282,10 @@ Node::recvSelf(int cTag, Channel &theChannel,
       // set the trial values
       for (int i=0; i<numberDOF; i++)
       accel[i] = accel[i+numberDOF];  // set trial equal committed
+
+    } else if (commitAccel != nullptr) {
+      commitAccel->Zero();
+      trialAccel->Zero();
     }
 
     if (data(5) == 0) {
@@ -1269,6 +1297,8 @@ Node::recvSelf(int cTag, Channel &theChannel,
       opserr << "Node::recvSelf() - failed to receive Mass data\n";
       return -6;
       }
+    } else if (mass != nullptr) {
+      mass->Zero();
     }
 
     if (data(12) == 0) {
@@ -1298,33 +1328,11 @@ Node::recvSelf(int cTag, Channel &theChannel,
       opserr << "Node::recvSelf() - failed to receive Load data\n";
       return res;
       }
+    } else if (unbalLoad != nullptr) {
+      unbalLoad->Zero();
     }
 
 
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == numberDOF) {
-      index = i;
-      i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-
-    nextMatrices[numMatrices] = new Matrix(numberDOF, numberDOF);
-
-    if (numMatrices != 0)
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
-
-
   return 0;
 }
 
@@ -1367,6 +1375,88 @@ Node::createAccel(void)
   return 0;
 }
 
+void
+Node::getStateSize(int &dispSize, int &velSize, int &accelSize) const
+{
+  dispSize  = 4*numberDOF;
+  velSize   = 2*numberDOF;
+  accelSize = 2*numberDOF;
+}
+
+int
+Node::setStateStorage(double *newDisp, double *newVel, double *newAccel)
+{
+  const bool shared = (newDisp != nullptr);
+  if (!shared)
+    newDisp = new double[4*numberDOF]{};
+
+  if (disp != nullptr) {
+    for (int i=0; i<4*numberDOF; i++)
+      newDisp[i] = disp[i];
+    if (!sharedDisp)
+      delete [] disp;
+  }
+  disp = newDisp;
+  sharedDisp = shared;
+
+  if (trialDisp == nullptr) {
+    trialDisp     = new Vector(disp, numberDOF);
+    commitDisp    = new Vector(&disp[numberDOF], numberDOF);
+    incrDisp      = new Vector(&disp[2*numberDOF], numberDOF);
+    incrDeltaDisp = new Vector(&disp[3*numberDOF], numberDOF);
+  } else {
+    trialDisp->setData(disp, numberDOF);
+    commitDisp->setData(&disp[numberDOF], numberDOF);
+    incrDisp->setData(&disp[2*numberDOF], numberDOF);
+    incrDeltaDisp->setData(&disp[3*numberDOF], numberDOF);
+  }
+
+  return this->setVelAccelStorage(newVel, newAccel);
+}
+
+int
+Node::setVelAccelStorage(double *newVel, double *newAccel)
+{
+  const bool shared = (newVel != nullptr && newAccel != nullptr);
+  if (!shared) {
+    newVel   = new double[2*numberDOF]{};
+    newAccel = new double[2*numberDOF]{};
+  }
+
+  if (vel != nullptr) {
+    for (int i=0; i<2*numberDOF; i++)
+      newVel[i] = vel[i];
+    if (!sharedVelAccel)
+      delete [] vel;
+  }
+  if (accel != nullptr) {
+    for (int i=0; i<2*numberDOF; i++)
+      newAccel[i] = accel[i];
+    if (!sharedVelAccel)
+      delete [] accel;
+  }
+  vel   = newVel;
+  accel = newAccel;
+  sharedVelAccel = shared;
+
+  if (trialVel == nullptr) {
+    commitVel = new Vector(&vel[numberDOF], numberDOF);
+    trialVel  = new Vector(vel, numberDOF);
+  } else {
+    commitVel->setData(&vel[numberDOF], numberDOF);
+    trialVel->setData(vel, numberDOF);
+  }
+
+  if (trialAccel == nullptr) {
+    commitAccel = new Vector(&accel[numberDOF], numberDOF);
+    trialAccel  = new Vector(accel, numberDOF);
+  } else {
+    commitAccel->setData(&accel[numberDOF], numberDOF);
+    trialAccel->setData(accel, numberDOF);
+  }
+  return 0;
+}
+
 void
 Node::Print(OPS_Stream &s, int flag)
 {
@@ -1424,12 +1514,10 @@ Node::Print(OPS_Stream &s, int flag)
 Matrix
 Node::getMassSensitivity(void)
 {
-  if (index == -1)
-      setGlobalMatrices();
-
   if (mass == 0) {
-    theMatrices[index]->Zero();
-    return *theMatrices[index];
+    Matrix &result = getWorkMatrix(numberDOF);
+    result.Zero();
+    return result;
 
   } else {
     Matrix massSens(mass->noRows(),mass->noCols());
@@ -1887,33 +1975,3 @@ Node::setNodalThermalActionPtr(NodalThermalAction* theAction)
     theNodalThermalActionPtr = theAction;
 }
 //Add Pointer to NodalThermalAction id applicable-----end------L.Jiang, {SIF]
-
-int
-Node::setGlobalMatrices()
-{
-    if (index == -1) {
-      for (int i=0; i<numMatrices; i++) {
-          if (theMatrices[i]->noRows() == numberDOF) {
-            index = i;
-            i = numMatrices;
-          }
-      }
-    }
-    if (index == -1) {
-      Matrix **nextMatrices = new Matrix *[numMatrices+1];
-
-      for (int j=0; j<numMatrices; j++)
-          nextMatrices[j] = theMatrices[j];
-
-      Matrix *theMatrix = new Matrix(numberDOF, numberDOF);
-
-      nextMatrices[numMatrices] = theMatrix;
-      if (numMatrices != 0)
-          delete [] theMatrices;
-      index = numMatrices;
-      numMatrices++;
-      theMatrices = nextMatrices;
-    }
-
-    return 0;
-}
@@ -116,6 +116,14 @@ class Node :
     VIRTUAL int incrTrialAccel(const Vector &);
 
     // Dynamics
+    // The response arrays may be moved into storage owned by the
+    // Domain (see NodalStateStore). getStateSize() gives the length of
+    // the disp, vel and accel arrays; setStateStorage() copies the
+    // current state into the given arrays and uses them from then on.
+    // Passing nullptr moves the state back into arrays owned by the node.
+    virtual void getStateSize(int &dispSize, int &velSize, int &accelSize) const;
+    virtual int  setStateStorage(double *disp, double *vel, double *accel);
+
     VIRTUAL const Matrix &getMass();
     VIRTUAL const Matrix &getDamp();
     VIRTUAL int setMass(const Matrix &theMass);
@@ -202,21 +210,17 @@ class Node :
     Vector *trialVel,  *trialAccel;   // trial quantities
     Vector *unbalLoad;                // unbalanced load
 
+    int setVelAccelStorage(double *vel, double *accel);
+
   private:
     double *disp;
+    bool sharedDisp = false;          // true if disp is owned by a NodalStateStore
+    bool sharedVelAccel = false;      // true if vel and accel are
 
 #if 1
     Domain* theDomain;
 #endif
 
-    // Private global state
-    int setGlobalMatrices();
-
-    static Matrix **theMatrices;
-    static int numMatrices;
-    static Matrix **theVectors;
-    static int numVectors;
-    int index;
 
 
     // priavte methods used to create the Vector objects 
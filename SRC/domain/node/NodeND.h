@@ -112,6 +112,21 @@ class NodeND: public Node {
       return 0;
   }
 
+  virtual int setStateStorage(double *newDisp, double *newVel, double *newAccel) override final {
+      // the displacements return to the inline array when released
+      double *target = (newDisp != nullptr) ? newDisp : displData;
+      if (target != displ) {
+        for (int i=0; i<4*ndf; i++)
+          target[i] = displ[i];
+        displ = target;
+        trialDisp->setData(displ, ndf);
+        commitDisp->setData(&displ[ndf], ndf);
+        incrDisp->setData(&displ[2*ndf], ndf);
+        incrDeltaDisp->setData(&displ[3*ndf], ndf);
+      }
+      return this->setVelAccelStorage(newVel, newAccel);
+  }
+
   private:
     int createDisp(void) override final {
       trialDisp     = new Vector(displ, ndf);
@@ -122,6 +137,7 @@ class NodeND: public Node {
     }
 
 //  OpenSees::VectorND<4*ndf> displ = {{0.0}};
-    double displ[4*ndf] = {{0.0}};
+    double displData[4*ndf] = {{0.0}};
+    double *displ = displData;
 };
 
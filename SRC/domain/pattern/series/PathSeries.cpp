@@ -33,12 +33,6 @@
 #include <math.h>
 #include <string.h>
 
-#include <fstream>
-using std::ifstream;
-
-#include <iomanip>
-using std::ios;
-
 #include <PathTimeSeries.h>
 #include <elementAPI.h>
 #include <string>
@@ -239,16 +233,18 @@ PathSeries::PathSeries(int tag,
    thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor),
    otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart)
 {
-  // create a copy of the vector containing path points
+  // share the path points with any series holding the same values
   if (prependZero == false) {
-    thePath = new Vector(theLoadPath);
+    theData = OpenSees::SeriesData::share(theLoadPath);
 
-  } else if (theLoadPath != 0) {
+  } else {
     // prepend a zero value
-    thePath = new Vector(1 + theLoadPath.Size());
-    thePath->Assemble(theLoadPath, 1);
+    Vector path(1 + theLoadPath.Size());
+    path.Assemble(theLoadPath, 1);
+    theData = OpenSees::SeriesData::share(path);
   }
 
+  thePath = theData->view();
 }
 
 
@@ -258,60 +254,48 @@ PathSeries::PathSeries(int tag,
                        double theFactor,
                        bool last,
                        bool prependZero,
-                       double tStart)
+                       double tStart,
+                       bool binary)
   :TimeSeries(tag, TSERIES_TAG_PathSeries),
    thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor),
    otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart)
 {
-  // determine the number of data points .. open file and count num entries
-  int numDataPoints = 0;
-  double dataPoint;
-
-  ifstream theFile;
-  theFile.open(fileName);
-
-  if (theFile.bad() || !theFile.is_open()) {
+  // a file read before is not read again
+  theData = OpenSees::SeriesData::read(fileName, binary);
+  if (theData == nullptr) {
     opserr << "WARNING - PathSeries::PathSeries()";
     opserr << " - could not open file " << fileName << endln;
-  } else {
-    while (theFile >> dataPoint)
-      numDataPoints++;
-  }   
-  theFile.close();
-
-  //
-  // create a vector and read in the data
-  //
-  if (numDataPoints == 0)
     return;
+  }
 
-  // increment size if we need to prepend a zero value
-  if (prependZero == true)
-    numDataPoints++;
-  
-  // first open the file
-  ifstream theFile1;
-  theFile1.open(fileName, ios::in);
-  if (theFile1.bad() || !theFile1.is_open()) {
-    opserr << "WARNING - PathSeries::PathSeries()";
-    opserr << " - could not open file " << fileName << endln;
+  if (theData->size() == 0) {
+    theData.reset();
+    return;
+  }
 
+  if (prependZero == true) {
+    Vector path(1 + theData->size());
+    for (int i = 0; i < theData->size(); i++)
+      path(i+1) = theData->data()[i];
+    theData = OpenSees::SeriesData::share(path);
   }
 
-  // now create the vector
-  thePath = new Vector(numDataPoints);
+  thePath = theData->view();
+}
 
-  // read the data from the file
-  int count = 0;
-  if (prependZero == true)
-    count++;
-  while (theFile1 >> dataPoint) {
-    (*thePath)(count) = dataPoint;
-    count++;
-  }
 
-  // finally close the file
-  theFile1.close();
+PathSeries::PathSeries(int tag,
+                       OpenSees::SeriesData::Handle data,
+                       double theTimeIncr, 
+                       double theFactor,
+                       bool last,
+                       double tStart)
+  :TimeSeries(tag, TSERIES_TAG_PathSeries),
+   theData(data), thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor),
+   otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart)
+{
+  if (theData != nullptr)
+    thePath = theData->view();
 }
 
 
@@ -324,8 +308,8 @@ PathSeries::~PathSeries()
 TimeSeries *
 PathSeries::getCopy(void) {
   if (thePath != nullptr)
-    return new PathSeries(this->getTag(), *thePath, pathTimeIncr, cFactor,
-                          useLast, false, startTime);
+    return new PathSeries(this->getTag(), theData, pathTimeIncr, cFactor,
+                          useLast, startTime);
   else
     return nullptr;
 }
@@ -468,22 +452,15 @@ PathSeries::recvSelf(int commitTag, Channel &theChannel,
   
   // get the path vector, only receive it once as it can't change
   if (thePath == 0 && size > 0) {
-    thePath = new Vector(size);
-    if (thePath == 0 || thePath->Size() == 0) {
-      opserr << "PathSeries::recvSelf() - ran out of memory";
-      opserr << " a Vector of size: " <<  size << endln;  
-      if (thePath != 0)
-	delete thePath;
-      thePath = 0;
-      return -1;
-    }
-
-    result = theChannel.recvVector(otherDbTag, lastSendCommitTag, *thePath);    
+    Vector path(size);
+    result = theChannel.recvVector(otherDbTag, lastSendCommitTag, path);    
     if (result < 0) {
       opserr << "PathSeries::recvSelf() - ";
       opserr << "channel failed to receive the Path Vector\n";
       return result;  
     }
+    theData = OpenSees::SeriesData::share(path);
+    thePath = theData->view();
   }
 
   return 0;    
@@ -36,6 +36,7 @@
 // apart. (could be provided in another vector if different)
 
 #include <TimeSeries.h>
+#include <SeriesData.h>
 
 class Vector;
 
@@ -56,7 +57,14 @@ class PathSeries : public TimeSeries
         double cfactor = 1.0,
         bool useLast = false,
         bool prependZero = false,
-        double startTime = 0.0);
+        double startTime = 0.0,
+        bool binary = false);
+    PathSeries(int tag,
+        OpenSees::SeriesData::Handle theData,
+        double pathTimeIncr,
+        double cfactor,
+        bool useLast,
+        double startTime);
     PathSeries();
     
     // destructor
@@ -80,7 +88,8 @@ class PathSeries : public TimeSeries
   protected:
     
   private:
-    Vector *thePath;      // vector containing the data points
+    OpenSees::SeriesData::Handle theData; // the data points, shared with copies
+    Vector *thePath;      // vector viewing the data points
     double pathTimeIncr;  // specifies the time increment used in load path vector
     double cFactor;       // additional factor on the returned load factor
     int otherDbTag;       // a database tag needed for the vector object
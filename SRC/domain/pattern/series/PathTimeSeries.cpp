@@ -35,12 +35,6 @@
 #include <Channel.h>
 #include <math.h>
 
-#include <fstream>
-using std::ifstream;
-
-#include <iomanip>
-using std::ios;
-
 PathTimeSeries::PathTimeSeries()        
   :TimeSeries(TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(0.0),
@@ -64,24 +58,13 @@ PathTimeSeries::PathTimeSeries(int tag,
     opserr << "WARNING PathTimeSeries::PathTimeSeries() - vector containing data ";
     opserr << "points for path and time are not of the same size\n";
 
-  } else {
-
-    // create copies of the vectors
-    thePath = new Vector(theLoadPath);
-    time = new Vector(theTimePath);
-
-    // ensure did not run out of memory creating copies
-    if (thePath == 0 || thePath->Size() == 0 ||
-        time == 0 || time->Size() == 0) {
-      
-      opserr << "WARNING PathTimeSeries::PathTimeSeries() - out of memory\n ";
-      if (thePath != 0)
-        delete thePath;
-      if (time != 0)
-        delete time;
-      thePath = 0;
-      time = 0;
-    }
+  } else if (theLoadPath.Size() != 0) {
+
+    // share the vectors with any series holding the same values
+    pathData = OpenSees::SeriesData::share(theLoadPath);
+    timeData = OpenSees::SeriesData::share(theTimePath);
+    thePath = pathData->view();
+    time = timeData->view();
   }
 }
 
@@ -89,190 +72,97 @@ PathTimeSeries::PathTimeSeries(int tag,
                                const char *filePathName, 
                                const char *fileTimeName, 
                                double theFactor,
-                               bool last)
+                               bool last,
+                               bool binary)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
    dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
    useLast(last)
 {
-  // determine the number of data points
-  int numDataPoints1 =0;
-  int numDataPoints2 =0;
-  double dataPoint;
-  ifstream theFile;
-  
-  // first open and go through file containing path
-  theFile.open(filePathName, ios::in);
-  if (theFile.bad() || !theFile.is_open()) {
+  // files read before are not read again
+  OpenSees::SeriesData::Handle path = OpenSees::SeriesData::read(filePathName, binary);
+  if (path == nullptr) {
     opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
     opserr << " - could not open file " << filePathName << endln;
-  } else {
-    while (theFile >> dataPoint)
-      numDataPoints1++;
-  }   
-  theFile.close();
-
-  // now open and go through file containing time
-  ifstream theFile1;
-  theFile1.open(fileTimeName, ios::in);
-  if (theFile1.bad() || !theFile1.is_open()) {
+  }
+
+  OpenSees::SeriesData::Handle times = OpenSees::SeriesData::read(fileTimeName, binary);
+  if (times == nullptr) {
     opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
     opserr << " - could not open file " << fileTimeName << endln;
-  } else {
-    while (theFile1 >> dataPoint)
-      numDataPoints2++;
-  }   
-  theFile1.close();
+  }
+
+  if (path == nullptr || times == nullptr)
+    return;
 
   // check number of data entries in both are the same
-  if (numDataPoints1 != numDataPoints2) {
+  if (path->size() != times->size()) {
     opserr << "WARNING PathTimeSeries::PathTimeSeries() - files containing data ";
     opserr << "points for path and time do not contain same number of points\n";
-  } else {
-
-
-    // create a vector and read in the data
-    if (numDataPoints1 != 0) {
-
-      // now create the two vector
-      thePath = new Vector(numDataPoints1);
-      time = new Vector(numDataPoints1);
-
-      // ensure did not run out of memory creating copies
-      if (thePath == 0 || thePath->Size() == 0 ||
-          time == 0 || time->Size() == 0) {
-          
-        opserr << "WARNING PathTimeSeries::PathTimeSeries() - out of memory\n ";
-        if (thePath != 0)
-          delete thePath;
-        if (time != 0)
-          delete time;
-        thePath = 0;
-        time = 0;
-      }
-      
-      // first open the path file and read in the data
-      ifstream theFile2;
-      theFile2.open(filePathName, ios::in);
-      if (theFile2.bad() || !theFile2.is_open()) {
-        opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
-        opserr << " - could not open file " << filePathName << endln;
-        delete thePath;
-        delete time;
-        thePath = 0;
-        time =0;
-      } else { // read in the path data and then do the time
-        int count = 0;
-        while (theFile2 >> dataPoint) {
-          (*thePath)(count) = dataPoint;
-          count++;
-        }
-
-        // finally close the file
-        theFile2.close();
-
-        // now open the time file and read in the data
-        ifstream theFile3;
-        theFile3.open(fileTimeName, ios::in);
-        if (theFile3.bad() || !theFile3.is_open()) {
-          opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
-          opserr << " - could not open file " << fileTimeName << endln;
-          delete thePath;
-          delete time;
-          thePath = 0;
-          time =0;
-        } else { // read in the data
-          int count = 0;
-          while (theFile3 >> dataPoint) {
-            (*time)(count) = dataPoint;
-            count++;
-          }
-          theFile3.close();
-        } // read in the data 
-      }   // read in the path data and then do the time
-    }
+
+  } else if (path->size() != 0) {
+    pathData = path;
+    timeData = times;
+    thePath = pathData->view();
+    time = timeData->view();
   }
 }
 
 PathTimeSeries::PathTimeSeries(int tag,
                                const char *fileName, 
                                double theFactor,
-                               bool last)
+                               bool last,
+                               bool binary)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
    dbTag1(0), dbTag2(0), lastChannel(0), useLast(last)
 {
-  // determine the number of data points
-  int numDataPoints = 0;
-  double dataPoint;
-  ifstream theFile;
-  
-  // first open and go through file counting entries
-  theFile.open(fileName, ios::in);
-  if (theFile.bad() || !theFile.is_open()) {
+  OpenSees::SeriesData::Handle pairs = OpenSees::SeriesData::read(fileName, binary);
+  if (pairs == nullptr) {
     opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
     opserr << " - could not open file " << fileName << endln;
-  }
-  else {
-    while (theFile >> dataPoint) {
-      numDataPoints++;
-      theFile >> dataPoint;        // Read in second value of pair
-    }
+    return;
   }
 
+  int numDataPoints = pairs->size();
   if ((numDataPoints % 2) != 0) {
     opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
     opserr << " - num data entries in file NOT EVEN! " << fileName << endln;
     numDataPoints--;
   }
 
+  if (numDataPoints == 0)
+    return;
 
-  theFile.close();
-
-  // create a vector and read in the data
-  if (numDataPoints != 0) {
-    
-    // now create the two vector
-    thePath = new Vector(numDataPoints/2);
-    time = new Vector(numDataPoints/2);
-    
-    // ensure did not run out of memory creating copies
-    if (thePath == 0 || thePath->Size() == 0 || time == 0 || time->Size() == 0) {
-      
-      opserr << "WARNING PathTimeSeries::PathTimeSeries() - out of memory\n ";
-      if (thePath != 0)
-        delete thePath;
-      if (time != 0)
-        delete time;
-      thePath = 0;
-      time = 0;
-    }
-    
-    // first open the file and read in the data
-    ifstream theFile1;
-    theFile1.open(fileName, ios::in);
-    if (theFile1.bad() || !theFile1.is_open()) {
-      
-      opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
-      opserr << " - could not open file " << fileName << endln;
-      delete thePath;
-      delete time;
-      thePath = 0;
-      time =0;
-    }
-    else { // read in the time and then read the value
-      int count = 0;
-      while (theFile1 >> dataPoint) {
-        (*time)(count) = dataPoint;
-        theFile1 >> dataPoint;
-        (*thePath)(count) = dataPoint;
-
-        count++;
-      }
-      
-      // finally close the file
-      theFile1.close();
-    } 
+  // split the time and value pairs
+  Vector values(numDataPoints/2);
+  Vector times(numDataPoints/2);
+  const double *data = pairs->data();
+  for (int i = 0; i < numDataPoints/2; i++) {
+    times(i)  = data[2*i];
+    values(i) = data[2*i+1];
+  }
+
+  pathData = OpenSees::SeriesData::share(values);
+  timeData = OpenSees::SeriesData::share(times);
+  thePath = pathData->view();
+  time = timeData->view();
+}
+
+PathTimeSeries::PathTimeSeries(int tag,
+                               OpenSees::SeriesData::Handle path,
+                               OpenSees::SeriesData::Handle times,
+                               double theFactor,
+                               bool last)
+  :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
+   pathData(path), timeData(times),
+   thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
+   dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
+   useLast(last)
+{
+  if (pathData != nullptr && timeData != nullptr) {
+    thePath = pathData->view();
+    time = timeData->view();
   }
 }
 
@@ -287,7 +177,7 @@ PathTimeSeries::~PathTimeSeries()
 TimeSeries *
 PathTimeSeries::getCopy(void) 
 {
-  return new PathTimeSeries(this->getTag(), *thePath, *time, cFactor, useLast);
+  return new PathTimeSeries(this->getTag(), pathData, timeData, cFactor, useLast);
 }
 
 double
@@ -482,33 +372,24 @@ PathTimeSeries::recvSelf(int commitTag, Channel &theChannel,
   if (thePath == 0 && size > 0) {
     dbTag1 = data(2);
     dbTag2 = data(3);
-    thePath = new Vector(size);
-    time = new Vector(size);
-    if (thePath == 0 || time == 0 ||
-        thePath->Size() == 0 || time->Size() == 0) {
-
-      opserr << "PathTimeSeries::recvSelf() - ran out of memory";
-      opserr << " a Vector of size: " <<  size << endln;  
-      if (thePath != 0)
-        delete thePath;
-      if (time != 0)
-        delete time;
-      thePath = 0;
-      time = 0;
-      return -1;
-    }
-    result = theChannel.recvVector(dbTag1, lastSendCommitTag, *thePath);    
+    Vector path(size);
+    Vector times(size);
+    result = theChannel.recvVector(dbTag1, lastSendCommitTag, path);    
     if (result < 0) {
       opserr << "PathTimeSeries::recvSelf() - ";
       opserr << "channel failed to receive the Path Vector\n";
       return result;  
     }
-    result = theChannel.recvVector(dbTag2, lastSendCommitTag, *time);    
+    result = theChannel.recvVector(dbTag2, lastSendCommitTag, times);    
     if (result < 0) {
       opserr << "PathTimeSeries::recvSelf() - ";
       opserr << "channel failed to receive the time Vector\n";
       return result;  
     }
+    pathData = OpenSees::SeriesData::share(path);
+    timeData = OpenSees::SeriesData::share(times);
+    thePath = pathData->view();
+    time = timeData->view();
   }
   return 0;    
 }
@@ -39,6 +39,7 @@
 // What: "@(#) PathTimeSeries.h, revA"
 
 #include <TimeSeries.h>
+#include <SeriesData.h>
 
 class Vector;
 
@@ -56,12 +57,20 @@ class PathTimeSeries : public TimeSeries
 		 const char *fileNamePath, 
 		 const char *fileNameTime, 
 		 double cfactor = 1.0,
-         bool useLast = false);
+         bool useLast = false,
+         bool binary = false);
   
   PathTimeSeries(int tag,
 		 const char *fileName,
 		 double cfactor = 1.0,
-         bool useLast = false);
+         bool useLast = false,
+         bool binary = false);
+
+  PathTimeSeries(int tag,
+		 OpenSees::SeriesData::Handle pathData,
+		 OpenSees::SeriesData::Handle timeData,
+		 double cfactor,
+         bool useLast);
 
     PathTimeSeries();    
     
@@ -86,8 +95,9 @@ class PathTimeSeries : public TimeSeries
   protected:
     
   private:
-    Vector *thePath;      // vector containing the data points
-    Vector *time;		  // vector containing the time values of data points
+    OpenSees::SeriesData::Handle pathData, timeData; // shared with copies
+    Vector *thePath;      // vector viewing the data points
+    Vector *time;		  // vector viewing the time values of data points
     int currentTimeLoc;   // current location in time
     double cFactor;       // additional factor on the returned load factor
     int dbTag1, dbTag2;   // additional database tags needed for vector objects
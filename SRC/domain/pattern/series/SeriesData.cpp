@@ -0,0 +1,222 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <SeriesData.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <charconv>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+#include <stdint.h>
+
+namespace OpenSees {
+
+namespace {
+
+// the contents of a file, read into memory of our own so that later
+// changes to the file cannot reach the values shared from it
+bool
+readBytes(const char *fileName, std::vector<char> &bytes)
+{
+  std::ifstream file(fileName, std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file.is_open())
+    return false;
+  const std::streamoff size = file.tellg();
+  if (size < 0)
+    return false;
+  bytes.resize(static_cast<std::size_t>(size));
+  file.seekg(0);
+  return size == 0 || file.read(bytes.data(), size).good();
+}
+
+
+// FNV-1a, a word at a time
+uint64_t
+hashBytes(const char *bytes, std::size_t size)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  std::size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    uint64_t word;
+    memcpy(&word, bytes + i, 8);
+    hash = (hash ^ word)*0x100000001b3ULL;
+  }
+  for (; i < size; i++)
+    hash = (hash ^ static_cast<unsigned char>(bytes[i]))*0x100000001b3ULL;
+  return hash;
+}
+
+
+struct Key {
+  uint64_t    hash;
+  std::size_t size;
+
+  bool operator==(const Key &other) const {
+    return hash == other.hash && size == other.size;
+  }
+};
+
+struct KeyHash {
+  std::size_t operator()(const Key &key) const {
+    return static_cast<std::size_t>(key.hash);
+  }
+};
+
+
+// buffers are known by a hash of their values, which are compared in full
+// before one is shared
+struct Cache {
+  std::mutex mutex;
+  std::unordered_multimap<Key, std::weak_ptr<const SeriesData>, KeyHash> buffers;
+
+  void prune(void) {
+    for (auto it = buffers.begin(); it != buffers.end(); )
+      it = it->second.expired() ? buffers.erase(it) : std::next(it);
+  }
+};
+
+Cache &
+cache()
+{
+  static Cache theCache;
+  return theCache;
+}
+
+
+// the numbers up to the first token that is not one
+void
+parseASCII(const char *p, const char *end, std::vector<double> &values)
+{
+  while (true) {
+    while (p < end && isspace(static_cast<unsigned char>(*p)))
+      p++;
+    if (p < end && *p == '+')
+      p++;
+    if (p >= end)
+      return;
+
+    double value;
+    const std::from_chars_result result = std::from_chars(p, end, value);
+    if (result.ec != std::errc())
+      return;
+    values.push_back(value);
+    p = result.ptr;
+  }
+}
+
+} // namespace
+
+
+SeriesData::SeriesData()
+:begin(nullptr), numValues(0)
+{
+
+}
+
+
+SeriesData::~SeriesData()
+{
+
+}
+
+
+Vector *
+SeriesData::view(void) const
+{
+  return new Vector(const_cast<double *>(begin), numValues);
+}
+
+
+//
+// find a buffer holding the given values, or make one; the new buffer
+// takes over the values
+//
+static SeriesData::Handle
+findOrAdd(const double *values, std::size_t n,
+          const std::function<SeriesData::Handle()> &make)
+{
+  const char *bytes = reinterpret_cast<const char *>(values);
+  const Key key{hashBytes(bytes, n*sizeof(double)), n};
+
+  Cache &theCache = cache();
+  std::lock_guard<std::mutex> lock(theCache.mutex);
+  auto range = theCache.buffers.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    SeriesData::Handle existing = it->second.lock();
+    if (existing != nullptr && memcmp(existing->data(), values, n*sizeof(double)) == 0)
+      return existing;
+  }
+
+  theCache.prune();
+  SeriesData::Handle handle = make();
+  theCache.buffers.emplace(key, handle);
+  return handle;
+}
+
+
+SeriesData::Handle
+SeriesData::share(const double *values, std::size_t n)
+{
+  return findOrAdd(values, n, [&]() {
+    std::shared_ptr<SeriesData> data(new SeriesData());
+    data->values.assign(values, values + n);
+    data->begin     = data->values.data();
+    data->numValues = static_cast<int>(n);
+    return Handle(data);
+  });
+}
+
+
+SeriesData::Handle
+SeriesData::share(const Vector &values)
+{
+  const int n = values.Size();
+  return share(n > 0 ? &const_cast<Vector &>(values)(0) : nullptr, n);
+}
+
+
+SeriesData::Handle
+SeriesData::read(const char *fileName, bool binary)
+{
+  std::vector<char> bytes;
+  if (!readBytes(fileName, bytes))
+    return nullptr;
+
+  // a file is shared like any other values, so two files share a buffer
+  // only when the values read from them are equal
+  std::vector<double> values;
+  if (binary) {
+    if (bytes.size() % sizeof(double) != 0)
+      opserr << "WARNING - SeriesData::read() - " << fileName
+             << " does not hold a whole number of float64 values\n";
+    values.resize(bytes.size()/sizeof(double));
+    if (!values.empty())
+      memcpy(values.data(), bytes.data(), values.size()*sizeof(double));
+  } else {
+    values.reserve(bytes.size()/8);
+    parseASCII(bytes.data(), bytes.data() + bytes.size(), values);
+  }
+  bytes = std::vector<char>();
+
+  return findOrAdd(values.data(), values.size(), [&]() {
+    std::shared_ptr<SeriesData> data(new SeriesData());
+    data->values.swap(values);
+    data->values.shrink_to_fit();
+    data->begin     = data->values.data();
+    data->numValues = static_cast<int>(data->values.size());
+    return Handle(data);
+  });
+}
+
+} // namespace OpenSees
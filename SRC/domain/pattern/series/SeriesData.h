@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SeriesData holds the values of a time series (a ground
+// motion record, a load path) in an immutable buffer shared by every
+// series that uses the same values. Buffers are found by their values,
+// which are hashed and then compared in full: reading a file whose values
+// were read before, or sharing values equal to ones already held, returns
+// the existing buffer, so fifty load patterns built from one record, or
+// the copies each pattern makes of its series, hold the record once. A
+// buffer is freed when the last series using it is destroyed.
+//
+// ASCII files are parsed with std::from_chars, and read the numbers up to
+// the first token that is not one, as the >> loops did. Binary files hold
+// native float64 values. Either way the values are copied into the buffer,
+// so a file may change or go away once it has been read.
+//
+// The cache is shared by all threads and interpreters in the process.
+//
+// Written: cmp
+//
+#ifndef SeriesData_h
+#define SeriesData_h
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class Vector;
+
+namespace OpenSees {
+
+class SeriesData
+{
+  public:
+    typedef std::shared_ptr<const SeriesData> Handle;
+
+    // the numbers in a file; null if it could not be read
+    static Handle read(const char *fileName, bool binary = false);
+
+    // a buffer holding values[0], ..., values[n-1]
+    static Handle share(const double *values, std::size_t n);
+    static Handle share(const Vector &values);
+
+    ~SeriesData();
+
+    const double *data(void) const {return begin;}
+    int size(void) const {return numValues;}
+
+    // a Vector viewing the buffer; it must not be modified, and must not
+    // outlive the handle it was made from
+    Vector *view(void) const;
+
+  private:
+    SeriesData();
+    SeriesData(const SeriesData &) = delete;
+    SeriesData &operator=(const SeriesData &) = delete;
+
+    std::vector<double> values;
+    const double *begin;
+    int           numValues;
+};
+
+} // namespace OpenSees
+
+#endif
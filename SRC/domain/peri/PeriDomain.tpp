@@ -1,4 +1,8 @@
 #include <cmath>
+#include <algorithm>
+#include <OPS_Globals.h>
+#include <PeriNeighborGrid.h>
+#include <threads/global_pool.hpp>
 
 
 template <int ndim>
@@ -40,24 +44,59 @@ template <int ndim>
 void PeriDomain<ndim>::create_fam(const double delta_in) {
     // Set the size of horizon delta
     this->delta = delta_in;
-    // Create families for each particle
-    for (int i = 0; i < totnode; i++) {
-        for (int j = i+1; j < totnode; j++) {
-            // Calculate the distance between the particles
-            double dist = 0.0;
-            for (int k = 0; k < ndim; k++) {
-                dist += (pts[j].coord[k] - pts[i].coord[k]) * (pts[j].coord[k] - pts[i].coord[k]);
-            }
-            dist = std::sqrt(dist);
-            // If the distance is less than delta, add the particle to the family
-            if (dist < delta_in && dist > 1.0e-8*delta_in) {
+
+    // Bin the particles into cells at least as wide as the horizon,
+    // so only the particles in the surrounding cells are candidates
+    PeriNeighborGrid<ndim> grid(pts, delta_in);
+
+    // Create the family of particles [first, last); each particle only
+    // writes to its own family, so blocks can run concurrently
+    auto create = [&](int first, int last) -> int {
+        int overflow = 0;
+        std::vector<int> fam;
+        for (int i = first; i < last; i++) {
+            fam.clear();
+            grid.for_each_near(pts[i].coord, [&](int j) {
+                if (j == i)
+                    return;
+                // Calculate the distance between the particles
+                double dist = 0.0;
+                for (int k = 0; k < ndim; k++) {
+                    dist += (pts[j].coord[k] - pts[i].coord[k]) * (pts[j].coord[k] - pts[i].coord[k]);
+                }
+                dist = std::sqrt(dist);
+                // If the distance is less than delta, add the particle to the family
+                if (dist < delta_in && dist > 1.0e-8*delta_in)
+                    fam.push_back(j);
+            });
+            // Keep the families in ascending order of particle, which is
+            // the order a search over all pairs would produce
+            std::sort(fam.begin(), fam.end());
+            for (int j : fam) {
+                if (pts[i].numfam >= maxfam) {
+                    overflow++;
+                    break;
+                }
                 pts[i].nodefam[pts[i].numfam] = j;
                 pts[i].numfam++;
-                pts[j].nodefam[pts[j].numfam] = i;
-                pts[j].numfam++;
             }
         }
-    }
+        return overflow;
+    };
+
+    int overflow = 0;
+    OpenSees::thread_pool &pool = OpenSees::global_thread_pool();
+    if (pool.get_thread_count() > 1 && !OpenSees::in_thread_pool() && totnode > 1) {
+        OpenSees::multi_future<int> blocks = pool.submit_blocks<int>(0, totnode, create,
+                                                                      4*pool.get_thread_count());
+        for (int n : blocks.get())
+            overflow += n;
+    } else
+        overflow = create(0, totnode);
+
+    if (overflow > 0)
+        opserr << "WARNING PeriDomain::create_fam - " << overflow
+               << " particles have more than maxfam = " << maxfam << " neighbors\n";
 }
 
 template <int ndim>
@@ -112,8 +151,7 @@ void PeriDomain<ndim>::calc_vols(double space_in) {
 template <int ndim>
 void PeriDomain<ndim>::calc_surf_correction(){
 
-    int j;
-    double vol_h_max = 0.0, tmp_corr = 1.0;
+    double vol_h_max = 0.0;
 
     for (int i = 0; i < totnode; i++) {
         if (pts[i].vol_h > vol_h_max) {
@@ -121,25 +159,26 @@ void PeriDomain<ndim>::calc_surf_correction(){
         }
     }
 
-    for (int i = 0; i < totnode; i++) {
-        for (int ind = 0; ind < pts[i].numfam; ind++) {
-            j = pts[i].nodefam[ind];
-            if (i < j) {
+    // The correction of a bond depends only on the horizon volumes of
+    // its two particles, so each particle can correct its side of
+    // every bond without searching the family of the other particle
+    auto correct = [&](int first, int last) {
+        for (int i = first; i < last; i++) {
+            for (int ind = 0; ind < pts[i].numfam; ind++) {
+                const int j = pts[i].nodefam[ind];
                 // set stiffness correction factor for this bond
-                tmp_corr = 2.0 * vol_h_max / (pts[i].vol_h + pts[j].vol_h);
+                const double tmp_corr = 2.0 * vol_h_max / (pts[i].vol_h + pts[j].vol_h);
                 pts[i].correction[ind] *= tmp_corr;
-                // also set for j, since it is symmetric
-                for (int ind2 = 0; ind2 < pts[j].numfam; ind2++) {
-                    if (pts[j].nodefam[ind2] == i) {
-                        pts[j].correction[ind2] *= tmp_corr;
-                        break;
-                    }
-                }
             }
         }
-    }
-}
+    };
 
+    OpenSees::thread_pool &pool = OpenSees::global_thread_pool();
+    if (pool.get_thread_count() > 1 && !OpenSees::in_thread_pool() && totnode > 1)
+        pool.submit_blocks<int>(0, totnode, correct, 4*pool.get_thread_count()).wait();
+    else
+        correct(0, totnode);
+}
 
 template <int ndim>
 void PeriDomain<ndim>::break_bond(const int node1, const int node2) {
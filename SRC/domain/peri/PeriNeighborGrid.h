@@ -0,0 +1,132 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <PeriParticle.h>
+
+// ============================================
+// A uniform cell list over the particles of a
+// PeriDomain. The cells are at least as wide as
+// the horizon, so every particle within the
+// horizon of a point lies in the cell of that
+// point or in one of the cells around it.
+// --------------------------------------------
+// The particles of each cell are stored in
+// ascending order of their index, one cell after
+// another (the same layout as a compressed
+// sparse row matrix).
+// ============================================
+template <int ndim>
+class PeriNeighborGrid
+{
+public:
+    PeriNeighborGrid(const std::vector<PeriParticle<ndim>> &pts, double delta);
+
+    // Call f(j) for every particle j in the cells around x
+    template <class F>
+    void for_each_near(const VectorND<ndim> &x, F &&f) const;
+
+private:
+    int cell_of(int k, double x) const;
+
+    double lo[ndim];    // lower corner of the grid
+    int    ncell[ndim]; // number of cells in each direction
+    double width = 0.0; // width of a cell
+    std::vector<int> start, index;
+};
+
+
+template <int ndim>
+PeriNeighborGrid<ndim>::PeriNeighborGrid(const std::vector<PeriParticle<ndim>> &pts, double delta)
+{
+    const int totnode = static_cast<int>(pts.size());
+
+    double hi[ndim];
+    for (int k = 0; k < ndim; k++) {
+        lo[k] = totnode > 0 ? pts[0].coord[k] : 0.0;
+        hi[k] = lo[k];
+    }
+    for (const PeriParticle<ndim> &node : pts)
+        for (int k = 0; k < ndim; k++) {
+            lo[k] = std::min(lo[k], node.coord[k]);
+            hi[k] = std::max(hi[k], node.coord[k]);
+        }
+
+    // pad the cell so that round-off in locating a particle can
+    // never put two particles within the horizon two cells apart;
+    // widen it further if a sparse model would need far more cells
+    // than particles
+    width = delta > 0.0 ? delta*(1.0 + 1.0e-8) : 1.0;
+    while (true) {
+        double total = 1.0;
+        for (int k = 0; k < ndim; k++)
+            total *= std::floor((hi[k] - lo[k])/width) + 1.0;
+        if (total <= 4.0*totnode + 64.0)
+            break;
+        width *= 2.0;
+    }
+
+    int numCells = 1;
+    for (int k = 0; k < ndim; k++) {
+        ncell[k] = static_cast<int>(std::floor((hi[k] - lo[k])/width)) + 1;
+        numCells *= ncell[k];
+    }
+
+    // counting sort of the particles by cell
+    std::vector<int> cell(totnode);
+    start.assign(numCells + 1, 0);
+    for (int i = 0; i < totnode; i++) {
+        int c = 0;
+        for (int k = ndim-1; k >= 0; k--)
+            c = c*ncell[k] + cell_of(k, pts[i].coord[k]);
+        cell[i] = c;
+        start[c+1]++;
+    }
+    for (int c = 0; c < numCells; c++)
+        start[c+1] += start[c];
+
+    index.resize(totnode);
+    std::vector<int> next(start.begin(), start.end() - 1);
+    for (int i = 0; i < totnode; i++)
+        index[next[cell[i]]++] = i;
+}
+
+template <int ndim>
+int PeriNeighborGrid<ndim>::cell_of(int k, double x) const
+{
+    int c = static_cast<int>(std::floor((x - lo[k])/width));
+    return std::min(std::max(c, 0), ncell[k]-1);
+}
+
+template <int ndim>
+template <class F>
+void PeriNeighborGrid<ndim>::for_each_near(const VectorND<ndim> &x, F &&f) const
+{
+    int center[ndim];
+    for (int k = 0; k < ndim; k++)
+        center[k] = cell_of(k, x[k]);
+
+    // visit the 3^ndim cells around the center
+    int numAround = 1;
+    for (int k = 0; k < ndim; k++)
+        numAround *= 3;
+
+    for (int m = 0; m < numAround; m++) {
+        int c = 0, digits = m;
+        bool inside = true;
+        int offset[ndim];
+        for (int k = 0; k < ndim; k++) {
+            offset[k] = center[k] + digits%3 - 1;
+            digits /= 3;
+            if (offset[k] < 0 || offset[k] >= ncell[k])
+                inside = false;
+        }
+        if (!inside)
+            continue;
+        for (int k = ndim-1; k >= 0; k--)
+            c = c*ncell[k] + offset[k];
+
+        for (int p = start[c]; p < start[c+1]; p++)
+            f(index[p]);
+    }
+}
@@ -323,47 +323,75 @@ Tcl_PeriPrintFam(PeriDomain<ndim> *domain, Tcl_Interp *interp,
 {
     int ind = 0, argi = 3;
 
-    if (argc == 3)
+    // With -ret, return the families as a list with one list of
+    // neighbors for each particle instead of printing them
+    bool ret = false;
+    if (argc > argi && strcmp(argv[argi], "-ret") == 0)
     {
-        // print the number of families and their indices of all the particles
-        for (int i = 0; i < domain->totnode; i++)
+        ret = true;
+        argi++;
+    }
+
+    Tcl_Obj *result = Tcl_NewListObj(0, nullptr);
+    auto report = [&](int i) {
+        if (ret)
         {
-            printf("Node %d: %d neighbors\n", i, domain->pts[i].numfam);
+            Tcl_Obj *fam = Tcl_NewListObj(0, nullptr);
             for (int j = 0; j < domain->pts[i].numfam; j++)
-            {
-                printf("%d ", domain->pts[i].nodefam[j]);
-            }
-            printf("\n");
+                Tcl_ListObjAppendElement(interp, fam, Tcl_NewIntObj(domain->pts[i].nodefam[j]));
+            Tcl_ListObjAppendElement(interp, result, fam);
+            return;
         }
+        printf("Node %d: %d neighbors\n", i, domain->pts[i].numfam);
+        for (int j = 0; j < domain->pts[i].numfam; j++)
+        {
+            printf("%d ", domain->pts[i].nodefam[j]);
+        }
+        printf("\n");
+    };
+
+    if (argc == argi)
+    {
+        // print the number of families and their indices of all the particles
+        for (int i = 0; i < domain->totnode; i++)
+            report(i);
     }
     else if (argc > argi)
     {
         // Parse arguments and set the coordinates of a particle
         // Note that argv[0] == "peri", argv[1] == "prin", argv[2] == "fam"
-        // Therefore, the first argument is argv[3]
+        // Therefore, the first argument is argv[3] (argv[4] after -ret)
         for (int i = argi; i < argc; i++)
         {
-            // If this returns TCL_ERROR it means that argv[3] couldnt be
+            // If this returns TCL_ERROR it means that argv[i] couldnt be
             // parsed as an integer.
             if (Tcl_GetInt(interp, argv[i], &ind) == TCL_ERROR)
             {
-                printf("ERROR in peri prin fam: Couldnt parse argv[3] as the index\n");
+                printf("ERROR in peri prin fam: Couldnt parse argv[%d] as the index\n", i);
+                Tcl_DecrRefCount(result);
                 return TCL_ERROR;
             }
-            // Print the families of the particle at index i
-            printf("Node %d: %d neighbors\n", ind, domain->pts[ind].numfam);
-            for (int j = 0; j < domain->pts[ind].numfam; j++)
+            if (ind < 0 || ind >= domain->totnode)
             {
-                printf("%d ", domain->pts[ind].nodefam[j]);
+                printf("ERROR in peri prin fam: index %d is out of range\n", ind);
+                Tcl_DecrRefCount(result);
+                return TCL_ERROR;
             }
-            printf("\n");
+            // Print the families of the particle at index i
+            report(ind);
         }
     }
     else
     {
         printf("ERROR in peri prin fam: Not enough arguments\n");
+        Tcl_DecrRefCount(result);
         return -1; // **QUESTION: Is this the correct return value?**
     }
+
+    if (ret)
+        Tcl_SetObjResult(interp, result);
+    else
+        Tcl_DecrRefCount(result);
     return TCL_OK;
 }
 
@@ -116,17 +116,17 @@ void * OPS_ADD_RUNTIME_VPV(OPS_BBarBrickUP)
 #endif
 
 //static data
-double  BBarBrickUP::xl[4][8] ;
-double  BBarBrickUP::Shape[4][8][8];
-double  BBarBrickUP::shpBar[3][8];
-double  BBarBrickUP::BBar[6][3][8][8];
-double  BBarBrickUP::BBarp[3][8][8];
-double  BBarBrickUP::dvol[8];
-
-Matrix  BBarBrickUP::stiff(32,32) ;
-Vector  BBarBrickUP::resid(32) ;
-Matrix  BBarBrickUP::mass(32,32) ;
-Matrix  BBarBrickUP::damp(32,32) ;
+thread_local double  BBarBrickUP::xl[4][8] ;
+thread_local double  BBarBrickUP::Shape[4][8][8];
+thread_local double  BBarBrickUP::shpBar[3][8];
+thread_local double  BBarBrickUP::BBar[6][3][8][8];
+thread_local double  BBarBrickUP::BBarp[3][8][8];
+thread_local double  BBarBrickUP::dvol[8];
+
+thread_local Matrix  BBarBrickUP::stiff(32,32) ;
+thread_local Vector  BBarBrickUP::resid(32) ;
+thread_local Matrix  BBarBrickUP::mass(32,32) ;
+thread_local Matrix  BBarBrickUP::damp(32,32) ;
 
 //quadrature data
 const double  BBarBrickUP::root3 = sqrt(3.0) ;
@@ -350,8 +350,8 @@ void  BBarBrickUP::Print( OPS_Stream &s, int flag )
     // spit out the section location & invoke print on the scetion
     const int numMaterials = 8;
 
-    static Vector avgStress(7);
-    static Vector avgStrain(nstress);
+    static thread_local Vector avgStress(7);
+    static thread_local Vector avgStrain(nstress);
     avgStress.Zero();
     avgStrain.Zero();
     for (i=0; i<numMaterials; i++) {
@@ -434,17 +434,17 @@ const Matrix&  BBarBrickUP::getInitialStiff( )
   int jj, kk ;
 
   static double xsj ;  // determinant jacaobian matrix
-  static double gaussPoint[ndm] ;
-  static Vector strain(nstress) ;  //strain
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
-  static Matrix dd(nstress,nstress) ;  //material tangent
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local Vector strain(nstress) ;  //strain
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
   //---------B-matrices------------------------------------
-  static Matrix BJ(nstress,ndf) ;      // B matrix node J
-  static Matrix BJtran(ndf,nstress) ;
-  static Matrix BK(nstress,ndf) ;      // B matrix node k
-  static Matrix BJtranD(ndf,nstress) ;
+  static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
+  static thread_local Matrix BJtran(ndf,nstress) ;
+  static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
+  static thread_local Matrix BJtranD(ndf,nstress) ;
 
 
   //zero stiffness and residual
@@ -565,9 +565,9 @@ void BBarBrickUP::formDampingTerms( int tangFlag )
   static const int numberDOFs = 32 ;
   static const int nShape = 4 ;
   static double xsj ;  // determinant jacaobian matrix
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double gaussPoint[ndm] ;
-  static Vector a(ndff*numberNodes) ;
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local Vector a(ndff*numberNodes) ;
 
   int i, j, k, p, q, m, i1, j1;
 
@@ -767,7 +767,7 @@ const Vector&  BBarBrickUP::getResistingForce( )
 //get residual with inertia terms
 const Vector&  BBarBrickUP::getResistingForceIncInertia( )
 {
-  static Vector res(32);
+  static thread_local Vector res(32);
 
   int tang_flag = 0 ; //don't get the tangent
 
@@ -800,9 +800,9 @@ void   BBarBrickUP::formInertiaTerms( int tangFlag )
   static const int nShape = 4 ;
   static const int massIndex = nShape - 1 ;
   static double xsj ;  // determinant jacaobian matrix
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double gaussPoint[ndm] ;
-  static Vector a(ndff*numberNodes) ;
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local Vector a(ndff*numberNodes) ;
 
   int i, j, k, p, q ;
   int jj, kk ;
@@ -916,20 +916,20 @@ void  BBarBrickUP::formResidAndTangent( int tang_flag )
   int success ;
 
   static double xsj ;  // determinant jacaobian matrix
-  static double gaussPoint[ndm] ;
-  static Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static Vector residJ(ndf) ; //nodeJ residual
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
-  static Vector stress(nstress) ;  //stress
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local Vector strain(nstress) ;  //strain
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local Vector residJ(ndf) ; //nodeJ residual
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local Vector stress(nstress) ;  //stress
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-    static Matrix BJtran(ndf,nstress) ;
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BJtranD(ndf,nstress) ;
   //-------------------------------------------------------
 
 
@@ -1215,7 +1215,7 @@ const Matrix&
 BBarBrickUP::computeB( int node, int Gauss )
 {
 
-  static Matrix B(6,3) ;
+  static thread_local Matrix B(6,3) ;
 
   int i, j;
 
@@ -1262,7 +1262,7 @@ int  BBarBrickUP::sendSelf (int commitTag, Channel &theChannel)
 
   // BBarBrickUP packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(13);
+  static thread_local Vector data(13);
   data(0) = this->getTag();
   data(1) = rho;
   data(2) = b[0];
@@ -1288,7 +1288,7 @@ int  BBarBrickUP::sendSelf (int commitTag, Channel &theChannel)
   // Now BBarBrickUP sends the ids of its materials
   int matDbTag;
 
-  static ID idData(24);
+  static thread_local ID idData(24);
 
   int i;
   for (i = 0; i < 8; i++) {
@@ -1343,7 +1343,7 @@ int  BBarBrickUP::recvSelf (int commitTag,
 
   // BBarBrickUP creates a Vector, receives the Vector and then sets the
   // internal data with the data in the Vector
-  static Vector data(13);
+  static thread_local Vector data(13);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING FourNodeQuadUP::recvSelf() - failed to receive Vector\n";
@@ -1366,7 +1366,7 @@ int  BBarBrickUP::recvSelf (int commitTag,
   perm[1] = data(11);
   perm[2] = data(12);
 
-  static ID idData(24);
+  static thread_local ID idData(24);
   // BBarBrickUP now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1445,14 +1445,14 @@ int
 BBarBrickUP::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
     // get vertex display coordinate vectors
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
-    static Vector v4(3);
-    static Vector v5(3);
-    static Vector v6(3);
-    static Vector v7(3);
-    static Vector v8(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
+    static thread_local Vector v4(3);
+    static thread_local Vector v5(3);
+    static thread_local Vector v6(3);
+    static thread_local Vector v7(3);
+    static thread_local Vector v8(3);
     nodePointers[0]->getDisplayCrds(v1, fact, displayMode);
     nodePointers[1]->getDisplayCrds(v2, fact, displayMode);
     nodePointers[2]->getDisplayCrds(v3, fact, displayMode);
@@ -1463,7 +1463,7 @@ BBarBrickUP::displaySelf(Renderer &theViewer, int displayMode, float fact, const
     nodePointers[7]->getDisplayCrds(v8, fact, displayMode);
 
     // add to coord matrix
-    static Matrix coords(8, 3);
+    static thread_local Matrix coords(8, 3);
     for (int i = 0; i < 3; i++) {
         coords(0, i) = v1(i);
         coords(1, i) = v2(i);
@@ -1476,7 +1476,7 @@ BBarBrickUP::displaySelf(Renderer &theViewer, int displayMode, float fact, const
     }
 
     // create color vector
-    static Vector values(8);
+    static thread_local Vector values(8);
     if (displayMode < 3 && displayMode > 0) {
         // get stress vectors
         const Vector& stress1 = materialPointers[0]->getStress();
@@ -1591,7 +1591,7 @@ BBarBrickUP::setResponse(const char **argv, int argc, OPS_Stream &output)
 int
 BBarBrickUP::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector stresses(48);
+  static thread_local Vector stresses(48);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -144,10 +144,10 @@ class BBarBrickUP : public Element {
     //static data
 
 
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damp ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damp ;
 
     //quadrature data
     static const double root3 ;
@@ -165,7 +165,7 @@ class BBarBrickUP : public Element {
     NDMaterial *materialPointers[8] ; //pointers to eight materials
 
     //local nodal coordinates, three coordinates for each of 8 nodes
-    static double xl[4][8] ;
+    static thread_local double xl[4][8] ;
     double b[3];		// Body forces
 
 	double appliedB[3]; // Body forces applied by load pattern, C.McGann, U.Washington
@@ -176,18 +176,18 @@ class BBarBrickUP : public Element {
     double perm[3];  // permeability
 
     // [0,1,2=derivative wrt x,y,z;3=shape func][node][Gauss point]
-    static double Shape[4][8][8]; // Stores shape functions and derivatives (overwritten)
+    static thread_local double Shape[4][8][8]; // Stores shape functions and derivatives (overwritten)
 
     // [x,y,z][node]
-    static double shpBar[3][8]; // Stores averaged shap functions (overwritten)
+    static thread_local double shpBar[3][8]; // Stores averaged shap functions (overwritten)
 
     // [row][col][node][Gauss point]
-    static double BBar[6][3][8][8];  // Stores strain-displacement matrix (overwritten)
+    static thread_local double BBar[6][3][8][8];  // Stores strain-displacement matrix (overwritten)
 
     // [col][node][Gauss point]  Note: there is only one row in Bp matrix
-    static double BBarp[3][8][8]; // Stores strain-displacement matrix for fluid phase (overwritten)
+    static thread_local double BBarp[3][8][8]; // Stores strain-displacement matrix for fluid phase (overwritten)
 
-    static double dvol[8];  // Stores detJacobian (overwritten)
+    static thread_local double dvol[8];  // Stores detJacobian (overwritten)
 
     //inertia terms
     void formInertiaTerms( int tangFlag ) ;
@@ -83,11 +83,11 @@ void * OPS_ADD_RUNTIME_VPV(OPS_BbarBrick)
 #endif
 
 //static data
-double  BbarBrick::xl[3][8] ;
+thread_local double  BbarBrick::xl[3][8] ;
 
-Matrix  BbarBrick::stiff(24,24) ;
-Vector  BbarBrick::resid(24) ;
-Matrix  BbarBrick::mass(24,24) ;
+thread_local Matrix  BbarBrick::stiff(24,24) ;
+thread_local Vector  BbarBrick::resid(24) ;
+thread_local Matrix  BbarBrick::mass(24,24) ;
 
 
 //quadrature data
@@ -327,32 +327,32 @@ const Matrix&  BbarBrick::getInitialStiff( )
 
   static double xsj ;  // determinant jacaobian matrix
 
-  static double dvol[numberGauss] ; //volume element
+  static thread_local double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static Vector strain(nstress) ;  //strain
+  static thread_local Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+  static thread_local double shpBar[nShape][numberNodes] ;  //mean value of shape functions
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -586,7 +586,7 @@ const Vector&  BbarBrick::getResistingForce( )
 //get residual with inertia terms
 const Vector&  BbarBrick::getResistingForceIncInertia( )
 {
-  static Vector res(24);
+  static thread_local Vector res(24);
 
   int tang_flag = 0 ; //don't get the tangent
 
@@ -626,13 +626,13 @@ BbarBrick::formInertiaTerms( int tangFlag )
 
   double dvol[numberGauss] ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static Vector momentum(ndf) ;
+  static thread_local Vector momentum(ndf) ;
 
   double temp, rho, massJK ;
 
@@ -764,35 +764,35 @@ void  BbarBrick::formResidAndTangent( int tang_flag )
 
   static double xsj ;  // determinant jacaobian matrix
 
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
+  static thread_local double dvol[numberGauss] ; //volume element
+  static thread_local double gaussPoint[ndm] ;
 
-  static Vector strain(nstress) ;  //strain
+  static thread_local Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+  static thread_local double shpBar[nShape][numberNodes] ;  //mean value of shape functions
 
-  static Vector residJ(ndf) ; //nodeJ residual
+  static thread_local Vector residJ(ndf) ; //nodeJ residual
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
 
-  static Vector stress(nstress) ;  //stress
+  static thread_local Vector stress(nstress) ;  //stress
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -1000,9 +1000,9 @@ BbarBrick::computeBbar( int node,
                            const double shpBar[4][8] )
 {
 
-  static Matrix Bbar(6,3) ;
-  static double Bdev[3][3] ;
-  static double BbarVol[3][3] ;
+  static thread_local Matrix Bbar(6,3) ;
+  static thread_local double Bdev[3][3] ;
+  static thread_local double BbarVol[3][3] ;
   static const double one3 = 1.0/3.0 ;
 
 
@@ -1103,7 +1103,7 @@ int  BbarBrick::sendSelf (int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(25);
+  static thread_local ID idData(25);
 
   idData(24) = this->getTag();
 
@@ -1142,7 +1142,7 @@ int  BbarBrick::sendSelf (int commitTag, Channel &theChannel)
   }
 
   // send damping coefficients & body forces
-  static Vector dData(7);
+  static thread_local Vector dData(7);
   dData(0) = alphaM;
   dData(1) = betaK;
   dData(2) = betaK0;
@@ -1176,7 +1176,7 @@ int  BbarBrick::recvSelf (int commitTag,
 
   int dataTag = this->getDbTag();
 
-  static ID idData(25);
+  static thread_local ID idData(25);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1187,7 +1187,7 @@ int  BbarBrick::recvSelf (int commitTag,
   this->setTag(idData(24));
 
   // recv damping & body forces coefficients
-  static Vector dData(7);
+  static thread_local Vector dData(7);
   if (theChannel.recvVector(dataTag, commitTag, dData) < 0) {
     opserr << "DispBeamColumn2d::sendSelf() - failed to recv double data\n";
     return -1;
@@ -1356,7 +1356,7 @@ BbarBrick::setResponse(const char **argv, int argc, OPS_Stream &output)
 int
 BbarBrick::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector stresses(48);
+  static thread_local Vector stresses(48);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -49,11 +49,11 @@
 #include <FEM_ObjectBroker.h>
 
 //static data
-double  BbarBrickWithSensitivity::xl[3][8] ;
+thread_local double  BbarBrickWithSensitivity::xl[3][8] ;
 
-Matrix  BbarBrickWithSensitivity::stiff(24,24) ;
-Vector  BbarBrickWithSensitivity::resid(24) ;
-Matrix  BbarBrickWithSensitivity::mass(24,24) ;
+thread_local Matrix  BbarBrickWithSensitivity::stiff(24,24) ;
+thread_local Vector  BbarBrickWithSensitivity::resid(24) ;
+thread_local Matrix  BbarBrickWithSensitivity::mass(24,24) ;
 
 
 //quadrature data
@@ -356,32 +356,32 @@ const Matrix&  BbarBrickWithSensitivity::getInitialStiff( )
 
   static double xsj ;  // determinant jacaobian matrix
 
-  static double dvol[numberGauss] ; //volume element
+  static thread_local double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static Vector strain(nstress) ;  //strain
+  static thread_local Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+  static thread_local double shpBar[nShape][numberNodes] ;  //mean value of shape functions
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -617,7 +617,7 @@ const Vector&  BbarBrickWithSensitivity::getResistingForce( )
 //get residual with inertia terms
 const Vector&  BbarBrickWithSensitivity::getResistingForceIncInertia( )
 {
-  static Vector res(24);
+  static thread_local Vector res(24);
 
   int tang_flag = 0 ; //don't get the tangent
 
@@ -661,13 +661,13 @@ void   BbarBrickWithSensitivity::formInertiaTerms( int tangFlag )
 
   double dvol[numberGauss] ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static Vector momentum(ndf) ;
+  static thread_local Vector momentum(ndf) ;
 
   int i, j, k, p, q ;
   int jj, kk ;
@@ -812,36 +812,36 @@ if (tang_flag ==0) {// stress only
 
   static double xsj ;  // determinant jacaobian matrix
 
-  static double dvol[numberGauss] ; //volume element
+  static thread_local double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static Vector strain(nstress) ;  //strain
+  static thread_local Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+  static thread_local double shpBar[nShape][numberNodes] ;  //mean value of shape functions
 
-  static Vector residJ(ndf) ; //nodeJ residual
+  static thread_local Vector residJ(ndf) ; //nodeJ residual
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
 
-  static Vector stress(nstress) ;  //stress
+  static thread_local Vector stress(nstress) ;  //stress
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -1021,36 +1021,36 @@ if (tang_flag ==0) {// stress only
 
   static double xsj ;  // determinant jacaobian matrix
 
-  static double dvol[numberGauss] ; //volume element
+  static thread_local double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
 //Quan	  static Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+  static thread_local double shpBar[nShape][numberNodes] ;  //mean value of shape functions
 
 //Quan	  static Vector residJ(ndf) ; //nodeJ residual
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
 
 //Quan	  static Vector stress(nstress) ;  //stress
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-	static Matrix BJ(nstress,ndf) ;      // B matrix node J
+	static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-	static Matrix BJtran(ndf,nstress) ;
+	static thread_local Matrix BJtran(ndf,nstress) ;
 
-	static Matrix BK(nstress,ndf) ;      // B matrix node k
+	static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-	static Matrix BJtranD(ndf,nstress) ;
+	static thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -1258,13 +1258,13 @@ BbarBrickWithSensitivity::computeBbar( int node,
 				 const double shpBar[4][8] )
 {
 
-  static Matrix Bbar(6,3) ;
+  static thread_local Matrix Bbar(6,3) ;
 
   //static Matrix Bdev(3,3) ;
-  static double Bdev[3][3] ;
+  static thread_local double Bdev[3][3] ;
 
   //static Matrix BbarVol(3,3) ;
-  static double BbarVol[3][3] ;
+  static thread_local double BbarVol[3][3] ;
 
   static const double one3 = 1.0/3.0 ;
 
@@ -1388,7 +1388,7 @@ int  BbarBrickWithSensitivity::sendSelf (int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(25);
+  static thread_local ID idData(25);
 
   idData(24) = this->getTag();
 
@@ -1442,7 +1442,7 @@ int  BbarBrickWithSensitivity::recvSelf (int commitTag,
 
   int dataTag = this->getDbTag();
 
-  static ID idData(25);
+  static thread_local ID idData(25);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1519,17 +1519,17 @@ int
 BbarBrickWithSensitivity::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
 	// vertex display coordinate vectors
-	static Vector v1(3);
-	static Vector v2(3);
-	static Vector v3(3);
-	static Vector v4(3);
-	static Vector v5(3);
-	static Vector v6(3);
-	static Vector v7(3);
-	static Vector v8(3);
-	static Matrix coords(8, 3); // polygon coordinate matrix
-	static Vector values(8); // color vector
-	static Vector P(24);
+	static thread_local Vector v1(3);
+	static thread_local Vector v2(3);
+	static thread_local Vector v3(3);
+	static thread_local Vector v4(3);
+	static thread_local Vector v5(3);
+	static thread_local Vector v6(3);
+	static thread_local Vector v7(3);
+	static thread_local Vector v8(3);
+	static thread_local Matrix coords(8, 3); // polygon coordinate matrix
+	static thread_local Vector values(8); // color vector
+	static thread_local Vector P(24);
 	int i;
 
 	// get display coords
@@ -1642,7 +1642,7 @@ BbarBrickWithSensitivity::setResponse(const char **argv, int argc, OPS_Stream &o
 int
 BbarBrickWithSensitivity::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector stresses(48);
+  static thread_local Vector stresses(48);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -1810,36 +1810,36 @@ BbarBrickWithSensitivity::getResistingForceSensitivity(int gradNumber)
 
 	  static double xsj ;  // determinant jacaobian matrix
 
-	  static double dvol[numberGauss] ; //volume element
+	  static thread_local double dvol[numberGauss] ; //volume element
 
-	  static double gaussPoint[ndm] ;
+	  static thread_local double gaussPoint[ndm] ;
 
 //	  static Vector strain(nstress) ;  //strain
 
-	  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+	  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-	  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+	  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-	  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+	  static thread_local double shpBar[nShape][numberNodes] ;  //mean value of shape functions
 
-	  static Vector residJ(ndf) ; //nodeJ residual
+	  static thread_local Vector residJ(ndf) ; //nodeJ residual
 
-	  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+	  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
 
-	  static Vector stress(nstress) ;  //stress
+	  static thread_local Vector stress(nstress) ;  //stress
 
-	  static Matrix dd(nstress,nstress) ;  //material tangent
+	  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
 	  //---------B-matrices------------------------------------
 
-		static Matrix BJ(nstress,ndf) ;      // B matrix node J
+		static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-		static Matrix BJtran(ndf,nstress) ;
+		static thread_local Matrix BJtran(ndf,nstress) ;
 
-		static Matrix BK(nstress,ndf) ;      // B matrix node k
+		static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-		static Matrix BJtranD(ndf,nstress) ;
+		static thread_local Matrix BJtranD(ndf,nstress) ;
 
 	  //-------------------------------------------------------
 
@@ -1981,7 +1981,7 @@ BbarBrickWithSensitivity::commitSensitivity(int gradNumber, int numGrads)
 	const Vector &disp3 = theNodes[2]->getDispSensitivity(gradNumber);
 	const Vector &disp4 = theNodes[3]->getDispSensitivity(gradNumber);
 
-  static double u[2][4];
+  static thread_local double u[2][4];
 
 	u[0][0] = disp1(0);
 	u[1][0] = disp1(1);
@@ -2035,7 +2035,7 @@ BbarBrickWithSensitivity::commitSensitivity(int gradNumber, int numGrads)
 
 	   double gaussPoint[ndm] ;
 
-	  static Vector strain(nstress) ;  //strain
+	  static thread_local Vector strain(nstress) ;  //strain
 
 	   double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
@@ -2045,22 +2045,22 @@ BbarBrickWithSensitivity::commitSensitivity(int gradNumber, int numGrads)
 
 //Quan	  static Vector residJ(ndf) ; //nodeJ residual
 
-	  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+	  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
 
 //Quan	  static Vector stress(nstress) ;  //stress
 
-	  static Matrix dd(nstress,nstress) ;  //material tangent
+	  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
 	  //---------B-matrices------------------------------------
 
-		static Matrix BJ(nstress,ndf) ;      // B matrix node J
+		static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-		static Matrix BJtran(ndf,nstress) ;
+		static thread_local Matrix BJtran(ndf,nstress) ;
 
-		static Matrix BK(nstress,ndf) ;      // B matrix node k
+		static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-		static Matrix BJtranD(ndf,nstress) ;
+		static thread_local Matrix BJtranD(ndf,nstress) ;
 
 	  //-------------------------------------------------------
 
@@ -2139,7 +2139,7 @@ BbarBrickWithSensitivity::commitSensitivity(int gradNumber, int numGrads)
 		//zero the strains
 		strain.Zero( ) ;
 
-		static Vector ul(3);
+		static thread_local Vector ul(3);
 	// j-node loop to compute strain
 		for ( j = 0; j < numberNodes; j++ )  {
 
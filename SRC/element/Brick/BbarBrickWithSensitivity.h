@@ -128,10 +128,10 @@ class BbarBrickWithSensitivity : public Element {
   private :
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damping ;
 
     //quadrature data
     static const double root3 ;
@@ -150,7 +150,7 @@ class BbarBrickWithSensitivity : public Element {
 
     //local nodal coordinates, three coordinates for each of four nodes
     //    static double xl[3][8] ;
-    static double xl[][8] ;
+    static thread_local double xl[][8] ;
 
 	double b[3];		    // Body forces
 
@@ -45,11 +45,11 @@
 
 
 //static data
-double  Brick::xl[3][8] ;
+thread_local double  Brick::xl[3][8] ;
 
-Matrix  Brick::stiff(24,24) ;
-Vector  Brick::resid(24) ;
-Matrix  Brick::mass(24,24) ;
+thread_local Matrix  Brick::stiff(24,24) ;
+thread_local Vector  Brick::resid(24) ;
+thread_local Matrix  Brick::mass(24,24) ;
 
     
 //quadrature data
@@ -63,7 +63,7 @@ const double  Brick::wg[] = { 1.0, 1.0, 1.0, 1.0,
                               1.0, 1.0, 1.0, 1.0  } ;
 
   
-static Matrix B(6,3) ;
+static thread_local Matrix B(6,3) ;
 
 //null constructor
 Brick::Brick( ) 
@@ -260,8 +260,8 @@ void  Brick::Print(OPS_Stream &s, int flag)
         // spit out the section location & invoke print on the scetion
         const int numMaterials = 8;
         
-        static Vector avgStress(nstress);
-        static Vector avgStrain(nstress);
+        static thread_local Vector avgStress(nstress);
+        static thread_local Vector avgStrain(nstress);
         avgStress.Zero();
         avgStrain.Zero();
         for (i = 0; i < numMaterials; i++) {
@@ -352,24 +352,24 @@ const Matrix&  Brick::getInitialStiff( )
   
   static double volume ;
   static double xsj ;  // determinant jacaobian matrix 
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
-  static Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local double dvol[numberGauss] ; //volume element
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local Vector strain(nstress) ;  //strain
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -586,7 +586,7 @@ const Vector&  Brick::getResistingForce( )
 //get residual with inertia terms
 const Vector&  Brick::getResistingForceIncInertia( )
 {
-  static Vector res(24);
+  static thread_local Vector res(24);
 
   int tang_flag = 0 ; //don't get the tangent
 
@@ -630,13 +630,13 @@ void   Brick::formInertiaTerms( int tangFlag )
 
   double dvol[numberGauss] ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static Vector momentum(ndf) ;
+  static thread_local Vector momentum(ndf) ;
 
   int i, j, k, p, q ;
   int jj, kk ;
@@ -773,22 +773,22 @@ Brick::update()
 
   static double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[numberGauss] ; //volume element
+  static thread_local double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static Vector strain(nstress) ;  //strain
+  static thread_local Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
   //---------B-matrices------------------------------------
 
-  static Matrix BJ(nstress,ndf) ;      // B matrix node J
-  static Matrix BJtran(ndf,nstress) ;
-  static Matrix BK(nstress,ndf) ;      // B matrix node k
-  static Matrix BJtranD(ndf,nstress) ;
+  static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
+  static thread_local Matrix BJtran(ndf,nstress) ;
+  static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
+  static thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -938,32 +938,32 @@ void  Brick::formResidAndTangent( int tang_flag )
 
   static double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[numberGauss] ; //volume element
+  static thread_local double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static Vector residJ(ndf) ; //nodeJ residual 
+  static thread_local Vector residJ(ndf) ; //nodeJ residual 
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
 
-  static Vector stress(nstress) ;  //stress
+  static thread_local Vector stress(nstress) ;  //stress
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -1227,7 +1227,7 @@ Brick::sendSelf (int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(26);
+  static thread_local ID idData(26);
 
   idData(24) = this->getTag();
   if (alphaM != 0 || betaK != 0 || betaK0 != 0 || betaKc != 0) 
@@ -1264,7 +1264,7 @@ Brick::sendSelf (int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector dData(7);
+  static thread_local Vector dData(7);
   dData(0) = alphaM;
   dData(1) = betaK;
   dData(2) = betaK0;
@@ -1299,7 +1299,7 @@ int  Brick::recvSelf (int commitTag,
   
   int dataTag = this->getDbTag();
 
-  static ID idData(26);
+  static thread_local ID idData(26);
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
     opserr << "WARNING Brick::recvSelf() - " << this->getTag() << " failed to receive ID\n";
@@ -1308,7 +1308,7 @@ int  Brick::recvSelf (int commitTag,
 
   this->setTag(idData(24));
 
-  static Vector dData(7);
+  static thread_local Vector dData(7);
   if (theChannel.recvVector(dataTag, commitTag, dData) < 0) {
     opserr << "DispBeamColumn2d::sendSelf() - failed to recv double data\n";
     return -1;
@@ -1477,7 +1477,7 @@ Brick::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 Brick::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector stresses(48);
+  static thread_local Vector stresses(48);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
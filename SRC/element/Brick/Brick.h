@@ -111,6 +111,7 @@ class Brick : public Element {
     
     //get residual with inertia terms
     const Vector &getResistingForceIncInertia( ) ;
+    bool hasOnlyRayleighDamping() const {return true;}
 
     // public methods for element output
     int sendSelf (int commitTag, Channel &theChannel);
@@ -146,10 +147,10 @@ class Brick : public Element {
     // static attributes
     //
 
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damping ;
 
     //quadrature data
     static const double root3 ;
@@ -158,7 +159,7 @@ class Brick : public Element {
     static const double wg[8] ;
   
     //local nodal coordinates, three coordinates for each of four nodes
-    static double xl[3][8] ; 
+    static thread_local double xl[3][8] ; 
 
     //
     // private methods
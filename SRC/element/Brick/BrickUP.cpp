@@ -117,12 +117,12 @@ void * OPS_ADD_RUNTIME_VPV(OPS_BrickUP)
 #endif
 
 //static data
-double  BrickUP::xl[4][8] ;
+thread_local double  BrickUP::xl[4][8] ;
 
-Matrix  BrickUP::stiff(32,32) ;
-Vector  BrickUP::resid(32) ;
-Matrix  BrickUP::mass(32,32) ;
-Matrix  BrickUP::damp(32,32) ;
+thread_local Matrix  BrickUP::stiff(32,32) ;
+thread_local Vector  BrickUP::resid(32) ;
+thread_local Matrix  BrickUP::mass(32,32) ;
+thread_local Matrix  BrickUP::damp(32,32) ;
 
 //quadrature data
 const double  BrickUP::root3 = sqrt(3.0) ;
@@ -346,8 +346,8 @@ void  BrickUP::Print( OPS_Stream &s, int flag )
     // spit out the section location & invoke print on the scetion
     const int numMaterials = 8;
 
-    static Vector avgStress(7);
-    static Vector avgStrain(nstress);
+    static thread_local Vector avgStress(7);
+    static thread_local Vector avgStrain(nstress);
     avgStress.Zero();
     avgStrain.Zero();
     for (i=0; i<numMaterials; i++) {
@@ -431,24 +431,24 @@ const Matrix&  BrickUP::getInitialStiff( )
 
   static double volume ;
   static double xsj ;  // determinant jacaobian matrix
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
-  static Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local double dvol[numberGauss] ; //volume element
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local Vector strain(nstress) ;  //strain
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -583,11 +583,11 @@ void BrickUP::formDampingTerms( int tangFlag )
   static const int nShape = 4 ;
   static double volume ;
   static double xsj ;  // determinant jacaobian matrix
-  static double dvol[numberGauss] ; //volume element
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static double gaussPoint[ndm] ;
-  static Vector a(ndff*numberNodes) ;
+  static thread_local double dvol[numberGauss] ; //volume element
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local Vector a(ndff*numberNodes) ;
 
   int i, j, k, p, q, m, i1, j1;
   //int jj, kk ;
@@ -794,7 +794,7 @@ const Vector&  BrickUP::getResistingForce( )
 //get residual with inertia terms
 const Vector&  BrickUP::getResistingForceIncInertia( )
 {
-  static Vector res(32);
+  static thread_local Vector res(32);
 
   int tang_flag = 0 ; //don't get the tangent
 
@@ -828,11 +828,11 @@ void   BrickUP::formInertiaTerms( int tangFlag )
   static const int massIndex = nShape - 1 ;
   static double volume ;
   static double xsj ;  // determinant jacaobian matrix
-  static double dvol[numberGauss] ; //volume element
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static double gaussPoint[ndm] ;
-  static Vector a(ndff*numberNodes) ;
+  static thread_local double dvol[numberGauss] ; //volume element
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local Vector a(ndff*numberNodes) ;
 
   int i, j, k, p, q ;
   int jj, kk ;
@@ -957,22 +957,22 @@ void  BrickUP::formResidAndTangent( int tang_flag )
 
   static double volume ;
   static double xsj ;  // determinant jacaobian matrix
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
-  static Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static Vector residJ(ndf) ; //nodeJ residual
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
-  static Vector stress(nstress) ;  //stress
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local double dvol[numberGauss] ; //volume element
+  static thread_local double gaussPoint[ndm] ;
+  static thread_local Vector strain(nstress) ;  //strain
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local Vector residJ(ndf) ; //nodeJ residual
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+  static thread_local Vector stress(nstress) ;  //stress
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
 
   //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-    static Matrix BJtran(ndf,nstress) ;
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BJtranD(ndf,nstress) ;
   //-------------------------------------------------------
 
 
@@ -1183,7 +1183,7 @@ const Matrix&
 BrickUP::computeB( int node, const double shp[4][8] )
 {
 
-  static Matrix B(6,3) ;
+  static thread_local Matrix B(6,3) ;
 
 //---B Matrix in standard {1,2,3} mechanics notation---------
 //
@@ -1250,7 +1250,7 @@ int  BrickUP::sendSelf (int commitTag, Channel &theChannel)
 
   // BrickUP packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(13);
+  static thread_local Vector data(13);
   data(0) = this->getTag();
   data(1) = rho;
   data(2) = b[0];
@@ -1276,7 +1276,7 @@ int  BrickUP::sendSelf (int commitTag, Channel &theChannel)
   // Now BrickUP sends the ids of its materials
   int matDbTag;
 
-  static ID idData(24);
+  static thread_local ID idData(24);
 
   int i;
   for (i = 0; i < 8; i++) {
@@ -1331,7 +1331,7 @@ int  BrickUP::recvSelf (int commitTag,
 
   // BrickUP creates a Vector, receives the Vector and then sets the
   // internal data with the data in the Vector
-  static Vector data(13);
+  static thread_local Vector data(13);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING FourNodeQuadUP::recvSelf() - failed to receive Vector\n";
@@ -1354,7 +1354,7 @@ int  BrickUP::recvSelf (int commitTag,
   perm[1] = data(11);
   perm[2] = data(12);
 
-  static ID idData(24);
+  static thread_local ID idData(24);
   // brickUP now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1433,14 +1433,14 @@ int
 BrickUP::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
     // get vertex display coordinate vectors
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
-    static Vector v4(3);
-    static Vector v5(3);
-    static Vector v6(3);
-    static Vector v7(3);
-    static Vector v8(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
+    static thread_local Vector v4(3);
+    static thread_local Vector v5(3);
+    static thread_local Vector v6(3);
+    static thread_local Vector v7(3);
+    static thread_local Vector v8(3);
     nodePointers[0]->getDisplayCrds(v1, fact, displayMode);
     nodePointers[1]->getDisplayCrds(v2, fact, displayMode);
     nodePointers[2]->getDisplayCrds(v3, fact, displayMode);
@@ -1451,7 +1451,7 @@ BrickUP::displaySelf(Renderer &theViewer, int displayMode, float fact, const cha
     nodePointers[7]->getDisplayCrds(v8, fact, displayMode);
 
     // add to coord matrix
-    static Matrix coords(8, 3);
+    static thread_local Matrix coords(8, 3);
     for (int i = 0; i < 3; i++) {
         coords(0, i) = v1(i);
         coords(1, i) = v2(i);
@@ -1464,7 +1464,7 @@ BrickUP::displaySelf(Renderer &theViewer, int displayMode, float fact, const cha
     }
 
     // create color vector
-    static Vector values(8);
+    static thread_local Vector values(8);
     if (displayMode < 3 && displayMode > 0) {
         // get stress vectors
         const Vector& stress1 = materialPointers[0]->getStress();
@@ -1578,7 +1578,7 @@ BrickUP::setResponse(const char **argv, int argc, OPS_Stream &output)
 int
 BrickUP::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector stresses(48);
+  static thread_local Vector stresses(48);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -142,10 +142,10 @@ class BrickUP : public Element {
     //static data
     
 
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damp ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damp ;
 
     //quadrature data
     static const double root3 ;
@@ -164,7 +164,7 @@ class BrickUP : public Element {
 
     //local nodal coordinates, three coordinates for each of four nodes
     //    static double xl[3][8] ;
-    static double xl[][8] ;
+    static thread_local double xl[][8] ;
     double b[3];		// Body forces
 	
 	double appliedB[3]; // Body forces applied by load pattern, C.McGann, U.Washington
@@ -34,10 +34,10 @@
 #define FixedOrder 3
 
 
-Matrix TwentyNodeBrick::K(60, 60);
-Matrix TwentyNodeBrick::C(60, 60);
-Matrix TwentyNodeBrick::M(60, 60);
-Vector TwentyNodeBrick::P(60);
+thread_local Matrix TwentyNodeBrick::K(60, 60);
+thread_local Matrix TwentyNodeBrick::C(60, 60);
+thread_local Matrix TwentyNodeBrick::M(60, 60);
+thread_local Vector TwentyNodeBrick::P(60);
 Vector Info(109+3);  //For computing moment
 Vector InfoPt(FixedOrder*FixedOrder*FixedOrder*4+1); //Plastic info
 Vector InfoSt(FixedOrder*FixedOrder*FixedOrder*6+1); //Stress info
@@ -2928,7 +2928,7 @@ int TwentyNodeBrick::addInertiaLoadToUnbalance(const Vector &accel)
       return -1;
     }
 
- static Vector ra(60);  // Changed form 8 to 24(3*8)  Xiaoyan 09/27/00
+ static thread_local Vector ra(60);  // Changed form 8 to 24(3*8)  Xiaoyan 09/27/00
 
  ra( 0) = Raccel1(0);
  ra( 1) = Raccel1(1);
@@ -3198,7 +3198,7 @@ const Vector &TwentyNodeBrick::getResistingForceIncInertia ()
     const Vector &accel19 = theNodes[18]->getTrialAccel();
     const Vector &accel20 = theNodes[19]->getTrialAccel();
 
-    static Vector a(60);  // originally 8
+    static thread_local Vector a(60);  // originally 8
 
     a( 0) = accel1(0);
     a( 1) = accel1(1);
@@ -3320,14 +3320,14 @@ int TwentyNodeBrick::displaySelf (Renderer &theViewer, int displayMode, float fa
     const Vector &end7Disp = theNodes[6]->getDisp();
     const Vector &end8Disp = theNodes[7]->getDisp();
 
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
-    static Vector v4(3);
-    static Vector v5(3);
-    static Vector v6(3);
-    static Vector v7(3);
-    static Vector v8(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
+    static thread_local Vector v4(3);
+    static thread_local Vector v5(3);
+    static thread_local Vector v6(3);
+    static thread_local Vector v7(3);
+    static thread_local Vector v8(3);
 
     for (int i = 0; i < 2; i++)
     {
@@ -4440,7 +4440,7 @@ double TwentyNodeBrick::get_Gauss_p_c(short order, short point_numb)
   {
 //  Abscissae coefficient of the Gaussian quadrature formula
 // starting from 1 not from 0
-    static double Gauss_coordinates[7][7];
+    static thread_local double Gauss_coordinates[7][7];
 
     Gauss_coordinates[1][1] = 0.0 ;
     Gauss_coordinates[2][1] = -0.577350269189626;
@@ -4471,7 +4471,7 @@ double TwentyNodeBrick::get_Gauss_p_w(short order, short point_numb)
   {
 //  Weight coefficient of the Gaussian quadrature formula
 // starting from 1 not from 0
-    static double Gauss_weights[7][7]; // static data ??
+    static thread_local double Gauss_weights[7][7]; // static data ??
 
     Gauss_weights[1][1] = 2.0;
     Gauss_weights[2][1] = 1.0;
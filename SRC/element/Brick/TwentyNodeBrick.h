@@ -142,10 +142,10 @@ class TwentyNodeBrick: public Element
     Matrix *Ki;
     Node *theNodes[20];
 
-    static Matrix K;    // Element stiffness Matrix
-    static Matrix C;    // Element damping matrix
-    static Matrix M;    // Element mass matrix
-    static Vector P;    // Element resisting force vector
+    static thread_local Matrix K;    // Element stiffness Matrix
+    static thread_local Matrix C;    // Element damping matrix
+    static thread_local Matrix M;    // Element mass matrix
+    static thread_local Vector P;    // Element resisting force vector
     Vector Q;           // Applied nodal loads
     Vector bf;          // Body forces
     
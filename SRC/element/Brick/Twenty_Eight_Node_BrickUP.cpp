@@ -98,24 +98,24 @@ void * OPS_ADD_RUNTIME_VPV(OPS_TwentyEightNodeBrickUP)
 #endif
 
 //static data
-double  TwentyEightNodeBrickUP::xl[3][20] ;
-
-Matrix  TwentyEightNodeBrickUP::stiff(68,68) ;
-Vector  TwentyEightNodeBrickUP::resid(68) ;
-Matrix  TwentyEightNodeBrickUP::mass(68,68) ;
-Matrix  TwentyEightNodeBrickUP::damp(68,68) ;
-
-double TwentyEightNodeBrickUP::shgu[4][20][27];
-double TwentyEightNodeBrickUP::shgp[4][8][8];
-double TwentyEightNodeBrickUP::shgq[4][20][8];
-double TwentyEightNodeBrickUP::shlu[4][20][27];
-double TwentyEightNodeBrickUP::shlp[4][8][8];
-double TwentyEightNodeBrickUP::shlq[4][20][8];
-double TwentyEightNodeBrickUP::wu[27];
-double TwentyEightNodeBrickUP::wp[8];
-double TwentyEightNodeBrickUP::dvolu[27];
-double TwentyEightNodeBrickUP::dvolp[8];
-double TwentyEightNodeBrickUP::dvolq[8];
+thread_local double  TwentyEightNodeBrickUP::xl[3][20] ;
+
+thread_local Matrix  TwentyEightNodeBrickUP::stiff(68,68) ;
+thread_local Vector  TwentyEightNodeBrickUP::resid(68) ;
+thread_local Matrix  TwentyEightNodeBrickUP::mass(68,68) ;
+thread_local Matrix  TwentyEightNodeBrickUP::damp(68,68) ;
+
+thread_local double TwentyEightNodeBrickUP::shgu[4][20][27];
+thread_local double TwentyEightNodeBrickUP::shgp[4][8][8];
+thread_local double TwentyEightNodeBrickUP::shgq[4][20][8];
+thread_local double TwentyEightNodeBrickUP::shlu[4][20][27];
+thread_local double TwentyEightNodeBrickUP::shlp[4][8][8];
+thread_local double TwentyEightNodeBrickUP::shlq[4][20][8];
+thread_local double TwentyEightNodeBrickUP::wu[27];
+thread_local double TwentyEightNodeBrickUP::wp[8];
+thread_local double TwentyEightNodeBrickUP::dvolu[27];
+thread_local double TwentyEightNodeBrickUP::dvolp[8];
+thread_local double TwentyEightNodeBrickUP::dvolq[8];
 
 // null constructor
 TwentyEightNodeBrickUP::TwentyEightNodeBrickUP( ) :
@@ -360,8 +360,8 @@ void  TwentyEightNodeBrickUP::Print( OPS_Stream &s, int flag )
         // spit out the section location & invoke print on the scetion
         const int numMaterials = nintu;
 
-        static Vector avgStress(7);
-        static Vector avgStrain(nstress);
+        static thread_local Vector avgStress(7);
+        static thread_local Vector avgStrain(nstress);
         avgStress.Zero();
         avgStrain.Zero();
         for (i=0; i<numMaterials; i++) {
@@ -439,9 +439,9 @@ int
 TwentyEightNodeBrickUP::update()
 {
     int i, j, k, k1;
-    static double u[3][20];
+    static thread_local double u[3][20];
     static double xsj;
-    static Matrix B(6, 3);
+    static thread_local Matrix B(6, 3);
     double volume = 0.;
 
     for (i = 0; i < nenu; i++) {
@@ -451,7 +451,7 @@ TwentyEightNodeBrickUP::update()
          u[2][i] = disp(2);
     }
 
-    static Vector eps(6);
+    static thread_local Vector eps(6);
 
     int ret = 0;
 
@@ -552,9 +552,9 @@ const Matrix&  TwentyEightNodeBrickUP::getStiff( int flag )
     double volume = 0.;
     //-------------------------------------------------------
     int j3, j3m1, j3m2, ik, ib, jk, jb;
-    static Matrix B(6,nenu*3);
-    static Matrix BTDB(nenu*3,nenu*3);
-    static Matrix D(6, 6);
+    static thread_local Matrix B(6,nenu*3);
+    static thread_local Matrix BTDB(nenu*3,nenu*3);
+    static thread_local Matrix D(6, 6);
     B.Zero();
     BTDB.Zero();
     stiff.Zero();
@@ -811,7 +811,7 @@ TwentyEightNodeBrickUP::addLoad(ElementalLoad *theLoad, double loadFactor)
 int
 TwentyEightNodeBrickUP::addInertiaLoadToUnbalance(const Vector &accel)
 {
-    static Vector ra(68);
+    static thread_local Vector ra(68);
     int i, j, ik;
     ra.Zero();
 
@@ -856,7 +856,7 @@ const Vector&  TwentyEightNodeBrickUP::getResistingForce( )
 {
     int i, j, jk, k, k1;
     double xsj;
-    static Matrix B(6, 3);
+    static thread_local Matrix B(6, 3);
     double volume = 0.;
 
 //    printf("calling getResistingForce()\n");
@@ -968,10 +968,10 @@ const Vector&  TwentyEightNodeBrickUP::getResistingForce( )
 //get residual with inertia terms
 const Vector&  TwentyEightNodeBrickUP::getResistingForceIncInertia( )
 {
-    static Vector res(68);
+    static thread_local Vector res(68);
 
     int i, j, ik;
-    static double a[68];
+    static thread_local double a[68];
 
     for (i=0; i<nenu; i++) {
         const Vector &accel = nodePointers[i]->getTrialAccel();
@@ -1147,7 +1147,7 @@ int  TwentyEightNodeBrickUP::sendSelf (int commitTag, Channel &theChannel)
   int dataTag = this->getDbTag();
   // TwentyEightNodeBrickUP packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(13);
+  static thread_local Vector data(13);
   data(0) = this->getTag();
   data(1) = rho;
   data(2) = b[0];
@@ -1168,7 +1168,7 @@ int  TwentyEightNodeBrickUP::sendSelf (int commitTag, Channel &theChannel)
   }
   // Now TwentyEightNodeBrickUP sends the ids of its materials
   int matDbTag;
-  static ID idData(74);
+  static thread_local ID idData(74);
   int i;
   for (i = 0; i < nintu; i++) {
     idData(i) = materialPointers[i]->getClassTag();
@@ -1208,7 +1208,7 @@ int  TwentyEightNodeBrickUP::recvSelf (int commitTag,
   int dataTag = this->getDbTag();
   // TwentyEightNodeBrickUP creates a Vector, receives the Vector and then sets the
   // internal data with the data in the Vector
-  static Vector data(13);
+  static thread_local Vector data(13);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING TwentyEightNodeBrickUP::recvSelf() - failed to receive Vector\n";
@@ -1227,7 +1227,7 @@ int  TwentyEightNodeBrickUP::recvSelf (int commitTag,
   perm[0] = data(10);
   perm[1] = data(11);
   perm[2] = data(12);
-  static ID idData(74);
+  static thread_local ID idData(74);
   // TwentyEightNodeBrickUP now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1408,7 +1408,7 @@ TwentyEightNodeBrickUP::setResponse(const char **argv, int argc, OPS_Stream &out
 int
 TwentyEightNodeBrickUP::getResponse(int responseID, Information &eleInfo)
 {
-    static Vector stresses(nintu*6);
+    static thread_local Vector stresses(nintu*6);
 
     if (responseID == 1)
         return eleInfo.setVector(this->getResistingForce());
@@ -1447,7 +1447,7 @@ TwentyEightNodeBrickUP::getResponse(int responseID, Information &eleInfo)
 void
 TwentyEightNodeBrickUP::compuLocalShapeFunction() {
 
-    static double shl[4][20][27], 
+    static thread_local double shl[4][20][27], 
                     w[27];
 
     // solid phase
@@ -1481,9 +1481,9 @@ TwentyEightNodeBrickUP::Jacobian3d(int gaussPoint, double& xsj, int mode)
 {
     int i, j, k, nint, nen;
     double rxsj, c1, c2, c3;
-    static double xs[3][3];
-    static double ad[3][3];
-    static double shp[4][20];
+    static thread_local double xs[3][3];
+    static thread_local double ad[3][3];
+    static thread_local double shp[4][20];
 
     if( mode == 0 ) { // solid
         nint = nintu;
@@ -136,10 +136,10 @@ public :
 
 private :
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damp ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damp ;
 
 
     //node information
@@ -151,7 +151,7 @@ private :
                                    //
     //local nodal coordinates, three coordinates for each of twenty nodes
     //    static double xl[3][20] ;
-    static double xl[3][20] ;
+    static thread_local double xl[3][20] ;
     double b[3];		// Body forces
     double appliedB[3]; // Body forces applied by load pattern, C.McGann, U.Washington
     int applyLoad;      // flag for body forces applied by load, C.McGann, U.Washington
@@ -165,17 +165,17 @@ private :
     static constexpr int nenu  = 20;
     static constexpr int nenp  =  8;
 
-    static double shgu[4][nenu][nintu];	// Stores shape functions and derivatives (overwritten)
-    static double shgp[4][8][8];	// Stores shape functions and derivatives (overwritten)
-    static double shgq[4][20][8];	// Stores shape functions and derivatives (overwritten)
-    static double shlu[4][20][27];	// Stores shape functions and derivatives
-    static double shlp[4][8][8];	// Stores shape functions and derivatives
-    static double shlq[4][20][8];	// Stores shape functions and derivatives
-    static double wu[nintu];		// Stores quadrature weights
-    static double wp[8];		// Stores quadrature weights
-    static double dvolu[nintu];  // Stores detJacobian (overwritten)
-    static double dvolp[8];  // Stores detJacobian (overwritten)
-    static double dvolq[8];  // Stores detJacobian (overwritten)
+    static thread_local double shgu[4][nenu][nintu];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shgp[4][8][8];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shgq[4][20][8];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shlu[4][20][27];	// Stores shape functions and derivatives
+    static thread_local double shlp[4][8][8];	// Stores shape functions and derivatives
+    static thread_local double shlq[4][20][8];	// Stores shape functions and derivatives
+    static thread_local double wu[nintu];		// Stores quadrature weights
+    static thread_local double wp[8];		// Stores quadrature weights
+    static thread_local double dvolu[nintu];  // Stores detJacobian (overwritten)
+    static thread_local double dvolp[8];  // Stores detJacobian (overwritten)
+    static thread_local double dvolq[8];  // Stores detJacobian (overwritten)
     //inertia terms
     void formInertiaTerms( int tangFlag ) ;
     //damping terms
@@ -97,19 +97,19 @@ void * OPS_ADD_RUNTIME_VPV(OPS_Twenty_Node_Brick)
 #endif
 
 //static data
-double  Twenty_Node_Brick::xl[3][20] ;
+thread_local double  Twenty_Node_Brick::xl[3][20] ;
 
-Matrix  Twenty_Node_Brick::stiff(60,60) ;
-Vector  Twenty_Node_Brick::resid(60) ;
-Matrix  Twenty_Node_Brick::mass(60,60) ;
-Matrix  Twenty_Node_Brick::damp(60,60) ;
+thread_local Matrix  Twenty_Node_Brick::stiff(60,60) ;
+thread_local Vector  Twenty_Node_Brick::resid(60) ;
+thread_local Matrix  Twenty_Node_Brick::mass(60,60) ;
+thread_local Matrix  Twenty_Node_Brick::damp(60,60) ;
 
 const int Twenty_Node_Brick::nintu=27;
 const int Twenty_Node_Brick::nenu=20;
-double Twenty_Node_Brick::shgu[4][20][27];
-double Twenty_Node_Brick::shlu[4][20][27];
-double Twenty_Node_Brick::wu[27];
-double Twenty_Node_Brick::dvolu[27];
+thread_local double Twenty_Node_Brick::shgu[4][20][27];
+thread_local double Twenty_Node_Brick::shlu[4][20][27];
+thread_local double Twenty_Node_Brick::wu[27];
+thread_local double Twenty_Node_Brick::dvolu[27];
 
 //null constructor
 Twenty_Node_Brick::Twenty_Node_Brick( ) :
@@ -350,8 +350,8 @@ void  Twenty_Node_Brick::Print(OPS_Stream &s, int flag)
         // spit out the section location & invoke print on the scetion
         const int numMaterials = nintu;
 
-        static Vector avgStress(7);
-        static Vector avgStrain(nstress);
+        static thread_local Vector avgStress(7);
+        static thread_local Vector avgStrain(nstress);
         avgStress.Zero();
         avgStrain.Zero();
         for (i = 0; i < numMaterials; i++) {
@@ -428,9 +428,9 @@ int
 Twenty_Node_Brick::update()
 {
 	int i, j, k, k1;
-	static double u[3][20];
+	static thread_local double u[3][20];
 	static double xsj;
-	static Matrix B(6, 3);
+	static thread_local Matrix B(6, 3);
 	double volume = 0.;
 
 	for (i = 0; i < nenu; i++) {
@@ -440,7 +440,7 @@ Twenty_Node_Brick::update()
 	     u[2][i] = disp(2);
     }
 
-	static Vector eps(6);
+	static thread_local Vector eps(6);
 
 	int ret = 0;
 
@@ -572,11 +572,11 @@ const Matrix&  Twenty_Node_Brick::getStiff( int flag )
 
 	int j3, j3m1, j3m2, ik, ib, jk, jb;
 
-	static Matrix B(6,nenu*3);
+	static thread_local Matrix B(6,nenu*3);
 
-	static Matrix BTDB(nenu*3,nenu*3);
+	static thread_local Matrix BTDB(nenu*3,nenu*3);
 
-	static Matrix D(6, 6);
+	static thread_local Matrix D(6, 6);
 
 	B.Zero();
 
@@ -915,7 +915,7 @@ Twenty_Node_Brick::addInertiaLoadToUnbalance(const Vector &accel)
 
 {
 
-	static Vector ra(60);
+	static thread_local Vector ra(60);
 
 //	printf("calling addInertiaLoadToUnbalance()\n");
 
@@ -995,7 +995,7 @@ const Vector&  Twenty_Node_Brick::getResistingForce( )
 
 	double xsj;
 
-	static Matrix B(6, 3);
+	static thread_local Matrix B(6, 3);
 
 	double volume = 0.;
 
@@ -1160,7 +1160,7 @@ const Vector&  Twenty_Node_Brick::getResistingForceIncInertia( )
 
 {
 
-	static Vector res(60);
+	static thread_local Vector res(60);
 
 
 
@@ -1170,7 +1170,7 @@ const Vector&  Twenty_Node_Brick::getResistingForceIncInertia( )
 
 	int i, j, ik;
 
-	static double a[60];
+	static thread_local double a[60];
 
 
 
@@ -1458,7 +1458,7 @@ int  Twenty_Node_Brick::sendSelf (int commitTag, Channel &theChannel)
 
 
 
-	static ID idData(75);
+	static thread_local ID idData(75);
 
 
 
@@ -1556,7 +1556,7 @@ int  Twenty_Node_Brick::recvSelf (int commitTag,
 
 
 
-	static ID idData(75);
+	static thread_local ID idData(75);
 
 	//  now receives the tags of its 20 external nodes
 
@@ -1767,7 +1767,7 @@ Twenty_Node_Brick::getResponse(int responseID, Information &eleInfo)
 
 {
 
-	static Vector stresses(162);
+	static thread_local Vector stresses(162);
 
 
 
@@ -1851,7 +1851,7 @@ Twenty_Node_Brick::compuLocalShapeFunction() {
 
 	int i, k, j;
 
-	static double shl[4][20][27], w[27];
+	static thread_local double shl[4][20][27], w[27];
 
 	// solid phase
 
@@ -1885,11 +1885,11 @@ Twenty_Node_Brick::Jacobian3d(int gaussPoint, double& xsj, int mode)
 
 	double rxsj, c1, c2, c3;
 
-	static double xs[3][3];
+	static thread_local double xs[3][3];
 
-	static double ad[3][3];
+	static thread_local double ad[3][3];
 
-	static double shp[4][20];
+	static thread_local double shp[4][20];
 
 
 
@@ -130,10 +130,10 @@ class Twenty_Node_Brick : public Element {
 private :
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damp ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damp ;
 
     //quadrature data
     static const int nintu;
@@ -150,16 +150,16 @@ private :
 
     //local nodal coordinates, three coordinates for each of twenty nodes
     //    static double xl[3][20] ;
-    static double xl[3][20] ;
+    static thread_local double xl[3][20] ;
     double b[3];		// Body forces
 	
 	double appliedB[3]; // Body forces applied with load pattern, C.McGann, U.Washington
 	int applyLoad;      // flag for body force in load, C.McGann, U.Washington
 
-    static double shgu[4][20][27];	// Stores shape functions and derivatives (overwritten)
-    static double shlu[4][20][27];	// Stores shape functions and derivatives
-    static double wu[27];		// Stores quadrature weights
-    static double dvolu[27];  // Stores detJacobian (overwritten)
+    static thread_local double shgu[4][20][27];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shlu[4][20][27];	// Stores shape functions and derivatives
+    static thread_local double wu[27];		// Stores quadrature weights
+    static thread_local double dvolu[27];  // Stores detJacobian (overwritten)
 
     //inertia terms
     void formInertiaTerms( int tangFlag ) ;
@@ -30,6 +30,8 @@
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
+#include <memory>
+#include <vector>
 
 #include "Element.h"
 #include "ElementResponse.h"
@@ -39,12 +41,33 @@
 #include <Node.h>
 #include <Domain.h>
 
-Element  *ops_TheActiveElement = 0;
+thread_local Element *ops_TheActiveElement = nullptr;
 
-Matrix **Element::theMatrices; 
-Vector **Element::theVectors1; 
-Vector **Element::theVectors2; 
-int  Element::numMatrices(0);
+namespace {
+// Work areas used by the default implementations below to return the
+// damping and mass matrices and the residual vectors. There is one set
+// of each size per thread so that elements may be evaluated concurrently.
+struct WorkArea {
+  WorkArea(int n) : matrix(n, n), vector1(n), vector2(n) {}
+  Matrix matrix;
+  Vector vector1;
+  Vector vector2;
+};
+
+WorkArea &
+getWorkArea(int numDOF)
+{
+  thread_local std::vector<std::unique_ptr<WorkArea>> theAreas;
+
+  if ((int)theAreas.size() <= numDOF)
+    theAreas.resize(numDOF+1);
+
+  if (theAreas[numDOF] == nullptr)
+    theAreas[numDOF] = std::make_unique<WorkArea>(numDOF);
+
+  return *theAreas[numDOF];
+}
+} // namespace
 
 // Element(int tag, int noExtNodes);
 // 	constructor that takes the element's unique tag and the number
@@ -115,59 +138,10 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   betaK0 = betak0;
   betaKc = betakc;
 
-  // check that memory has been allocated to store compute/return
-  // damping matrix & residual force calculations
-  if (index == -1) {
-    int numDOF = this->getNumDOF();
-
-    for (int i=0; i<numMatrices; i++) {
-      Matrix *aMatrix = theMatrices[i];
-      if (aMatrix->noRows() == numDOF) {
-	index = i;
-	i = numMatrices;
-      }
-    }
-    if (index == -1) {
-      Matrix **nextMatrices = new Matrix *[numMatrices+1];
-
-      for (int j=0; j<numMatrices; j++)
-	nextMatrices[j] = theMatrices[j];
-
-      Matrix *theMatrix = new Matrix(numDOF, numDOF);
-
-      nextMatrices[numMatrices] = theMatrix;
-
-      Vector **nextVectors1 = new Vector *[numMatrices+1];
-      Vector **nextVectors2 = new Vector *[numMatrices+1];
-      if (nextVectors1 == 0 || nextVectors2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      for (int j=0; j<numMatrices; j++) {
-	nextVectors1[j] = theVectors1[j];
-	nextVectors2[j] = theVectors2[j];
-      }
-	
-      Vector *theVector1 = new Vector(numDOF);
-      Vector *theVector2 = new Vector(numDOF);
-
-      nextVectors1[numMatrices] = theVector1;
-      nextVectors2[numMatrices] = theVector2;
-
-      if (numMatrices != 0) {
-	delete [] theMatrices;
-	delete [] theVectors1;
-	delete [] theVectors2;
-      }
-
-      index = numMatrices;
-      numMatrices++;
-      theMatrices = nextMatrices;
-      theVectors1 = nextVectors1;
-      theVectors2 = nextVectors2;
-    }
-  }
+  // the work areas used to compute/return the damping matrix &
+  // residual force are keyed by the number of dof
+  if (index == -1)
+    index = this->getNumDOF();
 
   // if need storage for Kc go get it
   if (betaKc != 0.0) {  
@@ -183,6 +157,12 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   return 0;
 }
 
+bool
+Element::hasRayleighDamping() const
+{
+  return alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0;
+}
+
 const Matrix &
 Element::getDamp() 
 {
@@ -191,7 +171,7 @@ Element::getDamp()
   }
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &getWorkArea(index).matrix; 
   theMatrix->Zero();
   if (alphaM != 0.0)
     theMatrix->addMatrix(0.0, this->getMass(), alphaM);
@@ -214,7 +194,7 @@ Element::getMass(void)
   }
 
   // zero the matrix & return it
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &getWorkArea(index).matrix; 
   theMatrix->Zero();
   return *theMatrix;
 }
@@ -226,9 +206,9 @@ Element::getResistingForceIncInertia(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = &getWorkArea(index).matrix; 
+  Vector *theVector = &getWorkArea(index).vector2;
+  Vector *theVector2 = &getWorkArea(index).vector1;
 
   //
   // perform: R = P(U) - Pext(t);
@@ -293,9 +273,9 @@ Element::getRayleighDampingForces(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = &getWorkArea(index).matrix; 
+  Vector *theVector = &getWorkArea(index).vector2;
+  Vector *theVector2 = &getWorkArea(index).vector1;
 
   //
   // perform: R = (alphaM * M + betaK0 * K0 + betaK * K) * v
@@ -389,6 +369,22 @@ Element::isSubdomain(void)
     return false;
 }
 
+bool
+Element::isThreadSafe(void) const
+{
+    // elements must opt in; by default the state determination
+    // methods are assumed to write to class-wide storage
+    return false;
+}
+
+bool
+Element::hasOnlyRayleighDamping(void) const
+{
+    // elements must opt in; by default getResistingForceIncInertia()
+    // may add forces of its own, e.g. the fluid coupling of u-p elements
+    return false;
+}
+
 Response*
 Element::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
@@ -486,7 +482,7 @@ Element::getResistingForceSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Vector *theVector = theVectors1[index];
+  Vector *theVector = &getWorkArea(index).vector1;
   theVector->Zero();
 
   return *theVector;
@@ -505,7 +501,7 @@ Element::getTangentStiffSensitivity(int gradIndex)
     warningShown = true;
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &getWorkArea(index).matrix;
   theMatrix->Zero();
 
   return *theMatrix;
@@ -525,7 +521,7 @@ Element::getInitialStiffSensitivity(int gradIndex)
     warningShown = true;
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &getWorkArea(index).matrix;
   theMatrix->Zero();
 
   return *theMatrix;
@@ -544,7 +540,7 @@ Element::getCommittedStiffSensitivity(int gradIndex)
     warningShown = true;
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &getWorkArea(index).matrix;
   theMatrix->Zero();
 
   return *theMatrix;
@@ -557,7 +553,7 @@ Element::getMassSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &getWorkArea(index).matrix;
   theMatrix->Zero();
 
   return *theMatrix;
@@ -588,7 +584,7 @@ Element::getDampSensitivity(int gradIndex)
   }
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &getWorkArea(index).matrix; 
   theMatrix->Zero();
   if (alphaM != 0.0) {
     theMatrix->addMatrix(0.0, this->getMassSensitivity(gradIndex), alphaM);
@@ -749,7 +745,7 @@ Element::getGeometricTangentStiff()
 	this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
     }
     
-    Matrix *theMatrix = theMatrices[index];
+    Matrix *theMatrix = &getWorkArea(index).matrix;
     theMatrix->Zero();
     
     return *theMatrix;
@@ -60,6 +60,18 @@ class Element : public DomainComponent
     virtual int  revertToStart();
     virtual int  update();
     virtual bool isSubdomain();
+
+    // return true if update() and the methods returning the tangent,
+    // mass, damping and resisting force only modify state owned by this
+    // element (or thread-local storage), so that they may be invoked
+    // concurrently with other elements
+    virtual bool isThreadSafe() const;
+
+    // return true if, with zero nodal accelerations,
+    // getResistingForceIncInertia() adds nothing to getResistingForce()
+    // but the Rayleigh damping forces; elements with other velocity
+    // dependent forces must leave it false
+    virtual bool hasOnlyRayleighDamping() const;
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -76,6 +88,7 @@ class Element : public DomainComponent
 
     virtual int addInertiaLoadToUnbalance(const Vector &accel);
     virtual int setRayleighDampingFactors(double alphaM, double betaK, double betaK0, double betaKc);
+    bool hasRayleighDamping() const;
 
     // methods for obtaining resisting force (force includes elemental loads)
     virtual const Vector &getResistingForce() =0;
@@ -119,10 +132,6 @@ private:
     bool is_this_element_active;
 
     int index, nodeIndex;
-    static Matrix ** theMatrices; 
-    static Vector ** theVectors1; 
-    static Vector ** theVectors2; 
-    static int numMatrices;
 };
 
 
@@ -10,8 +10,8 @@
 
 using OpenSees::VectorND;
 
-Matrix BasicFrame3d::K(12,12);
-Vector BasicFrame3d::P(12);
+thread_local Matrix BasicFrame3d::K(12,12);
+thread_local Vector BasicFrame3d::P(12);
 
 
 BasicFrame3d::~BasicFrame3d()
@@ -139,7 +139,7 @@ BasicFrame3d::getTangentStiff()
 
   // Transform basic stiffness to local system
   static MatrixND<12,12> kl;  // Local stiffness
-  static double tmp[12][12];  // Temporary storage
+  static thread_local double tmp[12][12];  // Temporary storage
   // First compute kb*T_{bl}
   for (int i = 0; i < 6; i++) {
     tmp[i][ 0] = -kb(i, 0);
@@ -174,7 +174,7 @@ BasicFrame3d::getTangentStiff()
 
 
   static MatrixND<12,12> Kg;
-  static Matrix Wrapper(Kg);
+  static thread_local Matrix Wrapper(Kg);
   Kg = theCoordTransf->pushResponse(kl, pl);
   return Wrapper;
 }
@@ -254,7 +254,7 @@ BasicFrame3d::getResistingForceIncInertia()
 
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    static thread_local Vector accel(12);
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
@@ -526,7 +526,7 @@ BasicFrame3d::getMassSensitivity(int gradNumber)
 
   } else  {
     // consistent mass matrix
-    static Matrix ml(12,12);
+    static thread_local Matrix ml(12,12);
     //double m = rho*L/420.0;
     double m = L/420.0;
     ml(0,0) = ml(6,6) = m*140.0;
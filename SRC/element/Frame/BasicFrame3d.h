@@ -116,8 +116,8 @@ protected:
    OpenSees::VectorND<6>   p0;  // Reactions in basic system
                                 // { 
                                 // TODO(cmp): change to size 12
-   static Matrix K;
-   static Vector P;
+   static thread_local Matrix K;
+   static thread_local Vector P;
 
 
    int parameterID;
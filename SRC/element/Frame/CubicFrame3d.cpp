@@ -28,8 +28,8 @@
 #include <Parameter.h>
 #include <math.h>
 
-Matrix CubicFrame3d::K(12, 12);
-Vector CubicFrame3d::P(12);
+thread_local Matrix CubicFrame3d::K(12, 12);
+thread_local Vector CubicFrame3d::P(12);
 using namespace OpenSees;
 
 #define ELE_TAG_CubicFrame3d 0
@@ -322,7 +322,7 @@ const Matrix&
 CubicFrame3d::getTangentStiff()
 {
   static MatrixND<6,6> kb;
-  static Matrix wrapper(kb);
+  static thread_local Matrix wrapper(kb);
 
   // Zero for integral
   kb.zero();
@@ -589,7 +589,7 @@ CubicFrame3d::getBasicStiff(Matrix& kb, int initial)
 const Matrix&
 CubicFrame3d::getInitialStiff()
 {
-  static Matrix kb(6, 6);
+  static thread_local Matrix kb(6, 6);
 
   this->getBasicStiff(kb, 1);
 
@@ -849,7 +849,7 @@ CubicFrame3d::sendSelf(int commitTag, Channel& theChannel)
 
   const ID& connectedExternalNodes = this->getExternalNodes();
 
-  static Vector data(14);
+  static thread_local Vector data(14);
   data(0)            = this->getTag();
   data(1)            = connectedExternalNodes(0);
   data(2)            = connectedExternalNodes(1);
@@ -941,7 +941,7 @@ CubicFrame3d::recvSelf(int commitTag, Channel& theChannel, FEM_ObjectBroker& the
   //
   int dbTag = this->getDbTag();
 
-  static Vector data(14);
+  static thread_local Vector data(14);
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0) {
     opserr << "CubicFrame3d::recvSelf() - failed to recv data Vector\n";
@@ -1421,7 +1421,7 @@ CubicFrame3d::getResponse(int responseID, Information& eleInfo)
   }
 
   else if (responseID == 19) {
-    static Matrix kb(6, 6);
+    static thread_local Matrix kb(6, 6);
     this->getBasicStiff(kb);
     return eleInfo.setMatrix(kb);
   }
@@ -1432,9 +1432,9 @@ CubicFrame3d::getResponse(int responseID, Information& eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
-    static Matrix kb(6, 6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
+    static thread_local Matrix kb(6, 6);
     this->getBasicStiff(kb, 1);
     kb.Solve(q, ve);
     vp = theCoordTransf->getBasicTrialDisp();
@@ -1619,7 +1619,7 @@ CubicFrame3d::getResistingForceSensitivity(int gradNumber)
 
 
   // Zero for integration
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh.Zero();
 
   // Loop over the integration points
@@ -1667,7 +1667,7 @@ CubicFrame3d::getResistingForceSensitivity(int gradNumber)
   }
 
   // Transform forces
-  static Vector dp0dh(6); // No distributed loads
+  static thread_local Vector dp0dh(6); // No distributed loads
 
   P.Zero();
 
@@ -1677,7 +1677,7 @@ CubicFrame3d::getResistingForceSensitivity(int gradNumber)
 
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(6, 6);
+    static thread_local Matrix kbmine(6, 6);
     kbmine.Zero();
     q.Zero();
 
@@ -1826,7 +1826,7 @@ CubicFrame3d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector& v = theCoordTransf->getBasicTrialDisp();
 
-  static Vector dvdh(6);
+  static thread_local Vector dvdh(6);
   dvdh = theCoordTransf->getBasicDisplTotalGrad(gradNumber);
 
   double L        = theCoordTransf->getInitialLength();
@@ -129,8 +129,8 @@ private:
 
   int parameterID;
 
-  static Matrix K; // Element stiffness, damping, and mass Matrix
-  static Vector P; // Element resisting force vector
+  static thread_local Matrix K; // Element stiffness, damping, and mass Matrix
+  static thread_local Vector P; // Element resisting force vector
 
   static constexpr FrameStressLayout scheme = {
       FrameStress::N, FrameStress::Vy, FrameStress::Vz,
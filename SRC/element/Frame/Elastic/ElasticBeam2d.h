@@ -72,6 +72,7 @@ class ElasticBeam2d : public Element
     int revertToStart();
     
     int update();
+    bool isThreadSafe() const;
     const Matrix &getTangentStiff();
     const Matrix &getInitialStiff();
     const Matrix &getMass();    
@@ -117,8 +118,8 @@ class ElasticBeam2d : public Element
 
     CrdTransf *theCoordTransf;
     
-    static Matrix K;
-    static Vector P;
+    static thread_local Matrix K;
+    static thread_local Vector P;
 };
 
 #endif
@@ -31,6 +31,7 @@
 #include <FEM_ObjectBroker.h>
 
 #include <CrdTransf.h>
+#include <classTags.h>
 #include <Information.h>
 #include <Parameter.h>
 #include <ElementResponse.h>
@@ -41,9 +42,9 @@
 #include <stdlib.h>
 #include <string>
 
-Matrix ElasticBeam3d::K(12,12);
-Vector ElasticBeam3d::P(12);
-Matrix ElasticBeam3d::kb(6,6);
+thread_local Matrix ElasticBeam3d::K(12,12);
+thread_local Vector ElasticBeam3d::P(12);
+thread_local Matrix ElasticBeam3d::kb(6,6);
 
 
 ElasticBeam3d::ElasticBeam3d()
@@ -301,6 +302,15 @@ ElasticBeam3d::update(void)
   return theCoordTransf->update();
 }
 
+bool
+ElasticBeam3d::isThreadSafe() const
+{
+  // the linear transformation keeps no state in update(); the
+  // others use function-static work areas
+  return theCoordTransf != nullptr
+      && theCoordTransf->getClassTag() == CRDTR_TAG_LinearCrdTransf3d;
+}
+
 const Matrix &
 ElasticBeam3d::getTangentStiff(void)
 {
@@ -439,7 +449,7 @@ ElasticBeam3d::getMass(void)
             K(8,8) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(12,12);
+            static thread_local Matrix ml(12,12);
             double m = rho*L/420.0;
             ml(0,0) = ml(6,6) = m*140.0;
             ml(0,6) = ml(6,0) = m*70.0;
@@ -671,7 +681,7 @@ ElasticBeam3d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(8) -= m * Raccel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    static thread_local Vector Raccel(12);
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
@@ -714,7 +724,7 @@ ElasticBeam3d::getResistingForceIncInertia()
     P(8) += m * accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    static thread_local Vector accel(12);
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
@@ -804,7 +814,7 @@ ElasticBeam3d::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(19);
+    static thread_local Vector data(19);
     
     data(0) = A;
     data(1) = E; 
@@ -857,7 +867,7 @@ int
 ElasticBeam3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(19);
+  static thread_local Vector data(19);
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -959,9 +969,9 @@ ElasticBeam3d::Print(OPS_Stream &s, int flag)
 	else if (flag == 2) {
 		this->getResistingForce(); // in case linear algo
 
-		static Vector xAxis(3);
-		static Vector yAxis(3);
-		static Vector zAxis(3);
+		static thread_local Vector xAxis(3);
+		static thread_local Vector yAxis(3);
+		static thread_local Vector zAxis(3);
 
 		theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -1153,9 +1163,9 @@ ElasticBeam3d::getResponse (int responseID, Information &eleInfo)
   double N, V, M1, M2, T;
   double L = theCoordTransf->getInitialLength();
   double oneOverL = 1.0/L;
-  static Vector Res(12);
+  static thread_local Vector Res(12);
   Res = this->getResistingForce();
-  static Vector s(6);
+  static thread_local Vector s(6);
   
   switch (responseID) {
   case 1: // stiffness
@@ -46,9 +46,9 @@
 #include <fstream>
 #include <elementAPI.h>
 
-Matrix ElasticBeamWarping3d::K(14,14);
-Vector ElasticBeamWarping3d::P(14);
-Matrix ElasticBeamWarping3d::kb(9,9);
+thread_local Matrix ElasticBeamWarping3d::K(14,14);
+thread_local Vector ElasticBeamWarping3d::P(14);
+thread_local Matrix ElasticBeamWarping3d::kb(9,9);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ElasticBeamWarping3d)
 {
@@ -688,7 +688,7 @@ ElasticBeamWarping3d::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(16);
+    static thread_local Vector data(16);
     
     data(0) = A;
     data(1) = E; 
@@ -738,7 +738,7 @@ int
 ElasticBeamWarping3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(16);
+  static thread_local Vector data(16);
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -837,9 +837,9 @@ ElasticBeamWarping3d::Print(OPS_Stream &s, int flag)
    else if (flag == 2){
      this->getResistingForce(); // in case linear algo
 
-     static Vector xAxis(3);
-     static Vector yAxis(3);
-     static Vector zAxis(3);
+     static thread_local Vector xAxis(3);
+     static thread_local Vector yAxis(3);
+     static thread_local Vector zAxis(3);
      
      theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
                         
@@ -89,11 +89,11 @@ class ElasticBeamWarping3d : public Element
 
     double rho;
 
-    static Matrix K;
-    static Vector P;
+    static thread_local Matrix K;
+    static thread_local Vector P;
     Vector Q;
     
-    static Matrix kb;
+    static thread_local Matrix kb;
     Vector q;
     double q0[5];  // Fixed end forces in basic system (no torsion)
     double p0[5];  // Reactions in basic system (no torsion)
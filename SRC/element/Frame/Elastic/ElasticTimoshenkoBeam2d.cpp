@@ -52,8 +52,8 @@
 
 
 // initialize the class wide variables
-Matrix ElasticTimoshenkoBeam2d::theMatrix(6,6);
-Vector ElasticTimoshenkoBeam2d::theVector(6);
+thread_local Matrix ElasticTimoshenkoBeam2d::theMatrix(6,6);
+thread_local Vector ElasticTimoshenkoBeam2d::theVector(6);
 
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ElasticTimoshenkoBeam2d)
@@ -339,13 +339,13 @@ const Matrix& ElasticTimoshenkoBeam2d::getTangentStiff()
         
     } else  {
         // initialize local stiffness matrix
-        static Matrix klTot(6,6);
+        static thread_local Matrix klTot(6,6);
         klTot.addMatrix(0.0, kl, 1.0);
         
         // get global trial displacements
         const Vector &dsp1 = theNodes[0]->getTrialDisp();
         const Vector &dsp2 = theNodes[1]->getTrialDisp();
-        static Vector ug(6);
+        static thread_local Vector ug(6);
         for (int i=0; i<3; i++)  {
             ug(i)   = dsp1(i);
             ug(i+3) = dsp2(i);
@@ -432,7 +432,7 @@ int ElasticTimoshenkoBeam2d::addInertiaLoadToUnbalance(const Vector &accel)
     // assemble Raccel vector
     const Vector &Raccel1 = theNodes[0]->getRV(accel);
     const Vector &Raccel2 = theNodes[1]->getRV(accel);
-    static Vector Raccel(6);
+    static thread_local Vector Raccel(6);
     for (int i=0; i<3; i++)  {
         Raccel(i)   = Raccel1(i);
         Raccel(i+3) = Raccel2(i);
@@ -453,7 +453,7 @@ const Vector& ElasticTimoshenkoBeam2d::getResistingForce()
     // get global trial displacements
     const Vector &dsp1 = theNodes[0]->getTrialDisp();
     const Vector &dsp2 = theNodes[1]->getTrialDisp();
-    static Vector ug(6);
+    static thread_local Vector ug(6);
     for (int i=0; i<3; i++)  {
         ug(i)   = dsp1(i);
         ug(i+3) = dsp2(i);
@@ -501,7 +501,7 @@ const Vector& ElasticTimoshenkoBeam2d::getResistingForceIncInertia()
     // add inertia forces from element mass
     const Vector &accel1 = theNodes[0]->getTrialAccel();
     const Vector &accel2 = theNodes[1]->getTrialAccel();
-    static Vector accel(6);
+    static thread_local Vector accel(6);
     for (int i=0; i<3; i++)  {
         accel(i)   = accel1(i);
         accel(i+3) = accel2(i);
@@ -516,7 +516,7 @@ int ElasticTimoshenkoBeam2d::sendSelf(int commitTag, Channel &sChannel)
 {
     int res = 0;
     
-    static Vector data(16);
+    static thread_local Vector data(16);
     data(0) = this->getTag();
     data(1) = connectedExternalNodes(0);
     data(2) = connectedExternalNodes(1);
@@ -564,7 +564,7 @@ int ElasticTimoshenkoBeam2d::recvSelf(int commitTag, Channel &rChannel,
 {
     int res = 0;
     
-    static Vector data(16);
+    static thread_local Vector data(16);
     res += rChannel.recvVector(this->getDbTag(), commitTag, data);
     if (res < 0) {
         opserr << "ElasticTimoshenkoBeam2d::recvSelf() - could not receive data Vector.\n";
@@ -788,7 +788,7 @@ int ElasticTimoshenkoBeam2d::updateParameter (int parameterID,
 void ElasticTimoshenkoBeam2d::setUp()
 {
     // element projection
-    static Vector dx(2);
+    static thread_local Vector dx(2);
     
     const Vector &ndICoords = theNodes[0]->getCrds();
     const Vector &ndJCoords = theNodes[1]->getCrds();
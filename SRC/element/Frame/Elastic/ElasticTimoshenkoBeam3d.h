@@ -125,8 +125,8 @@ private:
     Matrix Ki;   // initial stiffness matrix in global system
     Matrix M;    // mass matrix in global system
     
-    static Matrix theMatrix;  // a class wide Matrix
-    static Vector theVector;  // a class wide Vector
+    static thread_local Matrix theMatrix;  // a class wide Matrix
+    static thread_local Vector theVector;  // a class wide Vector
     Vector theLoad;
 };
 
@@ -44,9 +44,9 @@
 #include <math.h>
 #include <stdlib.h>
 
-Matrix ModElasticBeam2d::K(6,6);
-Vector ModElasticBeam2d::P(6);
-Matrix ModElasticBeam2d::kb(3,3);
+thread_local Matrix ModElasticBeam2d::K(6,6);
+thread_local Vector ModElasticBeam2d::P(6);
+thread_local Matrix ModElasticBeam2d::kb(3,3);
 
 
 static int numModElasticBeam2d = 0;
@@ -390,7 +390,7 @@ ModElasticBeam2d::getMass(void)
             K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(6,6);
+            static thread_local Matrix ml(6,6);
             double m = rho*L/420.0;
             ml(0,0) = ml(3,3) = m*140.0;
             ml(0,3) = ml(3,0) = m*70.0;
@@ -547,7 +547,7 @@ ModElasticBeam2d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(4) -= m * Raccel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(6);
+    static thread_local Vector Raccel(6);
     for (int i=0; i<3; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+3) = Raccel2(i);
@@ -589,7 +589,7 @@ ModElasticBeam2d::getResistingForceIncInertia()
     P(4) += m * accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    static thread_local Vector accel(6);
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -639,7 +639,7 @@ ModElasticBeam2d::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-    static Vector data(19);
+    static thread_local Vector data(19);
     
     data(0) = A;
     data(1) = E; 
@@ -693,7 +693,7 @@ ModElasticBeam2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theB
 {
     int res = 0;
 	
-    static Vector data(19);
+    static thread_local Vector data(19);
 
     res += theChannel.recvVector(this->getDbTag(), cTag, data);
     if (res < 0) {
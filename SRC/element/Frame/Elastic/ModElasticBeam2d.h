@@ -93,11 +93,11 @@ class ModElasticBeam2d : public Element
     double rho;          // mass per unit length
     int cMass;           // consistent mass flag
     
-    static Matrix K;
-    static Vector P;
+    static thread_local Matrix K;
+    static thread_local Vector P;
     Vector Q;
     
-    static Matrix kb;
+    static thread_local Matrix kb;
     Vector q;
     double q0[3];  // Fixed end forces in basic system
     double p0[3];  // Reactions in basic system
@@ -42,9 +42,9 @@
 #include <stdlib.h>
 #include <string>
 
-Matrix ModElasticBeam3d::K(12, 12);
-Vector ModElasticBeam3d::P(12);
-Matrix ModElasticBeam3d::kb(6, 6);
+thread_local Matrix ModElasticBeam3d::K(12, 12);
+thread_local Vector ModElasticBeam3d::P(12);
+thread_local Matrix ModElasticBeam3d::kb(6, 6);
 
 void *OPS_ADD_RUNTIME_VPV(OPS_ModElasticBeam3d) {
   int numArgs = OPS_GetNumRemainingInputArgs();
@@ -386,7 +386,7 @@ const Matrix &ModElasticBeam3d::getMass(void) {
       K(8, 8) = m;
     } else {
       // consistent mass matrix
-      static Matrix ml(12, 12);
+      static thread_local Matrix ml(12, 12);
       double m = rho * L / 420.0;
       ml(0, 0) = ml(6, 6) = m * 140.0;
       ml(0, 6) = ml(6, 0) = m * 70.0;
@@ -594,7 +594,7 @@ int ModElasticBeam3d::addInertiaLoadToUnbalance(const Vector &accel) {
     Q(8) -= m * Raccel2(2);
   } else {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    static thread_local Vector Raccel(12);
     for (int i = 0; i < 6; i++) {
       Raccel(i) = Raccel1(i);
       Raccel(i + 6) = Raccel2(i);
@@ -633,7 +633,7 @@ const Vector &ModElasticBeam3d::getResistingForceIncInertia() {
     P(8) += m * accel2(2);
   } else {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    static thread_local Vector accel(12);
     for (int i = 0; i < 6; i++) {
       accel(i) = accel1(i);
       accel(i + 6) = accel2(i);
@@ -690,7 +690,7 @@ const Vector &ModElasticBeam3d::getResistingForce() {
 int ModElasticBeam3d::sendSelf(int cTag, Channel &theChannel) {
   int res = 0;
 
-  static Vector data(22);
+  static thread_local Vector data(22);
 
   int indx = 0;
 
@@ -746,7 +746,7 @@ int ModElasticBeam3d::sendSelf(int cTag, Channel &theChannel) {
 int ModElasticBeam3d::recvSelf(int cTag, Channel &theChannel,
                                FEM_ObjectBroker &theBroker) {
   int res = 0;
-  static Vector data(22);
+  static thread_local Vector data(22);
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -830,9 +830,9 @@ void ModElasticBeam3d::Print(OPS_Stream &s, int flag) {
   else if (flag == 2) {
     this->getResistingForce(); // in case linear algo
 
-    static Vector xAxis(3);
-    static Vector yAxis(3);
-    static Vector zAxis(3);
+    static thread_local Vector xAxis(3);
+    static thread_local Vector yAxis(3);
+    static thread_local Vector zAxis(3);
 
     theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -1040,11 +1040,11 @@ int ModElasticBeam3d::getResponse(int responseID, Information &eleInfo) {
   double N, V, M1, M2, T;
   double L = theCoordTransf->getInitialLength();
   double oneOverL = 1.0 / L;
-  static Vector Sd(3);
-  static Vector Res(12);
+  static thread_local Vector Sd(3);
+  static thread_local Vector Res(12);
   Res = this->getResistingForce();
-  static Vector s(6);
-  static Matrix kb(6, 6);
+  static thread_local Vector s(6);
+  static thread_local Matrix kb(6, 6);
 
   switch (responseID) {
   case 1: // stiffness
@@ -91,11 +91,11 @@ private:
   double rho;
   int cMass;
 
-  static Matrix K;
-  static Vector P;
+  static thread_local Matrix K;
+  static thread_local Vector P;
   Vector Q;
 
-  static Matrix kb;
+  static thread_local Matrix kb;
   Vector q;
   double q0[5]; // Fixed end forces in basic system (no torsion)
   double p0[5]; // Reactions in basic system (no torsion)
@@ -36,9 +36,9 @@ Written by: Quan Gu_1,  Yongdou Liu_1, Wei Guo_23, Weiquan Li_1, Zhiwu Yu_23, Li
 #include <iostream>
 using namespace std;
 
-Vector WheelRail::contactData(7);
-Vector WheelRail::localActiveForce(5);
-Vector WheelRail::activeData(7);
+thread_local Vector WheelRail::contactData(7);
+thread_local Vector WheelRail::localActiveForce(5);
+thread_local Vector WheelRail::activeData(7);
 
 WheelRail::WheelRail(int pTag, 
 		     double pDeltT, 
@@ -128,9 +128,9 @@ class WheelRail : public Element
     Vector * theDeltaYList;
     Vector * theDeltaYLocationList;
     
-    static Vector contactData;
-    static Vector localActiveForce;
-    static Vector activeData;
+    static thread_local Vector contactData;
+    static thread_local Vector localActiveForce;
+    static thread_local Vector activeData;
 
 };
 
@@ -318,7 +318,7 @@ EulerDeltaFrame3d::getIntegral(Field field, State state, double& total)
 const Vector &
 EulerDeltaFrame3d::getResistingForce()
 {
-  static Vector wrap(p);
+  static thread_local Vector wrap(p);
   return wrap;
 }
 
@@ -382,7 +382,7 @@ EulerDeltaFrame3d::getTangentStiff()
 //q[4] += q0[4];
 
 
-  static Matrix wrapper(kb);
+  static thread_local Matrix wrapper(kb);
 
   return wrapper;
 }
@@ -669,8 +669,8 @@ EulerDeltaFrame3d::getResponse(int responseID, Information &info)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
     // TODO(cmp)
 //  const Matrix &kb = this->getInitialBasicStiff();
 //  kb.Solve(q, ve);
@@ -806,7 +806,7 @@ EulerDeltaFrame3d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static Vector data(16);
+  static thread_local Vector data(16);
   data(0)            = this->getTag();
   data(1)            = connectedExternalNodes(0);
   data(2)            = connectedExternalNodes(1);
@@ -901,7 +901,7 @@ EulerDeltaFrame3d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static Vector data(16);
+  static thread_local Vector data(16);
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0) {
     opserr << "EulerDeltaFrame3d::recvSelf() - failed to recv data Vector\n";
@@ -407,7 +407,7 @@ EulerFrame3d::sendSelf(int commitTag, Channel &theChannel)
   int dbTag = this->getDbTag();
   int loc = 0;
   
-  static Vector data(14);
+  static thread_local Vector data(14);
   data(0) = this->getTag();
   data(1) = connectedExternalNodes(0);
   data(2) = connectedExternalNodes(1);
@@ -501,7 +501,7 @@ EulerFrame3d::recvSelf(int commitTag, Channel &theChannel,
   //
   int dbTag = this->getDbTag();
 
-  static Vector data(14);
+  static thread_local Vector data(14);
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0)  {
     opserr << "EulerFrame3d::recvSelf() - failed to recv data Vector\n";
@@ -1033,8 +1033,8 @@ EulerFrame3d::getResponse(int responseID, Information &info)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
     auto kb = this->getBasicTangent(State::Init, 0);
     kb.solve(q, ve);
     vp = theCoordTransf->getBasicTrialDisp();
@@ -1240,7 +1240,7 @@ EulerFrame3d::getResistingForceSensitivity(int gradNumber)
   //
   // dAdh^T q + A^T (dqdh + k dAdh u)
   //
-  static Vector P(12);
+  static thread_local Vector P(12);
   P.Zero();
 
   VectorND<6> dqdh = this->getBasicForceGrad(gradNumber);
@@ -1248,7 +1248,7 @@ EulerFrame3d::getResistingForceSensitivity(int gradNumber)
   double jsx = 1.0/theCoordTransf->getInitialLength();
 
   // TODO: No distributed loads
-  static Vector dp0dh(6);   
+  static thread_local Vector dp0dh(6);   
 
   if (theCoordTransf->isShapeSensitivity()) {
     // k dAdh u
@@ -1273,7 +1273,7 @@ EulerFrame3d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = theCoordTransf->getBasicTrialDisp();
   
-  static Vector dvdh(6);
+  static thread_local Vector dvdh(6);
   dvdh = theCoordTransf->getBasicDisplTotalGrad(gradNumber);
   
   double L = theCoordTransf->getInitialLength();
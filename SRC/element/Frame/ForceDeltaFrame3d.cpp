@@ -2060,13 +2060,13 @@ ForceDeltaFrame3d::compSectionDisplacements(Vector sectionCoords[], Vector secti
 {
   int numSections = points.size();
   // get basic displacements and increments
-  static Vector ub(nq);
+  static thread_local Vector ub(nq);
   ub = theCoordTransf->getBasicTrialDisp();
 
   double L = theCoordTransf->getInitialLength();
 
   // get integration point positions and weights
-  static double xi_pts[maxNumSections];
+  static thread_local double xi_pts[maxNumSections];
   stencil->getSectionLocations(numSections, L, xi_pts);
 
   //
@@ -2079,7 +2079,7 @@ ForceDeltaFrame3d::compSectionDisplacements(Vector sectionCoords[], Vector secti
 
   // get section curvatures
   Vector kappa(numSections); // curvature
-  static Vector vs;          // section deformations
+  static thread_local Vector vs;          // section deformations
 
   for (int i = 0; i < numSections; i++) {
     // THIS IS VERY INEFFICIENT ... CAN CHANGE LATER
@@ -2469,7 +2469,7 @@ ForceDeltaFrame3d::setResponse(const char** argv, int argc, OPS_Stream& output)
 int
 ForceDeltaFrame3d::getResponse(int responseID, Information& info)
 {
-  static Vector vp(6);
+  static thread_local Vector vp(6);
 
   if (responseID == 1)
     return info.setVector(this->getResistingForce());
@@ -2529,11 +2529,11 @@ ForceDeltaFrame3d::getResponse(int responseID, Information& info)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Matrix fe(6, 6);
+    static thread_local Matrix fe(6, 6);
     this->getInitialFlexibility(fe);
     vp = theCoordTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, q_pres, -1.0);
-    static Vector v0(6);
+    static thread_local Vector v0(6);
     this->getInitialDeformations(v0);
     vp.addVector(1.0, v0, -1.0);
     return info.setVector(vp);
@@ -2597,7 +2597,7 @@ ForceDeltaFrame3d::getResponse(int responseID, Information& info)
 
     d3 += stencil->getTangentDriftJ(L, LI, q_pres[1], q_pres[2]);
 
-    static Vector d(2);
+    static thread_local Vector d(2);
     d(0) = d2;
     d(1) = d3;
 
@@ -2688,8 +2688,8 @@ ForceDeltaFrame3d::getResponse(int responseID, Information& info)
     dispsy.addMatrixVector(0.0, ls, kappaz, 1.0);
     dispsz.addMatrixVector(0.0, ls, kappay, 1.0);
     stencil->getSectionLocations(numSections, L, pts);
-    static Vector uxb(3);
-    static Vector uxg(3);
+    static thread_local Vector uxb(3);
+    static thread_local Vector uxg(3);
     Matrix disps(numSections, 3);
     vp = theCoordTransf->getBasicTrialDisp();
     for (int i = 0; i < numSections; i++) {
@@ -2734,8 +2734,8 @@ ForceDeltaFrame3d::getResponse(int responseID, Information& info)
     Vector dispsz(20); // along local z
     dispsy.addMatrixVector(0.0, ls, kappaz, 1.0);
     dispsz.addMatrixVector(0.0, ls, kappay, 1.0);
-    static Vector uxb(3);
-    static Vector uxg(3);
+    static thread_local Vector uxb(3);
+    static thread_local Vector uxg(3);
     Matrix disps(20, 3);
     vp = theCoordTransf->getBasicTrialDisp();
     for (int i = 0; i < 20; i++) {
@@ -2764,7 +2764,7 @@ ForceDeltaFrame3d::getResponseSensitivity(int responseID, int igrad, Information
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(6);
+    static thread_local Vector dqdh(6);
 
     const Vector& dvdh = theCoordTransf->getBasicDisplTotalGrad(igrad);
 
@@ -2788,7 +2788,7 @@ ForceDeltaFrame3d::getResponseSensitivity(int responseID, int igrad, Information
       this->getStressGrad(dsdh, sectionNum - 1, igrad);
     }
 
-    static Vector dqdh(nq);
+    static thread_local Vector dqdh(nq);
     const Vector& dvdh = theCoordTransf->getBasicDisplTotalGrad(igrad);
 
     dqdh.addMatrixVector(0.0, K_pres, dvdh, 1.0);
@@ -2917,20 +2917,20 @@ ForceDeltaFrame3d::getResponseSensitivity(int responseID, int igrad, Information
 
   // Plastic deformation sensitivity
   else if (responseID == 4) {
-    static Vector dvpdh(6);
+    static thread_local Vector dvpdh(6);
 
     const Vector& dvdh = theCoordTransf->getBasicDisplTotalGrad(igrad);
 
     dvpdh = dvdh;
 
-    static Matrix fe(6, 6);
+    static thread_local Matrix fe(6, 6);
     this->getInitialFlexibility(fe);
 
     const Vector& dqdh = this->getBasicForceGrad(igrad);
 
     dvpdh.addMatrixVector(1.0, fe, dqdh, -1.0);
 
-    static Matrix fek(6, 6);
+    static thread_local Matrix fek(6, 6);
     fek.addMatrixProduct(0.0, fe, K_pres, 1.0);
 
     dvpdh.addMatrixVector(1.0, fek, dvdh, -1.0);
@@ -3055,7 +3055,7 @@ const Matrix&
 ForceDeltaFrame3d::getKiSensitivity(int igrad)
 {
   static MatrixND<12,12> dKi{};
-  static Matrix wrapper(dKi);
+  static thread_local Matrix wrapper(dKi);
   return wrapper;
 }
 
@@ -3063,7 +3063,7 @@ const Matrix&
 ForceDeltaFrame3d::getMassSensitivity(int igrad)
 {
   static MatrixND<12,12> dM{};
-  static Matrix wrapper(dM);
+  static thread_local Matrix wrapper(dM);
   return wrapper;
 }
 
@@ -3083,7 +3083,7 @@ ForceDeltaFrame3d::getResistingForceSensitivity(int igrad)
   this->addReactionGrad(dp0dh, igrad);
   Vector dp0dhVec(dp0dh, 3);
 
-  static Vector P(12);
+  static thread_local Vector P(12);
   P.Zero();
 
   if (theCoordTransf->isShapeSensitivity()) {
@@ -3122,7 +3122,7 @@ ForceDeltaFrame3d::commitSensitivity(int igrad, int numGrads)
 
   double d1oLdh = theCoordTransf->getd1overLdh();
 
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh = this->getBasicForceGrad(igrad);
 
   // dvdh = A dudh + dAdh u
@@ -3272,7 +3272,7 @@ ForceDeltaFrame3d::getBasicForceGrad(int igrad)
 
   double d1oLdh = theCoordTransf->getd1overLdh();
 
-  static Vector dvdh(nq);
+  static thread_local Vector dvdh(nq);
   dvdh.Zero();
 
   Vector kappa(numSections);
@@ -3407,7 +3407,7 @@ const Matrix&
 ForceDeltaFrame3d::computedfedh(int igrad)
 {
   int numSections = points.size();
-  static Matrix dfedh(6, 6);
+  static thread_local Matrix dfedh(6, 6);
 
   dfedh.Zero();
 
@@ -3535,7 +3535,7 @@ ForceDeltaFrame3d::sendSelf(int commitTag, Channel& theChannel)
   int dbTag = this->getDbTag();
   int loc = 0;
 
-  static ID idData(11); // one bigger than needed so no clash later
+  static thread_local ID idData(11); // one bigger than needed so no clash later
   idData(0) = this->getTag();
   idData(1) = connectedExternalNodes(0);
   idData(2) = connectedExternalNodes(1);
@@ -3669,7 +3669,7 @@ ForceDeltaFrame3d::recvSelf(int commitTag, Channel& theChannel, FEM_ObjectBroker
   int dbTag = this->getDbTag();
   int i, j, k;
 
-  static ID idData(11); // one bigger than needed
+  static thread_local ID idData(11); // one bigger than needed
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0) {
     opserr << "ForceDeltaFrame3d::recvSelf() - failed to recv ID data\n";
@@ -3981,10 +3981,10 @@ ForceDeltaFrame3d::getInitialStiff()
   if (Ki != nullptr)
     return *Ki;
 
-  static Matrix f(nq, nq);   // element flexibility matrix  
+  static thread_local Matrix f(nq, nq);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
-  static Matrix kvInit(nq, nq);
+  static thread_local Matrix kvInit(nq, nq);
   f.Invert(kvInit);
   Ki = new Matrix(theCoordTransf->getInitialGlobalStiffMatrix(kvInit));
 
@@ -1850,7 +1850,7 @@ ForceFrame3d::Print(OPS_Stream& s, int flag)
   // flag set to 2 used for viewing data with UCSD renderer
   //
   else if (flag == 2) {
-    static Vector xAxis(3), yAxis(3), zAxis(3);
+    static thread_local Vector xAxis(3), yAxis(3), zAxis(3);
     theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
     s << "#ForceFrame3D\n";
@@ -2314,8 +2314,8 @@ ForceFrame3d::getResponse(int responseID, Information& info)
     dispsy.addMatrixVector(0.0, ls, kappaz, 1.0);
     dispsz.addMatrixVector(0.0, ls, kappay, -1.0);
     stencil->getSectionLocations(numSections, L, pts);
-    static Vector uxb(3);
-    static Vector uxg(3);
+    static thread_local Vector uxb(3);
+    static thread_local Vector uxg(3);
     Matrix disps(numSections, 3);
     vp = theCoordTransf->getBasicTrialDisp();
     for (int i = 0; i < numSections; i++) {
@@ -2363,8 +2363,8 @@ ForceFrame3d::getResponse(int responseID, Information& info)
     Vector dispsz(20); // along local z
     dispsy.addMatrixVector(0.0, ls, kappaz, 1.0);
     dispsz.addMatrixVector(0.0, ls, kappay, -1.0);
-    static Vector uxb(3);
-    static Vector uxg(3);
+    static thread_local Vector uxb(3);
+    static thread_local Vector uxg(3);
     Matrix disps(20, 3);
     vp = theCoordTransf->getBasicTrialDisp();
     for (int i = 0; i < 20; i++) {
@@ -2384,7 +2384,7 @@ ForceFrame3d::getResponse(int responseID, Information& info)
 
   // Point of inflection
   else if (responseID == 5) {
-    static Vector LI(2);
+    static thread_local Vector LI(2);
     LI(0) = 0.0;
     LI(1) = 0.0;
 
@@ -2474,7 +2474,7 @@ ForceFrame3d::getResponse(int responseID, Information& info)
     d3z += stencil->getTangentDriftJ(L, LIz, q_pres[1], q_pres[2]);
     d3y += stencil->getTangentDriftJ(L, LIy, q_pres[3], q_pres[4], true);
 
-    static Vector d(4);
+    static thread_local Vector d(4);
     d(0) = d2z;
     d(1) = d3z;
     d(2) = d2y;
@@ -2596,7 +2596,7 @@ ForceFrame3d::getResponse(int responseID, Information& info)
         indata.close();
       }
 
-      static Vector result8(2);
+      static thread_local Vector result8(2);
       result8(0) = value;
       result8(1) = checkvalue1;
 
@@ -2632,7 +2632,7 @@ ForceFrame3d::getResponseSensitivity(int responseID, int gradNumber, Information
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(6);
+    static thread_local Vector dqdh(6);
     dqdh.Zero();
 
     const Vector& dvdh = theCoordTransf->getBasicDisplTotalGrad(gradNumber);
@@ -2656,7 +2656,7 @@ ForceFrame3d::getResponseSensitivity(int responseID, int gradNumber, Information
     if (eleLoads.size() > 0)
       this->getStressGrad(dsdh, sectionNum - 1, gradNumber);
 
-    static Vector dqdh(6);
+    static thread_local Vector dqdh(6);
     {
       // Response 7
       const Vector& dvdh = theCoordTransf->getBasicDisplTotalGrad(gradNumber);
@@ -2714,7 +2714,7 @@ ForceFrame3d::getResponseSensitivity(int responseID, int gradNumber, Information
 
   // Plastic deformation sensitivity
   else if (responseID == 4) {
-    static Vector dvpdh(6);
+    static thread_local Vector dvpdh(6);
 
     const Vector& dvdh = theCoordTransf->getBasicDisplTotalGrad(gradNumber);
 
@@ -2883,7 +2883,7 @@ ForceFrame3d::getMassSensitivity(int gradNumber)
 const Vector&
 ForceFrame3d::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector P(12);
+  static thread_local Vector P(12);
   P.Zero();
 
   VectorND<NBV> dqdh = this->getBasicForceGrad(gradNumber);
@@ -3030,7 +3030,7 @@ ForceFrame3d::getBasicForceGrad(int gradNumber)
   //
   // Integrate dvdh
   //
-  static Vector dvdh(6);
+  static thread_local Vector dvdh(6);
   dvdh.Zero();
   for (int i = 0; i < numSections; i++) {
 
@@ -3151,7 +3151,7 @@ ForceFrame3d::getBasicForceGrad(int gradNumber)
 const Matrix&
 ForceFrame3d::computedfedh(int gradNumber)
 {
-  static Matrix dfedh(6, 6);
+  static thread_local Matrix dfedh(6, 6);
 
   dfedh.Zero();
 
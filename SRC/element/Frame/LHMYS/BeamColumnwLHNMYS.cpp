@@ -41,9 +41,9 @@
 #include <ElementIter.h>
 #include <iostream>
 
-Matrix BeamColumnwLHNMYS::K(6,6);
-Vector BeamColumnwLHNMYS::P(6);
-Matrix BeamColumnwLHNMYS::k(3,3);
+thread_local Matrix BeamColumnwLHNMYS::K(6,6);
+thread_local Vector BeamColumnwLHNMYS::P(6);
+thread_local Matrix BeamColumnwLHNMYS::k(3,3);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_BeamColumnwLHNMYS)
 {
@@ -367,28 +367,28 @@ BeamColumnwLHNMYS::update(void)
     double mLoverEI6 = -LoverEI3/2.0;   // -L/(6EI)
     
     // elastic stiffness matrix
-    static Matrix ke(3,3);
+    static thread_local Matrix ke(3,3);
     ke.Zero();
     ke(0,0) = EAoverL;
     ke(1,1) = ke(2,2) = EIoverL4;
     ke(2,1) = ke(1,2) = EIoverL2;
     
     // elastic flexibility matrix
-    static Matrix fe(3,3);
+    static thread_local Matrix fe(3,3);
     fe.Zero();
     fe(0,0) = LoverEA;
     fe(1,1) = fe(2,2) = LoverEI3;
     fe(2,1) = fe(1,2) = mLoverEI6;
     
     // kinematic hardening matrix
-    static Matrix Hk(3,3);
+    static thread_local Matrix Hk(3,3);
     Hk.Zero();
     Hk(0,0) = EAoverL*Hkr(0);
     Hk(1,1) = 6.0*EIoverL*Hkr(1);
     Hk(2,2) = 6.0*EIoverL*Hkr(2);
     
     // isotropic hardening matrix
-    static Matrix Hi(2,2);
+    static thread_local Matrix Hi(2,2);
     Hi.Zero();
     Hi(0,0) = Hir(0);
     Hi(1,1) = Hir(1);
@@ -399,9 +399,9 @@ BeamColumnwLHNMYS::update(void)
     Vector qb(qbpast);
 
     // trial elastic step
-    static Vector vmvp(3);
+    static thread_local Vector vmvp(3);
     vmvp = v - vp;
-    static Vector qtr(3);
+    static thread_local Vector qtr(3);
     qtr = ke*vmvp;
     Vector xyrefI(2), xyrefJ(2);
     Vector ScVecI(2), ScVecJ(2);
@@ -713,7 +713,7 @@ BeamColumnwLHNMYS::getInitialStiff(void)
     double EIoverL4 = 2.0*EIoverL2;                // 4EI/L
     
     // elastic stiffness matrix
-    static Matrix ke(3,3);
+    static thread_local Matrix ke(3,3);
     ke.Zero();
     ke(0,0) = EAoverL;
     ke(1,1) = ke(2,2) = EIoverL4;
@@ -736,7 +736,7 @@ BeamColumnwLHNMYS::getMass(void)
             K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
         } else  {
             // consistent mass matrix
-            static Matrix ml(6,6);
+            static thread_local Matrix ml(6,6);
             double m = rho*L/420.0;
             ml(0,0) = ml(3,3) = m*140.0;
             ml(0,3) = ml(3,0) = m*70.0;
@@ -897,7 +897,7 @@ BeamColumnwLHNMYS::addInertiaLoadToUnbalance(const Vector &accel)
     Q(4) -= m * Raccel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(6);
+    static thread_local Vector Raccel(6);
     for (int i=0; i<3; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+3) = Raccel2(i);
@@ -939,7 +939,7 @@ BeamColumnwLHNMYS::getResistingForceIncInertia()
     P(4) += m * accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    static thread_local Vector accel(6);
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -1028,9 +1028,9 @@ BeamColumnwLHNMYS::Print(OPS_Stream &s, int flag)
 int
 BeamColumnwLHNMYS::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector vp(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector vp(3);
 
   theNodes[0]->getDisplayCrds(v1, fact);
   theNodes[1]->getDisplayCrds(v2, fact);
@@ -1082,7 +1082,7 @@ BeamColumnwLHNMYS::displaySelf(Renderer &theViewer, int displayMode, float fact,
 
       d1 = q(1);
       d2 = q(2);
-      static Vector delta(3); delta = v2-v1; delta/=20.;
+      static thread_local Vector delta(3); delta = v2-v1; delta/=20.;
       res += theViewer.drawPoint(v1+delta, d1, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d2, this->getTag(), i);
 
@@ -1090,7 +1090,7 @@ BeamColumnwLHNMYS::displaySelf(Renderer &theViewer, int displayMode, float fact,
       d1 = q(0);
       d2 = q(1);
       d3 = q(2);
-      static Vector delta(3); delta = v2-v1; delta/=20;
+      static thread_local Vector delta(3); delta = v2-v1; delta/=20;
       res += theViewer.drawPoint(v1+delta, d2, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d3, this->getTag(), i);
       res +=theViewer.drawLine(v1, v2, d1, d1, this->getTag(), i);
@@ -1103,7 +1103,7 @@ BeamColumnwLHNMYS::displaySelf(Renderer &theViewer, int displayMode, float fact,
 
       d1 = vp(1);
       d2 = vp(2);
-      static Vector delta(3); delta = v2-v1; delta/=20.;
+      static thread_local Vector delta(3); delta = v2-v1; delta/=20.;
       res += theViewer.drawPoint(v1+delta, d1, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d2, this->getTag(), i);
 
@@ -1111,7 +1111,7 @@ BeamColumnwLHNMYS::displaySelf(Renderer &theViewer, int displayMode, float fact,
       d1 = vp(0);
       d2 = vp(1);
       d3 = vp(2);
-      static Vector delta(3); delta = v2-v1; delta/=20;
+      static thread_local Vector delta(3); delta = v2-v1; delta/=20;
       res += theViewer.drawPoint(v1+delta, d2, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d3, this->getTag(), i);
       res +=theViewer.drawLine(v1, v2, d1, d1, this->getTag(), i);
@@ -1120,7 +1120,7 @@ BeamColumnwLHNMYS::displaySelf(Renderer &theViewer, int displayMode, float fact,
       d1 = 0.;
       d2 = 0.;
       d3 = 0.;
-      static Vector delta(3); delta = v2-v1; delta/=20;
+      static thread_local Vector delta(3); delta = v2-v1; delta/=20;
       res += theViewer.drawPoint(v1+delta, d2, this->getTag(), i);
       res += theViewer.drawPoint(v2-delta, d3, this->getTag(), i);
       res +=theViewer.drawLine(v1, v2, d1, d1, this->getTag(), i);
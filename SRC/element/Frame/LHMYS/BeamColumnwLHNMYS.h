@@ -101,11 +101,11 @@ class BeamColumnwLHNMYS : public Element
     Vector Hir;                 // isotropic hardening ratio for flexural end i and end j (default [0;0])
     Vector Hkr;                 // kinematic hardening ratio for axial, flexural end i and end j (default [0;0;0])
 
-    static Matrix K;
-    static Vector P;
+    static thread_local Matrix K;
+    static thread_local Vector P;
     Vector Q;
     
-    static Matrix k;
+    static thread_local Matrix k;
     Vector q;
     double q0[3];  // Fixed end forces in basic system
     double p0[3];  // Reactions in basic system
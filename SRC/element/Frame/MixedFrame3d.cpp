@@ -74,8 +74,8 @@
 #include <TrapezoidalBeamIntegration.h>
 #include <RegularizedHingeIntegration.h>
 
-Matrix MixedFrame3d::theMatrix(NEGD, NEGD);
-Vector MixedFrame3d::theVector(NEGD);
+thread_local Matrix MixedFrame3d::theMatrix(NEGD, NEGD);
+thread_local Vector MixedFrame3d::theVector(NEGD);
 Matrix MixedFrame3d::transformNaturalCoords(NDM_NATURAL_WITH_TORSION, NDM_NATURAL_WITH_TORSION);
 Matrix MixedFrame3d::transformNaturalCoordsT(NDM_NATURAL_WITH_TORSION, NDM_NATURAL_WITH_TORSION);
 
@@ -1643,10 +1643,10 @@ MixedFrame3d::getResponse(int responseID, Information& info)
     dispsy.addMatrixVector(0.0, ls, kappaz, 1.0);
     dispsz.addMatrixVector(0.0, ls, kappay, -1.0);
     beamIntegr->getSectionLocations(numSections, L, pts);
-    static Vector uxb(3);
-    static Vector uxg(3);
+    static thread_local Vector uxb(3);
+    static thread_local Vector uxg(3);
     Matrix disps(numSections, 3);
-    static Vector vp(6);
+    static thread_local Vector vp(6);
     vp = crdTransf->getBasicTrialDisp();
     for (int i = 0; i < numSections; i++) {
       uxb(0) = pts[i] * vp[0]; // linear shape function
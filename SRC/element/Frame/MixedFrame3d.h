@@ -156,8 +156,8 @@ private:
   //
   // Static data
   //
-  static Matrix theMatrix;
-  static Vector theVector;
+  static thread_local Matrix theMatrix;
+  static thread_local Vector theVector;
   static Matrix transformNaturalCoords;
   static Matrix transformNaturalCoordsT;
   // matrix to transform the natural coordinates from what the coordinate transformation uses and what the element uses
@@ -61,9 +61,9 @@ UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 #include <Parameter.h>
 
 // initialise the class wide variables
-Matrix AxEqDispBeamColumn2d::K(6, 6);
-Vector AxEqDispBeamColumn2d::P(6);
-double AxEqDispBeamColumn2d::workArea[100];
+thread_local Matrix AxEqDispBeamColumn2d::K(6, 6);
+thread_local Vector AxEqDispBeamColumn2d::P(6);
+thread_local double AxEqDispBeamColumn2d::workArea[100];
 
 static int numMyDBEle = 0;
 
@@ -859,7 +859,7 @@ AxEqDispBeamColumn2d::getBasicStiff(Matrix &kb, int initial)
 const Matrix &
 AxEqDispBeamColumn2d::getTangentStiff()
 {
-  static Matrix kb(3, 3);
+  static thread_local Matrix kb(3, 3);
 
   //opserr << "I am here 2" << endln;
 
@@ -927,7 +927,7 @@ AxEqDispBeamColumn2d::getTangentStiff()
 const Matrix &
 AxEqDispBeamColumn2d::getInitialBasicStiff()
 {
-  static Matrix kb(3, 3);
+  static thread_local Matrix kb(3, 3);
 
   // Zero for integral
   kb.Zero();
@@ -1030,7 +1030,7 @@ AxEqDispBeamColumn2d::getMass()
     K(0, 0) = K(1, 1) = K(3, 3) = K(4, 4) = m;
   } else {
     // consistent mass matrix
-    static Matrix ml(6, 6);
+    static thread_local Matrix ml(6, 6);
     double m = rho * L / 420.0;
     ml(0, 0) = ml(3, 3) = m * 140.0;
     ml(0, 3) = ml(3, 0) = m * 70.0;
@@ -1162,7 +1162,7 @@ AxEqDispBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(4) -= m * Raccel2(1);
   } else {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(6);
+    static thread_local Vector Raccel(6);
     for (int i = 0; i < 3; i++) {
       Raccel(i)     = Raccel1(i);
       Raccel(i + 3) = Raccel2(i);
@@ -1261,7 +1261,7 @@ AxEqDispBeamColumn2d::getResistingForceIncInertia()
       P(4) += m * accel2(1);
     } else {
       // use matrix vector multip. for consistent mass matrix
-      static Vector accel(6);
+      static thread_local Vector accel(6);
       for (int i = 0; i < 3; i++) {
         accel(i)     = accel1(i);
         accel(i + 3) = accel2(i);
@@ -1293,7 +1293,7 @@ AxEqDispBeamColumn2d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static Vector data(14);
+  static thread_local Vector data(14);
   data(0)            = this->getTag();
   data(1)            = connectedExternalNodes(0);
   data(2)            = connectedExternalNodes(1);
@@ -1388,7 +1388,7 @@ AxEqDispBeamColumn2d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static Vector data(14);
+  static thread_local Vector data(14);
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0) {
     opserr << "AxEqDispBeamColumn2d::recvSelf() - failed to recv data Vector\n";
@@ -1587,8 +1587,8 @@ int
 AxEqDispBeamColumn2d::displaySelf(Renderer &theViewer, int displayMode, float fact,
                                   const char **displayModes, int numModes)
 {
-  static Vector v1(3);
-  static Vector v2(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
 
   theNodes[0]->getDisplayCrds(v1, fact, displayMode);
   theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -1817,7 +1817,7 @@ AxEqDispBeamColumn2d::getResponse(int responseID, Information &eleInfo)
   }
 
   else if (responseID == 19) {
-    static Matrix kb(3, 3);
+    static thread_local Matrix kb(3, 3);
     this->getBasicStiff(kb);
     return eleInfo.setMatrix(kb);
   }
@@ -1829,8 +1829,8 @@ AxEqDispBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(3);
-    static Vector ve(3);
+    static thread_local Vector vp(3);
+    static thread_local Vector ve(3);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1923,7 +1923,7 @@ AxEqDispBeamColumn2d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 9) {
-    static Vector dqdh(3);
+    static thread_local Vector dqdh(3);
 
     dqdh.Zero();
 
@@ -2094,7 +2094,7 @@ AxEqDispBeamColumn2d::getMassSensitivity(int gradNumber)
     K(0, 0) = K(1, 1) = K(3, 3) = K(4, 4) = m;
   } else {
     // consistent mass matrix
-    static Matrix ml(6, 6);
+    static thread_local Matrix ml(6, 6);
     //double m = rho*L/420.0;
     double m = L / 420.0;
     ml(0, 0) = ml(3, 3) = m * 140.0;
@@ -2139,7 +2139,7 @@ AxEqDispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   beamInt->getWeightsDeriv(numSections, L, dLdh, dwtsdh);
 
   // Zero for integration
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh.Zero();
 
   // Loop over the integration points
@@ -2199,7 +2199,7 @@ AxEqDispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   }
 
   // Transform forces
-  static Vector dp0dh(3); // No distributed loads
+  static thread_local Vector dp0dh(3); // No distributed loads
 
   P.Zero();
 
@@ -2209,7 +2209,7 @@ AxEqDispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
 
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(3, 3);
+    static thread_local Matrix kbmine(3, 3);
     kbmine.Zero();
     q.Zero();
 
@@ -2303,7 +2303,7 @@ AxEqDispBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
 
-  static Vector dvdh(3);
+  static thread_local Vector dvdh(3);
   dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
   double L        = crdTransf->getInitialLength();
@@ -144,8 +144,8 @@ private:
 
 	Node *theNodes[2];
 
-	static Matrix K;		// Element stiffness, damping, and mass Matrix
-	static Vector P;		// Element resisting force vector
+	static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+	static thread_local Vector P;		// Element resisting force vector
 
 	Vector Q;      // Applied nodal loads
 	Vector q;      // Basic force
@@ -164,7 +164,7 @@ private:
 
 	enum { maxNumSections = 20 };
 
-	static double workArea[];
+	static thread_local double workArea[];
 
 	// AddingSensitivity:BEGIN //////////////////////////////////////////
 	int parameterID;
@@ -44,9 +44,9 @@
 #include <ElementalLoad.h>
 #include <string.h>
 
-Matrix DispBeamColumn2d::K(6,6);
-Vector DispBeamColumn2d::P(6);
-double DispBeamColumn2d::workArea[100];
+thread_local Matrix DispBeamColumn2d::K(6,6);
+thread_local Vector DispBeamColumn2d::P(6);
+thread_local double DispBeamColumn2d::workArea[100];
 
 DispBeamColumn2d::DispBeamColumn2d(int tag, int nd1, int nd2,
                                    int numSec, SectionForceDeformation **s,
@@ -375,7 +375,7 @@ DispBeamColumn2d::getBasicStiff(Matrix &kb, int initial)
 const Matrix&
 DispBeamColumn2d::getTangentStiff()
 {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
 
   this->getBasicStiff(kb);
 
@@ -437,7 +437,7 @@ DispBeamColumn2d::getTangentStiff()
 const Matrix&
 DispBeamColumn2d::getInitialBasicStiff()
 {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -539,7 +539,7 @@ DispBeamColumn2d::getMass()
     K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(6,6);
+    static thread_local Matrix ml(6,6);
     double m = rho*L/420.0;
     ml(0,0) = ml(3,3) = m*140.0;
     ml(0,3) = ml(3,0) = m*70.0;
@@ -668,7 +668,7 @@ DispBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(4) -= m*Raccel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(6);
+    static thread_local Vector Raccel(6);
     for (int i=0; i<3; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+3) = Raccel2(i);
@@ -762,7 +762,7 @@ DispBeamColumn2d::getResistingForceIncInertia()
     P(4) += m*accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    static thread_local Vector accel(6);
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -793,7 +793,7 @@ DispBeamColumn2d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static Vector data(14);
+  static thread_local Vector data(14);
   data(0) = this->getTag();
   data(1) = connectedExternalNodes(0);
   data(2) = connectedExternalNodes(1);
@@ -887,7 +887,7 @@ DispBeamColumn2d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static Vector data(14);
+  static thread_local Vector data(14);
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0)  {
     opserr << "DispBeamColumn2d::recvSelf() - failed to recv data Vector\n";
@@ -1326,7 +1326,7 @@ DispBeamColumn2d::getResponse(int responseID, Information &eleInfo)
   }
 
   else if (responseID == 19) {
-    static Matrix kb(3,3);
+    static thread_local Matrix kb(3,3);
     this->getBasicStiff(kb);
     return eleInfo.setMatrix(kb);
   }
@@ -1338,8 +1338,8 @@ DispBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(3);
-    static Vector ve(3);
+    static thread_local Vector vp(3);
+    static thread_local Vector ve(3);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1451,7 +1451,7 @@ DispBeamColumn2d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 9) {
-    static Vector dqdh(3);
+    static thread_local Vector dqdh(3);
 
     dqdh.Zero();
 
@@ -1606,7 +1606,7 @@ DispBeamColumn2d::activateParameter(int passedParameterID)
 const Matrix &
 DispBeamColumn2d::getInitialStiffSensitivity(int gradNumber)
 {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -1697,7 +1697,7 @@ DispBeamColumn2d::getMassSensitivity(int gradNumber)
     K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(6,6);
+    static thread_local Matrix ml(6,6);
     //double m = rho*L/420.0;    
     double m = L/420.0;
     ml(0,0) = ml(3,3) = m*140.0;
@@ -1744,7 +1744,7 @@ DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   beamInt->getWeightsDeriv(numSections, L, dLdh, dwtsdh);
 
   // Zero for integration
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh.Zero();
 
   // Loop over the integration points
@@ -1805,7 +1805,7 @@ DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   }
 
   // Transform forces
-  static Vector dp0dh(3);                // No distributed loads
+  static thread_local Vector dp0dh(3);                // No distributed loads
 
   P.Zero();
 
@@ -1815,7 +1815,7 @@ DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
 
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(3,3);
+    static thread_local Matrix kbmine(3,3);
     kbmine.Zero();
     q.Zero();
 
@@ -1911,7 +1911,7 @@ DispBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
 
-  static Vector dvdh(3);
+  static thread_local Vector dvdh(3);
   dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
   double L = crdTransf->getInitialLength();
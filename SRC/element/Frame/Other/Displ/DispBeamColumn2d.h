@@ -76,6 +76,7 @@ class DispBeamColumn2d : public Element
 
     const Vector &getResistingForce(void);
     const Vector &getResistingForceIncInertia(void);            
+    bool hasOnlyRayleighDamping() const {return true;}
 
     // public methods for element output
     int sendSelf(int commitTag, Channel &theChannel);
@@ -113,8 +114,8 @@ class DispBeamColumn2d : public Element
 
     Node *theNodes[2];
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
     Vector Q;      // Applied nodal loads
     Vector q;      // Basic force
@@ -126,7 +127,7 @@ class DispBeamColumn2d : public Element
 
     enum {maxNumSections = 20};
 
-    static double workArea[];
+    static thread_local double workArea[];
 
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
@@ -50,9 +50,9 @@
 #include <stdlib.h>
 #include <FiberSection2dThermal.h>
 
-Matrix DispBeamColumn2dThermal::K(6, 6);
-Vector DispBeamColumn2dThermal::P(6);
-double DispBeamColumn2dThermal::workArea[100];
+thread_local Matrix DispBeamColumn2dThermal::K(6, 6);
+thread_local Vector DispBeamColumn2dThermal::P(6);
+thread_local double DispBeamColumn2dThermal::workArea[100];
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_DispBeamColumn2dThermal)
@@ -466,7 +466,7 @@ DispBeamColumn2dThermal::update(void)
 const Matrix &
 DispBeamColumn2dThermal::getTangentStiff()
 {
-  static Matrix kb(3, 3);
+  static thread_local Matrix kb(3, 3);
 
   // Zero for integral
   kb.Zero();
@@ -571,7 +571,7 @@ DispBeamColumn2dThermal::getTangentStiff()
 const Matrix &
 DispBeamColumn2dThermal::getInitialBasicStiff()
 {
-  static Matrix kb(3, 3);
+  static thread_local Matrix kb(3, 3);
 
   // Zero for integral
   kb.Zero();
@@ -1283,7 +1283,7 @@ DispBeamColumn2dThermal::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static ID idData(7); // one bigger than needed so no clash later
+  static thread_local ID idData(7); // one bigger than needed so no clash later
   idData(0)          = this->getTag();
   idData(1)          = connectedExternalNodes(0);
   idData(2)          = connectedExternalNodes(1);
@@ -1309,7 +1309,7 @@ DispBeamColumn2dThermal::sendSelf(int commitTag, Channel &theChannel)
 
   if (idData(6) == 1) {
     // send damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     dData(0) = alphaM;
     dData(1) = betaK;
     dData(2) = betaK0;
@@ -1377,7 +1377,7 @@ DispBeamColumn2dThermal::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static ID idData(7); // one bigger than needed so no clash with section ID
+  static thread_local ID idData(7); // one bigger than needed so no clash with section ID
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0) {
     opserr << "DispBeamColumn2dThermal::recvSelf() - failed to recv ID data\n";
@@ -1393,7 +1393,7 @@ DispBeamColumn2dThermal::recvSelf(int commitTag, Channel &theChannel,
 
   if (idData(6) == 1) {
     // recv damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     if (theChannel.recvVector(dbTag, commitTag, dData) < 0) {
       opserr << "DispBeamColumn2dThermal::sendSelf() - failed to recv double data\n";
       return -1;
@@ -1731,8 +1731,8 @@ DispBeamColumn2dThermal::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(3);
-    static Vector ve(3);
+    static thread_local Vector vp(3);
+    static thread_local Vector ve(3);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1935,7 +1935,7 @@ DispBeamColumn2dThermal::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh.Zero();
 
   // Loop over the integration points
@@ -1971,7 +1971,7 @@ DispBeamColumn2dThermal::getResistingForceSensitivity(int gradNumber)
   }
 
   // Transform forces
-  static Vector dp0dh(3); // No distributed loads
+  static thread_local Vector dp0dh(3); // No distributed loads
 
   P.Zero();
 
@@ -1981,7 +1981,7 @@ DispBeamColumn2dThermal::getResistingForceSensitivity(int gradNumber)
 
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(3, 3);
+    static thread_local Matrix kbmine(3, 3);
     kbmine.Zero();
     q.Zero();
 
@@ -2075,7 +2075,7 @@ DispBeamColumn2dThermal::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
 
-  static Vector dvdh(3);
+  static thread_local Vector dvdh(3);
   dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
   double L        = crdTransf->getInitialLength();
@@ -43,9 +43,9 @@
 #include <math.h>
 #include <string>
 
-Matrix DispBeamColumn3d::K(12,12);
-Vector DispBeamColumn3d::P(12);
-double DispBeamColumn3d::workArea[200];
+thread_local Matrix DispBeamColumn3d::K(12,12);
+thread_local Vector DispBeamColumn3d::P(12);
+thread_local double DispBeamColumn3d::workArea[200];
 
 #if 0
 #include <elementAPI.h>
@@ -382,7 +382,7 @@ DispBeamColumn3d::update()
 const Matrix&
 DispBeamColumn3d::getTangentStiff()
 {
-  static Matrix kb(6,6);
+  static thread_local Matrix kb(6,6);
   
   // Zero for integral
   kb.Zero();
@@ -515,7 +515,7 @@ DispBeamColumn3d::getTangentStiff()
 const Matrix&
 DispBeamColumn3d::getInitialBasicStiff()
 {
-  static Matrix kb(6,6);
+  static thread_local Matrix kb(6,6);
 
   // Zero for integral
   kb.Zero();
@@ -638,7 +638,7 @@ DispBeamColumn3d::getMass()
     K(0,0) = K(1,1) = K(2,2) = K(6,6) = K(7,7) = K(8,8) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(12,12);
+    static thread_local Matrix ml(12,12);
     double m = rho*L/420.0;
     ml(0,0) = ml(6,6) = m*140.0;
     ml(0,6) = ml(6,0) = m*70.0;
@@ -802,7 +802,7 @@ DispBeamColumn3d::addInertiaLoadToUnbalance(const Vector &accel)
 
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    static thread_local Vector Raccel(12);
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
@@ -850,7 +850,7 @@ DispBeamColumn3d::getResistingForceIncInertia()
     P(8) += m*accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    static thread_local Vector accel(12);
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
@@ -881,7 +881,7 @@ DispBeamColumn3d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
   
-  static Vector data(14);
+  static thread_local Vector data(14);
   data(0) = this->getTag();
   data(1) = connectedExternalNodes(0);
   data(2) = connectedExternalNodes(1);
@@ -975,7 +975,7 @@ DispBeamColumn3d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
   
-  static Vector data(14);
+  static thread_local Vector data(14);
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0)  {
     opserr << "DispBeamColumn3d::recvSelf() - failed to recv data Vector\n";
@@ -1432,8 +1432,8 @@ DispBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1611,7 +1611,7 @@ DispBeamColumn3d::getMassSensitivity(int gradNumber)
     K(0,0) = K(1,1) = K(2,2) = K(6,6) = K(7,7) = K(8,8) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(12,12);
+    static thread_local Matrix ml(12,12);
     //double m = rho*L/420.0;
     double m = L/420.0;
     ml(0,0) = ml(6,6) = m*140.0;
@@ -1660,7 +1660,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh.Zero();
   
   // Loop over the integration points
@@ -1703,7 +1703,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   }
   
   // Transform forces
-  static Vector dp0dh(6);                // No distributed loads
+  static thread_local Vector dp0dh(6);                // No distributed loads
 
   P.Zero();
 
@@ -1713,7 +1713,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
     
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(6,6);
+    static thread_local Matrix kbmine(6,6);
     kbmine.Zero();
     q.Zero();
     
@@ -1836,7 +1836,7 @@ DispBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
   
-  static Vector dvdh(6);
+  static thread_local Vector dvdh(6);
   dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
   
   double L = crdTransf->getInitialLength();
@@ -80,6 +80,7 @@ class DispBeamColumn3d : public Element
 
     const Vector &getResistingForce(void);
     const Vector &getResistingForceIncInertia(void);            
+    bool hasOnlyRayleighDamping() const {return true;}
 
     // public methods for element output
     int sendSelf(int commitTag, Channel &theChannel);
@@ -115,8 +116,8 @@ private:
 
     Node *theNodes[2];
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
     Vector Q;      // Applied nodal loads
     Vector q;      // Basic force
@@ -130,7 +131,7 @@ private:
 
     enum {maxNumSections = 20};
 
-    static double workArea[];
+    static thread_local double workArea[];
 };
 
 #endif
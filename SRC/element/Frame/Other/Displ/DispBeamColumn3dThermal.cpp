@@ -51,9 +51,9 @@
 #include <FiberSection3dThermal.h>
 #include <elementAPI.h>
 
-Matrix DispBeamColumn3dThermal::K(12, 12);
-Vector DispBeamColumn3dThermal::P(12);
-double DispBeamColumn3dThermal::workArea[200];
+thread_local Matrix DispBeamColumn3dThermal::K(12, 12);
+thread_local Vector DispBeamColumn3dThermal::P(12);
+thread_local double DispBeamColumn3dThermal::workArea[200];
 
 using namespace OpenSees;
 
@@ -456,7 +456,7 @@ DispBeamColumn3dThermal::update(void)
 const Matrix &
 DispBeamColumn3dThermal::getTangentStiff()
 {
-  static Matrix kb(6, 6);
+  static thread_local Matrix kb(6, 6);
 
   // Zero for integral
   kb.Zero();
@@ -602,7 +602,7 @@ DispBeamColumn3dThermal::getTangentStiff()
 const Matrix &
 DispBeamColumn3dThermal::getInitialBasicStiff()
 {
-  static Matrix kb(6, 6);
+  static thread_local Matrix kb(6, 6);
 
   // Zero for integral
   kb.Zero();
@@ -1261,7 +1261,7 @@ DispBeamColumn3dThermal::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static ID idData(9); // one bigger than needed so no clash later
+  static thread_local ID idData(9); // one bigger than needed so no clash later
   idData(0) = this->getTag();
   idData(1) = connectedExternalNodes(0);
   idData(2) = connectedExternalNodes(1);
@@ -1297,7 +1297,7 @@ DispBeamColumn3dThermal::sendSelf(int commitTag, Channel &theChannel)
 
   if (idData(6) == 1) {
     // send damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     dData(0) = alphaM;
     dData(1) = betaK;
     dData(2) = betaK0;
@@ -1371,7 +1371,7 @@ DispBeamColumn3dThermal::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static ID idData(9); // one bigger than needed so no clash with section ID
+  static thread_local ID idData(9); // one bigger than needed so no clash with section ID
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0) {
     opserr << "DispBeamColumn3dThermal::recvSelf() - failed to recv ID data\n";
@@ -1387,7 +1387,7 @@ DispBeamColumn3dThermal::recvSelf(int commitTag, Channel &theChannel,
 
   if (idData(6) == 1) {
     // recv damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     if (theChannel.recvVector(dbTag, commitTag, dData) < 0) {
       opserr << "DispBeamColumn3dThermal::sendSelf() - failed to recv double "
                 "data\n";
@@ -1601,8 +1601,8 @@ int
 DispBeamColumn3dThermal::displaySelf(Renderer &theViewer, int displayMode, float fact,
                                      const char **modes, int numModes)
 {
-  static Vector v1(3);
-  static Vector v2(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
 
   theNodes[0]->getDisplayCrds(v1, fact, displayMode);
   theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -1821,8 +1821,8 @@ DispBeamColumn3dThermal::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1958,7 +1958,7 @@ DispBeamColumn3dThermal::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh.Zero();
 
   // Loop over the integration points
@@ -2001,7 +2001,7 @@ DispBeamColumn3dThermal::getResistingForceSensitivity(int gradNumber)
   }
 
   // Transform forces
-  static Vector dp0dh(6); // No distributed loads
+  static thread_local Vector dp0dh(6); // No distributed loads
 
   P.Zero();
 
@@ -2011,7 +2011,7 @@ DispBeamColumn3dThermal::getResistingForceSensitivity(int gradNumber)
 
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(6, 6);
+    static thread_local Matrix kbmine(6, 6);
     kbmine.Zero();
     q.Zero();
 
@@ -2132,7 +2132,7 @@ DispBeamColumn3dThermal::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
 
-  static Vector dvdh(6);
+  static thread_local Vector dvdh(6);
   dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
   double L        = crdTransf->getInitialLength();
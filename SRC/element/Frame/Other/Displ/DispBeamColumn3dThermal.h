@@ -121,8 +121,8 @@ class DispBeamColumn3dThermal : public Element
 
     Node *theNodes[2];
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
     Vector Q;		// Applied nodal loads
     Vector q;		// Basic force
@@ -138,7 +138,7 @@ class DispBeamColumn3dThermal : public Element
 	int parameterID;
 
     enum {maxNumSections = 20};
-    static double workArea[];
+    static thread_local double workArea[];
 
 	double SectionThermalElong[20];
     double AverageThermalElong;
@@ -48,9 +48,9 @@
 
 #define ELE_TAG_DispBeamColumn3dWithSensitivity 1110000
 
-Matrix DispBeamColumn3dWithSensitivity::K(12, 12);
-Vector DispBeamColumn3dWithSensitivity::P(12);
-double DispBeamColumn3dWithSensitivity::workArea[200];
+thread_local Matrix DispBeamColumn3dWithSensitivity::K(12, 12);
+thread_local Vector DispBeamColumn3dWithSensitivity::P(12);
+thread_local double DispBeamColumn3dWithSensitivity::workArea[200];
 //GaussQuadRule1d01 DispBeamColumn3dWithSensitivity::quadRule;
 
 void *
@@ -414,7 +414,7 @@ DispBeamColumn3dWithSensitivity::update(void)
 const Matrix &
 DispBeamColumn3dWithSensitivity::getTangentStiff()
 {
-  static Matrix kb(6, 6);
+  static thread_local Matrix kb(6, 6);
 
   // Zero for integral
   kb.Zero();
@@ -549,7 +549,7 @@ DispBeamColumn3dWithSensitivity::getTangentStiff()
 const Matrix &
 DispBeamColumn3dWithSensitivity::getInitialBasicStiff()
 {
-  static Matrix kb(6, 6);
+  static thread_local Matrix kb(6, 6);
 
   // Zero for integral
   kb.Zero();
@@ -917,7 +917,7 @@ DispBeamColumn3dWithSensitivity::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static ID idData(7); // one bigger than needed so no clash later
+  static thread_local ID idData(7); // one bigger than needed so no clash later
   idData(0)          = this->getTag();
   idData(1)          = connectedExternalNodes(0);
   idData(2)          = connectedExternalNodes(1);
@@ -941,7 +941,7 @@ DispBeamColumn3dWithSensitivity::sendSelf(int commitTag, Channel &theChannel)
   }
   if (idData(6) == 1) {
     // send damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     dData(0) = alphaM;
     dData(1) = betaK;
     dData(2) = betaK0;
@@ -1011,7 +1011,7 @@ DispBeamColumn3dWithSensitivity::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static ID idData(7); // one bigger than needed so no clash with section ID
+  static thread_local ID idData(7); // one bigger than needed so no clash with section ID
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0) {
     opserr << "DispBeamColumn3dWithSensitivity::recvSelf() - failed to recv ID "
@@ -1027,7 +1027,7 @@ DispBeamColumn3dWithSensitivity::recvSelf(int commitTag, Channel &theChannel,
   int crdTransfDbTag    = idData(5);
   if (idData(6) == 1) {
     // recv damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     if (theChannel.recvVector(dbTag, commitTag, dData) < 0) {
       opserr << "DispBeamColumn3d::sendSelf() - failed to recv double data\n";
       return -1;
@@ -1215,8 +1215,8 @@ int
 DispBeamColumn3dWithSensitivity::displaySelf(Renderer &theViewer, int displayMode,
                                              float fact, const char **modes, int numMode)
 {
-  static Vector v1(3);
-  static Vector v2(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
 
   theNodes[0]->getDisplayCrds(v1, fact, displayMode);
   theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -1379,8 +1379,8 @@ DispBeamColumn3dWithSensitivity::getResponse(int responseID, Information &eleInf
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1480,7 +1480,7 @@ DispBeamColumn3dWithSensitivity::getResistingForceSensitivity(int gradNumber)
 
   // Zero for integration
   q.Zero();
-  static Vector qsens(6);
+  static thread_local Vector qsens(6);
   qsens.Zero();
 
   // Loop over the integration points
@@ -1538,7 +1538,7 @@ DispBeamColumn3dWithSensitivity::getResistingForceSensitivity(int gradNumber)
   } //for section
 
   // Term 5
-  static Vector dummy(5); //dummy is only 5
+  static thread_local Vector dummy(5); //dummy is only 5
   dummy.Zero();
   P = crdTransf->getGlobalResistingForce(qsens, dummy);
 
@@ -1552,7 +1552,7 @@ int
 DispBeamColumn3dWithSensitivity::commitSensitivity(int gradNumber, int numGrads)
 {
   const Vector &v = crdTransf->getBasicTrialDisp();
-  static Vector vsens(6);
+  static thread_local Vector vsens(6);
   vsens           = crdTransf->getBasicDisplTotalGrad(gradNumber);
   double L        = crdTransf->getInitialLength();
   double oneOverL = 1.0 / L;
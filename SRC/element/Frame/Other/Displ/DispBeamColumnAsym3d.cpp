@@ -57,9 +57,9 @@
 #include <TrapezoidalBeamIntegration.h>
 #include <RegularizedHingeIntegration.h>
 
-Matrix DispBeamColumnAsym3d::K(12, 12);
-Vector DispBeamColumnAsym3d::P(12);
-double DispBeamColumnAsym3d::workArea[200];
+thread_local Matrix DispBeamColumnAsym3d::K(12, 12);
+thread_local Vector DispBeamColumnAsym3d::P(12);
+thread_local double DispBeamColumnAsym3d::workArea[200];
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_DispBeamColumnAsym3d)
@@ -556,16 +556,16 @@ DispBeamColumnAsym3d::update()
 const Matrix &
 DispBeamColumnAsym3d::getTangentStiff()
 {
-  static Matrix kb(6, 6);
-  static Matrix N1(5, 11);  //Xinlong
-  static Matrix N2(11, 6);  //Xinlong
-  static Matrix N3(11, 11); //Xinlong
-  static Matrix kbPart1(6, 6);
-  static Matrix Gm(11, 11);
-  static Matrix kbPart2(6, 6);
-  static Matrix Tr(6, 6);
-  static Matrix kf1(6, 6);
-  static Matrix kf2(6, 6);
+  static thread_local Matrix kb(6, 6);
+  static thread_local Matrix N1(5, 11);  //Xinlong
+  static thread_local Matrix N2(11, 6);  //Xinlong
+  static thread_local Matrix N3(11, 11); //Xinlong
+  static thread_local Matrix kbPart1(6, 6);
+  static thread_local Matrix Gm(11, 11);
+  static thread_local Matrix kbPart2(6, 6);
+  static thread_local Matrix Tr(6, 6);
+  static thread_local Matrix kf1(6, 6);
+  static thread_local Matrix kf2(6, 6);
 
   const Vector &v = crdTransf->getBasicTrialDisp();
 
@@ -694,9 +694,9 @@ DispBeamColumnAsym3d::getTangentStiff()
     }
 
     //assemble internal force vector q
-    static Vector qProduct1(11);
-    static Vector qProduct2(6);
-    static Vector qProduct3(6);
+    static thread_local Vector qProduct1(11);
+    static thread_local Vector qProduct2(6);
+    static thread_local Vector qProduct3(6);
     qProduct1.Zero();
     qProduct2.Zero();
     qProduct3.Zero();
@@ -724,16 +724,16 @@ const Matrix &
 DispBeamColumnAsym3d::getInitialBasicStiff()
 {
 
-  static Matrix kb(6, 6);
-  static Matrix N1(5, 11);  //Xinlong
-  static Matrix N2(11, 6);  //Xinlong
-  static Matrix N3(11, 11); //Xinlong
-  static Matrix kbPart1(6, 6);
-  static Matrix Gm(11, 11);
-  static Matrix kbPart2(6, 6);
-  static Matrix Tr(6, 6);
-  static Matrix kf1(6, 6);
-  static Matrix kf2(6, 6);
+  static thread_local Matrix kb(6, 6);
+  static thread_local Matrix N1(5, 11);  //Xinlong
+  static thread_local Matrix N2(11, 6);  //Xinlong
+  static thread_local Matrix N3(11, 11); //Xinlong
+  static thread_local Matrix kbPart1(6, 6);
+  static thread_local Matrix Gm(11, 11);
+  static thread_local Matrix kbPart2(6, 6);
+  static thread_local Matrix Tr(6, 6);
+  static thread_local Matrix kf1(6, 6);
+  static thread_local Matrix kf2(6, 6);
 
   // Zero for integral
   kb.Zero();
@@ -890,7 +890,7 @@ DispBeamColumnAsym3d::getMass()
     K(0, 0) = K(1, 1) = K(2, 2) = K(6, 6) = K(7, 7) = K(8, 8) = m;
   } else {
     // consistent mass matrix
-    static Matrix ml(12, 12);
+    static thread_local Matrix ml(12, 12);
     double m = rho * L / 420.0;
     ml(0, 0) = ml(6, 6) = m * 140.0;
     ml(0, 6) = ml(6, 0) = m * 70.0;
@@ -1045,7 +1045,7 @@ DispBeamColumnAsym3d::addInertiaLoadToUnbalance(const Vector &accel)
 
   } else {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    static thread_local Vector Raccel(12);
     for (int i = 0; i < 6; i++) {
       Raccel(i)     = Raccel1(i);
       Raccel(i + 6) = Raccel2(i);
@@ -1060,9 +1060,9 @@ const Vector &
 DispBeamColumnAsym3d::getResistingForce()
 {
 
-  static Matrix N1(5, 11); //Xinlong
-  static Matrix N2(11, 6); //Xinlong
-  static Matrix Tr(6, 6);
+  static thread_local Matrix N1(5, 11); //Xinlong
+  static thread_local Matrix N2(11, 6); //Xinlong
+  static thread_local Matrix Tr(6, 6);
 
   const Vector &v = crdTransf->getBasicTrialDisp();
 
@@ -1158,9 +1158,9 @@ DispBeamColumnAsym3d::getResistingForce()
     double wti = wt[i];
 
     //assemble internal force vector q
-    static Vector qProduct1(11);
-    static Vector qProduct2(6);
-    static Vector qProduct3(6);
+    static thread_local Vector qProduct1(11);
+    static thread_local Vector qProduct2(6);
+    static thread_local Vector qProduct3(6);
     qProduct1.Zero();
     qProduct2.Zero();
     qProduct3.Zero();
@@ -1212,7 +1212,7 @@ DispBeamColumnAsym3d::getResistingForceIncInertia()
       P(8) += m * accel2(2);
     } else {
       // use matrix vector multip. for consistent mass matrix
-      static Vector accel(12);
+      static thread_local Vector accel(12);
       for (int i = 0; i < 6; i++) {
         accel(i)     = accel1(i);
         accel(i + 6) = accel2(i);
@@ -1243,7 +1243,7 @@ DispBeamColumnAsym3d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static Vector data(16);
+  static thread_local Vector data(16);
   data(0)            = this->getTag();
   data(1)            = connectedExternalNodes(0);
   data(2)            = connectedExternalNodes(1);
@@ -1340,7 +1340,7 @@ DispBeamColumnAsym3d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static Vector data(16);
+  static thread_local Vector data(16);
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0) {
     opserr << "DispBeamColumnAsym3d::recvSelf() - failed to recv data Vector\n";
@@ -1572,8 +1572,8 @@ int
 DispBeamColumnAsym3d::displaySelf(Renderer &theViewer, int displayMode, float fact,
                                   const char **modes, int numModes)
 {
-  static Vector v1(3);
-  static Vector v2(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
 
   if (displayMode >= 0) {
 
@@ -1827,8 +1827,8 @@ DispBeamColumnAsym3d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1988,7 +1988,7 @@ DispBeamColumnAsym3d::getMassSensitivity(int gradNumber)
     K(0, 0) = K(1, 1) = K(2, 2) = K(6, 6) = K(7, 7) = K(8, 8) = m;
   } else {
     // consistent mass matrix
-    static Matrix ml(12, 12);
+    static thread_local Matrix ml(12, 12);
     //double m = rho*L/420.0;
     double m = L / 420.0;
     ml(0, 0) = ml(6, 6) = m * 140.0;
@@ -2035,7 +2035,7 @@ DispBeamColumnAsym3d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh.Zero();
 
   // Loop over the integration points
@@ -2078,7 +2078,7 @@ DispBeamColumnAsym3d::getResistingForceSensitivity(int gradNumber)
   }
 
   // Transform forces
-  static Vector dp0dh(6); // No distributed loads
+  static thread_local Vector dp0dh(6); // No distributed loads
 
   P.Zero();
 
@@ -2088,7 +2088,7 @@ DispBeamColumnAsym3d::getResistingForceSensitivity(int gradNumber)
 
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(6, 6);
+    static thread_local Matrix kbmine(6, 6);
     kbmine.Zero();
     q.Zero();
 
@@ -2208,7 +2208,7 @@ DispBeamColumnAsym3d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
 
-  static Vector dvdh(6);
+  static thread_local Vector dvdh(6);
   dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
   double L        = crdTransf->getInitialLength();
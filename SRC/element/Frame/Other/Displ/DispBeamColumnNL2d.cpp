@@ -30,9 +30,9 @@
 #include <string.h>
 #include <map>
 
-Matrix DispBeamColumnNL2d::K(6,6);
-Vector DispBeamColumnNL2d::P(6);
-double DispBeamColumnNL2d::workArea[100];
+thread_local Matrix DispBeamColumnNL2d::K(6,6);
+thread_local Vector DispBeamColumnNL2d::P(6);
+thread_local double DispBeamColumnNL2d::workArea[100];
 
 #if 0
 #include <elementAPI.h>
@@ -426,7 +426,7 @@ DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial)
 
     Matrix B(order,3);
     Matrix C(order,3);
-    static Matrix C1(1,3);
+    static thread_local Matrix C1(1,3);
     for (j = 0; j < order; j++) {
       switch(code(j)) {
       case SECTION_RESPONSE_P:
@@ -455,7 +455,7 @@ DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial)
     kb.addMatrixTransposeProduct(1.0, B, kC, theta*wt[i]);
 
     Matrix ks1(1,order);
-    static Matrix ksB(1,3);
+    static thread_local Matrix ksB(1,3);
 
     for (j = 0; j < order; j++) {
       if (code(j) == SECTION_RESPONSE_P) {
@@ -523,7 +523,7 @@ DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial)
 const Matrix&
 DispBeamColumnNL2d::getTangentStiff()
 {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
 
   this->getBasicStiff(kb);
 
@@ -600,7 +600,7 @@ DispBeamColumnNL2d::getTangentStiff()
 const Matrix&
 DispBeamColumnNL2d::getInitialBasicStiff()
 {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -945,7 +945,7 @@ DispBeamColumnNL2d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static ID idData(9);  // one bigger than needed so no clash later
+  static thread_local ID idData(9);  // one bigger than needed so no clash later
   idData(0) = this->getTag();
   idData(1) = connectedExternalNodes(0);
   idData(2) = connectedExternalNodes(1);
@@ -980,7 +980,7 @@ DispBeamColumnNL2d::sendSelf(int commitTag, Channel &theChannel)
 
   if (idData(6) == 1) {
     // send damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     dData(0) = alphaM;
     dData(1) = betaK;
     dData(2) = betaK0;
@@ -1052,7 +1052,7 @@ DispBeamColumnNL2d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static ID idData(9); // one bigger than needed so no clash with section ID
+  static thread_local ID idData(9); // one bigger than needed so no clash with section ID
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0)  {
     opserr << "DispBeamColumnNL2d::recvSelf() - failed to recv ID data\n";
@@ -1069,7 +1069,7 @@ DispBeamColumnNL2d::recvSelf(int commitTag, Channel &theChannel,
 
   if (idData(6) == 1) {
     // recv damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     if (theChannel.recvVector(dbTag, commitTag, dData) < 0) {
       opserr << "DispBeamColumnNL2d::sendSelf() - failed to recv double data\n";
       return -1;
@@ -1468,7 +1468,7 @@ DispBeamColumnNL2d::getResponse(int responseID, Information &eleInfo)
   }
 
   else if (responseID == 19) {
-    static Matrix kb(3,3);
+    static thread_local Matrix kb(3,3);
     this->getBasicStiff(kb);
     return eleInfo.setMatrix(kb);
   }
@@ -1479,8 +1479,8 @@ DispBeamColumnNL2d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(3);
-    static Vector ve(3);
+    static thread_local Vector vp(3);
+    static thread_local Vector ve(3);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1580,7 +1580,7 @@ DispBeamColumnNL2d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 9) {
-    static Vector dqdh(3);
+    static thread_local Vector dqdh(3);
 
     dqdh.Zero();
 
@@ -1738,7 +1738,7 @@ DispBeamColumnNL2d::activateParameter(int passedParameterID)
 const Matrix &
 DispBeamColumnNL2d::getInitialStiffSensitivity(int gradNumber)
 {
-  static Matrix kb(3,3);
+  static thread_local Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -1843,7 +1843,7 @@ DispBeamColumnNL2d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh.Zero();
 
   // Loop over the integration points
@@ -2002,7 +2002,7 @@ DispBeamColumnNL2d::getResistingForceSensitivity(int gradNumber)
 
 
   // Transform forces
-  static Vector dp0dh(3);                // No distributed loads
+  static thread_local Vector dp0dh(3);                // No distributed loads
   dp0dh.Zero();
 
   P.Zero();
@@ -2013,7 +2013,7 @@ DispBeamColumnNL2d::getResistingForceSensitivity(int gradNumber)
 
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(3,3);
+    static thread_local Matrix kbmine(3,3);
     this->getBasicStiff(kbmine);
 
     // k dAdh u
@@ -2040,7 +2040,7 @@ DispBeamColumnNL2d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
 
-  static Vector dvdh(3);
+  static thread_local Vector dvdh(3);
   dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
   double L = crdTransf->getInitialLength();
@@ -103,8 +103,8 @@ class DispBeamColumnNL2d : public Element
 
     Node *theNodes[2];
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
 
     Vector Q;		// Applied nodal loads
     Vector q;		// Basic force
@@ -115,7 +115,7 @@ class DispBeamColumnNL2d : public Element
 
     enum {maxNumSections = 20};
 
-    static double workArea[];
+    static thread_local double workArea[];
 
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
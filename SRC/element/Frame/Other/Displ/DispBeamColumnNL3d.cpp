@@ -27,9 +27,9 @@
 #include <math.h>
 #include <ElementalLoad.h>
 
-Matrix DispBeamColumnNL3d::K(12, 12);
-Vector DispBeamColumnNL3d::P(12);
-double DispBeamColumnNL3d::workArea[200];
+thread_local Matrix DispBeamColumnNL3d::K(12, 12);
+thread_local Vector DispBeamColumnNL3d::P(12);
+thread_local double DispBeamColumnNL3d::workArea[200];
 
 #if 0
 #include <runtimeAPI.h>
@@ -472,8 +472,8 @@ DispBeamColumnNL3d::getBasicStiff(Matrix &kb, int initial)
     Matrix B(order, 6);
     Matrix Cz(order, 6);
     Matrix Cy(order, 6);
-    static Matrix Cz1(1, 6);
-    static Matrix Cy1(1, 6);
+    static thread_local Matrix Cz1(1, 6);
+    static thread_local Matrix Cy1(1, 6);
     for (int j = 0; j < order; j++) {
       switch (code(j)) {
       case SECTION_RESPONSE_P:
@@ -517,7 +517,7 @@ DispBeamColumnNL3d::getBasicStiff(Matrix &kb, int initial)
     kb.addMatrixTransposeProduct(1.0, B, kC, dy * wt[i]);
 
     Matrix ks1(1, order);
-    static Matrix ksB(1, 6);
+    static thread_local Matrix ksB(1, 6);
 
     for (int j = 0; j < order; j++) {
       if (code(j) == SECTION_RESPONSE_P) {
@@ -591,7 +591,7 @@ DispBeamColumnNL3d::getBasicStiff(Matrix &kb, int initial)
 const Matrix &
 DispBeamColumnNL3d::getTangentStiff()
 {
-  static Matrix kb(6, 6);
+  static thread_local Matrix kb(6, 6);
 
   this->getBasicStiff(kb);
 
@@ -698,7 +698,7 @@ DispBeamColumnNL3d::getTangentStiff()
 const Matrix &
 DispBeamColumnNL3d::getInitialBasicStiff()
 {
-  static Matrix kb(6, 6);
+  static thread_local Matrix kb(6, 6);
 
   // Zero for integral
   kb.Zero();
@@ -1099,7 +1099,7 @@ DispBeamColumnNL3d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static ID idData(9); // one bigger than needed so no clash later
+  static thread_local ID idData(9); // one bigger than needed so no clash later
   idData(0)          = this->getTag();
   idData(1)          = connectedExternalNodes(0);
   idData(2)          = connectedExternalNodes(1);
@@ -1134,7 +1134,7 @@ DispBeamColumnNL3d::sendSelf(int commitTag, Channel &theChannel)
 
   if (idData(6) == 1) {
     // send damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     dData(0) = alphaM;
     dData(1) = betaK;
     dData(2) = betaK0;
@@ -1206,7 +1206,7 @@ DispBeamColumnNL3d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static ID idData(9); // one bigger than needed so no clash with section ID
+  static thread_local ID idData(9); // one bigger than needed so no clash with section ID
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0) {
     opserr << "DispBeamColumnNL3d::recvSelf() - failed to recv ID data\n";
@@ -1222,7 +1222,7 @@ DispBeamColumnNL3d::recvSelf(int commitTag, Channel &theChannel,
 
   if (idData(6) == 1) {
     // recv damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     if (theChannel.recvVector(dbTag, commitTag, dData) < 0) {
       opserr << "DispBeamColumnNL3d::sendSelf() - failed to recv double data\n";
       return -1;
@@ -1649,7 +1649,7 @@ DispBeamColumnNL3d::getResponse(int responseID, Information &eleInfo)
   }
 
   else if (responseID == 19) {
-    static Matrix kb(6, 6);
+    static thread_local Matrix kb(6, 6);
     this->getBasicStiff(kb);
     return eleInfo.setMatrix(kb);
   }
@@ -1660,8 +1660,8 @@ DispBeamColumnNL3d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1772,10 +1772,10 @@ DispBeamColumnNL3d::getResponse(int responseID, Information &eleInfo)
     dispsy.addMatrixVector(0.0, ls, kappaz, 1.0);
     dispsz.addMatrixVector(0.0, ls, kappay, -1.0);
     beamInt->getSectionLocations(numSections, L, pts);
-    static Vector uxb(3);
-    static Vector uxg(3);
+    static thread_local Vector uxb(3);
+    static thread_local Vector uxg(3);
     Matrix disps(numSections, 3);
-    static Vector vp(6);
+    static thread_local Vector vp(6);
     vp = crdTransf->getBasicTrialDisp();
     for (int i = 0; i < numSections; i++) {
       uxb(0) = pts[i] * vp(0); // linear shape function
@@ -1808,7 +1808,7 @@ DispBeamColumnNL3d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 9) {
-    static Vector dqdh(6);
+    static thread_local Vector dqdh(6);
 
     dqdh.Zero();
 
@@ -1968,7 +1968,7 @@ DispBeamColumnNL3d::activateParameter(int passedParameterID)
 const Matrix &
 DispBeamColumnNL3d::getInitialStiffSensitivity(int gradNumber)
 {
-  static Matrix kb(6, 6);
+  static thread_local Matrix kb(6, 6);
 
   // Zero for integral
   kb.Zero();
@@ -2071,7 +2071,7 @@ DispBeamColumnNL3d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh.Zero();
 
   // Loop over the integration points
@@ -2225,7 +2225,7 @@ DispBeamColumnNL3d::getResistingForceSensitivity(int gradNumber)
   }
 
   // Transform forces
-  static Vector dp0dh(5); // No distributed loads
+  static thread_local Vector dp0dh(5); // No distributed loads
   dp0dh.Zero();
 
   P.Zero();
@@ -2236,7 +2236,7 @@ DispBeamColumnNL3d::getResistingForceSensitivity(int gradNumber)
 
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(6, 6);
+    static thread_local Matrix kbmine(6, 6);
     this->getBasicStiff(kbmine);
 
     // k dAdh u
@@ -2261,7 +2261,7 @@ DispBeamColumnNL3d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
 
-  static Vector dvdh(6);
+  static thread_local Vector dvdh(6);
   dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
   double L        = crdTransf->getInitialLength();
@@ -104,8 +104,8 @@ class DispBeamColumnNL3d : public Element
 
     Node *theNodes[2];
 
-    static Matrix K;                // Element stiffness, damping, and mass Matrix
-    static Vector P;                // Element resisting force vector
+    static thread_local Matrix K;                // Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;                // Element resisting force vector
 
     Vector Q;                // Applied nodal loads
     Vector q;                // Basic force
@@ -116,7 +116,7 @@ class DispBeamColumnNL3d : public Element
 
     enum {maxNumSections = 20};
 
-    static double workArea[];
+    static thread_local double workArea[];
 
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
@@ -46,9 +46,9 @@
 #include <Parameter.h>
 
 
-Matrix DispBeamColumnWarping3d::K(14, 14);
-Vector DispBeamColumnWarping3d::P(14);
-double DispBeamColumnWarping3d::workArea[200];
+thread_local Matrix DispBeamColumnWarping3d::K(14, 14);
+thread_local Vector DispBeamColumnWarping3d::P(14);
+thread_local double DispBeamColumnWarping3d::workArea[200];
 
 void *
 OPS_ADD_RUNTIME_VPV(OPS_DispBeamColumnWarping3d)
@@ -445,13 +445,13 @@ DispBeamColumnWarping3d::update()
 const Matrix &
 DispBeamColumnWarping3d::getTangentStiff()
 {
-  static Matrix kb(9, 9);
-  static Matrix N1(6, 8);
-  static Matrix N2(8, 9);
-  static Matrix N3(8, 8);
-  static Matrix kbPart1(9, 9);
-  static Matrix Gmax(8, 8);
-  static Matrix kbPart2(9, 9);
+  static thread_local Matrix kb(9, 9);
+  static thread_local Matrix N1(6, 8);
+  static thread_local Matrix N2(8, 9);
+  static thread_local Matrix N3(8, 8);
+  static thread_local Matrix kbPart1(9, 9);
+  static thread_local Matrix Gmax(8, 8);
+  static thread_local Matrix kbPart2(9, 9);
   const Vector &v = crdTransf->getBasicTrialDisp();
 
   // Zero for integral
@@ -570,8 +570,8 @@ DispBeamColumnWarping3d::getTangentStiff()
       }
     }
 
-    static Vector qProduct1(8);
-    static Vector qProduct2(9);
+    static thread_local Vector qProduct1(8);
+    static thread_local Vector qProduct2(9);
     qProduct1.Zero();
     qProduct2.Zero();
     qProduct1.addMatrixTransposeVector(0.0, N1, s, 1.0);
@@ -597,13 +597,13 @@ DispBeamColumnWarping3d::getTangentStiff()
 const Matrix &
 DispBeamColumnWarping3d::getInitialBasicStiff()
 {
-  static Matrix kb(9, 9);
-  static Matrix N1(6, 8);
-  static Matrix N2(8, 9);
-  static Matrix N3(8, 8);
-  static Matrix kbPart1(9, 9);
-  static Matrix Gmax(8, 8);
-  static Matrix kbPart2(9, 9);
+  static thread_local Matrix kb(9, 9);
+  static thread_local Matrix N1(6, 8);
+  static thread_local Matrix N2(8, 9);
+  static thread_local Matrix N3(8, 8);
+  static thread_local Matrix kbPart1(9, 9);
+  static thread_local Matrix Gmax(8, 8);
+  static thread_local Matrix kbPart2(9, 9);
 
   // Zero for integral
   kb.Zero();
@@ -915,8 +915,8 @@ DispBeamColumnWarping3d::getResistingForce()
   double oneOverL       = 1.0 / L;
   double oneOverLsquare = oneOverL * oneOverL;
   double oneOverLcube   = oneOverLsquare * oneOverL;
-  static Matrix N1(6, 8);
-  static Matrix N2(8, 9);
+  static thread_local Matrix N1(6, 8);
+  static thread_local Matrix N2(8, 9);
   //const Matrix &pts = quadRule.getIntegrPointCoords(numSections);
   //const Vector &wts = quadRule.getIntegrPointWeights(numSections);
   double xi[maxNumSections];
@@ -1006,8 +1006,8 @@ DispBeamColumnWarping3d::getResistingForce()
   q(7) += ((2.0-xi6)*s(3)+(3.0*xi1*xi1-2.0*xi1)*L*s(4))*wti;
   q(8) += s(0)*wti;*/
 
-    static Vector qProduct1(8);
-    static Vector qProduct2(9);
+    static thread_local Vector qProduct1(8);
+    static thread_local Vector qProduct2(9);
     qProduct1.Zero();
     qProduct2.Zero();
     qProduct1.addMatrixTransposeVector(0.0, N1, s, 1.0);
@@ -1079,7 +1079,7 @@ DispBeamColumnWarping3d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static ID idData(7); // one bigger than needed so no clash later
+  static thread_local ID idData(7); // one bigger than needed so no clash later
   idData(0)          = this->getTag();
   idData(1)          = connectedExternalNodes(0);
   idData(2)          = connectedExternalNodes(1);
@@ -1105,7 +1105,7 @@ DispBeamColumnWarping3d::sendSelf(int commitTag, Channel &theChannel)
 
   if (idData(6) == 1) {
     // send damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     dData(0) = alphaM;
     dData(1) = betaK;
     dData(2) = betaK0;
@@ -1172,7 +1172,7 @@ DispBeamColumnWarping3d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static ID idData(7); // one bigger than needed so no clash with section ID
+  static thread_local ID idData(7); // one bigger than needed so no clash with section ID
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0) {
     opserr << "DispBeamColumnWarping3d::recvSelf() - failed to recv ID data\n";
@@ -1188,7 +1188,7 @@ DispBeamColumnWarping3d::recvSelf(int commitTag, Channel &theChannel,
 
   if (idData(6) == 1) {
     // recv damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     if (theChannel.recvVector(dbTag, commitTag, dData) < 0) {
       opserr << "DispBeamColumnWarping3d::sendSelf() - failed to recv double data\n";
       return -1;
@@ -1360,8 +1360,8 @@ DispBeamColumnWarping3d::displaySelf(Renderer &theViewer, int displayMode, float
   const Vector &end1Crd = theNodes[0]->getCrds();
   const Vector &end2Crd = theNodes[1]->getCrds();
 
-  static Vector v1(3);
-  static Vector v2(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
 
   if (displayMode >= 0) {
     const Vector &end1Disp = theNodes[0]->getDisp();
@@ -1557,8 +1557,8 @@ DispBeamColumnWarping3d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1683,7 +1683,7 @@ DispBeamColumnWarping3d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh.Zero();
 
   // Loop over the integration points
@@ -1726,7 +1726,7 @@ DispBeamColumnWarping3d::getResistingForceSensitivity(int gradNumber)
   }
 
   // Transform forces
-  static Vector dp0dh(6); // No distributed loads
+  static thread_local Vector dp0dh(6); // No distributed loads
 
   P.Zero();
 
@@ -1736,7 +1736,7 @@ DispBeamColumnWarping3d::getResistingForceSensitivity(int gradNumber)
 
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(6, 6);
+    static thread_local Matrix kbmine(6, 6);
     kbmine.Zero();
     q.Zero();
 
@@ -1857,7 +1857,7 @@ DispBeamColumnWarping3d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
 
-  static Vector dvdh(6);
+  static thread_local Vector dvdh(6);
   dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
   double L        = crdTransf->getInitialLength();
@@ -44,9 +44,9 @@
 #include <math.h>
 #include <ElementalLoad.h>
 
-Matrix TimoshenkoBeamColumn2d::K(6, 6);
-Vector TimoshenkoBeamColumn2d::P(6);
-double TimoshenkoBeamColumn2d::workArea[100];
+thread_local Matrix TimoshenkoBeamColumn2d::K(6, 6);
+thread_local Vector TimoshenkoBeamColumn2d::P(6);
+thread_local double TimoshenkoBeamColumn2d::workArea[100];
 
 TimoshenkoBeamColumn2d::TimoshenkoBeamColumn2d(int tag, int nd1, int nd2, int numSec,
                                                SectionForceDeformation **s,
@@ -327,7 +327,7 @@ TimoshenkoBeamColumn2d::update(void)
 const Matrix &
 TimoshenkoBeamColumn2d::getTangentStiff()
 {
-  static Matrix kb(3, 3);
+  static thread_local Matrix kb(3, 3);
 
   // Zero for integral
   kb.Zero();
@@ -460,7 +460,7 @@ TimoshenkoBeamColumn2d::getTangentStiff()
 const Matrix &
 TimoshenkoBeamColumn2d::getInitialBasicStiff()
 {
-  static Matrix kb(3, 3);
+  static thread_local Matrix kb(3, 3);
 
   // Zero for integral
   kb.Zero();
@@ -825,7 +825,7 @@ TimoshenkoBeamColumn2d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static ID idData(9); // one bigger than needed so no clash later
+  static thread_local ID idData(9); // one bigger than needed so no clash later
   idData(0)          = this->getTag();
   idData(1)          = connectedExternalNodes(0);
   idData(2)          = connectedExternalNodes(1);
@@ -860,7 +860,7 @@ TimoshenkoBeamColumn2d::sendSelf(int commitTag, Channel &theChannel)
 
   if (idData(6) == 1) {
     // send damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     dData(0) = alphaM;
     dData(1) = betaK;
     dData(2) = betaK0;
@@ -932,7 +932,7 @@ TimoshenkoBeamColumn2d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static ID idData(9); // one bigger than needed so no clash with section ID
+  static thread_local ID idData(9); // one bigger than needed so no clash with section ID
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0) {
     opserr << "TimoshenkoBeamColumn2d::recvSelf() - failed to recv ID data\n";
@@ -948,7 +948,7 @@ TimoshenkoBeamColumn2d::recvSelf(int commitTag, Channel &theChannel,
 
   if (idData(6) == 1) {
     // recv damping coefficients
-    static Vector dData(4);
+    static thread_local Vector dData(4);
     if (theChannel.recvVector(dbTag, commitTag, dData) < 0) {
       opserr << "TimoshenkoBeamColumn2d::sendSelf() - failed to recv double data\n";
       return -1;
@@ -1334,8 +1334,8 @@ TimoshenkoBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(3);
-    static Vector ve(3);
+    static thread_local Vector vp(3);
+    static thread_local Vector ve(3);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1539,7 +1539,7 @@ TimoshenkoBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh.Zero();
 
   // Loop over the integration points
@@ -1627,7 +1627,7 @@ TimoshenkoBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   }
 
   // Transform forces
-  static Vector dp0dh(3); // No distributed loads
+  static thread_local Vector dp0dh(3); // No distributed loads
 
   P.Zero();
 
@@ -1636,7 +1636,7 @@ TimoshenkoBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   if (crdTransf->isShapeSensitivity()) {
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(3, 3);
+    static thread_local Matrix kbmine(3, 3);
     kbmine.Zero();
     q.Zero();
 
@@ -1755,7 +1755,7 @@ TimoshenkoBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
 
-  static Vector dvdh(3);
+  static thread_local Vector dvdh(3);
   dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
   double L        = crdTransf->getInitialLength();
@@ -43,9 +43,9 @@
 #include <math.h>
 #include <string>
 
-Matrix TimoshenkoBeamColumn3d::K(12,12);
-Vector TimoshenkoBeamColumn3d::P(12);
-double TimoshenkoBeamColumn3d::workArea[200];
+thread_local Matrix TimoshenkoBeamColumn3d::K(12,12);
+thread_local Vector TimoshenkoBeamColumn3d::P(12);
+thread_local double TimoshenkoBeamColumn3d::workArea[200];
 
 #include <elementAPI.h>
 void* OPS_TimoshenkoBeamColumn3d()
@@ -438,7 +438,7 @@ TimoshenkoBeamColumn3d::update()
 const Matrix&
 TimoshenkoBeamColumn3d::getTangentStiff()
 {
-  static Matrix kb(6,6);
+  static thread_local Matrix kb(6,6);
   
   // Zero for integral
   kb.Zero();
@@ -732,7 +732,7 @@ TimoshenkoBeamColumn3d::getBasicStiff(Matrix &kb, int initial)
 const Matrix&
 TimoshenkoBeamColumn3d::getInitialStiff()
 {
-  static Matrix kb(6,6);
+  static thread_local Matrix kb(6,6);
   
   this->getBasicStiff(kb, 1);
 
@@ -1018,7 +1018,7 @@ TimoshenkoBeamColumn3d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
   
-  static Vector data(14);
+  static thread_local Vector data(14);
   data(0) = this->getTag();
   data(1) = connectedExternalNodes(0);
   data(2) = connectedExternalNodes(1);
@@ -1112,7 +1112,7 @@ TimoshenkoBeamColumn3d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
   
-  static Vector data(14);
+  static thread_local Vector data(14);
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0)  {
     opserr << "TimoshenkoBeamColumn3d::recvSelf() - failed to recv data Vector\n";
@@ -1580,7 +1580,7 @@ TimoshenkoBeamColumn3d::getResponse(int responseID, Information &eleInfo)
   }
 
   else if (responseID == 19) {
-    static Matrix kb(6,6);
+    static thread_local Matrix kb(6,6);
     this->getBasicStiff(kb);
     return eleInfo.setMatrix(kb);
   }
@@ -1591,9 +1591,9 @@ TimoshenkoBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
-    static Matrix kb(6,6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
+    static thread_local Matrix kb(6,6);
     this->getBasicStiff(kb, 1);
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1787,7 +1787,7 @@ TimoshenkoBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh.Zero();
   
   // Loop over the integration points
@@ -1838,7 +1838,7 @@ TimoshenkoBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   }
   
   // Transform forces
-  static Vector dp0dh(6);        // No distributed loads
+  static thread_local Vector dp0dh(6);        // No distributed loads
 
   P.Zero();
 
@@ -1848,7 +1848,7 @@ TimoshenkoBeamColumn3d::getResistingForceSensitivity(int gradNumber)
     
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(6,6);
+    static thread_local Matrix kbmine(6,6);
     kbmine.Zero();
     q.Zero();
     
@@ -2003,7 +2003,7 @@ TimoshenkoBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
   
-  static Vector dvdh(6);
+  static thread_local Vector dvdh(6);
   dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
   
   double L = crdTransf->getInitialLength();
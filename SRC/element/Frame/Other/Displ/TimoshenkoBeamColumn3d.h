@@ -110,8 +110,8 @@ private:
   
   Node *theNodes[2];
   
-  static Matrix K;		// Element stiffness, damping, and mass Matrix
-  static Vector P;		// Element resisting force vector
+  static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+  static thread_local Vector P;		// Element resisting force vector
   
   Vector Q;      // Applied nodal loads
   Vector q;      // Basic force
@@ -125,7 +125,7 @@ private:
   
   int parameterID;
   
-  static double workArea[];
+  static thread_local double workArea[];
 };
 
 #endif
@@ -71,9 +71,9 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
 
-Matrix ElasticForceBeamColumn2d::theMatrix(6,6);
-Vector ElasticForceBeamColumn2d::theVector(6);
-double ElasticForceBeamColumn2d::workArea[200];
+thread_local Matrix ElasticForceBeamColumn2d::theMatrix(6,6);
+thread_local Vector ElasticForceBeamColumn2d::theVector(6);
+thread_local double ElasticForceBeamColumn2d::workArea[200];
 
 
 // constructor:
@@ -262,11 +262,11 @@ int ElasticForceBeamColumn2d::revertToStart()
 const Matrix &
 ElasticForceBeamColumn2d::getInitialStiff(void)
 {
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
@@ -274,15 +274,15 @@ ElasticForceBeamColumn2d::getInitialStiff(void)
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ElasticForceBeamColumn2d::getInitialStiff() -- could not invert flexibility\n";
   */
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   f.Invert(kvInit);
 
-  static Vector SeInit(NEBD);
+  static thread_local Vector SeInit(NEBD);
   SeInit.Zero();
   return crdTransf->getGlobalStiffMatrix(kvInit, SeInit);
 }
@@ -291,11 +291,11 @@ const Matrix &
 ElasticForceBeamColumn2d::getTangentStiff(void)
 {
   crdTransf->update();	// Will remove once we clean up the corotational 2d transformation -- MHS
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
@@ -303,15 +303,15 @@ ElasticForceBeamColumn2d::getTangentStiff(void)
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ElasticForceBeamColumn2d::getInitialStiff() -- could not invert flexibility\n";
   */
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   f.Invert(kvInit);
 
-  static Vector q(NEBD);
+  static thread_local Vector q(NEBD);
   q.Zero();
   this->computeBasicForces(q);
 
@@ -370,10 +370,10 @@ ElasticForceBeamColumn2d::getResistingForce(void)
   if (numEleLoads > 0)
     this->computeReactions(p0);
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
-  static Vector Se(NEBD);
+  static thread_local Vector Se(NEBD);
   this->computeBasicForces(Se);
 
   return crdTransf->getGlobalResistingForce(Se, p0Vec);
@@ -387,7 +387,7 @@ ElasticForceBeamColumn2d::computeBasicForces(Vector &q)
     return;
   }
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   const Vector &v = crdTransf->getBasicTrialDisp();
@@ -401,7 +401,7 @@ ElasticForceBeamColumn2d::update()
 {
   int ok = crdTransf->update();
 	
-  static Vector q(NEBD);
+  static thread_local Vector q(NEBD);
   q.Zero();
   this->computeBasicForces(q);
   
@@ -419,9 +419,9 @@ ElasticForceBeamColumn2d::update()
     double xL  = xi[i];
     double xL1 = xL-1.0;
     
-    static Vector s;
+    static thread_local Vector s;
     s.setData(workArea, order);
-    static Vector e;
+    static thread_local Vector e;
     e.setData(&workArea[order], order);
     
     int ii;
@@ -759,7 +759,7 @@ ElasticForceBeamColumn2d::getInitialFlexibility(Matrix &fe)
 void ElasticForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector sectionDispls[]) const
 {
    // get basic displacements and increments
-   static Vector ub(NEBD);
+   static thread_local Vector ub(NEBD);
    ub = crdTransf->getBasicTrialDisp();    
 
    double L = crdTransf->getInitialLength();
@@ -767,7 +767,7 @@ void ElasticForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[],
    // get integration point positions and weights
    //   const Matrix &xi_pt  = quadRule.getIntegrPointCoords(numSections);
    // get integration point positions and weights
-   static double xi_pts[maxNumSections];
+   static thread_local double xi_pts[maxNumSections];
    beamIntegr->getSectionLocations(numSections, L, xi_pts);
 
    // setup Vandermode and CBDI influence matrices
@@ -780,7 +780,7 @@ void ElasticForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[],
 
    // get section curvatures
    Vector kappa(numSections);  // curvature
-   static Vector vs;              // section deformations 
+   static thread_local Vector vs;              // section deformations 
 
    for (i=0; i<numSections; i++)
    {
@@ -806,8 +806,8 @@ void ElasticForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[],
    }
 
    Vector w(numSections);
-   static Vector xl(NDM), uxb(NDM);
-   static Vector xg(NDM), uxg(NDM); 
+   static thread_local Vector xl(NDM), uxb(NDM);
+   static thread_local Vector xg(NDM), uxg(NDM); 
 
    // w = ls * kappa;  
    w.addMatrixVector (0.0, ls, kappa, 1.0);
@@ -835,9 +835,9 @@ void ElasticForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[],
 void
 ElasticForceBeamColumn2d::Print(OPS_Stream &s, int flag)
 {
-  static Vector Se(NEBD);
-  static Vector vp(NEBD);
-  static Matrix fe(NEBD,NEBD);
+  static thread_local Vector Se(NEBD);
+  static thread_local Vector vp(NEBD);
+  static thread_local Matrix fe(NEBD,NEBD);
 
   if (flag == 2) {
 
@@ -1118,9 +1118,9 @@ ElasticForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &o
 int 
 ElasticForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector Se(NEBD);
-  static Vector vp(NEBD);
-  static Matrix fe(NEBD,NEBD);
+  static thread_local Vector Se(NEBD);
+  static thread_local Vector vp(NEBD);
+  static thread_local Matrix fe(NEBD,NEBD);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -1199,9 +1199,9 @@ ElasticForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
   }
 
   else if (responseID == 12) {
-    static Matrix fb(NEBD,NEBD);
+    static thread_local Matrix fb(NEBD,NEBD);
     this->getInitialFlexibility(fb);
-    static Matrix kb(NEBD,NEBD);
+    static thread_local Matrix kb(NEBD,NEBD);
     fb.Invert(kb);
     return eleInfo.setMatrix(kb);
   }
@@ -161,9 +161,9 @@ class ElasticForceBeamColumn2d: public Element
   ElementalLoad **eleLoads;
   double *eleLoadFactors;
 
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
+  static thread_local Matrix theMatrix;
+  static thread_local Vector theVector;
+  static thread_local double workArea[];
   
   int parameterID;
 };
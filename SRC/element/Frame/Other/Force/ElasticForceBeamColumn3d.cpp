@@ -70,9 +70,9 @@
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
 
-Matrix ElasticForceBeamColumn3d::theMatrix(12,12);
-Vector ElasticForceBeamColumn3d::theVector(12);
-double ElasticForceBeamColumn3d::workArea[200];
+thread_local Matrix ElasticForceBeamColumn3d::theMatrix(12,12);
+thread_local Vector ElasticForceBeamColumn3d::theVector(12);
+thread_local double ElasticForceBeamColumn3d::workArea[200];
 
 #if 0
 #include <elementAPI.h>
@@ -329,11 +329,11 @@ int ElasticForceBeamColumn3d::revertToStart()
 const Matrix &
 ElasticForceBeamColumn3d::getInitialStiff(void)
 {
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
@@ -341,15 +341,15 @@ ElasticForceBeamColumn3d::getInitialStiff(void)
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ElasticForceBeamColumn3d::getInitialStiff() -- could not invert flexibility\n";
   */
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   f.Invert(kvInit);
 
-  static Vector SeInit(NEBD);
+  static thread_local Vector SeInit(NEBD);
   SeInit.Zero();
   return crdTransf->getGlobalStiffMatrix(kvInit, SeInit);
 }
@@ -420,10 +420,10 @@ ElasticForceBeamColumn3d::getResistingForce(void)
   if (numEleLoads > 0)
     this->computeReactions(p0);
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
-  static Vector Se(NEBD);
+  static thread_local Vector Se(NEBD);
   this->computeBasicForces(Se);
 
   return crdTransf->getGlobalResistingForce(Se, p0Vec);
@@ -437,7 +437,7 @@ ElasticForceBeamColumn3d::computeBasicForces(Vector &q)
     return;
   }
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   const Vector &v = crdTransf->getBasicTrialDisp();
@@ -450,7 +450,7 @@ ElasticForceBeamColumn3d::update()
 {
   int ok = crdTransf->update();
   
-  static Vector q(NEBD);
+  static thread_local Vector q(NEBD);
   q.Zero();
   this->computeBasicForces(q);
 
@@ -468,9 +468,9 @@ ElasticForceBeamColumn3d::update()
       double xL  = xi[i];
       double xL1 = xL-1.0;
       
-      static Vector s;
+      static thread_local Vector s;
       s.setData(workArea, order);
-      static Vector e;
+      static thread_local Vector e;
       e.setData(&workArea[order], order);
 
       int ii;
@@ -881,9 +881,9 @@ ElasticForceBeamColumn3d::getInitialFlexibility(Matrix &fe)
 void
 ElasticForceBeamColumn3d::Print(OPS_Stream &s, int flag)
   {
-  static Vector Se(NEBD);
-  static Vector vp(NEBD);
-  static Matrix fe(NEBD,NEBD);
+  static thread_local Vector Se(NEBD);
+  static thread_local Vector vp(NEBD);
+  static thread_local Matrix fe(NEBD,NEBD);
   double p0[NEBD];
   Vector p0Vec(p0,NEBD);
   p0Vec.Zero();
@@ -926,9 +926,9 @@ ElasticForceBeamColumn3d::Print(OPS_Stream &s, int flag)
 
     // flag set to 2 used to print everything .. used for viewing data for UCSD renderer  
     else if (flag == 2) {
-       static Vector xAxis(3);
-       static Vector yAxis(3);
-       static Vector zAxis(3);
+       static thread_local Vector xAxis(3);
+       static thread_local Vector yAxis(3);
+       static thread_local Vector zAxis(3);
 
        crdTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -1230,9 +1230,9 @@ ElasticForceBeamColumn3d::Print(OPS_Stream &s, int flag)
 int 
 ElasticForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(NEBD);
-  static Matrix fe(NEBD,NEBD);
-  static Vector Se(NEBD);
+  static thread_local Vector vp(NEBD);
+  static thread_local Matrix fe(NEBD,NEBD);
+  static thread_local Vector Se(NEBD);
   this->computeBasicForces(Se);
 
   double p0[NEBD];
@@ -1292,7 +1292,7 @@ ElasticForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Point of inflection
   else if (responseID == 5) {
-    static Vector LI(2);
+    static thread_local Vector LI(2);
     LI(0) = 0.0;
     LI(1) = 0.0;
 
@@ -1382,7 +1382,7 @@ ElasticForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     d3z += beamIntegr->getTangentDriftJ(L, LIz, Se(1), Se(2));
     d3y += beamIntegr->getTangentDriftJ(L, LIy, Se(3), Se(4), true);
 
-    static Vector d(4);
+    static thread_local Vector d(4);
     d(0) = d2z;
     d(1) = d3z;
     d(2) = d2y;
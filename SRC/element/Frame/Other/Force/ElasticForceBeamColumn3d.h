@@ -164,9 +164,9 @@ class ElasticForceBeamColumn3d: public Element
   ElementalLoad **eleLoads;
   double *eleLoadFactors;
 
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
+  static thread_local Matrix theMatrix;
+  static thread_local Vector theVector;
+  static thread_local double workArea[];
   
   int parameterID;
 };
@@ -85,9 +85,9 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <ElementalLoad.h>
 #include <elementAPI.h>
 
-Matrix ElasticForceBeamColumnWarping2d::theMatrix(8,8);
-Vector ElasticForceBeamColumnWarping2d::theVector(10);
-double ElasticForceBeamColumnWarping2d::workArea[200];
+thread_local Matrix ElasticForceBeamColumnWarping2d::theMatrix(8,8);
+thread_local Vector ElasticForceBeamColumnWarping2d::theVector(10);
+thread_local double ElasticForceBeamColumnWarping2d::workArea[200];
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ElasticForceBeamColumnWarping2d)
 {
@@ -357,11 +357,11 @@ int ElasticForceBeamColumnWarping2d::revertToStart()
 const Matrix &
 ElasticForceBeamColumnWarping2d::getInitialStiff(void)
 {
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
@@ -369,15 +369,15 @@ ElasticForceBeamColumnWarping2d::getInitialStiff(void)
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ElasticForceBeamColumnWarping2d::getInitialStiff() -- could not invert flexibility\n";
   */
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   f.Invert(kvInit); 
   
-  static Vector SeInit(NEBD);
+  static thread_local Vector SeInit(NEBD);
   SeInit.Zero();
   return crdTransf->getGlobalStiffMatrix(kvInit, SeInit);
  }
@@ -386,11 +386,11 @@ const Matrix &
 ElasticForceBeamColumnWarping2d::getTangentStiff(void)
 {
   crdTransf->update();	// Will remove once we clean up the corotational 2d transformation -- MHS
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
@@ -398,15 +398,15 @@ ElasticForceBeamColumnWarping2d::getTangentStiff(void)
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ElasticForceBeamColumnWarping2d::getInitialStiff() -- could not invert flexibility\n";
   */
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   f.Invert(kvInit); 
 
-  static Vector q(NEBD);
+  static thread_local Vector q(NEBD);
   q.Zero();
   this->computeBasicForces(q); 
   return crdTransf->getGlobalStiffMatrix(kvInit, q);
@@ -465,10 +465,10 @@ ElasticForceBeamColumnWarping2d::getResistingForce(void)
   if (numEleLoads > 0)
     this->computeReactions(p0);
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
-  static Vector Se(NEBD);
+  static thread_local Vector Se(NEBD);
   this->computeBasicForces(Se);
 
   return crdTransf->getGlobalResistingForce(Se, p0Vec);
@@ -482,7 +482,7 @@ ElasticForceBeamColumnWarping2d::computeBasicForces(Vector &q)
     return;
   }
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f); 
   
   const Vector &v = crdTransf->getBasicTrialDisp(); 
@@ -496,7 +496,7 @@ ElasticForceBeamColumnWarping2d::update()
 {
 	int ok = crdTransf->update();
 	
-	static Vector q(NEBD);
+	static thread_local Vector q(NEBD);
 	q.Zero();
 	this->computeBasicForces(q);
 	double L = crdTransf->getInitialLength();
@@ -533,9 +533,9 @@ ElasticForceBeamColumnWarping2d::update()
 		double xL  = xi[i];
 	    double xL1 = xL-1.0;
 
-	    static Vector s;
+	    static thread_local Vector s;
 	    s.setData(workArea, order);
-		static Vector e;
+		static thread_local Vector e;
 		e.setData(&workArea[order], order);
 
 	    int ii;
@@ -956,7 +956,7 @@ ElasticForceBeamColumnWarping2d::getInitialFlexibility(Matrix &fe)
 /*void ElasticForceBeamColumnWarping2d::compSectionDisplacements(Vector sectionCoords[], Vector sectionDispls[]) const
 {
    // get basic displacements and increments
-   static Vector ub(NEBD);
+   static thread_local Vector ub(NEBD);
    ub = crdTransf->getBasicTrialDisp();    
 
    double L = crdTransf->getInitialLength();
@@ -964,7 +964,7 @@ ElasticForceBeamColumnWarping2d::getInitialFlexibility(Matrix &fe)
    // get integration point positions and weights
    //   const Matrix &xi_pt  = quadRule.getIntegrPointCoords(numSections);
    // get integration point positions and weights
-   static double xi_pts[maxNumSections];
+   static thread_local double xi_pts[maxNumSections];
    beamIntegr->getSectionLocations(numSections, L, xi_pts);
 
    // setup Vandermode and CBDI influence matrices
@@ -977,7 +977,7 @@ ElasticForceBeamColumnWarping2d::getInitialFlexibility(Matrix &fe)
 
    // get section curvatures
    Vector kappa(numSections);  // curvature
-   static Vector vs;              // section deformations 
+   static thread_local Vector vs;              // section deformations 
 
    for (i=0; i<numSections; i++)
    {
@@ -1003,8 +1003,8 @@ ElasticForceBeamColumnWarping2d::getInitialFlexibility(Matrix &fe)
    }
 
    Vector w(numSections);
-   static Vector xl(NDM), uxb(NDM);
-   static Vector xg(NDM), uxg(NDM); 
+   static thread_local Vector xl(NDM), uxb(NDM);
+   static thread_local Vector xg(NDM), uxg(NDM); 
 
    // w = ls * kappa;  
    w.addMatrixVector (0.0, ls, kappa, 1.0);
@@ -1032,9 +1032,9 @@ ElasticForceBeamColumnWarping2d::getInitialFlexibility(Matrix &fe)
 void
 ElasticForceBeamColumnWarping2d::Print(OPS_Stream &s, int flag)
 {
-  static Vector Se(NEBD);
-  static Vector vp(NEBD);
-  static Matrix fe(NEBD,NEBD);
+  static thread_local Vector Se(NEBD);
+  static thread_local Vector vp(NEBD);
+  static thread_local Matrix fe(NEBD,NEBD);
 
   if (flag == 2) {
 
@@ -1409,9 +1409,9 @@ ElasticForceBeamColumnWarping2d::setResponse(const char **argv, int argc, OPS_St
 int 
 ElasticForceBeamColumnWarping2d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector Se(NEBD);
-  static Vector vp(NEBD);
-  static Matrix fe(NEBD,NEBD);
+  static thread_local Vector Se(NEBD);
+  static thread_local Vector vp(NEBD);
+  static thread_local Matrix fe(NEBD,NEBD);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
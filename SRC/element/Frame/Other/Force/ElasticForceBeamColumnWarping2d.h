@@ -170,9 +170,9 @@ class ElasticForceBeamColumnWarping2d: public Element
   ElementalLoad **eleLoads;
   double *eleLoadFactors;
 
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
+  static thread_local Matrix theMatrix;
+  static thread_local Vector theVector;
+  static thread_local double workArea[];
   
   int parameterID;
 };
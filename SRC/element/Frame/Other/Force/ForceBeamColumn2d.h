@@ -109,6 +109,7 @@ class ForceBeamColumn2d: public Element
   
   const Vector &getResistingForce(void);
   const Vector &getResistingForceIncInertia(void);            
+  bool hasOnlyRayleighDamping() const {return true;}
   
   int sendSelf(int cTag, Channel &theChannel);
   int recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
@@ -194,16 +195,16 @@ class ForceBeamColumn2d: public Element
 
   Matrix *Ki;
   
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
+  static thread_local Matrix theMatrix;
+  static thread_local Vector theVector;
+  static thread_local double workArea[];
 
   // following are added for subdivision of displacement increment
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
   
-  static Vector vsSubdivide[];
-  static Vector SsrSubdivide[];
-  static Matrix fsSubdivide[];
+  static thread_local Vector vsSubdivide[];
+  static thread_local Vector SsrSubdivide[];
+  static thread_local Matrix fsSubdivide[];
   //static int maxNumSections;
 
   // AddingSensitivity:BEGIN //////////////////////////////////////////
@@ -83,13 +83,13 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <ThermalActionWrapper.h>
 
 
-Matrix ForceBeamColumn2dThermal::theMatrix(6,6);
-Vector ForceBeamColumn2dThermal::theVector(6);
-double ForceBeamColumn2dThermal::workArea[200];
+thread_local Matrix ForceBeamColumn2dThermal::theMatrix(6,6);
+thread_local Vector ForceBeamColumn2dThermal::theVector(6);
+thread_local double ForceBeamColumn2dThermal::workArea[200];
 
-Vector ForceBeamColumn2dThermal::vsSubdivide[maxNumSections];
-Matrix ForceBeamColumn2dThermal::fsSubdivide[maxNumSections];
-Vector ForceBeamColumn2dThermal::SsrSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumn2dThermal::vsSubdivide[maxNumSections];
+thread_local Matrix ForceBeamColumn2dThermal::fsSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumn2dThermal::SsrSubdivide[maxNumSections];
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ForceBeamColumn2dThermal)
 {
@@ -467,11 +467,11 @@ ForceBeamColumn2dThermal::getInitialStiff(void)
     Ki = new Matrix(this->getTangentStiff());
   */
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
@@ -479,12 +479,12 @@ ForceBeamColumn2dThermal::getInitialStiff(void)
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ForceBeamColumn2dThermal::getInitialStiff() -- could not invert flexibility\n";
   */
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   f.Invert(kvInit);
   Ki = new Matrix(crdTransf->getInitialGlobalStiffMatrix(kvInit));
 
@@ -799,7 +799,7 @@ ForceBeamColumn2dThermal::update()
   // get basic displacements and increments
   const Vector &v = crdTransf->getBasicTrialDisp();    
 
-  static Vector dv(NEBD);
+  static thread_local Vector dv(NEBD);
 
   dv = crdTransf->getBasicIncrDeltaDisp();   
 #ifdef _BDEBUG
@@ -809,7 +809,7 @@ ForceBeamColumn2dThermal::update()
   if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && numEleLoads == 0)
     return 0;
   }
-  static Vector vin(NEBD);
+  static thread_local Vector vin(NEBD);
   vin = v;
   vin -= dv;
 
@@ -822,10 +822,10 @@ ForceBeamColumn2dThermal::update()
   double wt[maxNumSections];
   beamIntegr->getSectionWeights(numSections, L, wt);
 
-  static Vector vr(NEBD);       // element residual displacements
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix
+  static thread_local Vector vr(NEBD);       // element residual displacements
+  static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
   double dW;                    // section strain energy (work) norm 
   int i, j;
   
@@ -835,11 +835,11 @@ ForceBeamColumn2dThermal::update()
 
   int numSubdivide = 1;
   bool converged = false;
-  static Vector dSe(NEBD);
-  static Vector dvToDo(NEBD);
-  static Vector dvTrial(NEBD);
-  static Vector SeTrial(NEBD);
-  static Matrix kvTrial(NEBD, NEBD);
+  static thread_local Vector dSe(NEBD);
+  static thread_local Vector dvToDo(NEBD);
+  static thread_local Vector dvTrial(NEBD);
+  static thread_local Vector SeTrial(NEBD);
+  static thread_local Matrix kvTrial(NEBD, NEBD);
 
   dvToDo = dv;
   dvTrial = dvToDo;
@@ -922,10 +922,10 @@ ForceBeamColumn2dThermal::update()
 	    int order      = sections[i]->getOrder();
 	    const ID &code = sections[i]->getType();
 	    
-	    static Vector Ss;
-	    static Vector dSs;
-	    static Vector dvs;
-	    static Matrix fb;
+	    static thread_local Vector Ss;
+	    static thread_local Vector dSs;
+	    static thread_local Vector dvs;
+	    static thread_local Matrix fb;
 	    
 	    Ss.setData(workArea, order);
 	    dSs.setData(&workArea[order], order);
@@ -1632,7 +1632,7 @@ ForceBeamColumn2dThermal::sendSelf(int commitTag, Channel &theChannel)
   int i, j , k;
   int loc = 0;
 
-  static ID idData(11);  // one bigger than needed so no clash later
+  static thread_local ID idData(11);  // one bigger than needed so no clash later
   idData(0) = this->getTag();
   idData(1) = connectedExternalNodes(0);
   idData(2) = connectedExternalNodes(1);
@@ -1767,7 +1767,7 @@ ForceBeamColumn2dThermal::recvSelf(int commitTag, Channel &theChannel, FEM_Objec
   int dbTag = this->getDbTag();
   int i,j,k;
   
-  static ID idData(11); // one bigger than needed 
+  static thread_local ID idData(11); // one bigger than needed 
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0)  {
     opserr << "ForceBeamColumn2dThermal::recvSelf() - failed to recv ID data\n";
@@ -2142,7 +2142,7 @@ ForceBeamColumn2dThermal::getInitialDeformations(Vector &v0)
     double xL1 = xL-1.0;
     double wtL = wt[i]*L;
 
-    static Vector sp;
+    static thread_local Vector sp;
     sp.setData(workArea, order);
     sp.Zero();
 
@@ -2150,7 +2150,7 @@ ForceBeamColumn2dThermal::getInitialDeformations(Vector &v0)
 
     const Matrix &fse = sections[i]->getInitialFlexibility();
 
-    static Vector e;
+    static thread_local Vector e;
     e.setData(&workArea[order], order);
 
     e.addMatrixVector(0.0, fse, sp, 1.0);
@@ -2181,7 +2181,7 @@ ForceBeamColumn2dThermal::getInitialDeformations(Vector &v0)
 void ForceBeamColumn2dThermal::compSectionDisplacements(Vector sectionCoords[], Vector sectionDispls[]) const
 {
    // get basic displacements and increments
-   static Vector ub(NEBD);
+   static thread_local Vector ub(NEBD);
    ub = crdTransf->getBasicTrialDisp();    
 
    double L = crdTransf->getInitialLength();
@@ -2189,7 +2189,7 @@ void ForceBeamColumn2dThermal::compSectionDisplacements(Vector sectionCoords[],
    // get integration point positions and weights
    //   const Matrix &xi_pt  = quadRule.getIntegrPointCoords(numSections);
    // get integration point positions and weights
-   static double xi_pts[maxNumSections];
+   static thread_local double xi_pts[maxNumSections];
    beamIntegr->getSectionLocations(numSections, L, xi_pts);
 
    // setup Vandermode and CBDI influence matrices
@@ -2202,7 +2202,7 @@ void ForceBeamColumn2dThermal::compSectionDisplacements(Vector sectionCoords[],
 
    // get section curvatures
    Vector kappa(numSections);  // curvature
-   static Vector vs;              // section deformations 
+   static thread_local Vector vs;              // section deformations 
 
    for (i=0; i<numSections; i++)
    {
@@ -2228,8 +2228,8 @@ void ForceBeamColumn2dThermal::compSectionDisplacements(Vector sectionCoords[],
    }
 
    Vector w(numSections);
-   static Vector xl(NDM), uxb(NDM);
-   static Vector xg(NDM), uxg(NDM); 
+   static thread_local Vector xl(NDM), uxb(NDM);
+   static thread_local Vector xg(NDM), uxg(NDM); 
 
    // w = ls * kappa;  
    w.addMatrixVector (0.0, ls, kappa, 1.0);
@@ -2286,8 +2286,8 @@ ForceBeamColumn2dThermal::Print(OPS_Stream &s, int flag)
     s << "#END_FORCES " << P << " " << -V+p0[2] << " " << M2 << endln;
 
     // plastic hinge rotation
-    static Vector vp(3);
-    static Matrix fe(3,3);
+    static thread_local Vector vp(3);
+    static thread_local Matrix fe(3,3);
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -2446,8 +2446,8 @@ ForceBeamColumn2dThermal::setSectionPointers(int numSec, SectionForceDeformation
 int
 ForceBeamColumn2dThermal::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **displayModes, int numModes)
 {
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -2669,8 +2669,8 @@ ForceBeamColumn2dThermal::setResponse(const char **argv, int argc, OPS_Stream &o
 int 
 ForceBeamColumn2dThermal::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(3);
-  static Matrix fe(3,3);
+  static thread_local Vector vp(3);
+  static thread_local Matrix fe(3,3);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -2708,7 +2708,7 @@ ForceBeamColumn2dThermal::getResponse(int responseID, Information &eleInfo)
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
-    static Vector v0(3);
+    static thread_local Vector v0(3);
     this->getInitialDeformations(v0);
     vp.addVector(1.0, v0, -1.0);
     return eleInfo.setVector(vp);
@@ -2778,7 +2778,7 @@ ForceBeamColumn2dThermal::getResponse(int responseID, Information &eleInfo)
     
     d3 += beamIntegr->getTangentDriftJ(L, LI, Se(1), Se(2));
 
-    static Vector d(2);
+    static thread_local Vector d(2);
     d(0) = d2;
     d(1) = d3;
 
@@ -2841,7 +2841,7 @@ ForceBeamColumn2dThermal::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(3);
+    static thread_local Vector dqdh(3);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
@@ -2866,7 +2866,7 @@ ForceBeamColumn2dThermal::getResponseSensitivity(int responseID, int gradNumber,
       this->computeSectionForceSensitivity(dsdh, sectionNum-1, gradNumber);
     }
     //opserr << "FBC2d::getRespSens dspdh: " << dsdh;
-    static Vector dqdh(3);
+    static thread_local Vector dqdh(3);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
@@ -2943,14 +2943,14 @@ ForceBeamColumn2dThermal::getResponseSensitivity(int responseID, int gradNumber,
 
   // Plastic deformation sensitivity
   else if (responseID == 4) {
-    static Vector dvpdh(3);
+    static thread_local Vector dvpdh(3);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
     dvpdh = dvdh;
     //opserr << dvpdh;
 
-    static Matrix fe(3,3);
+    static thread_local Matrix fe(3,3);
     this->getInitialFlexibility(fe);
 
     const Vector &dqdh = this->computedqdh(gradNumber);
@@ -2958,7 +2958,7 @@ ForceBeamColumn2dThermal::getResponseSensitivity(int responseID, int gradNumber,
     dvpdh.addMatrixVector(1.0, fe, dqdh, -1.0);
     //opserr << dvpdh;
 
-    static Matrix fek(3,3);
+    static thread_local Matrix fek(3,3);
     fek.addMatrixProduct(0.0, fe, kv, 1.0);
 
     dvpdh.addMatrixVector(1.0, fek, dvdh, -1.0);
@@ -3103,7 +3103,7 @@ ForceBeamColumn2dThermal::getMassSensitivity(int gradNumber)
 const Vector&
 ForceBeamColumn2dThermal::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh = this->computedqdh(gradNumber);
 
   // Transform forces
@@ -3111,7 +3111,7 @@ ForceBeamColumn2dThermal::getResistingForceSensitivity(int gradNumber)
   this->computeReactionSensitivity(dp0dh, gradNumber);
   Vector dp0dhVec(dp0dh, 3);
 
-  static Vector P(6);
+  static thread_local Vector P(6);
   P.Zero();
 
   if (crdTransf->isShapeSensitivity()) {
@@ -3150,7 +3150,7 @@ ForceBeamColumn2dThermal::commitSensitivity(int gradNumber, int numGrads)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh = this->computedqdh(gradNumber);
 
   // dvdh = A dudh + dAdh u
@@ -3249,7 +3249,7 @@ ForceBeamColumn2dThermal::computedqdh(int gradNumber)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dvdh(3);
+  static thread_local Vector dvdh(3);
   dvdh.Zero();
 
   // Loop over the integration points
@@ -3344,7 +3344,7 @@ ForceBeamColumn2dThermal::computedqdh(int gradNumber)
     }
   }
 
-  static Matrix dfedh(3,3);
+  static thread_local Matrix dfedh(3,3);
   dfedh.Zero();
 
   if (beamIntegr->addElasticFlexDeriv(L, dfedh, dLdh) < 0)
@@ -3352,7 +3352,7 @@ ForceBeamColumn2dThermal::computedqdh(int gradNumber)
   
   //opserr << "dfedh: " << dfedh << endln;
 
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh.addMatrixVector(0.0, kv, dvdh, 1.0);
   
   //opserr << "dqdh: " << dqdh << endln;
@@ -3363,7 +3363,7 @@ ForceBeamColumn2dThermal::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumn2dThermal::computedfedh(int gradNumber)
 {
-  static Matrix dfedh(3,3);
+  static thread_local Matrix dfedh(3,3);
 
   dfedh.Zero();
 
@@ -193,9 +193,9 @@ class ForceBeamColumn2dThermal: public Element
 
   Matrix *Ki;
   
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
+  static thread_local Matrix theMatrix;
+  static thread_local Vector theVector;
+  static thread_local double workArea[];
   
   enum {maxNumSections = 20};
   enum {maxSectionOrder = 5};
@@ -203,9 +203,9 @@ class ForceBeamColumn2dThermal: public Element
   // following are added for subdivision of displacement increment
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
   
-  static Vector vsSubdivide[];
-  static Vector SsrSubdivide[];
-  static Matrix fsSubdivide[];
+  static thread_local Vector vsSubdivide[];
+  static thread_local Vector SsrSubdivide[];
+  static thread_local Matrix fsSubdivide[];
   Vector *Vsth0;
   //static int maxNumSections;
 
@@ -86,13 +86,13 @@ using std::ifstream;
 
 #define DefaultLoverGJ 1.0e-10
 
-Matrix ForceBeamColumn3dThermal::theMatrix(12,12);
-Vector ForceBeamColumn3dThermal::theVector(12);
-double ForceBeamColumn3dThermal::workArea[200];
+thread_local Matrix ForceBeamColumn3dThermal::theMatrix(12,12);
+thread_local Vector ForceBeamColumn3dThermal::theVector(12);
+thread_local double ForceBeamColumn3dThermal::workArea[200];
 
-Vector ForceBeamColumn3dThermal::vsSubdivide[maxNumSections];
-Matrix ForceBeamColumn3dThermal::fsSubdivide[maxNumSections];
-Vector ForceBeamColumn3dThermal::SsrSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumn3dThermal::vsSubdivide[maxNumSections];
+thread_local Matrix ForceBeamColumn3dThermal::fsSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumn3dThermal::SsrSubdivide[maxNumSections];
 
 void* OPS_ForceBeamColumn3dThermal()
 {
@@ -765,17 +765,17 @@ ForceBeamColumn3dThermal::getInitialStiff(void)
   if (Ki != 0)
     return *Ki;
 
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
   
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ForceBeamColumn3dThermal::getInitialStiff() -- could not invert flexibility for element with tag: " << this->getTag() << endln;
 
@@ -1182,13 +1182,13 @@ void
     // get basic displacements and increments
     const Vector &v = crdTransf->getBasicTrialDisp();    
 
-    static Vector dv(NEBD);
+    static thread_local Vector dv(NEBD);
     dv = crdTransf->getBasicIncrDeltaDisp();    
 
     if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && numEleLoads == 0)
       return 0;
 
-    static Vector vin(NEBD);
+    static thread_local Vector vin(NEBD);
     vin = v;
     vin -= dv;
     double L = crdTransf->getInitialLength();
@@ -1200,10 +1200,10 @@ void
     double wt[maxNumSections];
     beamIntegr->getSectionWeights(numSections, L, wt);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    static thread_local Vector vr(NEBD);       // element residual displacements
+    static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW;                    // section strain energy (work) norm 
     int i, j;
 
@@ -1213,11 +1213,11 @@ void
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static Vector SeTrial(NEBD);
-    static Matrix kvTrial(NEBD, NEBD);
+    static thread_local Vector dSe(NEBD);
+    static thread_local Vector dvToDo(NEBD);
+    static thread_local Vector dvTrial(NEBD);
+    static thread_local Vector SeTrial(NEBD);
+    static thread_local Matrix kvTrial(NEBD, NEBD);
 
     dvToDo = dv;
     dvTrial = dvToDo;
@@ -1277,10 +1277,10 @@ void
 	  int order      = sections[i]->getOrder();
 	  const ID &code = sections[i]->getType();
 	  
-	  static Vector Ss;
-	  static Vector dSs;
-	  static Vector dvs;
-	  static Matrix fb;
+	  static thread_local Vector Ss;
+	  static thread_local Vector dSs;
+	  static thread_local Vector dvs;
+	  static thread_local Matrix fb;
 	  
 	  Ss.setData(workArea, order);
 	  dSs.setData(&workArea[order], order);
@@ -2238,7 +2238,7 @@ ForceBeamColumn3dThermal::computeSectionForceSensitivity(Vector &dspdh, int isec
     int i, j , k;
     int loc = 0;
 
-    static ID idData(15);  
+    static thread_local ID idData(15);  
     idData(0) = this->getTag();
     idData(1) = connectedExternalNodes(0);
     idData(2) = connectedExternalNodes(1);
@@ -2397,7 +2397,7 @@ ForceBeamColumn3dThermal::computeSectionForceSensitivity(Vector &dspdh, int isec
     int dbTag = this->getDbTag();
     int i,j,k;
 
-    static ID idData(15); // one bigger than needed 
+    static thread_local ID idData(15); // one bigger than needed 
 
     if (theChannel.recvID(dbTag, commitTag, idData) < 0)  {
       opserr << "ForceBeamColumn3dThermal::recvSelf() - failed to recv ID data\n";
@@ -2846,7 +2846,7 @@ ForceBeamColumn3dThermal::getInitialDeformations(Vector &v0)
       double xL1 = xL - 1.0;
       double wtL = wt[i] * L;
 
-      static Vector sp;
+      static thread_local Vector sp;
       sp.setData(workArea, order);
       sp.Zero();
 
@@ -2854,7 +2854,7 @@ ForceBeamColumn3dThermal::getInitialDeformations(Vector &v0)
 
       const Matrix &fse = sections[i]->getInitialFlexibility();
 
-      static Vector e;
+      static thread_local Vector e;
       e.setData(&workArea[order], order);
 
       e.addMatrixVector(0.0, fse, sp, 1.0);
@@ -2894,13 +2894,13 @@ ForceBeamColumn3dThermal::getInitialDeformations(Vector &v0)
 					      Vector sectionDispls[]) const
   {
      // get basic displacements and increments
-     static Vector ub(NEBD);
+     static thread_local Vector ub(NEBD);
      ub = crdTransf->getBasicTrialDisp();    
 
      double L = crdTransf->getInitialLength();
 
      // get integration point positions and weights
-     static double pts[maxNumSections];
+     static thread_local double pts[maxNumSections];
      beamIntegr->getSectionLocations(numSections, L, pts);
 
      // setup Vandermode and CBDI influence matrices
@@ -2914,7 +2914,7 @@ ForceBeamColumn3dThermal::getInitialDeformations(Vector &v0)
      // get section curvatures
      Vector kappa_y(numSections);  // curvature
      Vector kappa_z(numSections);  // curvature
-     static Vector vs;                // section deformations 
+     static thread_local Vector vs;                // section deformations 
 
      for (i=0; i<numSections; i++) {
 	 // THIS IS VERY INEFFICIENT ... CAN CHANGE IF RUNS TOO SLOW
@@ -2949,8 +2949,8 @@ ForceBeamColumn3dThermal::getInitialDeformations(Vector &v0)
      //cout << "kappa_z: " << kappa_z;   
 
      Vector v(numSections), w(numSections);
-     static Vector xl(NDM), uxb(NDM);
-     static Vector xg(NDM), uxg(NDM); 
+     static thread_local Vector xl(NDM), uxb(NDM);
+     static thread_local Vector xg(NDM), uxg(NDM); 
      // double theta;                             // angle of twist of the sections
 
      // v = ls * kappa_z;  
@@ -3025,9 +3025,9 @@ ForceBeamColumn3dThermal::getInitialDeformations(Vector &v0)
 
     // flag set to 2 used to print everything .. used for viewing data for UCSD renderer  
     else if (flag == 2) {
-       static Vector xAxis(3);
-       static Vector yAxis(3);
-       static Vector zAxis(3);
+       static thread_local Vector xAxis(3);
+       static thread_local Vector yAxis(3);
+       static thread_local Vector zAxis(3);
 
 
        crdTransf->getLocalAxes(xAxis, yAxis, zAxis);
@@ -3072,8 +3072,8 @@ ForceBeamColumn3dThermal::getInitialDeformations(Vector &v0)
 	 << T << ' ' << MY2 << ' '  <<  MZ2 << endln;
 
        // plastic hinge rotation
-       static Vector vp(6);
-       static Matrix fe(6,6);
+       static thread_local Vector vp(6);
+       static thread_local Matrix fe(6,6);
        this->getInitialFlexibility(fe);
        vp = crdTransf->getBasicTrialDisp();
        vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -3184,8 +3184,8 @@ ForceBeamColumn3dThermal::getInitialDeformations(Vector &v0)
   int
   ForceBeamColumn3dThermal::displaySelf(Renderer &theViewer, int displayMode, float fact, const char** displayModes, int numModes)
   {
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -3507,8 +3507,8 @@ ForceBeamColumn3dThermal::getInitialDeformations(Vector &v0)
 int 
 ForceBeamColumn3dThermal::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(6);
-  static Matrix fe(6,6);
+  static thread_local Vector vp(6);
+  static thread_local Matrix fe(6,6);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -3668,8 +3668,8 @@ ForceBeamColumn3dThermal::getResponse(int responseID, Information &eleInfo)
     dispsy.addMatrixVector(0.0, ls, kappaz,  1.0);
     dispsz.addMatrixVector(0.0, ls, kappay, -1.0);    
     beamIntegr->getSectionLocations(numSections, L, pts);
-    static Vector uxb(3);
-    static Vector uxg(3);
+    static thread_local Vector uxb(3);
+    static thread_local Vector uxg(3);
     Matrix disps(numSections,3);
     vp = crdTransf->getBasicTrialDisp();
     for (int i = 0; i < numSections; i++) {
@@ -3715,8 +3715,8 @@ ForceBeamColumn3dThermal::getResponse(int responseID, Information &eleInfo)
     Vector dispsz(1); // along local z    
     dispsy.addMatrixVector(0.0, ls, kappaz,  1.0);
     dispsz.addMatrixVector(0.0, ls, kappay, -1.0);
-    static Vector uxb(3);
-    static Vector uxg(3);
+    static thread_local Vector uxb(3);
+    static thread_local Vector uxg(3);
     Matrix disps(1,3);
     vp = crdTransf->getBasicTrialDisp();
     uxb(0) = pts[0]*vp(0); // linear shape function
@@ -3735,7 +3735,7 @@ ForceBeamColumn3dThermal::getResponse(int responseID, Information &eleInfo)
 
   // Point of inflection
   else if (responseID == 5) {
-    static Vector LI(2);
+    static thread_local Vector LI(2);
     LI(0) = 0.0;
     LI(1) = 0.0;
 
@@ -3819,7 +3819,7 @@ ForceBeamColumn3dThermal::getResponse(int responseID, Information &eleInfo)
       }
     }
 
-    static Vector d(4);
+    static thread_local Vector d(4);
     d(0) = d2z;
     d(1) = d3z;
     d(2) = d2y;
@@ -3933,7 +3933,7 @@ ForceBeamColumn3dThermal::getResponse(int responseID, Information &eleInfo)
 	indata.close();
       }
 
-      static Vector result8(2);
+      static thread_local Vector result8(2);
       result8(0) = value;
       result8(1) = checkvalue1;      
       
@@ -3970,7 +3970,7 @@ ForceBeamColumn3dThermal::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(6);
+    static thread_local Vector dqdh(6);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
@@ -3995,7 +3995,7 @@ ForceBeamColumn3dThermal::getResponseSensitivity(int responseID, int gradNumber,
       this->computeSectionForceSensitivity(dsdh, sectionNum-1, gradNumber);
     }
     //opserr << "FBC3d::getRespSens dspdh: " << dsdh;
-    static Vector dqdh(6);
+    static thread_local Vector dqdh(6);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
@@ -4088,14 +4088,14 @@ ForceBeamColumn3dThermal::getResponseSensitivity(int responseID, int gradNumber,
 
   // Plastic deformation sensitivity
   else if (responseID == 4) {
-    static Vector dvpdh(6);
+    static thread_local Vector dvpdh(6);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
     dvpdh = dvdh;
     //opserr << dvpdh;
 
-    static Matrix fe(6,6);
+    static thread_local Matrix fe(6,6);
     this->getInitialFlexibility(fe);
 
     const Vector &dqdh = this->computedqdh(gradNumber);
@@ -4103,7 +4103,7 @@ ForceBeamColumn3dThermal::getResponseSensitivity(int responseID, int gradNumber,
     dvpdh.addMatrixVector(1.0, fe, dqdh, -1.0);
     //opserr << dvpdh;
 
-    static Matrix fek(6,6);
+    static thread_local Matrix fek(6,6);
     fek.addMatrixProduct(0.0, fe, kv, 1.0);
 
     dvpdh.addMatrixVector(1.0, fek, dvdh, -1.0);
@@ -4260,7 +4260,7 @@ ForceBeamColumn3dThermal::getMassSensitivity(int gradNumber)
 const Vector&
 ForceBeamColumn3dThermal::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh = this->computedqdh(gradNumber);
 
   // Transform forces
@@ -4270,7 +4270,7 @@ ForceBeamColumn3dThermal::getResistingForceSensitivity(int gradNumber)
   this->computeReactionSensitivity(dp0dh, gradNumber);
   Vector dp0dhVec(dp0dh, 6);
 
-  static Vector P(12);
+  static thread_local Vector P(12);
   P.Zero();
 
   if (crdTransf->isShapeSensitivity()) {
@@ -4308,7 +4308,7 @@ ForceBeamColumn3dThermal::commitSensitivity(int gradNumber, int numGrads)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh = this->computedqdh(gradNumber);
 
   // dvdh = A dudh + dAdh u
@@ -4422,7 +4422,7 @@ ForceBeamColumn3dThermal::computedqdh(int gradNumber)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dvdh(6);
+  static thread_local Vector dvdh(6);
   dvdh.Zero();
 
   // Loop over the integration points
@@ -4553,12 +4553,12 @@ ForceBeamColumn3dThermal::computedqdh(int gradNumber)
     }
   }
 
-  static Matrix dfedh(6,6);
+  static thread_local Matrix dfedh(6,6);
   dfedh.Zero();
 
   //opserr << "dfedh: " << dfedh << endln;
 
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh.addMatrixVector(0.0, kv, dvdh, 1.0);
   
   //opserr << "dqdh: " << dqdh << endln;
@@ -4569,7 +4569,7 @@ ForceBeamColumn3dThermal::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumn3dThermal::computedfedh(int gradNumber)
 {
-  static Matrix dfedh(6,6);
+  static thread_local Matrix dfedh(6,6);
 
   dfedh.Zero();
 
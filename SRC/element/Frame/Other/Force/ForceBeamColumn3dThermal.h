@@ -201,9 +201,9 @@ class ForceBeamColumn3dThermal: public Element
 
   Damping *theDamping;
   
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
+  static thread_local Matrix theMatrix;
+  static thread_local Vector theVector;
+  static thread_local double workArea[];
   
   enum {maxNumSections = 10};
   
@@ -211,9 +211,9 @@ class ForceBeamColumn3dThermal: public Element
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
   double subdivideFactor;
   
-  static Vector vsSubdivide[];
-  static Vector SsrSubdivide[];
-  static Matrix fsSubdivide[];
+  static thread_local Vector vsSubdivide[];
+  static thread_local Vector SsrSubdivide[];
+  static thread_local Matrix fsSubdivide[];
   //static int maxNumSections;
 
   // AddingSensitivity:BEGIN //////////////////////////////////////////
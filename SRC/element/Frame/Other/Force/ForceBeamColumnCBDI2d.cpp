@@ -73,13 +73,13 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <ElementalLoad.h>
 
 
-Matrix ForceBeamColumnCBDI2d::theMatrix(6,6);
-Vector ForceBeamColumnCBDI2d::theVector(6);
-double ForceBeamColumnCBDI2d::workArea[200];
+thread_local Matrix ForceBeamColumnCBDI2d::theMatrix(6,6);
+thread_local Vector ForceBeamColumnCBDI2d::theVector(6);
+thread_local double ForceBeamColumnCBDI2d::workArea[200];
 
-Vector ForceBeamColumnCBDI2d::vsSubdivide[maxNumSections];
-Matrix ForceBeamColumnCBDI2d::fsSubdivide[maxNumSections];
-Vector ForceBeamColumnCBDI2d::SsrSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumnCBDI2d::vsSubdivide[maxNumSections];
+thread_local Matrix ForceBeamColumnCBDI2d::fsSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumnCBDI2d::SsrSubdivide[maxNumSections];
 
 
 // constructor:
@@ -383,11 +383,11 @@ ForceBeamColumnCBDI2d::getInitialStiff(void)
     Ki = new Matrix(this->getTangentStiff());
   */
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
@@ -395,12 +395,12 @@ ForceBeamColumnCBDI2d::getInitialStiff(void)
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ForceBeamColumnCBDI2d::getInitialStiff() -- could not invert flexibility\n";
   */
   
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   f.Invert(kvInit);
   Ki = new Matrix(crdTransf->getInitialGlobalStiffMatrix(kvInit));
 
@@ -557,14 +557,14 @@ ForceBeamColumnCBDI2d::update()
   // get basic displacements and increments
   const Vector &v = crdTransf->getBasicTrialDisp();    
 
-  static Vector dv(NEBD);
+  static thread_local Vector dv(NEBD);
 
   dv = crdTransf->getBasicIncrDeltaDisp();    
 
   if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && numEleLoads == 0)
     return 0;
 
-  static Vector vin(NEBD);
+  static thread_local Vector vin(NEBD);
   vin = v;
   vin -= dv;
 
@@ -577,10 +577,10 @@ ForceBeamColumnCBDI2d::update()
   double wt[maxNumSections];
   beamIntegr->getSectionWeights(numSections, L, wt);
 
-  static Vector vr(NEBD);       // element residual displacements
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix
+  static thread_local Vector vr(NEBD);       // element residual displacements
+  static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
   double dW;                    // section strain energy (work) norm 
   int i, j;
   
@@ -590,11 +590,11 @@ ForceBeamColumnCBDI2d::update()
 
   int numSubdivide = 1;
   bool converged = false;
-  static Vector dSe(NEBD);
-  static Vector dvToDo(NEBD);
-  static Vector dvTrial(NEBD);
-  static Vector SeTrial(NEBD);
-  static Matrix kvTrial(NEBD, NEBD);
+  static thread_local Vector dSe(NEBD);
+  static thread_local Vector dvToDo(NEBD);
+  static thread_local Vector dvTrial(NEBD);
+  static thread_local Vector SeTrial(NEBD);
+  static thread_local Matrix kvTrial(NEBD, NEBD);
 
   dvToDo = dv;
   dvTrial = dvToDo;
@@ -1404,7 +1404,7 @@ ForceBeamColumnCBDI2d::sendSelf(int commitTag, Channel &theChannel)
   int i, j , k;
   int loc = 0;
 
-  static ID idData(11);  // one bigger than needed so no clash later
+  static thread_local ID idData(11);  // one bigger than needed so no clash later
   idData(0) = this->getTag();
   idData(1) = connectedExternalNodes(0);
   idData(2) = connectedExternalNodes(1);
@@ -1539,7 +1539,7 @@ ForceBeamColumnCBDI2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBr
   int dbTag = this->getDbTag();
   int i,j,k;
   
-  static ID idData(11); // one bigger than needed 
+  static thread_local ID idData(11); // one bigger than needed 
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0)  {
     opserr << "ForceBeamColumnCBDI2d::recvSelf() - failed to recv ID data\n";
@@ -1914,7 +1914,7 @@ ForceBeamColumnCBDI2d::getInitialDeformations(Vector &v0)
     double xL1 = xL-1.0;
     double wtL = wt[i]*L;
 
-    static Vector sp;
+    static thread_local Vector sp;
     sp.setData(workArea, order);
     sp.Zero();
 
@@ -1922,7 +1922,7 @@ ForceBeamColumnCBDI2d::getInitialDeformations(Vector &v0)
 
     const Matrix &fse = sections[i]->getInitialFlexibility();
 
-    static Vector e;
+    static thread_local Vector e;
     e.setData(&workArea[order], order);
 
     e.addMatrixVector(0.0, fse, sp, 1.0);
@@ -2408,7 +2408,7 @@ ForceBeamColumnCBDI2d::computedwdq(Matrix &dwidq, const Vector &q,
 void ForceBeamColumnCBDI2d::compSectionDisplacements(Vector sectionCoords[], Vector sectionDispls[]) const
 {
    // get basic displacements and increments
-   static Vector ub(NEBD);
+   static thread_local Vector ub(NEBD);
    ub = crdTransf->getBasicTrialDisp();    
 
    double L = crdTransf->getInitialLength();
@@ -2416,7 +2416,7 @@ void ForceBeamColumnCBDI2d::compSectionDisplacements(Vector sectionCoords[], Vec
    // get integration point positions and weights
    //   const Matrix &xi_pt  = quadRule.getIntegrPointCoords(numSections);
    // get integration point positions and weights
-   static double xi_pts[maxNumSections];
+   static thread_local double xi_pts[maxNumSections];
    beamIntegr->getSectionLocations(numSections, L, xi_pts);
 
    // setup Vandermode and CBDI influence matrices
@@ -2429,7 +2429,7 @@ void ForceBeamColumnCBDI2d::compSectionDisplacements(Vector sectionCoords[], Vec
 
    // get section curvatures
    Vector kappa(numSections);  // curvature
-   static Vector vs;              // section deformations 
+   static thread_local Vector vs;              // section deformations 
 
    for (i=0; i<numSections; i++)
    {
@@ -2455,8 +2455,8 @@ void ForceBeamColumnCBDI2d::compSectionDisplacements(Vector sectionCoords[], Vec
    }
 
    Vector w(numSections);
-   static Vector xl(NDM), uxb(NDM);
-   static Vector xg(NDM), uxg(NDM); 
+   static thread_local Vector xl(NDM), uxb(NDM);
+   static thread_local Vector xg(NDM), uxg(NDM); 
 
    // w = ls * kappa;  
    w.addMatrixVector (0.0, ls, kappa, 1.0);
@@ -2513,8 +2513,8 @@ ForceBeamColumnCBDI2d::Print(OPS_Stream &s, int flag)
     s << "#END_FORCES " << P << " " << -V+p0[2] << " " << M2 << endln;
 
     // plastic hinge rotation
-    static Vector vp(3);
-    static Matrix fe(3,3);
+    static thread_local Vector vp(3);
+    static thread_local Matrix fe(3,3);
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -2892,8 +2892,8 @@ ForceBeamColumnCBDI2d::setResponse(const char **argv, int argc, OPS_Stream &outp
 int 
 ForceBeamColumnCBDI2d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(3);
-  static Matrix fe(3,3);
+  static thread_local Vector vp(3);
+  static thread_local Matrix fe(3,3);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -2928,7 +2928,7 @@ ForceBeamColumnCBDI2d::getResponse(int responseID, Information &eleInfo)
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
-    static Vector v0(3);
+    static thread_local Vector v0(3);
     this->getInitialDeformations(v0);
     vp.addVector(1.0, v0, -1.0);
     return eleInfo.setVector(vp);
@@ -2998,7 +2998,7 @@ ForceBeamColumnCBDI2d::getResponse(int responseID, Information &eleInfo)
     
     d3 += beamIntegr->getTangentDriftJ(L, LI, Se(1), Se(2));
 
-    static Vector d(2);
+    static thread_local Vector d(2);
     d(0) = d2;
     d(1) = d3;
 
@@ -3073,8 +3073,8 @@ ForceBeamColumnCBDI2d::getResponse(int responseID, Information &eleInfo)
     Vector dispsy(numSections);
     dispsy.addMatrixVector(0.0, ls, kappa, 1.0);
     beamIntegr->getSectionLocations(numSections, L, pts);
-    static Vector uxb(2);
-    static Vector uxg(2);
+    static thread_local Vector uxb(2);
+    static thread_local Vector uxg(2);
     Matrix disps(numSections,3);
     vp = crdTransf->getBasicTrialDisp();
     for (int i = 0; i < numSections; i++) {
@@ -3111,8 +3111,8 @@ ForceBeamColumnCBDI2d::getResponse(int responseID, Information &eleInfo)
     // Displacement vector
     Vector dispsy(20);
     dispsy.addMatrixVector(0.0, ls, kappa, 1.0);
-    static Vector uxb(2);
-    static Vector uxg(2);
+    static thread_local Vector uxb(2);
+    static thread_local Vector uxg(2);
     Matrix disps(20,3);
     vp = crdTransf->getBasicTrialDisp();
     for (int i = 0; i < 20; i++) {
@@ -3142,7 +3142,7 @@ ForceBeamColumnCBDI2d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(3);
+    static thread_local Vector dqdh(3);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
@@ -3167,7 +3167,7 @@ ForceBeamColumnCBDI2d::getResponseSensitivity(int responseID, int gradNumber,
       this->computeSectionForceSensitivity(dsdh, sectionNum-1, gradNumber);
     }
     //opserr << "FBC2d::getRespSens dspdh: " << dsdh;
-    static Vector dqdh(NEBD);
+    static thread_local Vector dqdh(NEBD);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
@@ -3310,14 +3310,14 @@ ForceBeamColumnCBDI2d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Plastic deformation sensitivity
   else if (responseID == 4) {
-    static Vector dvpdh(3);
+    static thread_local Vector dvpdh(3);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
     dvpdh = dvdh;
     //opserr << dvpdh;
 
-    static Matrix fe(3,3);
+    static thread_local Matrix fe(3,3);
     this->getInitialFlexibility(fe);
 
     const Vector &dqdh = this->computedqdh(gradNumber);
@@ -3325,7 +3325,7 @@ ForceBeamColumnCBDI2d::getResponseSensitivity(int responseID, int gradNumber,
     dvpdh.addMatrixVector(1.0, fe, dqdh, -1.0);
     //opserr << dvpdh;
 
-    static Matrix fek(3,3);
+    static thread_local Matrix fek(3,3);
     fek.addMatrixProduct(0.0, fe, kv, 1.0);
 
     dvpdh.addMatrixVector(1.0, fek, dvdh, -1.0);
@@ -3469,7 +3469,7 @@ ForceBeamColumnCBDI2d::getMassSensitivity(int gradNumber)
 const Vector&
 ForceBeamColumnCBDI2d::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh = this->computedqdh(gradNumber);
 
   // Transform forces
@@ -3477,7 +3477,7 @@ ForceBeamColumnCBDI2d::getResistingForceSensitivity(int gradNumber)
   this->computeReactionSensitivity(dp0dh, gradNumber);
   Vector dp0dhVec(dp0dh, 3);
 
-  static Vector P(6);
+  static thread_local Vector P(6);
   P.Zero();
 
   if (crdTransf->isShapeSensitivity()) {
@@ -3515,7 +3515,7 @@ ForceBeamColumnCBDI2d::commitSensitivity(int gradNumber, int numGrads)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh = this->computedqdh(gradNumber);
 
   // dvdh = A dudh + dAdh u
@@ -3671,7 +3671,7 @@ ForceBeamColumnCBDI2d::computedqdh(int gradNumber)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dvdh(NEBD);
+  static thread_local Vector dvdh(NEBD);
   dvdh.Zero();
 
   Vector kappa(numSections);
@@ -3805,7 +3805,7 @@ ForceBeamColumnCBDI2d::computedqdh(int gradNumber)
     }
   }
 
-  static Matrix dfedh(3,3);
+  static thread_local Matrix dfedh(3,3);
   dfedh.Zero();
 
   if (beamIntegr->addElasticFlexDeriv(L, dfedh, dLdh) < 0)
@@ -3813,7 +3813,7 @@ ForceBeamColumnCBDI2d::computedqdh(int gradNumber)
   
   //opserr << "dfedh: " << dfedh << endln;
 
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh.addMatrixVector(0.0, kv, dvdh, 1.0);
   
   //opserr << "dqdh: " << dqdh << endln;
@@ -3824,7 +3824,7 @@ ForceBeamColumnCBDI2d::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumnCBDI2d::computedfedh(int gradNumber)
 {
-  static Matrix dfedh(3,3);
+  static thread_local Matrix dfedh(3,3);
 
   dfedh.Zero();
 
@@ -72,13 +72,13 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <CompositeResponse.h>
 #include <ElementalLoad.h>
 
-Matrix ForceBeamColumnCBDI3d::theMatrix(12,12);
-Vector ForceBeamColumnCBDI3d::theVector(12);
-double ForceBeamColumnCBDI3d::workArea[800];
+thread_local Matrix ForceBeamColumnCBDI3d::theMatrix(12,12);
+thread_local Vector ForceBeamColumnCBDI3d::theVector(12);
+thread_local double ForceBeamColumnCBDI3d::workArea[800];
 
-Vector ForceBeamColumnCBDI3d::vsSubdivide[maxNumSections];
-Matrix ForceBeamColumnCBDI3d::fsSubdivide[maxNumSections];
-Vector ForceBeamColumnCBDI3d::SsrSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumnCBDI3d::vsSubdivide[maxNumSections];
+thread_local Matrix ForceBeamColumnCBDI3d::fsSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumnCBDI3d::SsrSubdivide[maxNumSections];
 
 
 // constructor:
@@ -380,11 +380,11 @@ ForceBeamColumnCBDI3d::getInitialStiff(void)
     Ki = new Matrix(this->getTangentStiff());
   */
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
@@ -392,12 +392,12 @@ ForceBeamColumnCBDI3d::getInitialStiff(void)
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ForceBeamColumnCBDI3d::getInitialStiff() -- could not invert flexibility\n";
   */
   
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   f.Invert(kvInit);
   Ki = new Matrix(crdTransf->getInitialGlobalStiffMatrix(kvInit));
 
@@ -591,14 +591,14 @@ ForceBeamColumnCBDI3d::update()
   // get basic displacements and increments
   const Vector &v = crdTransf->getBasicTrialDisp();    
 
-  static Vector dv(NEBD);
+  static thread_local Vector dv(NEBD);
 
   dv = crdTransf->getBasicIncrDeltaDisp();    
 
   if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && numEleLoads == 0)
     return 0;
 
-  static Vector vin(NEBD);
+  static thread_local Vector vin(NEBD);
   vin = v;
   vin -= dv;
 
@@ -611,10 +611,10 @@ ForceBeamColumnCBDI3d::update()
   double wt[maxNumSections];
   beamIntegr->getSectionWeights(numSections, L, wt);
 
-  static Vector vr(NEBD);       // element residual displacements
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix
+  static thread_local Vector vr(NEBD);       // element residual displacements
+  static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
   double dW;                    // section strain energy (work) norm 
   int i, j;
   
@@ -624,11 +624,11 @@ ForceBeamColumnCBDI3d::update()
 
   int numSubdivide = 1;
   bool converged = false;
-  static Vector dSe(NEBD);
-  static Vector dvToDo(NEBD);
-  static Vector dvTrial(NEBD);
-  static Vector SeTrial(NEBD);
-  static Matrix kvTrial(NEBD, NEBD);
+  static thread_local Vector dSe(NEBD);
+  static thread_local Vector dvToDo(NEBD);
+  static thread_local Vector dvTrial(NEBD);
+  static thread_local Vector SeTrial(NEBD);
+  static thread_local Matrix kvTrial(NEBD, NEBD);
 
   dvToDo = dv;
   dvTrial = dvToDo;
@@ -1737,7 +1737,7 @@ ForceBeamColumnCBDI3d::sendSelf(int commitTag, Channel &theChannel)
   int i, j , k;
   int loc = 0;
 
-  static ID idData(11);  // one bigger than needed so no clash later
+  static thread_local ID idData(11);  // one bigger than needed so no clash later
   idData(0) = this->getTag();
   idData(1) = connectedExternalNodes(0);
   idData(2) = connectedExternalNodes(1);
@@ -1872,7 +1872,7 @@ ForceBeamColumnCBDI3d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBr
   int dbTag = this->getDbTag();
   int i,j,k;
   
-  static ID idData(11); // one bigger than needed 
+  static thread_local ID idData(11); // one bigger than needed 
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0)  {
     opserr << "ForceBeamColumnCBDI3d::recvSelf() - failed to recv ID data\n";
@@ -2261,7 +2261,7 @@ ForceBeamColumnCBDI3d::getInitialDeformations(Vector &v0)
     double xL1 = xL-1.0;
     double wtL = wt[i]*L;
 
-    static Vector sp;
+    static thread_local Vector sp;
     sp.setData(workArea, order);
     sp.Zero();
 
@@ -2269,7 +2269,7 @@ ForceBeamColumnCBDI3d::getInitialDeformations(Vector &v0)
 
     const Matrix &fse = sections[i]->getInitialFlexibility();
 
-    static Vector e;
+    static thread_local Vector e;
     e.setData(&workArea[order], order);
 
     e.addMatrixVector(0.0, fse, sp, 1.0);
@@ -2888,7 +2888,7 @@ ForceBeamColumnCBDI3d::computedwzdq(Matrix &dwzidq, const Vector &q,
 void ForceBeamColumnCBDI3d::compSectionDisplacements(Vector sectionCoords[], Vector sectionDispls[]) const
 {
    // get basic displacements and increments
-   static Vector ub(NEBD);
+   static thread_local Vector ub(NEBD);
    ub = crdTransf->getBasicTrialDisp();    
 
    double L = crdTransf->getInitialLength();
@@ -2896,7 +2896,7 @@ void ForceBeamColumnCBDI3d::compSectionDisplacements(Vector sectionCoords[], Vec
    // get integration point positions and weights
    //   const Matrix &xi_pt  = quadRule.getIntegrPointCoords(numSections);
    // get integration point positions and weights
-   static double xi_pts[maxNumSections];
+   static thread_local double xi_pts[maxNumSections];
    beamIntegr->getSectionLocations(numSections, L, xi_pts);
 
    // setup Vandermode and CBDI influence matrices
@@ -2909,7 +2909,7 @@ void ForceBeamColumnCBDI3d::compSectionDisplacements(Vector sectionCoords[], Vec
 
    // get section curvatures
    Vector kappa(numSections);  // curvature
-   static Vector vs;              // section deformations 
+   static thread_local Vector vs;              // section deformations 
 
    for (int i=0; i<numSections; i++)
    {
@@ -2934,8 +2934,8 @@ void ForceBeamColumnCBDI3d::compSectionDisplacements(Vector sectionCoords[], Vec
    }
 
    Vector w(numSections);
-   static Vector xl(NDM), uxb(NDM);
-   static Vector xg(NDM), uxg(NDM); 
+   static thread_local Vector xl(NDM), uxb(NDM);
+   static thread_local Vector xg(NDM), uxg(NDM); 
 
    // w = ls * kappa;  
    w.addMatrixVector (0.0, ls, kappa, 1.0);
@@ -2994,8 +2994,8 @@ ForceBeamColumnCBDI3d::Print(OPS_Stream &s, int flag)
     s << "#END_FORCES " << P << " " << -V+p0[2] << " " << M2 << endln;
 
     // plastic hinge rotation
-    static Vector vp(6);
-    static Matrix fe(6,6);
+    static thread_local Vector vp(6);
+    static thread_local Matrix fe(6,6);
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -3348,8 +3348,8 @@ ForceBeamColumnCBDI3d::setResponse(const char **argv, int argc, OPS_Stream &outp
 int 
 ForceBeamColumnCBDI3d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(6);
-  static Matrix fe(6,6);
+  static thread_local Vector vp(6);
+  static thread_local Matrix fe(6,6);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -3386,7 +3386,7 @@ ForceBeamColumnCBDI3d::getResponse(int responseID, Information &eleInfo)
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
-    static Vector v0(6);
+    static thread_local Vector v0(6);
     this->getInitialDeformations(v0);
     vp.addVector(1.0, v0, -1.0);
     return eleInfo.setVector(vp);
@@ -3456,7 +3456,7 @@ ForceBeamColumnCBDI3d::getResponse(int responseID, Information &eleInfo)
     
     d3 += beamIntegr->getTangentDriftJ(L, LI, Se(1), Se(2));
 
-    static Vector d(2);
+    static thread_local Vector d(2);
     d(0) = d2;
     d(1) = d3;
 
@@ -3537,8 +3537,8 @@ ForceBeamColumnCBDI3d::getResponse(int responseID, Information &eleInfo)
     dispsy.addMatrixVector(0.0, ls, kappaz,  1.0);
     dispsz.addMatrixVector(0.0, ls, kappay,  1.0);    
     beamIntegr->getSectionLocations(numSections, L, pts);
-    static Vector uxb(3);
-    static Vector uxg(3);
+    static thread_local Vector uxb(3);
+    static thread_local Vector uxg(3);
     Matrix disps(numSections,3);
     vp = crdTransf->getBasicTrialDisp();
     for (int i = 0; i < numSections; i++) {
@@ -3582,8 +3582,8 @@ ForceBeamColumnCBDI3d::getResponse(int responseID, Information &eleInfo)
     Vector dispsz(20); // along local z    
     dispsy.addMatrixVector(0.0, ls, kappaz,  1.0);
     dispsz.addMatrixVector(0.0, ls, kappay,  1.0);    
-    static Vector uxb(3);
-    static Vector uxg(3);
+    static thread_local Vector uxb(3);
+    static thread_local Vector uxg(3);
     Matrix disps(20,3);
     vp = crdTransf->getBasicTrialDisp();
     for (int i = 0; i < 20; i++) {
@@ -3613,7 +3613,7 @@ ForceBeamColumnCBDI3d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(6);
+    static thread_local Vector dqdh(6);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
@@ -3638,7 +3638,7 @@ ForceBeamColumnCBDI3d::getResponseSensitivity(int responseID, int gradNumber,
       this->computeSectionForceSensitivity(dsdh, sectionNum-1, gradNumber);
     }
     //opserr << "FBC2d::getRespSens dspdh: " << dsdh;
-    static Vector dqdh(NEBD);
+    static thread_local Vector dqdh(NEBD);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
@@ -3781,14 +3781,14 @@ ForceBeamColumnCBDI3d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Plastic deformation sensitivity
   else if (responseID == 4) {
-    static Vector dvpdh(6);
+    static thread_local Vector dvpdh(6);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
     dvpdh = dvdh;
     //opserr << dvpdh;
 
-    static Matrix fe(6,6);
+    static thread_local Matrix fe(6,6);
     this->getInitialFlexibility(fe);
 
     const Vector &dqdh = this->computedqdh(gradNumber);
@@ -3796,7 +3796,7 @@ ForceBeamColumnCBDI3d::getResponseSensitivity(int responseID, int gradNumber,
     dvpdh.addMatrixVector(1.0, fe, dqdh, -1.0);
     //opserr << dvpdh;
 
-    static Matrix fek(6,6);
+    static thread_local Matrix fek(6,6);
     fek.addMatrixProduct(0.0, fe, kv, 1.0);
 
     dvpdh.addMatrixVector(1.0, fek, dvdh, -1.0);
@@ -3940,7 +3940,7 @@ ForceBeamColumnCBDI3d::getMassSensitivity(int gradNumber)
 const Vector&
 ForceBeamColumnCBDI3d::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector dqdh(6);
+  static thread_local Vector dqdh(6);
   dqdh = this->computedqdh(gradNumber);
 
   // Transform forces
@@ -3950,7 +3950,7 @@ ForceBeamColumnCBDI3d::getResistingForceSensitivity(int gradNumber)
   this->computeReactionSensitivity(dp0dh, gradNumber);
   Vector dp0dhVec(dp0dh, 3);
 
-  static Vector P(12);
+  static thread_local Vector P(12);
   P.Zero();
 
   if (crdTransf->isShapeSensitivity()) {
@@ -3988,7 +3988,7 @@ ForceBeamColumnCBDI3d::commitSensitivity(int gradNumber, int numGrads)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh = this->computedqdh(gradNumber);
 
   // dvdh = A dudh + dAdh u
@@ -4144,7 +4144,7 @@ ForceBeamColumnCBDI3d::computedqdh(int gradNumber)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dvdh(NEBD);
+  static thread_local Vector dvdh(NEBD);
   dvdh.Zero();
 
   Vector kappa(numSections);
@@ -4278,7 +4278,7 @@ ForceBeamColumnCBDI3d::computedqdh(int gradNumber)
     }
   }
 
-  static Matrix dfedh(6,6);
+  static thread_local Matrix dfedh(6,6);
   dfedh.Zero();
 
   if (beamIntegr->addElasticFlexDeriv(L, dfedh, dLdh) < 0)
@@ -4286,7 +4286,7 @@ ForceBeamColumnCBDI3d::computedqdh(int gradNumber)
   
   //opserr << "dfedh: " << dfedh << endln;
 
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh.addMatrixVector(0.0, kv, dvdh, 1.0);
   
   //opserr << "dqdh: " << dqdh << endln;
@@ -4297,7 +4297,7 @@ ForceBeamColumnCBDI3d::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumnCBDI3d::computedfedh(int gradNumber)
 {
-  static Matrix dfedh(6,6);
+  static thread_local Matrix dfedh(6,6);
 
   dfedh.Zero();
 
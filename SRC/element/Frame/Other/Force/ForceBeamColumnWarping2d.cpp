@@ -85,13 +85,13 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 
 #include <elementAPI.h>
 
-Matrix ForceBeamColumnWarping2d::theMatrix(8,8);
-Vector ForceBeamColumnWarping2d::theVector(10);
-double ForceBeamColumnWarping2d::workArea[200];
+thread_local Matrix ForceBeamColumnWarping2d::theMatrix(8,8);
+thread_local Vector ForceBeamColumnWarping2d::theVector(10);
+thread_local double ForceBeamColumnWarping2d::workArea[200];
 
-Vector ForceBeamColumnWarping2d::vsSubdivide[maxNumSections];
-Matrix ForceBeamColumnWarping2d::fsSubdivide[maxNumSections];
-Vector ForceBeamColumnWarping2d::SsrSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumnWarping2d::vsSubdivide[maxNumSections];
+thread_local Matrix ForceBeamColumnWarping2d::fsSubdivide[maxNumSections];
+thread_local Vector ForceBeamColumnWarping2d::SsrSubdivide[maxNumSections];
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ForceBeamColumnWarping2d)
 {
@@ -477,11 +477,11 @@ ForceBeamColumnWarping2d::getInitialStiff(void)
     Ki = new Matrix(this->getTangentStiff());
   */
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
+  static thread_local Matrix f(NEBD, NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
 
   /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
@@ -489,12 +489,12 @@ ForceBeamColumnWarping2d::getInitialStiff(void)
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ForceBeamColumnWarping2d::getInitialStiff() -- could not invert flexibility\n";
   */
 
-  static Matrix kvInit(NEBD, NEBD);
+  static thread_local Matrix kvInit(NEBD, NEBD);
   f.Invert(kvInit);
   Ki = new Matrix(crdTransf->getInitialGlobalStiffMatrix(kvInit));
 
@@ -652,14 +652,14 @@ ForceBeamColumnWarping2d::update()
   // get basic displacements and increments
   const Vector &v = crdTransf->getBasicTrialDisp();    
 
-  static Vector dv(NEBD);
+  static thread_local Vector dv(NEBD);
 
   dv = crdTransf->getBasicIncrDeltaDisp();    
 
   if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && numEleLoads == 0)
     return 0;
 
-  static Vector vin(NEBD);
+  static thread_local Vector vin(NEBD);
   vin = v;
   vin -= dv;
 
@@ -672,10 +672,10 @@ ForceBeamColumnWarping2d::update()
   double wt[maxNumSections];
   beamIntegr->getSectionWeights(numSections, L, wt);
 
-  static Vector vr(NEBD);       // element residual displacements
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix
+  static thread_local Vector vr(NEBD);       // element residual displacements
+  static thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+  static thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
   double dW;                    // section strain energy (work) norm 
   int i, j;
   
@@ -685,11 +685,11 @@ ForceBeamColumnWarping2d::update()
 
   int numSubdivide = 1;
   bool converged = false;
-  static Vector dSe(NEBD);
-  static Vector dvToDo(NEBD);
-  static Vector dvTrial(NEBD);
-  static Vector SeTrial(NEBD);
-  static Matrix kvTrial(NEBD, NEBD);
+  static thread_local Vector dSe(NEBD);
+  static thread_local Vector dvToDo(NEBD);
+  static thread_local Vector dvTrial(NEBD);
+  static thread_local Vector SeTrial(NEBD);
+  static thread_local Matrix kvTrial(NEBD, NEBD);
 
   dvToDo = dv;
   dvTrial = dvToDo;
@@ -765,10 +765,10 @@ ForceBeamColumnWarping2d::update()
             int order      = sections[i]->getOrder();
             const ID &code = sections[i]->getType();
             
-            static Vector Ss;
-            static Vector dSs;
-            static Vector dvs;
-            static Matrix fb;
+            static thread_local Vector Ss;
+            static thread_local Vector dSs;
+            static thread_local Vector dvs;
+            static thread_local Matrix fb;
             
             Ss.setData(workArea, order);
             dSs.setData(&workArea[order], order);
@@ -1544,7 +1544,7 @@ ForceBeamColumnWarping2d::sendSelf(int commitTag, Channel &theChannel)
   int i, j , k;
   int loc = 0;
 
-  static ID idData(11);  // one bigger than needed so no clash later
+  static thread_local ID idData(11);  // one bigger than needed so no clash later
   idData(0) = this->getTag();
   idData(1) = connectedExternalNodes(0);
   idData(2) = connectedExternalNodes(1);
@@ -1679,7 +1679,7 @@ ForceBeamColumnWarping2d::recvSelf(int commitTag, Channel &theChannel, FEM_Objec
   int dbTag = this->getDbTag();
   int i,j,k;
   
-  static ID idData(11); // one bigger than needed 
+  static thread_local ID idData(11); // one bigger than needed 
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0)  {
     opserr << "ForceBeamColumnWarping2d::recvSelf() - failed to recv ID data\n";
@@ -2121,7 +2121,7 @@ ForceBeamColumnWarping2d::getInitialDeformations(Vector &v0)
         w = sqrt((GA * GC - GB *GB) / EJ / GA); 
         if (w == 0) w = 1e-10;
 
-    static Vector sp;
+    static thread_local Vector sp;
     sp.setData(workArea, order);
     sp.Zero();
 
@@ -2129,7 +2129,7 @@ ForceBeamColumnWarping2d::getInitialDeformations(Vector &v0)
 
     const Matrix &fse = sections[i]->getInitialFlexibility();
 
-    static Vector e;
+    static thread_local Vector e;
     e.setData(&workArea[order], order);
 
     e.addMatrixVector(0.0, fse, sp, 1.0);
@@ -2166,7 +2166,7 @@ ForceBeamColumnWarping2d::getInitialDeformations(Vector &v0)
 void ForceBeamColumnWarping2d::compSectionDisplacements(Vector sectionCoords[], Vector sectionDispls[]) const
 {
    // get basic displacements and increments
-   static Vector ub(NEBD);
+   static thread_local Vector ub(NEBD);
    ub = crdTransf->getBasicTrialDisp();    
 
    double L = crdTransf->getInitialLength();
@@ -2174,7 +2174,7 @@ void ForceBeamColumnWarping2d::compSectionDisplacements(Vector sectionCoords[],
    // get integration point positions and weights
    //   const Matrix &xi_pt  = quadRule.getIntegrPointCoords(numSections);
    // get integration point positions and weights
-   static double xi_pts[maxNumSections];
+   static thread_local double xi_pts[maxNumSections];
    beamIntegr->getSectionLocations(numSections, L, xi_pts);
 
    // setup Vandermode and CBDI influence matrices
@@ -2187,7 +2187,7 @@ void ForceBeamColumnWarping2d::compSectionDisplacements(Vector sectionCoords[],
 
    // get section curvatures
    Vector kappa(numSections);  // curvature
-   static Vector vs;              // section deformations 
+   static thread_local Vector vs;              // section deformations 
 
    for (i=0; i<numSections; i++)
    {
@@ -2213,8 +2213,8 @@ void ForceBeamColumnWarping2d::compSectionDisplacements(Vector sectionCoords[],
    }
 
    Vector w(numSections);
-   static Vector xl(NDM), uxb(NDM);
-   static Vector xg(NDM), uxg(NDM); 
+   static thread_local Vector xl(NDM), uxb(NDM);
+   static thread_local Vector xg(NDM), uxg(NDM); 
 
    // w = ls * kappa;  
    w.addMatrixVector (0.0, ls, kappa, 1.0);
@@ -2313,8 +2313,8 @@ ForceBeamColumnWarping2d::Print(OPS_Stream &s, int flag)
     s << "#END_FORCES " << P << " " << -V+p0[2] << " " << M2 <<  " " << -R2 <<  " " << Q2 << endln;
 
     // plastic hinge rotation
-    static Vector vp(NEBD);
-    static Matrix fe(NEBD,NEBD);
+    static thread_local Vector vp(NEBD);
+    static thread_local Matrix fe(NEBD,NEBD);
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -2517,8 +2517,8 @@ ForceBeamColumnWarping2d::setSectionPointers(int numSec, SectionForceDeformation
 int
 ForceBeamColumnWarping2d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char** modes, int numMode)
 {
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -2760,8 +2760,8 @@ ForceBeamColumnWarping2d::setResponse(const char **argv, int argc, OPS_Stream &o
 int 
 ForceBeamColumnWarping2d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(3);
-  static Matrix fe(3,3);
+  static thread_local Vector vp(3);
+  static thread_local Matrix fe(3,3);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -2848,7 +2848,7 @@ ForceBeamColumnWarping2d::getResponse(int responseID, Information &eleInfo)
     this->getInitialFlexibility(fe);
     vp = crdTransf->getBasicTrialDisp();
     vp.addMatrixVector(1.0, fe, Se, -1.0);
-    static Vector v0(5);
+    static thread_local Vector v0(5);
     this->getInitialDeformations(v0);
     vp.addVector(1.0, v0, -1.0);
     return eleInfo.setVector(vp);
@@ -2918,7 +2918,7 @@ ForceBeamColumnWarping2d::getResponse(int responseID, Information &eleInfo)
     
     d3 += beamIntegr->getTangentDriftJ(L, LI, Se(1), Se(3));
 
-    static Vector d(2);
+    static thread_local Vector d(2);
     d(0) = d2;
     d(1) = d3;
 
@@ -2981,7 +2981,7 @@ ForceBeamColumnWarping2d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(5);
+    static thread_local Vector dqdh(5);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
@@ -3006,7 +3006,7 @@ ForceBeamColumnWarping2d::getResponseSensitivity(int responseID, int gradNumber,
       this->computeSectionForceSensitivity(dsdh, sectionNum-1, gradNumber);
     }
     //opserr << "FBC2d::getRespSens dspdh: " << dsdh;
-    static Vector dqdh(5);
+    static thread_local Vector dqdh(5);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
@@ -3096,14 +3096,14 @@ ForceBeamColumnWarping2d::getResponseSensitivity(int responseID, int gradNumber,
 
   // Plastic deformation sensitivity
   else if (responseID == 4) {
-    static Vector dvpdh(5);
+    static thread_local Vector dvpdh(5);
 
     const Vector &dvdh = crdTransf->getBasicDisplTotalGrad(gradNumber);
 
     dvpdh = dvdh;
     //opserr << dvpdh;
 
-    static Matrix fe(NEBD,NEBD);
+    static thread_local Matrix fe(NEBD,NEBD);
     this->getInitialFlexibility(fe);
 
     const Vector &dqdh = this->computedqdh(gradNumber);
@@ -3111,7 +3111,7 @@ ForceBeamColumnWarping2d::getResponseSensitivity(int responseID, int gradNumber,
     dvpdh.addMatrixVector(1.0, fe, dqdh, -1.0);
     //opserr << dvpdh;
 
-    static Matrix fek(3,3);
+    static thread_local Matrix fek(3,3);
     fek.addMatrixProduct(0.0, fe, kv, 1.0);
 
     dvpdh.addMatrixVector(1.0, fek, dvdh, -1.0);
@@ -3255,7 +3255,7 @@ ForceBeamColumnWarping2d::getMassSensitivity(int gradNumber)
 const Vector&
 ForceBeamColumnWarping2d::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector dqdh(3);
+  static thread_local Vector dqdh(3);
   dqdh = this->computedqdh(gradNumber);
 
   // Transform forces
@@ -3263,7 +3263,7 @@ ForceBeamColumnWarping2d::getResistingForceSensitivity(int gradNumber)
   this->computeReactionSensitivity(dp0dh, gradNumber);
   Vector dp0dhVec(dp0dh, 3);
 
-  static Vector P(8);
+  static thread_local Vector P(8);
   P.Zero();
 
   if (crdTransf->isShapeSensitivity()) {
@@ -3301,7 +3301,7 @@ ForceBeamColumnWarping2d::commitSensitivity(int gradNumber, int numGrads)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dqdh(5);
+  static thread_local Vector dqdh(5);
   dqdh = this->computedqdh(gradNumber);
 
   // dvdh = A dudh + dAdh u
@@ -3412,7 +3412,7 @@ ForceBeamColumnWarping2d::computedqdh(int gradNumber)
 
   double d1oLdh = crdTransf->getd1overLdh();
 
-  static Vector dvdh(5);
+  static thread_local Vector dvdh(5);
   dvdh.Zero();
 
   // Loop over the integration points
@@ -3537,7 +3537,7 @@ ForceBeamColumnWarping2d::computedqdh(int gradNumber)
     }
   }
 
-  static Matrix dfedh(5,5);
+  static thread_local Matrix dfedh(5,5);
   dfedh.Zero();
 
   if (beamIntegr->addElasticFlexDeriv(L, dfedh, dLdh) < 0)
@@ -3545,7 +3545,7 @@ ForceBeamColumnWarping2d::computedqdh(int gradNumber)
   
   //opserr << "dfedh: " << dfedh << endln;
 
-  static Vector dqdh(5);
+  static thread_local Vector dqdh(5);
   dqdh.addMatrixVector(0.0, kv, dvdh, 1.0);
   
   //opserr << "dqdh: " << dqdh << endln;
@@ -3556,7 +3556,7 @@ ForceBeamColumnWarping2d::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumnWarping2d::computedfedh(int gradNumber)
 {
-  static Matrix dfedh(5,5);
+  static thread_local Matrix dfedh(5,5);
 
   dfedh.Zero();
 
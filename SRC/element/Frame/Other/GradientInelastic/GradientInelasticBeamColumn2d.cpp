@@ -207,8 +207,8 @@ void * OPS_ADD_RUNTIME_VPV(OPS_GradientInelasticBeamColumn2d)
 }
 
 // Initialize Class Wide Variables
-Matrix GradientInelasticBeamColumn2d::theMatrix(6, 6);
-Vector GradientInelasticBeamColumn2d::theVector(6);
+thread_local Matrix GradientInelasticBeamColumn2d::theMatrix(6, 6);
+thread_local Vector GradientInelasticBeamColumn2d::theVector(6);
 
 // Constructor 1 (for normal processing)
 GradientInelasticBeamColumn2d::GradientInelasticBeamColumn2d(int tag, int nodeI, int nodeJ,
@@ -970,7 +970,7 @@ GradientInelasticBeamColumn2d::update(void)
 	crdTransf->update();
 	const Vector &q_t = crdTransf->getBasicTrialDisp();		// target
 	const Vector &q_inc = crdTransf->getBasicIncrDisp();		// increment from last committed step
-	static Vector q(3);											// trial for each iteration (could be smaller than target)
+	static thread_local Vector q(3);											// trial for each iteration (could be smaller than target)
 
 	if (initialFlag != 0 && q_inc.Norm() <= DBL_EPSILON)
 		return 0;
@@ -979,7 +979,7 @@ GradientInelasticBeamColumn2d::update(void)
 	Vector d_tot_prev(numSections * secOrder);
 	Vector d_nl_tot_prev(numSections * secOrder);
 	Vector F_ms_prev(numSections * secOrder);
-	static Vector Q_prev(3);
+	static thread_local Vector Q_prev(3);
 
 	// Initialize Previous Sub-step Variables
 	d_tot_prev = *d_tot_commit;
@@ -988,7 +988,7 @@ GradientInelasticBeamColumn2d::update(void)
 	F_ms_prev = *F_ms_commit; // B_Q * Q_commit;
 
 	// Declare Variables Requaired for Iterations
-	static Vector dq(3);
+	static thread_local Vector dq(3);
 	Vector dF_ms(numSections * secOrder);
 	Vector d_inc_tot(numSections * secOrder);
 	Vector trial_diff(3 + numSections * secOrder);
@@ -1288,8 +1288,8 @@ GradientInelasticBeamColumn2d::getBasicStiff(void)
 	// Determine Element Stiffness Matrix in Basic System
 	Matrix K_ms(numSections * secOrder, numSections * secOrder);
 	Matrix K_ms_inv_BQ(numSections * secOrder, 3);
-	static Matrix F(3, 3);       // flexibility matrix in the basic system
-	static Matrix K(3, 3);       // stiffness matrix in the basic system
+	static thread_local Matrix F(3, 3);       // flexibility matrix in the basic system
+	static thread_local Matrix K(3, 3);       // stiffness matrix in the basic system
 
 	this->getSectionsTangentStiff(K_ms);
 
@@ -1326,8 +1326,8 @@ GradientInelasticBeamColumn2d::getInitialBasicStiff(void)
 
 	// Determine Element Stiffness Matrix in Basic System
 	Matrix K_ms_inv_BQ(numSections * secOrder, 3);
-	static Matrix F_init(3, 3);      // initial flexibility matrix in the basic system
-	static Matrix K_init(3, 3);      // initial stiffness matrix in the basic system
+	static thread_local Matrix F_init(3, 3);      // initial flexibility matrix in the basic system
+	static thread_local Matrix K_init(3, 3);      // initial stiffness matrix in the basic system
 
 	if (K_ms_init.Solve(*B_Q, K_ms_inv_BQ) < 0)
 		opserr << "WARNING! GradientInelasticBeamColumn2d::getInitialBasicStiff() - element: " << this->getTag() << " - could not invert K_ms_init\n";
@@ -1556,8 +1556,8 @@ GradientInelasticBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 int
 GradientInelasticBeamColumn2d::displaySelf(Renderer& theViewer, int displayMode, float fact, const char** displayModes, int numModes)
 {
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -190,8 +190,8 @@ private:
 	bool fConvergence(const int &iter, const Vector &Qt, Vector &DF_ms, double &dfNorm);
 
 	// Static Class Wide Variables
-	static Matrix theMatrix;
-	static Vector theVector;
+	static thread_local Matrix theMatrix;
+	static thread_local Vector theVector;
 };
 
 #endif // GradientInelasticBeamColumn2d_H
@@ -206,8 +206,8 @@ void * OPS_ADD_RUNTIME_VPV(OPS_GradientInelasticBeamColumn3d)
 }
 
 // Initialize Class Wide Variables
-Matrix GradientInelasticBeamColumn3d::theMatrix(12, 12);
-Vector GradientInelasticBeamColumn3d::theVector(12);
+thread_local Matrix GradientInelasticBeamColumn3d::theMatrix(12, 12);
+thread_local Vector GradientInelasticBeamColumn3d::theVector(12);
 
 // Constructor 1 (for normal processing)
 GradientInelasticBeamColumn3d::GradientInelasticBeamColumn3d(int tag, int nodeI, int nodeJ,
@@ -941,7 +941,7 @@ GradientInelasticBeamColumn3d::update(void)
 	crdTransf->update();
 	const Vector &q_t = crdTransf->getBasicTrialDisp();		// target
 	const Vector &q_inc = crdTransf->getBasicIncrDisp();		// increment from last committed step
-	static Vector q(6);											// trial for each iteration (could be smaller than target)
+	static thread_local Vector q(6);											// trial for each iteration (could be smaller than target)
 
 	if (initialFlag != 0 && q_inc.Norm() <= DBL_EPSILON)
 		return 0;
@@ -950,7 +950,7 @@ GradientInelasticBeamColumn3d::update(void)
 	Vector d_tot_prev(numSections * secOrder);
 	Vector d_nl_tot_prev(numSections * secOrder);
 	Vector F_ms_prev(numSections * secOrder);
-	static Vector Q_prev(6);
+	static thread_local Vector Q_prev(6);
 
 	// Initialize Previous Sub-step Variables
 	d_tot_prev = *d_tot_commit;
@@ -959,7 +959,7 @@ GradientInelasticBeamColumn3d::update(void)
 	F_ms_prev = *F_ms_commit; // B_Q * Q_commit;
 
 	// Declare Variables Requaired for Iterations
-	static Vector dq(6);
+	static thread_local Vector dq(6);
 	Vector dF_ms(numSections * secOrder);
 	Vector d_inc_tot(numSections * secOrder);
 	Vector trial_diff(6 + numSections * secOrder);
@@ -1264,8 +1264,8 @@ GradientInelasticBeamColumn3d::getBasicStiff(void)
 	// Determine Element Stiffness Matrix in Basic System
 	Matrix K_ms(numSections * secOrder, numSections * secOrder);
 	Matrix K_ms_inv_BQ(numSections * secOrder, 6);
-	static Matrix F(6, 6);       // flexibility matrix in the basic system
-	static Matrix K(6, 6);       // stiffness matrix in the basic system
+	static thread_local Matrix F(6, 6);       // flexibility matrix in the basic system
+	static thread_local Matrix K(6, 6);       // stiffness matrix in the basic system
 
 	this->getSectionsTangentStiff(K_ms);
 
@@ -1303,8 +1303,8 @@ GradientInelasticBeamColumn3d::getInitialBasicStiff(void)
 	// Determine Element Stiffness Matrix in Basic System
 	Matrix K_ms_inv_BQ(numSections * secOrder, 6);
 	Matrix H_inv_init(numSections * secOrder, numSections * secOrder);
-	static Matrix F_init(6, 6);      // initial flexibility matrix in the basic system
-	static Matrix K_init(6, 6);      // initial stiffness matrix in the basic system
+	static thread_local Matrix F_init(6, 6);      // initial flexibility matrix in the basic system
+	static thread_local Matrix K_init(6, 6);      // initial stiffness matrix in the basic system
 
 	if (K_ms_init.Solve((*B_Q), K_ms_inv_BQ) < 0)
 		opserr << "WARNING! GradientInelasticBeamColumn3d::getInitialBasicStiff() - element: " << this->getTag() << " - could not invert K_ms_init\n";
@@ -1560,8 +1560,8 @@ GradientInelasticBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 int
 GradientInelasticBeamColumn3d::displaySelf(Renderer& theViewer, int displayMode, float fact, const char** displayModes, int numModes)
 {
-	static Vector v1(3);
-	static Vector v2(3);
+	static thread_local Vector v1(3);
+	static thread_local Vector v2(3);
 
 	theNodes[0]->getDisplayCrds(v1, fact, displayMode);
 	theNodes[1]->getDisplayCrds(v2, fact, displayMode);
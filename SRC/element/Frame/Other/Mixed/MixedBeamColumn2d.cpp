@@ -63,28 +63,28 @@
 using namespace std;
 
 
-Matrix MixedBeamColumn2d::theMatrix(NEGD,NEGD);
-Matrix MixedBeamColumn2d::theNaturalMatrix(NDM_NATURAL,NDM_NATURAL);
-Matrix MixedBeamColumn2d::theSectionNaturalMatrix(NDM_SECTION,NDM_NATURAL);
-Matrix MixedBeamColumn2d::G(NDM_NATURAL,NDM_NATURAL);
-Matrix MixedBeamColumn2d::G2(NDM_NATURAL,NDM_NATURAL);
-Matrix MixedBeamColumn2d::H(NDM_NATURAL,NDM_NATURAL);
-Matrix MixedBeamColumn2d::H12(NDM_NATURAL,NDM_NATURAL);
-Matrix MixedBeamColumn2d::H22(NDM_NATURAL,NDM_NATURAL);
-Matrix MixedBeamColumn2d::Md(NDM_NATURAL,NDM_NATURAL);
-Matrix MixedBeamColumn2d::Kg(NDM_NATURAL,NDM_NATURAL);
-Matrix MixedBeamColumn2d::GT(NDM_NATURAL,NDM_NATURAL);
-Matrix MixedBeamColumn2d::G2T(NDM_NATURAL,NDM_NATURAL);
-Matrix MixedBeamColumn2d::GMHT(NDM_NATURAL,NDM_NATURAL);
-Matrix MixedBeamColumn2d::ks(NDM_SECTION,NDM_SECTION);
-Matrix MixedBeamColumn2d::fs(NDM_SECTION,NDM_SECTION);
-
-
-Vector MixedBeamColumn2d::theVector(NEGD);
-Vector MixedBeamColumn2d::theNaturalVector(NDM_NATURAL);
-Vector MixedBeamColumn2d::naturalDisp(NDM_NATURAL);
-Vector MixedBeamColumn2d::naturalIncrDeltaDisp(NDM_NATURAL);
-Vector MixedBeamColumn2d::V2(NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::theMatrix(NEGD,NEGD);
+thread_local Matrix MixedBeamColumn2d::theNaturalMatrix(NDM_NATURAL,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::theSectionNaturalMatrix(NDM_SECTION,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::G(NDM_NATURAL,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::G2(NDM_NATURAL,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::H(NDM_NATURAL,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::H12(NDM_NATURAL,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::H22(NDM_NATURAL,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::Md(NDM_NATURAL,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::Kg(NDM_NATURAL,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::GT(NDM_NATURAL,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::G2T(NDM_NATURAL,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::GMHT(NDM_NATURAL,NDM_NATURAL);
+thread_local Matrix MixedBeamColumn2d::ks(NDM_SECTION,NDM_SECTION);
+thread_local Matrix MixedBeamColumn2d::fs(NDM_SECTION,NDM_SECTION);
+
+
+thread_local Vector MixedBeamColumn2d::theVector(NEGD);
+thread_local Vector MixedBeamColumn2d::theNaturalVector(NDM_NATURAL);
+thread_local Vector MixedBeamColumn2d::naturalDisp(NDM_NATURAL);
+thread_local Vector MixedBeamColumn2d::naturalIncrDeltaDisp(NDM_NATURAL);
+thread_local Vector MixedBeamColumn2d::V2(NDM_NATURAL);
 
 Vector *MixedBeamColumn2d::sectionDefShapeFcn = 0;
 Vector *MixedBeamColumn2d::sectionForceShapeFcn = 0;
@@ -1700,8 +1700,8 @@ int MixedBeamColumn2d::recvSelf(int commitTag, Channel &theChannel,
 
 int MixedBeamColumn2d::displaySelf(Renderer& theViewer, int displayMode, float fact, const char** modes, int numMode)
 {
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -156,27 +156,27 @@ class MixedBeamColumn2d : public Element
     Matrix *commitedSectionFlexibility;
 
     // static data - single copy for all objects of the class
-    static Matrix theMatrix;
-    static Matrix theNaturalMatrix;
-    static Matrix G;
-    static Matrix G2;
-    static Matrix H;
-    static Matrix H12;
-    static Matrix H22;
-    static Matrix Md;
-    static Matrix Kg;
-    static Matrix GT;
-    static Matrix G2T;
-    static Matrix GMHT;
-    static Matrix ks;
-    static Matrix fs;
-    static Matrix theSectionNaturalMatrix;
-
-    static Vector theVector;
-    static Vector theNaturalVector;
-    static Vector naturalDisp;
-    static Vector naturalIncrDeltaDisp;
-    static Vector V2;
+    static thread_local Matrix theMatrix;
+    static thread_local Matrix theNaturalMatrix;
+    static thread_local Matrix G;
+    static thread_local Matrix G2;
+    static thread_local Matrix H;
+    static thread_local Matrix H12;
+    static thread_local Matrix H22;
+    static thread_local Matrix Md;
+    static thread_local Matrix Kg;
+    static thread_local Matrix GT;
+    static thread_local Matrix G2T;
+    static thread_local Matrix GMHT;
+    static thread_local Matrix ks;
+    static thread_local Matrix fs;
+    static thread_local Matrix theSectionNaturalMatrix;
+
+    static thread_local Vector theVector;
+    static thread_local Vector theNaturalVector;
+    static thread_local Vector naturalDisp;
+    static thread_local Vector naturalIncrDeltaDisp;
+    static thread_local Vector V2;
 
     // These variable are always recomputed, so there is no need to store them for each instance of the element
     static Vector *sectionDefShapeFcn;
@@ -95,9 +95,9 @@
 #define  MAX_NUM_SECTIONS  10          // maximum number of sections allowed
 
 
-Matrix MixedBeamColumn3d::theMatrix(NEGD,NEGD);
-Vector MixedBeamColumn3d::theVector(NEGD);
-double MixedBeamColumn3d::workArea[400];
+thread_local Matrix MixedBeamColumn3d::theMatrix(NEGD,NEGD);
+thread_local Vector MixedBeamColumn3d::theVector(NEGD);
+thread_local double MixedBeamColumn3d::workArea[400];
 Matrix MixedBeamColumn3d::transformNaturalCoords(NDM_NATURAL_WITH_TORSION,NDM_NATURAL_WITH_TORSION);
 Matrix MixedBeamColumn3d::transformNaturalCoordsT(NDM_NATURAL_WITH_TORSION,NDM_NATURAL_WITH_TORSION);
 
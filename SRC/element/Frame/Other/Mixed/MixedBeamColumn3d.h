@@ -149,9 +149,9 @@ class MixedBeamColumn3d : public Element
     Matrix *commitedSectionFlexibility;
 
     // static data - single copy for all objects of the class
-    static Matrix theMatrix;
-    static Vector theVector;
-    static double workArea[];
+    static thread_local Matrix theMatrix;
+    static thread_local Vector theVector;
+    static thread_local double workArea[];
     static Matrix transformNaturalCoords;
     static Matrix transformNaturalCoordsT;
         // matrix to transform the natural coordinates from what the coordinate transformation uses and what the element uses
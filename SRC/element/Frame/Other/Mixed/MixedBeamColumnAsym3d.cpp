@@ -69,9 +69,9 @@
 
 
 
-Matrix MixedBeamColumnAsym3d::theMatrix(NEGD,NEGD);
-Vector MixedBeamColumnAsym3d::theVector(NEGD);
-double MixedBeamColumnAsym3d::workArea[400];
+thread_local Matrix MixedBeamColumnAsym3d::theMatrix(NEGD,NEGD);
+thread_local Vector MixedBeamColumnAsym3d::theVector(NEGD);
+thread_local double MixedBeamColumnAsym3d::workArea[400];
 //Matrix MixedBeamColumnAsym3d::transformNaturalCoords(NDM_NATURAL_WITH_TORSION,NDM_NATURAL_WITH_TORSION);
 //Matrix MixedBeamColumnAsym3d::transformNaturalCoordsT(NDM_NATURAL_WITH_TORSION,NDM_NATURAL_WITH_TORSION);
 //int MixedBeamColumnAsym3d::maxNumSections = 10;
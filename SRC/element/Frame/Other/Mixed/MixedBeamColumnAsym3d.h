@@ -166,9 +166,9 @@ class MixedBeamColumnAsym3d : public Element
     // static data - single copy for all objects of the class
     //static int maxNumSections;
 	enum { maxNumSections = 10 };
-    static Matrix theMatrix;
-    static Vector theVector;
-    static double workArea[];
+    static thread_local Matrix theMatrix;
+    static thread_local Vector theVector;
+    static thread_local double workArea[];
     //static Matrix transformNaturalCoords;
     //static Matrix transformNaturalCoordsT;
         // matrix to transform the natural coordinates from what the coordinate transformation uses and what the element uses
@@ -149,9 +149,9 @@ OPS_ADD_RUNTIME_VPV(OPS_DispBeamColumn2dInt)
   return theElement;
 }
 
-Matrix DispBeamColumn2dInt::K(6, 6);
-Vector DispBeamColumn2dInt::P(6);
-double DispBeamColumn2dInt::workArea[100];
+thread_local Matrix DispBeamColumn2dInt::K(6, 6);
+thread_local Vector DispBeamColumn2dInt::P(6);
+thread_local double DispBeamColumn2dInt::workArea[100];
 LegendreBeamIntegration DispBeamColumn2dInt::quadRule;
 
 DispBeamColumn2dInt::DispBeamColumn2dInt(int tag, int nd1, int nd2, int numSec,
@@ -418,7 +418,7 @@ DispBeamColumn2dInt::update(void)
 const Matrix &
 DispBeamColumn2dInt::getTangentStiff()
 {
-  static Matrix kb(6, 6);
+  static thread_local Matrix kb(6, 6);
 
   // Zero for integral
   kb.Zero();
@@ -547,7 +547,7 @@ DispBeamColumn2dInt::getTangentStiff()
 const Matrix &
 DispBeamColumn2dInt::getInitialBasicStiff()
 {
-  static Matrix kb(6, 6);
+  static thread_local Matrix kb(6, 6);
 
   // Zero for integral
   kb.Zero();
@@ -875,7 +875,7 @@ DispBeamColumn2dInt::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
 
-  static ID idData(7); // one bigger than needed so no clash later
+  static thread_local ID idData(7); // one bigger than needed so no clash later
   idData(0)          = this->getTag();
   idData(1)          = connectedExternalNodes(0);
   idData(2)          = connectedExternalNodes(1);
@@ -948,7 +948,7 @@ DispBeamColumn2dInt::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
 
-  static ID idData(7); // one bigger than needed so no clash with section ID
+  static thread_local ID idData(7); // one bigger than needed so no clash with section ID
 
   if (theChannel.recvID(dbTag, commitTag, idData) < 0) {
     opserr << "DispBeamColumn2dInt::recvSelf() - failed to recv ID data\n";
@@ -1099,8 +1099,8 @@ int
 DispBeamColumn2dInt::displaySelf(Renderer &theViewer, int displayMode, float fact,
                                  const char **modes, int numMode)
 {
-  static Vector v1(3);
-  static Vector v2(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
   theNodes[0]->getDisplayCrds(v1, fact, displayMode);
   theNodes[1]->getDisplayCrds(v2, fact, displayMode);
   return theViewer.drawLine(v1, v2, 1.0, 1.0, this->getTag());
@@ -1170,8 +1170,8 @@ DispBeamColumn2dInt::getResponse(int responseID, Information &eleInfo) //L modif
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static thread_local Vector vp(6);
+    static thread_local Vector ve(6);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDispInt();
@@ -1202,7 +1202,7 @@ DispBeamColumn2dInt::getMassSensitivity(int gradNumber)
 const Vector &
 DispBeamColumn2dInt::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector dummy(3); // No distributed loads
+  static thread_local Vector dummy(3); // No distributed loads
   return dummy;
 }
 
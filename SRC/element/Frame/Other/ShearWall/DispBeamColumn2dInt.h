@@ -112,8 +112,8 @@ private:
 
   Node *theNodes[2];
 
-  static Matrix K;           // Element stiffness, damping, and mass Matrix
-  static Vector P;           // Element resisting force vector
+  static thread_local Matrix K;           // Element stiffness, damping, and mass Matrix
+  static thread_local Vector P;           // Element resisting force vector
 
   Vector Q;                  // Applied nodal loads
   Vector q;                  // Basic force
@@ -122,7 +122,7 @@ private:
 
   double rho; // Mass density per unit length
 
-  static double workArea[];
+  static thread_local double workArea[];
 
   static LegendreBeamIntegration quadRule;
 
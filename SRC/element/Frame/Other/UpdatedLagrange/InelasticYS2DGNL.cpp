@@ -33,10 +33,10 @@
 #define TAG_InelasticYS2DGNL -1
 
 // Vector InelasticYS2DGNL::trialForce(6);
-Vector InelasticYS2DGNL::elasticForce(6);
-Vector InelasticYS2DGNL::F1(6);
-Vector InelasticYS2DGNL::F2(6);
-Vector InelasticYS2DGNL::Fs(6);
+thread_local Vector InelasticYS2DGNL::elasticForce(6);
+thread_local Vector InelasticYS2DGNL::F1(6);
+thread_local Vector InelasticYS2DGNL::F2(6);
+thread_local Vector InelasticYS2DGNL::Fs(6);
 double InelasticYS2DGNL::storage(0);
 
 const int InelasticYS2DGNL::INSIDE(-1);
@@ -1644,8 +1644,8 @@ int InelasticYS2DGNL::displaySelf(Renderer &theViewer, int displayMode, float fa
 
 	this->UpdatedLagrangianBeam2D::displaySelf(theViewer, displayMode, fact);
 
-	static Vector v1(3);
-	static Vector v2(3);
+	static thread_local Vector v1(3);
+	static thread_local Vector v2(3);
 	Vector vc(3);
 
 	end1Ptr->getDisplayCrds(v1, fact, displayMode);
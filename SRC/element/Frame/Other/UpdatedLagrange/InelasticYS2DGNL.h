@@ -69,8 +69,8 @@ private:
   int  elasticCorrector(Vector &trialForce, int algo);
   
  protected:
-  static Vector elasticForce;
-  static Vector F1, F2, Fs;
+  static thread_local Vector elasticForce;
+  static thread_local Vector F1, F2, Fs;
   
 
   YieldSurface_BC *ys1, *ys2;
@@ -1,9 +1,9 @@
 #include "QuadraticCyclic.h"
 #include <math.h>
 
-Matrix QuadraticCyclic::X(3,3);
-Vector QuadraticCyclic::Y(3);
-Vector QuadraticCyclic::A(3);
+thread_local Matrix QuadraticCyclic::X(3,3);
+thread_local Vector QuadraticCyclic::Y(3);
+thread_local Vector QuadraticCyclic::A(3);
 
 QuadraticCyclic::QuadraticCyclic(int tag, double wt, double fac_y)
 :CyclicModel(tag, -1), weightFactor(wt), facty(fac_y),
@@ -29,8 +29,8 @@ private:
 	double weightFactor, facty;
 	double qx1, qy1, qx2, qy2, qx3, qy3;
 	
-	static Matrix X;
-	static Vector Y, A;
+	static thread_local Matrix X;
+	static thread_local Vector Y, A;
 };
 
 #endif
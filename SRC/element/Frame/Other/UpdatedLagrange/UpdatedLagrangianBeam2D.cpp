@@ -35,18 +35,18 @@
 #define	  _debug  0
 #define   _Kdebug 0
 
-Matrix UpdatedLagrangianBeam2D::K(6,6);  
-Matrix UpdatedLagrangianBeam2D::Kg(6,6);
-Matrix UpdatedLagrangianBeam2D::Kt(6,6);
-Matrix UpdatedLagrangianBeam2D::M(6,6);
-Matrix UpdatedLagrangianBeam2D::D(6,6);
-Matrix UpdatedLagrangianBeam2D::T(6,6);
-Vector UpdatedLagrangianBeam2D::force(6);
-Vector UpdatedLagrangianBeam2D::disp(6);
-Vector UpdatedLagrangianBeam2D::ZeroVector(6);
-Matrix UpdatedLagrangianBeam2D::ZeroMatrix(6,6);
-Vector UpdatedLagrangianBeam2D::end1IncrDisp(3);
-Vector UpdatedLagrangianBeam2D::end2IncrDisp(3);
+thread_local Matrix UpdatedLagrangianBeam2D::K(6,6);  
+thread_local Matrix UpdatedLagrangianBeam2D::Kg(6,6);
+thread_local Matrix UpdatedLagrangianBeam2D::Kt(6,6);
+thread_local Matrix UpdatedLagrangianBeam2D::M(6,6);
+thread_local Matrix UpdatedLagrangianBeam2D::D(6,6);
+thread_local Matrix UpdatedLagrangianBeam2D::T(6,6);
+thread_local Vector UpdatedLagrangianBeam2D::force(6);
+thread_local Vector UpdatedLagrangianBeam2D::disp(6);
+thread_local Vector UpdatedLagrangianBeam2D::ZeroVector(6);
+thread_local Matrix UpdatedLagrangianBeam2D::ZeroMatrix(6,6);
+thread_local Vector UpdatedLagrangianBeam2D::end1IncrDisp(3);
+thread_local Vector UpdatedLagrangianBeam2D::end2IncrDisp(3);
 
 Node *UpdatedLagrangianBeam2D::theNodes[2];
 
@@ -33,8 +33,8 @@
 using OpenSees::VectorND;
 using OpenSees::MatrixND;
 
-Matrix PrismFrame2d::K(6,6);
-Vector PrismFrame2d::P(6);
+thread_local Matrix PrismFrame2d::K(6,6);
+thread_local Vector PrismFrame2d::P(6);
 
 PrismFrame2d::PrismFrame2d()
   : Element(0,ELE_TAG_ElasticBeam2d), 
@@ -373,7 +373,7 @@ PrismFrame2d::getMass()
     // get initial element length
     if (mass_flag == 0)  {
         static MatrixND<6,6> M;
-        static Matrix Wrapper(M);
+        static thread_local Matrix Wrapper(M);
         M.zero();
         // lumped mass matrix
         double m = 0.5*rho*L;
@@ -610,7 +610,7 @@ PrismFrame2d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(4) -= m * Raccel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(6);
+    static thread_local Vector Raccel(6);
     for (int i=0; i<3; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+3) = Raccel2(i);
@@ -651,7 +651,7 @@ PrismFrame2d::getResistingForceIncInertia()
     P(4) += m * accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    static thread_local Vector accel(6);
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -685,7 +685,7 @@ PrismFrame2d::sendSelf(int cTag, Channel &theChannel)
 {
   int res = 0;
 
-    static Vector data(17);
+    static thread_local Vector data(17);
     
     data(0) = A;
     data(1) = E; 
@@ -737,7 +737,7 @@ PrismFrame2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroke
 {
   int res = 0;
       
-  static Vector data(17);
+  static thread_local Vector data(17);
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
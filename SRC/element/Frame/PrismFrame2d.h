@@ -120,8 +120,8 @@ class PrismFrame2d : public Element
 
     CrdTransf *theCoordTransf;
 
-    static Matrix K;
-    static Vector P;
+    static thread_local Matrix K;
+    static thread_local Vector P;
 };
 
 #endif
@@ -517,7 +517,7 @@ PrismFrame3d::sendSelf(int cTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(19);
+    static thread_local Vector data(19);
     
     data(0) = A;
     data(1) = E;
@@ -572,7 +572,7 @@ int
 PrismFrame3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(19);
+  static thread_local Vector data(19);
 
   res += theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) {
@@ -683,9 +683,9 @@ PrismFrame3d::Print(OPS_Stream &s, int flag)
     }
 
     else if (flag == 2) {
-        static Vector xAxis(3);
-        static Vector yAxis(3);
-        static Vector zAxis(3);
+        static thread_local Vector xAxis(3);
+        static thread_local Vector yAxis(3);
+        static thread_local Vector zAxis(3);
 
         theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
@@ -827,9 +827,9 @@ PrismFrame3d::getResponse(int responseID, Information &info)
 {
   double L = theCoordTransf->getInitialLength();
   double oneOverL = 1.0/L;
-  static Vector Res(12);
+  static thread_local Vector Res(12);
   Res = this->getResistingForce();
-  static Vector s(6);
+  static thread_local Vector s(6);
 
   switch (responseID) {
   case 1: // stiffness
@@ -899,7 +899,7 @@ PrismFrame3d::getResponse(int responseID, Information &info)
 const Vector&
 PrismFrame3d::getResistingForceSensitivity(int gradNumber)
 {
-  static Vector P(12);
+  static thread_local Vector P(12);
   P.Zero();
 
   VectorND<NBV> dqdh = this->getBasicForceGrad(gradNumber);
@@ -943,7 +943,7 @@ PrismFrame3d::getResponseSensitivity(int responseID, int gradNumber, Information
 
   // Basic force sensitivity
   else if (responseID == 7) {
-    static Vector dqdh(6);
+    static thread_local Vector dqdh(6);
 
     const Vector& dvdh = theCoordTransf->getBasicDisplTotalGrad(gradNumber);
 #if 0
@@ -28,8 +28,8 @@
 #include <math.h>
 
 // initialize the class wide variables
-Matrix PrismShearFrame2d::theMatrix(6, 6);
-Vector PrismShearFrame2d::theVector(6);
+thread_local Matrix PrismShearFrame2d::theMatrix(6, 6);
+thread_local Vector PrismShearFrame2d::theVector(6);
 
 
 PrismShearFrame2d::PrismShearFrame2d(int tag, int Nd1, int Nd2, double e, double g, double a,
@@ -273,13 +273,13 @@ PrismShearFrame2d::getTangentStiff()
 
   } else {
     // initialize local stiffness matrix
-    static Matrix klTot(6, 6);
+    static thread_local Matrix klTot(6, 6);
     klTot.addMatrix(0.0, kl, 1.0);
 
     // get global trial displacements
     const Vector& ui = theNodes[0]->getTrialDisp();
     const Vector& uj = theNodes[1]->getTrialDisp();
-    static Vector ug(6);
+    static thread_local Vector ug(6);
     for (int i = 0; i < 3; i++) {
       ug(i)     = ui(i);
       ug(i + 3) = uj(i);
@@ -369,7 +369,7 @@ PrismShearFrame2d::addInertiaLoadToUnbalance(const Vector& accel)
   // assemble Raccel vector
   const Vector& Raccel1 = theNodes[0]->getRV(accel);
   const Vector& Raccel2 = theNodes[1]->getRV(accel);
-  static Vector Raccel(6);
+  static thread_local Vector Raccel(6);
   for (int i = 0; i < 3; i++) {
     Raccel(i)     = Raccel1(i);
     Raccel(i + 3) = Raccel2(i);
@@ -391,7 +391,7 @@ PrismShearFrame2d::getResistingForce()
   // get global trial displacements
   const Vector& ui = theNodes[0]->getTrialDisp();
   const Vector& uj = theNodes[1]->getTrialDisp();
-  static Vector ug(6);
+  static thread_local Vector ug(6);
   for (int i = 0; i < 3; i++) {
     ug(i)     = ui(i);
     ug(i + 3) = uj(i);
@@ -437,7 +437,7 @@ PrismShearFrame2d::getResistingForceIncInertia()
   // add inertia forces from element mass
   const Vector& accel1 = theNodes[0]->getTrialAccel();
   const Vector& accel2 = theNodes[1]->getTrialAccel();
-  static Vector accel(6);
+  static thread_local Vector accel(6);
   for (int i = 0; i < 3; i++) {
     accel(i)     = accel1(i);
     accel(i + 3) = accel2(i);
@@ -453,7 +453,7 @@ PrismShearFrame2d::sendSelf(int commitTag, Channel& sChannel)
 {
   int res = 0;
 
-  static Vector data(16);
+  static thread_local Vector data(16);
   data(0)  = this->getTag();
   data(1)  = connectedExternalNodes(0);
   data(2)  = connectedExternalNodes(1);
@@ -501,7 +501,7 @@ PrismShearFrame2d::recvSelf(int commitTag, Channel& rChannel, FEM_ObjectBroker&
 {
   int res = 0;
 
-  static Vector data(16);
+  static thread_local Vector data(16);
   res += rChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
     opserr << "PrismShearFrame2d::recvSelf() - could not receive data Vector.\n";
@@ -715,7 +715,7 @@ void
 PrismShearFrame2d::setUp()
 {
   // element projection
-  static Vector dx(2);
+  static thread_local Vector dx(2);
 
   const Vector& ndICoords = theNodes[0]->getCrds();
   const Vector& ndJCoords = theNodes[1]->getCrds();
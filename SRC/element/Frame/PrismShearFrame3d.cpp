@@ -45,8 +45,8 @@
 
 
 // initialize the class wide variables
-Matrix ElasticTimoshenkoBeam3d::theMatrix(12, 12);
-Vector ElasticTimoshenkoBeam3d::theVector(12);
+thread_local Matrix ElasticTimoshenkoBeam3d::theMatrix(12, 12);
+thread_local Vector ElasticTimoshenkoBeam3d::theVector(12);
 
 ElasticTimoshenkoBeam3d::ElasticTimoshenkoBeam3d(int tag, int Nd1, int Nd2, double e, double g,
                                                  double a, double jx, double iy, double iz,
@@ -300,13 +300,13 @@ ElasticTimoshenkoBeam3d::getTangentStiff()
   }
 
   // initialize local stiffness matrix
-  static Matrix klTot(12, 12);
+  static thread_local Matrix klTot(12, 12);
   klTot.addMatrix(0.0, kl, 1.0);
 
   // get global trial displacements
   const Vector& dsp1 = theNodes[0]->getTrialDisp();
   const Vector& dsp2 = theNodes[1]->getTrialDisp();
-  static Vector ug(12);
+  static thread_local Vector ug(12);
   for (int i = 0; i < 6; i++) {
     ug(i)     = dsp1(i);
     ug(i + 6) = dsp2(i);
@@ -402,7 +402,7 @@ ElasticTimoshenkoBeam3d::addInertiaLoadToUnbalance(const Vector& accel)
   // assemble Raccel vector
   const Vector& Raccel1 = theNodes[0]->getRV(accel);
   const Vector& Raccel2 = theNodes[1]->getRV(accel);
-  static Vector Raccel(12);
+  static thread_local Vector Raccel(12);
   for (int i = 0; i < 6; i++) {
     Raccel(i)     = Raccel1(i);
     Raccel(i + 6) = Raccel2(i);
@@ -424,7 +424,7 @@ ElasticTimoshenkoBeam3d::getResistingForce()
   // get global trial displacements
   const Vector& dsp1 = theNodes[0]->getTrialDisp();
   const Vector& dsp2 = theNodes[1]->getTrialDisp();
-  static Vector ug(12);
+  static thread_local Vector ug(12);
   for (int i = 0; i < 6; i++) {
     ug(i)     = dsp1(i);
     ug(i + 6) = dsp2(i);
@@ -470,7 +470,7 @@ ElasticTimoshenkoBeam3d::getResistingForceIncInertia()
   // add inertia forces from element mass
   const Vector& accel1 = theNodes[0]->getTrialAccel();
   const Vector& accel2 = theNodes[1]->getTrialAccel();
-  static Vector accel(12);
+  static thread_local Vector accel(12);
   for (int i = 0; i < 6; i++) {
     accel(i)     = accel1(i);
     accel(i + 6) = accel2(i);
@@ -665,9 +665,9 @@ ElasticTimoshenkoBeam3d::setUp()
   }
 
   // get local axes vectors (these are already normalized)
-  static Vector xAxis(3);
-  static Vector yAxis(3);
-  static Vector zAxis(3);
+  static thread_local Vector xAxis(3);
+  static thread_local Vector yAxis(3);
+  static thread_local Vector zAxis(3);
   theCoordTransf->getLocalAxes(xAxis, yAxis, zAxis);
 
   // create transformation matrix from global to local system
@@ -798,7 +798,7 @@ ElasticTimoshenkoBeam3d::sendSelf(int commitTag, Channel& sChannel)
 {
   int res = 0;
 
-  static Vector data(19);
+  static thread_local Vector data(19);
   data(0)  = this->getTag();
   data(1)  = connectedExternalNodes(0);
   data(2)  = connectedExternalNodes(1);
@@ -849,7 +849,7 @@ ElasticTimoshenkoBeam3d::recvSelf(int commitTag, Channel& rChannel, FEM_ObjectBr
 {
   int res = 0;
 
-  static Vector data(19);
+  static thread_local Vector data(19);
   res += rChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
     opserr << "ElasticTimoshenkoBeam3d::recvSelf() - could not receive data Vector.\n";
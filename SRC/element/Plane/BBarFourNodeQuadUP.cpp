@@ -31,13 +31,13 @@
 
 using OpenSees::VectorND;
 
-Matrix BBarFourNodeQuadUP::K(12,12);
-Vector BBarFourNodeQuadUP::P(12);
-double BBarFourNodeQuadUP::shp[3][4][4];
-double BBarFourNodeQuadUP::dvol[4];
-double BBarFourNodeQuadUP::shpBar[2][4];
-double BBarFourNodeQuadUP::B[4][2][4][4];
-double BBarFourNodeQuadUP::Bp[2][4][4];
+thread_local Matrix BBarFourNodeQuadUP::K(12,12);
+thread_local Vector BBarFourNodeQuadUP::P(12);
+thread_local double BBarFourNodeQuadUP::shp[3][4][4];
+thread_local double BBarFourNodeQuadUP::dvol[4];
+thread_local double BBarFourNodeQuadUP::shpBar[2][4];
+thread_local double BBarFourNodeQuadUP::B[4][2][4][4];
+thread_local double BBarFourNodeQuadUP::Bp[2][4][4];
 Node *BBarFourNodeQuadUP::theNodes[4];
 
 
@@ -412,7 +412,7 @@ BBarFourNodeQuadUP::getInitialStiff()
 const Matrix&
 BBarFourNodeQuadUP::getDamp()
 {
-  static Matrix Kdamp(12,12);
+  static thread_local Matrix Kdamp(12,12);
 
   Kdamp.Zero();
   if (betaK != 0.0)
@@ -681,7 +681,7 @@ BBarFourNodeQuadUP::getResistingForceIncInertia()
   const Vector &accel3 = nd3Ptr->getTrialAccel();
   const Vector &accel4 = nd4Ptr->getTrialAccel();
 
-  static double a[12];
+  static thread_local double a[12];
 
   a[0] = accel1(0);
   a[1] = accel1(1);
@@ -761,7 +761,7 @@ BBarFourNodeQuadUP::sendSelf(int commitTag, Channel &theChannel)
 
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(13);
+  static thread_local Vector data(13);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = rho;
@@ -787,7 +787,7 @@ BBarFourNodeQuadUP::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(12);
+  static thread_local ID idData(12);
 
   for (int i = 0; i < 4; i++) {
     idData(i) = theMaterial[i]->getClassTag();
@@ -835,7 +835,7 @@ BBarFourNodeQuadUP::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the
   // internal data with the data in the Vector
-  static Vector data(13);
+  static thread_local Vector data(13);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING BBarFourNodeQuadUP::recvSelf() - failed to receive Vector\n";
@@ -858,7 +858,7 @@ BBarFourNodeQuadUP::recvSelf(int commitTag, Channel &theChannel,
   perm[0] = data(11);
   perm[1] = data(12);
 
-  static ID idData(12);
+  static thread_local ID idData(12);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -946,17 +946,17 @@ int
 BBarFourNodeQuadUP::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
   // get the end point display coords
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector v3(3);
-  static Vector v4(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector v3(3);
+  static thread_local Vector v4(3);
   nd1Ptr->getDisplayCrds(v1, fact, displayMode);
   nd2Ptr->getDisplayCrds(v2, fact, displayMode);
   nd3Ptr->getDisplayCrds(v3, fact, displayMode);
   nd4Ptr->getDisplayCrds(v4, fact, displayMode);
 
   // place values in coords matrix
-  static Matrix coords(4, 3);
+  static thread_local Matrix coords(4, 3);
   for (int i = 0; i < 3; i++) {
     coords(0, i) = v1(i);
     coords(1, i) = v2(i);
@@ -966,7 +966,7 @@ BBarFourNodeQuadUP::displaySelf(Renderer &theViewer, int displayMode, float fact
 
   // set the quantity to be displayed at the nodes;
   // if displayMode is 1 through 3 we will plot material stresses otherwise 0.0
-  static Vector values(4);
+  static thread_local Vector values(4);
   if (displayMode < 4 && displayMode > 0) {
     for (int i = 0; i < 4; i++) {
       const Vector& stress = theMaterial[i]->getStress();
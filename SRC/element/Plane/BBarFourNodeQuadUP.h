@@ -120,23 +120,23 @@ class BBarFourNodeQuadUP : public Element,
     double perm[2];  // lateral/vertical permeability
 
     // [0,1=derivative wrt x, y; 2=shape func][node][Gauss point]
-    static double shp[3][4][4];    // Stores shape functions and derivatives (overwritten)
+    static thread_local double shp[3][4][4];    // Stores shape functions and derivatives (overwritten)
 //  static double pts[4][2];    // Stores quadrature points
 //  static double wts[4];        // Stores quadrature weights
-    static double dvol[4];  // Stores detJacobian (overwritten)
+    static thread_local double dvol[4];  // Stores detJacobian (overwritten)
 
     // [x,y][node]
-    static double shpBar[2][4]; // Stores averaged shap functions (overwritten)
+    static thread_local double shpBar[2][4]; // Stores averaged shap functions (overwritten)
 
     // [row][col][node][Gauss point]
-    static double B[4][2][4][4];  // Stores strain-displacement matrix (overwritten)
+    static thread_local double B[4][2][4][4];  // Stores strain-displacement matrix (overwritten)
 
     // [col][node][Gauss point]  Note: there is only one row in Bp matrix
-    static double Bp[2][4][4]; // Stores strain-displacement matrix for fluid phase (overwritten)
+    static thread_local double Bp[2][4][4]; // Stores strain-displacement matrix for fluid phase (overwritten)
 
     Matrix *Ki;
-    static Matrix K;        // Element stiffness, damping, and mass Matrix
-    static Vector P;        // Element resisting force vector
+    static thread_local Matrix K;        // Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;        // Element resisting force vector
 
     static Node *theNodes[NEN];
     Node *nd1Ptr;               // Pointers to quad nodes
@@ -82,11 +82,11 @@ void * OPS_ADD_RUNTIME_VPV(OPS_ConstantPressureVolumeQuad)
 #endif
 
 //static data
-double ConstantPressureVolumeQuad :: matrixData[64];
-Matrix ConstantPressureVolumeQuad :: stiff(matrixData,8,8)   ;
-Vector ConstantPressureVolumeQuad :: resid(8)     ;
-Matrix ConstantPressureVolumeQuad :: mass(8,8)    ;
-Matrix ConstantPressureVolumeQuad :: damping(8,8) ;
+thread_local double ConstantPressureVolumeQuad :: matrixData[64];
+thread_local Matrix ConstantPressureVolumeQuad :: stiff(matrixData,8,8)   ;
+thread_local Vector ConstantPressureVolumeQuad :: resid(8)     ;
+thread_local Matrix ConstantPressureVolumeQuad :: mass(8,8)    ;
+thread_local Matrix ConstantPressureVolumeQuad :: damping(8,8) ;
  
 // volume-pressure constants
 double ConstantPressureVolumeQuad :: one3  = 1.0 / 3.0 ;
@@ -260,21 +260,21 @@ ConstantPressureVolumeQuad :: update( )
   int i,  k, l;
   int success = 0;
   
-  static double tmp_shp[3][4] ; //shape functions
+  static thread_local double tmp_shp[3][4] ; //shape functions
 
-  static double shp[3][4][4] ; //shape functions at each gauss point
+  static thread_local double shp[3][4][4] ; //shape functions at each gauss point
 
   double xsj ;  // determinant jacaobian matrix 
 
-  static Matrix sx(2,2) ; // inverse jacobian matrix 
+  static thread_local Matrix sx(2,2) ; // inverse jacobian matrix 
 
   double theta = 0.0 ; //average volume change (trace of strain) 
 
-  static Vector strain(4) ; //strain in vector form 
+  static thread_local Vector strain(4) ; //strain in vector form 
 
   double trace = 0.0 ; //trace of the strain 
 
-  static Vector one(4) ; //rank 2 identity as a vector
+  static thread_local Vector one(4) ; //rank 2 identity as a vector
   
   //one vector
   one(0) = 1.0 ;
@@ -285,7 +285,7 @@ ConstantPressureVolumeQuad :: update( )
 
   // zero stuff
 
-  static double vol_avg_shp[3][4] ; // volume averaged shape functions
+  static thread_local double vol_avg_shp[3][4] ; // volume averaged shape functions
 
   for (int k = 0; k < 3; k++ ){
     for (int l = 0; l < 4; l++ ) 
@@ -425,15 +425,15 @@ const Matrix& ConstantPressureVolumeQuad :: getInitialStiff( )
   int i,  j,  k, l, p, q ;
   int jj, kk ;
   
-  static double tmp_shp[3][4] ; //shape functions
+  static thread_local double tmp_shp[3][4] ; //shape functions
 
-  static double shp[3][4][4] ; //shape functions at each gauss point
+  static thread_local double shp[3][4][4] ; //shape functions at each gauss point
 
-  static double vol_avg_shp[3][4] ; // volume averaged shape functions
+  static thread_local double vol_avg_shp[3][4] ; // volume averaged shape functions
 
   double xsj ;  // determinant jacaobian matrix 
 
-  static Matrix sx(2,2) ; // inverse jacobian matrix 
+  static thread_local Matrix sx(2,2) ; // inverse jacobian matrix 
 
   double dvol[4] ; //volume elements
 
@@ -441,44 +441,44 @@ const Matrix& ConstantPressureVolumeQuad :: getInitialStiff( )
 
   double pressure = 0.0 ; //constitutive pressure  
 
-  static Vector strain(4) ; //strain in vector form 
+  static thread_local Vector strain(4) ; //strain in vector form 
 
   // static Vector sigBar(4) ; //stress in vector form
-  static Vector sig(4) ; //mixed stress in vector form
+  static thread_local Vector sig(4) ; //mixed stress in vector form
 
   double trace = 0.0 ; //trace of the strain 
 
-  static Matrix BJtran(2,4) ; 
-  static Matrix BK(4,2) ;
+  static thread_local Matrix BJtran(2,4) ; 
+  static thread_local Matrix BK(4,2) ;
 
-  static Matrix littleBJtran(2,1) ;
-  static Matrix littleBK(1,2) ; 
+  static thread_local Matrix littleBJtran(2,1) ;
+  static thread_local Matrix littleBK(1,2) ; 
 
-  static Matrix stiffJK(2,2) ; //nodeJ-nodeK 2x2 stiffness
-  static Vector residJ(2) ; //nodeJ residual 
+  static thread_local Matrix stiffJK(2,2) ; //nodeJ-nodeK 2x2 stiffness
+  static thread_local Vector residJ(2) ; //nodeJ residual 
   
-  static Vector one(4) ; //rank 2 identity as a vector
+  static thread_local Vector one(4) ; //rank 2 identity as a vector
   
-  static Matrix Pdev(4,4) ; //deviator projector
+  static thread_local Matrix Pdev(4,4) ; //deviator projector
 
   //  static Matrix dd(4,4) ;  //material tangent
 
-  static Matrix ddPdev(4,4) ;
-  static Matrix PdevDD(4,4) ;
+  static thread_local Matrix ddPdev(4,4) ;
+  static thread_local Matrix PdevDD(4,4) ;
 
-  static double Pdev_dd_Pdev_data[16];
-  static double Pdev_dd_one_data[4]; 
-  static double one_dd_Pdev_data[4];
-  static Matrix Pdev_dd_Pdev(Pdev_dd_Pdev_data, 4, 4);
-  static Matrix Pdev_dd_one(Pdev_dd_one_data, 4, 1); 
-  static Matrix one_dd_Pdev(one_dd_Pdev_data, 1,4) ;
+  static thread_local double Pdev_dd_Pdev_data[16];
+  static thread_local double Pdev_dd_one_data[4]; 
+  static thread_local double one_dd_Pdev_data[4];
+  static thread_local Matrix Pdev_dd_Pdev(Pdev_dd_Pdev_data, 4, 4);
+  static thread_local Matrix Pdev_dd_one(Pdev_dd_one_data, 4, 1); 
+  static thread_local Matrix one_dd_Pdev(one_dd_Pdev_data, 1,4) ;
 
   double bulk ;
-  static Matrix BJtranD(2,4) ;
-  static Matrix BJtranDone(2,1) ;
+  static thread_local Matrix BJtranD(2,4) ;
+  static thread_local Matrix BJtranDone(2,1) ;
 
-  static Matrix littleBJoneD(2,4) ;
-  static Matrix littleBJtranBulk(2,1) ;
+  static thread_local Matrix littleBJoneD(2,4) ;
+  static thread_local Matrix littleBJtranBulk(2,1) ;
   
   //zero stiffness and residual 
   stiff.Zero();
@@ -547,7 +547,7 @@ const Matrix& ConstantPressureVolumeQuad :: getInitialStiff( )
   //residual and tangent calculations gauss loop
   for ( i = 0; i < 4; i++ ) {
 
-    static Matrix dd(4,4);
+    static thread_local Matrix dd(4,4);
 
     dd = materialPointers[i]->getInitialTangent( ) ;
 
@@ -605,8 +605,8 @@ const Matrix& ConstantPressureVolumeQuad :: getInitialStiff( )
       //littleBJoneD     =  littleBJtran * one_dd_Pdev ;
       // littleBJoneD.addMatrixProduct(0.0,  littleBJtran, one_dd_Pdev, 1.0);
       
-      static double Adata[8];
-      static Matrix A(Adata, 2, 4);
+      static thread_local double Adata[8];
+      static thread_local Matrix A(Adata, 2, 4);
       
       // A = BJtranD;
       // A += littleBJoneD;
@@ -747,7 +747,7 @@ const Vector& ConstantPressureVolumeQuad :: getResistingForceIncInertia( )
 {
   int tang_flag = 0 ; //don't get the tangent
 
-  static Vector res(8);
+  static thread_local Vector res(8);
 
   //do tangent and residual here 
   formResidAndTangent( tang_flag ) ;
@@ -781,11 +781,11 @@ void   ConstantPressureVolumeQuad::formInertiaTerms( int tangFlag )
   static const int massIndex = nShape - 1 ;
 
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static Vector momentum(ndf) ;
+  static thread_local Vector momentum(ndf) ;
 
-  static Matrix sx(ndm,ndm) ;
+  static thread_local Matrix sx(ndm,ndm) ;
 
   int i, j, k, p ;
   int jj, kk ;
@@ -876,15 +876,15 @@ void ConstantPressureVolumeQuad::formResidAndTangent( int tang_flag )
   int i,  j,  k, l, p, q ;
   int jj, kk ;
   
-  static double tmp_shp[3][4] ; //shape functions
+  static thread_local double tmp_shp[3][4] ; //shape functions
 
-  static double shp[3][4][4] ; //shape functions at each gauss point
+  static thread_local double shp[3][4][4] ; //shape functions at each gauss point
 
-  static double vol_avg_shp[3][4] ; // volume averaged shape functions
+  static thread_local double vol_avg_shp[3][4] ; // volume averaged shape functions
 
   double xsj ;  // determinant jacaobian matrix 
 
-  static Matrix sx(2,2) ; // inverse jacobian matrix 
+  static thread_local Matrix sx(2,2) ; // inverse jacobian matrix 
 
   double dvol[4] ; //volume elements
 
@@ -892,44 +892,44 @@ void ConstantPressureVolumeQuad::formResidAndTangent( int tang_flag )
 
   double pressure = 0.0 ; //constitutive pressure  
 
-  static Vector strain(4) ; //strain in vector form 
+  static thread_local Vector strain(4) ; //strain in vector form 
 
   // static Vector sigBar(4) ; //stress in vector form
-  static Vector sig(4) ; //mixed stress in vector form
+  static thread_local Vector sig(4) ; //mixed stress in vector form
 
   double trace = 0.0 ; //trace of the strain 
 
-  static Matrix BJtran(2,4) ; 
-  static Matrix BK(4,2) ;
+  static thread_local Matrix BJtran(2,4) ; 
+  static thread_local Matrix BK(4,2) ;
 
-  static Matrix littleBJtran(2,1) ;
-  static Matrix littleBK(1,2) ; 
+  static thread_local Matrix littleBJtran(2,1) ;
+  static thread_local Matrix littleBK(1,2) ; 
 
-  static Matrix stiffJK(2,2) ; //nodeJ-nodeK 2x2 stiffness
-  static Vector residJ(2) ; //nodeJ residual 
+  static thread_local Matrix stiffJK(2,2) ; //nodeJ-nodeK 2x2 stiffness
+  static thread_local Vector residJ(2) ; //nodeJ residual 
   
-  static Vector one(4) ; //rank 2 identity as a vector
+  static thread_local Vector one(4) ; //rank 2 identity as a vector
   
-  static Matrix Pdev(4,4) ; //deviator projector
+  static thread_local Matrix Pdev(4,4) ; //deviator projector
 
   //  static Matrix dd(4,4) ;  //material tangent
 
-  static Matrix ddPdev(4,4) ;
-  static Matrix PdevDD(4,4) ;
+  static thread_local Matrix ddPdev(4,4) ;
+  static thread_local Matrix PdevDD(4,4) ;
 
-  static double Pdev_dd_Pdev_data[16];
-  static double Pdev_dd_one_data[4]; 
-  static double one_dd_Pdev_data[4];
-  static Matrix Pdev_dd_Pdev(Pdev_dd_Pdev_data, 4, 4);
-  static Matrix Pdev_dd_one(Pdev_dd_one_data, 4, 1); 
-  static Matrix one_dd_Pdev(one_dd_Pdev_data, 1,4) ;
+  static thread_local double Pdev_dd_Pdev_data[16];
+  static thread_local double Pdev_dd_one_data[4]; 
+  static thread_local double one_dd_Pdev_data[4];
+  static thread_local Matrix Pdev_dd_Pdev(Pdev_dd_Pdev_data, 4, 4);
+  static thread_local Matrix Pdev_dd_one(Pdev_dd_one_data, 4, 1); 
+  static thread_local Matrix one_dd_Pdev(one_dd_Pdev_data, 1,4) ;
 
   double bulk ;
-  static Matrix BJtranD(2,4) ;
-  static Matrix BJtranDone(2,1) ;
+  static thread_local Matrix BJtranD(2,4) ;
+  static thread_local Matrix BJtranDone(2,1) ;
 
-  static Matrix littleBJoneD(2,4) ;
-  static Matrix littleBJtranBulk(2,1) ;
+  static thread_local Matrix littleBJoneD(2,4) ;
+  static thread_local Matrix littleBJtranBulk(2,1) ;
   
   //zero stiffness and residual 
   if ( tang_flag == 1 ) 
@@ -1017,7 +1017,7 @@ void ConstantPressureVolumeQuad::formResidAndTangent( int tang_flag )
 
     if ( tang_flag == 1 ) {    // compute matrices for stiffness calculation
       
-      static Matrix dd(4,4);
+      static thread_local Matrix dd(4,4);
       dd = materialPointers[i]->getTangent( ) ;
       
       dd *= dvol[i] ;
@@ -1118,8 +1118,8 @@ void ConstantPressureVolumeQuad::formResidAndTangent( int tang_flag )
         //littleBJoneD     =  littleBJtran * one_dd_Pdev ;
         // littleBJoneD.addMatrixProduct(0.0,  littleBJtran, one_dd_Pdev, 1.0);
 
-        static double Adata[8];
-        static Matrix A(Adata, 2, 4);
+        static thread_local double Adata[8];
+        static thread_local Matrix A(Adata, 2, 4);
 
         // A = BJtranD;
         // A += littleBJoneD;
@@ -1227,7 +1227,7 @@ void ConstantPressureVolumeQuad :: shape2d( double ss, double tt,
   static const double s[] = { -0.5,  0.5, 0.5, -0.5 } ;
   static const double t[] = { -0.5, -0.5, 0.5,  0.5 } ;
 
-  static double xs[2][2];
+  static thread_local double xs[2][2];
 
   //  static Matrix xs(2,2) ;
 
@@ -1373,7 +1373,7 @@ ConstantPressureVolumeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 3) {
 
     // Loop over the integration points
-    static Vector stresses(16);
+    static thread_local Vector stresses(16);
     int cnt = 0;
     for (int i = 0; i < 4; i++) {
 
@@ -1389,7 +1389,7 @@ ConstantPressureVolumeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 4) {
 
     // Loop over the integration points
-    static Vector stresses(16);
+    static thread_local Vector stresses(16);
     int cnt = 0;
     for (int i = 0; i < 4; i++) {
 
@@ -1420,7 +1420,7 @@ ConstantPressureVolumeQuad :: sendSelf (int commitTag, Channel &theChannel)
   
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(6);
+  static thread_local Vector data(6);
   data(0) = this->getTag();
   data(1) = thickness;
 
@@ -1439,7 +1439,7 @@ ConstantPressureVolumeQuad :: sendSelf (int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(12);
+  static thread_local ID idData(12);
   
   int i;
   for (i = 0; i < 4; i++) {
@@ -1489,7 +1489,7 @@ ConstantPressureVolumeQuad :: recvSelf (int commitTag,
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(6);
+  static thread_local Vector data(6);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING ConstantPressureVolumeQuad::recvSelf() - failed to receive Vector\n";
@@ -1504,7 +1504,7 @@ ConstantPressureVolumeQuad :: recvSelf (int commitTag,
   betaK0 = data(4);
   betaKc = data(5);
 
-  static ID idData(12);
+  static thread_local ID idData(12);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
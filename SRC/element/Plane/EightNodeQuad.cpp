@@ -29,9 +29,9 @@ using namespace OpenSees;
 
 
 double EightNodeQuad::matrixData[(NEN*2)*(NEN*2)];
-Matrix EightNodeQuad::K(matrixData, NEN*2, NEN*2);
-Vector EightNodeQuad::P(NEN*2);
-double EightNodeQuad::shp[3][NEN];
+thread_local Matrix EightNodeQuad::K(matrixData, NEN*2, NEN*2);
+thread_local Vector EightNodeQuad::P(NEN*2);
+thread_local double EightNodeQuad::shp[3][NEN];
 // double EightNodeQuad::pts[nip][2];
 // double EightNodeQuad::wts[nip];
 
@@ -372,7 +372,7 @@ EightNodeQuad::getMass()
     K.Zero();
 
     int i;
-    static double rhoi[nip];
+    static thread_local double rhoi[nip];
     double sum = 0.0;
     for (i = 0; i < nip; i++) {
       if (rho == 0)
@@ -442,7 +442,7 @@ int
 EightNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int i;
-  static double rhoi[nip];
+  static thread_local double rhoi[nip];
   double sum = 0.0;
   for (i = 0; i < nip; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -469,7 +469,7 @@ EightNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
     return -1;
   }
 
-  static double ra[NEN*2];
+  static thread_local double ra[NEN*2];
 
   ra[0] = Raccel1(0);
   ra[1] = Raccel1(1);
@@ -555,7 +555,7 @@ const Vector&
 EightNodeQuad::getResistingForceIncInertia()
 {
     int i;
-    static double rhoi[nip];
+    static thread_local double rhoi[nip];
     double sum = 0.0;
     for (i = 0; i < nip; i++) {
       rhoi[i] = theMaterial[i]->getRho();
@@ -582,7 +582,7 @@ EightNodeQuad::getResistingForceIncInertia()
     const Vector &accel7 = theNodes[6]->getTrialAccel();
     const Vector &accel8 = theNodes[7]->getTrialAccel();
 
-    static double a[NEN*2];
+    static thread_local double a[NEN*2];
 
     a[0] = accel1(0);
     a[1] = accel1(1);
@@ -630,7 +630,7 @@ EightNodeQuad::sendSelf(int commitTag, Channel &theChannel)
 
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(9);
+  static thread_local Vector data(9);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = b[0];
@@ -652,7 +652,7 @@ EightNodeQuad::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(2*nip+NEN);
+  static thread_local ID idData(2*nip+NEN);
 
   int i;
   for (i = 0; i < nip; i++) {
@@ -699,7 +699,7 @@ EightNodeQuad::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the
   // internal data with the data in the Vector
-  static Vector data(9);
+  static thread_local Vector data(9);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING EightNodeQuad::recvSelf() - failed to receive Vector\n";
@@ -717,7 +717,7 @@ EightNodeQuad::recvSelf(int commitTag, Channel &theChannel,
   betaK0 = data(7);
   betaKc = data(8);
 
-  static ID idData(2*nip+NEN);
+  static thread_local ID idData(2*nip+NEN);
   // Quad now receives the tags of its nine external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -818,8 +818,8 @@ EightNodeQuad::Print(OPS_Stream &s, int flag)
     // spit out the section location & invoke print on the scetion
     const int numMaterials = nip;
 
-    static Vector avgStress(nstress);
-    static Vector avgStrain(nstress);
+    static thread_local Vector avgStress(nstress);
+    static thread_local Vector avgStrain(nstress);
     avgStress.Zero();
     avgStrain.Zero();
     for (i=0; i<numMaterials; i++) {
@@ -981,7 +981,7 @@ EightNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 3) {
 
     // Loop over the integration points
-    static Vector stresses(3*nip);
+    static thread_local Vector stresses(3*nip);
     int cnt = 0;
     for (int i = 0; i < nip; i++) {
 
@@ -998,8 +998,8 @@ EightNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 11) {
 
     // extrapolate stress from Gauss points to element nodes
-    static Vector stressGP(3*nip);
-    static Vector stressAtNodes(3*NEN);
+    static thread_local Vector stressGP(3*nip);
+    static thread_local Vector stressAtNodes(3*NEN);
     stressAtNodes.Zero();
     int cnt = 0;
     // first get stress components (xx, yy, xy) at Gauss points
@@ -1037,7 +1037,7 @@ EightNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 4) {
 
     // Loop over the integration points
-    static Vector stresses(3*nip);
+    static thread_local Vector stresses(3*nip);
     int cnt = 0;
     for (int i = 0; i < nip; i++) {
 
@@ -97,8 +97,8 @@ private:
   Node *theNodes[NEN];
 
   static double matrixData[(NEN*2)*(NEN*2)]; // array data for matrix
-  static Matrix K;              // Element stiffness, damping, and mass Matrix
-  static Vector P;              // Element resisting force vector
+  static thread_local Matrix K;              // Element stiffness, damping, and mass Matrix
+  static thread_local Vector P;              // Element resisting force vector
   Vector Q;                     // Applied nodal loads
   double b[2];                  // Body forces
 
@@ -112,7 +112,7 @@ private:
   double pressure;  // Normal surface traction (pressure) over entire element
                    // Note: positive for outward normal
   double rho;
-  static double shp[3][NEN]; // Stores shape functions and derivatives (overwritten)
+  static thread_local double shp[3][NEN]; // Stores shape functions and derivatives (overwritten)
 //static double pts[nip][2]; // Stores quadrature points
 //static double wts[nip];    // Stores quadrature weights
 
@@ -29,10 +29,10 @@ using namespace OpenSees;
 
 
 // static data
-double  EnhancedQuad::xl[2][4] ;
-Matrix  EnhancedQuad::stiff(8,8) ;
-Vector  EnhancedQuad::resid(8) ;
-Matrix  EnhancedQuad::mass(8,8) ;
+thread_local double  EnhancedQuad::xl[2][4] ;
+thread_local Matrix  EnhancedQuad::stiff(8,8) ;
+thread_local Vector  EnhancedQuad::resid(8) ;
+thread_local Matrix  EnhancedQuad::mass(8,8) ;
 
 
 //***********************************************************************
@@ -119,8 +119,8 @@ computeBenhanced(int node,
                   BT &B)
 {
   // static Matrix B(3,2) ;
-  static double JinvTran[2][2] ;
-  static double shape[2] ;
+  static thread_local double JinvTran[2][2] ;
+  static thread_local double shape[2] ;
 
 
   // compute JinvTran
@@ -408,7 +408,7 @@ const Vector&  EnhancedQuad::getResistingForceIncInertia( )
 {
   int tang_flag = 0 ; // don't get the tangent
 
-  static Vector res(8);
+  static thread_local Vector res(8);
 
   // do tangent and residual here 
   formResidAndTangent( tang_flag ) ;
@@ -435,9 +435,9 @@ const Vector&  EnhancedQuad::getResistingForceIncInertia( )
 void   EnhancedQuad::formInertiaTerms( int tangFlag ) 
 {
 
-  static double shp[nShape][numberNodes] ;  // shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  // shape functions at a gauss point
 
-  static Vector momentum(NDF);
+  static thread_local Vector momentum(NDF);
   mass.Zero( ) ;
 
   // gauss loop 
@@ -512,17 +512,17 @@ int  EnhancedQuad::formResidAndTangent( int tang_flag )
   OPS_STATIC double dvol[nip] ; // volume element
   OPS_STATIC double Shape[nip][nShape][numberNodes]; // [nip] ; // all the shape functions
 
-  static Vector residJ(NDF) ; // nodeJ residual
+  static thread_local Vector residJ(NDF) ; // nodeJ residual
   // static Matrix dd(nstress,nstress) ;  // material tangent
 
-  static Matrix Kee(nEnhanced,nEnhanced) ;
+  static thread_local Matrix Kee(nEnhanced,nEnhanced) ;
 
-  static Vector residE(nEnhanced);
-  static Vector Umode(NDF);
-  static Vector dalpha(nEnhanced);
-  static Matrix Kue(numberDOF,nEnhanced) ;
-  static Matrix Keu(nEnhanced,numberDOF) ;
-  static Matrix KeeInvKeu(nEnhanced,numberDOF);
+  static thread_local Vector residE(nEnhanced);
+  static thread_local Vector Umode(NDF);
+  static thread_local Vector dalpha(nEnhanced);
+  static thread_local Matrix Kue(numberDOF,nEnhanced) ;
+  static thread_local Matrix Keu(nEnhanced,numberDOF) ;
+  static thread_local Matrix KeeInvKeu(nEnhanced,numberDOF);
   
   // zero stiffness and residual 
   stiff.Zero( );
@@ -816,8 +816,8 @@ void  EnhancedQuad::shape2d(double ss, double tt,
   static constexpr double s[] = { -0.5,  0.5, 0.5, -0.5 } ;
   static constexpr double t[] = { -0.5, -0.5, 0.5,  0.5 } ;
 
-  static Matrix xs(2,2) ;
-  static Matrix sx(2,2) ;
+  static thread_local Matrix xs(2,2) ;
+  static thread_local Matrix sx(2,2) ;
 
   for (int i = 0; i < 4; i++ ) {
       shp[2][i] = ( 0.5 + s[i]*ss )*( 0.5 + t[i]*tt ) ;
@@ -961,7 +961,7 @@ EnhancedQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 3) {
 
     // Loop over the integration points
-    static Vector stresses(12);
+    static thread_local Vector stresses(12);
     int cnt = 0;
     for (int i = 0; i < 4; i++) {
 
@@ -977,7 +977,7 @@ EnhancedQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 4) {
 
     // Loop over the integration points
-    static Vector stresses(12);
+    static thread_local Vector stresses(12);
     int cnt = 0;
     for (int i = 0; i < 4; i++) {
 
@@ -1007,7 +1007,7 @@ EnhancedQuad::sendSelf (int commitTag, Channel &theChannel)
   
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(6);
+  static thread_local Vector data(6);
   data(0) = this->getTag();
   data(1) = thickness;
 
@@ -1026,7 +1026,7 @@ EnhancedQuad::sendSelf (int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(12);
+  static thread_local ID idData(12);
 
   for (int i = 0; i < 4; i++) {
     idData(i) = materialPointers[i]->getClassTag();
@@ -1074,7 +1074,7 @@ EnhancedQuad::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(6);
+  static thread_local Vector data(6);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING EnhancedQuad::recvSelf() - failed to receive Vector\n";
@@ -1089,7 +1089,7 @@ EnhancedQuad::recvSelf(int commitTag, Channel &theChannel,
   betaK0 = data(4);
   betaKc = data(5);
 
-  static ID idData(12);
+  static thread_local ID idData(12);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
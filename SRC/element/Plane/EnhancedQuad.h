@@ -113,10 +113,10 @@ class EnhancedQuad : public Element,
     static constexpr int massIndex = nShape - 1 ;
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damping ;
 
     //quadrature data
 //  static const double root3 ;
@@ -146,7 +146,7 @@ class EnhancedQuad : public Element,
 					  
     //local nodal coordinates, two coordinates for each of four nodes
     //    static double xl[2][4] ; 
-    static double xl[][4] ; 
+    static thread_local double xl[][4] ; 
 
     //compute enhanced strain B-matrices
     // const Matrix& computeBenhanced( int node, 
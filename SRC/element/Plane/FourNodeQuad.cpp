@@ -27,10 +27,10 @@
 using namespace OpenSees;
 
 
-double FourNodeQuad::matrixData[64];
-Matrix FourNodeQuad::K(matrixData, 8, 8);
-Vector FourNodeQuad::P(8);
-double FourNodeQuad::shp[3][4];
+thread_local double FourNodeQuad::matrixData[64];
+thread_local Matrix FourNodeQuad::K(matrixData, 8, 8);
+thread_local Vector FourNodeQuad::P(8);
+thread_local double FourNodeQuad::shp[3][4];
 
 FourNodeQuad::FourNodeQuad(int tag, 
                            std::array<int,4>& nodes,
@@ -391,7 +391,7 @@ FourNodeQuad::getMass()
     K.Zero();
 
     int i;
-    static double rhoi[4];
+    static thread_local double rhoi[4];
     double sum = 0.0;
     for (i = 0; i < nip; i++) {
       if (rho == 0)
@@ -461,7 +461,7 @@ FourNodeQuad::addLoad(ElementalLoad *theLoad, double loadFactor)
 int 
 FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 {
-  static double rhoi[4];
+  static thread_local double rhoi[4];
   double sum = 0.0;
   for (int i = 0; i < 4; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -483,7 +483,7 @@ FourNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
     return -1;
   }
   
-  static double ra[8];
+  static thread_local double ra[8];
   
   ra[0] = Raccel1(0);
   ra[1] = Raccel1(1);
@@ -558,7 +558,7 @@ const Vector&
 FourNodeQuad::getResistingForceIncInertia()
 {
     int i;
-    static double rhoi[4];
+    static thread_local double rhoi[4];
     double sum = 0.0;
     for (int i = 0; i < 4; i++) {
       rhoi[i] = theMaterial[i]->getRho();
@@ -621,7 +621,7 @@ FourNodeQuad::sendSelf(int commitTag, Channel &theChannel)
   
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(9);
+  static thread_local Vector data(9);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = b[0];
@@ -642,7 +642,7 @@ FourNodeQuad::sendSelf(int commitTag, Channel &theChannel)
 
   // Now quad sends the ids of its materials
   
-  static ID idData(12);
+  static thread_local ID idData(12);
   
   for (int i = 0; i < 4; i++) {
     idData(i) = theMaterial[i]->getClassTag();
@@ -688,7 +688,7 @@ FourNodeQuad::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(9);
+  static thread_local Vector data(9);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING FourNodeQuad::recvSelf() - failed to receive Vector\n";
@@ -706,7 +706,7 @@ FourNodeQuad::recvSelf(int commitTag, Channel &theChannel,
   betaK0 = data(7);
   betaKc = data(8);
 
-  static ID idData(12);
+  static thread_local ID idData(12);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -816,8 +816,8 @@ FourNodeQuad::Print(OPS_Stream &s, int flag)
     // spit out the section location & invoke print on the scetion
     const int numMaterials = 4;
 
-    static Vector avgStress(nstress);
-    static Vector avgStrain(nstress);
+    static thread_local Vector avgStress(nstress);
+    static thread_local Vector avgStrain(nstress);
     avgStress.Zero();
     avgStrain.Zero();
     for (i=0; i<numMaterials; i++) {
@@ -974,7 +974,7 @@ FourNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 3) {
 
     // Loop over the integration points
-    static Vector stresses(12);
+    static thread_local Vector stresses(12);
     int cnt = 0;
     for (int i = 0; i < 4; i++) {
 
@@ -991,8 +991,8 @@ FourNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 11) {
 
     // extrapolate stress from Gauss points to element nodes
-    static Vector stressGP(12);      // 3*nip
-    static Vector stressAtNodes(12); // 3*nnodes
+    static thread_local Vector stressGP(12);      // 3*nip
+    static thread_local Vector stressAtNodes(12); // 3*nnodes
     stressAtNodes.Zero();
     int cnt = 0;
         // first get stress components (xx, yy, xy) at Gauss points
@@ -1028,7 +1028,7 @@ FourNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 4) {
 
     // Loop over the integration points
-    static Vector stresses(12);
+    static thread_local Vector stresses(12);
     int cnt = 0;
     for (int i = 0; i < 4; i++) {
 
@@ -1305,14 +1305,14 @@ int
 FourNodeQuad::commitSensitivity(int gradNumber, int numGrads)
 {
 	
-	static double u[NDM][NEN];
+	static thread_local double u[NDM][NEN];
 
   for (int i=0; i<NEN; i++) {
 	  u[0][i] = theNodes[i]->getDispSensitivity(1,gradNumber);
 	  u[1][i] = theNodes[i]->getDispSensitivity(2,gradNumber);
   }
 
-	static Vector eps(3);
+	static thread_local Vector eps(3);
 
 	int ret = 0;
 
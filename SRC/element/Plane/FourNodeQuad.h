@@ -77,6 +77,7 @@ class FourNodeQuad : public Element,
 
     const Vector &getResistingForce();
     const Vector &getResistingForceIncInertia();            
+    bool hasOnlyRayleighDamping() const {return true;}
 
     // Public methods for element output
 
@@ -129,9 +130,9 @@ class FourNodeQuad : public Element,
     std::array<Node *, NEN> theNodes;
 
     Matrix *Ki;
-    static double matrixData[64];   // array data for matrix
-    static Matrix K;                // Element stiffness, damping, and mass Matrix
-    static Vector P;                // Element resisting force vector
+    static thread_local double matrixData[64];   // array data for matrix
+    static thread_local Matrix K;                // Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;                // Element resisting force vector
     Vector Q;                       // Applied nodal loads
     double b[2];                    // Body forces
 
@@ -144,7 +145,7 @@ class FourNodeQuad : public Element,
     double pressure;                 // Normal surface traction (pressure) over entire element
                                      // Note: positive for outward normal
     double rho;
-    static double shp[3][NEN];       // shape functions and derivatives
+    static thread_local double shp[3][NEN];       // shape functions and derivatives
 
     int parameterID;
 
@@ -41,11 +41,11 @@
 #include <ElementalLoad.h>
 
 
-double FourNodeQuad3d::matrixData[144];
-Matrix FourNodeQuad3d::K(matrixData, 12, 12);
-Vector FourNodeQuad3d::P(12);
-double FourNodeQuad3d::shp[3][4];
-double FourNodeQuad3d::pts[4][2];
+thread_local double FourNodeQuad3d::matrixData[144];
+thread_local Matrix FourNodeQuad3d::K(matrixData, 12, 12);
+thread_local Vector FourNodeQuad3d::P(12);
+thread_local double FourNodeQuad3d::shp[3][4];
+thread_local double FourNodeQuad3d::pts[4][2];
 double FourNodeQuad3d::wts[4];
 
 #include <elementAPI.h>
@@ -384,7 +384,7 @@ FourNodeQuad3d::update()
   const Vector &disp3 = theNodes[2]->getTrialDisp();
   const Vector &disp4 = theNodes[3]->getTrialDisp();
   
-  static double u[2][4];
+  static thread_local double u[2][4];
   
   u[0][0] = disp1(dirn[0]);
   u[1][0] = disp1(dirn[1]);
@@ -395,7 +395,7 @@ FourNodeQuad3d::update()
   u[0][3] = disp4(dirn[0]);
   u[1][3] = disp4(dirn[1]);
   
-  static Vector eps(3);
+  static thread_local Vector eps(3);
   
   int ret = 0;
 
@@ -572,7 +572,7 @@ FourNodeQuad3d::getMass()
   K.Zero();
   
   int i;
-  static double rhoi[4];
+  static thread_local double rhoi[4];
   double sum = 0.0;
   for (i = 0; i < 4; i++) {
     if (rho == 0)
@@ -644,7 +644,7 @@ int
 FourNodeQuad3d::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int i;
-  static double rhoi[4];
+  static thread_local double rhoi[4];
   double sum = 0.0;
   for (i = 0; i < 4; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -660,7 +660,7 @@ FourNodeQuad3d::addInertiaLoadToUnbalance(const Vector &accel)
   const Vector &Raccel3 = theNodes[2]->getRV(accel);
   const Vector &Raccel4 = theNodes[3]->getRV(accel);
   
-  static double ra[12];
+  static thread_local double ra[12];
   
   ra[0] = Raccel1(0);
   ra[1] = Raccel1(1);
@@ -744,7 +744,7 @@ const Vector&
 FourNodeQuad3d::getResistingForceIncInertia()
 {
   int i;
-  static double rhoi[4];
+  static thread_local double rhoi[4];
   double sum = 0.0;
   for (i = 0; i < 4; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -767,7 +767,7 @@ FourNodeQuad3d::getResistingForceIncInertia()
   const Vector &accel3 = theNodes[2]->getTrialAccel();
   const Vector &accel4 = theNodes[3]->getTrialAccel();
   
-  static double a[12];
+  static thread_local double a[12];
   
   a[0] = accel1(0);
   a[1] = accel1(1);
@@ -811,7 +811,7 @@ FourNodeQuad3d::sendSelf(int commitTag, Channel &theChannel)
   
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(10);
+  static thread_local Vector data(10);
   data(0) = this->getTag();
   data(1) = thickness;
   data(3) = b[0];
@@ -833,7 +833,7 @@ FourNodeQuad3d::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(12);
+  static thread_local ID idData(12);
   
   int i;
   for (i = 0; i < 4; i++) {
@@ -882,7 +882,7 @@ FourNodeQuad3d::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(10);
+  static thread_local Vector data(10);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING FourNodeQuad3d::recvSelf() - failed to receive Vector\n";
@@ -900,7 +900,7 @@ FourNodeQuad3d::recvSelf(int commitTag, Channel &theChannel,
   betaK0 = data(8);
   betaKc = data(9);
 
-  static ID idData(12);
+  static thread_local ID idData(12);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -989,8 +989,8 @@ FourNodeQuad3d::Print(OPS_Stream &s, int flag)
         // spit out the section location & invoke print on the scetion
         const int numMaterials = 4;
 
-        static Vector avgStress(nstress);
-        static Vector avgStrain(nstress);
+        static thread_local Vector avgStress(nstress);
+        static thread_local Vector avgStrain(nstress);
         avgStress.Zero();
         avgStrain.Zero();
         for (i = 0; i < numMaterials; i++) {
@@ -1044,17 +1044,17 @@ int
 FourNodeQuad3d::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **mdes, int numMode)
 {
     // get the end point display coords
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
-    static Vector v4(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
+    static thread_local Vector v4(3);
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
     theNodes[2]->getDisplayCrds(v3, fact, displayMode);
     theNodes[3]->getDisplayCrds(v4, fact, displayMode);
 
     // place values in coords matrix
-    static Matrix coords(4, 3);
+    static thread_local Matrix coords(4, 3);
     for (int i = 0; i < 3; i++) {
         coords(0, i) = v1(i);
         coords(1, i) = v2(i);
@@ -1064,7 +1064,7 @@ FourNodeQuad3d::displaySelf(Renderer &theViewer, int displayMode, float fact, co
 
     // set the quantity to be displayed at the nodes;
     // if displayMode is 1 through 3 we will plot material stresses otherwise 0.0
-    static Vector values(4);
+    static thread_local Vector values(4);
     if (displayMode < 4 && displayMode > 0) {
         for (int i = 0; i < 4; i++) {
             const Vector& stress = theMaterial[i]->getStress();
@@ -1159,7 +1159,7 @@ FourNodeQuad3d::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 3) {
 
     // Loop over the integration points
-    static Vector stresses(12);
+    static thread_local Vector stresses(12);
     int cnt = 0;
     for (int i = 0; i < 4; i++) {
 
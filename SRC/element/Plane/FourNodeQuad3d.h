@@ -113,9 +113,9 @@ class FourNodeQuad3d : public Element
 
     Node *theNodes[NEN];
 
-    static double matrixData[144];  // array data for matrix
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local double matrixData[144];  // array data for matrix
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
     Vector Q;		        // Applied nodal loads
     double b[2];		// Body forces
 
@@ -129,8 +129,8 @@ class FourNodeQuad3d : public Element
     double pressure;	        // Normal surface traction (pressure) over entire element
 					 // Note: positive for outward normal
     double rho;
-    static double shp[3][4];	// Stores shape functions and derivatives (overwritten)
-    static double pts[4][2];	// Stores quadrature points
+    static thread_local double shp[3][4];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double pts[4][2];	// Stores quadrature points
     static double wts[4];	// Stores quadrature weights
 
     // private member functions - only objects of this class can call these
@@ -25,11 +25,11 @@
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
 
-Matrix FourNodeQuadUP::K(12,12);
-Vector FourNodeQuadUP::P(12);
-double FourNodeQuadUP::shp[3][4][4];
-double FourNodeQuadUP::dvol[4];
-double FourNodeQuadUP::shpBar[3][4];
+thread_local Matrix FourNodeQuadUP::K(12,12);
+thread_local Vector FourNodeQuadUP::P(12);
+thread_local double FourNodeQuadUP::shp[3][4][4];
+thread_local double FourNodeQuadUP::dvol[4];
+thread_local double FourNodeQuadUP::shpBar[3][4];
 Node *FourNodeQuadUP::theNodes[4];
 
 
@@ -285,7 +285,7 @@ FourNodeQuadUP::update()
   const Vector &disp3 = nd3Ptr->getTrialDisp();
   const Vector &disp4 = nd4Ptr->getTrialDisp();
   
-  static double u[2][4];
+  static thread_local double u[2][4];
   if (end1InitDisp == 0) {
     u[0][0] = disp1(0);
     u[1][0] = disp1(1);
@@ -317,7 +317,7 @@ FourNodeQuadUP::update()
     u[1][3] = disp4(1) - end4InitDisp[1];;
   }
 
-  static Vector eps(3);
+  static thread_local Vector eps(3);
 
   int ret = 0;
   
@@ -436,7 +436,7 @@ const Matrix &FourNodeQuadUP::getInitialStiff ()
 const Matrix&
 FourNodeQuadUP::getDamp()
 {
-  static Matrix Kdamp(12,12);
+  static thread_local Matrix Kdamp(12,12);
   Kdamp.Zero();
 
   if (betaK != 0.0)
@@ -711,7 +711,7 @@ FourNodeQuadUP::getResistingForceIncInertia()
   const Vector &accel3 = nd3Ptr->getTrialAccel();
   const Vector &accel4 = nd4Ptr->getTrialAccel();
 
-  static double a[12];
+  static thread_local double a[12];
 
   a[0] = accel1(0);
   a[1] = accel1(1);
@@ -790,7 +790,7 @@ FourNodeQuadUP::sendSelf(int commitTag, Channel &theChannel)
 
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(13);
+  static thread_local Vector data(13);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = rho;
@@ -816,7 +816,7 @@ FourNodeQuadUP::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(12);
+  static thread_local ID idData(12);
 
   int i;
   for (i = 0; i < 4; i++) {
@@ -865,7 +865,7 @@ FourNodeQuadUP::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the
   // internal data with the data in the Vector
-  static Vector data(13);
+  static thread_local Vector data(13);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING FourNodeQuadUP::recvSelf() - failed to receive Vector\n";
@@ -888,7 +888,7 @@ FourNodeQuadUP::recvSelf(int commitTag, Channel &theChannel,
   perm[0] = data(11);
   perm[1] = data(12);
 
-  static ID idData(12);
+  static thread_local ID idData(12);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -976,17 +976,17 @@ int
 FourNodeQuadUP::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **argv, int numModes)
 {
     // get the end point display coords
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
-    static Vector v4(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
+    static thread_local Vector v4(3);
     nd1Ptr->getDisplayCrds(v1, fact, displayMode);
     nd2Ptr->getDisplayCrds(v2, fact, displayMode);
     nd3Ptr->getDisplayCrds(v3, fact, displayMode);
     nd4Ptr->getDisplayCrds(v4, fact, displayMode);
 
     // place values in coords matrix
-    static Matrix coords(4, 3);
+    static thread_local Matrix coords(4, 3);
     for (int i = 0; i < 3; i++) {
         coords(0, i) = v1(i);
         coords(1, i) = v2(i);
@@ -996,7 +996,7 @@ FourNodeQuadUP::displaySelf(Renderer &theViewer, int displayMode, float fact, co
 
     // set the quantity to be displayed at the nodes;
     // if displayMode is 1 through 3 we will plot material stresses otherwise 0.0
-    static Vector values(4);
+    static thread_local Vector values(4);
     if (displayMode < 4 && displayMode > 0) {
         for (int i = 0; i < 4; i++) {
             const Vector& stress = theMaterial[i]->getStress();
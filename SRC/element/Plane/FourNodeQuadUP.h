@@ -92,8 +92,8 @@ class FourNodeQuadUP : public Element,
     Node *nd3Ptr;
     Node *nd4Ptr;
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
     Vector Q;		// Applied nodal loads
     double b[2];		// Body forces
 	double appliedB[2]; // Body forces applied with load pattern, C.McGann, U.Washington
@@ -107,11 +107,11 @@ class FourNodeQuadUP : public Element,
 
     // Note: positive for outward normal
     double perm[2];  // lateral/vertical permeability
-    static double shp[3][4][4];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shp[3][4][4];	// Stores shape functions and derivatives (overwritten)
 //  static double pts[4][2];	// Stores quadrature points
 //  static double wts[4];		// Stores quadrature weights
-    static double dvol[4];  // Stores detJacobian (overwritten)
-    static double shpBar[3][4]; // Stores averaged shap functions (overwritten)
+    static thread_local double dvol[4];  // Stores detJacobian (overwritten)
+    static thread_local double shpBar[3][4]; // Stores averaged shap functions (overwritten)
     // private member functions - only objects of this class can call these
     double mixtureRho(int ipt);  // Mixture mass density at integration point i
     void shapeFunction(void);
@@ -41,11 +41,11 @@
 #include <ElementalLoad.h>
 #define ELE_TAG_FourNodeQuadWithSensitivity 100000011
 
-double FourNodeQuadWithSensitivity::matrixData[64];
-Matrix FourNodeQuadWithSensitivity::K(matrixData, 8, 8);
-Vector FourNodeQuadWithSensitivity::P(8);
-double FourNodeQuadWithSensitivity::shp[3][4];
-double FourNodeQuadWithSensitivity::pts[4][2];
+thread_local double FourNodeQuadWithSensitivity::matrixData[64];
+thread_local Matrix FourNodeQuadWithSensitivity::K(matrixData, 8, 8);
+thread_local Vector FourNodeQuadWithSensitivity::P(8);
+thread_local double FourNodeQuadWithSensitivity::shp[3][4];
+thread_local double FourNodeQuadWithSensitivity::pts[4][2];
 double FourNodeQuadWithSensitivity::wts[4];
 
 #include <elementAPI.h>
@@ -346,7 +346,7 @@ FourNodeQuadWithSensitivity::update()
 	const Vector &disp3 = theNodes[2]->getTrialDisp();
 	const Vector &disp4 = theNodes[3]->getTrialDisp();
 
-	static double u[2][4];
+	static thread_local double u[2][4];
 
 	u[0][0] = disp1(0);
 	u[1][0] = disp1(1);
@@ -357,7 +357,7 @@ FourNodeQuadWithSensitivity::update()
 	u[0][3] = disp4(0);
 	u[1][3] = disp4(1);
 
-	static Vector eps(3);
+	static thread_local Vector eps(3);
 
 	int ret = 0;
 
@@ -503,7 +503,7 @@ FourNodeQuadWithSensitivity::getMass()
 	K.Zero();
 
 	int i;
-	static double rhoi[4];
+	static thread_local double rhoi[4];
 	double sum = this->rho;
 	for (i = 0; i < 4; i++) {
 	  rhoi[i] = theMaterial[i]->getRho();
@@ -570,7 +570,7 @@ int
 FourNodeQuadWithSensitivity::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int i;
-  static double rhoi[4];
+  static thread_local double rhoi[4];
   double sum = this->rho;
   for (i = 0; i < 4; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -592,7 +592,7 @@ FourNodeQuadWithSensitivity::addInertiaLoadToUnbalance(const Vector &accel)
     return -1;
   }
 
-  static double ra[8];
+  static thread_local double ra[8];
 
   ra[0] = Raccel1(0);
   ra[1] = Raccel1(1);
@@ -670,7 +670,7 @@ const Vector&
 FourNodeQuadWithSensitivity::getResistingForceIncInertia()
 {
 	int i;
-	static double rhoi[4];
+	static thread_local double rhoi[4];
 	double sum = this->rho;
 	for (i = 0; i < 4; i++) {
 	  rhoi[i] = theMaterial[i]->getRho();
@@ -693,7 +693,7 @@ FourNodeQuadWithSensitivity::getResistingForceIncInertia()
 	const Vector &accel3 = theNodes[2]->getTrialAccel();
 	const Vector &accel4 = theNodes[3]->getTrialAccel();
 
-	static double a[8];
+	static thread_local double a[8];
 
 	a[0] = accel1(0);
 	a[1] = accel1(1);
@@ -733,7 +733,7 @@ FourNodeQuadWithSensitivity::sendSelf(int commitTag, Channel &theChannel)
 
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(10);
+  static thread_local Vector data(10);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = rho;
@@ -756,7 +756,7 @@ FourNodeQuadWithSensitivity::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(12);
+  static thread_local ID idData(12);
 
   int i;
   for (i = 0; i < 4; i++) {
@@ -805,7 +805,7 @@ FourNodeQuadWithSensitivity::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the
   // internal data with the data in the Vector
-  static Vector data(10);
+  static thread_local Vector data(10);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING FourNodeQuadWithSensitivity::recvSelf() - failed to receive Vector\n";
@@ -822,7 +822,7 @@ FourNodeQuadWithSensitivity::recvSelf(int commitTag, Channel &theChannel,
   betaK = data(7);
   betaK0 = data(8);
   betaKc = data(9);
-  static ID idData(12);
+  static thread_local ID idData(12);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -911,8 +911,8 @@ FourNodeQuadWithSensitivity::Print(OPS_Stream &s, int flag)
     // spit out the section location & invoke print on the scetion
     const int numMaterials = 4;
 
-    static Vector avgStress(nstress);
-    static Vector avgStrain(nstress);
+    static thread_local Vector avgStress(nstress);
+    static thread_local Vector avgStrain(nstress);
     avgStress.Zero();
     avgStrain.Zero();
     for (i=0; i<numMaterials; i++) {
@@ -968,17 +968,17 @@ int
 FourNodeQuadWithSensitivity::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numModes)
 {
 	// get the end point display coords
-	static Vector v1(3);
-	static Vector v2(3);
-	static Vector v3(3);
-	static Vector v4(3);
+	static thread_local Vector v1(3);
+	static thread_local Vector v2(3);
+	static thread_local Vector v3(3);
+	static thread_local Vector v4(3);
 	theNodes[0]->getDisplayCrds(v1, fact, displayMode);
 	theNodes[1]->getDisplayCrds(v2, fact, displayMode);
 	theNodes[2]->getDisplayCrds(v3, fact, displayMode);
 	theNodes[3]->getDisplayCrds(v4, fact, displayMode);
 
 	// place values in coords matrix
-	static Matrix coords(4, 3);
+	static thread_local Matrix coords(4, 3);
 	for (int i = 0; i < 3; i++) {
 		coords(0, i) = v1(i);
 		coords(1, i) = v2(i);
@@ -988,7 +988,7 @@ FourNodeQuadWithSensitivity::displaySelf(Renderer &theViewer, int displayMode, f
 
 	// set the quantity to be displayed at the nodes;
 	// if displayMode is 1 through 3 we will plot material stresses otherwise 0.0
-	static Vector values(4);
+	static thread_local Vector values(4);
 	if (displayMode < 4 && displayMode > 0) {
 		for (int i = 0; i < 4; i++) {
 			const Vector& stress = theMaterial[i]->getStress();
@@ -1325,7 +1325,7 @@ int
 FourNodeQuadWithSensitivity::commitSensitivity(int gradNumber, int numGrads)
 {
 	
-	static double u[2][4];
+	static thread_local double u[2][4];
 
 	u[0][0] = theNodes[0]->getDispSensitivity(1,gradNumber);
 	u[1][0] = theNodes[0]->getDispSensitivity(2,gradNumber);
@@ -1336,7 +1336,7 @@ FourNodeQuadWithSensitivity::commitSensitivity(int gradNumber, int numGrads)
 	u[0][3] = theNodes[3]->getDispSensitivity(1,gradNumber);
 	u[1][3] = theNodes[3]->getDispSensitivity(2,gradNumber);
 
-	static Vector eps(3);
+	static thread_local Vector eps(3);
 
 	int ret = 0;
 
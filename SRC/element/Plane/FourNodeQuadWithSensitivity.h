@@ -116,9 +116,9 @@ class FourNodeQuadWithSensitivity : public Element
 
     Node *theNodes[4];
 
-    static double matrixData[64];  // array data for matrix
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local double matrixData[64];  // array data for matrix
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
     Vector Q;		        // Applied nodal loads
     double b[2];		// Body forces
 
@@ -131,8 +131,8 @@ class FourNodeQuadWithSensitivity : public Element
     double rho;			// Mass per unit volume
     double pressure;	        // Normal surface traction (pressure) over entire element
 					 // Note: positive for outward normal
-    static double shp[3][4];	// Stores shape functions and derivatives (overwritten)
-    static double pts[4][2];	// Stores quadrature points
+    static thread_local double shp[3][4];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double pts[4][2];	// Stores quadrature points
     static double wts[4];		// Stores quadrature weights
 
     // private member functions - only objects of this class can call these
@@ -139,12 +139,12 @@ void* OPS_ADD_RUNTIME_VPV(OPS_IGAQuad)
 }
 
 
-double IGAQuad::matrixData[324];
-Matrix IGAQuad::K(18,18);
-Vector IGAQuad::P(18);
-double IGAQuad::shp[3][9];
-double IGAQuad::pts[9][2];
-double IGAQuad::wts[9];
+thread_local double IGAQuad::matrixData[324];
+thread_local Matrix IGAQuad::K(18,18);
+thread_local Vector IGAQuad::P(18);
+thread_local double IGAQuad::shp[3][9];
+thread_local double IGAQuad::pts[9][2];
+thread_local double IGAQuad::wts[9];
 
 //Matrix* IGAQuad::N0n;
 
@@ -394,7 +394,7 @@ IGAQuad::update()
       //u[0][3] = disp4(0);
       //u[1][3] = disp4(1);
 
-      static Vector eps(3);
+      static thread_local Vector eps(3);
 
       int ret = 0;
 
@@ -546,7 +546,7 @@ IGAQuad::getMass()
 {
     K.Zero();
 
-    static double rhoi[4];
+    static thread_local double rhoi[4];
     double sum = 0.0;
     for (int i = 0; i < 4; i++) {
       if (rho == 0)
@@ -623,7 +623,7 @@ int
 IGAQuad::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int i;
-  static double rhoi[4];
+  static thread_local double rhoi[4];
   double sum = 0.0;
   for (i = 0; i < numCPs; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -634,7 +634,7 @@ IGAQuad::addInertiaLoadToUnbalance(const Vector &accel)
     return 0;
   
   // Get R * accel from the nodes
-  static Vector ra(ndof);
+  static thread_local Vector ra(ndof);
   for (i = 1; i <= numCPs; i++) {
       const Vector& Raccel_temp = theNodes[i - 1]->getRV(accel);
       ra[i - 1] = Raccel_temp(0);
@@ -736,7 +736,7 @@ const Vector&
 IGAQuad::getResistingForceIncInertia()
 {
         int i;
-        static double rhoi[4];
+        static thread_local double rhoi[4];
         double sum = 0.0;
         for (i = 0; i < 4; i++) {
           rhoi[i] = theMaterial[i]->getRho();
@@ -759,7 +759,7 @@ IGAQuad::getResistingForceIncInertia()
         const Vector &accel3 = theNodes[2]->getTrialAccel();
         const Vector &accel4 = theNodes[3]->getTrialAccel();
         
-        static double a[8];
+        static thread_local double a[8];
 
         a[0] = accel1(0);
         a[1] = accel1(1);
@@ -799,7 +799,7 @@ IGAQuad::sendSelf(int commitTag, Channel &theChannel)
   
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(9);
+  static thread_local Vector data(9);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = b[0];
@@ -821,7 +821,7 @@ IGAQuad::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(3*numCPs);
+  static thread_local ID idData(3*numCPs);
   
   int i;
   for (i = 0; i < numCPs; i++) {
@@ -871,7 +871,7 @@ IGAQuad::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(9);
+  static thread_local Vector data(9);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING IGAQuad::recvSelf() - failed to receive Vector\n";
@@ -889,7 +889,7 @@ IGAQuad::recvSelf(int commitTag, Channel &theChannel,
   betaK0 = data(7);
   betaKc = data(8);
 
-  static ID idData(3*numCPs);
+  static thread_local ID idData(3*numCPs);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -978,8 +978,8 @@ IGAQuad::Print(OPS_Stream &s, int flag)
     // spit out the section location & invoke print on the scetion
     const int numMaterials = numCPs;
 
-    static Vector avgStress(nstress);
-    static Vector avgStrain(nstress);
+    static thread_local Vector avgStress(nstress);
+    static thread_local Vector avgStrain(nstress);
     avgStress.Zero();
     avgStrain.Zero();
     for (i=0; i<numMaterials; i++) {
@@ -1135,7 +1135,7 @@ IGAQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 3) {
 
     // Loop over the integration points
-    static Vector stresses(3*numCPs);
+    static thread_local Vector stresses(3*numCPs);
     int cnt = 0;
     for (int i = 0; i < numCPs; i++) {
 
@@ -1152,7 +1152,7 @@ IGAQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 4) {
 
     // Loop over the integration points
-    static Vector stresses(3*numCPs);
+    static thread_local Vector stresses(3*numCPs);
     int cnt = 0;
     for (int i = 0; i < numCPs; i++) {
 
@@ -93,9 +93,9 @@ private:
 
     Node* theNodes[9];
 
-    static double matrixData[324];  // array data for matrix
-    static Matrix K;		            // Element stiffness, damping, and mass Matrix
-    static Vector P;		            // Element resisting force vector
+    static thread_local double matrixData[324];  // array data for matrix
+    static thread_local Matrix K;		            // Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		            // Element resisting force vector
     Vector Q;		                    // Applied nodal loads
     double b[2];		                // Body forces
 
@@ -110,9 +110,9 @@ private:
     void setPressureLoadAtNodes();
 
     double rho;
-    static double shp[3][9];	// Stores shape functions and derivatives (overwritten)
-    static double pts[9][2];	// Stores quadrature points
-    static double wts[9];		  // Stores quadrature weights
+    static thread_local double shp[3][9];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double pts[9][2];	// Stores quadrature points
+    static thread_local double wts[9];		  // Stores quadrature weights
                               //
 
     // IGA
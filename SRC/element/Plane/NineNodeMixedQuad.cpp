@@ -33,10 +33,10 @@
 
 
 //static data
-Matrix  NineNodeMixedQuad :: stiff(18,18)   ;
-Vector  NineNodeMixedQuad :: resid(18)     ;
-Matrix  NineNodeMixedQuad :: mass(18,18)    ;
-double  NineNodeMixedQuad::xl[2][9];
+thread_local Matrix  NineNodeMixedQuad :: stiff(18,18)   ;
+thread_local Vector  NineNodeMixedQuad :: resid(18)     ;
+thread_local Matrix  NineNodeMixedQuad :: mass(18,18)    ;
+thread_local double  NineNodeMixedQuad::xl[2][9];
  
 //quadrature data
 double   NineNodeMixedQuad::root06 = sqrt(0.6) ;
@@ -318,49 +318,49 @@ NineNodeMixedQuad::getInitialStiff( )
 
   static double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[numberGauss] ; //volume element
+  static thread_local double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static double natCoorArray[ndm][numberGauss] ;
+  static thread_local double natCoorArray[ndm][numberGauss] ;
 
-  static Vector strain(nstress) ;  //strain
+  static thread_local Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double shpBar[nShape][numberNodes][nMixed] ; //mean value of shape functions
+  static thread_local double shpBar[nShape][numberNodes][nMixed] ; //mean value of shape functions
 
-  static double rightHandSide[nShape][numberNodes][nMixed] ;
+  static thread_local double rightHandSide[nShape][numberNodes][nMixed] ;
 
-  static Vector residJ(ndf) ; //nodeJ residual 
+  static thread_local Vector residJ(ndf) ; //nodeJ residual 
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
 
-  static Vector stress(nstress) ;  //stress
+  static thread_local Vector stress(nstress) ;  //stress
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
-  static double interp[nMixed] ;
+  static thread_local double interp[nMixed] ;
 
-  static Matrix Proj(3,3) ;   //projection matrix 
-  static Matrix ProjInv(3,3) ;
+  static thread_local Matrix Proj(3,3) ;   //projection matrix 
+  static thread_local Matrix ProjInv(3,3) ;
 
-  static Matrix Iden(3,3) ;
+  static thread_local Matrix Iden(3,3) ;
   Iden(0,0) = 1.0 ;
   Iden(1,1) = 1.0 ;
   Iden(2,2) = 1.0 ;
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -618,7 +618,7 @@ NineNodeMixedQuad::getResistingForceIncInertia( )
 {
   int tang_flag = 0 ; //don't get the tangent
 
-  static Vector res(18);
+  static thread_local Vector res(18);
 
   //do tangent and residual here 
   formResidAndTangent( tang_flag ) ;
@@ -662,13 +662,13 @@ NineNodeMixedQuad::formInertiaTerms( int tangFlag )
 
   double dvol ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static Vector momentum(ndf) ;
+  static thread_local Vector momentum(ndf) ;
 
-  static Matrix sx(ndm,ndm) ;
+  static thread_local Matrix sx(ndm,ndm) ;
 
-  static double GaussPoint[2] ;
+  static thread_local double GaussPoint[2] ;
 
   int j, k, p, q, r ;
   int jj, kk ;
@@ -774,46 +774,46 @@ NineNodeMixedQuad::formResidAndTangent( int tang_flag )
 
   static double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[numberGauss] ; //volume element
+  static thread_local double dvol[numberGauss] ; //volume element
 
-  static double gaussPoint[ndm] ;
+  static thread_local double gaussPoint[ndm] ;
 
-  static double natCoorArray[ndm][numberGauss] ;
+  static thread_local double natCoorArray[ndm][numberGauss] ;
 
-  static Vector strain(nstress) ;  //strain
+  static thread_local Vector strain(nstress) ;  //strain
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+  static thread_local double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
 
-  static double shpBar[nShape][numberNodes][nMixed] ; //mean value of shape functions
+  static thread_local double shpBar[nShape][numberNodes][nMixed] ; //mean value of shape functions
 
-  static double rightHandSide[nShape][numberNodes][nMixed] ;
+  static thread_local double rightHandSide[nShape][numberNodes][nMixed] ;
 
-  static Vector residJ(ndf) ; //nodeJ residual 
+  static thread_local Vector residJ(ndf) ; //nodeJ residual 
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
 
-  static Vector stress(nstress) ;  //stress
+  static thread_local Vector stress(nstress) ;  //stress
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
-  static double interp[nMixed] ;
+  static thread_local double interp[nMixed] ;
 
-  static Matrix Proj(3,3) ;   //projection matrix 
-  static Matrix ProjInv(3,3) ;
+  static thread_local Matrix Proj(3,3) ;   //projection matrix 
+  static thread_local Matrix ProjInv(3,3) ;
 
-  static Matrix Iden(3,3) ;
+  static thread_local Matrix Iden(3,3) ;
   Iden(0,0) = 1.0 ;
   Iden(1,1) = 1.0 ;
   Iden(2,2) = 1.0 ;
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-    static Matrix BJtran(ndf,nstress) ;
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
   //-------------------------------------------------------
 
@@ -1063,15 +1063,15 @@ NineNodeMixedQuad::computeBbar( int node,
                             double shpBar[3][9][3] )
 {
 
-  static Matrix Bbar(4,2) ;
+  static thread_local Matrix Bbar(4,2) ;
 
-  static double Bdev[3][2] ;
+  static thread_local double Bdev[3][2] ;
 
-  static double BbarVol[3][2] ;
+  static thread_local double BbarVol[3][2] ;
 
   static const double one3 = 1.0/3.0 ;
 
-  static double interp[3] ;
+  static thread_local double interp[3] ;
 
   static double c0, c1 ;
 
@@ -1178,8 +1178,8 @@ NineNodeMixedQuad::shape2dNine( double coor[2],
 
   int i, j, k, q ;
 
-  static double xs[ndm][ndm] ;
-  static double sx[ndm][ndm] ;
+  static thread_local double xs[ndm][ndm] ;
+  static thread_local double sx[ndm][ndm] ;
 
   double ss = coor[0] ;
   double tt = coor[1] ;
@@ -1371,7 +1371,7 @@ NineNodeMixedQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 3) {
 
     // Loop over the integration points
-    static Vector stresses(4*9);
+    static thread_local Vector stresses(4*9);
     int cnt = 0;
     for (int i = 0; i < 9; i++) {
 
@@ -1405,7 +1405,7 @@ NineNodeMixedQuad::sendSelf (int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(28);
+  static thread_local ID idData(28);
   
   int i;
   for (i = 0; i < 9; i++) {
@@ -1461,7 +1461,7 @@ NineNodeMixedQuad::recvSelf (int commitTag,
   
   int dataTag = this->getDbTag();
 
-  static ID idData(28);
+  static thread_local ID idData(28);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
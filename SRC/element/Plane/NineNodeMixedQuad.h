@@ -87,10 +87,10 @@ class NineNodeMixedQuad : public Element {
   private : 
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damping ;
     
     
     // quadrature data
@@ -106,7 +106,7 @@ class NineNodeMixedQuad : public Element {
     NDMaterial *materialPointers[9] ; //pointers to nine materials
 					  
     //nodal coordinates, two coordinates for each of nine nodes
-    static double xl[][9] ; 
+    static thread_local double xl[][9] ; 
     
     //form residual and tangent					  
     void formResidAndTangent( int tang_flag ) ;
@@ -43,9 +43,9 @@
 using OpenSees::VectorND;
 
 double NineNodeQuad::matrixData[(NEN*2)*(NEN*2)];
-Matrix NineNodeQuad::K(matrixData, 2*NEN, 2*NEN);
-Vector NineNodeQuad::P(2*NEN);
-double NineNodeQuad::shp[3][NEN];
+thread_local Matrix NineNodeQuad::K(matrixData, 2*NEN, 2*NEN);
+thread_local Vector NineNodeQuad::P(2*NEN);
+thread_local double NineNodeQuad::shp[3][NEN];
 
 NineNodeQuad::NineNodeQuad(int tag, 
                            const std::array<int,9>& nodes,
@@ -366,7 +366,7 @@ NineNodeQuad::getMass()
     K.Zero();
 
     int i;
-    static double rhoi[nip];
+    static thread_local double rhoi[nip];
     double sum = 0.0;
     for (int i = 0; i < nip; i++) {
       if (rho == 0)
@@ -437,7 +437,7 @@ int
 NineNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int i;
-  static double rhoi[nip];
+  static thread_local double rhoi[nip];
   double sum = 0.0;
   for (int i = 0; i < nip; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -465,7 +465,7 @@ NineNodeQuad::addInertiaLoadToUnbalance(const Vector &accel)
     return -1;
   }
 
-  static double ra[2*NEN];
+  static thread_local double ra[2*NEN];
 
   ra[0] = Raccel1(0);
   ra[1] = Raccel1(1);
@@ -606,7 +606,7 @@ NineNodeQuad::sendSelf(int commitTag, Channel &theChannel)
 
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(9);
+  static thread_local Vector data(9);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = b[0];
@@ -628,7 +628,7 @@ NineNodeQuad::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(2*nip+NEN);
+  static thread_local ID idData(2*nip+NEN);
 
   int i;
   for (int i = 0; i < nip; i++) {
@@ -675,7 +675,7 @@ NineNodeQuad::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the
   // internal data with the data in the Vector
-  static Vector data(9);
+  static thread_local Vector data(9);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING NineNodeQuad::recvSelf() - failed to receive Vector\n";
@@ -693,7 +693,7 @@ NineNodeQuad::recvSelf(int commitTag, Channel &theChannel,
   betaK0 = data(7);
   betaKc = data(8);
 
-  static ID idData(2*nip+NEN);
+  static thread_local ID idData(2*nip+NEN);
   // Quad now receives the tags of its nine external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -778,8 +778,8 @@ NineNodeQuad::Print(OPS_Stream &s, int flag)
     // spit out the section location & invoke print on the scetion
     const int numMaterials = nip;
 
-    static Vector avgStress(nstress);
-    static Vector avgStrain(nstress);
+    static thread_local Vector avgStress(nstress);
+    static thread_local Vector avgStrain(nstress);
     avgStress.Zero();
     avgStrain.Zero();
     for (i=0; i<numMaterials; i++) {
@@ -962,7 +962,7 @@ NineNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 3) {
 
     // Loop over the integration points
-    static Vector stresses(3*nip);
+    static thread_local Vector stresses(3*nip);
     int cnt = 0;
     for (int i = 0; i < nip; i++) {
 
@@ -979,8 +979,8 @@ NineNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 11) {
 
     // extrapolate stress from Gauss points to element nodes
-    static Vector stressGP(3*nip);
-    static Vector stressAtNodes(3*NEN);
+    static thread_local Vector stressGP(3*nip);
+    static thread_local Vector stressAtNodes(3*NEN);
     stressAtNodes.Zero();
     int cnt = 0;
     // first get stress components (xx, yy, xy) at Gauss points
@@ -1019,7 +1019,7 @@ NineNodeQuad::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 4) {
 
     // Loop over the integration points
-    static Vector stresses(3*nip);
+    static thread_local Vector stresses(3*nip);
     int cnt = 0;
     for (int i = 0; i < nip; i++) {
 
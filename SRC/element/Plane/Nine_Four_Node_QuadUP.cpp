@@ -96,19 +96,19 @@ void * OPS_ADD_RUNTIME_VPV(OPS_NineFourNodeQuadUP)
 }
 #endif
 
-Matrix NineFourNodeQuadUP::K(22,22);
-Vector NineFourNodeQuadUP::P(22);
-double NineFourNodeQuadUP::shgu[3][9][9];
-double NineFourNodeQuadUP::shgp[3][4][4];
-double NineFourNodeQuadUP::shgq[3][9][4];
-double NineFourNodeQuadUP::shlu[3][9][9];
-double NineFourNodeQuadUP::shlp[3][4][4];
-double NineFourNodeQuadUP::shlq[3][9][4];
+thread_local Matrix NineFourNodeQuadUP::K(22,22);
+thread_local Vector NineFourNodeQuadUP::P(22);
+thread_local double NineFourNodeQuadUP::shgu[3][9][9];
+thread_local double NineFourNodeQuadUP::shgp[3][4][4];
+thread_local double NineFourNodeQuadUP::shgq[3][9][4];
+thread_local double NineFourNodeQuadUP::shlu[3][9][9];
+thread_local double NineFourNodeQuadUP::shlp[3][4][4];
+thread_local double NineFourNodeQuadUP::shlq[3][9][4];
 double NineFourNodeQuadUP::wu[9];
 double NineFourNodeQuadUP::wp[4];
-double NineFourNodeQuadUP::dvolu[9];
-double NineFourNodeQuadUP::dvolp[4];
-double NineFourNodeQuadUP::dvolq[4];
+thread_local double NineFourNodeQuadUP::dvolu[9];
+thread_local double NineFourNodeQuadUP::dvolp[4];
+thread_local double NineFourNodeQuadUP::dvolq[4];
 const int NineFourNodeQuadUP::nintu=9;
 const int NineFourNodeQuadUP::nintp=4;
 const int NineFourNodeQuadUP::nenu=9;
@@ -304,7 +304,7 @@ NineFourNodeQuadUP::revertToStart()
 int
 NineFourNodeQuadUP::update()
 {
-  static double u[2][9];
+  static thread_local double u[2][9];
   int i;
   for (i = 0; i < nenu; i++) {
     const Vector &disp = theNodes[i]->getTrialDisp();
@@ -318,7 +318,7 @@ NineFourNodeQuadUP::update()
     }
   }
 
-  static Vector eps(3);
+  static thread_local Vector eps(3);
 
   int ret = 0;
 
@@ -349,8 +349,8 @@ const Matrix&
 NineFourNodeQuadUP::getTangentStiff()
 {
   int i, j, j2, j2m1, ik, ib, jk, jb;
-  static Matrix B(3,nenu*2);
-  static Matrix BTDB(nenu*2,nenu*2);
+  static thread_local Matrix B(3,nenu*2);
+  static thread_local Matrix BTDB(nenu*2,nenu*2);
 
   B.Zero();
   BTDB.Zero();
@@ -406,8 +406,8 @@ const Matrix &NineFourNodeQuadUP::getInitialStiff ()
   if (Ki != 0) return *Ki;
 
   int i, j, j2, j2m1, ik, ib, jk, jb;
-  static Matrix B(3,nenu*2);
-  static Matrix BTDB(nenu*2,nenu*2);
+  static thread_local Matrix B(3,nenu*2);
+  static thread_local Matrix BTDB(nenu*2,nenu*2);
 
   B.Zero();
   BTDB.Zero();
@@ -467,7 +467,7 @@ const Matrix &NineFourNodeQuadUP::getInitialStiff ()
 const Matrix&
 NineFourNodeQuadUP::getDamp()
 {
-  static Matrix Kdamp(22,22);
+  static thread_local Matrix Kdamp(22,22);
   Kdamp.Zero();
 
   if (betaK != 0.0)
@@ -615,7 +615,7 @@ NineFourNodeQuadUP::addInertiaLoadToUnbalance(const Vector &accel)
   // accel = uDotDotG (see EarthquakePattern.cpp)
   // Get R * accel from the nodes
 
-  static Vector ra(22);
+  static thread_local Vector ra(22);
   int i, j, ik;
 
   ra.Zero();
@@ -714,7 +714,7 @@ const Vector&
 NineFourNodeQuadUP::getResistingForceIncInertia()
 {
   int i, j, ik;
-  static double a[22];
+  static thread_local double a[22];
 
   for (i=0; i<nenu; i++) {
     const Vector &accel = theNodes[i]->getTrialAccel();
@@ -778,7 +778,7 @@ NineFourNodeQuadUP::sendSelf(int commitTag, Channel &theChannel)
   int dataTag = this->getDbTag();
   // NineFourNodeQuadUP packs its data into a Vector and sends this to theChannel
     // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(13);
+  static thread_local Vector data(13);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = rho;
@@ -799,7 +799,7 @@ NineFourNodeQuadUP::sendSelf(int commitTag, Channel &theChannel)
   }
   // Now NineFourNodeQuadUP sends the ids of its materials
   int matDbTag;
-  static ID idData(27);
+  static thread_local ID idData(27);
   int i;
   for (i = 0; i < 9; i++) {
     idData(i) = theMaterial[i]->getClassTag();
@@ -839,7 +839,7 @@ NineFourNodeQuadUP::recvSelf(int commitTag, Channel &theChannel,
   int dataTag = this->getDbTag();
   // Quad creates a Vector, receives the Vector and then sets the
   // internal data with the data in the Vector
-  static Vector data(13);
+  static thread_local Vector data(13);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING NineFourNodeQuadUP::recvSelf() - failed to receive Vector\n";
@@ -858,7 +858,7 @@ NineFourNodeQuadUP::recvSelf(int commitTag, Channel &theChannel,
   kc = data(10);
   perm[0] = data(11);
   perm[1] = data(12);
-  static ID idData(27);
+  static thread_local ID idData(27);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -938,14 +938,14 @@ int
 NineFourNodeQuadUP::displaySelf(Renderer &theViewer, int displayMode, float fact, const char **modes, int numMode)
 {
     // get the end point display coords
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
-    static Vector v4(3);
-    static Vector v5(3);
-    static Vector v6(3);
-    static Vector v7(3);
-    static Vector v8(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
+    static thread_local Vector v4(3);
+    static thread_local Vector v5(3);
+    static thread_local Vector v6(3);
+    static thread_local Vector v7(3);
+    static thread_local Vector v8(3);
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
     theNodes[2]->getDisplayCrds(v3, fact, displayMode);
@@ -955,7 +955,7 @@ NineFourNodeQuadUP::displaySelf(Renderer &theViewer, int displayMode, float fact
     theNodes[6]->getDisplayCrds(v7, fact, displayMode);
     theNodes[7]->getDisplayCrds(v8, fact, displayMode);
     // place values in coords matrix
-    static Matrix coords(8, 3);
+    static thread_local Matrix coords(8, 3);
     for (int i = 0; i < 3; i++) {
         coords(0, i) = v1(i);
         coords(1, i) = v5(i);
@@ -968,7 +968,7 @@ NineFourNodeQuadUP::displaySelf(Renderer &theViewer, int displayMode, float fact
     }
     // set the quantity to be displayed at the nodes;
     // if displayMode is 1 through 8 we will plot material stresses otherwise 0.0
-    static Vector values(8);
+    static thread_local Vector values(8);
     if (displayMode < 8 && displayMode > 0) {
         const Vector& stress1 = theMaterial[0]->getStress();
         const Vector& stress2 = theMaterial[1]->getStress();
@@ -1125,7 +1125,7 @@ NineFourNodeQuadUP::updateParameter(int parameterID, Information &info)
 }
 void NineFourNodeQuadUP::globalShapeFunction(double *dvol, double *w, int nint, int nen, int mode)
 {
-  static double coord[2][9], xs[2][2], det, temp;
+  static thread_local double coord[2][9], xs[2][2], det, temp;
   int i, j, k, m;
 
   for (i=0; i<3; i++) {
@@ -95,8 +95,8 @@ class NineFourNodeQuadUP : public Element
 
     ID connectedExternalNodes; // Tags of quad nodes
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static thread_local Matrix K;		// Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;		// Element resisting force vector
     Vector Q;		// Applied nodal loads
     double b[2];		// Body forces
     double appliedB[2]; // Body forces applied with load pattern, C.McGann, U.Washington
@@ -114,17 +114,17 @@ class NineFourNodeQuadUP : public Element
     static const int nenu;
     static const int nenp;
 
-    static double shgu[3][9][9];	// Stores shape functions and derivatives (overwritten)
-    static double shgp[3][4][4];	// Stores shape functions and derivatives (overwritten)
-    static double shgq[3][9][4];	// Stores shape functions and derivatives (overwritten)
-    static double shlu[3][9][9];	// Stores shape functions and derivatives
-    static double shlp[3][4][4];	// Stores shape functions and derivatives
-    static double shlq[3][9][4];	// Stores shape functions and derivatives
+    static thread_local double shgu[3][9][9];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shgp[3][4][4];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shgq[3][9][4];	// Stores shape functions and derivatives (overwritten)
+    static thread_local double shlu[3][9][9];	// Stores shape functions and derivatives
+    static thread_local double shlp[3][4][4];	// Stores shape functions and derivatives
+    static thread_local double shlq[3][9][4];	// Stores shape functions and derivatives
     static double wu[9];		// Stores quadrature weights
     static double wp[4];		// Stores quadrature weights
-    static double dvolu[9];  // Stores detJacobian (overwritten)
-    static double dvolp[4];  // Stores detJacobian (overwritten)
-    static double dvolq[4];  // Stores detJacobian (overwritten)
+    static thread_local double dvolu[9];  // Stores detJacobian (overwritten)
+    static thread_local double dvolp[4];  // Stores detJacobian (overwritten)
+    static thread_local double dvolq[4];  // Stores detJacobian (overwritten)
 
     // private member functions - only objects of this class can call these
     double mixtureRho(int ipt);  // Mixture mass density at integration point i
@@ -28,19 +28,19 @@
 #include <FEM_ObjectBroker.h>
 #include <ElementResponse.h>
 
-Matrix NineFourNodeQuadUP::K(22,22);
-Vector NineFourNodeQuadUP::P(22);
-double NineFourNodeQuadUP::shgu[3][9][9];	
-double NineFourNodeQuadUP::shgp[3][4][4];	
-double NineFourNodeQuadUP::shgq[3][9][4];	
-double NineFourNodeQuadUP::shlu[3][9][9];	
-double NineFourNodeQuadUP::shlp[3][4][4];	
-double NineFourNodeQuadUP::shlq[3][9][4];	
+thread_local Matrix NineFourNodeQuadUP::K(22,22);
+thread_local Vector NineFourNodeQuadUP::P(22);
+thread_local double NineFourNodeQuadUP::shgu[3][9][9];	
+thread_local double NineFourNodeQuadUP::shgp[3][4][4];	
+thread_local double NineFourNodeQuadUP::shgq[3][9][4];	
+thread_local double NineFourNodeQuadUP::shlu[3][9][9];	
+thread_local double NineFourNodeQuadUP::shlp[3][4][4];	
+thread_local double NineFourNodeQuadUP::shlq[3][9][4];	
 double NineFourNodeQuadUP::wu[9];	
 double NineFourNodeQuadUP::wp[4];	
-double NineFourNodeQuadUP::dvolu[9];  
-double NineFourNodeQuadUP::dvolp[4];  
-double NineFourNodeQuadUP::dvolq[4];  
+thread_local double NineFourNodeQuadUP::dvolu[9];  
+thread_local double NineFourNodeQuadUP::dvolp[4];  
+thread_local double NineFourNodeQuadUP::dvolq[4];  
 const int NineFourNodeQuadUP::nintu=9;
 const int NineFourNodeQuadUP::nintp=4;
 const int NineFourNodeQuadUP::nenu=9;
@@ -224,7 +224,7 @@ NineFourNodeQuadUP::revertToStart()
 int
 NineFourNodeQuadUP::update()
 {
-  static double u[2][9];
+  static thread_local double u[2][9];
   int i;
   for (i = 0; i < nenu; i++) {
     const Vector &disp = theNodes[i]->getTrialDisp();
@@ -232,7 +232,7 @@ NineFourNodeQuadUP::update()
     u[1][i] = disp(1);
   }
   
-  static Vector eps(3);
+  static thread_local Vector eps(3);
   
   int ret = 0;
   
@@ -263,8 +263,8 @@ NineFourNodeQuadUP::update()
 const Matrix&
 NineFourNodeQuadUP::getTangentStiff()
 {
-  static Matrix B(3,nenu*2);
-  static Matrix BTDB(nenu*2,nenu*2);
+  static thread_local Matrix B(3,nenu*2);
+  static thread_local Matrix BTDB(nenu*2,nenu*2);
 
   B.Zero(); 
   BTDB.Zero();
@@ -323,8 +323,8 @@ const Matrix &NineFourNodeQuadUP::getInitialStiff ()
     return *Ki;
 
   int i, j, j2, j2m1, ik, ib, jk, jb;
-  static Matrix B(3,nenu*2);
-  static Matrix BTDB(nenu*2,nenu*2);
+  static thread_local Matrix B(3,nenu*2);
+  static thread_local Matrix BTDB(nenu*2,nenu*2);
 
   B.Zero(); 
   BTDB.Zero();
@@ -385,7 +385,7 @@ const Matrix &NineFourNodeQuadUP::getInitialStiff ()
 const Matrix&
 NineFourNodeQuadUP::getDamp()
 {
-  static Matrix Kdamp(22,22);
+  static thread_local Matrix Kdamp(22,22);
   Kdamp.Zero();
   
   if (betaK != 0.0)
@@ -522,7 +522,7 @@ NineFourNodeQuadUP::addInertiaLoadToUnbalance(const Vector &accel)
   // accel = uDotDotG (see EarthquakePattern.cpp)
   // Get R * accel from the nodes
 
-  static Vector ra(22);
+  static thread_local Vector ra(22);
   int i, j, ik;
 
   ra.Zero();
@@ -611,7 +611,7 @@ const Vector&
 NineFourNodeQuadUP::getResistingForceIncInertia()
 {
   int i, j, ik;
-  static double a[22];
+  static thread_local double a[22];
 
   for (i=0; i<nenu; i++) {
     const Vector &accel = theNodes[i]->getTrialAccel();
@@ -677,7 +677,7 @@ NineFourNodeQuadUP::sendSelf(int commitTag, Channel &theChannel)
   
   // Quad packs its data into a Vector and sends this to theChannel
 	// along with its dbTag and the commitTag passed in the arguments
-  static Vector data(10);
+  static thread_local Vector data(10);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = rho;
@@ -750,7 +750,7 @@ NineFourNodeQuadUP::recvSelf(int commitTag, Channel &theChannel,
   
   // Quad creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
-  static Vector data(7);
+  static thread_local Vector data(7);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING NineFourNodeQuadUP::recvSelf() - failed to receive Vector\n";
@@ -871,7 +871,7 @@ NineFourNodeQuadUP::displaySelf(Renderer &theViewer, int displayMode, float fact
     // first set the quantity to be displayed at the nodes;
     // if displayMode is 1 through 3 we will plot material stresses otherwise 0.0
 
-    static Vector values(9);
+    static thread_local Vector values(9);
 
     for (int j=0; j<9; j++)
 	   values(j) = 0.0;
@@ -896,7 +896,7 @@ NineFourNodeQuadUP::displaySelf(Renderer &theViewer, int displayMode, float fact
     const Vector &end3Disp = nd3Ptr->getDisp();
     const Vector &end4Disp = nd4Ptr->getDisp();
 
-    static Matrix coords(4,3);
+    static thread_local Matrix coords(4,3);
 
     for (int i = 0; i < 2; i++) {
       coords(0,i) = end1Crd(i) + end1Disp(i)*fact;
@@ -1022,7 +1022,7 @@ NineFourNodeQuadUP::updateParameter(int parameterID, Information &info)
 
 void NineFourNodeQuadUP::globalShapeFunction(double *dvol, double *w, int nint, int nen, int mode)
 {
-  static double coord[2][9], xs[2][2], det, temp;
+  static thread_local double coord[2][9], xs[2][2], det, temp;
   int i, j, k, m;
 
   for (i=0; i<3; i++) {
@@ -44,10 +44,10 @@
 using OpenSees::VectorND;
 
 double SixNodeTri::matrixData[(NEN*NDF)*(NEN*NDF)];
-Matrix SixNodeTri::K(matrixData, NDF*NEN, NDF*NEN);
-Vector SixNodeTri::P(2*NEN);
-double SixNodeTri::shp[3][NEN];
-double SixNodeTri::pts[nip][2];
+thread_local Matrix SixNodeTri::K(matrixData, NDF*NEN, NDF*NEN);
+thread_local Vector SixNodeTri::P(2*NEN);
+thread_local double SixNodeTri::shp[3][NEN];
+thread_local double SixNodeTri::pts[nip][2];
 double SixNodeTri::wts[nip];
 
 SixNodeTri::SixNodeTri(int tag, 
@@ -452,7 +452,7 @@ SixNodeTri::addLoad(ElementalLoad *theLoad, double loadFactor)
 int
 SixNodeTri::addInertiaLoadToUnbalance(const Vector &accel)
 {
-  static double rhoi[nip];
+  static thread_local double rhoi[nip];
   double sum = 0.0;
   for (int i = 0; i < nip; i++) {
     rhoi[i] = theMaterial[i]->getRho();
@@ -462,7 +462,7 @@ SixNodeTri::addInertiaLoadToUnbalance(const Vector &accel)
   if (sum == 0.0)
     return 0;
 
-  static double ra[NEN*NDF];
+  static thread_local double ra[NEN*NDF];
 
   // Get R * accel from the nodes
   for (int i=0; i<NEN; i++) {
@@ -537,7 +537,7 @@ const Vector&
 SixNodeTri::getResistingForceIncInertia()
 {
     int i;
-    static double rhoi[nip];
+    static thread_local double rhoi[nip];
     double sum = 0.0;
     for (i = 0; i < nip; i++) {
       rhoi[i] = theMaterial[i]->getRho();
@@ -562,7 +562,7 @@ SixNodeTri::getResistingForceIncInertia()
     const Vector &accel5 = theNodes[4]->getTrialAccel();
     const Vector &accel6 = theNodes[5]->getTrialAccel();
 
-    static double a[2*NEN];
+    static thread_local double a[2*NEN];
 
     a[0] = accel1(0);
     a[1] = accel1(1);
@@ -606,7 +606,7 @@ SixNodeTri::sendSelf(int commitTag, Channel &theChannel)
 
   // Quad packs its data into a Vector and sends this to theChannel
   // along with its dbTag and the commitTag passed in the arguments
-  static Vector data(9);
+  static thread_local Vector data(9);
   data(0) = this->getTag();
   data(1) = thickness;
   data(2) = b[0];
@@ -628,7 +628,7 @@ SixNodeTri::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(2*nip+NEN);
+  static thread_local ID idData(2*nip+NEN);
 
   int i;
   for (int i = 0; i < nip; i++) {
@@ -676,7 +676,7 @@ SixNodeTri::recvSelf(int commitTag, Channel &theChannel,
 
   // Quad creates a Vector, receives the Vector and then sets the
   // internal data with the data in the Vector
-  static Vector data(9);
+  static thread_local Vector data(9);
   res += theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING SixNodeTri::recvSelf() - failed to receive Vector\n";
@@ -694,7 +694,7 @@ SixNodeTri::recvSelf(int commitTag, Channel &theChannel,
   betaK0 = data(7);
   betaKc = data(8);
 
-  static ID idData(2*nip+NEN);
+  static thread_local ID idData(2*nip+NEN);
   // Quad now receives the tags of its nine external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -794,8 +794,8 @@ SixNodeTri::Print(OPS_Stream &s, int flag)
     // spit out the section location & invoke print on the scetion
     const int numMaterials = nip;
 
-    static Vector avgStress(nstress);
-    static Vector avgStrain(nstress);
+    static thread_local Vector avgStress(nstress);
+    static thread_local Vector avgStrain(nstress);
     avgStress.Zero();
     avgStrain.Zero();
     for (i=0; i<numMaterials; i++) {
@@ -954,7 +954,7 @@ SixNodeTri::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 3) {
 
     // Loop over the integration points
-    static Vector stresses(3*nip);
+    static thread_local Vector stresses(3*nip);
     int cnt = 0;
     for (int i = 0; i < nip; i++) {
 
@@ -971,8 +971,8 @@ SixNodeTri::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 11) {
 
     // extrapolate stress from Gauss points to element nodes
-    static Vector stressGP(3*nip);
-    static Vector stressAtNodes(3*NEN);
+    static thread_local Vector stressGP(3*nip);
+    static thread_local Vector stressAtNodes(3*NEN);
         stressAtNodes.Zero();
     int cnt = 0;
         // first get stress components (xx, yy, xy) at Gauss points
@@ -1009,7 +1009,7 @@ SixNodeTri::getResponse(int responseID, Information &eleInfo)
   } else if (responseID == 4) {
 
     // Loop over the integration points
-    static Vector stresses(3*nip);
+    static thread_local Vector stresses(3*nip);
     int cnt = 0;
     for (int i = 0; i < nip; i++) {
 
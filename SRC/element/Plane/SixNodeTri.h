@@ -111,8 +111,8 @@ private:
   std::array<Node *,NEN> theNodes;
 
   static double matrixData[(NEN*2)*(NEN*2)]; // array data for matrix
-  static Matrix K;              // Element stiffness, damping, and mass Matrix
-  static Vector P;              // Element resisting force vector
+  static thread_local Matrix K;              // Element stiffness, damping, and mass Matrix
+  static thread_local Vector P;              // Element resisting force vector
   Vector Q;                     // Applied nodal loads
   double b[2];                  // Body forces
 
@@ -126,8 +126,8 @@ private:
   double pressure;  // Normal surface traction (pressure) over entire element
                     // Note: positive for outward normal
   double rho;
-  static double shp[3][NEN]; // shape functions and derivatives (overwritten)
-  static double pts[nip][2];    // quadrature points
+  static thread_local double shp[3][NEN]; // shape functions and derivatives (overwritten)
+  static thread_local double pts[nip][2];    // quadrature points
   static double wts[nip];       // quadrature weights
 
   // private member functions
@@ -30,8 +30,8 @@
 #include "HigherOrder.h"
 #include "quadrature/GaussTriangle.h"
 
-Matrix TaylorHood2D::mat;
-Vector TaylorHood2D::vec;
+thread_local Matrix TaylorHood2D::mat;
+thread_local Vector TaylorHood2D::vec;
 
 #include <elementAPI.h>
 void * OPS_ADD_RUNTIME_VPV(OPS_TaylorHood2D)
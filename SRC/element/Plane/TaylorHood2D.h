@@ -123,8 +123,8 @@ private:
     ID vxdof, vydof, pdof;
 
     // matrix
-    static Matrix mat;
-    static Vector vec;
+    static thread_local Matrix mat;
+    static thread_local Vector vec;
 
 };
 
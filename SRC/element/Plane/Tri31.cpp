@@ -40,11 +40,11 @@ using OpenSees::VectorND;
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
 
-double Tri31::matrixData[36];
-Matrix Tri31::K(matrixData, 6, 6);
-Vector Tri31::P(6);
-double Tri31::shp[3][3];
-double Tri31::pts[1][2];
+thread_local double Tri31::matrixData[36];
+thread_local Matrix Tri31::K(matrixData, 6, 6);
+thread_local Vector Tri31::P(6);
+thread_local double Tri31::shp[3][3];
+thread_local double Tri31::pts[1][2];
 double Tri31::wts[1];
 
 Tri31::Tri31(int tag, 
@@ -366,7 +366,7 @@ Tri31::getMass()
 {
     K.Zero();
 
-    static double rhoi[1]; // NIP
+    static thread_local double rhoi[1]; // NIP
     double sum = 0.0;
     for (int i = 0; i < NIP; i++) {
         if (rho == 0)
@@ -434,7 +434,7 @@ Tri31::addLoad(ElementalLoad *theLoad, double loadFactor)
 int 
 Tri31::addInertiaLoadToUnbalance(const Vector &accel)
 {
-    static double rhoi[NIP];
+    static thread_local double rhoi[NIP];
     double sum = 0.0;
     for (int i = 0; i < NIP; i++) {
         if(rho == 0) {
@@ -458,7 +458,7 @@ Tri31::addInertiaLoadToUnbalance(const Vector &accel)
         return -1;
     }
 
-    static double ra[6];
+    static thread_local double ra[6];
 
     ra[0] = Raccel1(0);
     ra[1] = Raccel1(1);
@@ -590,7 +590,7 @@ Tri31::sendSelf(int commitTag, Channel &theChannel)
   
     // Tri31 packs its data into a Vector and sends this to theChannel
     // along with its dbTag and the commitTag passed in the arguments
-    static Vector data(10);
+    static thread_local Vector data(10);
     data(0) = this->getTag();
     data(1) = thickness;
     data(3) = b[0];
@@ -611,7 +611,7 @@ Tri31::sendSelf(int commitTag, Channel &theChannel)
     // Now send the ids of our materials
     int count=0;
   
-    static ID idData(2*NIP+NEN+1);
+    static thread_local ID idData(2*NIP+NEN+1);
 
     for (int i = 0; i < NIP; i++) { 
         idData(i) = theMaterial[i]->getClassTag();
@@ -657,7 +657,7 @@ Tri31::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 
     // Tri31 creates a Vector, receives the Vector and then sets the 
     // internal data with the data in the Vector
-    static Vector data(10);
+    static thread_local Vector data(10);
     res += theChannel.recvVector(dataTag, commitTag, data);
     if (res < 0) {
         opserr << "WARNING Tri31::recvSelf() - failed to receive Vector\n";
@@ -675,7 +675,7 @@ Tri31::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
     betaK0 = data(8);
     betaKc = data(9);
 
-    static ID idData(2*NIP+NEN+1);
+    static thread_local ID idData(2*NIP+NEN+1);
     // Tri31 now receives the tags of its four external nodes
     res += theChannel.recvID(dataTag, commitTag, idData);
     if (res < 0) {
@@ -791,8 +791,8 @@ Tri31::Print(OPS_Stream &s, int flag)
 
         // print the section location & invoke print on the material
 
-        static Vector avgStress(nstress);
-        static Vector avgStrain(nstress);
+        static thread_local Vector avgStress(nstress);
+        static thread_local Vector avgStrain(nstress);
         avgStress.Zero();
         avgStrain.Zero();
         for (int i = 0; i < NIP; i++) {
@@ -909,7 +909,7 @@ Tri31::getResponse(int responseID, Information &eleInfo)
 
     } else if (responseID == 3) {
         // Loop over the integration points
-        static Vector stresses(3*NIP);
+        static thread_local Vector stresses(3*NIP);
         int cnt = 0;
         for (int i = 0; i < NIP; i++) {
             // Get material stress response
@@ -925,8 +925,8 @@ Tri31::getResponse(int responseID, Information &eleInfo)
 
   else if (responseID == 11) {
     // extrapolate stress from Gauss points to element nodes
-    static Vector stressGP(3*NIP);
-    static Vector stressAtNodes(3*NEN); // 3*nnodes
+    static thread_local Vector stressGP(3*NIP);
+    static thread_local Vector stressAtNodes(3*NEN); // 3*nnodes
     stressAtNodes.Zero();
     int cnt = 0;
     // first get stress components (xx, yy, xy) at Gauss points
@@ -118,9 +118,9 @@ class Tri31 : public Element
 
     std::array<Node *, NEN> theNodes;
 
-    static double matrixData[36];  // array data for matrix
-    static Matrix K;               // Element stiffness, damping, and mass Matrix
-    static Vector P;               // Element resisting force vector
+    static thread_local double matrixData[36];  // array data for matrix
+    static thread_local Matrix K;               // Element stiffness, damping, and mass Matrix
+    static thread_local Vector P;               // Element resisting force vector
     Vector Q;                   // Applied nodal loads
     double b[2];                // Body forces
 
@@ -133,8 +133,8 @@ class Tri31 : public Element
     double pressure;            // Normal surface traction (pressure) over entire element
                                 // Note: positive for outward normal
     double rho;
-    static double shp[3][3];    // Stores shape functions and derivatives (overwritten)
-    static double pts[1][2];    // Stores quadrature points
+    static thread_local double shp[3][3];    // Stores shape functions and derivatives (overwritten)
+    static thread_local double pts[1][2];    // Stores quadrature points
     static double wts[1];       // Stores quadrature weights
 
     // private member functions - only objects of this class can call these
@@ -46,14 +46,14 @@
 #include <stdlib.h>
 #include <string.h>
 
-static Matrix CoupledZeroLengthM2(2,2);   // class wide matrix for 2*2
-static Matrix CoupledZeroLengthM4(4,4);   // class wide matrix for 4*4
-static Matrix CoupledZeroLengthM6(6,6);   // class wide matrix for 6*6
-static Matrix CoupledZeroLengthM12(12,12);  // class wide matrix for 12*12
-static Vector CoupledZeroLengthV2(2);   // class wide Vector for size 2
-static Vector CoupledZeroLengthV4(4);   // class wide Vector for size 4
-static Vector CoupledZeroLengthV6(6);   // class wide Vector for size 6
-static Vector CoupledZeroLengthV12(12);  // class wide Vector for size 12
+static thread_local Matrix CoupledZeroLengthM2(2,2);   // class wide matrix for 2*2
+static thread_local Matrix CoupledZeroLengthM4(4,4);   // class wide matrix for 4*4
+static thread_local Matrix CoupledZeroLengthM6(6,6);   // class wide matrix for 6*6
+static thread_local Matrix CoupledZeroLengthM12(12,12);  // class wide matrix for 12*12
+static thread_local Vector CoupledZeroLengthV2(2);   // class wide Vector for size 2
+static thread_local Vector CoupledZeroLengthV4(4);   // class wide Vector for size 4
+static thread_local Vector CoupledZeroLengthV6(6);   // class wide Vector for size 6
+static thread_local Vector CoupledZeroLengthV12(12);  // class wide Vector for size 12
 
 
 #include <elementAPI.h>
@@ -122,7 +122,6 @@ CoupledZeroLength::CoupledZeroLength(int tag,
   :Element(tag,ELE_TAG_CoupledZeroLength),     
    connectedExternalNodes(2),
    dimension(0), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
-   theMatrix(0), theVector(0),
    theMaterial(0), dirn1(direction1), dirn2(direction2), d0(0), v0(0)
 {
   // allocate memory for numMaterials1d uniaxial material models
@@ -154,7 +153,6 @@ CoupledZeroLength::CoupledZeroLength(void)
   :Element(0,ELE_TAG_CoupledZeroLength),     
    connectedExternalNodes(2),
    dimension(0), numDOF(0), transformation(3,3),
-   theMatrix(0), theVector(0),
    theMaterial(0), dirn1(0), dirn2(0), d0(0), v0(0)
 {
   // ensure the connectedExternalNode ID is of correct size 
@@ -230,8 +228,6 @@ CoupledZeroLength::setDomain(Domain *theDomain)
 
     // set default values for error conditions
     numDOF = 2;
-    theMatrix = &CoupledZeroLengthM2;
-    theVector = &CoupledZeroLengthV2;
     
     // first set the node pointers
     int Nd1 = connectedExternalNodes(0);
@@ -287,32 +283,22 @@ CoupledZeroLength::setDomain(Domain *theDomain)
     // set the number of dof for element and set matrix and vector pointer
     if (dimension == 1 && dofNd1 == 1) {
 	numDOF = 2;    
-	theMatrix = &CoupledZeroLengthM2;
-	theVector = &CoupledZeroLengthV2;
 	elemType  = D1N2;
     }
     else if (dimension == 2 && dofNd1 == 2) {
 	numDOF = 4;
-	theMatrix = &CoupledZeroLengthM4;
-	theVector = &CoupledZeroLengthV4;
 	elemType  = D2N4;
     }
     else if (dimension == 2 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &CoupledZeroLengthM6;
-	theVector = &CoupledZeroLengthV6;
 	elemType  = D2N6;
     }
     else if (dimension == 3 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &CoupledZeroLengthM6;
-	theVector = &CoupledZeroLengthV6;
 	elemType  = D3N6;
     }
     else if (dimension == 3 && dofNd1 == 6) {
 	numDOF = 12;	    
-	theMatrix = &CoupledZeroLengthM12;
-	theVector = &CoupledZeroLengthV12;
 	elemType  = D3N12;
     }
     else {
@@ -430,7 +416,7 @@ CoupledZeroLength::getTangentStiff(void)
     double E;
 
     // stiff is a reference to the matrix holding the stiffness matrix
-    Matrix& stiff = *theMatrix;
+    Matrix& stiff = this->workMatrix();
     
     // zero stiffness matrix
     stiff.Zero();
@@ -494,7 +480,7 @@ CoupledZeroLength::getInitialStiff(void)
 
     E = theMaterial->getInitialTangent();
 
-    Matrix& stiff = *theMatrix;
+    Matrix& stiff = this->workMatrix();
     stiff.Zero();
 
     int numNodeDof = numDOF/2;
@@ -518,7 +504,7 @@ CoupledZeroLength::getInitialStiff(void)
 const Matrix &
 CoupledZeroLength::getDamp(void)
 {
-    Matrix& damp = *theMatrix;
+    Matrix& damp = this->workMatrix();
     damp.Zero();
 
     if (useRayleighDamping == 1)
@@ -548,9 +534,11 @@ CoupledZeroLength::getDamp(void)
 const Matrix &
 CoupledZeroLength::getMass(void)
 {
+  Matrix &theMatrix = this->workMatrix();
+
   // no mass 
-  theMatrix->Zero();    
-  return *theMatrix; 
+  theMatrix.Zero();    
+  return theMatrix; 
 }
 
 
@@ -578,10 +566,12 @@ CoupledZeroLength::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 CoupledZeroLength::getResistingForce()
 {
+    Vector &theVector = this->workVector();
+
     double force, strain;
 
     // zero the residual
-    theVector->Zero();
+    theVector.Zero();
 
     // get resisting force for material
     force = theMaterial->getStress();
@@ -605,29 +595,31 @@ CoupledZeroLength::getResistingForce()
     int dirn1b = dirn1+numNodeDof;
     int dirn2b = dirn2+numNodeDof;
 
-    (*theVector)(dirn1)   = -Fx;
-    (*theVector)(dirn1b)  =  Fx;      
-    (*theVector)(dirn2)   = -Fy;
-    (*theVector)(dirn2b)  =  Fy;      
+    theVector(dirn1)   = -Fx;
+    theVector(dirn1b)  =  Fx;      
+    theVector(dirn2)   = -Fy;
+    theVector(dirn2b)  =  Fy;      
 
-    //  opserr << "CoupledZeroLength::getResistingForce() " << force << " forces: " << *theVector;
+    //  opserr << "CoupledZeroLength::getResistingForce() " << force << " forces: " << theVector;
 
-    return *theVector;
+    return theVector;
 }
 
 
 const Vector &
 CoupledZeroLength::getResistingForceIncInertia()
 {	
+    Vector &theVector = this->workVector();
+
     // this already includes damping forces from materials
     this->getResistingForce();
 
     // add the damping forces from rayleigh damping
     if (useRayleighDamping == 1)
         if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
-            *theVector += this->getRayleighDampingForces();
+            theVector += this->getRayleighDampingForces();
 
-    return *theVector;
+    return theVector;
 }
 
 
@@ -646,7 +638,7 @@ CoupledZeroLength::sendSelf(int commitTag, Channel &theChannel)
 
 	// Make one size bigger so not a multiple of 3, otherwise will conflict
 	// with classTags ID
-	static ID idData(10);
+	static thread_local ID idData(10);
 
 	idData(0) = this->getTag();
 	idData(1) = dimension;
@@ -687,7 +679,7 @@ CoupledZeroLength::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   // CoupledZeroLength creates an ID, receives the ID and then sets the 
   // internal data with the data in the ID
 
-  static ID idData(10);
+  static thread_local ID idData(10);
 
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -746,8 +738,8 @@ CoupledZeroLength::displaySelf(Renderer &theViewer, int displayMode, float fact,
        return 0;
 
     // get the end point display coords    
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
 
@@ -890,11 +882,13 @@ CoupledZeroLength::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 CoupledZeroLength::getResistingForceSensitivity(int gradIndex)
 {
+  Vector &theVector = this->workVector();
+
   // Recompute strains to be safe
   this->update();
 
   // zero the residual
-  theVector->Zero();
+  theVector.Zero();
 
   // get resisting force for material
   double dfdh = theMaterial->getStressSensitivity(gradIndex, true);
@@ -918,12 +912,12 @@ CoupledZeroLength::getResistingForceSensitivity(int gradIndex)
   int dirn1b = dirn1+numNodeDof;
   int dirn2b = dirn2+numNodeDof;
 
-  (*theVector)(dirn1)   = -Fx;
-  (*theVector)(dirn1b)  =  Fx;      
-  (*theVector)(dirn2)   = -Fy;
-  (*theVector)(dirn2b)  =  Fy;      
+  theVector(dirn1)   = -Fx;
+  theVector(dirn1b)  =  Fx;      
+  theVector(dirn2)   = -Fy;
+  theVector(dirn2b)  =  Fy;      
   
-  return *theVector;
+  return theVector;
 }
  
 int
@@ -947,3 +941,31 @@ CoupledZeroLength::commitSensitivity(int gradIndex, int numGrads)
 
   return theMaterial->commitSensitivity(depsdh, gradIndex, numGrads);
 }
+
+Matrix &
+CoupledZeroLength::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return CoupledZeroLengthM2;
+    case 4:   return CoupledZeroLengthM4;
+    case 6:   return CoupledZeroLengthM6;
+    case 12:  return CoupledZeroLengthM12;
+    default: return CoupledZeroLengthM2;
+  }
+}
+
+Vector &
+CoupledZeroLength::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return CoupledZeroLengthV2;
+    case 4:   return CoupledZeroLengthV4;
+    case 6:   return CoupledZeroLengthV6;
+    case 12:  return CoupledZeroLengthV12;
+    default: return CoupledZeroLengthV2;
+  }
+}
@@ -117,8 +117,8 @@ class CoupledZeroLength : public Element {
     
     Node *theNodes[2];
     
-    Matrix *theMatrix; 	    	// pointer to objects matrix (a class Matrix)
-    Vector *theVector;      	// pointer to objects vector (a class Vector)
+    Matrix &workMatrix(void) const;  // class wide matrix of the calling thread
+    Vector &workVector(void) const;  // class wide vector of the calling thread
     
     // Storage for uniaxial material models
     UniaxialMaterial *theMaterial;    // array of pointers to 1d materials
@@ -49,14 +49,14 @@
 #include <vector>
 
 // initialise the class wide variables
-Matrix ZeroLength::ZeroLengthM2(2,2);
-Matrix ZeroLength::ZeroLengthM4(4,4);
-Matrix ZeroLength::ZeroLengthM6(6,6);
-Matrix ZeroLength::ZeroLengthM12(12,12);
-Vector ZeroLength::ZeroLengthV2(2);
-Vector ZeroLength::ZeroLengthV4(4);
-Vector ZeroLength::ZeroLengthV6(6);
-Vector ZeroLength::ZeroLengthV12(12);
+thread_local Matrix ZeroLength::ZeroLengthM2(2,2);
+thread_local Matrix ZeroLength::ZeroLengthM4(4,4);
+thread_local Matrix ZeroLength::ZeroLengthM6(6,6);
+thread_local Matrix ZeroLength::ZeroLengthM12(12,12);
+thread_local Vector ZeroLength::ZeroLengthV2(2);
+thread_local Vector ZeroLength::ZeroLengthV4(4);
+thread_local Vector ZeroLength::ZeroLengthV6(6);
+thread_local Vector ZeroLength::ZeroLengthV12(12);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ZeroLength)
 {
@@ -243,7 +243,6 @@ ZeroLength::ZeroLength(int tag,
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
-  theMatrix(0), theVector(0),
   numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
 {
   // allocate memory for numMaterials1d uniaxial material models
@@ -287,7 +286,6 @@ ZeroLength::ZeroLength(int tag,
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(2),
-  theMatrix(0), theVector(0),
   numMaterials1d(1), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
 {
   // allocate memory for numMaterials1d uniaxial material models
@@ -338,7 +336,6 @@ ZeroLength::ZeroLength(int tag,
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
-  theMatrix(0), theVector(0),
   numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
 {
 
@@ -389,7 +386,6 @@ ZeroLength::ZeroLength(int tag,
  :Element(tag,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
   dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
-  theMatrix(0), theVector(0),
   numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
 {
 
@@ -435,7 +431,6 @@ ZeroLength::ZeroLength(void)
   :Element(0,ELE_TAG_ZeroLength),     
   connectedExternalNodes(2),
   dimension(0), numDOF(0), transformation(3,3),
-  theMatrix(0), theVector(0),
   numMaterials1d(0), theMaterial1d(0),
   dir1d(0), t1d(0), d0(0), v0(0)
 {
@@ -527,8 +522,6 @@ ZeroLength::setDomain(Domain *theDomain)
 
     // set default values for error conditions
     numDOF = 2;
-    theMatrix = &ZeroLengthM2;
-    theVector = &ZeroLengthV2;
     
     // first set the node pointers
     int Nd1 = connectedExternalNodes(0);
@@ -581,32 +574,22 @@ ZeroLength::setDomain(Domain *theDomain)
     // set the number of dof for element and set matrix and vector pointer
     if (dimension == 1 && dofNd1 == 1) {
 	numDOF = 2;    
-	theMatrix = &ZeroLengthM2;
-	theVector = &ZeroLengthV2;
 	elemType  = D1N2;
     }
     else if (dimension == 2 && dofNd1 == 2) {
 	numDOF = 4;
-	theMatrix = &ZeroLengthM4;
-	theVector = &ZeroLengthV4;
 	elemType  = D2N4;
     }
     else if (dimension == 2 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &ZeroLengthM6;
-	theVector = &ZeroLengthV6;
 	elemType  = D2N6;
     }
     else if (dimension == 3 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &ZeroLengthM6;
-	theVector = &ZeroLengthV6;
 	elemType  = D3N6;
     }
     else if (dimension == 3 && dofNd1 == 6) {
 	numDOF = 12;	    
-	theMatrix = &ZeroLengthM12;
-	theVector = &ZeroLengthV12;
 	elemType  = D3N12;
     }
     else {
@@ -736,7 +719,7 @@ ZeroLength::getTangentStiff(void)
     double E;
 
     // stiff is a reference to the matrix holding the stiffness matrix
-    Matrix& stiff = *theMatrix;
+    Matrix& stiff = this->workMatrix();
     
     // zero stiffness matrix
     stiff.Zero();
@@ -773,7 +756,7 @@ ZeroLength::getInitialStiff(void)
     double E;
 
     // stiff is a reference to the matrix holding the stiffness matrix
-    Matrix& stiff = *theMatrix;
+    Matrix& stiff = this->workMatrix();
     
     // zero stiffness matrix
     stiff.Zero();
@@ -808,7 +791,7 @@ const Matrix &
 ZeroLength::getDamp(void)
 {
     // damp is a reference to the matrix holding the damping matrix
-    Matrix& damp = *theMatrix;
+    Matrix& damp = this->workMatrix();
 
     // zero damping matrix
     damp.Zero();
@@ -865,9 +848,11 @@ ZeroLength::getDamp(void)
 const Matrix &
 ZeroLength::getMass(void)
 {
+  Matrix &theMatrix = this->workMatrix();
+
   // no mass 
-  theMatrix->Zero();    
-  return *theMatrix; 
+  theMatrix.Zero();    
+  return theMatrix; 
 }
 
 
@@ -896,10 +881,12 @@ ZeroLength::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 ZeroLength::getResistingForce()
 {
+  Vector &theVector = this->workVector();
+
   double force;
   
   // zero the residual
-  theVector->Zero();
+  theVector.Zero();
   
   // loop over 1d materials
   for (int mat=0; mat<numMaterials1d; mat++) {
@@ -909,24 +896,26 @@ ZeroLength::getResistingForce()
     
     // compute residual due to resisting force
     for (int i=0; i<numDOF; i++)
-      (*theVector)(i)  += (*t1d)(mat,i) * force;
+      theVector(i)  += (*t1d)(mat,i) * force;
     
   } // end loop over 1d materials 
   
-  return *theVector;
+  return theVector;
 }
 
 
 const Vector &
 ZeroLength::getResistingForceIncInertia()
 {	
+  Vector &theVector = this->workVector();
+
   // this already includes damping forces from materials
   this->getResistingForce();
   
   // add the damping forces from rayleigh damping
   if (useRayleighDamping == 1) {
     if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0) {
-      *theVector += this->getRayleighDampingForces();
+      theVector += this->getRayleighDampingForces();
     }  
   } else if (useRayleighDamping == 2) {
       // loop over 1d materials
@@ -937,11 +926,11 @@ ZeroLength::getResistingForceIncInertia()
     
 	// compute residual due to resisting force
 	for (int i=0; i<numDOF; i++)
-	  (*theVector)(i)  += (*t1d)(mat,i) * force;
+	  theVector(i)  += (*t1d)(mat,i) * force;
       }
   }
 
-  return *theVector;
+  return theVector;
 }
 
 
@@ -960,7 +949,7 @@ ZeroLength::sendSelf(int commitTag, Channel &theChannel)
 
 	// Make one size bigger so not a multiple of 3, otherwise will conflict
 	// with classTags ID
-	static ID idData(10);
+	static thread_local ID idData(10);
 
 	idData(0) = this->getTag();
 	idData(1) = dimension;
@@ -1032,7 +1021,7 @@ ZeroLength::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBr
   // ZeroLength creates an ID, receives the ID and then sets the 
   // internal data with the data in the ID
 
-  static ID idData(10);
+  static thread_local ID idData(10);
 
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1147,8 +1136,8 @@ ZeroLength::displaySelf(Renderer &theViewer, int displayMode, float fact, const
        return 0;
 
     // get the end point display coords    
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
 
@@ -1170,12 +1159,14 @@ ZeroLength::displaySelf(Renderer &theViewer, int displayMode, float fact, const
 void
 ZeroLength::Print(OPS_Stream &s, int flag)
 {
+    Vector &theVector = this->workVector();
+
     // compute the strain and axial force in the member
     double strain=0.0;
     double force =0.0;
      
     for (int i=0; i<numDOF; i++)
-	(*theVector)(i) = (*t1d)(0,i)*force;
+	theVector(i) = (*t1d)(0,i)*force;
     
     if (flag == OPS_PRINT_CURRENTSTATE) { // print everything
         s << "Element: " << this->getTag();
@@ -1347,6 +1338,8 @@ ZeroLength::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 ZeroLength::getResponse(int responseID, Information &eleInformation)
 {
+    Vector &theVector = this->workVector();
+
     const Vector& disp1 = theNodes[0]->getTrialDisp();
     const Vector& disp2 = theNodes[1]->getTrialDisp();
     const Vector  diff  = disp2-disp1;
@@ -1359,10 +1352,10 @@ ZeroLength::getResponse(int responseID, Information &eleInformation)
         return eleInformation.setVector(this->getResistingForce());
 
     case 15:
-      theVector->Zero();
+      theVector.Zero();
       if (useRayleighDamping == 1) {
         if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
-            *theVector += this->getRayleighDampingForces();      
+            theVector += this->getRayleighDampingForces();      
       } else if (useRayleighDamping == 2) {
 	for (int mat=0; mat<numMaterials1d; mat++) {
 	  
@@ -1371,10 +1364,10 @@ ZeroLength::getResponse(int responseID, Information &eleInformation)
 	  
 	  // compute residual due to resisting force
 	  for (int i=0; i<numDOF; i++)
-	    (*theVector)(i)  += (*t1d)(mat,i) * force;
+	    theVector(i)  += (*t1d)(mat,i) * force;
 	}
       }
-      return eleInformation.setVector(*theVector);
+      return eleInformation.setVector(theVector);
 
     case 2:
         if (eleInformation.theVector != 0) {
@@ -1441,13 +1434,15 @@ ZeroLength::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 ZeroLength::getResistingForceSensitivity(int gradIndex)
 {
+  Vector &theVector = this->workVector();
+
   // Recompute strains to be safe
   this->update();
 
   double dfdh;
 
   // zero the residual
-  theVector->Zero();
+  theVector.Zero();
 
   // loop over 1d materials
   for (int mat=0; mat<numMaterials1d; mat++) {
@@ -1457,11 +1452,11 @@ ZeroLength::getResistingForceSensitivity(int gradIndex)
 
     // compute residual due to resisting force
     for (int i=0; i<numDOF; i++)
-      (*theVector)(i)  += (*t1d)(mat,i) * dfdh;
+      theVector(i)  += (*t1d)(mat,i) * dfdh;
     
   } // end loop over 1d materials 
   
-  return *theVector;
+  return theVector;
 }
  
 int
@@ -1693,3 +1688,31 @@ ZeroLength::onDeactivate()
 {
 
 }
+
+Matrix &
+ZeroLength::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return ZeroLengthM2;
+    case 4:   return ZeroLengthM4;
+    case 6:   return ZeroLengthM6;
+    case 12:  return ZeroLengthM12;
+    default: return ZeroLengthM2;
+  }
+}
+
+Vector &
+ZeroLength::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return ZeroLengthV2;
+    case 4:   return ZeroLengthV4;
+    case 6:   return ZeroLengthV6;
+    case 12:  return ZeroLengthV12;
+    default: return ZeroLengthV2;
+  }
+}
@@ -179,8 +179,8 @@ class ZeroLength : public Element
 	
     Node *theNodes[2];
 
-    Matrix *theMatrix; 	    	// pointer to objects matrix (a class Matrix)
-    Vector *theVector;      	// pointer to objects vector (a class Vector)
+    Matrix &workMatrix(void) const;  // class wide matrix of the calling thread
+    Vector &workVector(void) const;  // class wide vector of the calling thread
 
     // Storage for uniaxial material models
     int numMaterials1d;			   // number of 1d materials
@@ -193,14 +193,14 @@ class ZeroLength : public Element
     Vector *v0;
 
     // static data - single copy for all objects of the class	
-    static Matrix ZeroLengthM2;   // class wide matrix for 2*2
-    static Matrix ZeroLengthM4;   // class wide matrix for 4*4
-    static Matrix ZeroLengthM6;   // class wide matrix for 6*6
-    static Matrix ZeroLengthM12;  // class wide matrix for 12*12
-    static Vector ZeroLengthV2;   // class wide Vector for size 2
-    static Vector ZeroLengthV4;   // class wide Vector for size 4
-    static Vector ZeroLengthV6;   // class wide Vector for size 6
-    static Vector ZeroLengthV12;  // class wide Vector for size 12
+    static thread_local Matrix ZeroLengthM2;   // class wide matrix for 2*2
+    static thread_local Matrix ZeroLengthM4;   // class wide matrix for 4*4
+    static thread_local Matrix ZeroLengthM6;   // class wide matrix for 6*6
+    static thread_local Matrix ZeroLengthM12;  // class wide matrix for 12*12
+    static thread_local Vector ZeroLengthV2;   // class wide Vector for size 2
+    static thread_local Vector ZeroLengthV4;   // class wide Vector for size 4
+    static thread_local Vector ZeroLengthV6;   // class wide Vector for size 6
+    static thread_local Vector ZeroLengthV12;  // class wide Vector for size 12
 
     int mInitialize;  // tag to fix bug in recvSelf/setDomain when using database command
 };
@@ -52,11 +52,11 @@
 const int ZeroLengthContact2D::numberNodes = 2 ;
 
 // static data for 2D
-Matrix  ZeroLengthContact2D::stiff4(2*numberNodes,2*numberNodes) ;
-Vector  ZeroLengthContact2D::resid4(2*numberNodes) ;
+thread_local Matrix  ZeroLengthContact2D::stiff4(2*numberNodes,2*numberNodes) ;
+thread_local Vector  ZeroLengthContact2D::resid4(2*numberNodes) ;
 
-Matrix  ZeroLengthContact2D::stiff6(3*numberNodes,3*numberNodes) ;
-Vector  ZeroLengthContact2D::resid6(3*numberNodes) ;
+thread_local Matrix  ZeroLengthContact2D::stiff6(3*numberNodes,3*numberNodes) ;
+thread_local Vector  ZeroLengthContact2D::resid6(3*numberNodes) ;
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ZeroLengthContact2D)
 {
@@ -660,7 +660,7 @@ ZeroLengthContact2D::sendSelf(int commitTag, Channel &theChannel)
 
   int dbTag = this->getDbTag();
 
-  static ID idData(5);
+  static thread_local ID idData(5);
   idData(0) = this->getTag();
   idData(1) = connectedExternalNodes(0);
   idData(2) = connectedExternalNodes(1);  
@@ -673,7 +673,7 @@ ZeroLengthContact2D::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector data(10);
+  static thread_local Vector data(10);
   data(0) = pressure;
   data(1) = lambda;
   data(2) = t1;
@@ -701,7 +701,7 @@ ZeroLengthContact2D::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
 
   int dbTag = this->getDbTag();
 
-  static ID idData(5);
+  static thread_local ID idData(5);
   res += theChannel.recvID(dbTag, commitTag, idData);
   if (res < 0) {
     opserr << "ZeroLengthContact2D::recvSelf -- failed to receive ID data" << endln;
@@ -714,7 +714,7 @@ ZeroLengthContact2D::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
   numDOF = idData(3);
   ContactFlag = idData(4);
 
-  static Vector data(10);
+  static thread_local Vector data(10);
   res += theChannel.recvVector(dbTag, commitTag, data);
   if (res < 0) {
     opserr << "ZeroLengthContact2D::recvSelf -- failed to receive Vector data" << endln;
@@ -890,8 +890,8 @@ void  ZeroLengthContact2D::formResidAndTangent( int tang_flag )
 
 
 	// trial displacement vectors
- 	static Vector DispTrialS(2); // trial disp for secondary node
-	static Vector DispTrialP(2); // trial disp for primary node
+ 	static thread_local Vector DispTrialS(2); // trial disp for secondary node
+	static thread_local Vector DispTrialP(2); // trial disp for primary node
 	// trial frictional force vectors (in local coordinate)
     double t_trial;
     double TtrNorm;
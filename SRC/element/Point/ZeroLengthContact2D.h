@@ -191,11 +191,11 @@ class ZeroLengthContact2D: public Element
   void formResidAndTangent(int tang_flag ) ;
 
   //static variables for 2D contact
-  static Matrix stiff4;   // for stiff matrix
-  static Vector resid4;   // for force residual vector
+  static thread_local Matrix stiff4;   // for stiff matrix
+  static thread_local Vector resid4;   // for force residual vector
 
-  static Matrix stiff6;   // for stiff matrix
-  static Vector resid6;   // for force residual vector
+  static thread_local Matrix stiff6;   // for stiff matrix
+  static thread_local Vector resid6;   // for force residual vector
 };
 
 #endif
@@ -51,9 +51,9 @@
 const int ZeroLengthContact3D::numberNodes = 2 ;
 
 // static data for 3D
-Matrix  ZeroLengthContact3D::stiff(3*numberNodes,3*numberNodes) ;
-Vector  ZeroLengthContact3D::resid(3*numberNodes) ;
-Matrix  ZeroLengthContact3D::zeroMatrix(3*numberNodes,3*numberNodes) ;
+thread_local Matrix  ZeroLengthContact3D::stiff(3*numberNodes,3*numberNodes) ;
+thread_local Vector  ZeroLengthContact3D::resid(3*numberNodes) ;
+thread_local Matrix  ZeroLengthContact3D::zeroMatrix(3*numberNodes,3*numberNodes) ;
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ZeroLengthContact3D)
 {
@@ -436,7 +436,7 @@ ZeroLengthContact3D::sendSelf(int commitTag, Channel &theChannel)
     int res = 0;
     int dataTag = this->getDbTag();
 
-    static Vector data(12);
+    static thread_local Vector data(12);
     data(0)  = this->getTag();
     data(1)  = directionID;
     data(2)  = Kn;
@@ -471,7 +471,7 @@ ZeroLengthContact3D::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBrok
     int res;
     int dataTag = this->getDbTag();
 
-    static Vector data(12);
+    static thread_local Vector data(12);
     res = theChannel.recvVector(dataTag, commitTag, data);
     if (res < 0) {
         opserr << "WARNING ZeroLengthContact3D::recvSelf() - failed to receive Vector\n";
@@ -212,9 +212,9 @@ class ZeroLengthContact3D: public Element
   Vector *load;         	// pointer to objects vector (a class Vector)
   
   //static variables for 3D contact
-  static Matrix stiff;   // for stiff matrix
-  static Vector resid;   // for force residual vector
-  static Matrix zeroMatrix;
+  static thread_local Matrix stiff;   // for stiff matrix
+  static thread_local Vector resid;   // for force residual vector
+  static thread_local Matrix zeroMatrix;
   
 };
 
@@ -389,8 +389,8 @@ int ZeroLengthContactASDimplex::update()
     }
     else {
         // for the implicit case we use the numerical tangent... seems more stable
-        static Vector strain(3);
-        static Matrix Cnum(3, 3);
+        static thread_local Vector strain(3);
+        static thread_local Matrix Cnum(3, 3);
         constexpr double pert = 1.0e-9;
         strain = sv.eps;
         for (int j = 0; j < 3; ++j) {
@@ -424,7 +424,7 @@ const Matrix& ZeroLengthContactASDimplex::getInitialStiff()
 {
     auto& gs = getGlobalStorage(numDOF[0] + numDOF[1]);
     auto& stiff = gs.K0;
-    static Matrix C0(3, 3);
+    static thread_local Matrix C0(3, 3);
     C0.Zero();
     const Vector& LGap = getInitialGap();
     double Un = LGap(0); // gap parallel to normal vector
@@ -461,12 +461,12 @@ const Vector& ZeroLengthContactASDimplex::getResistingForce() {
     const auto& F = sv.sig;
 
     // residual vector in local coordinate system & global dof-set
-    static Vector RL(6);
+    static thread_local Vector RL(6);
     const Matrix& B = theBMatrix();
     RL.addMatrixTransposeVector(0.0, B, F, 1.0);
 
     // residual vector in global system, local DOFset
-    static Vector RG(6);
+    static thread_local Vector RG(6);
     const Matrix& T2 = getRotationMatrix66();
     RG.addMatrixTransposeVector(0.0, T2, RL, 1.0);
 
@@ -491,7 +491,7 @@ int ZeroLengthContactASDimplex::sendSelf(int commitTag, Channel& theChannel) {
     int dataTag = this->getDbTag();
 
     // int data
-    static ID idata(10);
+    static thread_local ID idata(10);
     idata(0) = getTag();
     idata(1) = numDIM;
     idata(2) = numDOF[0];
@@ -509,7 +509,7 @@ int ZeroLengthContactASDimplex::sendSelf(int commitTag, Channel& theChannel) {
     }
 
     // double data
-    static Vector ddata(31);
+    static thread_local Vector ddata(31);
     ddata(0) = Knormal;
     ddata(1) = Kfriction;
     ddata(2) = mu;
@@ -557,7 +557,7 @@ int ZeroLengthContactASDimplex::recvSelf(int commitTag, Channel& theChannel, FEM
     int dataTag = this->getDbTag();
 
     // int data
-    static ID idata(10);
+    static thread_local ID idata(10);
     res = theChannel.recvID(dataTag, commitTag, idata);
     if (res < 0) {
         opserr << "WARNING ZeroLengthContactASDimplex::recvSelf() - failed to receive ID\n";
@@ -575,7 +575,7 @@ int ZeroLengthContactASDimplex::recvSelf(int commitTag, Channel& theChannel, FEM
     gap0_initialized = idata(9) == 1;
 
     // double data
-    static Vector ddata(31);
+    static thread_local Vector ddata(31);
     res = theChannel.recvVector(dataTag, commitTag, ddata);
     if (res < 0) {
         opserr << "WARNING ZeroLengthContactASDimplex::recvSelf() - failed to receive Vector\n";
@@ -621,8 +621,8 @@ int ZeroLengthContactASDimplex::displaySelf(Renderer& theViewer, int displayMode
     if (theNodes[0] == 0 || theNodes[1] == 0)
         return 0;
 
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
     float d1 = 1.0;
 
     theNodes[0]->getDisplayCrds(v1, 0.);
@@ -786,9 +786,9 @@ Response* ZeroLengthContactASDimplex::setResponse(const char** argv, int argc, O
 int ZeroLengthContactASDimplex::getResponse(int responseID, Information& eleInfo) {
 
     auto& gs = getGlobalStorage(numDOF[0] + numDOF[1]);
-    static Vector small(numDIM);
-    static Vector large(2 * numDIM);
-    static Vector scalar(1);
+    static thread_local Vector small(numDIM);
+    static thread_local Vector large(2 * numDIM);
+    static thread_local Vector scalar(1);
 
     if (responseID == 1) {
         // global contact forces
@@ -803,7 +803,7 @@ int ZeroLengthContactASDimplex::getResponse(int responseID, Information& eleInfo
     else if (responseID == 2) {
         // global displacement jump
         const Matrix& T1 = getRotationMatrix33();
-        static Vector dU(3);
+        static thread_local Vector dU(3);
         dU.addMatrixTransposeVector(0.0, T1, sv.eps, 1.0);
         for (int i = 0; i < numDIM; i++) {
             small(i) = dU(i);
@@ -848,7 +848,7 @@ int ZeroLengthContactASDimplex::getResponse(int responseID, Information& eleInfo
     }
     else if (responseID == 8) {
         // cres internal variable hist
-        static Vector cres(3);
+        static thread_local Vector cres(3);
         cres(0) = sv.cres; cres(1) = sv.cres_commit; cres(2) = sv.cres_commit_old;
         return eleInfo.setVector(cres);
     }
@@ -879,11 +879,11 @@ int ZeroLengthContactASDimplex::updateParameter(int parameterID, double value)
 
 const Matrix& ZeroLengthContactASDimplex::getRotationMatrix33()
 {
-    static Matrix T(3, 3);
+    static thread_local Matrix T(3, 3);
 
     // initialize orthogonal vectors to Xorient
-    static Vector rY(3);
-    static Vector rZ(3);
+    static thread_local Vector rY(3);
+    static thread_local Vector rZ(3);
 
     // create global Y and Z axes
     // static and initialized only once
@@ -894,8 +894,8 @@ const Matrix& ZeroLengthContactASDimplex::getRotationMatrix33()
         v(2) = z;
         return v;
     };
-    static Vector gY = make3DVector(0.0, 1.0, 0.0);   // global Y axis
-    static Vector gZ = make3DVector(0.0, 0.0, 1.0);   // global Z axis
+    static thread_local Vector gY = make3DVector(0.0, 1.0, 0.0);   // global Y axis
+    static thread_local Vector gZ = make3DVector(0.0, 0.0, 1.0);   // global Z axis
 
     // compute two orthonal vectors to Xorient
     if (fabs(Xorient ^ gY) < 0.99) { // assume X is not parallel to global Y
@@ -923,7 +923,7 @@ const Matrix& ZeroLengthContactASDimplex::getRotationMatrix33()
 
 const Matrix& ZeroLengthContactASDimplex::getRotationMatrix66()
 {
-    static Matrix T2(6, 6);
+    static thread_local Matrix T2(6, 6);
     T2.Zero();
 
     const Matrix& T1 = getRotationMatrix33();
@@ -941,7 +941,7 @@ const Matrix& ZeroLengthContactASDimplex::getRotationMatrix66()
 const Vector& ZeroLengthContactASDimplex::getInitialGap()
 {
     // compute local gap vector
-    static Vector LGap(3);
+    static thread_local Vector LGap(3);
     const Matrix& T1 = getRotationMatrix33();
     LGap.addMatrixVector(0.0, T1, gap0, 1.0);
     return LGap;
@@ -954,14 +954,14 @@ void ZeroLengthContactASDimplex::computeStrain()
     const Vector& U2 = theNodes[1]->getTrialDisp();
 
     // set global displacement for local DOFset 
-    static Vector UGL(6);
+    static thread_local Vector UGL(6);
     for (int i = 0; i < numDIM; i++) {
         UGL(i) = U1(i);
         UGL(i + 3) = U2(i);
     }
 
     // compute local displacement for local DOFset
-    static Vector UL(6);
+    static thread_local Vector UL(6);
     const Matrix& T2 = getRotationMatrix66();
     UL.addMatrixVector(0.0, T2, UGL, 1.0);
 
@@ -1103,12 +1103,12 @@ void ZeroLengthContactASDimplex::updateInternal(bool do_implex, bool do_tangent)
 void ZeroLengthContactASDimplex::formStiffnessMatrix(const Matrix& C, Matrix& K)
 {
     // element stiffness in local system
-    static Matrix KL(6, 6);
+    static thread_local Matrix KL(6, 6);
     const Matrix& B = theBMatrix();
     KL.addMatrixTripleProduct(0.0, B, C, 1.0);
 
     // element stiffness in global system, local DOFset
-    static Matrix KG(6, 6);
+    static thread_local Matrix KG(6, 6);
     const Matrix& T2 = getRotationMatrix66();
     KG.addMatrixTripleProduct(0.0, T2, KL, 1.0);
 
@@ -1129,7 +1129,7 @@ const Matrix& ZeroLengthContactASDimplex::theBMatrix()
 {
     // this is the strain-displacement matrix.
     // the strain is a actually the displacement jump U2-U1
-    static Matrix B(3, 6);
+    static thread_local Matrix B(3, 6);
     B.Zero();
     for (int i = 0; i < 3; i++) {
         B(i, i + 3) = 1;
@@ -158,9 +158,9 @@ void * OPS_ADD_RUNTIME_VPV(OPS_ZeroLengthImpact3D)
 //static data
 const int ZeroLengthImpact3D::numberNodes = 2 ;
 // static data for 3D
-Matrix  ZeroLengthImpact3D::stiff(3*numberNodes,3*numberNodes) ;
-Vector  ZeroLengthImpact3D::resid(3*numberNodes) ;
-Matrix  ZeroLengthImpact3D::zeroMatrix(3*numberNodes,3*numberNodes) ;
+thread_local Matrix  ZeroLengthImpact3D::stiff(3*numberNodes,3*numberNodes) ;
+thread_local Vector  ZeroLengthImpact3D::resid(3*numberNodes) ;
+thread_local Matrix  ZeroLengthImpact3D::zeroMatrix(3*numberNodes,3*numberNodes) ;
 
 // typical constructor
 ZeroLengthImpact3D::ZeroLengthImpact3D(int tag, 
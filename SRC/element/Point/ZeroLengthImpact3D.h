@@ -127,9 +127,9 @@ class ZeroLengthImpact3D : public Element
     Matrix *Ki; 	    	// pointer to objects matrix (a class Matrix)
     Vector *load;         	// pointer to objects vector (a class Vector)
     //static variables for 3D contact
-    static Matrix stiff;   // for stiff matrix
-    static Vector resid;   // for force residual vector
-    static Matrix zeroMatrix;
+    static thread_local Matrix stiff;   // for stiff matrix
+    static thread_local Vector resid;   // for force residual vector
+    static thread_local Matrix zeroMatrix;
 
 	double initGap; //initial gap
 	double Kn1; //normal stiffness before yielding
@@ -564,7 +564,7 @@ ZeroLengthND::sendSelf(int commitTag, Channel &theChannel)
 	// ZeroLengthND packs its data into an ID and sends this to theChannel
 	// along with its dbTag and the commitTag passed in the arguments
 
-	static ID idData(11);
+	static thread_local ID idData(11);
 
 	idData(0) = this->getTag();
 	idData(1) = dimension;
@@ -638,7 +638,7 @@ ZeroLengthND::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &the
 	// ZeroLengthND creates an ID, receives the ID and then sets the 
 	// internal data with the data in the ID
 
-	static ID idData(11);
+	static thread_local ID idData(11);
 
 	res += theChannel.recvID(dataTag, commitTag, idData);
 	if (res < 0) {
@@ -754,8 +754,8 @@ ZeroLengthND::displaySelf(Renderer &theViewer, int displayMode, float fact, cons
 		return 0;
 
 	// get the end point display coords    
-	static Vector v1(3);
-	static Vector v2(3);
+	static thread_local Vector v1(3);
+	static thread_local Vector v2(3);
 	theNodes[0]->getDisplayCrds(v1, fact, displayMode);
 	theNodes[1]->getDisplayCrds(v2, fact, displayMode);
 
@@ -929,13 +929,13 @@ ZeroLengthND::setUp(int Nd1, int Nd2, const Vector &x, const Vector &yp)
 	}
     // establish orientation of element for the transformation matrix
     // z = x cross yp
-    static Vector z(3);
+    static thread_local Vector z(3);
     z(0) = x(1)*yp(2) - x(2)*yp(1);
     z(1) = x(2)*yp(0) - x(0)*yp(2);
     z(2) = x(0)*yp(1) - x(1)*yp(0);
 
     // y = z cross x
-    static Vector y(3);
+    static thread_local Vector y(3);
     y(0) = z(1)*x(2) - z(2)*x(1);
     y(1) = z(2)*x(0) - z(0)*x(2);
     y(2) = z(0)*x(1) - z(1)*x(0);
@@ -47,10 +47,10 @@
 #include <elementAPI.h>
 
 // initialise the class wide variables
-Matrix ZeroLengthRocking::ZeroLengthRockingM6(6,6);
-Matrix ZeroLengthRocking::ZeroLengthRockingM12(12,12);
-Vector ZeroLengthRocking::ZeroLengthRockingV6(6);
-Vector ZeroLengthRocking::ZeroLengthRockingV12(12);
+thread_local Matrix ZeroLengthRocking::ZeroLengthRockingM6(6,6);
+thread_local Matrix ZeroLengthRocking::ZeroLengthRockingM12(12,12);
+thread_local Vector ZeroLengthRocking::ZeroLengthRockingV6(6);
+thread_local Vector ZeroLengthRocking::ZeroLengthRockingV12(12);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ZeroLengthRocking)
 {
@@ -197,8 +197,7 @@ ZeroLengthRocking::ZeroLengthRocking(int tag,
                double eb, double dtol, double vtol)
  :Element(tag,ELE_TAG_ZeroLengthRocking),     
   connectedExternalNodes(2),
-  dimension(dim), numDOF(0), transformation(3,3), 
-  theMatrix(0), theVector(0),  
+  dimension(dim), numDOF(0), transformation(3,3),  
   ktheta(kr), Rrock(R), Trock(theta), kappa(kap),
   xi(eb), dispTol(dtol), velTol(vtol)
 {
@@ -227,7 +226,6 @@ ZeroLengthRocking::ZeroLengthRocking(void)
   :Element(0,ELE_TAG_ZeroLengthRocking),     
   connectedExternalNodes(2),
   dimension(0), numDOF(0), transformation(3,3),
-  theMatrix(0), theVector(0),
   ktheta(0), Rrock(0), Trock(0), kappa(0), 
   xi(0), dispTol(0), velTol(0)
 {
@@ -297,8 +295,6 @@ ZeroLengthRocking::setDomain(Domain *theDomain)
 
     // set default values for error conditions
     numDOF = 3;
-    theMatrix = &ZeroLengthRockingM6;
-    theVector = &ZeroLengthRockingV6;
     
     // first set the node pointers
     int Nd1 = connectedExternalNodes(0);
@@ -350,8 +346,6 @@ ZeroLengthRocking::setDomain(Domain *theDomain)
     // set the number of dof for element and set matrix and vector pointer
     if (dimension == 2 && dofNd1 == 3) {
         numDOF = 6;	
-        theMatrix = &ZeroLengthRockingM6;
-        theVector = &ZeroLengthRockingV6;
         
         Llocal = new Matrix(2,6);
         constraint = new Vector(2);
@@ -359,8 +353,6 @@ ZeroLengthRocking::setDomain(Domain *theDomain)
     }
     else if (dimension == 3 && dofNd1 == 6) {
         numDOF = 12;	    
-        theMatrix = &ZeroLengthRockingM12;
-        theVector = &ZeroLengthRockingV12;
         
         Llocal = new Matrix(4,12);
         constraint = new Vector(4);
@@ -506,7 +498,7 @@ const Matrix &
 ZeroLengthRocking::getTangentStiff(void)
 {
     // stiff is a reference to the matrix holding the stiffness matrix
-    Matrix& stiff = *theMatrix;
+    Matrix& stiff = this->workMatrix();
     
     // transform basic to global
     stiff.addMatrixTransposeProduct(0.0,*Llocal,*Llocal,kappa);
@@ -535,7 +527,7 @@ ZeroLengthRocking::getInitialStiff(void)
     // compute the exact Llocal with all the sin and cos terms that go to zero
     
     // stiff is a reference to the matrix holding the stiffness matrix
-    Matrix& stiff = *theMatrix;
+    Matrix& stiff = this->workMatrix();
     
     // transform basic to global
     stiff.addMatrixTransposeProduct(0.0,*Llocal,*Llocal,kappa);
@@ -562,7 +554,7 @@ ZeroLengthRocking::getDamp(void)
 {
     // NYI
     // damp is a reference to the matrix holding the damping matrix
-    Matrix& damp = *theMatrix;
+    Matrix& damp = this->workMatrix();
 
     // zero damping matrix
     damp.Zero();
@@ -574,9 +566,11 @@ ZeroLengthRocking::getDamp(void)
 const Matrix &
 ZeroLengthRocking::getMass(void)
 {
+    Matrix &theMatrix = this->workMatrix();
+
     // no mass 
-    theMatrix->Zero();    
-    return *theMatrix; 
+    theMatrix.Zero();    
+    return theMatrix; 
 }
 
 
@@ -606,7 +600,7 @@ const Vector &
 ZeroLengthRocking::getResistingForce()
 {
     // force is a reference to the vector holding the resisting force
-    Vector& force = *theVector;
+    Vector& force = this->workVector();
 
     // basic to global
     force.addMatrixTransposeVector(0.0,*Llocal,*constraint,kappa);
@@ -648,7 +642,7 @@ ZeroLengthRocking::sendSelf(int commitTag, Channel &theChannel)
 
 	// ZeroLengthRocking packs its data into an ID and sends this to theChannel
 	// along with its dbTag and the commitTag passed in the arguments
-    static ID idData(7);
+    static thread_local ID idData(7);
 
 	idData(0) = this->getTag();
 	idData(1) = dimension;
@@ -665,7 +659,7 @@ ZeroLengthRocking::sendSelf(int commitTag, Channel &theChannel)
 	}
     
     // now send vector of double data
-    static Vector dData(9);
+    static thread_local Vector dData(9);
     
     dData(0) = ktheta;
     dData(1) = Rrock;
@@ -698,7 +692,7 @@ ZeroLengthRocking::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
 
     // ZeroLengthRocking creates a ID, receives the ID and then sets the 
     // internal data with the data in the ID
-    static ID idData(7);
+    static thread_local ID idData(7);
     res += theChannel.recvID(dataTag, commitTag, idData);
     if (res < 0) {
         opserr << "ZeroLengthRocking::recvSelf -- failed to receive ID data\n";
@@ -714,7 +708,7 @@ ZeroLengthRocking::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
     RockingCounter = idData(6);
     
     // now receive Vector
-    static Vector dData(9);
+    static thread_local Vector dData(9);
     res += theChannel.recvVector(dataTag, commitTag, dData);
     if (res < 0) {
         opserr << "ZeroLengthRocking::recvSelf -- failed to receive Vector data\n";
@@ -743,8 +737,8 @@ ZeroLengthRocking::displaySelf(Renderer &theViewer, int displayMode, float fact,
        return 0;
 
     // get the end point display coords    
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
 
@@ -930,3 +924,27 @@ ZeroLengthRocking::updateParameter (int parameterID, Information &info)
             return -1;
 	}
 }
+
+Matrix &
+ZeroLengthRocking::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 6:   return ZeroLengthRockingM6;
+    case 12:  return ZeroLengthRockingM12;
+    default: return ZeroLengthRockingM6;
+  }
+}
+
+Vector &
+ZeroLengthRocking::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 6:   return ZeroLengthRockingV6;
+    case 12:  return ZeroLengthRockingV12;
+    default: return ZeroLengthRockingV6;
+  }
+}
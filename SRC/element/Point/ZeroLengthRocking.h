@@ -124,8 +124,8 @@ class ZeroLengthRocking : public Element
 	
     Node *theNodes[2];
 
-    Matrix *theMatrix; 	    	// pointer to objects matrix (a class Matrix)
-    Vector *theVector;      	// pointer to objects vector (a class Vector)
+    Matrix &workMatrix(void) const;  // class wide matrix of the calling thread
+    Vector &workVector(void) const;  // class wide vector of the calling thread
 
     Matrix *Llocal;
     Vector *constraint;
@@ -146,10 +146,10 @@ class ZeroLengthRocking : public Element
     double d31plusT;    // state variable
 
     // static data - single copy for all objects of the class	
-    static Matrix ZeroLengthRockingM6;   // class wide matrix for 6*6
-    static Matrix ZeroLengthRockingM12;  // class wide matrix for 12*12
-    static Vector ZeroLengthRockingV6;   // class wide Vector for size 6
-    static Vector ZeroLengthRockingV12;  // class wide Vector for size 12
+    static thread_local Matrix ZeroLengthRockingM6;   // class wide matrix for 6*6
+    static thread_local Matrix ZeroLengthRockingM12;  // class wide matrix for 12*12
+    static thread_local Vector ZeroLengthRockingV6;   // class wide Vector for size 6
+    static thread_local Vector ZeroLengthRockingV12;  // class wide Vector for size 12
 
 };
 
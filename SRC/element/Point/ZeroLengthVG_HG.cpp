@@ -49,8 +49,8 @@
 #include <vector>
 
 // initialise the class wide variables
-Matrix ZeroLengthVG_HG::ZeroLengthVG_HGM6(6,6);
-Vector ZeroLengthVG_HG::ZeroLengthVG_HGV6(6);
+thread_local Matrix ZeroLengthVG_HG::ZeroLengthVG_HGM6(6,6);
+thread_local Vector ZeroLengthVG_HG::ZeroLengthVG_HGV6(6);
 
 #define ELE_TAG_ZeroLengthVG_HG 101
 
@@ -253,7 +253,6 @@ ZeroLengthVG_HG::ZeroLengthVG_HG(int tag,
   :Element(tag,ELE_TAG_ZeroLengthVG_HG),     
    connectedExternalNodes(2),
    dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
-   theMatrix(0), theVector(0),
    numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
 {
 
@@ -310,7 +309,6 @@ ZeroLengthVG_HG::ZeroLengthVG_HG(int tag,
   :Element(tag,ELE_TAG_ZeroLengthVG_HG),     
    connectedExternalNodes(2),
    dimension(dim), numDOF(0), transformation(3,3), useRayleighDamping(doRayleigh),
-   theMatrix(0), theVector(0),
    numMaterials1d(n1dMat), theMaterial1d(0), dir1d(0), t1d(0), d0(0), v0(0)
 {
 
@@ -361,7 +359,6 @@ ZeroLengthVG_HG::ZeroLengthVG_HG(void)
   :Element(0,ELE_TAG_ZeroLengthVG_HG),     
   connectedExternalNodes(2),
   dimension(0), numDOF(0), transformation(3,3),
-  theMatrix(0), theVector(0),
   numMaterials1d(0), theMaterial1d(0),
   dir1d(0), t1d(0), d0(0), v0(0)
 {
@@ -458,8 +455,6 @@ ZeroLengthVG_HG::setDomain(Domain *theDomain)
 
     // set default values for error conditions
     numDOF = 2;
-    theMatrix = &ZeroLengthVG_HGM6;
-    theVector = &ZeroLengthVG_HGV6;
     
     // first set the node pointers
     int Nd1 = connectedExternalNodes(0);
@@ -515,8 +510,6 @@ ZeroLengthVG_HG::setDomain(Domain *theDomain)
     // set the number of dof for element and set matrix and vector pointer
     if (dimension == 2 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &ZeroLengthVG_HGM6;
-	theVector = &ZeroLengthVG_HGV6;
 	elemType  = D2N6;
     }
 
@@ -675,7 +668,7 @@ ZeroLengthVG_HG::getTangentStiff(void)
     double E;
 
     // stiff is a reference to the matrix holding the stiffness matrix
-    Matrix& stiff = *theMatrix;
+    Matrix& stiff = this->workMatrix();
     
     // zero stiffness matrix
     stiff.Zero();
@@ -716,7 +709,7 @@ ZeroLengthVG_HG::getInitialStiff(void)
     double E;
 
     // stiff is a reference to the matrix holding the stiffness matrix
-    Matrix& stiff = *theMatrix;
+    Matrix& stiff = this->workMatrix();
     
     // zero stiffness matrix
     stiff.Zero();
@@ -751,7 +744,7 @@ const Matrix &
 ZeroLengthVG_HG::getDamp(void)
 {
     // damp is a reference to the matrix holding the damping matrix
-    Matrix& damp = *theMatrix;
+    Matrix& damp = this->workMatrix();
 
     // zero damping matrix
     damp.Zero();
@@ -808,9 +801,11 @@ ZeroLengthVG_HG::getDamp(void)
 const Matrix &
 ZeroLengthVG_HG::getMass(void)
 {
+  Matrix &theMatrix = this->workMatrix();
+
   // no mass 
-  theMatrix->Zero();    
-  return *theMatrix; 
+  theMatrix.Zero();    
+  return theMatrix; 
 }
 
 
@@ -839,10 +834,12 @@ ZeroLengthVG_HG::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 ZeroLengthVG_HG::getResistingForce()
 {
+  Vector &theVector = this->workVector();
+
   double force;
   
   // zero the residual
-  theVector->Zero();
+  theVector.Zero();
 
   // NEW CODE for Jason
   if (springActive == true) {
@@ -855,18 +852,20 @@ ZeroLengthVG_HG::getResistingForce()
       
       // compute residual due to resisting force
       for (int i=0; i<numDOF; i++)
-	(*theVector)(i)  += (*t1d)(mat,i) * force;
+	theVector(i)  += (*t1d)(mat,i) * force;
       
     } // end loop over 1d materials 
   }
   
-  return *theVector;
+  return theVector;
 }
 
 
 const Vector &
 ZeroLengthVG_HG::getResistingForceIncInertia()
 {	
+  Vector &theVector = this->workVector();
+
   // this already includes damping forces from materials
   this->getResistingForce();
 
@@ -876,7 +875,7 @@ ZeroLengthVG_HG::getResistingForceIncInertia()
     // add the damping forces from rayleigh damping
     if (useRayleighDamping == 1) {
       if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0) {
-	*theVector += this->getRayleighDampingForces();
+	theVector += this->getRayleighDampingForces();
       }  
     } else if (useRayleighDamping == 2) {
       // loop over 1d materials
@@ -887,12 +886,12 @@ ZeroLengthVG_HG::getResistingForceIncInertia()
 	
 	// compute residual due to resisting force
 	for (int i=0; i<numDOF; i++)
-	  (*theVector)(i)  += (*t1d)(mat,i) * force;
+	  theVector(i)  += (*t1d)(mat,i) * force;
       }
     }
   }
 
-  return *theVector;
+  return theVector;
 }
 
 
@@ -911,7 +910,7 @@ ZeroLengthVG_HG::sendSelf(int commitTag, Channel &theChannel)
 
 	// Make one size bigger so not a multiple of 3, otherwise will conflict
 	// with classTags ID
-	static ID idData(7);
+	static thread_local ID idData(7);
 
 	idData(0) = this->getTag();
 	idData(1) = dimension;
@@ -983,7 +982,7 @@ ZeroLengthVG_HG::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &
   // ZeroLengthVG_HG creates an ID, receives the ID and then sets the 
   // internal data with the data in the ID
 
-  static ID idData(7);
+  static thread_local ID idData(7);
 
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1098,8 +1097,8 @@ ZeroLengthVG_HG::displaySelf(Renderer &theViewer, int displayMode, float fact, c
        return 0;
 
     // get the end point display coords    
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
 
@@ -1121,12 +1120,14 @@ ZeroLengthVG_HG::displaySelf(Renderer &theViewer, int displayMode, float fact, c
 void
 ZeroLengthVG_HG::Print(OPS_Stream &s, int flag)
 {
+    Vector &theVector = this->workVector();
+
     // compute the strain and axial force in the member
     double strain=0.0;
     double force =0.0;
      
     for (int i=0; i<numDOF; i++)
-	(*theVector)(i) = (*t1d)(0,i)*force;
+	theVector(i) = (*t1d)(0,i)*force;
     
     if (flag == OPS_PRINT_CURRENTSTATE) { // print everything
         s << "Element: " << this->getTag();
@@ -1298,6 +1299,8 @@ ZeroLengthVG_HG::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 ZeroLengthVG_HG::getResponse(int responseID, Information &eleInformation)
 {
+    Vector &theVector = this->workVector();
+
     const Vector& disp1 = theNodes[0]->getTrialDisp();
     const Vector& disp2 = theNodes[1]->getTrialDisp();
     const Vector  diff  = disp2-disp1;
@@ -1310,10 +1313,10 @@ ZeroLengthVG_HG::getResponse(int responseID, Information &eleInformation)
         return eleInformation.setVector(this->getResistingForce());
 
     case 15:
-      theVector->Zero();
+      theVector.Zero();
       if (useRayleighDamping == 1) {
         if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
-            *theVector += this->getRayleighDampingForces();      
+            theVector += this->getRayleighDampingForces();      
       } else if (useRayleighDamping == 2) {
 	for (int mat=0; mat<numMaterials1d; mat++) {
 	  
@@ -1322,10 +1325,10 @@ ZeroLengthVG_HG::getResponse(int responseID, Information &eleInformation)
 	  
 	  // compute residual due to resisting force
 	  for (int i=0; i<numDOF; i++)
-	    (*theVector)(i)  += (*t1d)(mat,i) * force;
+	    theVector(i)  += (*t1d)(mat,i) * force;
 	}
       }
-      return eleInformation.setVector(*theVector);
+      return eleInformation.setVector(theVector);
 
     case 2:
         if (eleInformation.theVector != 0) {
@@ -1392,13 +1395,15 @@ ZeroLengthVG_HG::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 ZeroLengthVG_HG::getResistingForceSensitivity(int gradIndex)
 {
+  Vector &theVector = this->workVector();
+
   // Recompute strains to be safe
   this->update();
 
   double dfdh;
 
   // zero the residual
-  theVector->Zero();
+  theVector.Zero();
 
   // loop over 1d materials
   for (int mat=0; mat<numMaterials1d; mat++) {
@@ -1408,11 +1413,11 @@ ZeroLengthVG_HG::getResistingForceSensitivity(int gradIndex)
 
     // compute residual due to resisting force
     for (int i=0; i<numDOF; i++)
-      (*theVector)(i)  += (*t1d)(mat,i) * dfdh;
+      theVector(i)  += (*t1d)(mat,i) * dfdh;
     
   } // end loop over 1d materials 
   
-  return *theVector;
+  return theVector;
 }
  
 int
@@ -1627,3 +1632,25 @@ ZeroLengthVG_HG::updateDir(const Vector& x, const Vector& y)
 	this->setUp(connectedExternalNodes(0), connectedExternalNodes(1), x, y);
 	this->setTran1d(elemType, numMaterials1d);
 }
+
+Matrix &
+ZeroLengthVG_HG::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 6:   return ZeroLengthVG_HGM6;
+    default: return ZeroLengthVG_HGM6;
+  }
+}
+
+Vector &
+ZeroLengthVG_HG::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 6:   return ZeroLengthVG_HGV6;
+    default: return ZeroLengthVG_HGV6;
+  }
+}
@@ -140,8 +140,8 @@ class ZeroLengthVG_HG : public Element
 	
     Node *theNodes[2];
         
-    Matrix *theMatrix; 	    	// pointer to objects matrix (a class Matrix)
-    Vector *theVector;      	// pointer to objects vector (a class Vector)
+    Matrix &workMatrix(void) const;  // class wide matrix of the calling thread
+    Vector &workVector(void) const;  // class wide vector of the calling thread
 
     // Storage for uniaxial material models
     int numMaterials1d;			   // number of 1d materials
@@ -154,8 +154,8 @@ class ZeroLengthVG_HG : public Element
     Vector *v0;
 
     // static data - single copy for all objects of the class	
-    static Matrix ZeroLengthVG_HGM6;   // class wide matrix for 6*6
-    static Vector ZeroLengthVG_HGV6;   // class wide Vector for size 6
+    static thread_local Matrix ZeroLengthVG_HGM6;   // class wide matrix for 6*6
+    static thread_local Vector ZeroLengthVG_HGV6;   // class wide Vector for size 6
 
     int mInitialize;  // tag to fix bug in recvSelf/setDomain when using database command
 
@@ -498,7 +498,7 @@ void computeBMatrix(
     // shear ***************************************************************************************************
 
     // MITC modified shape functions
-    static Matrix MITCShapeFunctions(2, 4);
+    static thread_local Matrix MITCShapeFunctions(2, 4);
     MITCShapeFunctions.Zero();
     MITCShapeFunctions(1, 0) = 1.0 - xi;
     MITCShapeFunctions(0, 1) = 1.0 - eta;
@@ -508,7 +508,7 @@ void computeBMatrix(
     // strain displacement matrix in natural coordinate system.
     // interpolate the shear strains given in MITC4Params
     // using the modified shape function
-    static Matrix BN(2, 24);
+    static thread_local Matrix BN(2, 24);
     BN.addMatrixProduct(0.0, MITCShapeFunctions, mitc.shearStrains, 1.0);
 
     // Modify the shear strain intensity in the tying points
@@ -530,7 +530,7 @@ void computeBMatrix(
 
     // transform the strain-displacement matrix from natural
     // to local coordinate system taking into account the element distortion
-    static Matrix TBN(2, 24);
+    static thread_local Matrix TBN(2, 24);
     TBN.addMatrixProduct(0.0, mitc.transformation, BN, 1.0);
     for (int i = 0; i < 2; i++)
         for (int j = 0; j < 24; j++)
@@ -1097,7 +1097,7 @@ ASDShellQ4::sendSelf(int commitTag, Channel& theChannel)
     // 1 -> EAS flag
     // 1 -> non-linear drilling flag
     // 1 -> local_x flag
-    static ID idData(21);
+    static thread_local ID idData(21);
     counter = 0;
     idData(counter++) = getTag();
     for(int i = 0; i < 4; ++i)
@@ -1241,7 +1241,7 @@ int  ASDShellQ4::recvSelf(int commitTag, Channel& theChannel, FEM_ObjectBroker&
     // 1 -> EAS flag
     // 1 -> non-linear drilling flag
     // 1 -> local_x flag
-    static ID idData(21);
+    static thread_local ID idData(21);
     res = theChannel.recvID(dataTag, commitTag, idData);
     if (res < 0) {
         opserr << "WARNING ASDShellQ4::recvSelf() - " << this->getTag() << " failed to receive ID\n";
@@ -1588,8 +1588,8 @@ ASDShellQ4::setResponse(const char **argv, int argc, OPS_Stream &output)
 int
 ASDShellQ4::getResponse(int responseID, Information &eleInfo)
 {
-    static Vector stresses(32);
-    static Vector strains(32);
+    static thread_local Vector stresses(32);
+    static thread_local Vector strains(32);
 
     switch (responseID) {
     case 1: // global forces
@@ -1765,9 +1765,9 @@ int ASDShellQ4::calculateAll(Matrix& LHS, Vector& RHS, int options)
     shapeFunctions(0.0, 0.0, N);
     shapeFunctionsNaturalDerivatives(0.0, 0.0, dN);
     computeBdrilling(reference_cs, 0.0, 0.0, jac, agq, N, dN, Bd0, m_eas);
-    static Vector drill_dstrain(8);
-    static Vector drill_dstress(8);
-    static Vector drill_dstress_el(8);
+    static thread_local Vector drill_dstrain(8);
+    static thread_local Vector drill_dstress(8);
+    static thread_local Vector drill_dstress_el(8);
 
     // Gauss loop
     for (int igauss = 0; igauss < 4; igauss++) {
@@ -1925,8 +1925,8 @@ int ASDShellQ4::calculateAll(Matrix& LHS, Vector& RHS, int options)
     // AGQI: static condensation
     if (((options & OPT_RHS) || (options & OPT_LHS)) && m_eas)
     {
-        static Matrix KQQ = Matrix(4, 4);
-        static Matrix KUQ_KQQ_inv = Matrix(24, 4);
+        static thread_local Matrix KQQ = Matrix(4, 4);
+        static thread_local Matrix KUQ_KQQ_inv = Matrix(24, 4);
         KQQ = m_eas->KQQ_inv;
         int inv_res = KQQ.Invert(m_eas->KQQ_inv);
         KUQ_KQQ_inv.addMatrixProduct(0.0, m_eas->KUQ, m_eas->KQQ_inv, 1.0);
@@ -1969,7 +1969,7 @@ void ASDShellQ4::AGQIinitialize()
 void ASDShellQ4::AGQIupdate(const Vector& UL)
 {
     // Compute incremental displacements
-    static Vector dUL(24);
+    static thread_local Vector dUL(24);
     dUL = UL;
     dUL.addVector(1.0, m_eas->U, -1.0);
 
@@ -1977,7 +1977,7 @@ void ASDShellQ4::AGQIupdate(const Vector& UL)
     m_eas->U = UL;
 
     // Update internal DOFs
-    static Vector temp(4);
+    static thread_local Vector temp(4);
     temp.addMatrixVector(0.0, m_eas->KQU, dUL, 1.0);
     temp.addVector(1.0, m_eas->Q_residual, -1.0);
     m_eas->Q.addMatrixVector(1.0, m_eas->KQQ_inv, temp, -1.0);
@@ -1042,7 +1042,7 @@ int  ASDShellT3::sendSelf(int commitTag, Channel& theChannel)
     // 1 -> reduced integration flag
     // 1 -> non-linear drilling flag
     // 1 -> local_x flag
-    static ID idData(18);
+    static thread_local ID idData(18);
     counter = 0;
     idData(counter++) = getTag();
     for (int i = 0; i < 3; ++i)
@@ -1183,7 +1183,7 @@ int  ASDShellT3::recvSelf(int commitTag, Channel& theChannel, FEM_ObjectBroker&
     // 1 -> reduced integration flag
     // 1 -> non-linear drilling flag
     // 1 -> local_x flag
-    static ID idData(18);
+    static thread_local ID idData(18);
     res = theChannel.recvID(dataTag, commitTag, idData);
     if (res < 0) {
         opserr << "WARNING ASDShellT3::recvSelf() - " << this->getTag() << " failed to receive ID\n";
@@ -1491,8 +1491,8 @@ ASDShellT3::setResponse(const char** argv, int argc, OPS_Stream& output)
 int
 ASDShellT3::getResponse(int responseID, Information& eleInfo)
 {
-    static Vector stresses(24);
-    static Vector strains(24);
+    static thread_local Vector stresses(24);
+    static thread_local Vector strains(24);
 
     switch (responseID) {
     case 1: // global forces
@@ -1632,9 +1632,9 @@ int ASDShellT3::calculateAll(Matrix& LHS, Vector& RHS, int options)
     m_transformation->calculateLocalDisplacements(local_cs, UG, UL);
 
     // Drilling data for drilling damage (optional)
-    static Vector drill_dstrain(8);
-    static Vector drill_dstress(8);
-    static Vector drill_dstress_el(8);
+    static thread_local Vector drill_dstrain(8);
+    static thread_local Vector drill_dstress(8);
+    static thread_local Vector drill_dstress_el(8);
 
     // Stenberg shear stabilization coefficient
     // to avoid shear oscillations in the thin limit
@@ -1872,15 +1872,15 @@ int
 ASDShellT3::displaySelf(Renderer& theViewer, int displayMode, float fact, const char** modes, int numMode)
 {
     // get the end point display coords
-    static Vector v1(3);
-    static Vector v2(3);
-    static Vector v3(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
+    static thread_local Vector v3(3);
     nodePointers[0]->getDisplayCrds(v1, fact, displayMode);
     nodePointers[1]->getDisplayCrds(v2, fact, displayMode);
     nodePointers[2]->getDisplayCrds(v3, fact, displayMode);
 
     // place values in coords matrix
-    static Matrix coords(3, 3);
+    static thread_local Matrix coords(3, 3);
     for (int i = 0; i < 3; i++) {
         coords(0, i) = v1(i);
         coords(1, i) = v2(i);
@@ -1888,7 +1888,7 @@ ASDShellT3::displaySelf(Renderer& theViewer, int displayMode, float fact, const
     }
 
     // set the quantity to be displayed at the nodes;
-    static Vector values(3);
+    static thread_local Vector values(3);
     for (int i = 0; i < 3; i++)
         values(i) = 0.0;
 
@@ -241,8 +241,8 @@ IGAShellMITC9::~IGAShellMITC9()
 void  IGAShellMITC9::setDomain( Domain *theDomain ) 
 {
   int i,j ;
-  static Vector eig(3) ;
-  static Matrix ddMembrane(3,3) ;
+  static thread_local Vector eig(3) ;
+  static thread_local Matrix ddMembrane(3,3) ;
 
   //node pointers
   for ( i = 0; i < 9; i++ ) {
@@ -531,8 +531,8 @@ IGAShellMITC9::getResponse(int responseID, Information &eleInfo)
 {
   int i;
   int cnt = 0;
-  static Vector stresses(84);
-  static Vector strains(84);
+  static thread_local Vector stresses(84);
+  static thread_local Vector strains(84);
 
   switch (responseID) {
   case 1: // global forces
@@ -614,13 +614,13 @@ const Matrix& IGAShellMITC9::getInitialStiff()
 
     static double xsj;  // determinant jacaobian matrix 
 
-    static double dvol[ngauss]; //volume element
+    static thread_local double dvol[ngauss]; //volume element
 
     //static double shp[3][numnodes];  //shape functions at a gauss point
 
-    static Matrix stiffJK(ndf, ndf); //nodeJK stiffness 
+    static thread_local Matrix stiffJK(ndf, ndf); //nodeJK stiffness 
 
-    static Matrix dd(nstress, nstress);  //material tangent
+    static thread_local Matrix dd(nstress, nstress);  //material tangent
 
     //static Matrix J0(2,2) ;  //Jacobian at center
 
@@ -628,29 +628,29 @@ const Matrix& IGAShellMITC9::getInitialStiff()
 
     //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress, ndf);      // B matrix node J
+    static thread_local Matrix BJ(nstress, ndf);      // B matrix node J
 
-    static Matrix BJtran(ndf, nstress);
+    static thread_local Matrix BJtran(ndf, nstress);
 
-    static Matrix BK(nstress, ndf);      // B matrix node k
+    static thread_local Matrix BK(nstress, ndf);      // B matrix node k
 
-    static Matrix BJtranD(ndf, nstress);
+    static thread_local Matrix BJtranD(ndf, nstress);
 
 
-    static Matrix Bbend(3, 3);  // bending B matrix
+    static thread_local Matrix Bbend(3, 3);  // bending B matrix
 
-    static Matrix Bshear(2, 3); // shear B matrix
+    static thread_local Matrix Bshear(2, 3); // shear B matrix
 
-    static Matrix Bmembrane(3, 2); // membrane B matrix
+    static thread_local Matrix Bmembrane(3, 2); // membrane B matrix
 
 
-    static double BdrillJ[ndf]; //drill B matrix
+    static thread_local double BdrillJ[ndf]; //drill B matrix
 
-    static double BdrillK[ndf];
+    static thread_local double BdrillK[ndf];
 
     double* drillPointer;
 
-    static double saveB[nstress][ndf][numnodes];
+    static thread_local double saveB[nstress][ndf][numnodes];
 
     //-------------------------------------------------------
 
@@ -814,7 +814,7 @@ IGAShellMITC9::addLoad(ElementalLoad *theLoad, double loadFactor)
 int 
 IGAShellMITC9::addInertiaLoadToUnbalance(const Vector &accel)
 {
-  static Vector r(54);
+  static thread_local Vector r(54);
   int tangFlag = 1 ;
 
   int i;
@@ -861,7 +861,7 @@ const Vector&  IGAShellMITC9::getResistingForce( )
 //get residual with inertia terms
 const Vector&  IGAShellMITC9::getResistingForceIncInertia( )
 {
-  static Vector res(54);
+  static thread_local Vector res(54);
   int tang_flag = 0 ; //don't get the tangent
 
   //do tangent and residual here 
@@ -905,9 +905,9 @@ IGAShellMITC9::formInertiaTerms( int tangFlag )
 
   double dvol ; //volume element
 
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static Vector momentum(ndf) ;
+  static thread_local Vector momentum(ndf) ;
 
 
   int i, j, k, p;
@@ -1039,19 +1039,19 @@ IGAShellMITC9::formResidAndTangent( int tang_flag )
 
   static double xsj ;  // determinant jacaobian matrix 
 
-  static double dvol[ngauss] ; //volume element
+  static thread_local double dvol[ngauss] ; //volume element
 
-  static Vector strain(nstress) ;  //strain
+  static thread_local Vector strain(nstress) ;  //strain
 
-  static double shp[3][numnodes] ;  //shape functions at a gauss point
+  static thread_local double shp[3][numnodes] ;  //shape functions at a gauss point
 
-  static Vector residJ(ndf) ; //nodeJ residual 
+  static thread_local Vector residJ(ndf) ; //nodeJ residual 
 
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
+  static thread_local Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
 
-  static Vector stress(nstress) ;  //stress resultants
+  static thread_local Vector stress(nstress) ;  //stress resultants
 
-  static Matrix dd(nstress,nstress) ;  //material tangent
+  static thread_local Matrix dd(nstress,nstress) ;  //material tangent
 
   double epsDrill = 0.0 ;  //drilling "strain"
 
@@ -1059,29 +1059,29 @@ IGAShellMITC9::formResidAndTangent( int tang_flag )
 
   //---------B-matrices------------------------------------
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+    static thread_local Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+    static thread_local Matrix BJtran(ndf,nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
+    static thread_local Matrix BK(nstress,ndf) ;      // B matrix node k
 
-    static Matrix BJtranD(ndf,nstress) ;
+    static thread_local Matrix BJtranD(ndf,nstress) ;
 
 
-    static Matrix Bbend(3,3) ;  // bending B matrix
+    static thread_local Matrix Bbend(3,3) ;  // bending B matrix
 
-    static Matrix Bshear(2,3) ; // shear B matrix
+    static thread_local Matrix Bshear(2,3) ; // shear B matrix
 
-    static Matrix Bmembrane(3,2) ; // membrane B matrix
+    static thread_local Matrix Bmembrane(3,2) ; // membrane B matrix
 
 
-    static double BdrillJ[ndf] ; //drill B matrix
+    static thread_local double BdrillJ[ndf] ; //drill B matrix
 
-    static double BdrillK[ndf] ;  
+    static thread_local double BdrillK[ndf] ;  
 
     double *drillPointer ;
 
-    static double saveB[nstress][ndf][numnodes] ;
+    static thread_local double saveB[nstress][ndf][numnodes] ;
 
   //-------------------------------------------------------
 
@@ -1269,7 +1269,7 @@ IGAShellMITC9::computeBasis( )
   //and use those as basis vectors but this is easier 
   //and the shell is flat anyway.
 
-  static Vector temp(3) ;
+  static thread_local Vector temp(3) ;
 
   //get two vectors (v1, v2) in plane of shell by 
   // nodal coordinate differences
@@ -1338,7 +1338,7 @@ IGAShellMITC9::computeBasis( )
 double*
 IGAShellMITC9::computeBdrill( int node, double** shp )
 {
-  static double Bdrill[6] ;
+  static thread_local double Bdrill[6] ;
   static double B1 ;
   static double B2 ;
   static double B6 ;
@@ -1375,12 +1375,12 @@ IGAShellMITC9::assembleB( const Matrix &Bmembrane,
   //Matrix Bshear(2,3) ; // plate shear B matrix
   //Matrix Bmembrane(3,2) ; // plate membrane B matrix
 
-  static Matrix B(8,6) ;
-  static Matrix BmembraneShell(3,3) ; 
-  static Matrix BbendShell(3,3) ; 
-  static Matrix BshearShell(2,6) ;
-  static Matrix Gmem(2,3) ;
-  static Matrix Gshear(3,6) ;
+  static thread_local Matrix B(8,6) ;
+  static thread_local Matrix BmembraneShell(3,3) ; 
+  static thread_local Matrix BbendShell(3,3) ; 
+  static thread_local Matrix BshearShell(2,6) ;
+  static thread_local Matrix Gmem(2,3) ;
+  static thread_local Matrix Gshear(3,6) ;
   int p, q ;
   int pp ;
 
@@ -1465,7 +1465,7 @@ IGAShellMITC9::assembleB( const Matrix &Bmembrane,
 const Matrix&   
 IGAShellMITC9::computeBmembrane( int node, double** shp ) 
 {
-  static Matrix Bmembrane(3,2) ;
+  static thread_local Matrix Bmembrane(3,2) ;
 
 //---Bmembrane Matrix in standard {1,2,3} mechanics notation---------
 //                -             -
@@ -1491,7 +1491,7 @@ IGAShellMITC9::computeBmembrane( int node, double** shp )
 const Matrix&   
 IGAShellMITC9::computeBbend( int node, double** shp )
 {
-  static Matrix Bbend(3,2) ;
+  static thread_local Matrix Bbend(3,2) ;
 
 //---Bbend Matrix in standard {1,2,3} mechanics notation---------
 //            -             -
@@ -1517,7 +1517,7 @@ IGAShellMITC9::computeBbend( int node, double** shp )
 const Matrix&  
 IGAShellMITC9::computeBshear( int node, double** shp )
 {
-  static Matrix Bshear(2,3) ;
+  static thread_local Matrix Bshear(2,3) ;
 
 //---Bshear Matrix in standard {1,2,3} mechanics notation------
 //             -                -
@@ -1881,7 +1881,7 @@ int  IGAShellMITC9::sendSelf (int commitTag,Channel &theChannel)
   int dataTag = this->getDbTag();
   // Now quad sends the ids of its materials
   int matDbTag;
-  static ID idData(27);
+  static thread_local ID idData(27);
   int i;
 
   for (i = 0; i < 9; i++) {
@@ -1913,7 +1913,7 @@ int  IGAShellMITC9::sendSelf (int commitTag,Channel &theChannel)
     return res;
   }
 
-  static Vector vectData(5);
+  static thread_local Vector vectData(5);
   vectData(0) = Ktt;
   vectData(1) = alphaM;
   vectData(2) = betaK;
@@ -1942,7 +1942,7 @@ int  IGAShellMITC9::recvSelf (int commitTag,Channel &theChannel,
 {
   int res = 0;
   int dataTag = this->getDbTag();
-  static ID idData(27);
+  static thread_local ID idData(27);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1960,7 +1960,7 @@ int  IGAShellMITC9::recvSelf (int commitTag,Channel &theChannel,
   connectedExternalNodes(6) = idData(25);
   connectedExternalNodes(7) = idData(26);
   connectedExternalNodes(8) = idData(27);
-  static Vector vectData(5);
+  static thread_local Vector vectData(5);
   res += theChannel.recvVector(dataTag, commitTag, vectData);
   if (res < 0) {
     opserr << "WARNING IGAShellMITC9::sendSelf() - " << this->getTag() << " failed to send ID\n";
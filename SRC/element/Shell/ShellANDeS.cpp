@@ -77,9 +77,9 @@ using namespace std;
 
 // Initialize static variables
 double ShellANDeS::alpha_membrane = 1.5; //Cfr. Reference (iii)
-Vector ShellANDeS::beta_membrane(10);
+thread_local Vector ShellANDeS::beta_membrane(10);
 unsigned int ShellANDeS::number_of_three_node_andes_membrane = 0;
-Matrix ShellANDeS::Mq(9, 9);
+thread_local Matrix ShellANDeS::Mq(9, 9);
 
 // Using the optimal parameter set found in reference (iv) page 14
 
@@ -356,7 +356,7 @@ int ShellANDeS::addInertiaLoadToUnbalance(const Vector &accel)
     return -1;
   }
 
-  static Vector ra(18); // Changed form 8 to 24(3*8)  Xiaoyan 09/27/00
+  static thread_local Vector ra(18); // Changed form 8 to 24(3*8)  Xiaoyan 09/27/00
 
   ra.Zero();
 
@@ -391,8 +391,8 @@ const Vector &ShellANDeS::getResistingForce()
 {
   P.Zero();
 
-  static Vector NodalDisplacements(18);
-  static Vector disp_i(6);
+  static thread_local Vector NodalDisplacements(18);
+  static thread_local Vector disp_i(6);
 
   NodalDisplacements.Zero();
   disp_i.Zero();
@@ -426,10 +426,10 @@ const Vector &ShellANDeS::getResistingForce()
 
 const Vector &ShellANDeS::getResistingForceIncInertia()
 {
-  static Vector NodalDisplacements(18);
-  static Vector disp_i(6);
-  static Vector NodalAccelerations(18);
-  static Vector accel_i(6);
+  static thread_local Vector NodalDisplacements(18);
+  static thread_local Vector disp_i(6);
+  static thread_local Vector NodalAccelerations(18);
+  static thread_local Vector accel_i(6);
 
   NodalDisplacements.Zero();
   disp_i.Zero();
@@ -550,7 +550,7 @@ int ShellANDeS::sendSelf(int commitTag, Channel &theChannel)
   int pos     = 0;
   int dataTag = this->getDbTag();
 
-  static ID idata(4);
+  static thread_local ID idata(4);
   idata(pos++) = this->getTag();
   idata(pos++) = connectedExternalNodes(0);
   idata(pos++) = connectedExternalNodes(1);
@@ -558,7 +558,7 @@ int ShellANDeS::sendSelf(int commitTag, Channel &theChannel)
 
   sendAndCheckID(commitTag, dataTag, idata, theChannel, "idata");
 
-  static Vector ddata(21 + 18);
+  static thread_local Vector ddata(21 + 18);
   pos          = 0;
   ddata(pos++) = thickness;
   ddata(pos++) = Area;
@@ -607,7 +607,7 @@ int ShellANDeS::recvSelf(int commitTag, Channel &theChannel,
   int pos     = 0;
   int dataTag = this->getDbTag();
 
-  static ID idata(4);
+  static thread_local ID idata(4);
   recvAndCheckID(commitTag, dataTag, idata, theChannel, "idata");
 
   this->setTag(idata(pos++));
@@ -615,7 +615,7 @@ int ShellANDeS::recvSelf(int commitTag, Channel &theChannel,
   connectedExternalNodes(1) = idata(pos++);
   connectedExternalNodes(2) = idata(pos++);
 
-  static Vector ddata(21 + 18);
+  static thread_local Vector ddata(21 + 18);
   recvAndCheckVector(commitTag, dataTag, ddata, theChannel, "ddata");
   pos            = 0;
   thickness      = ddata(pos++);
@@ -774,9 +774,9 @@ bool ShellANDeS::gotMass() const { return is_mass_calculated; }
 
 const Vector &ShellANDeS::getBodyForce(double loadFactor, const Vector &data)
 {
-  static Vector bforce(18);
-  static Vector ba(18);
-  static Vector bfx(3);
+  static thread_local Vector bforce(18);
+  static thread_local Vector ba(18);
+  static thread_local Vector bfx(3);
 
   bforce.Zero();
   ba.Zero();
@@ -818,16 +818,16 @@ const Vector &ShellANDeS::getBodyForce(double loadFactor, const Vector &data)
 
 const Vector &ShellANDeS::get_bending_moment_field()
 {
-  static Vector m(3);
-  static Vector disps_global(18);
-  static Vector disps_local(18);
+  static thread_local Vector m(3);
+  static thread_local Vector disps_global(18);
+  static thread_local Vector disps_local(18);
   // static Vector disps_local_bending(9);
-  static Vector d1(6);
-  static Vector d2(6);
-  static Vector d3(6);
-  static Matrix TLG(18, 18); // Local-to-global transformation matrix
-  static Matrix L(3, 9);
-  static Matrix EL(3, 9);
+  static thread_local Vector d1(6);
+  static thread_local Vector d2(6);
+  static thread_local Vector d3(6);
+  static thread_local Matrix TLG(18, 18); // Local-to-global transformation matrix
+  static thread_local Matrix L(3, 9);
+  static thread_local Matrix EL(3, 9);
 
   m.Zero();
   disps_global.Zero();
@@ -844,7 +844,7 @@ const Vector &ShellANDeS::get_bending_moment_field()
 
   // Form TLG
   int I, J;
-  static Matrix T_gl(3, 3);
+  static thread_local Matrix T_gl(3, 3);
   T_gl.Zero();
   T_lg.Invert(T_gl);
   int offset = 0;
@@ -1042,9 +1042,9 @@ const Matrix &ShellANDeS::getMembraneMass()
   double y13   = -y31;
   double alpha = 1.5;
 
-  static Matrix TLG(18, 18); // Local-to-global transformation matrix
-  static Matrix Ml(9, 9);
-  static Matrix Mlocal(18, 18);
+  static thread_local Matrix TLG(18, 18); // Local-to-global transformation matrix
+  static thread_local Matrix Ml(9, 9);
+  static thread_local Matrix Mlocal(18, 18);
 
   TLG.Zero();
   Ml.Zero();
@@ -1189,7 +1189,7 @@ const Matrix &ShellANDeS::getMembraneMass()
 
   // Form TLG
   TLG.Zero();
-  static Matrix T_gl(3, 3);
+  static thread_local Matrix T_gl(3, 3);
   T_gl.Zero();
   T_lg.Invert(T_gl);
   int offset = 0;
@@ -1212,7 +1212,7 @@ const Matrix &ShellANDeS::getMembraneMass()
   }
 
   // Compute total mass
-  static Matrix Mass(18, 18);
+  static thread_local Matrix Mass(18, 18);
   Mass.Zero();
   Mass.addMatrixTripleProduct(1.0, TLG, Mlocal, 1.0);
 
@@ -1231,8 +1231,8 @@ const Matrix &ShellANDeS::getBendingMass()
   double x_3 = this->xl3[0];
   double y_3 = this->xl3[1];
 
-  static Matrix Gp(9, 9);
-  static Matrix Hp(9, 9);
+  static thread_local Matrix Gp(9, 9);
+  static thread_local Matrix Hp(9, 9);
 
   Gp.Zero();
   Hp.Zero();
@@ -1396,12 +1396,12 @@ const Matrix &ShellANDeS::getBendingMass()
   Gp.Invert(Hp);
 
   // Get local matrix
-  static Matrix Ml(9, 9);
+  static thread_local Matrix Ml(9, 9);
   Ml.Zero();
   Ml.addMatrixTripleProduct(1.0, Hp, Mq, rho * Area * thickness);
 
   //Expand local matrix to local complete dofs.
-  static Matrix Mlocal(18, 18);
+  static thread_local Matrix Mlocal(18, 18);
   Mlocal.Zero();
 
   // Expand matrices to local complete mass
@@ -1420,9 +1420,9 @@ const Matrix &ShellANDeS::getBendingMass()
   }
 
   // Form TLG Transform local -> global
-  static Matrix TLG(18, 18);
+  static thread_local Matrix TLG(18, 18);
   TLG.Zero();
-  static Matrix T_gl(3, 3);
+  static thread_local Matrix T_gl(3, 3);
   T_gl.Zero();
   T_lg.Invert(T_gl);
   int offset = 0;
@@ -1445,7 +1445,7 @@ const Matrix &ShellANDeS::getBendingMass()
   }
 
   // Compute total stiffness as M = TLG^T * Mlocal *TLG
-  static Matrix Mass(18, 18);
+  static thread_local Matrix Mass(18, 18);
   Mass.Zero();
   Mass.addMatrixTripleProduct(1.0, TLG, Mlocal, 1.0);
 
@@ -1458,11 +1458,11 @@ const Matrix &ShellANDeS::getMembraneTangentStiffness()
   int I, J;
 
   // Form completestiffness
-  static Matrix Kb_membrane(9, 9); // Basic membrane stiffness
-  static Matrix Kh_membrane(9, 9); // High-order membrane stiffness
-  static Matrix Klocal(
+  static thread_local Matrix Kb_membrane(9, 9); // Basic membrane stiffness
+  static thread_local Matrix Kh_membrane(9, 9); // High-order membrane stiffness
+  static thread_local Matrix Klocal(
       18, 18); // Total (membrane + bending) stiffness in local coordinates
-  static Matrix TLG(18, 18); // Local-to-global transformation matrix
+  static thread_local Matrix TLG(18, 18); // Local-to-global transformation matrix
 
   Kb_membrane.Zero();
   Kh_membrane.Zero();
@@ -1505,7 +1505,7 @@ const Matrix &ShellANDeS::getMembraneTangentStiffness()
 
   // Form TLG
   TLG.Zero();
-  static Matrix T_gl(3, 3);
+  static thread_local Matrix T_gl(3, 3);
   T_gl.Zero();
   T_lg.Invert(T_gl);
   int offset = 0;
@@ -1540,11 +1540,11 @@ const Matrix &ShellANDeS::getBendingTangentStiffness()
   int I, J;
 
   // Form completestiffness
-  static Matrix Kb_bending(9, 9); // Basic bending stiffness
-  static Matrix Kh_bending(9, 9); // High-order bending stiffness
-  static Matrix Klocal(
+  static thread_local Matrix Kb_bending(9, 9); // Basic bending stiffness
+  static thread_local Matrix Kh_bending(9, 9); // High-order bending stiffness
+  static thread_local Matrix Klocal(
       18, 18); // Total (membrane + bending) stiffness in local coordinates
-  static Matrix TLG(18, 18); // Local-to-global transformation matrix
+  static thread_local Matrix TLG(18, 18); // Local-to-global transformation matrix
 
   Kb_bending.Zero();
   Kh_bending.Zero();
@@ -1579,7 +1579,7 @@ const Matrix &ShellANDeS::getBendingTangentStiffness()
 
   // Form TLG
   TLG.Zero();
-  static Matrix T_gl(3, 3);
+  static thread_local Matrix T_gl(3, 3);
   T_gl.Zero();
   T_lg.Invert(T_gl);
   int offset = 0;
@@ -1683,8 +1683,8 @@ Matrix ShellANDeS::getBendingBasicStiffness()
   double s23 = y32 / l23;
   double s31 = y13 / l31;
 
-  static Matrix L(3, 9);
-  static Matrix Kb(9, 9);
+  static thread_local Matrix L(3, 9);
+  static thread_local Matrix Kb(9, 9);
 
   L.Zero();
   Kb.Zero();
@@ -1764,7 +1764,7 @@ Matrix ShellANDeS::getBendingBasicStiffness()
 
 Matrix ShellANDeS::getBendingHighOrderStiffness()
 {
-  static Matrix Kh(9, 9);
+  static thread_local Matrix Kh(9, 9);
   Kh.Zero();
 
   // Geometric data
@@ -1780,7 +1780,7 @@ Matrix ShellANDeS::getBendingHighOrderStiffness()
   double l31 = sqrt(x31 * x31 + y31 * y31);
   double k_A = 4.0 * Area * Area;
 
-  static Matrix T(3, 3);
+  static thread_local Matrix T(3, 3);
   T.Zero();
 
   T(0, 0) = y23 * y13 / k_A;
@@ -1793,7 +1793,7 @@ Matrix ShellANDeS::getBendingHighOrderStiffness()
   T(2, 1) = (y31 * x12 + x13 * y21) / k_A;
   T(2, 2) = (y12 * x23 + x21 * y32) / k_A;
 
-  static Matrix D(3, 3);
+  static thread_local Matrix D(3, 3);
   D.Zero();
 
   D.addMatrixTripleProduct(
@@ -2017,7 +2017,7 @@ void ShellANDeS::initializeMq()
 
 Matrix ShellANDeS::getMembraneForceLumpingMatrix()
 {
-  static Matrix L(3, 9); // This is the transpose of Felippa's article
+  static thread_local Matrix L(3, 9); // This is the transpose of Felippa's article
   L.Zero();
 
   // Filling each row
@@ -2050,7 +2050,7 @@ Matrix ShellANDeS::getMembraneForceLumpingMatrix()
 
 Matrix ShellANDeS::getMembraneHierarchicalProjectionMatrix()
 {
-  static Matrix T_thu(3, 9);
+  static thread_local Matrix T_thu(3, 9);
   T_thu.Zero();
 
   double x21 = -x12;
@@ -2095,7 +2095,7 @@ Matrix ShellANDeS::getMembraneHierarchicalProjectionMatrix()
 
 Matrix ShellANDeS::getMembraneNaturalStrainProjectionMatrix()
 {
-  static Matrix T_e(3, 3);
+  static thread_local Matrix T_e(3, 3);
   T_e.Zero();
 
   double x21 = -x12;
@@ -2127,14 +2127,14 @@ Matrix ShellANDeS::getMembraneNaturalStrainProjectionMatrix()
 Matrix ShellANDeS::getMembraneBasicStiffness()
 {
   //Initialize basic stiffness
-  static Matrix Kb(9, 9);
+  static thread_local Matrix Kb(9, 9);
   Kb.Zero();
 
   //Condense E into plane stress matrix
   calculate_E_planestress_and_beta0();
 
   // Force lumping matrix
-  static Matrix L(3, 9);
+  static thread_local Matrix L(3, 9);
   L.Zero();
   L = getMembraneForceLumpingMatrix();
 
@@ -2148,9 +2148,9 @@ Matrix ShellANDeS::getMembraneBasicStiffness()
 
 Matrix ShellANDeS::getMembraneHighOrderStiffness()
 {
-  static Matrix Kh(9, 9);
-  static Matrix Ktheta(3, 3);
-  static Matrix Q1(3, 3), Q2(3, 3), Q3(3, 3), Q4(3, 3), Q5(3, 3), Q6(3, 3);
+  static thread_local Matrix Kh(9, 9);
+  static thread_local Matrix Ktheta(3, 3);
+  static thread_local Matrix Q1(3, 3), Q2(3, 3), Q3(3, 3), Q4(3, 3), Q5(3, 3), Q6(3, 3);
 
   Kh.Zero();
   Ktheta.Zero();
@@ -2212,7 +2212,7 @@ Matrix ShellANDeS::getMembraneHighOrderStiffness()
   //Transpose Qs
 
   Matrix T_e = getMembraneNaturalStrainProjectionMatrix();
-  static Matrix Enat(3, 3);
+  static thread_local Matrix Enat(3, 3);
   Enat.Zero();
   Enat.addMatrixTripleProduct(1.0, T_e, E_planestress,
                               1.0); // (T_e)^T*E_planestress*T_e
@@ -2460,14 +2460,14 @@ void ShellANDeS::calculate_E_planestress_and_beta0()
 void ShellANDeS::initializeGeometry(double n1, double n2, double n3)
 {
   //Local unit vectors
-  static Vector e1(3), e2(3), e3(3);
+  static thread_local Vector e1(3), e2(3), e3(3);
   e1.Zero();
   e2.Zero();
   e3.Zero();
   //node coordinates
-  static Vector x1(3);
-  static Vector x2(3);
-  static Vector x3(3);
+  static thread_local Vector x1(3);
+  static thread_local Vector x2(3);
+  static thread_local Vector x3(3);
   x1 = theNodes[0]->getCrds();
   x2 = theNodes[1]->getCrds();
   x3 = theNodes[2]->getCrds();
@@ -2496,9 +2496,9 @@ void ShellANDeS::initializeGeometry(double n1, double n2, double n3)
 
   //If local e1 axis is given, then use it instead but keep the normal!!
   if (n1 != 0 || n2 != 0 || n3 != 0) {
-    static Vector nn(3);
-    static Vector temp1(3);
-    static Vector temp2(3);
+    static thread_local Vector nn(3);
+    static thread_local Vector temp1(3);
+    static thread_local Vector temp2(3);
     nn(0) = n1;
     nn(1) = n2;
     nn(2) = n3;
@@ -2547,15 +2547,15 @@ int ShellANDeS::displaySelf(Renderer &theViewer, int displayMode, float fact,
                             const char **displayModes, int numModes)
 {
   // get the end point display coords
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector v3(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector v3(3);
   theNodes[0]->getDisplayCrds(v1, fact, displayMode);
   theNodes[1]->getDisplayCrds(v2, fact, displayMode);
   theNodes[2]->getDisplayCrds(v3, fact, displayMode);
 
   // place values in coords matrix
-  static Matrix coords(3, 3);
+  static thread_local Matrix coords(3, 3);
   for (int i = 0; i < 3; i++) {
     coords(0, i) = v1(i);
     coords(1, i) = v2(i);
@@ -2563,7 +2563,7 @@ int ShellANDeS::displaySelf(Renderer &theViewer, int displayMode, float fact,
   }
 
   // basic colors
-  static Vector values(3);
+  static thread_local Vector values(3);
   for (int i = 0; i < 3; i++)
     values(i) = 0.0;
 
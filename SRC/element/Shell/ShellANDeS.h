@@ -231,7 +231,7 @@ private:
 
     // Element formulation related
     static double alpha_membrane;   // Scale factor relating boundary normal displacements to corner rotations. See paper (1) by Felippa.
-    static Vector beta_membrane;    // beta_membrane parameter values
+    static thread_local Vector beta_membrane;    // beta_membrane parameter values
     double beta0;                   // Optimal beta0 depends on material Poisson's ratio as seen in ref (iv) page 17 --> beta0 = 1/2*(1-4*nu^2)
 
     static unsigned int number_of_three_node_andes_membrane;
@@ -240,7 +240,7 @@ private:
    // Element formulation related
     double disp_init[3][6];
     
-    static Matrix Mq;
+    static thread_local Matrix Mq;
 
     int initialized_disps;
 };
@@ -47,9 +47,9 @@
 
 
 // static data
-Matrix ShellDKGQ::stiff(24, 24);
-Vector ShellDKGQ::resid(24);
-Matrix ShellDKGQ::mass(24, 24);
+thread_local Matrix ShellDKGQ::stiff(24, 24);
+thread_local Vector ShellDKGQ::resid(24);
+thread_local Matrix ShellDKGQ::mass(24, 24);
 
 ShellDKGQ::ShellDKGQ()
     : Element(0, ELE_TAG_ShellDKGQ), connectedExternalNodes(4), load(0), Ki(0)
@@ -345,8 +345,8 @@ int ShellDKGQ::getResponse(int responseID, Information &eleInfo)
 {
   int cnt = 0;
 
-  static Vector stresses(32);
-  static Vector strains(32);
+  static thread_local Vector stresses(32);
+  static thread_local Vector strains(32);
 
   switch (responseID) {
   case 1: // global forces
@@ -422,30 +422,30 @@ const Matrix &ShellDKGQ::getInitialStiff()
   double volume = 0.0;
 
   static double xsj;              // determinant jacabian matrix
-  static double dvol[ShellDKGQ::nip];     // volume element
-  static double shp[3][ShellDKGQ::numberNodes]; // shape function 2d at a gauss point
+  static thread_local double dvol[ShellDKGQ::nip];     // volume element
+  static thread_local double shp[3][ShellDKGQ::numberNodes]; // shape function 2d at a gauss point
 
   // shape function-drilling dof(Nu,1&Nu,2&Nv,1&Nv,2) at a gauss point
-  static double shpDrill[4][ShellDKGQ::numberNodes];
+  static thread_local double shpDrill[4][ShellDKGQ::numberNodes];
 
   // shape function -bending part(Hx,Hy,Hx-1,2&Hy-1,2) at a gauss point
-  static double shpBend[6][12]; 
+  static thread_local double shpBend[6][12]; 
 
-  static Matrix stiffJK(ndf, ndf);      //nodeJK stiffness, global coordinates
-  static Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
-  static Matrix stiffJK1(ndf, ndf);
-  static Matrix stiffJK2(ndf, ndf);
-  static Matrix stiffJK3(ndf, ndf);
+  static thread_local Matrix stiffJK(ndf, ndf);      //nodeJK stiffness, global coordinates
+  static thread_local Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
+  static thread_local Matrix stiffJK1(ndf, ndf);
+  static thread_local Matrix stiffJK2(ndf, ndf);
+  static thread_local Matrix stiffJK3(ndf, ndf);
 
   //static Vector stress(nstress); //stress resultants
 
-  static Matrix dd(nstress, nstress); // material tangent
+  static thread_local Matrix dd(nstress, nstress); // material tangent
 
   // Tmat(6,6):  local-global coordinates matrix
   // Pmat(6,6):  from (u1 u2 theta3 w theta1 theta2) to (u1 u2 w theta1 theta2 theta3)
   // J0(2,2):    Jacobian at center
   // J0inv(2,2): inverse of Jacobian at center
-  static double sx[2][2]; // inverse of Jacobian
+  static thread_local double sx[2][2]; // inverse of Jacobian
 
 
   Matrix Tmat(6, 6);
@@ -454,14 +454,14 @@ const Matrix &ShellDKGQ::getInitialStiff()
   Matrix PmatTran(6, 6);
 
   //--------------------B-matrices-------------------------------
-  static Matrix BJ(nstress, ndf);      // B matrix node J
-  static Matrix BJtran(ndf, nstress);  // BJ Transposed
-  static Matrix BK(nstress, ndf);      // B matrix node K
-  static Matrix BJtranD(ndf, nstress); // BJtran * dd
-  static Matrix Bmembrane(3, 3);       // membrane B matrix
-  static Matrix Bbend(3, 3);           // bending B matrix
-  static Matrix Bshear(2, 3);          // shear B matrix (zero)
-  static double saveB[nstress][ShellDKGQ::ndf][ShellDKGQ::numberNodes];
+  static thread_local Matrix BJ(nstress, ndf);      // B matrix node J
+  static thread_local Matrix BJtran(ndf, nstress);  // BJ Transposed
+  static thread_local Matrix BK(nstress, ndf);      // B matrix node K
+  static thread_local Matrix BJtranD(ndf, nstress); // BJtran * dd
+  static thread_local Matrix Bmembrane(3, 3);       // membrane B matrix
+  static thread_local Matrix Bbend(3, 3);           // bending B matrix
+  static thread_local Matrix Bshear(2, 3);          // shear B matrix (zero)
+  static thread_local double saveB[nstress][ShellDKGQ::ndf][ShellDKGQ::numberNodes];
   //-------------------------------------------------------------
 
   stiff.Zero();
@@ -678,7 +678,7 @@ const Vector &ShellDKGQ::getResistingForce()
 //get residual with inertia terms
 const Vector &ShellDKGQ::getResistingForceIncInertia()
 {
-  static Vector res(24);
+  static thread_local Vector res(24);
   int tang_flag = 0; //don't get the tangent
 
   //do tangent and residual here
@@ -712,9 +712,9 @@ void ShellDKGQ::formInertiaTerms(int tangFlag)
   double dvol;     // volume element
 
   //shape functions at a gauss point
-  static double shp[ShellDKGQ::nShape][ShellDKGQ::numberNodes];
+  static thread_local double shp[ShellDKGQ::nShape][ShellDKGQ::numberNodes];
 
-  static Vector momentum(ndf);
+  static thread_local Vector momentum(ndf);
 
   int i, j, k, p;
   int jj, kk;
@@ -830,7 +830,7 @@ void ShellDKGQ::formResidAndTangent(int tang_flag)
 
   static double xsj; //determinant jacobian matrix
 
-  static double dvol[ShellDKGQ::nip]; //volume element
+  static thread_local double dvol[ShellDKGQ::nip]; //volume element
 
 
   static double 
@@ -839,25 +839,25 @@ void ShellDKGQ::formResidAndTangent(int tang_flag)
       shpDrill[4][ShellDKGQ::numberNodes]; // shape function drilling dof at a gauss point
 
 
-  static Vector strain(nstress); //strain
-  static Vector residJ(ndf); //nodeJ residual, global coordinates
-  static Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
-  static Vector residJlocal(ndf); //nodeJ residual, local coordinates
-  static Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
-  static Matrix stiffJK1(ndf, ndf);
-  static Matrix stiffJK2(ndf, ndf);
-  static Matrix stiffJK3(ndf, ndf);
+  static thread_local Vector strain(nstress); //strain
+  static thread_local Vector residJ(ndf); //nodeJ residual, global coordinates
+  static thread_local Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
+  static thread_local Vector residJlocal(ndf); //nodeJ residual, local coordinates
+  static thread_local Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
+  static thread_local Matrix stiffJK1(ndf, ndf);
+  static thread_local Matrix stiffJK2(ndf, ndf);
+  static thread_local Matrix stiffJK3(ndf, ndf);
 
-  static Vector residJ1(ndf);
+  static thread_local Vector residJ1(ndf);
 
-  static Vector stress(nstress); //stress resultants
+  static thread_local Vector stress(nstress); //stress resultants
 
-  static Matrix dd(nstress, nstress); //material tangent
+  static thread_local Matrix dd(nstress, nstress); //material tangent
 
   //static Matrix J0(2,2); //Jacobian at center
 
   //static Matrix J0inv(2,2); //inverse of Jacobian at center
-  static double sx[2][2];
+  static thread_local double sx[2][2];
 
   Matrix Tmat(6, 6); //local-global coordinates transform matrix
 
@@ -869,26 +869,26 @@ void ShellDKGQ::formResidAndTangent(int tang_flag)
 
   //-------------------B-matrices---------------------------------
 
-  static Matrix BJ(nstress, ndf); // B matrix node J
+  static thread_local Matrix BJ(nstress, ndf); // B matrix node J
 
-  static Matrix BJtran(ndf, nstress);
+  static thread_local Matrix BJtran(ndf, nstress);
 
-  static Matrix BK(nstress, ndf); // B matrix node K
+  static thread_local Matrix BK(nstress, ndf); // B matrix node K
 
-  static Matrix BJtranD(ndf, nstress); //BJtran * dd
+  static thread_local Matrix BJtranD(ndf, nstress); //BJtran * dd
 
-  static Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
+  static thread_local Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
 
-  static Matrix BJPT(
+  static thread_local Matrix BJPT(
       nstress, ndf); //BJP * Tmmat, from global coordinates to local coordinates
 
-  static Matrix Bmembrane(3, 3); //membrane B matrix
+  static thread_local Matrix Bmembrane(3, 3); //membrane B matrix
 
-  static Matrix Bbend(3, 3); //bending B matrix
+  static thread_local Matrix Bbend(3, 3); //bending B matrix
 
-  static Matrix Bshear(2, 3); //shear B matrix (zero)
+  static thread_local Matrix Bshear(2, 3); //shear B matrix (zero)
 
-  static double saveB[nstress][ShellDKGQ::ndf][ShellDKGQ::numberNodes];
+  static thread_local double saveB[nstress][ShellDKGQ::ndf][ShellDKGQ::numberNodes];
   //---------------------------------------------------------------
 
   //zero stiffness and residual
@@ -1090,11 +1090,11 @@ void ShellDKGQ::computeBasis()
   //and use those as basis vectors but this is easier
   //and the shell is flat anyway.
 
-  static Vector temp(3);
+  static thread_local Vector temp(3);
 
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector v3(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector v3(3);
 
   //get two vectors (v1, v2) in plane of shell by
   // nodal coordinate differences
@@ -1174,11 +1174,11 @@ void ShellDKGQ::updateBasis()
   //and use those as basis vectors but this is easier
   //and the shell is flat anyway.
 
-  static Vector temp(3);
+  static thread_local Vector temp(3);
 
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector v3(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector v3(3);
 
   //get two vectors (v1, v2) in plane of shell by
   // nodal coordinate differences
@@ -1258,7 +1258,7 @@ void ShellDKGQ::updateBasis()
 const Matrix &ShellDKGQ::assembleB(const Matrix &Bmembrane, const Matrix &Bbend,
                                    const Matrix &Bshear)
 {
-  static Matrix B(8, 6);
+  static thread_local Matrix B(8, 6);
 
   int p, q;
 
@@ -1311,7 +1311,7 @@ const Matrix &ShellDKGQ::assembleB(const Matrix &Bmembrane, const Matrix &Bbend,
 const Matrix &ShellDKGQ::computeBmembrane(int node, const double shp[3][4],
                                           const double shpDrill[4][4])
 {
-  static Matrix Bmembrane(3, 3);
+  static thread_local Matrix Bmembrane(3, 3);
 
   // ------Bmembrane Matrix in standard {1,2,3} mechanics notation ---------------
   //
@@ -1338,7 +1338,7 @@ const Matrix &ShellDKGQ::computeBmembrane(int node, const double shp[3][4],
 
 const Matrix &ShellDKGQ::computeBbend(int node, const double shpBend[6][12])
 {
-  static Matrix Bbend(3, 3);
+  static thread_local Matrix Bbend(3, 3);
 
   int i, j, k;
 
@@ -1392,7 +1392,7 @@ void ShellDKGQ::shape2d(double ss, double tt, const double x[2][4],
   static const double s[] = {-0.5, 0.5, 0.5, -0.5};
   static const double t[] = {-0.5, -0.5, 0.5, 0.5};
 
-  static double xs[2][2];
+  static thread_local double xs[2][2];
   //  static double sx[2][2] ;  //have been defined before
 
   for (i = 0; i < 4; i++) {
@@ -1509,7 +1509,7 @@ void ShellDKGQ::shapeBend(double ss, double tt, const double x[2][4],
   //static Vector N(8);
   //static Vector Nxi(8);
   //static Vector Neta(8);
-  static double N[3][8];
+  static thread_local double N[3][8];
 
   double a5, a6, a7, a8;
   double b5, b6, b7, b8;
@@ -1521,7 +1521,7 @@ void ShellDKGQ::shapeBend(double ss, double tt, const double x[2][4],
   double y12, y23, y34, y41;
   double L12, L23, L34, L41;
 
-  static double temp[4][12];
+  static thread_local double temp[4][12];
 
   int i;
 
@@ -1722,7 +1722,7 @@ int ShellDKGQ::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(13);
+  static thread_local ID idData(13);
 
   int i;
   for (i = 0; i < 4; i++) {
@@ -1751,7 +1751,7 @@ int ShellDKGQ::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vectData(4);
+  static thread_local Vector vectData(4);
   //vectData(0) = Ktt;
   vectData(0) = alphaM;
   vectData(1) = betaK;
@@ -1785,7 +1785,7 @@ int ShellDKGQ::recvSelf(int commitTag, Channel &theChannel,
 
   int dataTag = this->getDbTag();
 
-  static ID idData(13);
+  static thread_local ID idData(13);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1800,7 +1800,7 @@ int ShellDKGQ::recvSelf(int commitTag, Channel &theChannel,
   connectedExternalNodes(2) = idData(11);
   connectedExternalNodes(3) = idData(12);
 
-  static Vector vectData(4);
+  static thread_local Vector vectData(4);
   res += theChannel.recvVector(dataTag, commitTag, vectData);
   if (res < 0) {
     opserr << "WARNING ShellDKGQ::sendSelf() - " << this->getTag()
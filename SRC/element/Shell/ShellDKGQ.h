@@ -113,10 +113,10 @@ class ShellDKGQ : public Element,
   private : 
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damping ;
 
     //node information
     ID connectedExternalNodes ;  //four node numbers
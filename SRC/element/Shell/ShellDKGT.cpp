@@ -50,9 +50,9 @@
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
 //static data
-Matrix ShellDKGT::stiff(18, 18);
-Vector ShellDKGT::resid(18);
-Matrix ShellDKGT::mass(18, 18);
+thread_local Matrix ShellDKGT::stiff(18, 18);
+thread_local Vector ShellDKGT::resid(18);
+thread_local Matrix ShellDKGT::mass(18, 18);
 
 //quadrature data
 
@@ -416,8 +416,8 @@ int ShellDKGT::getResponse(int responseID, Information &eleInfo)
 {
   int cnt = 0;
 
-  static Vector stresses(32);
-  static Vector strains(32);
+  static thread_local Vector stresses(32);
+  static thread_local Vector strains(32);
 
   switch (responseID) {
   case 1: // global forces
@@ -494,31 +494,31 @@ ShellDKGT::getInitialStiff()
   double volume = 0.0;
 
   static double xsj;              //determinant jacabian matrix
-  static double dvol[ngauss];     //volume element
-  static double shp[3][ShellDKGT::numberNodes]; //shape function 2d at a gauss point
+  static thread_local double dvol[ngauss];     //volume element
+  static thread_local double shp[3][ShellDKGT::numberNodes]; //shape function 2d at a gauss point
 
   //	static double shpM[3][ShellDKGT::numberNodes];//shape function-membrane at a gausss point
 
-  static double shpDrill[4][ShellDKGT::numberNodes]; //shape function-drilling dof(Nu,1&Nu,2&Nv,1&Nv,2) at a gauss point
+  static thread_local double shpDrill[4][ShellDKGT::numberNodes]; //shape function-drilling dof(Nu,1&Nu,2&Nv,1&Nv,2) at a gauss point
 
-  static double shpBend[6][9]; //shape function -bending part(Hx,Hy,Hx-1,2&Hy-1,2) at a gauss point
+  static thread_local double shpBend[6][9]; //shape function -bending part(Hx,Hy,Hx-1,2&Hy-1,2) at a gauss point
 
   //static Vector residJ(ndf,ndf); //nodeJ residual, global coordinates
 
-  static Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
+  static thread_local Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
 
   //static Vector residJlocal(ndf,ndf); // nodeJ residual, local coordinates
 
-  static Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
-  static Matrix stiffJK1(ndf, ndf);
-  static Matrix stiffJK2(ndf, ndf);
-  static Matrix stiffJK3(ndf, ndf);
+  static thread_local Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
+  static thread_local Matrix stiffJK1(ndf, ndf);
+  static thread_local Matrix stiffJK2(ndf, ndf);
+  static thread_local Matrix stiffJK3(ndf, ndf);
 
   //static Vector stress(nstress); //stress resultants
 
-  static Matrix dd(nstress, nstress); // material tangent
+  static thread_local Matrix dd(nstress, nstress); // material tangent
 
-  static double sx[2][2]; // inverse of Jacobian
+  static thread_local double sx[2][2]; // inverse of Jacobian
 
   Matrix Tmat(6, 6);
   Matrix TmatTran(6, 6);
@@ -526,15 +526,15 @@ ShellDKGT::getInitialStiff()
   Matrix PmatTran(6, 6);
 
   //--------------------B-matrices-------------------------------
-  static Matrix BJ(nstress, ndf);      // B matrix node J
-  static Matrix BJtran(ndf, nstress);
-  static Matrix BK(nstress, ndf);      // B matrix node K
-  static Matrix BJtranD(ndf, nstress); // BJtran * dd
-  static Matrix Bmembrane(3, 3);       // membrane B matrix
-  static Matrix Bbend(3, 3);           // bending B matrix
-  static Matrix Bshear(2, 3);          // shear B matrix (zero)
-
-  static double saveB[nstress][ShellDKGT::ndf][ShellDKGT::numberNodes];
+  static thread_local Matrix BJ(nstress, ndf);      // B matrix node J
+  static thread_local Matrix BJtran(ndf, nstress);
+  static thread_local Matrix BK(nstress, ndf);      // B matrix node K
+  static thread_local Matrix BJtranD(ndf, nstress); // BJtran * dd
+  static thread_local Matrix Bmembrane(3, 3);       // membrane B matrix
+  static thread_local Matrix Bbend(3, 3);           // bending B matrix
+  static thread_local Matrix Bshear(2, 3);          // shear B matrix (zero)
+
+  static thread_local double saveB[nstress][ShellDKGT::ndf][ShellDKGT::numberNodes];
   //-------------------------------------------------------------
 
   stiff.Zero();
@@ -774,7 +774,7 @@ const Vector &ShellDKGT::getResistingForce()
 //get residual with inertia terms
 const Vector &ShellDKGT::getResistingForceIncInertia()
 {
-  static Vector res(18);
+  static thread_local Vector res(18);
   int tang_flag = 0; //don't get the tangent
 
   //do tangent and residual here
@@ -813,7 +813,7 @@ void ShellDKGT::formInertiaTerms(int tangFlag)
 
   double shp[ShellDKGT::nShape][ShellDKGT::numberNodes]; //shape functions at a gauss point
 
-  static Vector momentum(ndf);
+  static thread_local Vector momentum(ndf);
 
   int i, j, k, p;
   int jj, kk;
@@ -912,41 +912,41 @@ void ShellDKGT::formResidAndTangent(int tang_flag)
 
   static double xsj; //determinant jacobian matrix
 
-  static double dvol[ngauss]; //volume element
+  static thread_local double dvol[ngauss]; //volume element
 
-  static Vector strain(nstress); //strain
+  static thread_local Vector strain(nstress); //strain
 
-  static double shp[3][ShellDKGT::numberNodes]; //shape function 2d at a gauss point
+  static thread_local double shp[3][ShellDKGT::numberNodes]; //shape function 2d at a gauss point
 
   static double
       shpDrill[4][ShellDKGT::numberNodes]; //shape function drilling dof at a gauss point
 
-  static double shpBend[6][9]; //shape function - bending part at a gauss point
+  static thread_local double shpBend[6][9]; //shape function - bending part at a gauss point
 
-  static Vector residJ(ndf); //nodeJ residual, global coordinates
+  static thread_local Vector residJ(ndf); //nodeJ residual, global coordinates
 
-  static Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
+  static thread_local Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
 
-  static Vector residJlocal(ndf); //nodeJ residual, local coordinates
+  static thread_local Vector residJlocal(ndf); //nodeJ residual, local coordinates
 
-  static Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
+  static thread_local Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
 
-  static Matrix stiffJK1(ndf, ndf);
+  static thread_local Matrix stiffJK1(ndf, ndf);
 
-  static Matrix stiffJK2(ndf, ndf);
+  static thread_local Matrix stiffJK2(ndf, ndf);
 
-  static Matrix stiffJK3(ndf, ndf);
+  static thread_local Matrix stiffJK3(ndf, ndf);
 
-  static Vector residJ1(ndf);
+  static thread_local Vector residJ1(ndf);
 
-  static Vector stress(nstress); //stress resultants
+  static thread_local Vector stress(nstress); //stress resultants
 
-  static Matrix dd(nstress, nstress); //material tangent
+  static thread_local Matrix dd(nstress, nstress); //material tangent
 
   //static Matrix J0(2,2); //Jacobian at center
 
   //static Matrix J0inv(2,2); //inverse of Jacobian at center
-  static double sx[2][2];
+  static thread_local double sx[2][2];
 
   Matrix Tmat(6, 6); //local-global coordinates transform matrix
 
@@ -958,27 +958,27 @@ void ShellDKGT::formResidAndTangent(int tang_flag)
 
   //-------------------B-matrices---------------------------------
 
-  static Matrix BJ(nstress, ndf); // B matrix node J
+  static thread_local Matrix BJ(nstress, ndf); // B matrix node J
 
-  static Matrix BJtran(ndf, nstress);
-  static Matrix BJt(nstress, ndf);
+  static thread_local Matrix BJtran(ndf, nstress);
+  static thread_local Matrix BJt(nstress, ndf);
 
-  static Matrix BK(nstress, ndf); // B matrix node K
+  static thread_local Matrix BK(nstress, ndf); // B matrix node K
 
-  static Matrix BJtranD(ndf, nstress); //BJtran * dd
+  static thread_local Matrix BJtranD(ndf, nstress); //BJtran * dd
 
-  static Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
+  static thread_local Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
 
-  static Matrix BJPT(
+  static thread_local Matrix BJPT(
       nstress, ndf); //BJP * Tmmat, from global coordinates to local coordinates
 
-  static Matrix Bmembrane(3, 3); //membrane B matrix
+  static thread_local Matrix Bmembrane(3, 3); //membrane B matrix
 
-  static Matrix Bbend(3, 3); //bending B matrix
+  static thread_local Matrix Bbend(3, 3); //bending B matrix
 
-  static Matrix Bshear(2, 3); //shear B matrix (zero)
+  static thread_local Matrix Bshear(2, 3); //shear B matrix (zero)
 
-  static double saveB[nstress][ShellDKGT::ndf][ShellDKGT::numberNodes];
+  static thread_local double saveB[nstress][ShellDKGT::ndf][ShellDKGT::numberNodes];
   //---------------------------------------------------------------
 
   //zero stiffness and residual
@@ -1179,7 +1179,7 @@ void ShellDKGT::formResidAndTangent(int tang_flag)
 
     double temp, rhoH;
     //If defined, apply self-weight
-    static Vector momentum(ndf);
+    static thread_local Vector momentum(ndf);
     double ddvol = 0;
     for (i = 0; i < ShellDKGT::numberGauss; i++) {
 
@@ -1375,7 +1375,7 @@ int ShellDKGT::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(15);
+  static thread_local ID idData(15);
 
   int i;
   for (i = 0; i < 4; i++) {
@@ -1406,7 +1406,7 @@ int ShellDKGT::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vectData(4); //????
+  static thread_local Vector vectData(4); //????
   //vectData(0) = Ktt;
   vectData(0) = alphaM;
   vectData(1) = betaK;
@@ -1440,7 +1440,7 @@ int ShellDKGT::recvSelf(int commitTag, Channel &theChannel,
 
   int dataTag = this->getDbTag();
 
-  static ID idData(14);
+  static thread_local ID idData(14);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1455,7 +1455,7 @@ int ShellDKGT::recvSelf(int commitTag, Channel &theChannel,
   connectedExternalNodes(2) = idData(11);
   applyLoad                 = idData(14);
 
-  static Vector vectData(4);
+  static thread_local Vector vectData(4);
   res += theChannel.recvVector(dataTag, commitTag, vectData);
   if (res < 0) {
     opserr << "WARNING ShellDKGT::sendSelf() - " << this->getTag()
@@ -1627,7 +1627,7 @@ void ShellDKGT::shapeDrill(double ss, double tt, double qq,
 const Matrix &ShellDKGT::assembleB(const Matrix &Bmembrane, const Matrix &Bbend,
                                    const Matrix &Bshear)
 {
-  static Matrix B(8, 6);
+  static thread_local Matrix B(8, 6);
 
   int p, q;
 
@@ -1677,7 +1677,7 @@ const Matrix &ShellDKGT::assembleB(const Matrix &Bmembrane, const Matrix &Bbend,
 const Matrix &ShellDKGT::computeBmembrane(int node, const double shp[3][3],
                                           const double shpDrill[4][3])
 {
-  static Matrix Bmembrane(3, 3);
+  static thread_local Matrix Bmembrane(3, 3);
 
   // ------Bmembrane Matrix in standard {1,2,3} mechanics notation ---------------
   //
@@ -1704,7 +1704,7 @@ const Matrix &ShellDKGT::computeBmembrane(int node, const double shp[3][3],
 
 const Matrix &ShellDKGT::computeBbend(int node, const double shpBend[6][9])
 {
-  static Matrix Bbend(3, 3);
+  static thread_local Matrix Bbend(3, 3);
 
   int i, j, k;
 
@@ -1749,8 +1749,8 @@ const Matrix &ShellDKGT::computeBbend(int node, const double shpBend[6][9])
 void ShellDKGT::shapeBend(double ss, double tt, double qq, const double x[2][3],
                           double sx[2][2], double shpBend[6][9])
 {
-  static double N[3][6];
-  static double temp[4][9];
+  static thread_local double N[3][6];
+  static thread_local double temp[4][9];
 
   double a4, a5, a6;
   double b4, b5, b6;
@@ -105,10 +105,10 @@ class ShellDKGT : public Element {
     static constexpr int massIndex   = nShape - 1;
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damping ;
 
     //quadrature data
     static const double three ;
@@ -55,9 +55,9 @@
 using namespace OpenSees;
 
 // static data
-Matrix ShellMITC4::stiff(24, 24);
-Vector ShellMITC4::resid(24);
-Matrix ShellMITC4::mass(24, 24);
+thread_local Matrix ShellMITC4::stiff(24, 24);
+thread_local Vector ShellMITC4::resid(24);
+thread_local Matrix ShellMITC4::mass(24, 24);
 
 
 ShellMITC4::ShellMITC4()
@@ -415,8 +415,8 @@ Response *ShellMITC4::setResponse(const char **argv, int argc,
 int ShellMITC4::getResponse(int responseID, Information &eleInfo)
 {
   int cnt = 0;
-  static Vector stresses(32);
-  static Vector strains(32);
+  static thread_local Vector stresses(32);
+  static thread_local Vector strains(32);
 
   switch (responseID) {
   case 1: // global forces
@@ -493,18 +493,18 @@ const Matrix &ShellMITC4::getInitialStiff()
 
   //  static double Shape[3][NEN][nip] ; // all the shape functions
 
-  static Matrix stiffJK(ndf, ndf);    // nodeJK stiffness
-  static Matrix dd(nstress, nstress); // material tangent
+  static thread_local Matrix stiffJK(ndf, ndf);    // nodeJK stiffness
+  static thread_local Matrix dd(nstress, nstress); // material tangent
 
   //---------B-matrices------------------------------------
-  static Matrix BJ(nstress, ndf); // B matrix node J
-  static Matrix BK(nstress, ndf); // B matrix node k
-  static Matrix BJtran(ndf, nstress);
-  static Matrix BJtranD(ndf, nstress);
-
-  static Matrix Bbend(3, 3);     // bending B matrix
-  static Matrix Bshear(2, 3);    // shear B matrix
-  static Matrix Bmembrane(3, 2); // membrane B matrix
+  static thread_local Matrix BJ(nstress, ndf); // B matrix node J
+  static thread_local Matrix BK(nstress, ndf); // B matrix node k
+  static thread_local Matrix BJtran(ndf, nstress);
+  static thread_local Matrix BJtranD(ndf, nstress);
+
+  static thread_local Matrix Bbend(3, 3);     // bending B matrix
+  static thread_local Matrix Bshear(2, 3);    // shear B matrix
+  static thread_local Matrix Bmembrane(3, 2); // membrane B matrix
   OPS_STATIC double BdrillJ[ndf]; // drill B matrix
   OPS_STATIC double BdrillK[ndf];
 
@@ -748,7 +748,7 @@ int ShellMITC4::addLoad(ElementalLoad *theLoad, double loadFactor)
 int ShellMITC4::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int tangFlag = 1;
-  static Vector r(24);
+  static thread_local Vector r(24);
 
   int allRhoZero = 0;
   for (int i = 0; i < 4; i++) {
@@ -793,7 +793,7 @@ const Vector &ShellMITC4::getResistingForce()
 // get residual with inertia terms
 const Vector &ShellMITC4::getResistingForceIncInertia()
 {
-  static Vector res(24);
+  static thread_local Vector res(24);
   int tang_flag = 0; // don't get the tangent
 
   // do tangent and residual here
@@ -828,7 +828,7 @@ void ShellMITC4::formInertiaTerms(int tangFlag)
   double dvol; // volume element
   OPS_STATIC double shp[nShape][numberNodes]; // shape functions at a gauss point
 
-  static Vector momentum(ndf);
+  static thread_local Vector momentum(ndf);
 
   double temp, rhoH, massJK;
 
@@ -940,8 +940,8 @@ void ShellMITC4::formResidAndTangent(int tang_flag)
   OPS_STATIC double shp[3][NEN];      // shape functions at a gauss point
 
   //  static double Shape[3][NEN][nip] ; // all the shape functions
-  static Vector stress(nstress);      // stress resultants
-  static Vector strain(nstress);      // strain
+  static thread_local Vector stress(nstress);      // stress resultants
+  static thread_local Vector strain(nstress);      // strain
                                       //
   OPS_STATIC VectorND<ndf> residJ;
   OPS_STATIC MatrixND<nstress,nstress> dd; // material tangent
@@ -952,11 +952,11 @@ void ShellMITC4::formResidAndTangent(int tang_flag)
 
   //---------B-matrices------------------------------------
   OPS_STATIC MatrixND<nstress, ndf> B[NEN];
-  static Matrix BJtranD(ndf, nstress);
-  static Matrix Bbend(3, 3);           // bending B matrix
-  static Matrix Bshear(2, 3);          // shear B matrix
+  static thread_local Matrix BJtranD(ndf, nstress);
+  static thread_local Matrix Bbend(3, 3);           // bending B matrix
+  static thread_local Matrix Bshear(2, 3);          // shear B matrix
 
-  static Matrix Bmembrane(3, 2);       // membrane B matrix
+  static thread_local Matrix Bmembrane(3, 2);       // membrane B matrix
   OPS_STATIC double BdrillJ[ndf];      // drill B matrix
   OPS_STATIC double BdrillK[ndf];
   //-------------------------------------------------------
@@ -1177,7 +1177,7 @@ void ShellMITC4::formResidAndTangent(int tang_flag)
     const int massIndex   = nShape - 1;
     double temp, rhoH;
     // If defined, apply self-weight
-    static Vector momentum(ndf);
+    static thread_local Vector momentum(ndf);
     double ddvol = 0;
 
     for (int i = 0; i < nip; i++) {
@@ -1414,11 +1414,11 @@ ShellMITC4::assembleB(const Matrix &Bmembrane,
   //
   //-------------------------------------------------------------
   //
-  static Matrix BmembraneShell(3, 3);
-  static Matrix BbendShell(3, 3);
-  static Matrix BshearShell(2, 6);
-  static Matrix Gmem(2, 3);
-  static Matrix Gshear(3, 6);
+  static thread_local Matrix BmembraneShell(3, 3);
+  static thread_local Matrix BbendShell(3, 3);
+  static thread_local Matrix BshearShell(2, 6);
+  static thread_local Matrix Gmem(2, 3);
+  static thread_local Matrix Gshear(3, 6);
 
   // shell modified membrane terms
 
@@ -1501,7 +1501,7 @@ ShellMITC4::computeBmembrane(int node, const double shp[3][4])
   //  three(3) strains and two(2) displacements (for plate)
   //-------------------------------------------------------------------
 
-  static Matrix Bmembrane(3, 2);
+  static thread_local Matrix Bmembrane(3, 2);
 
   Bmembrane.Zero();
 
@@ -1530,7 +1530,7 @@ ShellMITC4::computeBbend(int node, const double shp[3][4])
 //
 //  three(3) curvatures and two(2) rotations (for plate)
 //----------------------------------------------------------------
-  static Matrix Bbend(3, 2);
+  static thread_local Matrix Bbend(3, 2);
   Bbend.Zero();
 
   Bbend(0, 1) = -shp[0][node];
@@ -1606,7 +1606,7 @@ ShellMITC4::sendSelf(int commitTag, Channel &theChannel)
   // Now send the ids of materials
   int matDbTag;
 
-  static ID idData(14);
+  static thread_local ID idData(14);
 
   for (int i = 0; i < 4; i++) {
     idData(i) = materialPointers[i]->getClassTag();
@@ -1638,7 +1638,7 @@ ShellMITC4::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vectData(5 + 6 * 4);
+  static thread_local Vector vectData(5 + 6 * 4);
   vectData(0) = Ktt;
   vectData(1) = alphaM;
   vectData(2) = betaK;
@@ -1680,7 +1680,7 @@ int ShellMITC4::recvSelf(int commitTag, Channel &theChannel,
 
   int dataTag = this->getDbTag();
 
-  static ID idData(14);
+  static thread_local ID idData(14);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1699,7 +1699,7 @@ int ShellMITC4::recvSelf(int commitTag, Channel &theChannel,
   else
     doUpdateBasis = false;
 
-  static Vector vectData(5 + 6 * 4);
+  static thread_local Vector vectData(5 + 6 * 4);
   res += theChannel.recvVector(dataTag, commitTag, vectData);
   if (res < 0) {
     opserr << "WARNING ShellMITC4::sendSelf() - " << this->getTag()
@@ -104,6 +104,7 @@ class ShellMITC4 : public    Element,
     
     //get residual with inertia terms
     const Vector &getResistingForceIncInertia( ) ;
+    bool hasOnlyRayleighDamping() const {return true;}
 
     // public methods for element output
     int sendSelf ( int commitTag, Channel &theChannel );
@@ -123,10 +124,10 @@ class ShellMITC4 : public    Element,
     static const int NEN = 4;
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damping ;
 
     //node information
     ID connectedExternalNodes ;            // node tags
@@ -55,9 +55,9 @@
 using namespace OpenSees;
 
 // static data
-Matrix ShellMITC4Thermal::stiff(24, 24);
-Vector ShellMITC4Thermal::resid(24);
-Matrix ShellMITC4Thermal::mass(24, 24);
+thread_local Matrix ShellMITC4Thermal::stiff(24, 24);
+thread_local Vector ShellMITC4Thermal::resid(24);
+thread_local Matrix ShellMITC4Thermal::mass(24, 24);
 
 //quadrature data
 const double ShellMITC4Thermal::root3          = sqrt(3.0);
@@ -433,8 +433,8 @@ Response *ShellMITC4Thermal::setResponse(const char **argv, int argc,
 int ShellMITC4Thermal::getResponse(int responseID, Information &eleInfo)
 {
   int cnt = 0;
-  static Vector stresses(32);
-  static Vector strains(32);
+  static thread_local Vector stresses(32);
+  static thread_local Vector strains(32);
 
   switch (responseID) {
   case 1: // global forces
@@ -520,43 +520,43 @@ const Matrix &ShellMITC4Thermal::getInitialStiff()
 
   static double xsj; // determinant jacaobian matrix
 
-  static double dvol[ngauss]; //volume element
+  static thread_local double dvol[ngauss]; //volume element
 
-  static double shp[3][numnodes]; //shape functions at a gauss point
+  static thread_local double shp[3][numnodes]; //shape functions at a gauss point
 
   //  static double Shape[3][numnodes][ngauss] ; //all the shape functions
 
-  static Matrix stiffJK(ndf, ndf); //nodeJK stiffness
+  static thread_local Matrix stiffJK(ndf, ndf); //nodeJK stiffness
 
-  static Matrix dd(nstress, nstress); //material tangent
+  static thread_local Matrix dd(nstress, nstress); //material tangent
 
-  static Matrix J0(2, 2); //Jacobian at center
+  static thread_local Matrix J0(2, 2); //Jacobian at center
 
-  static Matrix J0inv(2, 2); //inverse of Jacobian at center
+  static thread_local Matrix J0inv(2, 2); //inverse of Jacobian at center
 
   //---------B-matrices------------------------------------
 
-  static Matrix BJ(nstress, ndf); // B matrix node J
+  static thread_local Matrix BJ(nstress, ndf); // B matrix node J
 
-  static Matrix BJtran(ndf, nstress);
+  static thread_local Matrix BJtran(ndf, nstress);
 
-  static Matrix BK(nstress, ndf); // B matrix node k
+  static thread_local Matrix BK(nstress, ndf); // B matrix node k
 
-  static Matrix BJtranD(ndf, nstress);
+  static thread_local Matrix BJtranD(ndf, nstress);
 
-  static Matrix Bbend(3, 3); // bending B matrix
+  static thread_local Matrix Bbend(3, 3); // bending B matrix
 
-  static Matrix Bshear(2, 3); // shear B matrix
+  static thread_local Matrix Bshear(2, 3); // shear B matrix
 
-  static Matrix Bmembrane(3, 2); // membrane B matrix
+  static thread_local Matrix Bmembrane(3, 2); // membrane B matrix
 
-  static double BdrillJ[ndf]; //drill B matrix
+  static thread_local double BdrillJ[ndf]; //drill B matrix
 
-  static double BdrillK[ndf];
+  static thread_local double BdrillK[ndf];
 
   double *drillPointer;
 
-  static double saveB[nstress][ndf][numnodes];
+  static thread_local double saveB[nstress][ndf][numnodes];
 
   //-------------------------------------------------------
 
@@ -999,7 +999,7 @@ int ShellMITC4Thermal::addLoad(ElementalLoad *theLoad, double loadFactor)
 int ShellMITC4Thermal::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int tangFlag = 1;
-  static Vector r(24);
+  static thread_local Vector r(24);
 
   int i;
 
@@ -1056,7 +1056,7 @@ const Vector &ShellMITC4Thermal::getResistingForce()
 //get residual with inertia terms
 const Vector &ShellMITC4Thermal::getResistingForceIncInertia()
 {
-  static Vector res(24);
+  static thread_local Vector res(24);
   int tang_flag = 0; //don't get the tangent
 
   //do tangent and residual here
@@ -1099,9 +1099,9 @@ void ShellMITC4Thermal::formInertiaTerms(int tangFlag)
 
   double dvol; //volume element
 
-  static double shp[nShape][numberNodes]; //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes]; //shape functions at a gauss point
 
-  static Vector momentum(ndf);
+  static thread_local Vector momentum(ndf);
 
   int i, j, k, p;
   int jj, kk;
@@ -1224,25 +1224,25 @@ int ShellMITC4Thermal::formResidAndTangent(int tang_flag)
 
   static double xsj; // determinant jacaobian matrix
 
-  static double dvol[ngauss]; //volume element
+  static thread_local double dvol[ngauss]; //volume element
 
-  static Vector strain(nstress); //strain
+  static thread_local Vector strain(nstress); //strain
 
-  static double shp[3][numnodes]; //shape functions at a gauss point
+  static thread_local double shp[3][numnodes]; //shape functions at a gauss point
 
   //  static double Shape[3][numnodes][ngauss] ; //all the shape functions
 
-  static Vector residJ(ndf); //nodeJ residual
+  static thread_local Vector residJ(ndf); //nodeJ residual
 
-  static Matrix stiffJK(ndf, ndf); //nodeJK stiffness
+  static thread_local Matrix stiffJK(ndf, ndf); //nodeJK stiffness
 
-  static Vector stress(nstress); //stress resultants
+  static thread_local Vector stress(nstress); //stress resultants
 
-  static Matrix dd(nstress, nstress); //material tangent
+  static thread_local Matrix dd(nstress, nstress); //material tangent
 
-  static Matrix J0(2, 2); //Jacobian at center
+  static thread_local Matrix J0(2, 2); //Jacobian at center
 
-  static Matrix J0inv(2, 2); //inverse of Jacobian at center
+  static thread_local Matrix J0inv(2, 2); //inverse of Jacobian at center
 
   double epsDrill = 0.0; //drilling "strain"
 
@@ -1250,27 +1250,27 @@ int ShellMITC4Thermal::formResidAndTangent(int tang_flag)
 
   //---------B-matrices------------------------------------
 
-  static Matrix BJ(nstress, ndf); // B matrix node J
+  static thread_local Matrix BJ(nstress, ndf); // B matrix node J
 
-  static Matrix BJtran(ndf, nstress);
+  static thread_local Matrix BJtran(ndf, nstress);
 
-  static Matrix BK(nstress, ndf); // B matrix node k
+  static thread_local Matrix BK(nstress, ndf); // B matrix node k
 
-  static Matrix BJtranD(ndf, nstress);
+  static thread_local Matrix BJtranD(ndf, nstress);
 
-  static Matrix Bbend(3, 3); // bending B matrix
+  static thread_local Matrix Bbend(3, 3); // bending B matrix
 
-  static Matrix Bshear(2, 3); // shear B matrix
+  static thread_local Matrix Bshear(2, 3); // shear B matrix
 
-  static Matrix Bmembrane(3, 2); // membrane B matrix
+  static thread_local Matrix Bmembrane(3, 2); // membrane B matrix
 
-  static double BdrillJ[ndf]; //drill B matrix
+  static thread_local double BdrillJ[ndf]; //drill B matrix
 
-  static double BdrillK[ndf];
+  static thread_local double BdrillK[ndf];
 
   double *drillPointer;
 
-  static double saveB[nstress][ndf][numnodes];
+  static thread_local double saveB[nstress][ndf][numnodes];
 
   //-------------------------------------------------------
 
@@ -1564,11 +1564,11 @@ void ShellMITC4Thermal::computeBasis()
   //and use those as basis vectors but this is easier
   //and the shell is flat anyway.
 
-  static Vector temp(3);
+  static thread_local Vector temp(3);
 
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector v3(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector v3(3);
 
   //get two vectors (v1, v2) in plane of shell by
   // nodal coordinate differences
@@ -1647,11 +1647,11 @@ void ShellMITC4Thermal::updateBasis()
   //and use those as basis vectors but this is easier
   //and the shell is flat anyway.
 
-  static Vector temp(3);
+  static thread_local Vector temp(3);
 
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector v3(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector v3(3);
 
   //get two vectors (v1, v2) in plane of shell by
   // nodal coordinate differences
@@ -1731,7 +1731,7 @@ double *ShellMITC4Thermal::computeBdrill(int node, const double shp[3][4])
 {
 
   //static Matrix Bdrill(1,6) ;
-  static double Bdrill[6];
+  static thread_local double Bdrill[6];
   static double B1;
   static double B2;
   static double B6;
@@ -1783,17 +1783,17 @@ const Matrix &ShellMITC4Thermal::assembleB(const Matrix &Bmembrane,
 
   //Matrix Bmembrane(3,2) ; // plate membrane B matrix
 
-  static Matrix B(8, 6);
+  static thread_local Matrix B(8, 6);
 
-  static Matrix BmembraneShell(3, 3);
+  static thread_local Matrix BmembraneShell(3, 3);
 
-  static Matrix BbendShell(3, 3);
+  static thread_local Matrix BbendShell(3, 3);
 
-  static Matrix BshearShell(2, 6);
+  static thread_local Matrix BshearShell(2, 6);
 
-  static Matrix Gmem(2, 3);
+  static thread_local Matrix Gmem(2, 3);
 
-  static Matrix Gshear(3, 6);
+  static thread_local Matrix Gshear(3, 6);
 
   //
   // For Shell :
@@ -1888,7 +1888,7 @@ const Matrix &ShellMITC4Thermal::computeBmembrane(int node,
                                                   const double shp[3][4])
 {
 
-  static Matrix Bmembrane(3, 2);
+  static thread_local Matrix Bmembrane(3, 2);
 
   //---Bmembrane Matrix in standard {1,2,3} mechanics notation---------
   //
@@ -1917,7 +1917,7 @@ const Matrix &ShellMITC4Thermal::computeBmembrane(int node,
 const Matrix &ShellMITC4Thermal::computeBbend(int node, const double shp[3][4])
 {
 
-  static Matrix Bbend(3, 2);
+  static thread_local Matrix Bbend(3, 2);
 
   //---Bbend Matrix in standard {1,2,3} mechanics notation---------
   //
@@ -1955,8 +1955,8 @@ void ShellMITC4Thermal::shape2d(double ss, double tt, const double x[2][4],
   static const double s[] = {-0.5, 0.5, 0.5, -0.5};
   static const double t[] = {-0.5, -0.5, 0.5, 0.5};
 
-  static double xs[2][2];
-  static double sx[2][2];
+  static thread_local double xs[2][2];
+  static thread_local double sx[2][2];
 
   for (i = 0; i < 4; i++) {
     shp[2][i] = (0.5 + s[i] * ss) * (0.5 + t[i] * tt);
@@ -2034,7 +2034,7 @@ int ShellMITC4Thermal::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(13);
+  static thread_local ID idData(13);
 
   int i;
   for (i = 0; i < 4; i++) {
@@ -2063,7 +2063,7 @@ int ShellMITC4Thermal::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vectData(5);
+  static thread_local Vector vectData(5);
   vectData(0) = Ktt;
   vectData(1) = alphaM;
   vectData(2) = betaK;
@@ -2097,7 +2097,7 @@ int ShellMITC4Thermal::recvSelf(int commitTag, Channel &theChannel,
 
   int dataTag = this->getDbTag();
 
-  static ID idData(13);
+  static thread_local ID idData(13);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -2112,7 +2112,7 @@ int ShellMITC4Thermal::recvSelf(int commitTag, Channel &theChannel,
   connectedExternalNodes(2) = idData(11);
   connectedExternalNodes(3) = idData(12);
 
-  static Vector vectData(5);
+  static thread_local Vector vectData(5);
   res += theChannel.recvVector(dataTag, commitTag, vectData);
   if (res < 0) {
     opserr << "WARNING ShellMITC4Thermal::sendSelf() - " << this->getTag()
@@ -2185,17 +2185,17 @@ int ShellMITC4Thermal::displaySelf(Renderer &theViewer, int displayMode,
                                    float fact, const char **modes, int numMode)
 {
   // get the end point display coords
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector v3(3);
-  static Vector v4(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector v3(3);
+  static thread_local Vector v4(3);
   nodePointers[0]->getDisplayCrds(v1, fact, displayMode);
   nodePointers[1]->getDisplayCrds(v2, fact, displayMode);
   nodePointers[2]->getDisplayCrds(v3, fact, displayMode);
   nodePointers[3]->getDisplayCrds(v4, fact, displayMode);
 
   // place values in coords matrix
-  static Matrix coords(4, 3);
+  static thread_local Matrix coords(4, 3);
   for (int i = 0; i < 3; i++) {
     coords(0, i) = v1(i);
     coords(1, i) = v2(i);
@@ -2206,7 +2206,7 @@ int ShellMITC4Thermal::displaySelf(Renderer &theViewer, int displayMode,
   // Display mode is positive:
   // display mode = 0 -> plot no contour
   // display mode = 1-8 -> plot 1-8 stress resultant
-  static Vector values(4);
+  static thread_local Vector values(4);
   if (displayMode < 8 && displayMode > 0) {
     for (int i = 0; i < 4; i++) {
       const Vector &stress = materialPointers[i]->getStressResultant();
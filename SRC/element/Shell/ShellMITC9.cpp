@@ -45,9 +45,9 @@
 using namespace OpenSees;
 
 // static data
-Matrix ShellMITC9::stiff(54, 54);
-Vector ShellMITC9::resid(54);
-Matrix ShellMITC9::mass(54, 54);
+thread_local Matrix ShellMITC9::stiff(54, 54);
+thread_local Vector ShellMITC9::resid(54);
+thread_local Matrix ShellMITC9::mass(54, 54);
 
 // quadrature data
 const double ShellMITC9::root3            = sqrt(3.0);
@@ -433,8 +433,8 @@ int ShellMITC9::getResponse(int responseID, Information &eleInfo)
 {
   int i;
   int cnt = 0;
-  static Vector stresses(84);
-  static Vector strains(84);
+  static thread_local Vector stresses(84);
+  static thread_local Vector strains(84);
 
   switch (responseID) {
   case 1: // global forces
@@ -510,9 +510,9 @@ const Matrix &ShellMITC9::getInitialStiff()
   /* static */ double dvol[nip];      // volume element
   /* static */ double shp[3][NEN];  // shape functions at a gauss point
 
-  static Matrix stiffJK(NDF, NDF); // nodeJK stiffness
+  static thread_local Matrix stiffJK(NDF, NDF); // nodeJK stiffness
 
-  static Matrix dd(nstress, nstress); // material tangent
+  static thread_local Matrix dd(nstress, nstress); // material tangent
 
   // static Matrix J0(2,2) ;  //Jacobian at center
 
@@ -520,20 +520,20 @@ const Matrix &ShellMITC9::getInitialStiff()
 
   //---------B-matrices------------------------------------
 
-  static Matrix BJ(nstress, NDF);     // B matrix node J
-  static Matrix BJtran(NDF, nstress);
-  static Matrix BK(nstress, NDF);     // B matrix node k
-  static Matrix BJtranD(NDF, nstress);
-  static Matrix Bbend(3, 3);          // bending B matrix
-  static Matrix Bshear(2, 3);         // shear B matrix
-  static Matrix Bmembrane(3, 2); // membrane B matrix
+  static thread_local Matrix BJ(nstress, NDF);     // B matrix node J
+  static thread_local Matrix BJtran(NDF, nstress);
+  static thread_local Matrix BK(nstress, NDF);     // B matrix node k
+  static thread_local Matrix BJtranD(NDF, nstress);
+  static thread_local Matrix Bbend(3, 3);          // bending B matrix
+  static thread_local Matrix Bshear(2, 3);         // shear B matrix
+  static thread_local Matrix Bmembrane(3, 2); // membrane B matrix
                                  //
   double BdrillJ[NDF]; // drill B matrix
   double BdrillK[NDF];
 
   double *drillPointer;
 
-  static double saveB[nstress][NDF][NEN];
+  static thread_local double saveB[nstress][NDF][NEN];
 
   //-------------------------------------------------------
 
@@ -685,7 +685,7 @@ int ShellMITC9::addLoad(ElementalLoad *theLoad, double loadFactor)
 
 int ShellMITC9::addInertiaLoadToUnbalance(const Vector &accel)
 {
-  static Vector r(54);
+  static thread_local Vector r(54);
   int tangFlag = 1;
 
   int i;
@@ -732,7 +732,7 @@ const Vector &ShellMITC9::getResistingForce()
 // get residual with inertia terms
 const Vector &ShellMITC9::getResistingForceIncInertia()
 {
-  static Vector res(54);
+  static thread_local Vector res(54);
   int tang_flag = 0; // don't get the tangent
 
   // do tangent and residual here
@@ -774,9 +774,9 @@ void ShellMITC9::formInertiaTerms(int tangFlag)
 
   double dvol; // volume element
 
-  static double shp[nShape][numberNodes]; // shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes]; // shape functions at a gauss point
 
-  static Vector momentum(NDF);
+  static thread_local Vector momentum(NDF);
 
   int i, j, k, p;
   int jj, kk;
@@ -890,29 +890,29 @@ void ShellMITC9::formResidAndTangent(int tang_flag)
   OPS_STATIC double dvol[nip]; // volume element
   OPS_STATIC double shp[3][NEN]; // shape functions at a gauss point
                                   //
-  static Vector residJ(NDF); // nodeJ residual
-  static Matrix stiffJK(NDF, NDF); // nodeJK stiffness
+  static thread_local Vector residJ(NDF); // nodeJ residual
+  static thread_local Matrix stiffJK(NDF, NDF); // nodeJK stiffness
   OPS_STATIC Vector strain(nstress); // strain
   OPS_STATIC Vector stress(nstress); // stress resultants
-  static Matrix dd(nstress, nstress); // material tangent
+  static thread_local Matrix dd(nstress, nstress); // material tangent
 
   double epsDrill = 0.0; // drilling "strain"
   double tauDrill = 0.0; // drilling "stress"
 
   //---------B-matrices------------------------------------
-  static Matrix BJ(nstress, NDF);      // B matrix node J
-  static Matrix BJtran(NDF, nstress);
-  static Matrix BK(nstress, NDF);      // B matrix node k
-  static Matrix BJtranD(NDF, nstress);
-  static Matrix Bbend(3, 3);           // bending B matrix
-  static Matrix Bshear(2, 3);          // shear B matrix
-  static Matrix Bmembrane(3, 2);       // membrane B matrix
-  static double BdrillJ[NDF];          // drill B matrix
-  static double BdrillK[NDF];
+  static thread_local Matrix BJ(nstress, NDF);      // B matrix node J
+  static thread_local Matrix BJtran(NDF, nstress);
+  static thread_local Matrix BK(nstress, NDF);      // B matrix node k
+  static thread_local Matrix BJtranD(NDF, nstress);
+  static thread_local Matrix Bbend(3, 3);           // bending B matrix
+  static thread_local Matrix Bshear(2, 3);          // shear B matrix
+  static thread_local Matrix Bmembrane(3, 2);       // membrane B matrix
+  static thread_local double BdrillJ[NDF];          // drill B matrix
+  static thread_local double BdrillK[NDF];
   //-------------------------------------------------------
 
   double *drillPointer;
-  static double saveB[nstress][NDF][NEN];
+  static thread_local double saveB[nstress][NDF][NEN];
 
   //-------------------------------------------------------
 
@@ -1088,7 +1088,7 @@ void ShellMITC9::computeBasis()
   // and use those as basis vectors but this is easier
   // and the shell is flat anyway.
 
-  static Vector temp(3);
+  static thread_local Vector temp(3);
 
   // get two vectors (v1, v2) in plane of shell by
   // nodal coordinate differences
@@ -1150,7 +1150,7 @@ void ShellMITC9::computeBasis()
 // compute Bdrill
 double *ShellMITC9::computeBdrill(int node, const double shp[3][9])
 {
-  static double Bdrill[6];
+  static thread_local double Bdrill[6];
   static double B1;
   static double B2;
   static double B6;
@@ -1185,12 +1185,12 @@ const Matrix &ShellMITC9::assembleB(const Matrix &Bmembrane,
   //Matrix Bshear(2,3) ; // plate shear B matrix
   //Matrix Bmembrane(3,2) ; // plate membrane B matrix
 
-  static Matrix B(8, 6);
-  static Matrix BmembraneShell(3, 3);
-  static Matrix BbendShell(3, 3);
-  static Matrix BshearShell(2, 6);
-  static Matrix Gmem(2, 3);
-  static Matrix Gshear(3, 6);
+  static thread_local Matrix B(8, 6);
+  static thread_local Matrix BmembraneShell(3, 3);
+  static thread_local Matrix BbendShell(3, 3);
+  static thread_local Matrix BshearShell(2, 6);
+  static thread_local Matrix Gmem(2, 3);
+  static thread_local Matrix Gshear(3, 6);
   int p, q;
   int pp;
 
@@ -1274,7 +1274,7 @@ const Matrix &ShellMITC9::assembleB(const Matrix &Bmembrane,
 // compute Bmembrane matrix
 const Matrix &ShellMITC9::computeBmembrane(int node, const double shp[3][9])
 {
-  static Matrix Bmembrane(3, 2);
+  static thread_local Matrix Bmembrane(3, 2);
 
   //---Bmembrane Matrix in standard {1,2,3} mechanics notation---------
   //                -             -
@@ -1299,7 +1299,7 @@ const Matrix &ShellMITC9::computeBmembrane(int node, const double shp[3][9])
 // compute Bbend matrix
 const Matrix &ShellMITC9::computeBbend(int node, const double shp[3][9])
 {
-  static Matrix Bbend(3, 2);
+  static thread_local Matrix Bbend(3, 2);
 
   //---Bbend Matrix in standard {1,2,3} mechanics notation---------
   //            -             -
@@ -1324,7 +1324,7 @@ const Matrix &ShellMITC9::computeBbend(int node, const double shp[3][9])
 // compute standard Bshear matrix
 const Matrix &ShellMITC9::computeBshear(int node, const double shp[3][9])
 {
-  static Matrix Bshear(2, 3);
+  static thread_local Matrix Bshear(2, 3);
 
   //---Bshear Matrix in standard {1,2,3} mechanics notation------
   //             -                -
@@ -1353,8 +1353,8 @@ void ShellMITC9::shape2d(double ss, double tt, const double x[2][9],
   double temp;
   static const double s[] = {-0.5, 0.5, 0.5, -0.5};
   static const double t[] = {-0.5, -0.5, 0.5, 0.5};
-  static double xs[2][2];
-  static double sx[2][2];
+  static thread_local double xs[2][2];
+  static thread_local double sx[2][2];
 
   for (int i = 0; i < 4; i++) {
     shp[2][i] = (0.5 + s[i] * ss) * (0.5 + t[i] * tt);
@@ -1434,7 +1434,7 @@ int ShellMITC9::sendSelf(int commitTag, Channel &theChannel)
   int dataTag = this->getDbTag();
   // Now quad sends the ids of its materials
   int matDbTag;
-  static ID idData(28);
+  static thread_local ID idData(28);
   int i;
 
   for (i = 0; i < nip; i++) {
@@ -1467,7 +1467,7 @@ int ShellMITC9::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vectData(5);
+  static thread_local Vector vectData(5);
   vectData(0) = Ktt;
   vectData(1) = alphaM;
   vectData(2) = betaK;
@@ -1498,7 +1498,7 @@ int ShellMITC9::recvSelf(int commitTag, Channel &theChannel,
 {
   int res     = 0;
   int dataTag = this->getDbTag();
-  static ID idData(28);
+  static thread_local ID idData(28);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -1517,7 +1517,7 @@ int ShellMITC9::recvSelf(int commitTag, Channel &theChannel,
   connectedExternalNodes(6) = idData(25);
   connectedExternalNodes(7) = idData(26);
   connectedExternalNodes(8) = idData(27);
-  static Vector vectData(5);
+  static thread_local Vector vectData(5);
   res += theChannel.recvVector(dataTag, commitTag, vectData);
   if (res < 0) {
     opserr << "WARNING ShellMITC9::sendSelf() - " << this->getTag()
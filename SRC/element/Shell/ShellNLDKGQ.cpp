@@ -50,9 +50,9 @@
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
 //static data
-Matrix ShellNLDKGQ::stiff(24, 24);
-Vector ShellNLDKGQ::resid(24);
-Matrix ShellNLDKGQ::mass(24, 24);
+thread_local Matrix ShellNLDKGQ::stiff(24, 24);
+thread_local Vector ShellNLDKGQ::resid(24);
+thread_local Matrix ShellNLDKGQ::mass(24, 24);
 
 //quadrature data
 // const double ShellNLDKGQ::root3          = sqrt(3.0);
@@ -410,8 +410,8 @@ int ShellNLDKGQ::getResponse(int responseID, Information &eleInfo)
 {
   int cnt = 0;
 
-  static Vector stresses(32);
-  static Vector strains(32);
+  static thread_local Vector stresses(32);
+  static thread_local Vector strains(32);
 
   switch (responseID) {
   case 1: // global forces
@@ -498,66 +498,66 @@ const Matrix &ShellNLDKGQ::getInitialStiff()
 
   static double xsj; //determinant jacobian matrix
 
-  static double dvol[ngauss]; //volume element
+  static thread_local double dvol[ngauss]; //volume element
 
   //add for geometric nonlinearity
-  static Vector incrDisp(ndf); //total displamcement
+  static thread_local Vector incrDisp(ndf); //total displamcement
 
-  static Vector Cstrain(
+  static thread_local Vector Cstrain(
       nstress); //commit strain last step/ add for geometric nonlinearity
 
-  static Vector strain(nstress); //strain
+  static thread_local Vector strain(nstress); //strain
   //add for geometric nonlinearity
-  static Vector dstrain(nstress);    //total strain increment
-  static Vector dstrain_li(nstress); //linear incr strain
-  static Vector dstrain_nl(3);       //geometric nonlinear strain
+  static thread_local Vector dstrain(nstress);    //total strain increment
+  static thread_local Vector dstrain_li(nstress); //linear incr strain
+  static thread_local Vector dstrain_nl(3);       //geometric nonlinear strain
 
-  static double shp[3][numnodes]; //shape function 2d at a gauss point
+  static thread_local double shp[3][numnodes]; //shape function 2d at a gauss point
 
   static double
       shpDrill[4][numnodes]; //shape function drilling dof at a gauss point
 
-  static double shpBend[6][12]; //shape function - bending part at a gauss point
+  static thread_local double shpBend[6][12]; //shape function - bending part at a gauss point
 
   //static Vector residJ(ndf); //nodeJ residual, global coordinates
 
-  static Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
+  static thread_local Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
 
   //static Vector residJlocal(ndf); //nodeJ residual, local coordinates
 
-  static Matrix stiffJKlinear(ndf, ndf); //nodeJK stiffness,for linear part
+  static thread_local Matrix stiffJKlinear(ndf, ndf); //nodeJK stiffness,for linear part
 
-  static Matrix stiffJKgeo(3, 3); //nodeJK stiffness,for geometric nonlinearity
+  static thread_local Matrix stiffJKgeo(3, 3); //nodeJK stiffness,for geometric nonlinearity
 
-  static Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
+  static thread_local Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
 
-  static Matrix stiffJK1(ndf, ndf);
+  static thread_local Matrix stiffJK1(ndf, ndf);
 
-  static Matrix stiffJK2(ndf, ndf);
+  static thread_local Matrix stiffJK2(ndf, ndf);
 
-  static Matrix stiffJK3(ndf, ndf);
+  static thread_local Matrix stiffJK3(ndf, ndf);
 
   //static Vector residJ1(ndf);
 
-  static Vector stress(nstress); //stress resultants
+  static thread_local Vector stress(nstress); //stress resultants
   //static Vector dstress(nstress); //add for geometric nonlinearity
 
-  static Matrix dd(nstress, nstress); //material tangent
+  static thread_local Matrix dd(nstress, nstress); //material tangent
 
   //static Matrix J0(2,2); //Jacobian at center
 
   //static Matrix J0inv(2,2); //inverse of Jacobian at center
-  static double sx[2][2];
+  static thread_local double sx[2][2];
 
   //add for geometric nonlinearity
-  static Vector dispIncLocal(6); //incr disp in local coordinates
-  static Vector dispIncLocalBend(
+  static thread_local Vector dispIncLocal(6); //incr disp in local coordinates
+  static thread_local Vector dispIncLocalBend(
       3); //incr disp of bending part in local coordinates
 
   //eleForce & eleForceLast: gauss stress
-  static Vector stressLast_gauss(8); //eleForceLast
+  static thread_local Vector stressLast_gauss(8); //eleForceLast
   //static Vector stressNew_gauss(8);  //eleForce
-  static Matrix membraneForce(2, 2); //membrane force in gauss point
+  static thread_local Matrix membraneForce(2, 2); //membrane force in gauss point
   Matrix Tmat(6, 6); //local-global coordinates transform matrix
   Matrix TmatTran(6, 6);
   Matrix Pmat(6, 6); //transform dofs order
@@ -565,24 +565,24 @@ const Matrix &ShellNLDKGQ::getInitialStiff()
 
   //-------------------B-matrices---------------------------------
 
-  static Matrix BJ(nstress, ndf); // B matrix node J
-  static Matrix BJtran(ndf, nstress);
-  static Matrix BK(nstress, ndf); // B matrix node K
-  static Matrix BJtranD(ndf, nstress); //BJtran * dd
-  static Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
+  static thread_local Matrix BJ(nstress, ndf); // B matrix node J
+  static thread_local Matrix BJtran(ndf, nstress);
+  static thread_local Matrix BK(nstress, ndf); // B matrix node K
+  static thread_local Matrix BJtranD(ndf, nstress); //BJtran * dd
+  static thread_local Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
   //static Matrix BJPT(nstress,ndf); //BJP * Tmat, from global coordinates to local coordinates
 
-  static Matrix Bmembrane(3, 3); //membrane B matrix
-  static Matrix Bbend(3, 3); //bending B matrix
-  static Matrix Bshear(2, 3); //shear B matrix (zero)
-  static double saveB[nstress][ndf][numnodes];
+  static thread_local Matrix Bmembrane(3, 3); //membrane B matrix
+  static thread_local Matrix Bbend(3, 3); //bending B matrix
+  static thread_local Matrix Bshear(2, 3); //shear B matrix (zero)
+  static thread_local double saveB[nstress][ndf][numnodes];
 
   //Added for geometric nonlinearity
   //BG
-  static Matrix BGJ(2, 3);
-  static Matrix BGJtran(3, 2);
-  static Matrix stiffBGM(3, 2); // BGJtran * membraneForce
-  static Matrix BGK(2, 3);
+  static thread_local Matrix BGJ(2, 3);
+  static thread_local Matrix BGJtran(3, 2);
+  static thread_local Matrix stiffBGM(3, 2); // BGJtran * membraneForce
+  static thread_local Matrix BGK(2, 3);
   //---------------------------------------------------------------
 
   //zero stiffness and residual
@@ -892,7 +892,7 @@ int ShellNLDKGQ::addLoad(ElementalLoad *theLoad, double loadFactor)
 int ShellNLDKGQ::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int tangFlag = 1;
-  static Vector r(24);
+  static thread_local Vector r(24);
 
   int i;
 
@@ -939,7 +939,7 @@ const Vector &ShellNLDKGQ::getResistingForce()
 //get residual with inertia terms
 const Vector &ShellNLDKGQ::getResistingForceIncInertia()
 {
-  static Vector res(24);
+  static thread_local Vector res(24);
   int tang_flag = 0; //don't get the tangent
 
   //do tangent and residual here
@@ -984,9 +984,9 @@ void ShellNLDKGQ::formInertiaTerms(int tangFlag)
 
   double dvol; //volume element
 
-  static double shp[nShape][numberNodes]; //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes]; //shape functions at a gauss point
 
-  static Vector momentum(ndf);
+  static thread_local Vector momentum(ndf);
 
   int i, j, k, p;
   int jj, kk;
@@ -1113,65 +1113,65 @@ void ShellNLDKGQ::formResidAndTangent(int tang_flag)
 
   static double xsj; //determinant jacobian matrix
 
-  static double dvol[ngauss]; //volume element
+  static thread_local double dvol[ngauss]; //volume element
 
   //add for geometric nonlinearity
-  static Vector incrDisp(ndf); //total displacement
+  static thread_local Vector incrDisp(ndf); //total displacement
 
-  static Vector Cstrain(
+  static thread_local Vector Cstrain(
       nstress); //commit strain last step/ add for geometric nonlinearity
 
-  static Vector strain(nstress); //strain
+  static thread_local Vector strain(nstress); //strain
   //add for geometric nonlinearity
-  static Vector dstrain(nstress);    //total strain increment
-  static Vector dstrain_li(nstress); //linear incr strain
-  static Vector dstrain_nl(3);       //geometric nonlinear strain
+  static thread_local Vector dstrain(nstress);    //total strain increment
+  static thread_local Vector dstrain_li(nstress); //linear incr strain
+  static thread_local Vector dstrain_nl(3);       //geometric nonlinear strain
 
-  static double shp[3][numnodes]; //shape function 2d at a gauss point
+  static thread_local double shp[3][numnodes]; //shape function 2d at a gauss point
 
   static double
       shpDrill[4][numnodes]; //shape function drilling dof at a gauss point
 
-  static double shpBend[6][12]; //shape function - bending part at a gauss point
+  static thread_local double shpBend[6][12]; //shape function - bending part at a gauss point
 
-  static Vector residJ(ndf); //nodeJ residual, global coordinates
+  static thread_local Vector residJ(ndf); //nodeJ residual, global coordinates
 
-  static Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
+  static thread_local Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
 
-  static Vector residJlocal(ndf); //nodeJ residual, local coordinates
+  static thread_local Vector residJlocal(ndf); //nodeJ residual, local coordinates
 
-  static Matrix stiffJKlinear(ndf, ndf); //nodeJK stiffness,for linear part
+  static thread_local Matrix stiffJKlinear(ndf, ndf); //nodeJK stiffness,for linear part
 
-  static Matrix stiffJKgeo(3, 3); //nodeJK stiffness,for geometric nonlinearity
+  static thread_local Matrix stiffJKgeo(3, 3); //nodeJK stiffness,for geometric nonlinearity
 
-  static Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
+  static thread_local Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
 
-  static Matrix stiffJK1(ndf, ndf);
+  static thread_local Matrix stiffJK1(ndf, ndf);
 
-  static Matrix stiffJK2(ndf, ndf);
+  static thread_local Matrix stiffJK2(ndf, ndf);
 
-  static Matrix stiffJK3(ndf, ndf);
+  static thread_local Matrix stiffJK3(ndf, ndf);
 
-  static Vector residJ1(ndf);
+  static thread_local Vector residJ1(ndf);
 
-  static Vector stress(nstress); //stress resultants
-  static Vector Cstress(nstress);
+  static thread_local Vector stress(nstress); //stress resultants
+  static thread_local Vector Cstress(nstress);
   //static Vector dstress(nstress); //add for geometric nonlinearity
 
-  static Matrix dd(nstress, nstress); //material tangent
+  static thread_local Matrix dd(nstress, nstress); //material tangent
 
   //static Matrix J0(2,2); //Jacobian at center
 
   //static Matrix J0inv(2,2); //inverse of Jacobian at center
-  static double sx[2][2];
+  static thread_local double sx[2][2];
 
   //add for geometric nonlinearity
-  static Vector dispIncLocal(6); //incr disp in local coordinates
-  static Vector dispIncLocalBend(
+  static thread_local Vector dispIncLocal(6); //incr disp in local coordinates
+  static thread_local Vector dispIncLocalBend(
       3); //incr disp of bending part in local coordinates
 
   //eleForce & eleForceLast: gauss stress
-  static Matrix membraneForce(2, 2); //membrane force in gauss point
+  static thread_local Matrix membraneForce(2, 2); //membrane force in gauss point
 
   Matrix Tmat(6, 6); //local-global coordinates transform matrix
 
@@ -1183,35 +1183,35 @@ void ShellNLDKGQ::formResidAndTangent(int tang_flag)
 
   //-------------------B-matrices---------------------------------
 
-  static Matrix BJ(nstress, ndf); // B matrix node J
+  static thread_local Matrix BJ(nstress, ndf); // B matrix node J
 
-  static Matrix BJtran(ndf, nstress);
+  static thread_local Matrix BJtran(ndf, nstress);
 
-  static Matrix BK(nstress, ndf); // B matrix node K
+  static thread_local Matrix BK(nstress, ndf); // B matrix node K
 
-  static Matrix BJtranD(ndf, nstress); //BJtran * dd
+  static thread_local Matrix BJtranD(ndf, nstress); //BJtran * dd
 
-  static Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
+  static thread_local Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
 
   //static Matrix BJPT(nstress,ndf); //BJP * Tmat, from global coordinates to local coordinates
 
-  static Matrix Bmembrane(3, 3); //membrane B matrix
+  static thread_local Matrix Bmembrane(3, 3); //membrane B matrix
 
-  static Matrix Bbend(3, 3); //bending B matrix
+  static thread_local Matrix Bbend(3, 3); //bending B matrix
 
-  static Matrix Bshear(2, 3); //shear B matrix (zero)
+  static thread_local Matrix Bshear(2, 3); //shear B matrix (zero)
 
-  static double saveB[nstress][ndf][numnodes];
+  static thread_local double saveB[nstress][ndf][numnodes];
 
   //Added for geometric nonlinearity
   //BG
-  static Matrix BGJ(2, 3);
+  static thread_local Matrix BGJ(2, 3);
 
-  static Matrix BGJtran(3, 2);
+  static thread_local Matrix BGJtran(3, 2);
 
-  static Matrix stiffBGM(3, 2); // BGJtran * membraneForce
+  static thread_local Matrix stiffBGM(3, 2); // BGJtran * membraneForce
 
-  static Matrix BGK(2, 3);
+  static thread_local Matrix BGK(2, 3);
   //---------------------------------------------------------------
 
   //zero stiffness and residual
@@ -1504,11 +1504,11 @@ void ShellNLDKGQ::computeBasis()
   //and use those as basis vectors but this is easier
   //and the shell is flat anyway.
 
-  static Vector temp(3);
+  static thread_local Vector temp(3);
 
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector v3(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector v3(3);
 
   //get two vectors (v1, v2) in plane of shell by
   // nodal coordinate differences
@@ -1672,7 +1672,7 @@ void ShellNLDKGQ::updateBasis()
 const Matrix &ShellNLDKGQ::assembleB(const Matrix &Bmembrane,
                                      const Matrix &Bbend, const Matrix &Bshear)
 {
-  static Matrix B(8, 6);
+  static thread_local Matrix B(8, 6);
 
   // For Shell :
   //
@@ -1720,7 +1720,7 @@ const Matrix &ShellNLDKGQ::assembleB(const Matrix &Bmembrane,
 const Matrix &ShellNLDKGQ::computeBmembrane(int node, const double shp[3][4],
                                             const double shpDrill[4][4])
 {
-  static Matrix Bmembrane(3, 3);
+  static thread_local Matrix Bmembrane(3, 3);
 
   // ------Bmembrane Matrix in standard {1,2,3} mechanics notation ---------------
   //
@@ -1747,7 +1747,7 @@ const Matrix &ShellNLDKGQ::computeBmembrane(int node, const double shp[3][4],
 
 const Matrix &ShellNLDKGQ::computeBbend(int node, const double shpBend[6][12])
 {
-  static Matrix Bbend(3, 3);
+  static thread_local Matrix Bbend(3, 3);
 
   int i, j, k;
 
@@ -1789,7 +1789,7 @@ const Matrix &ShellNLDKGQ::computeBbend(int node, const double shpBend[6][12])
 //compute BG matrix
 const Matrix &ShellNLDKGQ::computeBG(int node, const double shpBend[6][12])
 {
-  static Matrix BG(2, 3);
+  static thread_local Matrix BG(2, 3);
 
   int i, j, k;
 
@@ -1820,8 +1820,8 @@ const Matrix &ShellNLDKGQ::computeBG(int node, const double shpBend[6][12])
 const Vector &ShellNLDKGQ::computeNLdstrain(const Matrix &BG,
                                             const Vector &dispIncLocalBend)
 {
-  static Vector dstrain_nl(3);
-  static Vector strainInc(2);
+  static thread_local Vector dstrain_nl(3);
+  static thread_local Vector strainInc(2);
 
   strainInc.addMatrixVector(0.0, BG, dispIncLocalBend, 1.0);
 
@@ -1845,7 +1845,7 @@ void ShellNLDKGQ::shape2d(double ss, double tt, const double x[2][4],
   static const double s[] = {-0.5, 0.5, 0.5, -0.5};
   static const double t[] = {-0.5, -0.5, 0.5, 0.5};
 
-  static double xs[2][2];
+  static thread_local double xs[2][2];
   // static double sx[2][2] ;  //have been defined before
 
   for (i = 0; i < 4; i++) {
@@ -1965,7 +1965,7 @@ void ShellNLDKGQ::shapeBend(double ss, double tt, const double x[2][4],
   //static Vector N(8);
   //static Vector Nxi(8);
   //static Vector Neta(8);
-  static double N[3][8];
+  static thread_local double N[3][8];
 
   double a5, a6, a7, a8;
   double b5, b6, b7, b8;
@@ -1977,7 +1977,7 @@ void ShellNLDKGQ::shapeBend(double ss, double tt, const double x[2][4],
   double y12, y23, y34, y41;
   double L12, L23, L34, L41;
 
-  static double temp[4][12];
+  static thread_local double temp[4][12];
 
   int i;
 
@@ -2178,7 +2178,7 @@ int ShellNLDKGQ::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(13);
+  static thread_local ID idData(13);
 
   int i;
   for (i = 0; i < 4; i++) {
@@ -2207,7 +2207,7 @@ int ShellNLDKGQ::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vectData(4);
+  static thread_local Vector vectData(4);
   //vectData(0) = Ktt;
   vectData(0) = alphaM;
   vectData(1) = betaK;
@@ -2247,7 +2247,7 @@ int ShellNLDKGQ::recvSelf(int commitTag, Channel &theChannel,
 
   int dataTag = this->getDbTag();
 
-  static ID idData(13);
+  static thread_local ID idData(13);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -2262,7 +2262,7 @@ int ShellNLDKGQ::recvSelf(int commitTag, Channel &theChannel,
   connectedExternalNodes(2) = idData(11);
   connectedExternalNodes(3) = idData(12);
 
-  static Vector vectData(4);
+  static thread_local Vector vectData(4);
   res += theChannel.recvVector(dataTag, commitTag, vectData);
   if (res < 0) {
     opserr << "WARNING ShellNLDKGQ::sendSelf() - " << this->getTag()
@@ -111,10 +111,10 @@ class ShellNLDKGQThermal : public Element {
   private : 
 
     //static data
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
+    static thread_local Matrix stiff ;
+    static thread_local Vector resid ;
+    static thread_local Matrix mass ;
+    static thread_local Matrix damping ;
 
 	//last resid
 	// Vector CstrainGauss,TstrainGauss;
@@ -49,9 +49,9 @@ using OpenSees::MatrixND;
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
 // static data
-Matrix ShellNLDKGT::stiff(18, 18);
-Vector ShellNLDKGT::resid(18);
-Matrix ShellNLDKGT::mass(18, 18);
+thread_local Matrix ShellNLDKGT::stiff(18, 18);
+thread_local Vector ShellNLDKGT::resid(18);
+thread_local Matrix ShellNLDKGT::mass(18, 18);
 
 //some data
 
@@ -413,8 +413,8 @@ int ShellNLDKGT::getResponse(int responseID, Information &eleInfo)
 {
   int cnt = 0;
 
-  static Vector stresses(32);
-  static Vector strains(32);
+  static thread_local Vector stresses(32);
+  static thread_local Vector strains(32);
 
   switch (responseID) {
   case 1: // global forces
@@ -495,61 +495,61 @@ const Matrix &ShellNLDKGT::getInitialStiff()
   int success;
   double volume = 0.0;
   static double xsj;          //determinant jacabian matrix
-  static double dvol[ngauss]; //volume element
+  static thread_local double dvol[ngauss]; //volume element
   //add for geometric nonlinearity
-  static Vector incrDisp(ndf); //total displacement
-  static Vector Cstrain(
+  static thread_local Vector incrDisp(ndf); //total displacement
+  static thread_local Vector Cstrain(
       nstress); //commit strain last step/ add for geometric nonlinearity
-  static Vector strain(nstress); //strain
+  static thread_local Vector strain(nstress); //strain
   //add for geometric nonlinearity
-  static Vector dstrain(nstress);    //total strain increment
-  static Vector dstrain_li(nstress); //linear incr strain
-  static Vector dstrain_nl(3);       //geometric nonlinear strain
+  static thread_local Vector dstrain(nstress);    //total strain increment
+  static thread_local Vector dstrain_li(nstress); //linear incr strain
+  static thread_local Vector dstrain_nl(3);       //geometric nonlinear strain
 
   //static Vector strain(nstress);//strain
 
-  static double shp[3][numnodes]; //shape function 2d at a gauss point
+  static thread_local double shp[3][numnodes]; //shape function 2d at a gauss point
 
   //	static double shpM[3][numnodes];//shape function-membrane at a gausss point
 
-  static double shpDrill[4][numnodes]; //shape function-drilling dof(Nu,1&Nu,2&Nv,1&Nv,2) at a gauss point
-  static double shpBend[6][9]; //shape function -bending part(Hx,Hy,Hx-1,2&Hy-1,2) at a gauss point
+  static thread_local double shpDrill[4][numnodes]; //shape function-drilling dof(Nu,1&Nu,2&Nv,1&Nv,2) at a gauss point
+  static thread_local double shpBend[6][9]; //shape function -bending part(Hx,Hy,Hx-1,2&Hy-1,2) at a gauss point
 
   //static Vector residJ(ndf,ndf); //nodeJ residual, global coordinates
 
-  static Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
+  static thread_local Matrix stiffJK(ndf, ndf); //nodeJK stiffness, global coordinates
 
   //static Vector residJlocal(ndf,ndf); // nodeJ residual, local coordinates
 
-  static Matrix stiffJKlinear(ndf, ndf); //nodeJK stiffness,for linear part
-  static Matrix stiffJKgeo(3, 3); //nodeJK stiffness,for geometric nonlinearity
+  static thread_local Matrix stiffJKlinear(ndf, ndf); //nodeJK stiffness,for linear part
+  static thread_local Matrix stiffJKgeo(3, 3); //nodeJK stiffness,for geometric nonlinearity
 
-  static Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
-  static Matrix stiffJK1(ndf, ndf);
-  static Matrix stiffJK2(ndf, ndf);
-  static Matrix stiffJK3(ndf, ndf);
-  static Vector stress(nstress); //stress resultants
+  static thread_local Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
+  static thread_local Matrix stiffJK1(ndf, ndf);
+  static thread_local Matrix stiffJK2(ndf, ndf);
+  static thread_local Matrix stiffJK3(ndf, ndf);
+  static thread_local Vector stress(nstress); //stress resultants
   //static Vector dstress(nstress); //add for geometric nonlinearity
 
   //static Vector stress(nstress); //stress resultants
 
-  static Matrix dd(nstress, nstress); // material tangent
+  static thread_local Matrix dd(nstress, nstress); // material tangent
 
   //static Matrix J0(2,2); //Jacobian at center
 
   //static Matrix J0inv(2,2); //inverse of Jacobian at center
-  static double sx[2][2]; // inverse of Jacobian
+  static thread_local double sx[2][2]; // inverse of Jacobian
 
   //static Matrix Tmat(6,6); // local-global coordinates matrix
   //add for geometric nonlinearity
-  static Vector dispIncLocal(6); //incr disp in local coordinates
-  static Vector dispIncLocalBend(
+  static thread_local Vector dispIncLocal(6); //incr disp in local coordinates
+  static thread_local Vector dispIncLocalBend(
       3); //incr disp of bending part in local coordinates
 
   //eleForce & eleForceLast: gauss stress
-  static Vector stressLast_gauss(8); //eleForceLast
+  static thread_local Vector stressLast_gauss(8); //eleForceLast
   //static Vector stressNew_gauss(8);  //eleForce
-  static Matrix membraneForce(2, 2); //membrane force in gauss point
+  static thread_local Matrix membraneForce(2, 2); //membrane force in gauss point
 
   // Matrix TmatTran(6,6);
 
@@ -563,35 +563,35 @@ const Matrix &ShellNLDKGT::getInitialStiff()
 
   //--------------------B-matrices--------------------------------------
 
-  static Matrix BJ(nstress, ndf); // B matrix node J
+  static thread_local Matrix BJ(nstress, ndf); // B matrix node J
 
-  static Matrix BJtran(ndf, nstress);
+  static thread_local Matrix BJtran(ndf, nstress);
 
-  static Matrix BK(nstress, ndf); // B matrix node K
+  static thread_local Matrix BK(nstress, ndf); // B matrix node K
 
-  static Matrix BJtranD(ndf, nstress); //BJtran * dd
+  static thread_local Matrix BJtranD(ndf, nstress); //BJtran * dd
 
-  static Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
+  static thread_local Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
 
   //static Matrix BJPT(nstress,ndf); //BJP * Tmat, from global coordinates to local coordinates
 
-  static Matrix Bmembrane(3, 3); //membrane B matrix
+  static thread_local Matrix Bmembrane(3, 3); //membrane B matrix
 
-  static Matrix Bbend(3, 3); //bending B matrix
+  static thread_local Matrix Bbend(3, 3); //bending B matrix
 
-  static Matrix Bshear(2, 3); //shear B matrix (zero)
+  static thread_local Matrix Bshear(2, 3); //shear B matrix (zero)
 
-  static double saveB[nstress][ndf][numnodes];
+  static thread_local double saveB[nstress][ndf][numnodes];
 
   //Added for geometric nonlinearity
   //BG
-  static Matrix BGJ(2, 3);
+  static thread_local Matrix BGJ(2, 3);
 
-  static Matrix BGJtran(3, 2);
+  static thread_local Matrix BGJtran(3, 2);
 
-  static Matrix stiffBGM(3, 2); // BGJtran * membraneForce
+  static thread_local Matrix stiffBGM(3, 2); // BGJtran * membraneForce
 
-  static Matrix BGK(2, 3);
+  static thread_local Matrix BGK(2, 3);
 
   //--------------------------------------------------------
 
@@ -873,7 +873,7 @@ int ShellNLDKGT::addLoad(ElementalLoad *theLoad, double loadFactor)
 int ShellNLDKGT::addInertiaLoadToUnbalance(const Vector &accel)
 {
   int tangFlag = 1;
-  static Vector r(18);
+  static thread_local Vector r(18);
 
   int i;
 
@@ -918,7 +918,7 @@ const Vector &ShellNLDKGT::getResistingForce()
 //get residual with inertia terms
 const Vector &ShellNLDKGT::getResistingForceIncInertia()
 {
-  static Vector res(18);
+  static thread_local Vector res(18);
   int tang_flag = 0; //don't get the tangent
 
   //do tangent and residual here
@@ -954,7 +954,7 @@ void ShellNLDKGT::formInertiaTerms(int tangFlag)
   static const int massIndex = nShape - 1;
 
   double sx[2][2]; //inverse jacobian matrix
-  static double shp[nShape][numberNodes]; //shape functions at a gauss point
+  static thread_local double shp[nShape][numberNodes]; //shape functions at a gauss point
 
   static VectorND<ndf> momentum;
 
@@ -1058,73 +1058,73 @@ void ShellNLDKGT::formResidAndTangent(int tang_flag)
 
   static double xsj; //determinant jacobian matrix
 
-  static double dvol[ngauss]; //volume element
+  static thread_local double dvol[ngauss]; //volume element
 
   // add for geometric nonlinearity
-  static Vector incrDisp(ndf); //total displacement
+  static thread_local Vector incrDisp(ndf); //total displacement
 
-  static Vector Cstrain(nstress); //commit strain last step/ add for geometric nonlinearity
-  static Vector strain(nstress); //strain
+  static thread_local Vector Cstrain(nstress); //commit strain last step/ add for geometric nonlinearity
+  static thread_local Vector strain(nstress); //strain
 
   // add for geometric nonlinearity
-  static Vector dstrain(nstress);      // total strain increment
-  static Vector dstrain_li(nstress);   // linear incr strain
-  static Vector dstrain_nl(3);         // geometric nonlinear strain
-  static double shp[3][numnodes];      // shape function 2d at a gauss point
-  static double shpDrill[4][numnodes]; // shape function drilling dof at a gauss point
-  static double shpBend[6][9];         // shape function - bending part at a gauss point
-  static Vector residJ(ndf);           // nodeJ residual, global coordinates
-  static Matrix stiffJK(ndf, ndf);     // nodeJK stiffness, global coordinates
-  static Vector residJlocal(ndf);      // nodeJ residual, local coordinates
-  static Matrix stiffJKlinear(ndf, ndf); //nodeJK stiffness,for linear part
-  static Matrix stiffJKgeo(3, 3); //nodeJK stiffness,for geometric nonlinearity
-  static Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
-  static Matrix stiffJK1(ndf, ndf);
-  static Matrix stiffJK2(ndf, ndf);
-  static Matrix stiffJK3(ndf, ndf);
-  static Vector residJ1(ndf);
-
-  static Vector stress(nstress); //stress resultants
-  static Vector Cstress(nstress);
+  static thread_local Vector dstrain(nstress);      // total strain increment
+  static thread_local Vector dstrain_li(nstress);   // linear incr strain
+  static thread_local Vector dstrain_nl(3);         // geometric nonlinear strain
+  static thread_local double shp[3][numnodes];      // shape function 2d at a gauss point
+  static thread_local double shpDrill[4][numnodes]; // shape function drilling dof at a gauss point
+  static thread_local double shpBend[6][9];         // shape function - bending part at a gauss point
+  static thread_local Vector residJ(ndf);           // nodeJ residual, global coordinates
+  static thread_local Matrix stiffJK(ndf, ndf);     // nodeJK stiffness, global coordinates
+  static thread_local Vector residJlocal(ndf);      // nodeJ residual, local coordinates
+  static thread_local Matrix stiffJKlinear(ndf, ndf); //nodeJK stiffness,for linear part
+  static thread_local Matrix stiffJKgeo(3, 3); //nodeJK stiffness,for geometric nonlinearity
+  static thread_local Matrix stiffJKlocal(ndf, ndf); //nodeJK stiffness, local coordinates
+  static thread_local Matrix stiffJK1(ndf, ndf);
+  static thread_local Matrix stiffJK2(ndf, ndf);
+  static thread_local Matrix stiffJK3(ndf, ndf);
+  static thread_local Vector residJ1(ndf);
+
+  static thread_local Vector stress(nstress); //stress resultants
+  static thread_local Vector Cstress(nstress);
   //static Vector dstress(nstress); //add for geometric nonlinearity
 
-  static Matrix dd(nstress, nstress); //material tangent
+  static thread_local Matrix dd(nstress, nstress); //material tangent
 
   //static Matrix J0(2,2); //Jacobian at center
   //static Matrix J0inv(2,2); //inverse of Jacobian at center
-  static double sx[2][2];
+  static thread_local double sx[2][2];
 
   //add for geometric nonlinearity
-  static Vector dispIncLocal(6); //incr disp in local coordinates
-  static Vector dispIncLocalBend(3); //incr disp of bending part in local coordinates
+  static thread_local Vector dispIncLocal(6); //incr disp in local coordinates
+  static thread_local Vector dispIncLocalBend(3); //incr disp of bending part in local coordinates
 
   // eleForce & eleForceLast: gauss stress
-  static Matrix membraneForce(2, 2); // membrane force in gauss point
+  static thread_local Matrix membraneForce(2, 2); // membrane force in gauss point
   MatrixND<6,6> Tmat{0.0};           // local-global coordinates transform matrix
   MatrixND<6,6> TmatTran{0.0};
   MatrixND<6,6> Pmat{0.0};           //transform dofs order
   MatrixND<6,6> PmatTran{0.0};
 
   //-------------------B-matrices---------------------------------
-  static Matrix BJ(nstress, ndf); // B matrix node J
-  static Matrix BJtran(ndf, nstress);
-  static Matrix BK(nstress, ndf);      // B matrix node K
-  static Matrix BJtranD(ndf, nstress); //BJtran * dd
-  static Matrix BJP(nstress, ndf);     //BJ * Pmat, transform the dof order
-  static Matrix BJPT(
+  static thread_local Matrix BJ(nstress, ndf); // B matrix node J
+  static thread_local Matrix BJtran(ndf, nstress);
+  static thread_local Matrix BK(nstress, ndf);      // B matrix node K
+  static thread_local Matrix BJtranD(ndf, nstress); //BJtran * dd
+  static thread_local Matrix BJP(nstress, ndf);     //BJ * Pmat, transform the dof order
+  static thread_local Matrix BJPT(
       nstress, ndf); //BJP * Tmmat, from global coordinates to local coordinates
 
-  static Matrix Bmembrane(3, 3); //membrane B matrix
-  static Matrix Bbend(3, 3);     //bending B matrix
-  static Matrix Bshear(2, 3);    //shear B matrix (zero)
-  static double saveB[nstress][ndf][numnodes];
+  static thread_local Matrix Bmembrane(3, 3); //membrane B matrix
+  static thread_local Matrix Bbend(3, 3);     //bending B matrix
+  static thread_local Matrix Bshear(2, 3);    //shear B matrix (zero)
+  static thread_local double saveB[nstress][ndf][numnodes];
 
   //Added for geometric nonlinearity
   //BG
-  static Matrix BGJ(2, 3);
-  static Matrix BGJtran(3, 2);
-  static Matrix stiffBGM(3, 2); // BGJtran * membraneForce
-  static Matrix BGK(2, 3);
+  static thread_local Matrix BGJ(2, 3);
+  static thread_local Matrix BGJtran(3, 2);
+  static thread_local Matrix stiffBGM(3, 2); // BGJtran * membraneForce
+  static thread_local Matrix BGK(2, 3);
   //---------------------------------------------------------------
 
   //zero stiffness and residual
@@ -1418,11 +1418,11 @@ void ShellNLDKGT::computeBasis()
   //and use those as basis vectors but this is easier
   //and the shell is flat anyway.
 
-  static Vector temp(3);
+  static thread_local Vector temp(3);
 
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector v3(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector v3(3);
 
   //get two vectors (v1, v2) in plane of shell by
   // nodal coordinate differences
@@ -1492,11 +1492,11 @@ void ShellNLDKGT::updateBasis()
   //and use those as basis vectors but this is easier
   //and the shell is flat anyway.
 
-  static Vector temp(3);
+  static thread_local Vector temp(3);
 
-  static Vector v1(3);
-  static Vector v2(3);
-  static Vector v3(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
+  static thread_local Vector v3(3);
 
   //get two vectors (v1, v2) in plane of shell by
   // nodal coordinate differences
@@ -1566,7 +1566,7 @@ void ShellNLDKGT::updateBasis()
 const Matrix &ShellNLDKGT::assembleB(const Matrix &Bmembrane,
                                      const Matrix &Bbend, const Matrix &Bshear)
 {
-  static Matrix B(8, 6);
+  static thread_local Matrix B(8, 6);
 
   int p, q;
 
@@ -1615,7 +1615,7 @@ const Matrix &ShellNLDKGT::assembleB(const Matrix &Bmembrane,
 const Matrix &ShellNLDKGT::computeBmembrane(int node, const double shp[3][3],
                                             const double shpDrill[4][3])
 {
-  static Matrix Bmembrane(3, 3);
+  static thread_local Matrix Bmembrane(3, 3);
 
   // ------Bmembrane Matrix in standard {1,2,3} mechanics notation ---------------
   //
@@ -1642,7 +1642,7 @@ const Matrix &ShellNLDKGT::computeBmembrane(int node, const double shp[3][3],
 
 const Matrix &ShellNLDKGT::computeBbend(int node, const double shpBend[6][9])
 {
-  static Matrix Bbend(3, 3);
+  static thread_local Matrix Bbend(3, 3);
 
   int i, j, k;
 
@@ -1685,7 +1685,7 @@ const Matrix &ShellNLDKGT::computeBbend(int node, const double shpBend[6][9])
 //compute BG matrix
 const Matrix &ShellNLDKGT::computeBG(int node, const double shpBend[6][9])
 {
-  static Matrix BG(2, 3);
+  static thread_local Matrix BG(2, 3);
 
   int i, j, k;
 
@@ -1716,8 +1716,8 @@ const Matrix &ShellNLDKGT::computeBG(int node, const double shpBend[6][9])
 const Vector &ShellNLDKGT::computeNLdstrain(const Matrix &BG,
                                             const Vector &dispIncLocalBend)
 {
-  static Vector dstrain_nl(3);
-  static Vector strainInc(2);
+  static thread_local Vector dstrain_nl(3);
+  static thread_local Vector strainInc(2);
 
   strainInc.addMatrixVector(0.0, BG, dispIncLocalBend, 1.0);
 
@@ -1838,8 +1838,8 @@ void ShellNLDKGT::shapeBend(double ss, double tt, double qq,
                             const double x[2][3], double sx[2][2],
                             double shpBend[6][9])
 {
-  static double N[3][6];
-  static double temp[4][9];
+  static thread_local double N[3][6];
+  static thread_local double temp[4][9];
 
   double a4, a5, a6;
   double b4, b5, b6;
@@ -2033,7 +2033,7 @@ int ShellNLDKGT::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
 
-  static ID idData(12);
+  static thread_local ID idData(12);
 
   int i;
   for (i = 0; i < 4; i++) {
@@ -2061,7 +2061,7 @@ int ShellNLDKGT::sendSelf(int commitTag, Channel &theChannel)
     return res;
   }
 
-  static Vector vectData(4); //????
+  static thread_local Vector vectData(4); //????
   //vectData(0) = Ktt;
   vectData(0) = alphaM;
   vectData(1) = betaK;
@@ -2101,7 +2101,7 @@ int ShellNLDKGT::recvSelf(int commitTag, Channel &theChannel,
 
   int dataTag = this->getDbTag();
 
-  static ID idData(12);
+  static thread_local ID idData(12);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
@@ -2115,7 +2115,7 @@ int ShellNLDKGT::recvSelf(int commitTag, Channel &theChannel,
   connectedExternalNodes(1) = idData(10);
   connectedExternalNodes(2) = idData(11);
 
-  static Vector vectData(4);
+  static thread_local Vector vectData(4);
   res += theChannel.recvVector(dataTag, commitTag, vectData);
   if (res < 0) {
     opserr << "WARNING ShellNLDKGT::recvSelf() - " << this->getTag()
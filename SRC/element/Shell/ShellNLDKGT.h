@@ -107,10 +107,10 @@ private :
   constexpr static int nip = 4;
 
   // static data
-  static Matrix stiff ;
-  static Vector resid ;
-  static Matrix mass ;
-  static Matrix damping ;
+  static thread_local Matrix stiff ;
+  static thread_local Vector resid ;
+  static thread_local Matrix mass ;
+  static thread_local Matrix damping ;
 
   //last resid
   // Vector CstrainGauss,TstrainGauss;
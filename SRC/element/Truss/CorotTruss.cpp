@@ -36,6 +36,7 @@
 #include <FEM_ObjectBroker.h>
 #include <UniaxialMaterial.h>
 #include <Renderer.h>
+#include <Scratch.h>
 
 #include <Parameter.h>
 #include <math.h>
@@ -45,15 +46,15 @@
 
 #include <ElementResponse.h>
 
-Matrix CorotTruss::M2(2,2);
-Matrix CorotTruss::M4(4,4);
-Matrix CorotTruss::M6(6,6);
-Matrix CorotTruss::M12(12,12);
+thread_local Matrix CorotTruss::M2(2,2);
+thread_local Matrix CorotTruss::M4(4,4);
+thread_local Matrix CorotTruss::M6(6,6);
+thread_local Matrix CorotTruss::M12(12,12);
 
-Vector CorotTruss::V2(2);
-Vector CorotTruss::V4(4);
-Vector CorotTruss::V6(6);
-Vector CorotTruss::V12(12);
+thread_local Vector CorotTruss::V2(2);
+thread_local Vector CorotTruss::V4(4);
+thread_local Vector CorotTruss::V6(6);
+thread_local Vector CorotTruss::V12(12);
 
 
 #include <elementAPI.h>
@@ -295,7 +296,7 @@ CorotTruss::CorotTruss(int tag, int dim,
   theMaterial(0), connectedExternalNodes(2),
   numDOF(0), numDIM(dim), Lo(0.0), Ln(0.0), 
   A(a), rho(r), doRayleighDamping(damp), cMass(cm),
-  R(3,3), theLoad(0), theMatrix(0), theVector(0)
+  R(3,3), theLoad(0)
 {
   // get a copy of the material and check we obtained a valid copy
   theMaterial = theMat.getCopy();
@@ -328,7 +329,7 @@ CorotTruss::CorotTruss()
   theMaterial(0),connectedExternalNodes(2),
   numDOF(0), numDIM(0), Lo(0.0), Ln(0.0),
   A(0.0), rho(0.0), doRayleighDamping(0), cMass(0),
-  R(3,3), theLoad(0), theMatrix(0), theVector(0)
+  R(3,3), theLoad(0)
 {
   // ensure the connectedExternalNode ID is of correct size 
   if (connectedExternalNodes.Size() != 2) {
@@ -430,28 +431,18 @@ CorotTruss::setDomain(Domain *theDomain)
   
   if (numDIM == 1 && dofNd1 == 1) {
     numDOF = 2;
-    theMatrix = &M2;
-    theVector = &V2;
   }
   else if (numDIM == 2 && dofNd1 == 2) {
     numDOF = 4;
-    theMatrix = &M4;
-    theVector = &V4;
   }
   else if (numDIM == 2 && dofNd1 == 3) {
     numDOF = 6;
-    theMatrix = &M6;
-    theVector = &V6;
   }
   else if (numDIM == 3 && dofNd1 == 3) {
     numDOF = 6;
-    theMatrix = &M6;
-    theVector = &V6;
   }
   else if (numDIM == 3 && dofNd1 == 6) {
     numDOF = 12;
-    theMatrix = &M12;
-    theVector = &V12;
   }
   else {
     opserr << " CorotTruss::setDomain -- nodal DOF " << dofNd1 << " not compatible with element\n";
@@ -604,10 +595,20 @@ CorotTruss::update(void)
   return theMaterial->setTrialStrain(strain,rate);
 }
 
+bool
+CorotTruss::isThreadSafe(void) const
+{
+  // the work areas are per thread, so the element is safe
+  // whenever its material is
+  return theMaterial != nullptr && theMaterial->isThreadSafe();
+}
+
 const Matrix &
 CorotTruss::getTangentStiff(void)
 {
-    static Matrix kl(3,3);
+    OpenSees::Scratch scratch;
+
+    Matrix &kl = scratch.matrix(3,3);
 
     // Material stiffness
     //
@@ -634,10 +635,10 @@ CorotTruss::getTangentStiff(void)
     }
     
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    Matrix &kg = scratch.matrix(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = this->workMatrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -651,24 +652,26 @@ CorotTruss::getTangentStiff(void)
         }
     }
 
-    return *theMatrix;
+    return K;
 }
 
 
 const Matrix &
 CorotTruss::getInitialStiff(void)
 {
-    static Matrix kl(3,3);
+    OpenSees::Scratch scratch;
+
+    Matrix &kl = scratch.matrix(3,3);
 
     // Material stiffness
     kl.Zero();
     kl(0,0) = A * theMaterial->getInitialTangent() / Lo;
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    Matrix &kg = scratch.matrix(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = this->workMatrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -682,34 +685,36 @@ CorotTruss::getInitialStiff(void)
         }
     }
 
-    return *theMatrix;
+    return K;
 }
 
 
 const Matrix &
 CorotTruss::getDamp(void)
 {
-    static Matrix kl(3,3);
+    OpenSees::Scratch scratch;
+
+    Matrix &kl = scratch.matrix(3,3);
 
-    Matrix a(3,1);
+    Matrix &a = scratch.matrix(3,1);
     a(0,0) = (Lo+d21[0])/Ln;
     a(1,0) = d21[1]/Ln;
     a(2,0) = 0.0;
 
-    Matrix cb(1,1);
+    Matrix &cb = scratch.matrix(1,1);
     cb(0,0) = A*theMaterial->getDampTangent()/Lo;
 
     kl.addMatrixTripleProduct(0.0, a, cb, 1.0);
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    Matrix &kg = scratch.matrix(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = this->workMatrix();
     K.Zero();
 
     if (doRayleighDamping == 1)
-        *theMatrix = this->Element::getDamp();
+        K = this->Element::getDamp();
 
     // Copy stiffness into appropriate blocks in element stiffness
     int numDOF2 = numDOF/2;
@@ -722,7 +727,7 @@ CorotTruss::getDamp(void)
         }
     }
 
-    return *theMatrix;
+    return K;
 }
 
 
@@ -730,7 +735,7 @@ const Matrix &
 CorotTruss::getMass(void)
 {
     // zero the matrix
-    Matrix &mass = *theMatrix;
+    Matrix &mass = this->workMatrix();
     mass.Zero();
     
     // check for quick return
@@ -757,7 +762,7 @@ CorotTruss::getMass(void)
         }
     }
     
-    return *theMatrix;
+    return mass;
 }
 
 
@@ -811,20 +816,22 @@ CorotTruss::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 CorotTruss::getResistingForce()
 {
+	OpenSees::Scratch scratch;
+
 	// Get material stress
 	double SA = A*theMaterial->getStress();
 	SA /= Ln;
 
-    static Vector ql(3);
+    Vector &ql = scratch.vector(3);
 
 	ql(0) = d21[0]*SA;
 	ql(1) = d21[1]*SA;
 	ql(2) = d21[2]*SA;
 
-    static Vector qg(3);
+    Vector &qg = scratch.vector(3);
     qg.addMatrixTransposeVector(0.0, R, ql, 1.0);
 
-    Vector &P = *theVector;
+    Vector &P = this->workVector();
     P.Zero();
 
     // Copy forces into appropriate places
@@ -834,7 +841,7 @@ CorotTruss::getResistingForce()
         P(i+numDOF2) =  qg(i);
     }
     
-    return *theVector;
+    return P;
 }
 
 
@@ -842,7 +849,7 @@ CorotTruss::getResistingForce()
 const Vector &
 CorotTruss::getResistingForceIncInertia()
 {	
-    Vector &P = *theVector;
+    Vector &P = this->workVector();
     P = this->getResistingForce();
     
     // subtract external load
@@ -868,22 +875,22 @@ CorotTruss::getResistingForceIncInertia()
             // consistent mass matrix
             double m = rho*Lo/6.0;
             for (int i=0; i<numDIM; i++) {
-                (*theVector)(i) += 2.0*m*accel1(i) + m*accel2(i);
-                (*theVector)(i+numDOF2) += m*accel1(i) + 2.0*m*accel2(i);
+                P(i) += 2.0*m*accel1(i) + m*accel2(i);
+                P(i+numDOF2) += m*accel1(i) + 2.0*m*accel2(i);
             }
         }
         
         // add the damping forces if rayleigh damping
         if (doRayleighDamping == 1 && (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-            theVector->addVector(1.0, this->getRayleighDampingForces(), 1.0);
+            P.addVector(1.0, this->getRayleighDampingForces(), 1.0);
     } else  {
         
         // add the damping forces if rayleigh damping
         if (doRayleighDamping == 1 && (betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-            theVector->addVector(1.0, this->getRayleighDampingForces(), 1.0);
+            P.addVector(1.0, this->getRayleighDampingForces(), 1.0);
     }
     
-    return *theVector;
+    return P;
 }
 
 int
@@ -899,7 +906,7 @@ CorotTruss::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(9);
+  static thread_local Vector data(9);
   data(0) = this->getTag();
   data(1) = numDIM;
   data(2) = numDOF;
@@ -952,7 +959,7 @@ CorotTruss::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBr
   // truss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(9);
+  static thread_local Vector data(9);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING Truss::recvSelf() - failed to receive Vector\n";
@@ -1013,8 +1020,8 @@ CorotTruss::displaySelf(Renderer &theViewer, int displayMode, float fact, const
 	if (Ln == 0.0)
 		return 0;
 
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -1190,3 +1197,31 @@ CorotTruss::updateParameter (int parameterID, Information &info)
     return -1;
   }
 }
+
+Matrix &
+CorotTruss::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return M2;
+    case 4:   return M4;
+    case 6:   return M6;
+    case 12:  return M12;
+    default: return M2;
+  }
+}
+
+Vector &
+CorotTruss::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return V2;
+    case 4:   return V4;
+    case 6:   return V6;
+    case 12:  return V12;
+    default: return V2;
+  }
+}
@@ -32,6 +32,7 @@
 #include <FEM_ObjectBroker.h>
 #include <UniaxialMaterial.h>
 #include <Renderer.h>
+#include <Scratch.h>
 
 #include <math.h>
 #include <stdlib.h>
@@ -39,15 +40,15 @@
 
 #include <ElementResponse.h>
 
-Matrix CorotTruss2::M2(2,2);
-Matrix CorotTruss2::M4(4,4);
-Matrix CorotTruss2::M6(6,6);
-Matrix CorotTruss2::M12(12,12);
+thread_local Matrix CorotTruss2::M2(2,2);
+thread_local Matrix CorotTruss2::M4(4,4);
+thread_local Matrix CorotTruss2::M6(6,6);
+thread_local Matrix CorotTruss2::M12(12,12);
 
-Vector CorotTruss2::V2(2);
-Vector CorotTruss2::V4(4);
-Vector CorotTruss2::V6(6);
-Vector CorotTruss2::V12(12);
+thread_local Vector CorotTruss2::V2(2);
+thread_local Vector CorotTruss2::V4(4);
+thread_local Vector CorotTruss2::V6(6);
+thread_local Vector CorotTruss2::V12(12);
 
 
 #include <elementAPI.h>
@@ -142,8 +143,7 @@ CorotTruss2::CorotTruss2(int tag, int dim,
   connectedExternalNodes(2), connectedExternalOtherNodes(2),
   numDOF(0), numDIM(dim),
   Lo(0.0), Ln(0.0), otherLength(0.0),
-  A(a), rho(r), R(3,3),
-  theMatrix(0), theVector(0)
+  A(a), rho(r), R(3,3)
 {
   // get a copy of the material and check we obtained a valid copy
   theMaterial = theMat.getCopy();
@@ -184,8 +184,7 @@ CorotTruss2::CorotTruss2()
   connectedExternalNodes(2), connectedExternalOtherNodes(2),
   numDOF(0), numDIM(0),
   Lo(0.0), Ln(0.0), otherLength(0.0),
-  A(0.0), rho(0.0), R(3,3),
-  theMatrix(0), theVector(0)
+  A(0.0), rho(0.0), R(3,3)
 {
   // ensure the connectedExternalNode ID is of correct size 
   if (connectedExternalNodes.Size() != 2 || connectedExternalOtherNodes.Size() != 2) {
@@ -285,8 +284,6 @@ CorotTruss2::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 6;
-	  theMatrix = &M6;
-      theVector = &V6;
       return;
     }
 
@@ -302,44 +299,30 @@ CorotTruss2::setDomain(Domain *theDomain)
     
     // fill this in so don't segment fault later
     numDOF = 6;    
-    theMatrix = &M6;
-    theVector = &V6;
     return;
   }	
   
   if (numDIM == 1 && dofNd1 == 1) {
     numDOF = 2;
-    theMatrix = &M2;
-    theVector = &V2;
   }
   else 
   if (numDIM == 2 && dofNd1 == 2) {
     numDOF = 4;
-    theMatrix = &M4;
-    theVector = &V4;
   }
   else if (numDIM == 2 && dofNd1 == 3) {
     numDOF = 6;
-    theMatrix = &M6;
-    theVector = &V6;
   }
   else if (numDIM == 3 && dofNd1 == 3) {
     numDOF = 6;
-    theMatrix = &M6;
-    theVector = &V6;
   }
   else if (numDIM == 3 && dofNd1 == 6) {
     numDOF = 12;
-    theMatrix = &M12;
-    theVector = &V12;
   }
   else {
     opserr << " CorotTruss2::setDomain -- nodal DOF " << dofNd1 << " not compatible with element\n";
     
     // fill this in so don't segment fault later
     numDOF = 6;    
-    theMatrix = &M6;
-    theVector = &V6;	
     return;
   }
 
@@ -539,7 +522,9 @@ CorotTruss2::computeCurrentNormalStrain(void)
 const Matrix &
 CorotTruss2::getTangentStiff(void)
 {
-    static Matrix kl(3,3);
+    OpenSees::Scratch scratch;
+
+    Matrix &kl = scratch.matrix(3,3);
 
     // Material stiffness
     //
@@ -566,10 +551,10 @@ CorotTruss2::getTangentStiff(void)
     }
     
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    Matrix &kg = scratch.matrix(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = this->workMatrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -583,23 +568,25 @@ CorotTruss2::getTangentStiff(void)
         }
     }
 
-    return *theMatrix;
+    return K;
 }
 
 const Matrix &
 CorotTruss2::getInitialStiff(void)
 {
-    static Matrix kl(3,3);
+    OpenSees::Scratch scratch;
+
+    Matrix &kl = scratch.matrix(3,3);
 
     // Material stiffness
     kl.Zero();
     kl(0,0) = A * theMaterial->getInitialTangent() / Lo;
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    Matrix &kg = scratch.matrix(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = this->workMatrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -613,14 +600,14 @@ CorotTruss2::getInitialStiff(void)
         }
     }
 
-    return *theMatrix;
+    return K;
 }
 
 
 const Matrix &
 CorotTruss2::getMass(void)
 {
-    Matrix &Mass = *theMatrix;
+    Matrix &Mass = this->workMatrix();
     Mass.Zero();
 
     // check for quick return
@@ -634,7 +621,7 @@ CorotTruss2::getMass(void)
         Mass(i+numDOF2,i+numDOF2) = M;
     }
 
-    return *theMatrix;
+    return Mass;
 }
 
 void 
@@ -662,20 +649,22 @@ CorotTruss2::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 CorotTruss2::getResistingForce()
 {
+	OpenSees::Scratch scratch;
+
 	// Get material stress
 	double SA = A*theMaterial->getStress();
 	SA /= Ln;
 
-    static Vector ql(3);
+    Vector &ql = scratch.vector(3);
 
 	ql(0) = d21[0]*SA;
 	ql(1) = d21[1]*SA;
 	ql(2) = d21[2]*SA;
 
-    static Vector qg(3);
+    Vector &qg = scratch.vector(3);
     qg.addMatrixTransposeVector(0.0, R, ql, 1.0);
 
-    Vector &P = *theVector;
+    Vector &P = this->workVector();
     P.Zero();
 
     // Copy forces into appropriate places
@@ -685,7 +674,7 @@ CorotTruss2::getResistingForce()
         P(i+numDOF2) =  qg(i);
     }
 
-    return *theVector;
+    return P;
 }
 
 
@@ -693,7 +682,7 @@ CorotTruss2::getResistingForce()
 const Vector &
 CorotTruss2::getResistingForceIncInertia()
 {	
-    Vector &P = *theVector;
+    Vector &P = this->workVector();
     P = this->getResistingForce();
     
     if (rho != 0.0) {
@@ -711,9 +700,9 @@ CorotTruss2::getResistingForceIncInertia()
 
     // add the damping forces if rayleigh damping
     if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
-      *theVector += this->getRayleighDampingForces();
+      P += this->getRayleighDampingForces();
 
-    return *theVector;
+    return P;
 }
 
 int
@@ -729,7 +718,7 @@ CorotTruss2::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(7);
+  static thread_local Vector data(7);
   data(0) = this->getTag();
   data(1) = numDIM;
   data(2) = numDOF;
@@ -786,7 +775,7 @@ CorotTruss2::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theB
   // truss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(7);
+  static thread_local Vector data(7);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING Truss::recvSelf() - failed to receive Vector\n";
@@ -852,8 +841,8 @@ CorotTruss2::displaySelf(Renderer &theViewer, int displayMode, float fact, const
 	if (Ln == 0.0)
 		return 0;
 
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -992,3 +981,31 @@ CorotTruss2::getResponse(int responseID, Information &eleInfo)
         return 0;
     }
 }
+
+Matrix &
+CorotTruss2::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return M2;
+    case 4:   return M4;
+    case 6:   return M6;
+    case 12:  return M12;
+    default: return M2;
+  }
+}
+
+Vector &
+CorotTruss2::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return V2;
+    case 4:   return V4;
+    case 6:   return V6;
+    case 12:  return V12;
+    default: return V2;
+  }
+}
@@ -115,19 +115,19 @@ class CorotTruss2 : public Element
 
     Matrix R;	// Rotation matrix
 
-    Matrix *theMatrix;
+    Matrix &workMatrix(void) const;  // class wide matrix of the calling thread
 
-    static Matrix M2;
-    static Matrix M4;
-    static Matrix M6;
-    static Matrix M12;
+    static thread_local Matrix M2;
+    static thread_local Matrix M4;
+    static thread_local Matrix M6;
+    static thread_local Matrix M12;
     
-    Vector *theVector;
+    Vector &workVector(void) const;  // class wide vector of the calling thread
 
-    static Vector V2;
-    static Vector V4;
-    static Vector V6;
-    static Vector V12;
+    static thread_local Vector V2;
+    static thread_local Vector V4;
+    static thread_local Vector V6;
+    static thread_local Vector V12;
 };
 
 #endif
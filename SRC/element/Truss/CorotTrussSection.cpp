@@ -36,6 +36,7 @@
 #include <FEM_ObjectBroker.h>
 #include <SectionForceDeformation.h>
 #include <Renderer.h>
+#include <Scratch.h>
 
 #include <math.h>
 #include <stdlib.h>
@@ -43,15 +44,15 @@
 
 #include <ElementResponse.h>
 
-Matrix CorotTrussSection::M2(2,2);
-Matrix CorotTrussSection::M4(4,4);
-Matrix CorotTrussSection::M6(6,6);
-Matrix CorotTrussSection::M12(12,12);
+thread_local Matrix CorotTrussSection::M2(2,2);
+thread_local Matrix CorotTrussSection::M4(4,4);
+thread_local Matrix CorotTrussSection::M6(6,6);
+thread_local Matrix CorotTrussSection::M12(12,12);
 
-Vector CorotTrussSection::V2(2);
-Vector CorotTrussSection::V4(4);
-Vector CorotTrussSection::V6(6);
-Vector CorotTrussSection::V12(12);
+thread_local Vector CorotTrussSection::V2(2);
+thread_local Vector CorotTrussSection::V4(4);
+thread_local Vector CorotTrussSection::V6(6);
+thread_local Vector CorotTrussSection::V12(12);
 
 
 #include <elementAPI.h>
@@ -144,7 +145,7 @@ CorotTrussSection::CorotTrussSection(int tag, int dim,
   theSection(0), connectedExternalNodes(2),
   numDOF(0), numDIM(dim), Lo(0.0), Ln(0.0),
   rho(r), doRayleighDamping(damp), cMass(cm),
-  R(3,3), theLoad(0), theMatrix(0), theVector(0)
+  R(3,3), theLoad(0)
 {
   // get a copy of the material and check we obtained a valid copy
   theSection = theSec.getCopy();
@@ -177,7 +178,7 @@ CorotTrussSection::CorotTrussSection()
   theSection(0),connectedExternalNodes(2),
   numDOF(0), numDIM(0), Lo(0.0), Ln(0.0),
   rho(0.0), doRayleighDamping(0), cMass(0),
-  R(3,3), theLoad(0), theMatrix(0), theVector(0)
+  R(3,3), theLoad(0)
 {
   // set node pointers to NULL
   for (int i=0; i<2; i++)
@@ -278,28 +279,18 @@ CorotTrussSection::setDomain(Domain *theDomain)
   
   if (numDIM == 1 && dofNd1 == 1) {
     numDOF = 2;
-    theMatrix = &M2;
-    theVector = &V2;
   }
   else if (numDIM == 2 && dofNd1 == 2) {
     numDOF = 4;
-    theMatrix = &M4;
-    theVector = &V4;
   }
   else if (numDIM == 2 && dofNd1 == 3) {
     numDOF = 6;
-    theMatrix = &M6;
-    theVector = &V6;
   }
   else if (numDIM == 3 && dofNd1 == 3) {
     numDOF = 6;
-    theMatrix = &M6;
-    theVector = &V6;
   }
   else if (numDIM == 3 && dofNd1 == 6) {
     numDOF = 12;
-    theMatrix = &M12;
-    theVector = &V12;
   }
   else {
     opserr << "CorotTrussSection::setDomain -- nodal DOF not compatible with element " << this->getTag() << endln;
@@ -443,7 +434,9 @@ CorotTrussSection::update(void)
 const Matrix &
 CorotTrussSection::getTangentStiff(void)
 {
-    static Matrix kl(3,3);
+    OpenSees::Scratch scratch;
+
+    Matrix &kl = scratch.matrix(3,3);
 
     // Material stiffness
     //
@@ -484,10 +477,10 @@ CorotTrussSection::getTangentStiff(void)
     }
     
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    Matrix &kg = scratch.matrix(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
 
-    Matrix &K = *theMatrix;
+    Matrix &K = this->workMatrix();
     K.Zero();
 
     // Copy stiffness into appropriate blocks in element stiffness
@@ -501,13 +494,15 @@ CorotTrussSection::getTangentStiff(void)
         }
     }
 
-    return *theMatrix;
+    return K;
 }
 
 const Matrix &
 CorotTrussSection::getInitialStiff(void)
 {
-    static Matrix kl(3,3);
+    OpenSees::Scratch scratch;
+
+    Matrix &kl = scratch.matrix(3,3);
 
     // Material stiffness
     //
@@ -529,10 +524,10 @@ CorotTrussSection::getInitialStiff(void)
     kl(0,0) = EA / Lo;
 
     // Compute R'*kl*R
-    static Matrix kg(3,3);
+    Matrix &kg = scratch.matrix(3,3);
     kg.addMatrixTripleProduct(0.0, R, kl, 1.0);
     
-    Matrix &K = *theMatrix;
+    Matrix &K = this->workMatrix();
     K.Zero();
     
     // Copy stiffness into appropriate blocks in element stiffness
@@ -546,18 +541,20 @@ CorotTrussSection::getInitialStiff(void)
       }
     }
 
-    return *theMatrix;
+    return K;
 }
 
 
 const Matrix &
 CorotTrussSection::getDamp(void)
 {   
+    Matrix &theMatrix = this->workMatrix();
+
     if (doRayleighDamping == 1)
       return this->Element::getDamp();
     
-    theMatrix->Zero();
-    return *theMatrix;
+    theMatrix.Zero();
+    return theMatrix;
 }
 
 
@@ -565,7 +562,7 @@ const Matrix &
 CorotTrussSection::getMass(void)
 {
     // zero the matrix
-    Matrix &mass = *theMatrix;
+    Matrix &mass = this->workMatrix();
     mass.Zero();    
     
     // check for quick return
@@ -592,7 +589,7 @@ CorotTrussSection::getMass(void)
         }
     }
     
-    return *theMatrix;
+    return mass;
 }
 
 void 
@@ -642,6 +639,8 @@ CorotTrussSection::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 CorotTrussSection::getResistingForce()
 {
+	OpenSees::Scratch scratch;
+
 	int order = theSection->getOrder();
 	const ID &code = theSection->getType();
 
@@ -657,16 +656,16 @@ CorotTrussSection::getResistingForce()
 
 	SA /= Ln;
 
-    static Vector ql(3);
+    Vector &ql = scratch.vector(3);
 
 	ql(0) = d21[0]*SA;
 	ql(1) = d21[1]*SA;
 	ql(2) = d21[2]*SA;
 
-    static Vector qg(3);
+    Vector &qg = scratch.vector(3);
     qg.addMatrixTransposeVector(0.0, R, ql, 1.0);
 
-    Vector &P = *theVector;
+    Vector &P = this->workVector();
     P.Zero();
 
     // Copy forces into appropriate places
@@ -676,13 +675,13 @@ CorotTrussSection::getResistingForce()
         P(i+numDOF2) =  qg(i);
     }
     
-    return *theVector;
+    return P;
 }
 
 const Vector &
 CorotTrussSection::getResistingForceIncInertia()
 {	
-    Vector &P = *theVector;
+    Vector &P = this->workVector();
     P = this->getResistingForce();
     
     // subtract external load
@@ -708,22 +707,22 @@ CorotTrussSection::getResistingForceIncInertia()
             // consistent mass matrix
             double m = rho*Lo/6.0;
             for (int i=0; i<numDIM; i++) {
-                (*theVector)(i) += 2.0*m*accel1(i) + m*accel2(i);
-                (*theVector)(i+numDOF2) += m*accel1(i) + 2.0*m*accel2(i);
+                P(i) += 2.0*m*accel1(i) + m*accel2(i);
+                P(i+numDOF2) += m*accel1(i) + 2.0*m*accel2(i);
             }
         }
         
         // add the damping forces if rayleigh damping
         if (doRayleighDamping == 1 && (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-            theVector->addVector(1.0, this->getRayleighDampingForces(), 1.0);
+            P.addVector(1.0, this->getRayleighDampingForces(), 1.0);
     } else  {
         
         // add the damping forces if rayleigh damping
         if (doRayleighDamping == 1 && (betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-            theVector->addVector(1.0, this->getRayleighDampingForces(), 1.0);
+            P.addVector(1.0, this->getRayleighDampingForces(), 1.0);
     }
     
-    return *theVector;
+    return P;
 }
 
 int
@@ -739,7 +738,7 @@ CorotTrussSection::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(8);
+  static thread_local Vector data(8);
   data(0) = this->getTag();
   data(1) = numDIM;
   data(2) = numDOF;
@@ -791,7 +790,7 @@ CorotTrussSection::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   // truss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(8);
+  static thread_local Vector data(8);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING CorotTrussSection::recvSelf() - failed to receive Vector\n";
@@ -852,8 +851,8 @@ CorotTrussSection::displaySelf(Renderer &theViewer, int displayMode, float fact,
 	if (Ln == 0.0)
 		return 0;
 
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
 
     theNodes[0]->getDisplayCrds(v1, fact, displayMode);
     theNodes[1]->getDisplayCrds(v2, fact, displayMode);
@@ -1037,3 +1036,31 @@ CorotTrussSection::getResponse(int responseID, Information &eleInfo)
         return -1;
     }
 }
+
+Matrix &
+CorotTrussSection::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return M2;
+    case 4:   return M4;
+    case 6:   return M6;
+    case 12:  return M12;
+    default: return M2;
+  }
+}
+
+Vector &
+CorotTrussSection::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return V2;
+    case 4:   return V4;
+    case 6:   return V6;
+    case 12:  return V12;
+    default: return V2;
+  }
+}
@@ -116,18 +116,18 @@ class CorotTrussSection : public Element
     Matrix R;	// Rotation matrix
 
     Vector *theLoad;    // pointer to the load vector P
-    Matrix *theMatrix;  // pointer to objects matrix (a class wide Matrix)
-    Vector *theVector;  // pointer to objects vector (a class wide Vector)
+    Matrix &workMatrix(void) const;  // class wide matrix of the calling thread
+    Vector &workVector(void) const;  // class wide vector of the calling thread
     
-    static Matrix M2;
-    static Matrix M4;
-    static Matrix M6;
-    static Matrix M12;
+    static thread_local Matrix M2;
+    static thread_local Matrix M4;
+    static thread_local Matrix M6;
+    static thread_local Matrix M12;
     
-    static Vector V2;
-    static Vector V4;
-    static Vector V6;
-    static Vector V12;
+    static thread_local Vector V2;
+    static thread_local Vector V4;
+    static thread_local Vector V6;
+    static thread_local Vector V12;
 };
 
 #endif
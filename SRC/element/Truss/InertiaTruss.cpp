@@ -51,14 +51,14 @@
 //#include <fstream>
 
 // initialise the class wide variables
-Matrix InertiaTruss::trussM2(2,2);
-Matrix InertiaTruss::trussM4(4,4);
-Matrix InertiaTruss::trussM6(6,6);
-Matrix InertiaTruss::trussM12(12,12);
-Vector InertiaTruss::trussV2(2);
-Vector InertiaTruss::trussV4(4);
-Vector InertiaTruss::trussV6(6);
-Vector InertiaTruss::trussV12(12);
+thread_local Matrix InertiaTruss::trussM2(2,2);
+thread_local Matrix InertiaTruss::trussM4(4,4);
+thread_local Matrix InertiaTruss::trussM6(6,6);
+thread_local Matrix InertiaTruss::trussM12(12,12);
+thread_local Vector InertiaTruss::trussV2(2);
+thread_local Vector InertiaTruss::trussV4(4);
+thread_local Vector InertiaTruss::trussV6(6);
+thread_local Vector InertiaTruss::trussV12(12);
 #include <elementAPI.h>
 
 #define OPS_Export
@@ -127,7 +127,7 @@ InertiaTruss::InertiaTruss(int tag, int dim,
  :Element(tag,ELE_TAG_InertiaTruss),
   connectedExternalNodes(2),
   dimension(dim), numDOF(0),
-  theLoad(0), theMatrix(0), theVector(0),
+  theLoad(0),
   L(0.0),  mass(mr), initialDisp(0)
 {
   
@@ -161,7 +161,7 @@ InertiaTruss::InertiaTruss()
 :Element(0,ELE_TAG_InertiaTruss),     
  connectedExternalNodes(2),
  dimension(0), numDOF(0),
- theLoad(0), theMatrix(0), theVector(0),
+ theLoad(0),
  L(0.0), mass(0.0)
 {
     // ensure the connectedExternalNode ID is of correct size 
@@ -257,8 +257,6 @@ InertiaTruss::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
       return;
     }
 
@@ -273,8 +271,6 @@ InertiaTruss::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
 	
       return;
     }	
@@ -285,36 +281,24 @@ InertiaTruss::setDomain(Domain *theDomain)
     // now set the number of dof for element and set matrix and vector pointer
     if (dimension == 1 && dofNd1 == 1) {
 	numDOF = 2;    
-	theMatrix = &trussM2;
-	theVector = &trussV2;
     }
     else if (dimension == 2 && dofNd1 == 2) {
 	numDOF = 4;
-	theMatrix = &trussM4;
-	theVector = &trussV4;	
     }
     else if (dimension == 2 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &trussM6;
-	theVector = &trussV6;		
     }
     else if (dimension == 3 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &trussM6;
-	theVector = &trussV6;			
     }
     else if (dimension == 3 && dofNd1 == 6) {
 	numDOF = 12;	    
-	theMatrix = &trussM12;
-	theVector = &trussV12;			
     }
     else {
       opserr <<"WARNING InertiaTruss::setDomain cannot handle " << dimension << " dofs at nodes in " << 
 	dofNd1  << " problem\n";
 
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
       return;
     }
 
@@ -458,7 +442,7 @@ const Matrix &
 InertiaTruss::getTangentStiff(void)
 {
     // set stiffness 0
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = this->workMatrix();
     stiff.Zero();
     return stiff;
 }
@@ -468,9 +452,9 @@ const Matrix &
 InertiaTruss::getInitialStiff(void)
 {
     // set stiffness 0
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = this->workMatrix();
     stiff.Zero();
-    return *theMatrix;
+    return stiff;
 }
 
 
@@ -479,7 +463,7 @@ const Matrix &
 InertiaTruss::getMass(void)
 {
   // zero the matrix
-  Matrix &Mmass = *theMatrix;
+  Matrix &Mmass = this->workMatrix();
   Mmass.Zero();
   
   // check for quick return
@@ -545,7 +529,7 @@ InertiaTruss::addInertiaLoadToUnbalance(const Vector &accel)
   
     double m = mass;
 	opserr << m;
-	Matrix &addinertiamass = *theMatrix;
+	Matrix &addinertiamass = this->workMatrix();
 	double temp;
 	for (int i = 0; i < dimension; i++) {
 		for (int j = 0; j < dimension; j++) {
@@ -578,9 +562,11 @@ InertiaTruss::addInertiaLoadSensitivityToUnbalance(const Vector &accel, bool som
 const Vector &
 InertiaTruss::getResistingForce()
 {	
+    Vector &theVector = this->workVector();
+
     if (L == 0.0) { // - problem in setDomain() no further warnings
-	theVector->Zero();
-	return *theVector;
+	theVector.Zero();
+	return theVector;
     }
     
     // R = Ku - Pext
@@ -588,21 +574,23 @@ InertiaTruss::getResistingForce()
     int numDOF2 = numDOF/2;
     double temp;
     for (int i = 0; i < dimension; i++) {
-      (*theVector)(i) = 0;
-      (*theVector)(i+numDOF2) = 0;
+      theVector(i) = 0;
+      theVector(i+numDOF2) = 0;
     }
     
-    return *theVector;
+    return theVector;
 }
 
 
 const Vector &
 InertiaTruss::getResistingForceIncInertia()
 {	
+  Vector &theVector = this->workVector();
+
   this->getResistingForce();
   
   // subtract external load
-  (*theVector) -= *theLoad;
+  theVector -= *theLoad;
   
   // now include the mass portion
   if (L != 0.0 && mass != 0.0) {
@@ -616,7 +604,7 @@ InertiaTruss::getResistingForceIncInertia()
     
       // inertia mass matrix
 	  double m = mass;
-	  Matrix &getinertiaforce = *theMatrix;
+	  Matrix &getinertiaforce = this->workMatrix();
 	  double temp;
 	  for (int i = 0; i < dimension; i++) {
 		  for (int j = 0; j < dimension; j++) {
@@ -629,13 +617,13 @@ InertiaTruss::getResistingForceIncInertia()
 	  }
 	  for (int k = 0; k < dimension; k++) {
 		  for (int l = 0; l < dimension; l++) {
-			  (*theVector)(k) += getinertiaforce(k, l)*accel1(l) + getinertiaforce(k, l + numDOF2)*accel2(l);
-			  (*theVector)(k + numDOF2) += getinertiaforce(k + numDOF2, l)*accel1(l) + getinertiaforce(k + numDOF2, l + numDOF2)*accel2(l);
+			  theVector(k) += getinertiaforce(k, l)*accel1(l) + getinertiaforce(k, l + numDOF2)*accel2(l);
+			  theVector(k + numDOF2) += getinertiaforce(k + numDOF2, l)*accel1(l) + getinertiaforce(k + numDOF2, l + numDOF2)*accel2(l);
 		  }
 	  }  
   }
   
-  return *theVector;
+  return theVector;
 }
 
 int
@@ -650,7 +638,7 @@ InertiaTruss::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(12);
+  static thread_local Vector data(12);
   data(0) = this->getTag();
   data(1) = dimension;
   data(2) = numDOF;
@@ -686,7 +674,7 @@ InertiaTruss::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &the
   // inertiatruss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(12);
+  static thread_local Vector data(12);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr <<"WARNING InertiaTruss::recvSelf() - failed to receive Vector\n";
@@ -729,8 +717,8 @@ int
 InertiaTruss::displaySelf(Renderer &theViewer, int displayMode, float fact, 
 		   const char **displayModes, int numModes)
 {
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
     int res = 0;
     if (L == 0.0)
         return res;
@@ -843,8 +831,8 @@ int
 InertiaTruss::getResponse(int responseID, Information &eleInfo)
 {
     int numDOF2 = numDOF / 2;
-    static Vector fVec_Acc(1);
-    static Vector fVec_AxialForce(1);
+    static thread_local Vector fVec_Acc(1);
+    static thread_local Vector fVec_AxialForce(1);
     const Vector& acc1 = theNodes[0]->getTrialAccel();
     const Vector& acc2 = theNodes[1]->getTrialAccel();
     Vector toret = acc2 - acc1;
@@ -902,7 +890,7 @@ InertiaTruss::getKiSensitivity(int gradNumber)
 {
 	opserr << "InertiaTruss::addInertiaLoadSensitivityToUnbalance " <<
 		"not ready for sensitivity analysis yet\n";
-	Matrix &Error = *theMatrix;
+	Matrix &Error = this->workMatrix();
 	Error.Zero();
 	return Error;
 }
@@ -912,7 +900,7 @@ InertiaTruss::getMassSensitivity(int gradNumber)
 {
 	opserr << "InertiaTruss::addInertiaLoadSensitivityToUnbalance " <<
 		"not ready for sensitivity analysis yet\n";
-	Matrix &Mmass = *theMatrix;
+	Matrix &Mmass = this->workMatrix();
 	Mmass.Zero();
 
 	return Mmass;
@@ -921,11 +909,13 @@ InertiaTruss::getMassSensitivity(int gradNumber)
 const Vector &
 InertiaTruss::getResistingForceSensitivity(int gradNumber)
 {
+	Vector &theVector = this->workVector();
+
 	opserr << "InertiaTruss::addInertiaLoadSensitivityToUnbalance " <<
 		"not ready for sensitivity analysis yet\n";
-	theVector->Zero();
+	theVector.Zero();
 
-	return *theVector;
+	return theVector;
 }
 
 int
@@ -937,3 +927,31 @@ InertiaTruss::commitSensitivity(int gradNumber, int numGrads)
 }
 
 // AddingSensitivity:END /////////////////////////////////////////////
+
+Matrix &
+InertiaTruss::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return trussM2;
+    case 4:   return trussM4;
+    case 6:   return trussM6;
+    case 12:  return trussM12;
+    default: return trussM2;
+  }
+}
+
+Vector &
+InertiaTruss::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return trussV2;
+    case 4:   return trussV4;
+    case 6:   return trussV6;
+    case 12:  return trussV12;
+    default: return trussV2;
+  }
+}
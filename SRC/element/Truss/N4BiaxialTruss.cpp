@@ -40,16 +40,16 @@
 //#include <fstream>
 
 // initialise the class wide variables
-Matrix N4BiaxialTruss::trussM2(2,2);
-Matrix N4BiaxialTruss::trussM8(8,8);
-Matrix N4BiaxialTruss::trussM12(12,12);
-Matrix N4BiaxialTruss::trussM24(24,24);
-Vector N4BiaxialTruss::trussV2(2);
-Vector N4BiaxialTruss::trussV4(4);
-Vector N4BiaxialTruss::trussV6(6);
-Vector N4BiaxialTruss::trussV8(8);
-Vector N4BiaxialTruss::trussV12(12);
-Vector N4BiaxialTruss::trussV24(24);
+thread_local Matrix N4BiaxialTruss::trussM2(2,2);
+thread_local Matrix N4BiaxialTruss::trussM8(8,8);
+thread_local Matrix N4BiaxialTruss::trussM12(12,12);
+thread_local Matrix N4BiaxialTruss::trussM24(24,24);
+thread_local Vector N4BiaxialTruss::trussV2(2);
+thread_local Vector N4BiaxialTruss::trussV4(4);
+thread_local Vector N4BiaxialTruss::trussV6(6);
+thread_local Vector N4BiaxialTruss::trussV8(8);
+thread_local Vector N4BiaxialTruss::trussV12(12);
+thread_local Vector N4BiaxialTruss::trussV24(24);
 
 // constructor:
 //  responsible for allocating the necessary space needed by each object
@@ -150,7 +150,6 @@ theMaterial_1(0), theBetaMaterial_1(0),
 theMaterial_2(0), theBetaMaterial_2(0), 
 connectedExternalNodes(4),
 dimension(dim), numDOF(0), theLoad(0),
-theMatrix(0), theVector(0), theVector2(0),
 L(0.0), A(a), rho(r), doRayleighDamping(damp)
 {
 	// get a copy of the material and check we obtained a valid copy
@@ -194,7 +193,6 @@ theMaterial_1(0), theBetaMaterial_1(0),
 theMaterial_2(0), theBetaMaterial_2(0), 
 connectedExternalNodes(2),
 dimension(0), numDOF(0), theLoad(0),
-theMatrix(0), theVector(0), theVector2(0),
 L(0.0), A(0.0), rho(0.0)
 {
 	// ensure the connectedExternalNode ID is of correct size 
@@ -288,9 +286,6 @@ N4BiaxialTruss::setDomain(Domain *theDomain)
 		
 		// fill this in so don't segment fault later
 		numDOF = 2;    
-		theMatrix = &trussM2;
-		theVector = &trussV2;	
-		theVector2 = &trussV2;	
 		return;
 	} else if ((theNodes[1] == 0)) {
 		opserr <<"N4BiaxialTruss::setDomain() - N4BiaxialTruss" << this->getTag() << " node " << Nd2 <<
@@ -298,9 +293,6 @@ N4BiaxialTruss::setDomain(Domain *theDomain)
 		
 		// fill this in so don't segment fault later
 		numDOF = 2;    
-		theMatrix = &trussM2;
-		theVector = &trussV2;	
-		theVector2 = &trussV2;	
 		return;
 	} else if ((theNodes[2] == 0)) {
 		opserr <<"N4BiaxialTruss::setDomain() - N4BiaxialTruss" << this->getTag() << " node " << GNd1 <<
@@ -308,9 +300,6 @@ N4BiaxialTruss::setDomain(Domain *theDomain)
 		
 		// fill this in so don't segment fault later
 		numDOF = 2;    
-		theMatrix = &trussM2;
-		theVector = &trussV2;	
-		theVector2 = &trussV2;	
 		return;
 	} else if ((theNodes[3] == 0)) {
 		opserr <<"N4BiaxialTruss::setDomain() - N4BiaxialTruss" << this->getTag() << " node " << GNd2 <<
@@ -318,9 +307,6 @@ N4BiaxialTruss::setDomain(Domain *theDomain)
 		
 		// fill this in so don't segment fault later
 		numDOF = 2;    
-		theMatrix = &trussM2;
-		theVector = &trussV2;	
-		theVector2 = &trussV2;	
 		return;
 	}
 
@@ -336,9 +322,6 @@ N4BiaxialTruss::setDomain(Domain *theDomain)
 
 		// fill this in so don't segment fault later
 		numDOF = 2;    
-		theMatrix = &trussM2;
-		theVector = &trussV2;	
-		theVector2 = &trussV2;	
 		
 		return;
 	}	
@@ -349,36 +332,21 @@ N4BiaxialTruss::setDomain(Domain *theDomain)
 	// now set the number of dof for element and set matrix and vector pointer
 	if (dimension == 2 && dofNd1 == 2) {
 		numDOF = 8;
-		theMatrix = &trussM8;
-		theVector = &trussV8;	
-		theVector2 = &trussV4;	
 	}
 	else if (dimension == 2 && dofNd1 == 3) {
 		numDOF = 12;	
-		theMatrix = &trussM12;
-		theVector = &trussV12;		
-		theVector2 = &trussV6;
 	}
 	else if (dimension == 3 && dofNd1 == 3) {
 		numDOF = 12;	
-		theMatrix = &trussM12;
-		theVector = &trussV12;			
-		theVector2 = &trussV6;
 	}
 	else if (dimension == 3 && dofNd1 == 6) {
 		numDOF = 24;	    
-		theMatrix = &trussM24;
-		theVector = &trussV24;			
-		theVector2 = &trussV12;	
 	}
 	else {
 		opserr <<"WARNING N4BiaxialTruss::setDomain cannot handle " << dimension << " dofs at nodes in " << 
 		dofNd1  << " problem\n";
 
 		numDOF = 2;    
-		theMatrix = &trussM2;
-		theVector = &trussV2;	
-		theVector2 = &trussV2;	
 		return;
 	}
 
@@ -588,16 +556,18 @@ N4BiaxialTruss::update(void)
 const Matrix &
 N4BiaxialTruss::getTangentStiff(void)
 {
+	Matrix &theMatrix = this->workMatrix();
+
 	if (L == 0.0) { // - problem in setDomain() no further warnings
-		theMatrix->Zero();
-		return *theMatrix;
+		theMatrix.Zero();
+		return theMatrix;
 	}
 	
 	double E1 = theMaterial_1->getTangent();
 	double E2 = theMaterial_2->getTangent();
 
 	// come back later and redo this if too slow
-	Matrix &stiff = *theMatrix;
+	Matrix &stiff = theMatrix;
 	stiff.Zero();
 
 	int numDOF2 = numDOF/4;
@@ -627,16 +597,18 @@ N4BiaxialTruss::getTangentStiff(void)
 const Matrix &
 N4BiaxialTruss::getInitialStiff(void)
 {
+	Matrix &theMatrix = this->workMatrix();
+
 	if (L == 0.0) { // - problem in setDomain() no further warnings
-		return *theMatrix;
-		theMatrix->Zero();
+		return theMatrix;
+		theMatrix.Zero();
 	}
 	
 	double E1 = theMaterial_1->getInitialTangent();
 	double E2 = theMaterial_2->getInitialTangent();
 
 	// come back later and redo this if too slow
-	Matrix &stiff = *theMatrix;
+	Matrix &stiff = theMatrix;
 	stiff.Zero();    
 
 	int numDOF2 = numDOF/4;
@@ -665,21 +637,23 @@ N4BiaxialTruss::getInitialStiff(void)
 const Matrix &
 N4BiaxialTruss::getDamp(void)
 {
+	Matrix &theMatrix = this->workMatrix();
+
 	if (L == 0.0) { // - problem in setDomain() no further warnings
-		theMatrix->Zero();
-		return *theMatrix;
+		theMatrix.Zero();
+		return theMatrix;
 	}
-	theMatrix->Zero();
+	theMatrix.Zero();
 
 	if (doRayleighDamping == 1) {
-		*theMatrix = this->Element::getDamp();
+		theMatrix = this->Element::getDamp();
 	}
 
 	double eta = theMaterial_1->getDampTangent();
 	double eta2 = theMaterial_2->getDampTangent();
 
 	// come back later and redo this if too slow
-	Matrix &damp = *theMatrix;
+	Matrix &damp = theMatrix;
 
 	int numDOF2 = numDOF/4;
 	double temp, temp2;
@@ -709,7 +683,7 @@ const Matrix &
 N4BiaxialTruss::getMass(void)
 {   
 	// zero the matrix
-	Matrix &mass = *theMatrix;
+	Matrix &mass = this->workMatrix();
 	mass.Zero();    
 
 	// check for quick return
@@ -783,9 +757,11 @@ N4BiaxialTruss::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 N4BiaxialTruss::getResistingForce()
 {	
+	Vector &theVector = this->workVector();
+
 	if (L == 0.0) { // - problem in setDomain() no further warnings
-		theVector->Zero();
-		return *theVector;
+		theVector.Zero();
+		return theVector;
 	}
 	
 	// R = Ku - Pext
@@ -796,23 +772,25 @@ N4BiaxialTruss::getResistingForce()
 	double temp;
 	for (int i = 0; i < dimension; i++) {
 		temp = cosX[i]*force1;
-		(*theVector)(i) = -temp;
-		(*theVector)(i+numDOF2) = temp;
+		theVector(i) = -temp;
+		theVector(i+numDOF2) = temp;
 		temp = cosX2[i]*force2;
-		(*theVector)(i+2*numDOF2) = -temp;
-		(*theVector)(i+3*numDOF2) = temp;
+		theVector(i+2*numDOF2) = -temp;
+		theVector(i+3*numDOF2) = temp;
 	}
 
 	// subtract external load:  Ku - P
-	(*theVector) -= *theLoad;
+	theVector -= *theLoad;
 
-	return *theVector;
+	return theVector;
 }
 
 
 const Vector &
 N4BiaxialTruss::getResistingForceIncInertia()
 {	
+	Vector &theVector = this->workVector();
+
 	this->getResistingForce();
 
 	// now include the mass portion
@@ -826,23 +804,23 @@ N4BiaxialTruss::getResistingForceIncInertia()
 		int numDOF2 = numDOF/4;
 		double M = 0.5*rho*L;
 		for (int i = 0; i < dimension; i++) {
-			(*theVector)(i) += M*accel1(i);
-			(*theVector)(i+numDOF2) += M*accel2(i);
-			(*theVector)(i+2*numDOF2) += M*accel3(i);
-			(*theVector)(i+3*numDOF2) += M*accel4(i);
+			theVector(i) += M*accel1(i);
+			theVector(i+numDOF2) += M*accel2(i);
+			theVector(i+2*numDOF2) += M*accel3(i);
+			theVector(i+3*numDOF2) += M*accel4(i);
 		}
 		
 		// add the damping forces if rayleigh damping
 		if (doRayleighDamping == 1 && (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-		(*theVector) += this->getRayleighDampingForces();
+		theVector += this->getRayleighDampingForces();
 	}  else {
 		
 		// add the damping forces if rayleigh damping
 		if (doRayleighDamping == 1 && (betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-		(*theVector) += this->getRayleighDampingForces();
+		theVector += this->getRayleighDampingForces();
 	}
 
-	return *theVector;
+	return theVector;
 }
 
 int
@@ -858,7 +836,7 @@ N4BiaxialTruss::sendSelf(int commitTag, Channel &theChannel)
 	// N4BiaxialTruss packs it's data into a Vector and sends this to theChannel
 	// along with it's dbTag and the commitTag passed in the arguments
 
-	static Vector data(11);
+	static thread_local Vector data(11);
 	data(0) = this->getTag();
 	data(1) = dimension;
 	data(2) = numDOF;
@@ -926,7 +904,7 @@ N4BiaxialTruss::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &t
 
 	// N4BiaxialTruss creates a Vector, receives the Vector and then sets the 
 	// internal data with the data in the Vector
-	static Vector data(11);
+	static thread_local Vector data(11);
 	res = theChannel.recvVector(dataTag, commitTag, data);
 	if (res < 0) {
 		opserr <<"WARNING N4BiaxialTruss::recvSelf() - failed to receive Vector\n";
@@ -1023,10 +1001,10 @@ N4BiaxialTruss::displaySelf(Renderer &theViewer, int displayMode, float fact, co
 	return 0;
 
 	// get display coordinates
-	static Vector v1(3);
-	static Vector v2(3);
-	static Vector v3(3);
-	static Vector v4(3);
+	static thread_local Vector v1(3);
+	static thread_local Vector v2(3);
+	static thread_local Vector v3(3);
+	static thread_local Vector v4(3);
 	theNodes[0]->getDisplayCrds(v1, fact, displayMode);
 	theNodes[1]->getDisplayCrds(v2, fact, displayMode);
 	theNodes[2]->getDisplayCrds(v3, fact, displayMode);
@@ -1070,6 +1048,8 @@ N4BiaxialTruss::displaySelf(Renderer &theViewer, int displayMode, float fact, co
 void
 N4BiaxialTruss::Print(OPS_Stream &s, int flag)
 {
+	Vector &theVector2 = this->workVector2();
+
 	// compute the strain and axial force in the member
 	double strain1, force1, strain2, force2;
 	strain1 = theMaterial_1->getStrain();
@@ -1091,10 +1071,10 @@ N4BiaxialTruss::Print(OPS_Stream &s, int flag)
 			double temp;
 			for (int i = 0; i < dimension; i++) {
 				temp = cosX[i]*force1;
-				(*theVector2)(i) = -temp;
-				(*theVector2)(i+numDOF2) = temp;
+				theVector2(i) = -temp;
+				theVector2(i+numDOF2) = temp;
 			}
-			s << " \n\t unbalanced load: " << *theVector2;	
+			s << " \n\t unbalanced load: " << theVector2;	
 		}
 
 		s << " \t Material: " << *theMaterial_1;
@@ -1113,10 +1093,10 @@ N4BiaxialTruss::Print(OPS_Stream &s, int flag)
 			double temp;
 			for (int i = 0; i < dimension; i++) {
 				temp = cosX[i]*force1;
-				(*theVector2)(i) = -temp;
-				(*theVector2)(i+numDOF2) = temp;
+				theVector2(i) = -temp;
+				theVector2(i+numDOF2) = temp;
 			}
-			s << " \n\t unbalanced load: " << *theVector2;	
+			s << " \n\t unbalanced load: " << theVector2;	
 		}
 
 		s << " \t Material: " << *theMaterial_2;
@@ -1326,3 +1306,45 @@ N4BiaxialTruss::getResponse(int responseID, Information &eleInfo)
 		return 0;
 	}
 }
+
+Matrix &
+N4BiaxialTruss::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return trussM2;
+    case 8:   return trussM8;
+    case 12:  return trussM12;
+    case 24:  return trussM24;
+    default: return trussM2;
+  }
+}
+
+Vector &
+N4BiaxialTruss::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return trussV2;
+    case 8:   return trussV8;
+    case 12:  return trussV12;
+    case 24:  return trussV24;
+    default: return trussV2;
+  }
+}
+
+Vector &
+N4BiaxialTruss::workVector2(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return trussV2;
+    case 8:   return trussV4;
+    case 12:  return trussV6;
+    case 24:  return trussV12;
+    default: return trussV2;
+  }
+}
@@ -100,9 +100,9 @@ class N4BiaxialTruss : public Element
     int numDOF;	                    // number of dof for truss
 
     Vector *theLoad;     // pointer to the load vector P
-    Matrix *theMatrix; // pointer to objects matrix (a class wide Matrix)
-    Vector *theVector; // pointer to objects vector (a clas wide Vector)
-    Vector *theVector2; // pointer to objects half size vector (a clas wide Vector)
+    Matrix &workMatrix(void) const;  // class wide matrix of the calling thread
+    Vector &workVector(void) const;  // class wide vector of the calling thread
+    Vector &workVector2(void) const;  // class wide vector of the calling thread
 
     double L;	    // length of truss based on undeformed configuration
     double L2;	    // length of truss based on undeformed configuration
@@ -135,16 +135,16 @@ class N4BiaxialTruss : public Element
 	double oneOver2Ly;
 
     // static data - single copy for all objects of the class	
-    static Matrix trussM2;   // class wide matrix for 2*2
-    static Matrix trussM8;   // class wide matrix for 8*8
-    static Matrix trussM12;   // class wide matrix for 12*12
-    static Matrix trussM24;  // class wide matrix for 24*24
-    static Vector trussV2;   // class wide Vector for size 2
-    static Vector trussV4;   // class wide Vector for size 4
-    static Vector trussV6;   // class wide Vector for size 6
-    static Vector trussV8;   // class wide Vector for size 8
-    static Vector trussV12;   // class wide Vector for size 12
-    static Vector trussV24;  // class wide Vector for size 24
+    static thread_local Matrix trussM2;   // class wide matrix for 2*2
+    static thread_local Matrix trussM8;   // class wide matrix for 8*8
+    static thread_local Matrix trussM12;   // class wide matrix for 12*12
+    static thread_local Matrix trussM24;  // class wide matrix for 24*24
+    static thread_local Vector trussV2;   // class wide Vector for size 2
+    static thread_local Vector trussV4;   // class wide Vector for size 4
+    static thread_local Vector trussV6;   // class wide Vector for size 6
+    static thread_local Vector trussV8;   // class wide Vector for size 8
+    static thread_local Vector trussV12;   // class wide Vector for size 12
+    static thread_local Vector trussV24;  // class wide Vector for size 24
 };
 
 #endif
@@ -44,14 +44,14 @@
 //#include <fstream>
 
 // initialise the class wide variables
-Matrix Truss::trussM2(2,2);
-Matrix Truss::trussM4(4,4);
-Matrix Truss::trussM6(6,6);
-Matrix Truss::trussM12(12,12);
-Vector Truss::trussV2(2);
-Vector Truss::trussV4(4);
-Vector Truss::trussV6(6);
-Vector Truss::trussV12(12);
+thread_local Matrix Truss::trussM2(2,2);
+thread_local Matrix Truss::trussM4(4,4);
+thread_local Matrix Truss::trussM6(6,6);
+thread_local Matrix Truss::trussM12(12,12);
+thread_local Vector Truss::trussV2(2);
+thread_local Vector Truss::trussV4(4);
+thread_local Vector Truss::trussV6(6);
+thread_local Vector Truss::trussV12(12);
 
 // constructor:
 //  responsible for allocating the necessary space needed by each object
@@ -174,7 +174,7 @@ Truss::Truss(int tag, int dim,
  :Element(tag,ELE_TAG_Truss),
   theMaterial(0), connectedExternalNodes(2),
   dimension(dim), numDOF(0),
-  theLoad(0), theMatrix(0), theVector(0),
+  theLoad(0),
   L(0.0), A(a), rho(r), doRayleighDamping(damp),
   cMass(cm), useInitialDisp(initDisp), initialDisp(0)
 {
@@ -216,7 +216,7 @@ Truss::Truss()
 :Element(0,ELE_TAG_Truss),     
  theMaterial(0),connectedExternalNodes(2),
  dimension(0), numDOF(0),
- theLoad(0), theMatrix(0), theVector(0),
+ theLoad(0),
  L(0.0), A(0.0), rho(0.0), doRayleighDamping(0),
  cMass(0), useInitialDisp(false), initialDisp(0)
 {
@@ -316,8 +316,6 @@ Truss::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
 
       return;
     }
@@ -333,8 +331,6 @@ Truss::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
 	
       return;
     }	
@@ -345,36 +341,24 @@ Truss::setDomain(Domain *theDomain)
     // now set the number of dof for element and set matrix and vector pointer
     if (dimension == 1 && dofNd1 == 1) {
 	numDOF = 2;    
-	theMatrix = &trussM2;
-	theVector = &trussV2;
     }
     else if (dimension == 2 && dofNd1 == 2) {
 	numDOF = 4;
-	theMatrix = &trussM4;
-	theVector = &trussV4;	
     }
     else if (dimension == 2 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &trussM6;
-	theVector = &trussV6;		
     }
     else if (dimension == 3 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &trussM6;
-	theVector = &trussV6;			
     }
     else if (dimension == 3 && dofNd1 == 6) {
 	numDOF = 12;	    
-	theMatrix = &trussM12;
-	theVector = &trussV12;			
     }
     else {
       opserr <<"WARNING Truss::setDomain cannot handle " << dimension << " dofs at nodes in " << 
 	dofNd1  << " problem\n";
 
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
       return;
     }
 
@@ -516,18 +500,28 @@ Truss::update(void)
 }
 
 
+bool
+Truss::isThreadSafe(void) const
+{
+  // the work areas are per thread, so the element is safe
+  // whenever its material is
+  return theMaterial != nullptr && theMaterial->isThreadSafe();
+}
+
 const Matrix &
 Truss::getTangentStiff(void)
 {
+    Matrix &theMatrix = this->workMatrix();
+
     if (L == 0.0) { // - problem in setDomain() no further warnings
-	theMatrix->Zero();
-	return *theMatrix;
+	theMatrix.Zero();
+	return theMatrix;
     }
     
     double E = theMaterial->getTangent();
 
     // come back later and redo this if too slow
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = theMatrix;
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -549,15 +543,17 @@ Truss::getTangentStiff(void)
 const Matrix &
 Truss::getInitialStiff(void)
 {
+    Matrix &theMatrix = this->workMatrix();
+
     if (L == 0.0) { // - problem in setDomain() no further warnings
-	theMatrix->Zero();
-	return *theMatrix;
+	theMatrix.Zero();
+	return theMatrix;
     }
     
     double E = theMaterial->getInitialTangent();
 
     // come back later and redo this if too slow
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = theMatrix;
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -572,26 +568,28 @@ Truss::getInitialStiff(void)
       }
     }
 
-    return *theMatrix;
+    return theMatrix;
 }
 
 const Matrix &
 Truss::getDamp(void)
 {
+  Matrix &theMatrix = this->workMatrix();
+
   if (L == 0.0) { // - problem in setDomain() no further warnings
-    theMatrix->Zero();
-    return *theMatrix;
+    theMatrix.Zero();
+    return theMatrix;
   }
 
-  theMatrix->Zero();
+  theMatrix.Zero();
   
   if (doRayleighDamping == 1)
-    *theMatrix = this->Element::getDamp();
+    theMatrix = this->Element::getDamp();
 
   double eta = theMaterial->getDampTangent();
   
   // come back later and redo this if too slow
-  Matrix &damp = *theMatrix;
+  Matrix &damp = theMatrix;
 
   int numDOF2 = numDOF/2;
   double temp;
@@ -614,7 +612,7 @@ const Matrix &
 Truss::getMass(void)
 {
   // zero the matrix
-  Matrix &mass = *theMatrix;
+  Matrix &mass = this->workMatrix();
   mass.Zero();
   
   // check for quick return
@@ -791,9 +789,11 @@ Truss::addInertiaLoadSensitivityToUnbalance(const Vector &accel, bool somethingR
 const Vector &
 Truss::getResistingForce()
 {	
+    Vector &theVector = this->workVector();
+
     if (L == 0.0) { // - problem in setDomain() no further warnings
-	theVector->Zero();
-	return *theVector;
+	theVector.Zero();
+	return theVector;
     }
     
     // R = Ku - Pext
@@ -803,20 +803,22 @@ Truss::getResistingForce()
     double temp;
     for (int i = 0; i < dimension; i++) {
       temp = cosX[i]*force;
-      (*theVector)(i) = -temp;
-      (*theVector)(i+numDOF2) = temp;
+      theVector(i) = -temp;
+      theVector(i+numDOF2) = temp;
     }
 
   // subtract external load
-  (*theVector) -= *theLoad;
+  theVector -= *theLoad;
     
-  return *theVector;
+  return theVector;
 }
 
 
 const Vector &
 Truss::getResistingForceIncInertia()
 {	
+  Vector &theVector = this->workVector();
+
   this->getResistingForce();
   
   // now include the mass portion
@@ -832,29 +834,29 @@ Truss::getResistingForceIncInertia()
       // lumped mass matrix
       double m = 0.5*rho*L;
       for (int i = 0; i < dimension; i++) {
-        (*theVector)(i) += m*accel1(i);
-        (*theVector)(i+numDOF2) += m*accel2(i);
+        theVector(i) += m*accel1(i);
+        theVector(i+numDOF2) += m*accel2(i);
       }
     } else  {
       // consistent mass matrix
       double m = rho*L/6.0;
       for (int i=0; i<dimension; i++) {
-        (*theVector)(i) += 2.0*m*accel1(i) + m*accel2(i);
-        (*theVector)(i+numDOF2) += m*accel1(i) + 2.0*m*accel2(i);
+        theVector(i) += 2.0*m*accel1(i) + m*accel2(i);
+        theVector(i+numDOF2) += m*accel1(i) + 2.0*m*accel2(i);
       }
     }
     
     // add the damping forces if rayleigh damping
     if (doRayleighDamping == 1 && (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-      theVector->addVector(1.0, this->getRayleighDampingForces(), 1.0);
+      theVector.addVector(1.0, this->getRayleighDampingForces(), 1.0);
   } else {
     
     // add the damping forces if rayleigh damping
     if (doRayleighDamping == 1 && (betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-      theVector->addVector(1.0, this->getRayleighDampingForces(), 1.0);
+      theVector.addVector(1.0, this->getRayleighDampingForces(), 1.0);
   }
   
-  return *theVector;
+  return theVector;
 }
 
 int
@@ -870,7 +872,7 @@ Truss::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(13);
+  static thread_local Vector data(13);
   data(0) = this->getTag();
   data(1) = dimension;
   data(2) = numDOF;
@@ -930,7 +932,7 @@ Truss::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
   // truss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(13);
+  static thread_local Vector data(13);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr <<"WARNING Truss::recvSelf() - failed to receive Vector\n";
@@ -1014,8 +1016,8 @@ Truss::displaySelf(Renderer &theViewer, int displayMode, float fact,
   if (L == 0.0)
     return res;
 
-  static Vector v1(3);
-  static Vector v2(3);
+  static thread_local Vector v1(3);
+  static thread_local Vector v2(3);
   float d1 = 0.0;
   float d2 = 0.0;
 
@@ -1060,6 +1062,8 @@ Truss::displaySelf(Renderer &theViewer, int displayMode, float fact,
 void
 Truss::Print(OPS_Stream &s, int flag)
 {
+    Vector &theVector = this->workVector();
+
     // compute the strain and axial force in the member
     double strain, force;
     strain = theMaterial->getStrain();
@@ -1086,10 +1090,10 @@ Truss::Print(OPS_Stream &s, int flag)
                       double temp;
                       for (int i = 0; i < dimension; i++) {
                               temp = cosX[i] * force;
-                              (*theVector)(i) = -temp;
-                              (*theVector)(i + numDOF2) = temp;
+                              theVector(i) = -temp;
+                              theVector(i + numDOF2) = temp;
                       }
-                      s << " \n\t unbalanced load: " << *theVector;
+                      s << " \n\t unbalanced load: " << theVector;
               }
       
               s << " \t Material: " << *theMaterial;
@@ -1245,8 +1249,8 @@ int
 Truss::getResponse(int responseID, Information &eleInfo)
 {
   double strain, force;
-    static Vector fVec(1);
-    static Matrix kVec(1,1);
+    static thread_local Vector fVec(1);
+    static thread_local Matrix kVec(1,1);
 
     switch (responseID) {
     case 1:
@@ -1346,7 +1350,7 @@ Truss::activateParameter(int passedParameterID)
 const Matrix &
 Truss::getKiSensitivity(int gradNumber)
 {
-  Matrix &stiff = *theMatrix;
+  Matrix &stiff = this->workMatrix();
   stiff.Zero();
     
   if (parameterID == 0) {
@@ -1394,7 +1398,7 @@ Truss::getKiSensitivity(int gradNumber)
 const Matrix &
 Truss::getMassSensitivity(int gradNumber)
 {
-  Matrix &mass = *theMatrix;
+  Matrix &mass = this->workMatrix();
   mass.Zero();
   
   if (parameterID == 2) {
@@ -1426,7 +1430,9 @@ Truss::getMassSensitivity(int gradNumber)
 const Vector &
 Truss::getResistingForceSensitivity(int gradNumber)
 {
-	theVector->Zero();
+	Vector &theVector = this->workVector();
+
+	theVector.Zero();
 
 	// Initial declarations
 	int i;
@@ -1533,15 +1539,15 @@ Truss::getResistingForceSensitivity(int gradNumber)
 	if (parameterID == 1) {			// Cross-sectional area
 	  for (i = 0; i < dimension; i++) {
 	    temp = (stress + A*stressSensitivity)*cosX[i];
-	    (*theVector)(i) = -temp;
-	    (*theVector)(i+numDOF2) = temp;
+	    theVector(i) = -temp;
+	    theVector(i+numDOF2) = temp;
 	  }
 	}
 	else {		// Density, material parameter or nodal coordinate
 	  for (i = 0; i < dimension; i++) {
 	    temp = A*(stressSensitivity*cosX[i] + stress*dcosXdh[i]);
-	    (*theVector)(i) = -temp;
-	    (*theVector)(i+numDOF2) = temp;
+	    theVector(i) = -temp;
+	    theVector(i+numDOF2) = temp;
 	  }
 	}
 
@@ -1549,9 +1555,9 @@ Truss::getResistingForceSensitivity(int gradNumber)
 	if (theLoadSens == 0) {
 		theLoadSens = new Vector(numDOF);
 	}
-	(*theVector) -= *theLoadSens;
+	theVector -= *theLoadSens;
 
-	return *theVector;
+	return theVector;
 }
 
 int
@@ -1663,3 +1669,31 @@ Truss::commitSensitivity(int gradNumber, int numGrads)
 }
 
 // AddingSensitivity:END /////////////////////////////////////////////
+
+Matrix &
+Truss::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return trussM2;
+    case 4:   return trussM4;
+    case 6:   return trussM6;
+    case 12:  return trussM12;
+    default: return trussM2;
+  }
+}
+
+Vector &
+Truss::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return trussV2;
+    case 4:   return trussV4;
+    case 6:   return trussV6;
+    case 12:  return trussV12;
+    default: return trussV2;
+  }
+}
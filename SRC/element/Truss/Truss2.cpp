@@ -43,14 +43,14 @@
 //#include <fstream>
 
 // initialise the class wide variables
-Matrix Truss2::trussM2(2,2);
-Matrix Truss2::trussM4(4,4);
-Matrix Truss2::trussM6(6,6);
-Matrix Truss2::trussM12(12,12);
-Vector Truss2::trussV2(2);
-Vector Truss2::trussV4(4);
-Vector Truss2::trussV6(6);
-Vector Truss2::trussV12(12);
+thread_local Matrix Truss2::trussM2(2,2);
+thread_local Matrix Truss2::trussM4(4,4);
+thread_local Matrix Truss2::trussM6(6,6);
+thread_local Matrix Truss2::trussM12(12,12);
+thread_local Vector Truss2::trussV2(2);
+thread_local Vector Truss2::trussV4(4);
+thread_local Vector Truss2::trussV6(6);
+thread_local Vector Truss2::trussV12(12);
 
 // constructor:
 //  responsible for allocating the necessary space needed by each object
@@ -150,7 +150,6 @@ Truss2::Truss2(int tag,
 	:Element(tag,ELE_TAG_Truss2),     
 	theMaterial(0), theBetaMaterial(0), connectedExternalNodes(2), connectedExternalOtherNodes(2),
 	dimension(dim), numDOF(0), theLoad(0),
-	theMatrix(0), theVector(0),
 	L(0.0), A(a), rho(r), doRayleighDamping(damp)
 {
 	// get a copy of the material and check we obtained a valid copy
@@ -199,7 +198,6 @@ Truss2::Truss2()
 	:Element(0,ELE_TAG_Truss2),     
 	theMaterial(0),connectedExternalNodes(2), connectedExternalOtherNodes(2),
 	dimension(0), numDOF(0), theLoad(0),
-	theMatrix(0), theVector(0),
 	L(0.0), A(0.0), rho(0.0)
 {
 
@@ -315,8 +313,6 @@ void
 
 		// fill this in so don't segment fault later
 		numDOF = 2;    
-		theMatrix = &trussM2;
-		theVector = &trussV2;	
 
 		return;
 	}
@@ -332,8 +328,6 @@ void
 
 		// fill this in so don't segment fault later
 		numDOF = 2;    
-		theMatrix = &trussM2;
-		theVector = &trussV2;	
 
 		return;
 	}	
@@ -344,36 +338,24 @@ void
 	// now set the number of dof for element and set matrix and vector pointer
 	if (dimension == 1 && dofNd1 == 1) {
 		numDOF = 2;    
-		theMatrix = &trussM2;
-		theVector = &trussV2;
 	}
 	else if (dimension == 2 && dofNd1 == 2) {
                 numDOF = 4;
-                theMatrix = &trussM4;
-                theVector = &trussV4;	
         }
         else if (dimension == 2 && dofNd1 == 3) {
                 numDOF = 6;	
-                theMatrix = &trussM6;
-                theVector = &trussV6;		
         }
         else if (dimension == 3 && dofNd1 == 3) {
                 numDOF = 6;	
-                theMatrix = &trussM6;
-                theVector = &trussV6;			
         }
         else if (dimension == 3 && dofNd1 == 6) {
                 numDOF = 12;	    
-                theMatrix = &trussM12;
-                theVector = &trussV12;			
         }
         else {
                 opserr <<"WARNING Truss2::setDomain cannot handle " << dimension << " dofs at nodes in " << 
                         dofNd1  << " problem\n";
 
                 numDOF = 2;    
-                theMatrix = &trussM2;
-                theVector = &trussV2;	
                 return;
         }
 
@@ -540,15 +522,17 @@ int
 const Matrix &
 	Truss2::getTangentStiff(void)
 {
+	Matrix &theMatrix = this->workMatrix();
+
 	if (L == 0.0) { // - problem in setDomain() no further warnings
-		theMatrix->Zero();
-		return *theMatrix;
+		theMatrix.Zero();
+		return theMatrix;
 	}
 
 	double E = theMaterial->getTangent();
 
 	// come back later and redo this if too slow
-	Matrix &stiff = *theMatrix;
+	Matrix &stiff = theMatrix;
 
 	int numDOF2 = numDOF/2;
 	double temp;
@@ -570,15 +554,17 @@ const Matrix &
 const Matrix &
 	Truss2::getInitialStiff(void)
 {
+	Matrix &theMatrix = this->workMatrix();
+
 	if (L == 0.0) { // - problem in setDomain() no further warnings
-		theMatrix->Zero();
-		return *theMatrix;
+		theMatrix.Zero();
+		return theMatrix;
 	}
 
 	double E = theMaterial->getInitialTangent();
 
 	// come back later and redo this if too slow
-	Matrix &stiff = *theMatrix;
+	Matrix &stiff = theMatrix;
 
 	int numDOF2 = numDOF/2;
 	double temp;
@@ -593,26 +579,28 @@ const Matrix &
 		}
 	}
 
-	return *theMatrix;
+	return theMatrix;
 }
 
 const Matrix &
 	Truss2::getDamp(void)
 {
+	Matrix &theMatrix = this->workMatrix();
+
 	if (L == 0.0) { // - problem in setDomain() no further warnings
-		theMatrix->Zero();
-		return *theMatrix;
+		theMatrix.Zero();
+		return theMatrix;
 	}
 
-	theMatrix->Zero();
+	theMatrix.Zero();
 
 	if (doRayleighDamping == 1)
-		*theMatrix = this->Element::getDamp();
+		theMatrix = this->Element::getDamp();
 
 	double eta = theMaterial->getDampTangent();
 
 	// come back later and redo this if too slow
-	Matrix &damp = *theMatrix;
+	Matrix &damp = theMatrix;
 
 	int numDOF2 = numDOF/2;
 	double temp;
@@ -635,7 +623,7 @@ const Matrix &
 	Truss2::getMass(void)
 {   
 	// zero the matrix
-	Matrix &mass = *theMatrix;
+	Matrix &mass = this->workMatrix();
 	mass.Zero();    
 
 	// check for quick return
@@ -798,9 +786,11 @@ int
 const Vector &
 	Truss2::getResistingForce()
 {	
+	Vector &theVector = this->workVector();
+
 	if (L == 0.0) { // - problem in setDomain() no further warnings
-		theVector->Zero();
-		return *theVector;
+		theVector.Zero();
+		return theVector;
 	}
 
 	// R = Ku - Pext
@@ -810,21 +800,23 @@ const Vector &
 	double temp;
 	for (int i = 0; i < dimension; i++) {
 		temp = cosX[i]*force;
-		(*theVector)(i) = -temp;
-		(*theVector)(i+numDOF2) = temp;
+		theVector(i) = -temp;
+		theVector(i+numDOF2) = temp;
 	}
     
-	return *theVector;
+	return theVector;
 }
 
 
 const Vector &
 	Truss2::getResistingForceIncInertia()
 {	
+	Vector &theVector = this->workVector();
+
 	this->getResistingForce();
     
 	// subtract external load
-	(*theVector) -= *theLoad;
+	theVector -= *theLoad;
     
 	// now include the mass portion
 	if (L != 0.0 && rho != 0.0) {
@@ -835,21 +827,21 @@ const Vector &
 		int numDOF2 = numDOF/2;
 		double M = 0.5*rho*L;
 		for (int i = 0; i < dimension; i++) {
-			(*theVector)(i) += M*accel1(i);
-			(*theVector)(i+numDOF2) += M*accel2(i);
+			theVector(i) += M*accel1(i);
+			theVector(i+numDOF2) += M*accel2(i);
 		}
 
 		// add the damping forces if rayleigh damping
 		if (doRayleighDamping == 1 && (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-			(*theVector) += this->getRayleighDampingForces();
+			theVector += this->getRayleighDampingForces();
 	}  else {
 
 		// add the damping forces if rayleigh damping
 		if (doRayleighDamping == 1 && (betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-			(*theVector) += this->getRayleighDampingForces();
+			theVector += this->getRayleighDampingForces();
 	}
 
-	return *theVector;
+	return theVector;
 }
 
 int Truss2::sendSelf(int commitTag, Channel &theChannel)
@@ -866,7 +858,7 @@ int Truss2::sendSelf(int commitTag, Channel &theChannel)
 	// truss packs it's data into a Vector and sends this to theChannel
 	// along with it's dbTag and the commitTag passed in the arguments
 
-	static Vector data(8);
+	static thread_local Vector data(8);
 	data(0) = this->getTag();
 	data(1) = dimension;
 	data(2) = numDOF;
@@ -931,7 +923,7 @@ int
 	// truss creates a Vector, receives the Vector and then sets the 
 	// internal data with the data in the Vector
 
-	static Vector data(8);
+	static thread_local Vector data(8);
 	res = theChannel.recvVector(dataTag, commitTag, data);
 	if (res < 0) {
 		opserr <<"WARNING Truss2::recvSelf() - failed to receive Vector\n";
@@ -1008,8 +1000,8 @@ Truss2::displaySelf(Renderer &theViewer, int displayMode, float fact, const char
 		return 0;
 
 	// get display coordinates
-	static Vector v1(3);
-	static Vector v2(3);
+	static thread_local Vector v1(3);
+	static thread_local Vector v2(3);
 	theNodes[0]->getDisplayCrds(v1, fact, displayMode);
 	theNodes[1]->getDisplayCrds(v2, fact, displayMode);
 
@@ -1042,6 +1034,8 @@ Truss2::displaySelf(Renderer &theViewer, int displayMode, float fact, const char
 void
 	Truss2::Print(OPS_Stream &s, int flag)
 {
+	Vector &theVector = this->workVector();
+
 	// compute the strain and axial force in the member
 	double strain, force;
 	strain = theMaterial->getStrain();
@@ -1060,10 +1054,10 @@ void
             double temp;
             for (int i = 0; i < dimension; i++) {
                 temp = cosX[i] * force;
-                (*theVector)(i) = -temp;
-                (*theVector)(i + numDOF2) = temp;
+                theVector(i) = -temp;
+                theVector(i + numDOF2) = temp;
             }
-            s << " \n\t unbalanced load: " << *theVector;
+            s << " \n\t unbalanced load: " << theVector;
         }
         
         s << " \t Material: " << *theMaterial;
@@ -1306,7 +1300,7 @@ int
 const Matrix &
 	Truss2::getKiSensitivity(int gradNumber)
 {
-	Matrix &stiff = *theMatrix;
+	Matrix &stiff = this->workMatrix();
 	stiff.Zero();
 
 	if (parameterID == 0) {
@@ -1354,7 +1348,7 @@ const Matrix &
 const Matrix &
 	Truss2::getMassSensitivity(int gradNumber)
 {
-	Matrix &mass = *theMatrix;
+	Matrix &mass = this->workMatrix();
 	mass.Zero();
 
 	if (parameterID == 2) {
@@ -1373,7 +1367,9 @@ const Matrix &
 const Vector &
 	Truss2::getResistingForceSensitivity(int gradNumber)
 {
-	theVector->Zero();
+	Vector &theVector = this->workVector();
+
+	theVector.Zero();
 
 	// Initial declarations
 	int i;
@@ -1480,15 +1476,15 @@ const Vector &
 	if (parameterID == 1) {			// Cross-sectional area
 		for (i = 0; i < dimension; i++) {
 			temp = (stress + A*stressSensitivity)*cosX[i];
-			(*theVector)(i) = -temp;
-			(*theVector)(i+numDOF2) = temp;
+			theVector(i) = -temp;
+			theVector(i+numDOF2) = temp;
 		}
 	}
 	else {		// Density, material parameter or nodal coordinate
 		for (i = 0; i < dimension; i++) {
 			temp = A*(stressSensitivity*cosX[i] + stress*dcosXdh[i]);
-			(*theVector)(i) = -temp;
-			(*theVector)(i+numDOF2) = temp;
+			theVector(i) = -temp;
+			theVector(i+numDOF2) = temp;
 		}
 	}
 
@@ -1496,9 +1492,9 @@ const Vector &
 	if (theLoadSens == 0) {
 		theLoadSens = new Vector(numDOF);
 	}
-	(*theVector) -= *theLoadSens;
+	theVector -= *theLoadSens;
 
-	return *theVector;
+	return theVector;
 }
 
 int
@@ -1612,3 +1608,31 @@ int
 }
 
 // AddingSensitivity:END /////////////////////////////////////////////
+
+Matrix &
+Truss2::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return trussM2;
+    case 4:   return trussM4;
+    case 6:   return trussM6;
+    case 12:  return trussM12;
+    default: return trussM2;
+  }
+}
+
+Vector &
+Truss2::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return trussV2;
+    case 4:   return trussV4;
+    case 6:   return trussV6;
+    case 12:  return trussV12;
+    default: return trussV2;
+  }
+}
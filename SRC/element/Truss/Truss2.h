@@ -112,8 +112,8 @@ class Truss2 : public Element
     int numDOF;	                    // number of dof for truss
 
     Vector *theLoad;     // pointer to the load vector P
-    Matrix *theMatrix; // pointer to objects matrix (a class wide Matrix)
-    Vector *theVector; // pointer to objects vector (a clas wide Vector)
+    Matrix &workMatrix(void) const;  // class wide matrix of the calling thread
+    Vector &workVector(void) const;  // class wide vector of the calling thread
 
     double L;	    // length of truss based on undeformed configuration
     double A; 	    // area of truss
@@ -138,14 +138,14 @@ class Truss2 : public Element
 // AddingSensitivity:END ///////////////////////////////////////////
 
     // static data - single copy for all objects of the class	
-    static Matrix trussM2;   // class wide matrix for 2*2
-    static Matrix trussM4;   // class wide matrix for 4*4
-    static Matrix trussM6;   // class wide matrix for 6*6
-	static Matrix trussM12;   // class wide matrix for 12*12
-    static Vector trussV2;   // class wide Vector for size 2
-    static Vector trussV4;   // class wide Vector for size 4
-    static Vector trussV6;   // class wide Vector for size 6
-	static Vector trussV12;   // class wide Vector for size 12
+    static thread_local Matrix trussM2;   // class wide matrix for 2*2
+    static thread_local Matrix trussM4;   // class wide matrix for 4*4
+    static thread_local Matrix trussM6;   // class wide matrix for 6*6
+	static thread_local Matrix trussM12;   // class wide matrix for 12*12
+    static thread_local Vector trussV2;   // class wide Vector for size 2
+    static thread_local Vector trussV4;   // class wide Vector for size 4
+    static thread_local Vector trussV6;   // class wide Vector for size 6
+	static thread_local Vector trussV12;   // class wide Vector for size 12
 };
 
 #endif
@@ -45,16 +45,16 @@
 #include <stdlib.h>
 
 // initialise the class wide variables
-Matrix TrussSection::trussM2(2,2);
-Matrix TrussSection::trussM3(3,3);
-Matrix TrussSection::trussM4(4,4);
-Matrix TrussSection::trussM6(6,6);
-Matrix TrussSection::trussM12(12,12);
-Vector TrussSection::trussV2(2);
-Vector TrussSection::trussV3(3);
-Vector TrussSection::trussV4(4);
-Vector TrussSection::trussV6(6);
-Vector TrussSection::trussV12(12);
+thread_local Matrix TrussSection::trussM2(2,2);
+thread_local Matrix TrussSection::trussM3(3,3);
+thread_local Matrix TrussSection::trussM4(4,4);
+thread_local Matrix TrussSection::trussM6(6,6);
+thread_local Matrix TrussSection::trussM12(12,12);
+thread_local Vector TrussSection::trussV2(2);
+thread_local Vector TrussSection::trussV3(3);
+thread_local Vector TrussSection::trussV4(4);
+thread_local Vector TrussSection::trussV6(6);
+thread_local Vector TrussSection::trussV12(12);
 
 
 #include <elementAPI.h>
@@ -143,7 +143,7 @@ TrussSection::TrussSection(int tag, int dim,
 :Element(tag,ELE_TAG_TrussSection),     
   connectedExternalNodes(2),
   dimension(dim), numDOF(0),
-  theLoad(0), theMatrix(0), theVector(0),
+  theLoad(0),
   L(0.0), rho(r), doRayleighDamping(damp),
   cMass(cm), theSection(0), initialDisp(0)
 {
@@ -189,7 +189,7 @@ TrussSection::TrussSection()
 :Element(0,ELE_TAG_TrussSection),     
  connectedExternalNodes(2),
   dimension(0), numDOF(0),
-  theLoad(0), theMatrix(0), theVector(0),
+  theLoad(0),
   L(0.0), rho(0.0), doRayleighDamping(0),
   cMass(0), theSection(0), initialDisp(0)
 {
@@ -288,8 +288,6 @@ TrussSection::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
 
       return;
     }
@@ -304,8 +302,6 @@ TrussSection::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
 	
       return;
     }	
@@ -316,36 +312,24 @@ TrussSection::setDomain(Domain *theDomain)
     // now set the number of dof for element and set matrix and vector pointers
     if (dimension == 1 && dofNd1 == 1) {
 	numDOF = 2;    
-	theMatrix = &trussM2;
-	theVector = &trussV2;
     }
     else if (dimension == 2 && dofNd1 == 2) {
 	numDOF = 4;
-	theMatrix = &trussM4;
-	theVector = &trussV4;	
     }
     else if (dimension == 2 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &trussM6;
-	theVector = &trussV6;		
     }
     else if (dimension == 3 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &trussM6;
-	theVector = &trussV6;			
     }
     else if (dimension == 3 && dofNd1 == 6) {
 	numDOF = 12;	    
-	theMatrix = &trussM12;
-	theVector = &trussV12;			
     }
     else {
       opserr << "WARNING TrussSection::setDomain cannot handle " << dimension << 
 	" dofs at nodes in " << dofNd1 << " d problem\n"; 
 
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
       return;
     }
 
@@ -509,9 +493,11 @@ TrussSection::update()
 const Matrix &
 TrussSection::getTangentStiff(void)
 {
+    Matrix &theMatrix = this->workMatrix();
+
     if (L == 0.0) { // - problem in setDomain() no further warnings
-	theMatrix->Zero();
-	return *theMatrix;
+	theMatrix.Zero();
+	return theMatrix;
     }
     
     int order = theSection->getOrder();
@@ -526,7 +512,7 @@ TrussSection::getTangentStiff(void)
     }
 
     // come back later and redo this if too slow
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = theMatrix;
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -541,15 +527,17 @@ TrussSection::getTangentStiff(void)
       }
     }
 
-    return *theMatrix;
+    return theMatrix;
 }
 
 const Matrix &
 TrussSection::getInitialStiff(void)
 {
+    Matrix &theMatrix = this->workMatrix();
+
     if (L == 0.0) { // - problem in setDomain() no further warnings
-	theMatrix->Zero();
-	return *theMatrix;
+	theMatrix.Zero();
+	return theMatrix;
     }
     
     int order = theSection->getOrder();
@@ -564,7 +552,7 @@ TrussSection::getInitialStiff(void)
     }
 
     // come back later and redo this if too slow
-    Matrix &stiff = *theMatrix;
+    Matrix &stiff = theMatrix;
 
     int numDOF2 = numDOF/2;
     double temp;
@@ -579,17 +567,19 @@ TrussSection::getInitialStiff(void)
       }
     }
 
-    return *theMatrix;
+    return theMatrix;
 }
     
 const Matrix &
 TrussSection::getDamp(void)
 {   
+  Matrix &theMatrix = this->workMatrix();
+
   if (doRayleighDamping == 1)
     return this->Element::getDamp();
   
-  theMatrix->Zero();
-  return *theMatrix;
+  theMatrix.Zero();
+  return theMatrix;
 }
 
 
@@ -597,7 +587,7 @@ const Matrix &
 TrussSection::getMass(void)
 {
   // zero the matrix
-  Matrix &mass = *theMatrix;
+  Matrix &mass = this->workMatrix();
   mass.Zero();    
   
   // check for quick return
@@ -688,9 +678,11 @@ TrussSection::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 TrussSection::getResistingForce()
 {	
+    Vector &theVector = this->workVector();
+
     if (L == 0.0) { // - problem in setDomain() no further warnings
-	theVector->Zero();
-	return *theVector;
+	theVector.Zero();
+	return theVector;
     }
     
     int order = theSection->getOrder();
@@ -708,14 +700,14 @@ TrussSection::getResistingForce()
     double temp;
     for (i = 0; i < dimension; i++) {
       temp = cosX[i]*force;
-      (*theVector)(i) = -temp;
-      (*theVector)(i+numDOF2) = temp;
+      theVector(i) = -temp;
+      theVector(i+numDOF2) = temp;
     }
 
     // subtract external load
-    (*theVector) -= *theLoad;
+    theVector -= *theLoad;
   
-    return *theVector;
+    return theVector;
 }
 
 
@@ -723,6 +715,8 @@ TrussSection::getResistingForce()
 const Vector &
 TrussSection::getResistingForceIncInertia()
 {	
+  Vector &theVector = this->workVector();
+
   this->getResistingForce();
   
   // now include the mass portion
@@ -738,29 +732,29 @@ TrussSection::getResistingForceIncInertia()
       // lumped mass matrix
       double m = 0.5*rho*L;
       for (int i = 0; i < dimension; i++) {
-        (*theVector)(i) += m*accel1(i);
-        (*theVector)(i+numDOF2) += m*accel2(i);
+        theVector(i) += m*accel1(i);
+        theVector(i+numDOF2) += m*accel2(i);
       }
     } else  {
       // consistent mass matrix
       double m = rho*L/6.0;
       for (int i=0; i<dimension; i++) {
-        (*theVector)(i) += 2.0*m*accel1(i) + m*accel2(i);
-        (*theVector)(i+numDOF2) += m*accel1(i) + 2.0*m*accel2(i);
+        theVector(i) += 2.0*m*accel1(i) + m*accel2(i);
+        theVector(i+numDOF2) += m*accel1(i) + 2.0*m*accel2(i);
       }
     }
     
     // add the damping forces if rayleigh damping
     if (doRayleighDamping == 1 && (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-      theVector->addVector(1.0, this->getRayleighDampingForces(), 1.0);
+      theVector.addVector(1.0, this->getRayleighDampingForces(), 1.0);
   } else {
     
     // add the damping forces if rayleigh damping
     if (doRayleighDamping == 1 && (betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0))
-      theVector->addVector(1.0, this->getRayleighDampingForces(), 1.0);
+      theVector.addVector(1.0, this->getRayleighDampingForces(), 1.0);
   }
   
-  return *theVector;
+  return theVector;
 }
 
 
@@ -777,7 +771,7 @@ TrussSection::sendSelf(int commitTag, Channel &theChannel)
   // truss packs it's data into a Vector and sends this to theChannel
   // along with it's dbTag and the commitTag passed in the arguments
 
-  static Vector data(11);
+  static thread_local Vector data(11);
   data(0) = this->getTag();
   data(1) = dimension;
   data(2) = numDOF;
@@ -835,7 +829,7 @@ TrussSection::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &the
   // truss creates a Vector, receives the Vector and then sets the 
   // internal data with the data in the Vector
 
-  static Vector data(11);
+  static thread_local Vector data(11);
   res = theChannel.recvVector(dataTag, commitTag, data);
   if (res < 0) {
     opserr << "WARNING TrussSection::recvSelf() - failed to receive Vector\n";
@@ -917,8 +911,8 @@ TrussSection::displaySelf(Renderer &theViewer, int displayMode, float fact, cons
     // first determine the two end points of the truss based on
     // the display factor (a measure of the distorted image)
     // store this information in 2 3d vectors v1 and v2
-    static Vector v1(3);
-    static Vector v2(3);
+    static thread_local Vector v1(3);
+    static thread_local Vector v2(3);
     float d1 = 0.0;
     float d2 = 0.0;
 
@@ -971,6 +965,8 @@ TrussSection::displaySelf(Renderer &theViewer, int displayMode, float fact, cons
 void
 TrussSection::Print(OPS_Stream &s, int flag)
 {
+    Vector &theVector = this->workVector();
+
     // compute the strain and axial force in the member
     double strain, force;
     if (L == 0.0) {
@@ -1005,8 +1001,8 @@ TrussSection::Print(OPS_Stream &s, int flag)
 	if (theVector != 0) {
 		for (int i=0; i<dimension; i++) {
 			temp = force*cosX[i];
-			(*theVector)(i) = -force;
-			(*theVector)(i+numDOF2) = force;
+			theVector(i) = -force;
+			theVector(i+numDOF2) = force;
 		}
 	}
      
@@ -1020,7 +1016,7 @@ TrussSection::Print(OPS_Stream &s, int flag)
         s << " \n\t strain: " << strain;
         s << " axial load: " << force;
         if (theVector != 0)
-            s << " \n\t unbalanced load: " << *theVector;
+            s << " \n\t unbalanced load: " << theVector;
         s << " \t Section: " << *theSection;
         s << endln;
     }
@@ -1151,9 +1147,9 @@ int
 TrussSection::getResponse(int responseID, Information &eleInfo)
 {
     double strain, force;
-    static Vector sVec(1);
-    static Vector fVec(1);
-    static Matrix kVec(1,1);
+    static thread_local Vector sVec(1);
+    static thread_local Vector fVec(1);
+    static thread_local Matrix kVec(1,1);
 
     switch (responseID) {
   case 1:
@@ -1281,7 +1277,7 @@ TrussSection::activateParameter(int passedParameterID)
 const Matrix &
 TrussSection::getKiSensitivity(int gradIndex)
 {
-  Matrix &stiff = *theMatrix;
+  Matrix &stiff = this->workMatrix();
   stiff.Zero();
     
   if (parameterID == 0) {
@@ -1321,7 +1317,7 @@ TrussSection::getKiSensitivity(int gradIndex)
 const Matrix &
 TrussSection::getMassSensitivity(int gradNumber)
 {
-  Matrix &mass = *theMatrix;
+  Matrix &mass = this->workMatrix();
   mass.Zero();
 
   if (parameterID == 2) {
@@ -1340,7 +1336,9 @@ TrussSection::getMassSensitivity(int gradNumber)
 const Vector &
 TrussSection::getResistingForceSensitivity(int gradIndex)
 {
-	theVector->Zero();
+	Vector &theVector = this->workVector();
+
+	theVector.Zero();
 
 	// Initial declarations
 	int i;
@@ -1475,8 +1473,8 @@ TrussSection::getResistingForceSensitivity(int gradIndex)
 	else {		// Density, material parameter or nodal coordinate
 	  for (i = 0; i < dimension; i++) {
 	    temp = dNdh*cosX[i] + N*dcosXdh[i];
-	    (*theVector)(i) = -temp;
-	    (*theVector)(i+numDOF2) = temp;
+	    theVector(i) = -temp;
+	    theVector(i+numDOF2) = temp;
 	  }
 	}
 
@@ -1484,9 +1482,9 @@ TrussSection::getResistingForceSensitivity(int gradIndex)
 	if (theLoadSens == 0) {
 		theLoadSens = new Vector(numDOF);
 	}
-	(*theVector) -= *theLoadSens;
+	theVector -= *theLoadSens;
 
-	return *theVector;
+	return theVector;
 }
 
 int
@@ -1695,3 +1693,31 @@ TrussSection::addInertiaLoadSensitivityToUnbalance(const Vector &accel, bool som
 }
 
 // AddingSensitivity:END /////////////////////////////////////////////
+
+Matrix &
+TrussSection::workMatrix(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return trussM2;
+    case 4:   return trussM4;
+    case 6:   return trussM6;
+    case 12:  return trussM12;
+    default: return trussM2;
+  }
+}
+
+Vector &
+TrussSection::workVector(void) const
+{
+  // the class wide objects are thread_local, so the one for the
+  // calling thread is looked up on each use
+  switch (numDOF) {
+    case 2:   return trussV2;
+    case 4:   return trussV4;
+    case 6:   return trussV6;
+    case 12:  return trussV12;
+    default: return trussV2;
+  }
+}
@@ -0,0 +1,223 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <CompressedGraph.h>
+#include <Vertex.h>
+#include <ID.h>
+#include <threads/global_pool.hpp>
+#include <algorithm>
+
+// fewest vertices worth handing to another thread
+static constexpr int minVerticesPerBlock = 4096;
+
+CompressedGraph::CompressedGraph()
+:Graph(),
+ compressed(true), start(1, 0), index()
+{
+
+}
+
+CompressedGraph::~CompressedGraph()
+{
+
+}
+
+void
+CompressedGraph::build(int numVertex,
+                       const std::vector<int> &groupStart,
+                       const std::vector<int> &vertices)
+{
+  const int numGroups = groupStart.empty() ? 0 : static_cast<int>(groupStart.size()) - 1;
+  const int numEntries = groupStart.empty() ? 0 : groupStart[numGroups];
+
+  // the groups that each vertex belongs to
+  std::vector<int> memberStart(numVertex+1, 0);
+  for (int k=0; k<numEntries; k++) {
+    const int v = vertices[k];
+    if (v >= 0 && v < numVertex)
+      memberStart[v+1]++;
+  }
+  for (int v=0; v<numVertex; v++)
+    memberStart[v+1] += memberStart[v];
+
+  std::vector<int> members(memberStart[numVertex]);
+  {
+    std::vector<int> next(memberStart.begin(), memberStart.end()-1);
+    for (int g=0; g<numGroups; g++)
+      for (int k=groupStart[g]; k<groupStart[g+1]; k++) {
+        const int v = vertices[k];
+        if (v >= 0 && v < numVertex)
+          members[next[v]++] = g;
+      }
+  }
+
+  // the first pass counts the distinct neighbours of each vertex in
+  // [v0, v1) and the second stores them; mark[w] == v flags w as
+  // already seen for v, so mark needs no clearing between vertices
+  start.assign(numVertex+1, 0);
+  index.clear();
+
+  auto pass = [&](int v0, int v1, bool fill) {
+    std::vector<int> mark(numVertex, -1);
+    for (int v=v0; v<v1; v++) {
+      mark[v] = v;
+      int *row = fill ? index.data() + start[v] : nullptr;
+      int count = 0;
+      for (int m=memberStart[v]; m<memberStart[v+1]; m++) {
+        const int g = members[m];
+        for (int k=groupStart[g]; k<groupStart[g+1]; k++) {
+          const int w = vertices[k];
+          if (w < 0 || w >= numVertex || mark[w] == v)
+            continue;
+          mark[w] = v;
+          if (fill)
+            row[count] = w;
+          count++;
+        }
+      }
+      if (fill)
+        std::sort(row, row+count);
+      else
+        start[v+1] = count;
+    }
+  };
+
+  OpenSees::thread_pool &pool = OpenSees::global_thread_pool();
+  const int numBlocks = std::min<int>(numVertex/minVerticesPerBlock, pool.get_thread_count());
+  const bool parallel = numBlocks > 1 && !OpenSees::in_thread_pool();
+
+  if (parallel)
+    pool.submit_blocks<int>(0, numVertex, [&](int v0, int v1) {
+      pass(v0, v1, false);
+    }, numBlocks).wait();
+  else
+    pass(0, numVertex, false);
+
+  for (int v=0; v<numVertex; v++)
+    start[v+1] += start[v];
+  index.resize(start[numVertex]);
+
+  if (parallel)
+    pool.submit_blocks<int>(0, numVertex, [&](int v0, int v1) {
+      pass(v0, v1, true);
+    }, numBlocks).wait();
+  else
+    pass(0, numVertex, true);
+
+  numEdge = start[numVertex]/2;
+}
+
+Vertex *
+CompressedGraph::newVertex(int i)
+{
+  return new Vertex(i, i);
+}
+
+void
+CompressedGraph::expand(void)
+{
+  if (!compressed)
+    return;
+  compressed = false;
+
+  const int numVertex = static_cast<int>(start.size()) - 1;
+  for (int i=0; i<numVertex; i++) {
+    Vertex *vertexPtr = this->newVertex(i);
+    ID adjacency(start[i+1] - start[i]);
+    for (int k=start[i]; k<start[i+1]; k++)
+      adjacency(k-start[i]) = index[k];
+    vertexPtr->setAdjacency(adjacency);
+    Graph::addVertex(vertexPtr, false);
+  }
+
+  std::vector<int>().swap(start);
+  std::vector<int>().swap(index);
+}
+
+bool
+CompressedGraph::getCompressed(const int *&theStart, const int *&theIndex)
+{
+  if (!compressed)
+    return Graph::getCompressed(theStart, theIndex);
+
+  theStart = start.data();
+  theIndex = index.data();
+  return true;
+}
+
+int
+CompressedGraph::getNumVertex(void) const
+{
+  if (!compressed)
+    return Graph::getNumVertex();
+
+  return static_cast<int>(start.size()) - 1;
+}
+
+bool
+CompressedGraph::addVertex(Vertex *vertexPtr, bool checkAdjacency)
+{
+  this->expand();
+  return Graph::addVertex(vertexPtr, checkAdjacency);
+}
+
+int
+CompressedGraph::addEdge(int vertexTag, int otherVertexTag)
+{
+  this->expand();
+  return Graph::addEdge(vertexTag, otherVertexTag);
+}
+
+void
+CompressedGraph::startAddEdge()
+{
+  this->expand();
+  Graph::startAddEdge();
+}
+
+int
+CompressedGraph::addEdgeFast(int vertexTag, int otherVertexTag)
+{
+  this->expand();
+  return Graph::addEdgeFast(vertexTag, otherVertexTag);
+}
+
+Vertex *
+CompressedGraph::getVertexPtr(int vertexTag)
+{
+  this->expand();
+  return Graph::getVertexPtr(vertexTag);
+}
+
+VertexIter &
+CompressedGraph::getVertices(void)
+{
+  this->expand();
+  return Graph::getVertices();
+}
+
+Vertex *
+CompressedGraph::removeVertex(int tag, bool removeEdgeFlag)
+{
+  this->expand();
+  return Graph::removeVertex(tag, removeEdgeFlag);
+}
+
+int
+CompressedGraph::merge(Graph &other)
+{
+  this->expand();
+  return Graph::merge(other);
+}
+
+void
+CompressedGraph::Print(OPS_Stream &s, int flag)
+{
+  this->expand();
+  Graph::Print(s, flag);
+}
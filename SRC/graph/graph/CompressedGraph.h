@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: CompressedGraph is a Graph whose adjacency is held in
+// compressed sparse row form instead of in a Vertex object for each
+// vertex. It is meant for the large graphs formed from the analysis model
+// (the DOF_Graph and DOF_GroupGraph), in which the vertices are numbered
+// 0 through n-1 and each element connects all of its vertices to one
+// another. The rows are formed in two passes over the vertices, the first
+// counting the neighbours of each vertex and the second filling them in,
+// with the vertices split over the shared thread pool.
+//
+// The Vertex based interface of Graph still works: the first call of one
+// of those methods creates the Vertex objects from the compressed form,
+// after which the graph behaves as a plain Graph. Consumers that only
+// need the structure (the LinearSOEs and GraphNumberers) should use
+// getCompressed() so that no Vertex is ever created.
+//
+// Written: cmp
+//
+#ifndef CompressedGraph_h
+#define CompressedGraph_h
+
+#include <Graph.h>
+#include <vector>
+
+class CompressedGraph: public Graph
+{
+  public:
+    CompressedGraph();
+    virtual ~CompressedGraph();
+
+    bool getCompressed(const int *&start, const int *&index);
+
+    bool addVertex(Vertex *vertexPtr, bool checkAdjacency = true);
+    int addEdge(int vertexTag, int otherVertexTag);
+    void startAddEdge();
+    int addEdgeFast(int vertexTag, int otherVertexTag);
+
+    Vertex *getVertexPtr(int vertexTag);
+    VertexIter &getVertices(void);
+    int getNumVertex(void) const;
+    Vertex *removeVertex(int tag, bool removeEdgeFlag = true);
+
+    int merge(Graph &other);
+    void Print(OPS_Stream &s, int flag =0);
+
+  protected:
+    // forms the adjacency of numVertex vertices in which the vertices of
+    // each group, vertices[groupStart[g]] ... vertices[groupStart[g+1]-1],
+    // are all adjacent to each other; vertices outside [0, numVertex)
+    // are ignored
+    void build(int numVertex,
+               const std::vector<int> &groupStart,
+               const std::vector<int> &vertices);
+
+    // gives up the compressed form, after which the graph is a plain Graph
+    void expand(void);
+
+    // creates the Vertex with tag i when the graph is expanded
+    virtual Vertex *newVertex(int i);
+
+  private:
+    bool compressed;
+    std::vector<int> start, index;
+};
+
+#endif
@@ -24,18 +24,19 @@
 //
 // Description: This file contains the class definition for DOF_Graph.
 // DOF_Graph is a graph of the DOFs in the analysis model. It is used
-// by the SysOfEqn to determine its size.
+// by the SysOfEqn to determine its size. The vertices are the equation
+// numbers, and the adjacency is held in compressed form.
 //
 // What: "@(#) DOF_Graph.h, revA"
 
 #ifndef DOF_Graph_h
 #define DOF_Graph_h
 
-#include <Graph.h>
+#include <CompressedGraph.h>
 
 class AnalysisModel;
 
-class DOF_Graph: public Graph
+class DOF_Graph: public CompressedGraph
 {
   public:
     DOF_Graph(AnalysisModel &theModel);
@@ -36,7 +36,7 @@
 
 // constructs the Graph
 DOF_GroupGraph::DOF_GroupGraph(AnalysisModel &theModel)
-:Graph(theModel.getNumDOF_Groups()+START_VERTEX_NUM), 
+:CompressedGraph(),
  myModel(theModel)
 {
 
@@ -50,11 +50,39 @@ DOF_GroupGraph::DOF_GroupGraph(AnalysisModel &theModel)
 	
     DOF_Group *dofPtr;
 
-    // now create the vertices with a reference equal to the DOF_Group number.
-    // and a tag which ranges from 0 through numVertex-1
+    // the vertices are the DOF_Groups; they can be held in compressed
+    // form when the DOF_Groups are numbered 0 through numVertex-1, as
+    // the ConstraintHandlers number them
+
+    bool contiguous = true;
+    DOF_GrpIter &dofIter = theModel.getDOFs();
+    while ((dofPtr = dofIter()) != nullptr) {
+	int DOF_GroupTag = dofPtr->getTag();
+	if (DOF_GroupTag < START_VERTEX_NUM || DOF_GroupTag >= numVertex+START_VERTEX_NUM)
+	    contiguous = false;
+    }
+
+    FE_Element *elePtr;
+
+    if (contiguous) {
+	// each FE_Element connects all of its DOF_Groups to each other
+	std::vector<int> groupStart(1, 0);
+	std::vector<int> dofs;
+	FE_EleIter &eleIter = myModel.getFEs();
+	while((elePtr = eleIter()) != nullptr) {
+	    const ID &id = elePtr->getDOFtags();
+	    for (int i=0; i<id.Size(); i++)
+		dofs.push_back(id(i)-START_VERTEX_NUM);
+	    groupStart.push_back(dofs.size());
+	}
+	this->build(numVertex, groupStart, dofs);
+	return;
+    }
+
+    // otherwise create the vertices with a reference equal to the
+    // DOF_Group number.
 
     DOF_GrpIter &dofIter2 = theModel.getDOFs();
-    int count = START_VERTEX_NUM;
     while ((dofPtr = dofIter2()) != nullptr) {
 	int DOF_GroupTag = dofPtr->getTag();
 	int DOF_GroupNodeTag = dofPtr->getNodeTag();
@@ -67,7 +95,6 @@ DOF_GroupGraph::DOF_GroupGraph(AnalysisModel &theModel)
     // now add the edges, by looping over the Elements, getting their
     // IDs and adding edges between DOFs for equation numbers >= START_EQN_NUM
     
-    FE_Element *elePtr;
     FE_EleIter &eleIter = myModel.getFEs();
 
     while((elePtr = eleIter()) != 0) {
@@ -84,6 +111,17 @@ DOF_GroupGraph::DOF_GroupGraph(AnalysisModel &theModel)
     }
 }
 
+Vertex *
+DOF_GroupGraph::newVertex(int i)
+{
+    int DOF_GroupTag = i + START_VERTEX_NUM;
+    DOF_Group *dofPtr = myModel.getDOF_GroupPtr(DOF_GroupTag);
+    if (dofPtr == nullptr)
+	return new Vertex(DOF_GroupTag, -1);
+
+    return new Vertex(DOF_GroupTag, dofPtr->getNodeTag(), 0, dofPtr->getNumFreeDOF());
+}
+
 DOF_GroupGraph::~DOF_GroupGraph()
 {
 
@@ -24,24 +24,27 @@
 //
 // Description: This file contains the class definition for DOF_GroupGraph.
 // DOF_GroupGraph is a graph of the DOF_Groups in the domain. It is used by 
-// the DOF_Numberer to assign equation numbers to the DOFs.
+// the DOF_Numberer to assign equation numbers to the DOFs. The adjacency
+// is held in compressed form when the DOF_Groups are numbered 0 through
+// n-1.
 //
 // What: "@(#) DOF_GroupGraph.h, revA"
 
 #ifndef DOF_GroupGraph_h
 #define DOF_GroupGraph_h
 
-#include <Graph.h>
+#include <CompressedGraph.h>
 
 class AnalysisModel;
 
-class DOF_GroupGraph: public Graph
+class DOF_GroupGraph: public CompressedGraph
 {
   public:
     DOF_GroupGraph(AnalysisModel &theModel);
     ~DOF_GroupGraph();
 
   protected:
+    Vertex *newVertex(int i);
     
   private:
     AnalysisModel &myModel;
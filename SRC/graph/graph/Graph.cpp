@@ -25,6 +25,7 @@
 // Description: This file contains the class implementation for Graph.
 //
 #include <stdlib.h>
+#include <algorithm>
 
 #include <Graph.h>
 #include <Vertex.h>
@@ -363,6 +364,33 @@ Graph::merge(Graph &other) {
 }
 
 
+bool
+Graph::getCompressed(const int *&start, const int *&index)
+{
+  const int numVertex = this->getNumVertex();
+  compressedStart.assign(numVertex+1, 0);
+  compressedIndex.clear();
+  compressedIndex.reserve(2*numEdge);
+
+  for (int i=0; i<numVertex; i++) {
+    Vertex *vertexPtr = this->getVertexPtr(i+START_VERTEX_NUM);
+    if (vertexPtr == 0) {
+      compressedStart.clear();
+      return false;
+    }
+    const ID &adjacency = vertexPtr->getAdjacency();
+    for (int j=0; j<adjacency.Size(); j++)
+      compressedIndex.push_back(adjacency(j)-START_VERTEX_NUM);
+    std::sort(compressedIndex.begin()+compressedStart[i], compressedIndex.end());
+    compressedStart[i+1] = compressedIndex.size();
+  }
+
+  start = compressedStart.data();
+  index = compressedIndex.data();
+  return true;
+}
+
+
 void 
 Graph::Print(OPS_Stream &s, int flag)
 {
@@ -63,6 +63,13 @@ class Graph
     virtual Vertex *removeVertex(int tag, bool removeEdgeFlag = true);
 
     virtual int merge(Graph &other);
+
+    // the adjacency in compressed sparse row form, for graphs whose
+    // vertex tags run from 0 through getNumVertex()-1: the vertices
+    // adjacent to vertex i are index[start[i]] ... index[start[i+1]-1],
+    // in increasing order. The arrays belong to the graph and remain
+    // valid until it is next changed. Returns false for other graphs.
+    virtual bool getCompressed(const int *&start, const int *&index);
     
     virtual void Print(OPS_Stream &s, int flag =0);
     int sendSelf(int commitTag, Channel &theChannel);
@@ -71,13 +78,14 @@ class Graph
     friend OPS_Stream &operator<<(OPS_Stream &s, Graph &M);    
     
   protected:
+    int numEdge;
     
   private:
     TaggedObjectStorage *myVertices;
     VertexIter *theVertexIter;
-    int numEdge;
     int nextFreeTag;
     std::vector<Vertex*> vertices;
+    std::vector<int> compressedStart, compressedIndex;
 };
 
 #endif
@@ -27,6 +27,7 @@
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <ID.h>
+#include <vector>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <Logging.h>
@@ -57,6 +58,16 @@ AMD::number(Graph &theGraph, int startVertex)
 
   theResult.resize(numVertex);
 
+  // the compressed form is already what amd_order takes
+  const int *start, *index;
+  if (theGraph.getCompressed(start, index)) {
+    std::vector<int> P(numVertex);
+    amd_order(numVertex, start, index, P.data(), (double *)NULL, (double *)NULL);
+    for (int i=0; i<numVertex; i++)
+      theResult[i] = P[i];
+    return theResult;
+  }
+
   int nnz = 0;
   Vertex *vertexPtr;
   VertexIter &vertexIter = theGraph.getVertices();
@@ -39,6 +39,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <Logging.h>
+#include <vector>
 
 // Constructor
 MyRCM::MyRCM(int startVertex, bool minDegreeFlag)
@@ -107,6 +108,52 @@ MyRCM::number(Graph &theGraph, int startVertex)
     
     if (numVertex == 0) 
 	return *theRefResult;
+
+    if (startVertex != -1)
+	startVertexTag = startVertex;
+
+    // number a compressed graph from its arrays
+    const int *start, *index;
+    if (theGraph.getCompressed(start, index)) {
+	int first = startVertexTag;
+	if (first < START_VERTEX_NUM || first >= numVertex+START_VERTEX_NUM) {
+	    if (first != -1) {
+		opserr << "WARNING:  MyRCM::number - No vertex with tag ";
+		opserr << first << "Exists - using first come from iter\n";
+	    }
+	    first = START_VERTEX_NUM;
+	}
+
+	std::vector<int> mark(numVertex, -1);
+	int nextStart = 0;
+	int currentMark = numVertex-1;
+	int nextMark = currentMark -1;
+	(*theRefResult)(currentMark) = first;
+	mark[first-START_VERTEX_NUM] = currentMark;
+
+	while (nextMark >= 0) {
+	    int v = (*theRefResult)(currentMark) - START_VERTEX_NUM;
+	    for (int k=start[v]; k<start[v+1]; k++) {
+		int w = index[k];
+		if (mark[w] == -1) {
+		    mark[w] = nextMark;
+		    (*theRefResult)(nextMark--) = w + START_VERTEX_NUM;
+		}
+	    }
+
+	    currentMark--;
+
+	    if ((currentMark == nextMark) && (currentMark >= 0)) {
+		opserr << "WARNING:  MyRCM::number - Disconnected graph\n";
+		while (mark[nextStart] != -1)
+		    nextStart++;
+		nextMark--;
+		mark[nextStart] = currentMark;
+		(*theRefResult)(currentMark) = nextStart + START_VERTEX_NUM;
+	    }
+	}
+	return *theRefResult;
+    }
 	    
 
     // we first set the Tmp of all vertices to -1, indicating
@@ -34,6 +34,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <Logging.h>
+#include <vector>
 
 // Constructor
 RCM::RCM(bool gps)
@@ -81,6 +82,33 @@ RCM::number(Graph &theGraph, int startVertex)
     
     if (numVertex == 0) 
 	return *theRefResult;
+
+    // number a compressed graph from its arrays
+    const int *xadj, *adjncy;
+    if (theGraph.getCompressed(xadj, adjncy)) {
+	int first = startVertex;
+	if (first != -1 && (first < START_VERTEX_NUM || first >= numVertex+START_VERTEX_NUM)) {
+	    opserr << "WARNING:  RCM::number - No vertex with tag ";
+	    opserr << first << "Exists - using first come from iter\n";
+	    first = -1;
+	}
+
+	int lastLevelSet;
+	if (first == -1) {
+	    first = START_VERTEX_NUM;
+	    if (GPS == true) {
+		this->order(xadj, adjncy, first, lastLevelSet);
+		if (lastLevelSet > 0) {
+		    ID lastLevel(lastLevelSet);
+		    for (int i=0; i<lastLevelSet; i++)
+			lastLevel(i) = (*theRefResult)(i);
+		    return this->number(theGraph, lastLevel);
+		}
+	    }
+	}
+	this->order(xadj, adjncy, first, lastLevelSet);
+	return *theRefResult;
+    }
 	    
 
     // we first set the Tmp of all vertices to -1, indicating
@@ -292,6 +320,32 @@ RCM::number(Graph &theGraph, const ID &startVertices)
     if (numVertex == 0) 
 	return *theRefResult;
 
+    // number a compressed graph from its arrays, starting from the
+    // vertex that gives the min avg profile
+    const int *xadj, *adjncy;
+    if (theGraph.getCompressed(xadj, adjncy)) {
+	int minStartVertexTag = START_VERTEX_NUM;
+	int minAvgProfile = 0;
+	int startVertexTag = START_VERTEX_NUM;
+	int lastLevelSet;
+	for (int i=0; i<startVertices.Size(); i++) {
+	    startVertexTag = startVertices(i);
+	    if (startVertexTag < START_VERTEX_NUM || startVertexTag >= numVertex+START_VERTEX_NUM) {
+		opserr << "WARNING:  RCM::number - No vertex with tag ";
+		opserr << startVertexTag << "Exists - using first come from iter\n";
+		startVertexTag = START_VERTEX_NUM;
+	    }
+	    int avgProfile = this->order(xadj, adjncy, startVertexTag, lastLevelSet);
+	    if (i == 0 || minAvgProfile > avgProfile) {
+		minStartVertexTag = startVertexTag;
+		minAvgProfile = avgProfile;
+	    }
+	}
+	if (minStartVertexTag != startVertexTag || startVertices.Size() == 0)
+	    this->order(xadj, adjncy, minStartVertexTag, lastLevelSet);
+	return *theRefResult;
+    }
+
     // determine one that gives the min avg profile	    
     int minStartVertexTag =0;
     int minAvgProfile = 0;
@@ -459,3 +513,54 @@ RCM::number(Graph &theGraph, const ID &startVertices)
     return *theRefResult;
 }
 
+
+// int order(const int *start, const int *index, int first, int &lastLevelSet)
+//    Reverse Cuthill-McKee numbering of a graph in compressed form, as
+// done above with the Vertex objects: the result is placed in theRefResult
+// from the back, and disconnected parts are started from the lowest
+// numbered vertex not yet added. Returns the sum of the distances between
+// each vertex and the vertex it was added from, which is used to compare
+// starting vertices, and sets lastLevelSet to the start of the last level
+// set in theRefResult.
+int
+RCM::order(const int *start, const int *index, int first, int &lastLevelSet)
+{
+    std::vector<int> mark(numVertex, -1);
+    int nextStart = 0;              // lowest vertex which may not be added
+    int avgProfile = 0;
+
+    int currentMark = numVertex-1;  // marks current vertex visiting.
+    int nextMark = currentMark -1;  // indiactes where to put next Tag in ID.
+    lastLevelSet = nextMark;
+    (*theRefResult)(currentMark) = first;
+    mark[first-START_VERTEX_NUM] = currentMark;
+
+    while (nextMark >= 0) {
+	int v = (*theRefResult)(currentMark) - START_VERTEX_NUM;
+	for (int k=start[v]; k<start[v+1]; k++) {
+	    int w = index[k];
+	    if (mark[w] == -1) {
+		mark[w] = nextMark;
+		avgProfile += (currentMark - nextMark);
+		(*theRefResult)(nextMark--) = w + START_VERTEX_NUM;
+	    }
+	}
+
+	currentMark--;
+
+	if (lastLevelSet == currentMark)
+	    lastLevelSet = nextMark;
+
+	// check to see if graph is disconneted
+	if ((currentMark == nextMark) && (currentMark >= 0)) {
+	    while (mark[nextStart] != -1)
+		nextStart++;
+	    nextMark--;
+	    lastLevelSet = nextMark;
+	    mark[nextStart] = currentMark;
+	    (*theRefResult)(currentMark) = nextStart + START_VERTEX_NUM;
+	}
+    }
+
+    return avgProfile;
+}
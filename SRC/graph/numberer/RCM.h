@@ -35,7 +35,9 @@
 // number() method with the Graph to be numbered.
 //
 // Side effects: numberer() changes the Tmp values of the vertices to
-// the number assigned to that vertex.
+// the number assigned to that vertex. Graphs given in compressed form
+// (see Graph::getCompressed()) are numbered without using their Vertex
+// objects, and so without this side effect.
 //
 // What: "@(#) RCM.h, revA"
 
@@ -64,6 +66,7 @@ class RCM: public GraphNumberer
   protected:
     
   private:
+    int order(const int *start, const int *index, int first, int &lastLevelSet);
     
     int numVertex;
     ID *theRefResult;
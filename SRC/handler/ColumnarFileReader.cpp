@@ -0,0 +1,256 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <ColumnarFileReader.h>
+#include <ColumnarFileStream.h>
+#include <Vector.h>
+#include <Logging.h>
+#include <sstream>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#  include <fstream>
+#  include <iterator>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+
+ColumnarFileReader::ColumnarFileReader()
+:data(nullptr), size(0), valueSize(0), numColumns(0), numRows(0)
+{
+
+}
+
+
+ColumnarFileReader::~ColumnarFileReader()
+{
+  this->close();
+}
+
+
+void
+ColumnarFileReader::close(void)
+{
+#if defined(_WIN32)
+  contents.clear();
+  contents.shrink_to_fit();
+#else
+  if (data != nullptr)
+    munmap(const_cast<char *>(data), size);
+#endif
+  data = nullptr;
+  size = 0;
+  numColumns = 0;
+  numRows = 0;
+  columns.clear();
+  chunks.clear();
+}
+
+
+int
+ColumnarFileReader::open(const char *fileName)
+{
+  this->close();
+
+#if defined(_WIN32)
+  std::ifstream file(fileName, std::ios::in | std::ios::binary);
+  if (!file.is_open()) {
+    opserr << "ColumnarFileReader::open() - could not open file " << fileName << "\n";
+    return -1;
+  }
+  contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  data = contents.data();
+  size = contents.size();
+#else
+  const int fd = ::open(fileName, O_RDONLY);
+  if (fd < 0) {
+    opserr << "ColumnarFileReader::open() - could not open file " << fileName << "\n";
+    return -1;
+  }
+  struct stat info;
+  if (fstat(fd, &info) == 0 && info.st_size > 0) {
+    void *map = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (map != MAP_FAILED) {
+      data = static_cast<const char *>(map);
+      size = info.st_size;
+    }
+  }
+  ::close(fd);
+#endif
+
+  ColumnarFileHeader header;
+  if (data == nullptr || size < sizeof(header)) {
+    opserr << "ColumnarFileReader::open() - " << fileName << " is empty\n";
+    this->close();
+    return -1;
+  }
+  memcpy(&header, data, sizeof(header));
+  if (memcmp(header.magic, "OPSCOLS", 8) != 0 || header.version != 1 ||
+      (header.valueSize != 4 && header.valueSize != 8) ||
+      sizeof(header) + header.schemaSize > size) {
+    opserr << "ColumnarFileReader::open() - " << fileName << " is not a columnar recorder file\n";
+    this->close();
+    return -1;
+  }
+
+  valueSize  = header.valueSize;
+  numColumns = static_cast<int>(header.numColumns);
+
+  // one line of the schema per column
+  std::istringstream schema(std::string(data + sizeof(header), header.schemaSize));
+  std::string line;
+  while (std::getline(schema, line)) {
+    Column column{"", "", -1, 0};
+    std::istringstream fields(line);
+    std::string tag, dof;
+    std::getline(fields, column.name, '\t');
+    std::getline(fields, tag, '\t');
+    std::getline(fields, dof, '\t');
+    std::getline(fields, column.context);
+    column.tag = tag.empty() ? -1 : atoi(tag.c_str());
+    column.dof = dof.empty() ? 0  : atoi(dof.c_str());
+    columns.push_back(column);
+  }
+  columns.resize(numColumns, Column{"", "", -1, 0});
+
+  if (this->findChunks(header.numChunks, header.indexOffset, sizeof(header) + (header.schemaSize + 7)/8*8) < 0) {
+    opserr << "ColumnarFileReader::open() - the chunk index of " << fileName << " is corrupt\n";
+    this->close();
+    return -1;
+  }
+  return 0;
+}
+
+
+int
+ColumnarFileReader::findChunks(uint64_t numChunks, uint64_t indexOffset, std::size_t dataOffset)
+{
+  auto addChunk = [&](uint64_t offset) -> bool {
+    ColumnarChunkHeader header;
+    if (offset + sizeof(header) > size)
+      return false;
+    memcpy(&header, data + offset, sizeof(header));
+    const uint64_t bytes = uint64_t(header.numRows)*header.numColumns*valueSize;
+    if (header.magic != ColumnarChunkMagic || header.numColumns != uint64_t(numColumns) ||
+        offset + sizeof(header) + bytes > size)
+      return false;
+    chunks.push_back({data + offset + sizeof(header), header.numRows});
+    numRows += header.numRows;
+    return true;
+  };
+
+  // a closed file has an index of its chunks
+  if (indexOffset != 0) {
+    if (indexOffset + numChunks*sizeof(uint64_t) > size)
+      return -1;
+    for (uint64_t c=0; c<numChunks; c++) {
+      uint64_t offset;
+      memcpy(&offset, data + indexOffset + c*sizeof(uint64_t), sizeof(offset));
+      if (!addChunk(offset))
+        return -1;
+    }
+    return 0;
+  }
+
+  // otherwise walk the chunks that were written in full
+  uint64_t offset = dataOffset;
+  while (addChunk(offset)) {
+    const Chunk &last = chunks.back();
+    offset = (last.values - data) + uint64_t(last.numRows)*numColumns*valueSize;
+  }
+  return 0;
+}
+
+
+int
+ColumnarFileReader::getNumColumns(void) const
+{
+  return numColumns;
+}
+
+
+long
+ColumnarFileReader::getNumRows(void) const
+{
+  return numRows;
+}
+
+
+const char *
+ColumnarFileReader::getName(int column) const
+{
+  return columns[column].name.c_str();
+}
+
+
+const char *
+ColumnarFileReader::getContext(int column) const
+{
+  return columns[column].context.c_str();
+}
+
+
+int
+ColumnarFileReader::getTag(int column) const
+{
+  return columns[column].tag;
+}
+
+
+int
+ColumnarFileReader::getDof(int column) const
+{
+  return columns[column].dof;
+}
+
+
+int
+ColumnarFileReader::findColumn(const char *name, int tag) const
+{
+  for (int j=0; j<numColumns; j++)
+    if (columns[j].name == name && (tag == -1 || columns[j].tag == tag))
+      return j;
+  return -1;
+}
+
+
+int
+ColumnarFileReader::getColumn(int column, double *values) const
+{
+  if (column < 0 || column >= numColumns)
+    return -1;
+
+  for (const Chunk &chunk : chunks) {
+    const char *block = chunk.values + std::size_t(column)*chunk.numRows*valueSize;
+    if (valueSize == sizeof(double))
+      memcpy(values, block, chunk.numRows*sizeof(double));
+    else {
+      const float *singles = reinterpret_cast<const float *>(block);
+      for (uint32_t i=0; i<chunk.numRows; i++)
+        values[i] = singles[i];
+    }
+    values += chunk.numRows;
+  }
+  return 0;
+}
+
+
+int
+ColumnarFileReader::getColumn(int column, Vector &values) const
+{
+  if (values.Size() != numRows)
+    values.resize(numRows);
+  if (numRows == 0)
+    return column >= 0 && column < numColumns ? 0 : -1;
+  return this->getColumn(column, &values(0));
+}
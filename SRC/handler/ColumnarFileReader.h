@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: ColumnarFileReader maps a file written by a
+// ColumnarFileStream into memory and reads single columns from it. Only
+// the header, the schema and the chunk index are looked at when the file
+// is opened; a column is then gathered from one contiguous block per
+// chunk, so the time to read it does not depend on how many other
+// columns the file holds.
+//
+//    ColumnarFileReader reader;
+//    reader.open("disp.ocb");
+//    int j = reader.findColumn("D1", 12);   // dof 1 of node 12
+//    Vector u(reader.getNumRows());
+//    reader.getColumn(j, u);
+//
+// Written: cmp
+//
+#ifndef ColumnarFileReader_h
+#define ColumnarFileReader_h
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+class Vector;
+
+class ColumnarFileReader
+{
+  public:
+    ColumnarFileReader();
+    ~ColumnarFileReader();
+
+    ColumnarFileReader(const ColumnarFileReader &) = delete;
+    ColumnarFileReader &operator=(const ColumnarFileReader &) = delete;
+
+    int  open(const char *fileName);
+    void close(void);
+
+    int  getNumColumns(void) const;
+    long getNumRows(void) const;
+
+    // the schema of a column
+    const char *getName(int column) const;
+    const char *getContext(int column) const;
+    int getTag(int column) const;
+    int getDof(int column) const;
+
+    // the first column with the given response name and, if tag is not
+    // -1, node or element tag; -1 if there is none
+    int findColumn(const char *name, int tag = -1) const;
+
+    // copy the numRows values of a column
+    int getColumn(int column, double *values) const;
+    int getColumn(int column, Vector &values) const;
+
+  private:
+    struct Column {
+      std::string name;
+      std::string context;
+      int tag;
+      int dof;
+    };
+
+    struct Chunk {
+      const char *values;
+      uint32_t numRows;
+    };
+
+    int findChunks(uint64_t numChunks, uint64_t indexOffset, std::size_t dataOffset);
+
+    const char *data;
+    std::size_t size;
+#if defined(_WIN32)
+    std::vector<char> contents;
+#endif
+
+    int  valueSize;
+    int  numColumns;
+    long numRows;
+    std::vector<Column> columns;
+    std::vector<Chunk>  chunks;
+};
+
+#endif
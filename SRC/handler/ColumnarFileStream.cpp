@@ -0,0 +1,362 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <ColumnarFileStream.h>
+#include <classTags.h>
+#include <Vector.h>
+#include <Logging.h>
+#include <algorithm>
+#include <cstddef>
+#include <sstream>
+#include <string.h>
+
+ColumnarFileStream::ColumnarFileStream()
+  :OPS_Stream(OPS_STREAM_TAGS_ColumnarFileStream),
+   fileOpen(false), singlePrecision(false), rowsPerChunk(0),
+   numChunkRows(0), numColumns(-1), schemaWritten(false), numRows(0)
+{
+
+}
+
+
+ColumnarFileStream::ColumnarFileStream(const char *file, bool single, int rows)
+  :OPS_Stream(OPS_STREAM_TAGS_ColumnarFileStream),
+   fileOpen(false), singlePrecision(single), rowsPerChunk(rows),
+   numChunkRows(0), numColumns(-1), schemaWritten(false), numRows(0)
+{
+  this->setFile(file);
+}
+
+
+ColumnarFileStream::~ColumnarFileStream()
+{
+  this->close();
+}
+
+
+int
+ColumnarFileStream::setFile(const char *name, openMode mode, bool echo)
+{
+  if (name == nullptr) {
+    opserr << "ColumnarFileStream::setFile() - no name passed\n";
+    return -1;
+  }
+
+  if (mode == openMode::APPEND)
+    opserr << "ColumnarFileStream::setFile() - columnar files cannot be appended to; "
+           << name << " will be overwritten\n";
+
+  this->close();
+  fileName = name;
+  return 0;
+}
+
+
+int
+ColumnarFileStream::open(void)
+{
+  if (fileName.empty()) {
+    opserr << "ColumnarFileStream::open() - no file name has been set\n";
+    return -1;
+  }
+
+  if (fileOpen)
+    return 0;
+
+  theFile.open(fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (theFile.bad() || !theFile.is_open()) {
+    opserr << "WARNING - ColumnarFileStream::open() - could not open file " << fileName.c_str() << "\n";
+    return -1;
+  }
+
+  fileOpen = true;
+  schemaWritten = false;
+  numChunkRows = 0;
+  numRows = 0;
+  chunkOffsets.clear();
+  return 0;
+}
+
+
+int
+ColumnarFileStream::close(void)
+{
+  if (!fileOpen)
+    return 0;
+
+  if (numColumns < 0)
+    numColumns = static_cast<int>(columns.size());
+
+  if (!schemaWritten)
+    this->writeHeader();
+
+  if (numChunkRows > 0)
+    this->writeChunk();
+
+  // the index of the chunks goes at the end
+  const uint64_t indexOffset = static_cast<uint64_t>(theFile.tellp());
+  theFile.write(reinterpret_cast<const char *>(chunkOffsets.data()),
+                chunkOffsets.size()*sizeof(uint64_t));
+
+  theFile.seekp(0);
+  this->writeHeader();
+
+  // now that the index exists, record where it is
+  theFile.seekp(offsetof(ColumnarFileHeader, indexOffset));
+  theFile.write(reinterpret_cast<const char *>(&indexOffset), sizeof(indexOffset));
+
+  theFile.close();
+  fileOpen = false;
+  return 0;
+}
+
+
+int
+ColumnarFileStream::flush()
+{
+  if (!fileOpen || !schemaWritten)
+    return 0;
+
+  // the rows of an unfinished chunk stay in memory until the chunk is
+  // full or the stream is closed, so that every chunk but the last one
+  // has rowsPerChunk rows; only the chunks written so far are flushed
+  const std::streampos end = theFile.tellp();
+  theFile.seekp(0);
+  this->writeHeader();
+  theFile.seekp(end);
+  theFile.flush();
+  return 0;
+}
+
+
+int
+ColumnarFileStream::writeHeader(void)
+{
+  std::ostringstream schema;
+  for (const Column &column : columns)
+    schema << column.name << "\t" << column.tag << "\t" << column.dof << "\t"
+           << column.context << "\n";
+  const std::string text = schema.str();
+
+  ColumnarFileHeader header = {};
+  strcpy(header.magic, "OPSCOLS");
+  header.version     = 1;
+  header.valueSize   = singlePrecision ? sizeof(float) : sizeof(double);
+  header.numColumns  = static_cast<uint64_t>(std::max(numColumns, 0));
+  header.numRows     = numRows - numChunkRows;   // the rows in the chunks written
+  header.numChunks   = chunkOffsets.size();
+  header.schemaSize  = text.size();
+  header.indexOffset = 0;
+
+  theFile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  if (!schemaWritten) {
+    // pad so the chunks start on a multiple of 8 bytes
+    static const char zeros[8] = {};
+    theFile.write(text.data(), text.size());
+    theFile.write(zeros, (8 - text.size() % 8) % 8);
+    schemaWritten = true;
+  }
+  return theFile.good() ? 0 : -1;
+}
+
+
+int
+ColumnarFileStream::writeChunk(void)
+{
+  chunkOffsets.push_back(static_cast<uint64_t>(theFile.tellp()));
+
+  ColumnarChunkHeader header;
+  header.magic      = ColumnarChunkMagic;
+  header.numRows    = static_cast<uint32_t>(numChunkRows);
+  header.numColumns = static_cast<uint64_t>(numColumns);
+  theFile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  // transpose the rows into one block per column
+  std::vector<double> values(numChunkRows);
+  std::vector<float>  singles(singlePrecision ? numChunkRows : 0);
+  for (int j=0; j<numColumns; j++) {
+    for (int i=0; i<numChunkRows; i++)
+      values[i] = chunk[static_cast<std::size_t>(i)*numColumns + j];
+
+    if (singlePrecision) {
+      std::copy(values.begin(), values.end(), singles.begin());
+      theFile.write(reinterpret_cast<const char *>(singles.data()), numChunkRows*sizeof(float));
+    } else
+      theFile.write(reinterpret_cast<const char *>(values.data()), numChunkRows*sizeof(double));
+  }
+
+  numChunkRows = 0;
+  return theFile.good() ? 0 : -1;
+}
+
+
+void
+ColumnarFileStream::addRow(const double *s, int n)
+{
+  if (!fileOpen && this->open() != 0)
+    return;
+
+  if (numColumns < 0) {
+    // the first row fixes the number of columns; a schema that does not
+    // describe them all is padded with unnamed columns
+    numColumns = n;
+    if (static_cast<int>(columns.size()) != n) {
+      if (!columns.empty())
+        opserr << "WARNING - ColumnarFileStream - " << static_cast<int>(columns.size())
+               << " responses described for " << n << " columns of data in "
+               << fileName.c_str() << "\n";
+      columns.resize(n, Column{"", "", -1, 0});
+    }
+    if (rowsPerChunk <= 0)
+      rowsPerChunk = std::max(1, static_cast<int>((1 << 20)/(sizeof(double)*std::max(n, 1))));
+    chunk.resize(static_cast<std::size_t>(rowsPerChunk)*n);
+  }
+
+  if (!schemaWritten)
+    this->writeHeader();
+
+  if (numColumns == 0)
+    return;
+
+  double *row = &chunk[static_cast<std::size_t>(numChunkRows)*numColumns];
+  const int m = std::min(n, numColumns);
+  std::copy(s, s + m, row);
+  std::fill(row + m, row + numColumns, 0.0);
+
+  numRows++;
+  if (++numChunkRows == rowsPerChunk)
+    this->writeChunk();
+}
+
+
+int
+ColumnarFileStream::write(Vector &data)
+{
+  const int n = data.Size();
+  this->addRow(n > 0 ? &data(0) : nullptr, n);
+  return 0;
+}
+
+
+OPS_Stream &
+ColumnarFileStream::write(const double *s, int n)
+{
+  this->addRow(s, n);
+  return *this;
+}
+
+
+int
+ColumnarFileStream::tag(const char *name)
+{
+  Scope scope{name, name, -1, {}, 0};
+  if (!scopes.empty()) {
+    scope.context = scopes.back().context + "/" + name;
+    scope.tag     = scopes.back().tag;
+  }
+  scopes.push_back(scope);
+  return 0;
+}
+
+
+int
+ColumnarFileStream::tag(const char *name, const char *value)
+{
+  if (strcmp(name, "ResponseType") != 0)
+    return 0;
+
+  Column column{value, "", -1, 0};
+  if (!scopes.empty()) {
+    Scope &scope = scopes.back();
+    column.context = scope.context;
+    column.tag     = scope.tag;
+    if (scope.numResponses < static_cast<int>(scope.dofs.size()))
+      column.dof = scope.dofs[scope.numResponses];
+    scope.numResponses++;
+  }
+  columns.push_back(column);
+  return 0;
+}
+
+
+int
+ColumnarFileStream::endTag()
+{
+  if (!scopes.empty())
+    scopes.pop_back();
+  return 0;
+}
+
+
+int
+ColumnarFileStream::attr(const char *name, int value)
+{
+  if (scopes.empty())
+    return 0;
+
+  Scope &scope = scopes.back();
+  if (strcmp(name, "nodeTag") == 0 || strcmp(name, "eleTag") == 0)
+    scope.tag = value;
+  scope.context += " " + std::string(name) + "=" + std::to_string(value);
+  return 0;
+}
+
+
+int
+ColumnarFileStream::attr(const char *name, double value)
+{
+  if (scopes.empty())
+    return 0;
+
+  std::ostringstream text;
+  text << " " << name << "=" << value;
+  scopes.back().context += text.str();
+  return 0;
+}
+
+
+int
+ColumnarFileStream::attr(const char *name, const char *value)
+{
+  if (scopes.empty())
+    return 0;
+
+  Scope &scope = scopes.back();
+  if (strcmp(name, "dofs") == 0) {
+    std::istringstream dofs(value);
+    int dof;
+    while (dofs >> dof)
+      scope.dofs.push_back(dof);
+    return 0;
+  }
+  scope.context += " " + std::string(name) + "=" + value;
+  return 0;
+}
+
+
+int
+ColumnarFileStream::setOrder(const ID &orderData)
+{
+  return 0;
+}
+
+
+int
+ColumnarFileStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "ColumnarFileStream::sendSelf() - not yet implemented\n";
+  return -1;
+}
+
+
+int
+ColumnarFileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  opserr << "ColumnarFileStream::recvSelf() - not yet implemented\n";
+  return -1;
+}
@@ -0,0 +1,137 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: ColumnarFileStream writes recorder output as a binary file
+// that can be read one column at a time. The rows passed to write() are
+// gathered into chunks, and each chunk is stored column by column, so the
+// values of one response channel within a chunk are contiguous. The file
+// describes itself: the header gives the value type and sizes, and a
+// schema built from the tag()/attr() calls of the recorder names every
+// column with its response, node or element tag and dof.
+//
+// Layout (native byte order, all offsets in bytes from the start):
+//
+//   ColumnarFileHeader      64 bytes
+//   schema                  text, one line per column:
+//                             name \t tag \t dof \t context \n
+//                           padded with zeros to a multiple of 8 bytes
+//   chunk 0                 ColumnarChunkHeader, then numColumns blocks
+//                           of numRows values
+//   chunk 1 ...
+//   index                   uint64 offset of each chunk
+//
+// The header is rewritten with the number of rows and the offset of the
+// index when the stream is closed. A chunk is written when it is full,
+// and the last, partial chunk when the stream is closed; flush() only
+// flushes the chunks written so far. A file that was never closed (the
+// analysis stopped) has no index, but its complete chunks can still be
+// walked from the end of the schema.
+//
+// ColumnarFileReader (and opensees.recorder.ColumnarOutput in Python)
+// memory-map these files.
+//
+// Written: cmp
+//
+#ifndef ColumnarFileStream_h
+#define ColumnarFileStream_h
+
+#include <OPS_Stream.h>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+struct ColumnarFileHeader {
+  char     magic[8];        // "OPSCOLS"
+  uint32_t version;
+  uint32_t valueSize;       // 8 for float64, 4 for float32
+  uint64_t numColumns;
+  uint64_t numRows;
+  uint64_t numChunks;
+  uint64_t schemaSize;      // the schema follows the header, unpadded
+  uint64_t indexOffset;     // 0 if the file was not closed
+  uint64_t reserved;
+};
+
+struct ColumnarChunkHeader {
+  uint32_t magic;           // ColumnarChunkMagic
+  uint32_t numRows;
+  uint64_t numColumns;
+};
+
+static constexpr uint32_t ColumnarChunkMagic = 0x4B4E4843; // "CHNK"
+
+class ColumnarFileStream : public OPS_Stream
+{
+ public:
+  ColumnarFileStream();
+  ColumnarFileStream(const char *fileName, bool singlePrecision = false, int rowsPerChunk = 0);
+  ~ColumnarFileStream();
+
+  int setFile(const char *fileName, openMode mode = openMode::OVERWRITE, bool echo = false);
+  int open(void);
+  int close(void);
+  int flush();
+
+  // xml stuff, used to build the schema
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  // regular stuff
+  OPS_Stream& write(const double *s, int n);
+
+  // parallel stuff
+  int setOrder(const ID &orderOfData);
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel,
+               FEM_ObjectBroker &theBroker);
+
+ private:
+  struct Scope {
+    std::string name;
+    std::string context;
+    int tag;
+    std::vector<int> dofs;
+    int numResponses;
+  };
+
+  struct Column {
+    std::string name;
+    std::string context;
+    int tag;
+    int dof;
+  };
+
+  int  writeHeader(void);
+  int  writeChunk(void);
+  void addRow(const double *s, int n);
+
+  std::ofstream theFile;
+  std::string fileName;
+  bool fileOpen;
+  bool singlePrecision;
+  int  rowsPerChunk;
+
+  // the open tags and the columns found in them
+  std::vector<Scope> scopes;
+  std::vector<Column>  columns;
+
+  // the rows of the current chunk
+  std::vector<double> chunk;
+  int numChunkRows;
+  int numColumns;
+  bool schemaWritten;
+
+  uint64_t numRows;
+  std::vector<uint64_t> chunkOffsets;
+};
+
+#endif
@@ -24,6 +24,7 @@
 
 
 #include <DataFileStream.h>
+#include <RecordWriter.h>
 #include <Logging.h>
 #include <Vector.h>
 #include <iostream>
@@ -34,20 +35,51 @@
 #include <Message.h>
 #include <Matrix.h>
 #include <string.h>
+#include <mutex>
+#include <set>
 
 using std::ios;
 using std::ifstream;
 using std::getline;
 
+// every stream, so their files can all be flushed; never destroyed,
+// since streams may outlive the static objects
+static std::mutex &
+streamsMutex()
+{
+  static std::mutex *mutex = new std::mutex();
+  return *mutex;
+}
+
+static std::set<DataFileStream *> &
+streams()
+{
+  static std::set<DataFileStream *> *streams = new std::set<DataFileStream *>();
+  return *streams;
+}
+
+void
+DataFileStream::flushAll()
+{
+  std::lock_guard<std::mutex> lock(streamsMutex());
+  for (DataFileStream *stream : streams())
+    if (stream->fileOpen == 1)
+      stream->theFile.flush();
+}
+
 DataFileStream::DataFileStream(int indent)
   :OPS_Stream(OPS_STREAM_TAGS_DataFileStream), 
    fileOpen(0), fileName(0), indentSize(indent), sendSelfCount(0), theChannels(0), numDataRows(0),
-   mapping(0), maxCount(0), sizeColumns(0), theColumns(0), theData(0), theRemoteData(0), doCSV(0), commonColumns(0)
+   mapping(0), maxCount(0), sizeColumns(0), theColumns(0), theData(0), theRemoteData(0), doCSV(0), commonColumns(0),
+   async(false), posted(false)
 {
   if (indentSize < 1) indentSize = 1;
   indentString = new char[indentSize+5];
   for (int i=0; i<indentSize; i++)
     strcpy(indentString, " ");
+
+  std::lock_guard<std::mutex> lock(streamsMutex());
+  streams().insert(this);
 }
 
 
@@ -57,7 +89,8 @@ DataFileStream::DataFileStream(const char *file, openMode mode, int indent, int
    theChannels(0), numDataRows(0),
    mapping(0), maxCount(0), sizeColumns(0), 
    theColumns(0), theData(0), theRemoteData(0), 
-   doCSV(csv), closeOnWrite(closeWrite), commonColumns(0)
+   doCSV(csv), closeOnWrite(closeWrite), commonColumns(0),
+   async(false), posted(false)
 {
   thePrecision = prec;
   doScientific = scientific;
@@ -68,11 +101,20 @@ DataFileStream::DataFileStream(const char *file, openMode mode, int indent, int
     strcpy(indentString, " ");
 
   this->setFile(file, mode);
+
+  std::lock_guard<std::mutex> lock(streamsMutex());
+  streams().insert(this);
 }
 
 
 DataFileStream::~DataFileStream()
 {
+  {
+    std::lock_guard<std::mutex> lock(streamsMutex());
+    streams().erase(this);
+  }
+  this->sync();
+
   if (fileOpen == 1)
     theFile.close();
 
@@ -113,6 +155,8 @@ DataFileStream::~DataFileStream()
 int 
 DataFileStream::setFile(const char *name, openMode mode)
 {
+  this->sync();
+
   if (name == 0) {
     std::cerr << "DataFileStream::setFile() - no name passed\n";
     return -1;
@@ -152,6 +196,8 @@ DataFileStream::setFile(const char *name, openMode mode)
 int 
 DataFileStream::open(void)
 {
+  this->sync();
+
   // check setFile has been called
   if (fileName == 0) {
     std::cerr << "DataFileStream::open(void) - no file name has been set\n";
@@ -189,6 +235,8 @@ DataFileStream::open(void)
 int 
 DataFileStream::close(void)
 {
+  this->sync();
+
   if (fileOpen != 0)
     theFile.close();
   fileOpen = 0;
@@ -200,6 +248,8 @@ DataFileStream::close(void)
 int 
 DataFileStream::setPrecision(int prec)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -212,6 +262,8 @@ DataFileStream::setPrecision(int prec)
 int 
 DataFileStream::setFloatField(OPS_Stream::Float field)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -276,6 +328,13 @@ DataFileStream::write(Vector &data)
   //
 
   if (sendSelfCount == 0) {
+    // hand the row to the writer thread; closeOnWrite asks for the file
+    // to be complete after every row, so it is written here
+    if (async && !closeOnWrite && fileOpen != 0 && data.Size() > 0) {
+      OpenSees::RecordWriter::instance().post(*this, &data(0), data.Size());
+      posted = true;
+      return 0;
+    }
     (*this) << data;  
     if (closeOnWrite == true)
       this->close();
@@ -416,6 +475,8 @@ DataFileStream::write(Vector &data)
 OPS_Stream& 
 DataFileStream::write(const char *s,int n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -428,6 +489,8 @@ DataFileStream::write(const char *s,int n)
 OPS_Stream& 
 DataFileStream::write(const unsigned char*s,int n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -439,6 +502,8 @@ DataFileStream::write(const unsigned char*s,int n)
 OPS_Stream& 
 DataFileStream::write(const signed char*s,int n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -450,6 +515,8 @@ DataFileStream::write(const signed char*s,int n)
 OPS_Stream& 
 DataFileStream::write(const void *s, int n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -462,11 +529,21 @@ DataFileStream::write(const void *s, int n)
 OPS_Stream& 
 DataFileStream::write(const double *s, int n)
 {
-  numDataRows++;
+  this->sync();
 
   if (fileOpen == 0)
     this->open();
 
+  this->writeRow(s, n);
+  return *this;
+}
+
+
+void
+DataFileStream::writeRow(const double *s, int n)
+{
+  numDataRows++;
+
   if (fileOpen != 0) {
     if (n > 0) {
       if (doCSV == 0) {
@@ -483,13 +560,14 @@ DataFileStream::write(const double *s, int n)
       }
     }
   }
-  return *this;
 }
 
 
 OPS_Stream& 
 DataFileStream::operator<<(char c)
-{  
+{
+  this->sync();
+  
   if (fileOpen == 0)
     this->open();
 
@@ -501,6 +579,8 @@ DataFileStream::operator<<(char c)
 OPS_Stream& 
 DataFileStream::operator<<(unsigned char c)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -512,6 +592,8 @@ DataFileStream::operator<<(unsigned char c)
 OPS_Stream& 
 DataFileStream::operator<<(signed char c)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -523,6 +605,8 @@ DataFileStream::operator<<(signed char c)
 OPS_Stream& 
 DataFileStream::operator<<(const char *s)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -538,6 +622,8 @@ DataFileStream::operator<<(const char *s)
 OPS_Stream& 
 DataFileStream::operator<<(const unsigned char *s)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -549,6 +635,8 @@ DataFileStream::operator<<(const unsigned char *s)
 OPS_Stream& 
 DataFileStream::operator<<(const signed char *s)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -560,6 +648,8 @@ DataFileStream::operator<<(const signed char *s)
 OPS_Stream& 
 DataFileStream::operator<<(const void *p)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -572,6 +662,8 @@ DataFileStream::operator<<(const void *p)
 OPS_Stream& 
 DataFileStream::operator<<(int n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -583,6 +675,8 @@ DataFileStream::operator<<(int n)
 OPS_Stream& 
 DataFileStream::operator<<(unsigned int n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -594,6 +688,8 @@ DataFileStream::operator<<(unsigned int n)
 OPS_Stream& 
 DataFileStream::operator<<(long n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -606,6 +702,8 @@ DataFileStream::operator<<(long n)
 OPS_Stream& 
 DataFileStream::operator<<(unsigned long n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -618,6 +716,8 @@ DataFileStream::operator<<(unsigned long n)
 OPS_Stream& 
 DataFileStream::operator<<(short n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -630,6 +730,8 @@ DataFileStream::operator<<(short n)
 OPS_Stream& 
 DataFileStream::operator<<(unsigned short n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -642,6 +744,8 @@ DataFileStream::operator<<(unsigned short n)
 OPS_Stream& 
 DataFileStream::operator<<(bool b)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -654,6 +758,8 @@ DataFileStream::operator<<(bool b)
 OPS_Stream& 
 DataFileStream::operator<<(double n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -665,6 +771,8 @@ DataFileStream::operator<<(double n)
 OPS_Stream& 
 DataFileStream::operator<<(float n)
 {
+  this->sync();
+
   if (fileOpen == 0)
     this->open();
 
@@ -785,6 +893,8 @@ DataFileStream::indent(void)
 int
 DataFileStream::setOrder(const ID &orderData)
 {
+  this->sync();
+
   if (sendSelfCount == 0)
     return 0;
 
@@ -947,8 +1057,27 @@ DataFileStream::setOrder(const ID &orderData)
 }
 
 int DataFileStream::flush() {
+  this->sync();
   if (theFile.is_open() && theFile.good()) {
     theFile.flush();
   }
   return 0;
 }
+
+
+void
+DataFileStream::setAsync(bool passedAsync)
+{
+  this->sync();
+  async = passedAsync;
+}
+
+
+void
+DataFileStream::sync(void)
+{
+  if (posted) {
+    OpenSees::RecordWriter::instance().drain();
+    posted = false;
+  }
+}
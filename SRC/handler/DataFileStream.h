@@ -31,6 +31,7 @@
 using std::ofstream;
 
 class Matrix;
+namespace OpenSees { class RecordWriter; }
 
 class DataFileStream : public OPS_Stream
 {
@@ -50,6 +51,14 @@ class DataFileStream : public OPS_Stream
   int width(int width) {return 0;};
   const char *getFileName(void) {return fileName;}
 
+  // when set, rows passed to write(Vector &) are copied and formatted
+  // into the file by the RecordWriter thread
+  void setAsync(bool async);
+
+  // flush the open files of all streams, e.g. so that a child made by
+  // fork() has nothing buffered to write again
+  static void flushAll();
+
   // xml stuff
   int tag(const char *);
   int tag(const char *, const char *);
@@ -90,6 +99,10 @@ class DataFileStream : public OPS_Stream
 	       FEM_ObjectBroker &theBroker);
 
  private:
+  friend class OpenSees::RecordWriter;
+  void writeRow(const double *s, int n);
+  void sync(void);
+
   ofstream theFile;
   int fileOpen;
   openMode theOpenMode;
@@ -118,6 +131,9 @@ class DataFileStream : public OPS_Stream
   bool doScientific;
 
   ID *commonColumns;
+
+  bool async;
+  bool posted;    // rows have been posted since the last sync()
 };
 
 #endif
@@ -0,0 +1,154 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <RecordWriter.h>
+#include <DataFileStream.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OpenSees {
+
+struct RecordWriter::State {
+  struct Row {
+    DataFileStream *stream;
+    std::size_t     offset;
+    int             size;
+  };
+
+  struct Buffer {
+    std::vector<double> values;
+    std::vector<Row>    rows;
+  };
+
+  Buffer buffers[2];
+  int    front    = 0;
+  bool   writing  = false;
+  std::size_t capacity = std::size_t(1) << 20;
+
+  std::mutex              mutex;
+  std::condition_variable posted;
+  std::condition_variable written;
+};
+
+
+// never destroyed, so streams that outlive the static objects can
+// still drain into it
+static std::atomic<RecordWriter *> theWriter(nullptr);
+
+RecordWriter &
+RecordWriter::instance()
+{
+  static RecordWriter *writer = [] {
+    RecordWriter *writer = new RecordWriter();
+    std::atexit([] { RecordWriter::instance().drain(); });
+    theWriter = writer;
+    return writer;
+  }();
+  return *writer;
+}
+
+
+void
+RecordWriter::beforeFork()
+{
+  if (RecordWriter *writer = theWriter.load())
+    writer->drain();
+  DataFileStream::flushAll();
+}
+
+
+void
+RecordWriter::afterForkChild()
+{
+  // the state of the parent is left as it is, since its lock may be
+  // held by a writer thread that was not copied
+  if (RecordWriter *writer = theWriter.load()) {
+    const std::size_t capacity = writer->state->capacity;
+    writer->state = new State();
+    writer->state->capacity = capacity;
+    std::thread(&RecordWriter::run, writer).detach();
+  }
+}
+
+
+RecordWriter::RecordWriter()
+:state(new State())
+{
+  std::thread(&RecordWriter::run, this).detach();
+}
+
+
+void
+RecordWriter::setCapacity(std::size_t numValues)
+{
+  std::lock_guard<std::mutex> lock(state->mutex);
+  state->capacity = numValues > 0 ? numValues : 1;
+}
+
+
+void
+RecordWriter::post(DataFileStream &stream, const double *values, int n)
+{
+  std::unique_lock<std::mutex> lock(state->mutex);
+
+  // wait for the writer to take the front buffer if the row does not fit;
+  // a row larger than the whole buffer goes into an empty one
+  state->written.wait(lock, [&] {
+    const State::Buffer &front = state->buffers[state->front];
+    return front.rows.empty() || front.values.size() + n <= state->capacity;
+  });
+
+  State::Buffer &front = state->buffers[state->front];
+  front.rows.push_back({&stream, front.values.size(), n});
+  front.values.insert(front.values.end(), values, values + n);
+
+  lock.unlock();
+  state->posted.notify_one();
+}
+
+
+void
+RecordWriter::drain()
+{
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->written.wait(lock, [&] {
+    return !state->writing && state->buffers[state->front].rows.empty();
+  });
+}
+
+
+void
+RecordWriter::run()
+{
+  std::unique_lock<std::mutex> lock(state->mutex);
+  while (true) {
+    state->posted.wait(lock, [&] { return !state->buffers[state->front].rows.empty(); });
+
+    // swap the buffers so the analysis can go on filling the other one
+    State::Buffer &back = state->buffers[state->front];
+    state->front   = 1 - state->front;
+    state->writing = true;
+    lock.unlock();
+    state->written.notify_all();
+
+    for (const State::Row &row : back.rows)
+      row.stream->writeRow(&back.values[row.offset], row.size);
+    back.rows.clear();
+    back.values.clear();
+
+    lock.lock();
+    state->writing = false;
+    state->written.notify_all();
+  }
+}
+
+} // namespace OpenSees
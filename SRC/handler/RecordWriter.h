@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: RecordWriter moves the formatting and writing of recorder
+// output off the thread running the analysis. A stream posts each row of
+// values it is given; the values are copied into the front of two
+// buffers and a background thread formats the rows of the back buffer
+// into their files. When the writer has finished the back buffer the two
+// are swapped, so after the first few steps no memory is allocated.
+//
+// The front buffer holds at most a fixed number of values. A post that
+// does not fit waits for the writer to take the buffer, which bounds the
+// memory used and keeps the analysis from running arbitrarily far ahead
+// of the disk.
+//
+// Rows are written in the order they were posted. Before anything else
+// is done with a stream that has posted rows (it is flushed, closed,
+// written to directly or destroyed) drain() must be called; the streams
+// do this themselves, and rows still pending when the program exits are
+// written by an atexit() handler.
+//
+// A process that fork()s must call beforeFork() first, which drains the
+// writer and flushes the files of the streams so that no rows are copied
+// into the child to be written twice, and afterForkChild() in the child,
+// which has no writer thread of its own until then.
+//
+// Written: cmp
+//
+#ifndef RecordWriter_h
+#define RecordWriter_h
+
+#include <cstddef>
+
+class DataFileStream;
+
+namespace OpenSees {
+
+class RecordWriter
+{
+  public:
+    // the writer shared by all streams; it is started on first use
+    static RecordWriter &instance();
+
+    // queue a row of n values to be written to a stream
+    void post(DataFileStream &stream, const double *values, int n);
+
+    // wait until every row posted so far has been written
+    void drain();
+
+    // the number of values the front buffer may hold
+    void setCapacity(std::size_t numValues);
+
+    // drain the writer, if it was started, and flush the streams before fork()
+    static void beforeFork();
+    // start a writer in the child made by fork()
+    static void afterForkChild();
+
+  private:
+    RecordWriter();
+    ~RecordWriter() = delete;
+    RecordWriter(const RecordWriter &) = delete;
+    RecordWriter &operator=(const RecordWriter &) = delete;
+
+    void run();
+
+    struct State;
+    State *state;
+};
+
+} // namespace OpenSees
+
+#endif
@@ -406,7 +406,7 @@ ElasticLinearFrameSection3d::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(7);
+    static thread_local Vector data(7);
 
     int dataTag = this->getDbTag();
 
@@ -434,7 +434,7 @@ ElasticLinearFrameSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
     int res = 0;
 
-      static Vector data(7);
+      static thread_local Vector data(7);
 
     int dataTag = this->getDbTag();
 
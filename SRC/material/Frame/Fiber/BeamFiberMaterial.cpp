@@ -34,8 +34,8 @@
 #include <string.h>
 #include <elementAPI.h>
 
-Vector BeamFiberMaterial::stress(3);
-Matrix BeamFiberMaterial::tangent(3,3);
+thread_local Vector BeamFiberMaterial::stress(3);
+thread_local Matrix BeamFiberMaterial::tangent(3,3);
 
 //      0  1  2  3  4  5
 // ND: 11 22 33 12 23 31
@@ -193,10 +193,10 @@ BeamFiberMaterial::setTrialStrain(const Vector &strainFromElement)
   //newton loop to solve for out-of-plane strains
 
   double norm;
-  static Vector condensedStress(3);
-  static Vector strainIncrement(3);
-  static Vector threeDstrain(6);
-  static Matrix dd22(3,3);
+  static thread_local Vector condensedStress(3);
+  static thread_local Vector strainIncrement(3);
+  static thread_local Vector threeDstrain(6);
+  static thread_local Matrix dd22(3,3);
 
   int count = 0;
   const int maxCount = 20;
@@ -290,7 +290,7 @@ BeamFiberMaterial::getStressSensitivity(int gradIndex,
 
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd12(3,3);
+  static thread_local Matrix dd12(3,3);
   dd12(0,0) = threeDtangent(0,1);
   dd12(1,0) = threeDtangent(3,1);
   dd12(2,0) = threeDtangent(5,1);
@@ -304,7 +304,7 @@ BeamFiberMaterial::getStressSensitivity(int gradIndex,
   dd12(2,2) = threeDtangent(5,4);
 
 
-  static Matrix dd22(3,3);
+  static thread_local Matrix dd22(3,3);
   dd22(0,0) = threeDtangent(1,1);
   dd22(1,0) = threeDtangent(2,1);
   dd22(2,0) = threeDtangent(4,1);
@@ -318,12 +318,12 @@ BeamFiberMaterial::getStressSensitivity(int gradIndex,
   dd22(2,2) = threeDtangent(4,4);
 
   
-  static Vector sigma2(3);
+  static thread_local Vector sigma2(3);
   sigma2(0) = threeDstress(1);
   sigma2(1) = threeDstress(2);
   sigma2(2) = threeDstress(4);
 
-  static Vector dd22sigma2(3);
+  static thread_local Vector dd22sigma2(3);
   dd22.Solve(sigma2,dd22sigma2);
 
   stress.addMatrixVector(1.0, dd12, dd22sigma2, -1.0);
@@ -336,7 +336,7 @@ BeamFiberMaterial::getTangent()
 {
   const Matrix &threeDtangent = theMaterial->getTangent();
 
-  static Matrix dd11(3,3);
+  static thread_local Matrix dd11(3,3);
   dd11(0,0) = threeDtangent(0,0);
   dd11(1,0) = threeDtangent(3,0);
   dd11(2,0) = threeDtangent(5,0);
@@ -350,7 +350,7 @@ BeamFiberMaterial::getTangent()
   dd11(2,2) = threeDtangent(5,5);
 
 
-  static Matrix dd12(3,3);
+  static thread_local Matrix dd12(3,3);
   dd12(0,0) = threeDtangent(0,1);
   dd12(1,0) = threeDtangent(3,1);
   dd12(2,0) = threeDtangent(5,1);
@@ -363,7 +363,7 @@ BeamFiberMaterial::getTangent()
   dd12(1,2) = threeDtangent(3,4);
   dd12(2,2) = threeDtangent(5,4);
 
-  static Matrix dd21(3,3);
+  static thread_local Matrix dd21(3,3);
   dd21(0,0) = threeDtangent(1,0);
   dd21(1,0) = threeDtangent(2,0);
   dd21(2,0) = threeDtangent(4,0);
@@ -376,7 +376,7 @@ BeamFiberMaterial::getTangent()
   dd21(1,2) = threeDtangent(2,5);
   dd21(2,2) = threeDtangent(4,5);
 
-  static Matrix dd22(3,3);
+  static thread_local Matrix dd22(3,3);
   dd22(0,0) = threeDtangent(1,1);
   dd22(1,0) = threeDtangent(2,1);
   dd22(2,0) = threeDtangent(4,1);
@@ -393,7 +393,7 @@ BeamFiberMaterial::getTangent()
   //int Solve(const Vector &V, Vector &res) const;
   //int Solve(const Matrix &M, Matrix &res) const;
   //condensation 
-  static Matrix dd22invdd21(3,3);
+  static thread_local Matrix dd22invdd21(3,3);
   dd22.Solve(dd21, dd22invdd21);
 
   //this->tangent   = dd11; 
@@ -409,7 +409,7 @@ BeamFiberMaterial::getInitialTangent()
 {
   const Matrix &threeDtangent = theMaterial->getInitialTangent();
 
-  static Matrix dd11(3,3);
+  static thread_local Matrix dd11(3,3);
   dd11(0,0) = threeDtangent(0,0);
   dd11(1,0) = threeDtangent(3,0);
   dd11(2,0) = threeDtangent(5,0);
@@ -423,7 +423,7 @@ BeamFiberMaterial::getInitialTangent()
   dd11(2,2) = threeDtangent(5,5);
 
 
-  static Matrix dd12(3,3);
+  static thread_local Matrix dd12(3,3);
   dd12(0,0) = threeDtangent(0,1);
   dd12(1,0) = threeDtangent(3,1);
   dd12(2,0) = threeDtangent(5,1);
@@ -436,7 +436,7 @@ BeamFiberMaterial::getInitialTangent()
   dd12(1,2) = threeDtangent(3,4);
   dd12(2,2) = threeDtangent(5,4);
 
-  static Matrix dd21(3,3);
+  static thread_local Matrix dd21(3,3);
   dd21(0,0) = threeDtangent(1,0);
   dd21(1,0) = threeDtangent(2,0);
   dd21(2,0) = threeDtangent(4,0);
@@ -449,7 +449,7 @@ BeamFiberMaterial::getInitialTangent()
   dd21(1,2) = threeDtangent(2,5);
   dd21(2,2) = threeDtangent(4,5);
 
-  static Matrix dd22(3,3);
+  static thread_local Matrix dd22(3,3);
   dd22(0,0) = threeDtangent(1,1);
   dd22(1,0) = threeDtangent(2,1);
   dd22(2,0) = threeDtangent(4,1);
@@ -466,7 +466,7 @@ BeamFiberMaterial::getInitialTangent()
   //int Solve(const Vector &V, Vector &res) const;
   //int Solve(const Matrix &M, Matrix &res) const;
   //condensation 
-  static Matrix dd22invdd21(3,3);
+  static thread_local Matrix dd22invdd21(3,3);
   dd22.Solve(dd21, dd22invdd21);
 
   //this->tangent   = dd11; 
@@ -492,7 +492,7 @@ BeamFiberMaterial::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and associated materials class and database tags into an id and send it
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -509,7 +509,7 @@ BeamFiberMaterial::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(3);
+  static thread_local Vector vecData(3);
   vecData(0) = Cstrain22;
   vecData(1) = Cstrain33;
   vecData(2) = Cgamma23;
@@ -534,7 +534,7 @@ BeamFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   int res = 0;
 
   // recv an id containing the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "BeamFiberMaterial::sendSelf() - failed to send id data\n";
@@ -558,7 +558,7 @@ BeamFiberMaterial::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(3);
+  static thread_local Vector vecData(3);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "BeamFiberMaterial::sendSelf() - failed to send vector data\n";
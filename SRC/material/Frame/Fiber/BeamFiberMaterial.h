@@ -82,8 +82,8 @@ class BeamFiberMaterial: public NDMaterial {
 
     Vector strain;
 
-    static Vector stress;
-    static Matrix tangent;
+    static thread_local Vector stress;
+    static thread_local Matrix tangent;
 };
 
 
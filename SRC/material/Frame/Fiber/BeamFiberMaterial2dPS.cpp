@@ -33,8 +33,8 @@
 #include <string.h>
 #include <elementAPI.h>
 
-Vector BeamFiberMaterial2dPS::stress(2);
-Matrix BeamFiberMaterial2dPS::tangent(2,2);
+thread_local Vector BeamFiberMaterial2dPS::stress(2);
+thread_local Matrix BeamFiberMaterial2dPS::tangent(2,2);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_BeamFiberMaterial2dPS)
 {
@@ -176,10 +176,10 @@ BeamFiberMaterial2dPS::setTrialStrain(const Vector &strainFromElement)
   //newton loop to solve for out-of-plane strains
 
   double norm;
-  static Vector condensedStress(1);
-  static Vector strainIncrement(1);
-  static Vector PSstrain(3);
-  static Matrix dd22(1,1);
+  static thread_local Vector condensedStress(1);
+  static thread_local Vector strainIncrement(1);
+  static thread_local Vector PSstrain(3);
+  static thread_local Matrix dd22(1,1);
 
   int count = 0;
   const int maxCount = 20;
@@ -251,17 +251,17 @@ BeamFiberMaterial2dPS::getStressSensitivity(int gradIndex,
 
   const Matrix &PStangent = theMaterial->getTangent();
 
-  static Matrix dd12(2,1);
+  static thread_local Matrix dd12(2,1);
   dd12(0,0) = PStangent(0,1);
   dd12(1,0) = PStangent(2,1);
 
-  static Matrix dd22(1,1);
+  static thread_local Matrix dd22(1,1);
   dd22(0,0) = PStangent(1,1);
   
-  static Vector sigma2(1);
+  static thread_local Vector sigma2(1);
   sigma2(0) = PSstress(1);
 
-  static Vector dd22sigma2(1);
+  static thread_local Vector dd22sigma2(1);
   dd22.Solve(sigma2,dd22sigma2);
 
   stress.addMatrixVector(1.0, dd12, dd22sigma2, -1.0);
@@ -273,18 +273,18 @@ int
 BeamFiberMaterial2dPS::commitSensitivity(const Vector &depsdh, int gradIndex,
 				       int numGrads)
 {
-  static Vector dstraindh(6);
+  static thread_local Vector dstraindh(6);
 
   const Matrix &PStangent = theMaterial->getTangent();
 
-  static Matrix dd22(1,1);
+  static thread_local Matrix dd22(1,1);
   dd22(0,0) = PStangent(1,1);
 
-  static Matrix dd21(1,2);
+  static thread_local Matrix dd21(1,2);
   dd21(0,0) = PStangent(1,0);
   dd21(0,1) = PStangent(1,2);
   
-  static Vector sigma2(1);
+  static thread_local Vector sigma2(1);
   sigma2.addMatrixVector(0.0, dd21, depsdh, -1.0);
 
   const Vector &PSstress = theMaterial->getStressSensitivity(gradIndex, true);
@@ -295,7 +295,7 @@ BeamFiberMaterial2dPS::commitSensitivity(const Vector &depsdh, int gradIndex,
   //opserr << PSstress2;
   //sigma2(0) += PSstress2(1);
 
-  static Vector strain2(1);
+  static thread_local Vector strain2(1);
   dd22.Solve(sigma2,strain2);
 
   dstraindh(0) = depsdh(0);
@@ -310,28 +310,28 @@ BeamFiberMaterial2dPS::getTangent()
 {
   const Matrix &PStangent = theMaterial->getTangent();
 
-  static Matrix dd11(2,2);
+  static thread_local Matrix dd11(2,2);
   dd11(0,0) = PStangent(0,0);
   dd11(1,0) = PStangent(2,0);
 
   dd11(0,1) = PStangent(0,2);
   dd11(1,1) = PStangent(2,2);
 
-  static Matrix dd12(2,1);
+  static thread_local Matrix dd12(2,1);
   dd12(0,0) = PStangent(0,1);
   dd12(1,0) = PStangent(2,1);
 
-  static Matrix dd21(1,2);
+  static thread_local Matrix dd21(1,2);
   dd21(0,0) = PStangent(1,0);
   dd21(0,1) = PStangent(1,2);
 
-  static Matrix dd22(1,1);
+  static thread_local Matrix dd22(1,1);
   dd22(0,0) = PStangent(1,1);
 
   //int Solve(const Vector &V, Vector &res) const;
   //int Solve(const Matrix &M, Matrix &res) const;
   //condensation 
-  static Matrix dd22invdd21(1,2);
+  static thread_local Matrix dd22invdd21(1,2);
   dd22.Solve(dd21, dd22invdd21);
 
   //this->tangent   = dd11; 
@@ -347,28 +347,28 @@ BeamFiberMaterial2dPS::getInitialTangent()
 {
   const Matrix &PStangent = theMaterial->getInitialTangent();
 
-  static Matrix dd11(2,2);
+  static thread_local Matrix dd11(2,2);
   dd11(0,0) = PStangent(0,0);
   dd11(1,0) = PStangent(2,0);
 
   dd11(0,1) = PStangent(0,2);
   dd11(1,1) = PStangent(2,2);
 
-  static Matrix dd12(2,1);
+  static thread_local Matrix dd12(2,1);
   dd12(0,0) = PStangent(0,1);
   dd12(1,0) = PStangent(2,1);
 
-  static Matrix dd21(1,2);
+  static thread_local Matrix dd21(1,2);
   dd21(0,0) = PStangent(1,0);
   dd21(0,1) = PStangent(1,2);
 
-  static Matrix dd22(1,1);
+  static thread_local Matrix dd22(1,1);
   dd22(0,0) = PStangent(1,1);
 
   //int Solve(const Vector &V, Vector &res) const;
   //int Solve(const Matrix &M, Matrix &res) const;
   //condensation 
-  static Matrix dd22invdd21(1,2);
+  static thread_local Matrix dd22invdd21(1,2);
   dd22.Solve(dd21, dd22invdd21);
 
   //this->tangent   = dd11; 
@@ -394,7 +394,7 @@ BeamFiberMaterial2dPS::sendSelf(int commitTag, Channel &theChannel)
   int res = 0;
 
   // put tag and assocaited materials class and database tags into an id and send it
-  static ID idData(3);
+  static thread_local ID idData(3);
   idData(0) = this->getTag();
   idData(1) = theMaterial->getClassTag();
   int matDbTag = theMaterial->getDbTag();
@@ -411,7 +411,7 @@ BeamFiberMaterial2dPS::sendSelf(int commitTag, Channel &theChannel)
   }
 
   // put the strains in a vector and send it
-  static Vector vecData(1);
+  static thread_local Vector vecData(1);
   vecData(0) = Cstrain22;
 
   res = theChannel.sendVector(this->getDbTag(), commitTag, vecData);
@@ -434,7 +434,7 @@ BeamFiberMaterial2dPS::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBr
   int res = 0;
 
   // recv an id containg the tag and associated materials class and db tags
-  static ID idData(3);
+  static thread_local ID idData(3);
   res = theChannel.sendID(this->getDbTag(), commitTag, idData);
   if (res < 0) {
     opserr << "BeamFiberMaterial2dPS::sendSelf() - failed to send id data\n";
@@ -458,7 +458,7 @@ BeamFiberMaterial2dPS::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBr
   theMaterial->setDbTag(idData(2));
 
   // recv a vector containing strains and set the strains
-  static Vector vecData(1);
+  static thread_local Vector vecData(1);
   res = theChannel.recvVector(this->getDbTag(), commitTag, vecData);
   if (res < 0) {
     opserr << "BeamFiberMaterial2dPS::sendSelf() - failed to send vector data\n";
@@ -35,8 +35,8 @@
 #include <string.h>
 #include <stdlib.h>
 
-Vector J2BeamFiber2d::sigma(2);
-Matrix J2BeamFiber2d::D(2,2);
+thread_local Vector J2BeamFiber2d::sigma(2);
+thread_local Matrix J2BeamFiber2d::D(2,2);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_J2BeamFiber2dMaterial)
 {
@@ -171,13 +171,13 @@ J2BeamFiber2d::getTangent (void)
     // Solve for dg
     double dg = 0.0;
 
-    static Vector R(3);
+    static thread_local Vector R(3);
     R(0) = 0.0; R(1) = 0.0; R(2) = F;
-    static Vector x(3);
+    static thread_local Vector x(3);
     x(0) = xsi[0]; x(1) = xsi[1]; x(2) = dg;
 
-    static Matrix J(3,3);
-    static Vector dx(3);
+    static thread_local Matrix J(3,3);
+    static thread_local Vector dx(3);
 
     int iter = 0; int maxIter = 25;
     while (iter < maxIter && R.Norm() > sigmaY*1.0e-14) {
@@ -239,7 +239,7 @@ J2BeamFiber2d::getTangent (void)
     //J(2,2) = -q*two3Hkin/(1.0+dg*two3Hkin) - root23*Hiso;
     J(2,2) = -q*two3Hkin/(1.0+dg*two3Hkin) - two3*Hiso*q;
 
-    static Matrix invJ(3,3);
+    static thread_local Matrix invJ(3,3);
     J.Invert(invJ);
 
     D(0,0) = invJ(0,0)*E;
@@ -293,13 +293,13 @@ J2BeamFiber2d::getStress (void)
     // Solve for dg
     double dg = 0.0;
 
-    static Vector R(3);
+    static thread_local Vector R(3);
     R(0) = 0.0; R(1) = 0.0; R(2) = F;
-    static Vector x(3);
+    static thread_local Vector x(3);
     x(0) = xsi[0]; x(1) = xsi[1]; x(2) = dg;
 
-    static Matrix J(3,3);
-    static Vector dx(3);
+    static thread_local Matrix J(3,3);
+    static thread_local Vector dx(3);
 
     int iter = 0; int maxIter = 25;
     while (iter < maxIter && R.Norm() > sigmaY*1.0e-14) {
@@ -432,7 +432,7 @@ J2BeamFiber2d::getOrder (void) const
 const Vector&
 J2BeamFiber2d::getStressSensitivity(int gradIndex, bool conditional)
 {
-  static Vector sigma(2);
+  static thread_local Vector sigma(2);
 
   sigma(0) = 0.0;
   sigma(1) = 0.0;
@@ -486,9 +486,9 @@ J2BeamFiber2d::getStressSensitivity(int gradIndex, bool conditional)
     sigma(1) = dGdh*(Tepsilon(1)-epsPn1[1]) - G*depsPdh[1];
   }
   else {
-    static Matrix J(3,3);
-    static Vector b(3);
-    static Vector dx(3);
+    static thread_local Matrix J(3,3);
+    static thread_local Vector b(3);
+    static thread_local Vector dx(3);
 
     double dg = dg_n1;
 
@@ -583,9 +583,9 @@ J2BeamFiber2d::commitSensitivity(const Vector &depsdh, int gradIndex, int numGra
     // Do nothing
   }
   else {
-    static Matrix J(3,3);
-    static Vector b(3);
-    static Vector dx(3);
+    static thread_local Matrix J(3,3);
+    static thread_local Vector b(3);
+    static thread_local Vector dx(3);
 
     double dg = dg_n1;
 
@@ -626,7 +626,7 @@ J2BeamFiber2d::sendSelf (int commitTag, Channel &theChannel)
 {
   int res = 0;
 
-  static Vector data(6);
+  static thread_local Vector data(6);
   
   data(0) = this->getTag();
   data(1) = E;
@@ -650,7 +650,7 @@ J2BeamFiber2d::recvSelf (int commitTag, Channel &theChannel,
 {
   int res = 0;
   
-  static Vector data(6);
+  static thread_local Vector data(6);
   
   res += theChannel.recvVector(this->getDbTag(), commitTag, data);
   if (res < 0) {
@@ -28,9 +28,7 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 #include <ElasticMaterial.h>
 
 #include "FiberResponse.h"
-
-// #include <threads/thread_pool.hpp>
-// #define N_FIBER_THREADS 6
+#include "FiberReduction3d.h"
 
 ID FrameFiberSection3d::code(4);
 
@@ -42,9 +40,6 @@ FrameFiberSection3d::FrameFiberSection3d(int tag, int num, UniaxialMaterial &tor
     QzBar(0.0), QyBar(0.0), Abar(0.0), 
     yBar(0.0), zBar(0.0), computeCentroid(compCentroid),
     theTorsion(0),
-#ifdef N_FIBER_THREADS
-    pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
-#endif
     e(es), s(sr)
 {
     if (sizeFibers != 0) {
@@ -75,9 +70,6 @@ FrameFiberSection3d::FrameFiberSection3d():
   matData(0),
   QzBar(0.0), QyBar(0.0), Abar(0.0), 
   yBar(0.0), zBar(0.0), computeCentroid(true),
-#ifdef N_FIBER_THREADS
-  pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
-#endif
   e(es), s(sr), theTorsion(nullptr)
 {
   es.zero();
@@ -240,72 +232,6 @@ FrameFiberSection3d::addFiber(UniaxialMaterial &theMat,
 }
 
 
-#ifdef N_FIBER_THREADS
-#include <mutex>
-int
-FrameFiberSection3d::setTrialSectionDeformation(const Vector &deforms)
-{
-  e = deforms;
- 
-  sr.zero();
-  ks.zero();
-
-  const double e0 = deforms(0), // u'
-               e1 = deforms(1),
-               e2 = deforms(2),
-               e3 = deforms(3);
-
-  int res = 0;
-  std::mutex resp_mutex;
-
-  ((OpenSees::thread_pool*)pool)->submit_loop<unsigned int>(0, numFibers,
-  [&,e0,e1,e2](int i){
-    int res = 0;
-
-    const double y  = matData[3*i]   - yBar;
-    const double z  = matData[3*i+1] - zBar;
-    const double A  = matData[3*i+2];
-
-    // determine material strain and set it
-    const double strain = e0 - y*e1 + z*e2;
-    double tangent, stress;
-    res += theMaterials[i]->setTrial(strain, stress, tangent);
-
-    const double EA = tangent * A;
-
-    const std::lock_guard<std::mutex> lock(resp_mutex);
-    ks(0, 0) +=     EA;
-    ks(0, 1) +=  -y*EA;
-    ks(0, 2) +=   z*EA;
-
-    ks(1, 1) +=  y*y*EA;
-    ks(2, 2) +=  z*z*EA; 
-    ks(1, 2) += -y*z*EA;
-
-    double fs0 = stress * A;
-    sr[ 0] +=    fs0;  // N
-    sr[ 1] += -y*fs0;  // Mz
-    sr[ 2] +=  z*fs0;  // My
-
-    return res;
-  }).wait();
-
-  ks(1, 0) = ks(0, 1);
-  ks(2, 0) = ks(0, 2);
-  ks(2, 1) = ks(1, 2);
- 
-  if (theTorsion != nullptr) {
-    double stress, tangent;
-    res += theTorsion->setTrial(e3, stress, tangent);
-    sr[ 3] = stress;
-    ks(3, 3) = tangent;
-  }
-
-  return res;
-}
-
-#else
-
 int
 FrameFiberSection3d::setTrialSectionDeformation(const Vector &deforms)
 {
@@ -319,34 +245,23 @@ FrameFiberSection3d::setTrialSectionDeformation(const Vector &deforms)
                k2 = deforms(2),
                e3 = deforms(3);
 
-  int res = 0;
-  for (int i = 0; i < numFibers; i++) {
-
-    const double y  = matData[3*i]   - yBar;
-    const double z  = matData[3*i+1] - zBar;
-    const double A  = matData[3*i+2];
+  const OpenSees::FiberSums3d sums = 
+    OpenSees::fiber_sums_3d(theMaterials, 
+                            OpenSees::find_uniaxial_runs(theMaterials, numFibers, fiberRuns),
+                            matData.get(), numFibers, yBar, zBar, e0, k1, k2);
 
-    // Determine material strain and set it
-    double strain = e0 - y*k1 + z*k2;
-    double tangent, stress;
-    res += theMaterials[i]->setTrial(strain, stress, tangent);
+  int res = sums.res;
 
-    double EA     = tangent * A;
+  ks(0, 0) = sums.k[0];
+  ks(0, 1) = sums.k[1];
+  ks(0, 2) = sums.k[2];
+  ks(1, 1) = sums.k[3];
+  ks(2, 2) = sums.k[4];
+  ks(1, 2) = sums.k[5];
 
-    ks( 0, 0) +=     EA;
-    ks( 0, 1) +=  -y*EA;
-    ks( 0, 2) +=   z*EA;
-//  ks( 0, 2) +=   z*EA;
-
-    ks( 1, 1) +=  y*y*EA; // 5
-    ks( 2, 2) +=  z*z*EA; // 10
-    ks( 1, 2) += -y*z*EA;
-
-    double fs0 = stress * A;
-    sr[0] +=    fs0;  // N
-    sr[1] += -y*fs0;  // Mz
-    sr[2] +=  z*fs0;  // My
-  }
+  sr[0] = sums.s[0];  // N
+  sr[1] = sums.s[1];  // Mz
+  sr[2] = sums.s[2];  // My
 
   ks(1, 0) = ks(0, 1);
   ks(2, 0) = ks(0, 2);
@@ -361,15 +276,14 @@ FrameFiberSection3d::setTrialSectionDeformation(const Vector &deforms)
 
   return res;
 }
-#endif
 
 
 
 const Matrix&
 FrameFiberSection3d::getInitialTangent()
 {
-  static double kInitialData[16];
-  static Matrix kInitial(kInitialData, 4, 4);
+  static thread_local double kInitialData[16];
+  static thread_local Matrix kInitial(kInitialData, 4, 4);
   
   kInitial.Zero();
 
@@ -414,7 +328,10 @@ FrameFiberSection3d::getSectionDeformation()
 const Matrix&
 FrameFiberSection3d::getSectionTangent()
 {
-  static Matrix wrapper(ks);
+  // a view of this section's tangent; the view is re-pointed on each
+  // call since it is shared by all sections on the calling thread
+  static thread_local Matrix wrapper;
+  wrapper.setData(ks);
   return wrapper;
 }
 
@@ -431,7 +348,6 @@ FrameFiberSection3d::getFrameCopy()
   theCopy->setTag(this->getTag());
   theCopy->numFibers  = numFibers;
   theCopy->sizeFibers = numFibers;
-  theCopy->pool       = pool;
 
   if (numFibers != 0) {
     theCopy->theMaterials = new UniaxialMaterial *[numFibers];
@@ -534,7 +450,7 @@ FrameFiberSection3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   // size 5 so no conflict with matData below if just 2 fibers
-  static ID data(5);
+  static thread_local ID data(5);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = (theTorsion != 0) ? 1 : 0;
@@ -597,7 +513,7 @@ FrameFiberSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(5);
+  static thread_local ID data(5);
 
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -660,7 +576,7 @@ FrameFiberSection3d::recvSelf(int commitTag, Channel &theChannel,
       }
     }
 
-    Vector fiberData(matData, 3*numFibers);
+    Vector fiberData(matData.get(), 3*numFibers);
     res += theChannel.recvVector(dbTag, commitTag, fiberData);
     if (res < 0) {
      opserr << "FrameFiberSection3d::recvSelf - failed to recv fiber data\n";
@@ -684,6 +600,9 @@ FrameFiberSection3d::recvSelf(int commitTag, Channel &theChannel,
       res += theMaterials[i]->recvSelf(commitTag, theChannel, theBroker);
     }
 
+    // the materials may have changed class
+    fiberRuns.clear();
+
     QzBar = 0.0;
     QyBar = 0.0;
     Abar  = 0.0;
@@ -1050,7 +969,7 @@ FrameFiberSection3d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FrameFiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(4);
+  static thread_local Vector dummy(4);
   
   dummy.Zero();
   
@@ -1061,7 +980,7 @@ FrameFiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FrameFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(4);
+  static thread_local Vector ds(4);
   
   ds.Zero();
   
@@ -1069,9 +988,9 @@ FrameFiberSection3d::getStressResultantSensitivity(int gradIndex, bool condition
   double dsigdh = 0;
   double sig_dAdh = 0;
   double tangent = 0;
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  static thread_local double dydh[10000];
+  static thread_local double dzdh[10000];
+  static thread_local double areaDeriv[10000];
 #if 0
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
@@ -1116,16 +1035,16 @@ FrameFiberSection3d::getStressResultantSensitivity(int gradIndex, bool condition
     if (dzdh[i] != 0.0)
       ds(2) +=  dzdh[i] * (stress*A);
 
-    static Matrix as(1,3);
+    static thread_local Matrix as(1,3);
     as(0,0) = 1;
     as(0,1) = -y;
     as(0,2) = z;
     
-    static Matrix dasdh(1,3);
+    static thread_local Matrix dasdh(1,3);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     
-    static Matrix tmpMatrix(3,3);
+    static thread_local Matrix tmpMatrix(3,3);
     tmpMatrix.addMatrixTransposeProduct(0.0, as, dasdh, tangent);
     
     //ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -1142,7 +1061,7 @@ FrameFiberSection3d::getStressResultantSensitivity(int gradIndex, bool condition
 const Matrix &
 FrameFiberSection3d::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(nsr,nsr);
+  static thread_local Matrix something(nsr,nsr);
   
   something.Zero();
 
@@ -1163,8 +1082,8 @@ FrameFiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int
 
   //dedh = defSens;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  static thread_local double yLocs[10000];
+  static thread_local double zLocs[10000];
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1173,8 +1092,8 @@ FrameFiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  static thread_local double dydh[10000];
+  static thread_local double dzdh[10000];
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -22,6 +22,7 @@
 #include <Matrix.h>
 #include <VectorND.h>
 #include <memory>
+#include <vector>
 
 class Response;
 class UniaxialMaterial;
@@ -92,6 +93,7 @@ class FrameFiberSection3d : public FrameSection
 
     int numFibers, sizeFibers;         // number of fibers in the section
     UniaxialMaterial **theMaterials;   // array of pointers to materials
+    std::vector<int> fiberRuns;        // runs of fibers of one material class
     std::shared_ptr<double[]> matData; // data for the materials [yloc, zloc, and area]
 
     OpenSees::MatrixND<nsr,nsr> ks;
@@ -108,7 +110,6 @@ class FrameFiberSection3d : public FrameSection
 
     OpenSees::VectorND<nsr> es, sr;
     UniaxialMaterial *theTorsion;
-    void *pool;        // thread pool
 };
 
 #endif
@@ -330,8 +330,8 @@ FrameSolidSection3d::getSectionDeformation()
 const Matrix&
 FrameSolidSection3d::getInitialTangent()
 {
-  static double kInitial[nsr*nsr];
-  static Matrix ksi(kInitial, nsr, nsr);
+  static thread_local double kInitial[nsr*nsr];
+  static thread_local Matrix ksi(kInitial, nsr, nsr);
 
   ksi.Zero();
   this->stateDetermination(ksi, nullptr, nullptr, InitialTangent);
@@ -751,18 +751,18 @@ FrameSolidSection3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(nsr);
+  static thread_local Vector ds(nsr);
   
   ds.Zero();
   
-  static Vector stress(3);
-  static Vector dsigdh(3);
-  static Vector sig_dAdh(3);
-  static Matrix tangent(3,3);
-
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  static thread_local Vector stress(3);
+  static thread_local Vector dsigdh(3);
+  static thread_local Vector sig_dAdh(3);
+  static thread_local Matrix tangent(3,3);
+
+  static thread_local double dydh[10000];
+  static thread_local double dzdh[10000];
+  static thread_local double areaDeriv[10000];
   const int nf = fibers->size();
   {
     for (int i = 0; i < nf; i++) {
@@ -837,7 +837,7 @@ FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool condition
     as(1,5) = -z;
     as(2,5) =  y;
     
-    static Matrix dasdh(3,6);
+    static thread_local Matrix dasdh(3,6);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     dasdh(1,3) = drootAlphadh;
@@ -845,7 +845,7 @@ FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool condition
     dasdh(1,5) = -dzdh[i];
     dasdh(2,5) = dydh[i];
     
-    static Matrix tmpMatrix(6,6);
+    static thread_local Matrix tmpMatrix(6,6);
     tmpMatrix.addMatrixTripleProduct(0.0, as, tangent, dasdh, 1.0);
     
     ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -857,7 +857,7 @@ FrameSolidSection3d::getStressResultantSensitivity(int gradIndex, bool condition
 const Matrix &
 FrameSolidSection3d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(6,6);
+  static thread_local Matrix dksdh(6,6);
   
   dksdh.Zero();
   return dksdh;
@@ -876,8 +876,8 @@ FrameSolidSection3d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  static thread_local double dydh[10000];
+  static thread_local double dzdh[10000];
   const int nf = fibers->size();
   
   { // TODO
@@ -887,7 +887,7 @@ FrameSolidSection3d::commitSensitivity(const Vector& defSens,
     }
   }
 
-  static Vector depsdh(3);
+  static thread_local Vector depsdh(3);
 
   double rootAlpha = 1.0;
   if (alpha != 1.0)
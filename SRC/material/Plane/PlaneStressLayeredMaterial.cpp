@@ -110,7 +110,7 @@ void * OPS_ADD_RUNTIME_VPV(OPS_PlaneStressLayeredMaterial)
 }
 
 //static vector and matrices
-Vector  PlaneStressLayeredMaterial::stress(3) ;
+thread_local Vector  PlaneStressLayeredMaterial::stress(3) ;
 Matrix  PlaneStressLayeredMaterial::tangent(3,3) ;
 
 //null constructor
@@ -87,7 +87,7 @@ class PlaneStressLayeredMaterial : public NDMaterial {
     NDMaterial **theFibers;  //pointers to the materials (fibers)
 
     Vector strain;
-    static Vector stress;
+    static thread_local Vector stress;
     static Matrix tangent ;
     static ID array ;  
 
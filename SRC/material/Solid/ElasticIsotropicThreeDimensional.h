@@ -75,8 +75,8 @@ class ElasticIsotropicThreeDimensional : public ElasticIsotropicMaterial
  protected:
 
   private:
-    static Vector sigma;	// Stress vector ... class-wide for returns
-    static Matrix D;		// Elastic constants
+    static thread_local Vector sigma;	// Stress vector ... class-wide for returns
+    static thread_local Matrix D;		// Elastic constants
     Vector epsilon;	        // Trial strains
     Vector Cepsilon;	        // Committed strain
 };
@@ -82,7 +82,7 @@ class IncrementalElasticIsotropicThreeDimensional : public ElasticIsotropicMater
  protected:
 
   private:
-    static Matrix D;  // Elastic constants
+    static thread_local Matrix D;  // Elastic constants
     Vector epsilon;   // Trial strains
     Vector epsilon_n; // Committed strain
     Vector sigma;     // Trial stress vector
@@ -28,8 +28,8 @@
 #include <Channel.h>
 #include <string.h>
 
-Vector ElasticIsotropicBeamFiber::sigma(3);
-Matrix ElasticIsotropicBeamFiber::D(3,3);
+thread_local Vector ElasticIsotropicBeamFiber::sigma(3);
+thread_local Matrix ElasticIsotropicBeamFiber::D(3,3);
 
 ElasticIsotropicBeamFiber::ElasticIsotropicBeamFiber
 (int tag, double E, double nu, double rho):
@@ -64,8 +64,8 @@ class ElasticIsotropicBeamFiber : public ElasticIsotropicMaterial
   protected:
 
   private:
-    static Vector sigma;	// Stress vector ... class-wide for returns
-    static Matrix D;		// Elastic constants
+    static thread_local Vector sigma;	// Stress vector ... class-wide for returns
+    static thread_local Matrix D;		// Elastic constants
     Vector Tepsilon;		// Trial strains
 };
 
@@ -32,8 +32,8 @@
 #include <Channel.h>
 #include <string.h>
 
-Vector ElasticIsotropicBeamFiber2d::sigma(2);
-Matrix ElasticIsotropicBeamFiber2d::D(2,2);
+thread_local Vector ElasticIsotropicBeamFiber2d::sigma(2);
+thread_local Matrix ElasticIsotropicBeamFiber2d::D(2,2);
 
 ElasticIsotropicBeamFiber2d::ElasticIsotropicBeamFiber2d
 (int tag, double E, double nu, double rho):
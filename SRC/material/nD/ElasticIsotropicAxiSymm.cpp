@@ -25,8 +25,8 @@
 #include <ElasticIsotropicAxiSymm.h>                                                                        
 #include <Channel.h>
 
-Vector ElasticIsotropicAxiSymm::sigma(4);
-Matrix ElasticIsotropicAxiSymm::D(4,4);
+thread_local Vector ElasticIsotropicAxiSymm::sigma(4);
+thread_local Matrix ElasticIsotropicAxiSymm::D(4,4);
 
 ElasticIsotropicAxiSymm::ElasticIsotropicAxiSymm
 (int tag, double E, double nu, double rho) :
@@ -70,8 +70,8 @@ class ElasticIsotropicPlateFiber : public ElasticIsotropicMaterial
   protected:
 
   private:
-    static Vector sigma;	// Stress vector ... class-wide for returns
-    static Matrix D;		// Elastic constants
+    static thread_local Vector sigma;	// Stress vector ... class-wide for returns
+    static thread_local Matrix D;		// Elastic constants
     Vector epsilon;		// Trial strains
 };
 
@@ -300,14 +300,14 @@ NDMaterial::getResponse (int responseID, Information &matInfo)
 const Vector &
 NDMaterial::getStressSensitivity(int gradIndex, bool conditional)
 {
-	static Vector dummy(1);
+	static thread_local Vector dummy(1);
 	return dummy;
 }
 
 const Vector &
 NDMaterial::getStrainSensitivity(int gradIndex)
 {
-	static Vector dummy(1);
+	static thread_local Vector dummy(1);
 	return dummy;
 }
 
@@ -320,21 +320,21 @@ NDMaterial::getRhoSensitivity(int gradIndex)
 const Matrix &
 NDMaterial::getDampTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	static thread_local Matrix dummy(1,1);
 	return dummy;
 }
 
 const Matrix &
 NDMaterial::getTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	static thread_local Matrix dummy(1,1);
 	return dummy;
 }
 
 const Matrix &
 NDMaterial::getInitialTangentSensitivity(int gradIndex)
 {
-	static Matrix dummy(1,1);
+	static thread_local Matrix dummy(1,1);
 	return dummy;
 }
 
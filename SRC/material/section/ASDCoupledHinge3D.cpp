@@ -1226,7 +1226,7 @@ int ASDCoupledHinge3D::setTrialSectionDeformation (const Vector &def)
 const Vector &
 ASDCoupledHinge3D::getSectionDeformation(void)
 {
-    static Vector e(6);
+    static thread_local Vector e(6);
     e(0) = axialMaterial->getStrain();
     e(1) = MyMaterial->getStrain();
     e(2) = MzMaterial->getStrain();
@@ -1239,7 +1239,7 @@ ASDCoupledHinge3D::getSectionDeformation(void)
 const Matrix &
 ASDCoupledHinge3D::getSectionTangent(void)
 {
-    static Matrix k(6, 6);
+    static thread_local Matrix k(6, 6);
 #ifdef ASD_HINGE_NUM_TANG
     for (int i = 0; i < 6; ++i)
         k(i, i) = m_num_tang(i);
@@ -1258,7 +1258,7 @@ ASDCoupledHinge3D::getSectionTangent(void)
 const Matrix &
 ASDCoupledHinge3D::getInitialTangent(void)
 {
-    static Matrix k(6, 6);
+    static thread_local Matrix k(6, 6);
     k(0, 0) = axialMaterial->getInitialTangent();
     k(1, 1) = MyMaterial->getInitialTangent();
     k(2, 2) = MzMaterial->getInitialTangent();
@@ -1271,7 +1271,7 @@ ASDCoupledHinge3D::getInitialTangent(void)
 const Matrix &
 ASDCoupledHinge3D::getSectionFlexibility(void)
 {
-    static Matrix f(6, 6);
+    static thread_local Matrix f(6, 6);
     
 #ifdef ASD_HINGE_NUM_TANG
 
@@ -1343,7 +1343,7 @@ ASDCoupledHinge3D::getSectionFlexibility(void)
 const Matrix &
 ASDCoupledHinge3D::getInitialFlexibility(void)
 {
-    static Matrix f(6, 6);
+    static thread_local Matrix f(6, 6);
 
     double k;
     k = axialMaterial->getInitialTangent();
@@ -1401,7 +1401,7 @@ ASDCoupledHinge3D::getInitialFlexibility(void)
 const Vector &
 ASDCoupledHinge3D::getStressResultant(void)
 {
-    static Vector s(6);
+    static thread_local Vector s(6);
     s(0) = axialMaterial->getStress();
     s(1) = MyMaterial->getStress();
     s(2) = MzMaterial->getStress();
@@ -84,8 +84,8 @@ class Bidirectional : public SectionForceDeformation
 	
 	int code1, code2;
 
-	static Vector s;
-	static Matrix ks;
+	static thread_local Vector s;
+	static thread_local Matrix ks;
 	static ID code;
 };
 
@@ -30,8 +30,8 @@
 
 #include <classTags.h>
 
-Vector ElasticBDShearSection2d::s(3);
-Matrix ElasticBDShearSection2d::ks(3,3);
+thread_local Vector ElasticBDShearSection2d::s(3);
+thread_local Matrix ElasticBDShearSection2d::ks(3,3);
 ID ElasticBDShearSection2d::code(3);
 
 ElasticBDShearSection2d::ElasticBDShearSection2d()
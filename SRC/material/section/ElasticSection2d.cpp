@@ -35,8 +35,8 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticSection2d::s(2);
-Matrix ElasticSection2d::ks(2,2);
+thread_local Vector ElasticSection2d::s(2);
+thread_local Matrix ElasticSection2d::ks(2,2);
 ID ElasticSection2d::code(2);
 
 ElasticSection2d::ElasticSection2d()
@@ -213,7 +213,7 @@ ElasticSection2d::sendSelf(int commitTag, Channel &theChannel)
 {
     int res = 0;
 
-    static Vector data(4);
+    static thread_local Vector data(4);
     
     int dataTag = this->getDbTag();
     
@@ -237,7 +237,7 @@ ElasticSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
 	int res = 0;
 
-    static Vector data(4);
+    static thread_local Vector data(4);
 
     int dataTag = this->getDbTag();
 
@@ -32,8 +32,8 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticShearSection2d::s(3);
-Matrix ElasticShearSection2d::ks(3,3);
+thread_local Vector ElasticShearSection2d::s(3);
+thread_local Matrix ElasticShearSection2d::ks(3,3);
 ID ElasticShearSection2d::code(3);
 
 void *
@@ -218,7 +218,7 @@ ElasticShearSection2d::sendSelf(int commitTag, Channel &theChannel)
 {
   int res = 0;
   
-  static Vector data(6);
+  static thread_local Vector data(6);
   
   int dataTag = this->getDbTag();
   
@@ -244,7 +244,7 @@ ElasticShearSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(6);
+  static thread_local Vector data(6);
   
   int dataTag = this->getDbTag();
   
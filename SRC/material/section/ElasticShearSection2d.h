@@ -84,8 +84,8 @@ class ElasticShearSection2d: public FrameSection
   
   Vector e;			// section trial deformations
   
-  static Vector s;
-  static Matrix ks;
+  static thread_local Vector s;
+  static thread_local Matrix ks;
   static ID code;
   
   int parameterID;
@@ -30,8 +30,8 @@
 #include <classTags.h>
 #include <elementAPI.h>
 
-Vector ElasticShearSection3d::s(6);
-Matrix ElasticShearSection3d::ks(6,6);
+thread_local Vector ElasticShearSection3d::s(6);
+thread_local Matrix ElasticShearSection3d::ks(6,6);
 ID ElasticShearSection3d::code(6);
 
 void *
@@ -66,8 +66,8 @@ OPS_ADD_RUNTIME_VPV(OPS_ElasticTubeSection3d)
     return new ElasticTubeSection3d(tag, E, d, tw, G);	
 }
 
-Vector ElasticTubeSection3d::s(4);
-Matrix ElasticTubeSection3d::ks(4,4);
+thread_local Vector ElasticTubeSection3d::s(4);
+thread_local Matrix ElasticTubeSection3d::ks(4,4);
 ID ElasticTubeSection3d::code(4);
 
 ElasticTubeSection3d::ElasticTubeSection3d(void)
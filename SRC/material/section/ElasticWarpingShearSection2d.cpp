@@ -71,8 +71,8 @@ OPS_ADD_RUNTIME_VPV(OPS_ElasticWarpingShearSection2d)
 
 }
 
-Vector ElasticWarpingShearSection2d::s(5);
-Matrix ElasticWarpingShearSection2d::ks(5,5);
+thread_local Vector ElasticWarpingShearSection2d::s(5);
+thread_local Matrix ElasticWarpingShearSection2d::ks(5,5);
 ID ElasticWarpingShearSection2d::code(5);
 
 ElasticWarpingShearSection2d::ElasticWarpingShearSection2d(void)
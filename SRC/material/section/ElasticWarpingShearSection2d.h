@@ -82,8 +82,8 @@ class ElasticWarpingShearSection2d: public SectionForceDeformation
   Vector e;			// section trial deformations
   Vector eCommit;
   
-  static Vector s;
-  static Matrix ks;
+  static thread_local Vector s;
+  static thread_local Matrix ks;
   static ID code;
   
   int parameterID;
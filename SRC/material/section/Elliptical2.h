@@ -90,8 +90,8 @@ class Elliptical2 : public SectionForceDeformation
 	int parameterID;
 	Matrix *SHVs;
 
-	static Vector s;
-	static Matrix ks;
+	static thread_local Vector s;
+	static thread_local Matrix ks;
 	static ID code;
 
 	// private functions, as per Matlab implementation by E. Taciroglu
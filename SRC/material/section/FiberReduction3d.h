@@ -0,0 +1,139 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: State determination of the uniaxial fibers of a 3d
+// section, shared by FiberSection3d and FrameFiberSection3d. For the
+// section deformations (e0, k1, k2) every fiber is set to the strain
+//
+//     e0 - y*k1 + z*k2
+//
+// and the axial/flexural stiffness and resultants are summed.
+//
+// The materials are set with setTrialBatch, one call for each run of
+// fibers of the same material class (see UniaxialBatch.h); runEnd holds
+// the runs.
+//
+// Sections with many fibers are split into blocks that are evaluated on
+// the shared thread pool. Each block accumulates into its own partial
+// sums, which are added in block order once all blocks are done, so no
+// locking is needed and the result does not depend on the order in
+// which blocks finish. Small sections, a single-threaded pool, or calls
+// made from a pool worker (e.g., a threaded Domain::update) are
+// evaluated serially on the calling thread.
+//
+// Written: cmp
+//
+#ifndef FiberReduction3d_h
+#define FiberReduction3d_h
+
+#include <OPS_Globals.h>
+#include <UniaxialMaterial.h>
+#include <UniaxialBatch.h>
+#include <threads/global_pool.hpp>
+#include <algorithm>
+
+namespace OpenSees {
+
+struct FiberSums3d {
+  // k = {EA, -y*EA, z*EA, y*y*EA, z*z*EA, -y*z*EA}; s = {N, Mz, My}
+  double k[6] {};
+  double s[3] {};
+  int    res = 0;
+
+  FiberSums3d &operator+=(const FiberSums3d &other) {
+    for (int i=0; i<6; i++)
+      k[i] += other.k[i];
+    for (int i=0; i<3; i++)
+      s[i] += other.s[i];
+    res += other.res;
+    return *this;
+  }
+};
+
+//
+// Evaluate fibers [first, last). matData holds {y, z, area} for each
+// fiber. The material updates are done for a chunk of fibers before the
+// sums for that chunk are formed, so that the summation loop has no
+// calls in it and can be vectorized.
+//
+inline FiberSums3d
+fiber_sums_3d(UniaxialMaterial **theMaterials, const int *runEnd, const double *matData,
+              double yBar, double zBar,
+              double e0, double k1, double k2,
+              int first, int last)
+{
+  constexpr int chunk = 64;
+  double y[chunk], z[chunk], EA[chunk], fs[chunk];
+  double strain[chunk];
+
+  FiberSums3d sums;
+  for (int start = first; start < last; start += chunk) {
+    const int n = std::min(chunk, last - start);
+
+    for (int j = 0; j < n; j++) {
+      const int i = start + j;
+      y[j] = matData[3*i]   - yBar;
+      z[j] = matData[3*i+1] - zBar;
+      strain[j] = e0 - y[j]*k1 + z[j]*k2;
+    }
+
+    // the stresses and tangents are returned in fs and EA
+    sums.res += set_trial_runs(theMaterials, runEnd, start, start + n, strain, fs, EA);
+
+    for (int j = 0; j < n; j++) {
+      const double A = matData[3*(start+j)+2];
+      EA[j] *= A;
+      fs[j] *= A;
+    }
+
+    for (int j = 0; j < n; j++) {
+      sums.k[0] +=           EA[j];
+      sums.k[1] +=     -y[j]*EA[j];
+      sums.k[2] +=      z[j]*EA[j];
+      sums.k[3] +=  y[j]*y[j]*EA[j];
+      sums.k[4] +=  z[j]*z[j]*EA[j];
+      sums.k[5] += -y[j]*z[j]*EA[j];
+
+      sums.s[0] +=       fs[j];
+      sums.s[1] += -y[j]*fs[j];
+      sums.s[2] +=  z[j]*fs[j];
+    }
+  }
+  return sums;
+}
+
+inline FiberSums3d
+fiber_sums_3d(UniaxialMaterial **theMaterials, const int *runEnd, const double *matData, int numFibers,
+              double yBar, double zBar,
+              double e0, double k1, double k2)
+{
+  // fewest fibers worth handing to another thread
+  constexpr int minFibersPerBlock = 64;
+
+  thread_pool &pool = global_thread_pool();
+  const int numBlocks = std::min<int>(numFibers/minFibersPerBlock,
+                                      2*pool.get_thread_count());
+
+  if (numBlocks < 2 || pool.get_thread_count() < 2 || in_thread_pool())
+    return fiber_sums_3d(theMaterials, runEnd, matData, yBar, zBar, e0, k1, k2, 0, numFibers);
+
+  // materials may read the update state of the calling thread
+  const ops_UpdateState state;
+  multi_future<FiberSums3d> blocks = pool.submit_blocks<int>(0, numFibers,
+    [=](int first, int last) -> FiberSums3d {
+      state.set();
+      return fiber_sums_3d(theMaterials, runEnd, matData, yBar, zBar, e0, k1, k2, first, last);
+    }, numBlocks);
+
+  FiberSums3d sums;
+  for (const FiberSums3d &block : blocks.get())
+    sums += block;
+  return sums;
+}
+
+} // namespace OpenSees
+
+#endif
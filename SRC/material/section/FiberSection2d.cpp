@@ -38,6 +38,8 @@
 #include <SensitiveResponse.h>
 typedef SensitiveResponse<FrameSection> SectionResponse;
 #include <UniaxialMaterial.h>
+#include <UniaxialBatch.h>
+#include <algorithm>
 
 #include "FiberResponse.h"
 
@@ -234,26 +236,36 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
                d1 = deforms(1);
 
   
+  // the materials are set one run of fibers of the same class at a time
+  const int *runEnd = OpenSees::find_uniaxial_runs(theMaterials, numFibers, fiberRuns);
+
+  constexpr int chunk = 64;
+  double strain[chunk], stress[chunk], tangent[chunk];
+
   int res = 0;
-  for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
-    const double y = matData[2*i] - yBar;
-    const double A = matData[2*i+1];
+  for (int start = 0; start < numFibers; start += chunk) {
+    const int n = std::min(chunk, numFibers - start);
 
-    // determine material strain and set it
-    double strain = d0 - y*d1;
-    double tangent, stress;
-    res += theMat->setTrial(strain, stress, tangent);
+    // determine material strains and set them
+    for (int j = 0; j < n; j++)
+      strain[j] = d0 - (matData[2*(start+j)] - yBar)*d1;
 
-    double ks0 = tangent * A;
-    double ks1 = ks0 * -y;
-    kData[0]  += ks0;
-    kData[1]  += ks1;
-    kData[3]  += ks1 * -y;
+    res += OpenSees::set_trial_runs(theMaterials, runEnd, start, start + n, strain, stress, tangent);
 
-    double fs0 = stress * A;
-    sData[0] += fs0;
-    sData[1] += fs0 * -y;
+    for (int j = 0; j < n; j++) {
+      const double y = matData[2*(start+j)] - yBar;
+      const double A = matData[2*(start+j)+1];
+
+      double ks0 = tangent[j] * A;
+      double ks1 = ks0 * -y;
+      kData[0]  += ks0;
+      kData[1]  += ks1;
+      kData[3]  += ks1 * -y;
+
+      double fs0 = stress[j] * A;
+      sData[0] += fs0;
+      sData[1] += fs0 * -y;
+    }
   }
 
   kData[2] = kData[1];
@@ -270,8 +282,8 @@ FiberSection2d::getSectionDeformation(void)
 const Matrix&
 FiberSection2d::getInitialTangent(void)
 {
-  static double kInitial[4];
-  static Matrix kInitialMatrix(kInitial, 2, 2);
+  static thread_local double kInitial[4];
+  static thread_local Matrix kInitialMatrix(kInitial, 2, 2);
   kInitial[0] = 0.0; kInitial[1] = 0.0; kInitial[2] = 0.0; kInitial[3] = 0.0;
 
 
@@ -416,8 +428,8 @@ FiberSection2d::revertToStart(void)
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  static thread_local double fiberLocs[10000];
+  static thread_local double fiberArea[10000];
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -460,7 +472,7 @@ FiberSection2d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(3);
+  static thread_local ID data(3);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = computeCentroid ? 1 : 0; // Now the ID data is really 3
@@ -516,7 +528,7 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(3);
+  static thread_local ID data(3);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -562,7 +574,7 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
       }
     }
 
-    Vector fiberData(matData, 2*numFibers);
+    Vector fiberData(matData.get(), 2*numFibers);
     res += theChannel.recvVector(dbTag, commitTag, fiberData);
     if (res < 0) {
       opserr <<  "FiberSection2d::recvSelf - failed to recv material data\n";
@@ -587,6 +599,9 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
       res += theMaterials[i]->recvSelf(commitTag, theChannel, theBroker);
     }
 
+    // the materials may have changed class
+    fiberRuns.clear();
+
     QzBar = 0.0;
     ABar  = 0.0;
     double yLoc, Area;
@@ -654,7 +669,7 @@ FiberSection2d::setResponse(const char **argv, int argc,
   
   if (argc > 2 && strcmp(argv[0],"fiber") == 0) {
 
-    static double fiberLocs[10000];
+    static thread_local double fiberLocs[10000];
     { // TODO
       for (int i = 0; i < numFibers; i++) {
 	fiberLocs[i] = matData[2*i];
@@ -966,7 +981,7 @@ FiberSection2d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(2);
+  static thread_local Vector dummy(2);
 
   return dummy;
 }
@@ -974,7 +989,7 @@ FiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(2);
+  static thread_local Vector ds(2);
   
   ds.Zero();
   
@@ -984,8 +999,8 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
   double tangent = 0.0;
   double sig_dAdh = 0.0;
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  static thread_local double locsDeriv[10000];
+  static thread_local double areaDeriv[10000];
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1032,7 +1047,7 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 FiberSection2d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(2,2);
+  static thread_local Matrix dksdh(2,2);
   
   dksdh.Zero();
 
@@ -1040,8 +1055,8 @@ FiberSection2d::getInitialTangentSensitivity(int gradIndex)
   double tangent = 0.0;
   double dtangentdh = 0.0;
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  static thread_local double locsDeriv[10000];
+  static thread_local double areaDeriv[10000];
 
   { // TODO; removing SectionIntegration
     for (int i = 0; i < numFibers; i++) {
@@ -1080,8 +1095,8 @@ FiberSection2d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  static thread_local double locsDeriv[10000];
+  static thread_local double areaDeriv[10000];
 
   for (int i = 0; i < numFibers; i++) {
     locsDeriv[i] = 0.0;
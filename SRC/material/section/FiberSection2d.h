@@ -33,6 +33,7 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <memory>
+#include <vector>
 
 class UniaxialMaterial;
 class Response;
@@ -95,6 +96,7 @@ class FiberSection2d : public FrameSection
     //  private:
     int numFibers, sizeFibers;         // number of fibers in the section
     UniaxialMaterial **theMaterials;   // array of pointers to materials
+    std::vector<int> fiberRuns;        // runs of fibers of one material class
     std::shared_ptr<double[]> matData; // data for the materials [yloc and area]
     double   kData[4];                 // data for ks matrix 
     double   sData[2];                 // data for s vector 
@@ -749,7 +749,7 @@ int FiberSection2dInt::setTrialSectionDeformationB (const Vector &deforms, doubl
       res = theMat1->setTrial(e1, sc1, tc1);
       res = theMat2->setTrial(e2, sc2, tc2);
 
-      static Information theInfo;
+      static thread_local Information theInfo;
       double e0 = 0.0;
 
       const char *theData = "ec";
@@ -1271,7 +1271,7 @@ for (int jj = 0; jj < NStrip; jj++) {
 
         double e0 = 0.0;
         const char *theData = "ec";
-        static Information theInfo;
+        static thread_local Information theInfo;
         if (theMat1->getVariable(theData, theInfo) == 0)
           e0 = theInfo.theDouble;
 
@@ -1493,7 +1493,7 @@ FiberSection2dInt::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(3);
+  static thread_local ID data(3);
   data(0) = this->getTag();
   data(1) = numFibers;
   int dbTag = this->getDbTag();
@@ -1548,7 +1548,7 @@ FiberSection2dInt::recvSelf(int commitTag, Channel &theChannel,
              FEM_ObjectBroker &theBroker)                        
 {
   int res = 0;
-  static ID data(3);
+  static thread_local ID data(3);
 
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -2140,21 +2140,21 @@ FiberSection2dInt::getResponse(int responseID, Information &sectInfo)
 const Vector &
 FiberSection2dInt::getSectionDeformationSensitivity(int gradNumber)
 {
-    static Vector dummy(2);
+    static thread_local Vector dummy(2);
     return dummy;
 }
 
 const Vector &
 FiberSection2dInt::getStressResultantSensitivity(int gradNumber, bool conditional)
 {
-    static Vector dummy(2);    
+    static thread_local Vector dummy(2);    
     return dummy;
 }
 
 const Matrix &
 FiberSection2dInt::getSectionTangentSensitivity(int gradNumber)
 {
-    static Matrix something(2,2);
+    static thread_local Matrix something(2,2);
     something.Zero();
     return something;
 }
@@ -42,9 +42,7 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 #include <ElasticMaterial.h>
 
 #include "FiberResponse.h"
-
-// #include <threads/thread_pool.hpp>
-// #define N_FIBER_THREADS 6
+#include "FiberReduction3d.h"
 
 ID FiberSection3d::code(4);
 
@@ -56,9 +54,6 @@ FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers,
   FrameSection(tag, SEC_TAG_FiberSection3d),
   numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(compCentroid),
-#ifdef N_FIBER_THREADS
-    pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
-#endif
   e(eData), s(sData), ks(kData,4,4), theTorsion(0)
 {
   if (numFibers != 0) {
@@ -115,9 +110,6 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial &torsion, bool
     numFibers(0), sizeFibers(num), theMaterials(nullptr), matData(new double [num*3]{}),
     QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(compCentroid),
     theTorsion(0),
-#ifdef N_FIBER_THREADS
-    pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
-#endif
     e(eData), s(sData), ks(kData, 4, 4)
 {
     if (sizeFibers != 0) {
@@ -160,11 +152,11 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
     exit(-1);
   }
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  static thread_local double yLocs[10000];
+  static thread_local double zLocs[10000];
   sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
   
-  static double fiberArea[10000];
+  static thread_local double fiberArea[10000];
   sectionIntegr->getFiberWeights(numFibers, fiberArea);
   
   for (int i = 0; i < numFibers; i++) {
@@ -207,9 +199,6 @@ FiberSection3d::FiberSection3d():
   FrameSection(0, SEC_TAG_FiberSection3d),
   numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), computeCentroid(true), 
-#ifdef N_FIBER_THREADS
-  pool((void*)new OpenSees::thread_pool{N_FIBER_THREADS}),
-#endif
   e(eData), s(sData), ks(kData, 4,4), theTorsion(0)
 {
 //   s = new Vector(sData, 4);
@@ -353,72 +342,6 @@ FiberSection3d::addFiber(UniaxialMaterial &theMat, const double Area, const doub
 }
 
 
-#ifdef N_FIBER_THREADS
-#include <mutex>
-int
-FiberSection3d::setTrialSectionDeformation(const Vector &deforms)
-{
-  e = deforms;
- 
-  sData.zero();
-  ks.Zero();
-
-  const double e0 = deforms(0), // u'
-               e1 = deforms(1),
-               e2 = deforms(2),
-               e3 = deforms(3);
-
-  int res = 0;
-  std::mutex resp_mutex;
-
-  ((OpenSees::thread_pool*)pool)->submit_loop<unsigned int>(0, numFibers,
-  [&,e0,e1,e2](int i){
-    int res = 0;
-
-    const double y  = matData[3*i]   - yBar;
-    const double z  = matData[3*i+1] - zBar;
-    const double A  = matData[3*i+2];
-
-    // determine material strain and set it
-    const double strain = e0 - y*e1 + z*e2;
-    double tangent, stress;
-    res += theMaterials[i]->setTrial(strain, stress, tangent);
-
-    const double EA = tangent * A;
-
-    const std::lock_guard<std::mutex> lock(resp_mutex);
-    kData[ 0] +=     EA;
-    kData[ 1] +=  -y*EA;
-    kData[ 2] +=   z*EA;
-
-    kData[ 5] +=  y*y*EA;
-    kData[10] +=  z*z*EA; 
-    kData[ 6] += -y*z*EA;
-
-    double fs0 = stress * A;
-    sData[ 0] +=    fs0;  // N
-    sData[ 1] += -y*fs0;  // Mz
-    sData[ 2] +=  z*fs0;  // My
-
-    return res;
-  }).wait();
-
-  kData[4] = kData[1];
-  kData[8] = kData[2];
-  kData[9] = kData[6];
- 
-  if (theTorsion != nullptr) {
-    double stress, tangent;
-    res += theTorsion->setTrial(e3, stress, tangent);
-    sData[ 3] = stress;
-    kData[15] = tangent;
-  }
-
-  return res;
-}
-
-#else
-
 int
 FiberSection3d::setTrialSectionDeformation(const Vector &deforms)
 {
@@ -432,33 +355,23 @@ FiberSection3d::setTrialSectionDeformation(const Vector &deforms)
                e2 = deforms(2),
                e3 = deforms(3);
 
-  int res = 0;
-  for (int i = 0; i < numFibers; i++) {
-
-    const double y  = matData[3*i]   - yBar;
-    const double z  = matData[3*i+1] - zBar;
-    const double A  = matData[3*i+2];
-
-    // determine material strain and set it
-    double strain = e0 - y*e1 + z*e2;
-    double tangent, stress;
-    res += theMaterials[i]->setTrial(strain, stress, tangent);
-
-    double EA     = tangent * A;
+  const OpenSees::FiberSums3d sums = 
+    OpenSees::fiber_sums_3d(theMaterials, 
+                            OpenSees::find_uniaxial_runs(theMaterials, numFibers, fiberRuns),
+                            matData.get(), numFibers, yBar, zBar, e0, e1, e2);
 
-    kData[0] +=     EA;
-    kData[1] +=  -y*EA;
-    kData[2] +=   z*EA;
+  int res = sums.res;
 
-    kData[ 5] +=  y*y*EA;
-    kData[10] +=  z*z*EA; 
-    kData[ 6] += -y*z*EA;
+  kData[ 0] = sums.k[0];
+  kData[ 1] = sums.k[1];
+  kData[ 2] = sums.k[2];
+  kData[ 5] = sums.k[3];
+  kData[10] = sums.k[4];
+  kData[ 6] = sums.k[5];
 
-    double fs0 = stress * A;
-    sData[0] +=    fs0;  // N
-    sData[1] += -y*fs0;  // Mz
-    sData[2] +=  z*fs0;  // My
-  }
+  sData[ 0] = sums.s[0];  // N
+  sData[ 1] = sums.s[1];  // Mz
+  sData[ 2] = sums.s[2];  // My
 
   kData[4] = kData[1];
   kData[8] = kData[2];
@@ -473,15 +386,14 @@ FiberSection3d::setTrialSectionDeformation(const Vector &deforms)
 
   return res;
 }
-#endif
 
 
 
 const Matrix&
 FiberSection3d::getInitialTangent(void)
 {
-  static double kInitialData[16];
-  static Matrix kInitial(kInitialData, 4, 4);
+  static thread_local double kInitialData[16];
+  static thread_local Matrix kInitial(kInitialData, 4, 4);
   
   kInitial.Zero();
 
@@ -542,7 +454,6 @@ FiberSection3d::getFrameCopy(void)
   theCopy->setTag(this->getTag());
   theCopy->numFibers  = numFibers;
   theCopy->sizeFibers = numFibers;
-  theCopy->pool       = pool;
 
   if (numFibers != 0) {
     theCopy->theMaterials = new UniaxialMaterial *[numFibers];
@@ -734,7 +645,7 @@ FiberSection3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   // size 5 so no conflict with matData below if just 2 fibers
-  static ID data(5);
+  static thread_local ID data(5);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = (theTorsion != 0) ? 1 : 0;
@@ -797,7 +708,7 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(5);
+  static thread_local ID data(5);
 
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -860,7 +771,7 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
       }
     }
 
-    Vector fiberData(matData, 3*numFibers);
+    Vector fiberData(matData.get(), 3*numFibers);
     res += theChannel.recvVector(dbTag, commitTag, fiberData);
     if (res < 0) {
      opserr << "FiberSection3d::recvSelf - failed to recv fiber data\n";
@@ -884,6 +795,9 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
       res += theMaterials[i]->recvSelf(commitTag, theChannel, theBroker);
     }
 
+    // the materials may have changed class
+    fiberRuns.clear();
+
     QzBar = 0.0;
     QyBar = 0.0;
     Abar  = 0.0;
@@ -1249,7 +1163,7 @@ FiberSection3d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(4);
+  static thread_local Vector dummy(4);
   
   dummy.Zero();
   
@@ -1260,7 +1174,7 @@ FiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(4);
+  static thread_local Vector ds(4);
   
   ds.Zero();
   
@@ -1269,9 +1183,9 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
   double sig_dAdh = 0;
   double tangent = 0;
 #if 0
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  static thread_local double yLocs[10000];
+  static thread_local double zLocs[10000];
+  static thread_local double fiberArea[10000];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -1285,9 +1199,9 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     }
   }
 #endif
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  static thread_local double dydh[10000];
+  static thread_local double dzdh[10000];
+  static thread_local double areaDeriv[10000];
 #if 0
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
@@ -1337,16 +1251,16 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     if (dzdh[i] != 0.0)
       ds(2) +=  dzdh[i] * (stress*A);
 
-    static Matrix as(1,3);
+    static thread_local Matrix as(1,3);
     as(0,0) = 1;
     as(0,1) = -y;
     as(0,2) = z;
     
-    static Matrix dasdh(1,3);
+    static thread_local Matrix dasdh(1,3);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     
-    static Matrix tmpMatrix(3,3);
+    static thread_local Matrix tmpMatrix(3,3);
     tmpMatrix.addMatrixTransposeProduct(0.0, as, dasdh, tangent);
     
     //ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -1363,7 +1277,7 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 FiberSection3d::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(4,4);
+  static thread_local Matrix something(4,4);
   
   something.Zero();
 
@@ -1383,8 +1297,8 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
 
   //dedh = defSens;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  static thread_local double yLocs[10000];
+  static thread_local double zLocs[10000];
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1393,8 +1307,8 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  static thread_local double dydh[10000];
+  static thread_local double dzdh[10000];
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
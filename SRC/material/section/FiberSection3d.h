@@ -34,6 +34,7 @@
 #include <Matrix.h>
 #include <VectorND.h>
 #include <memory>
+#include <vector>
 
 class Response;
 class UniaxialMaterial;
@@ -99,6 +100,7 @@ class FiberSection3d : public FrameSection
   private:
     int numFibers, sizeFibers;         // number of fibers in the section
     UniaxialMaterial **theMaterials;   // array of pointers to materials
+    std::vector<int> fiberRuns;        // runs of fibers of one material class
     std::shared_ptr<double[]> matData; // data for the materials [yloc, zloc, and area]
     double   kData[16];                // data for ks matrix 
 
@@ -115,7 +117,6 @@ class FiberSection3d : public FrameSection
 
     OpenSees::VectorND<4> eData, sData;
     UniaxialMaterial *theTorsion;
-    void *pool;        // thread pool
 };
 
 #endif
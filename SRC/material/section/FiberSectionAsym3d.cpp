@@ -203,11 +203,11 @@ FiberSectionAsym3d::FiberSectionAsym3d(int tag, int num, UniaxialMaterial **mats
     exit(-1);
   }
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  static thread_local double yLocs[10000];
+  static thread_local double zLocs[10000];
   sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
   
-  static double fiberArea[10000];
+  static thread_local double fiberArea[10000];
   sectionIntegr->getFiberWeights(numFibers, fiberArea);
   
   for (int i = 0; i < numFibers; i++) {
@@ -455,8 +455,8 @@ FiberSectionAsym3d::setTrialSectionDeformation(const Vector &deforms)
 const Matrix&
 FiberSectionAsym3d::getInitialTangent(void)
 {
-  static double kInitialData[25];
-  static Matrix kInitial(kInitialData, 5, 5);
+  static thread_local double kInitialData[25];
+  static thread_local Matrix kInitial(kInitialData, 5, 5);
   
   kInitial.Zero();
 
@@ -682,9 +682,9 @@ FiberSectionAsym3d::revertToStart(void)
   for (int i = 0; i < 25; i++) //Xinlong
           kData[i] = 0.0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  static thread_local double yLocs[10000];
+  static thread_local double zLocs[10000];
+  static thread_local double fiberArea[10000];
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -762,7 +762,7 @@ FiberSectionAsym3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 6 so no conflict with matData below if just 2 fibers
-  static Vector data(6);
+  static thread_local Vector data(6);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = (theTorsion != 0) ? 1 : 0;
@@ -827,7 +827,7 @@ FiberSectionAsym3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static Vector data(6);
+  static thread_local Vector data(6);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvVector(dbTag, commitTag, data);
@@ -1016,8 +1016,8 @@ FiberSectionAsym3d::setResponse(const char **argv, int argc, OPS_Stream &output)
   
   if (argc > 2 && strcmp(argv[0],"fiber") == 0) {
 
-    static double yLocs[10000];
-    static double zLocs[10000];
+    static thread_local double yLocs[10000];
+    static thread_local double zLocs[10000];
     
 
     { // TODO
@@ -1257,7 +1257,7 @@ FiberSectionAsym3d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FiberSectionAsym3d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(4);
+  static thread_local Vector dummy(4);
   
   dummy.Zero();
   
@@ -1268,7 +1268,7 @@ FiberSectionAsym3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSectionAsym3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(4);
+  static thread_local Vector ds(4);
   
   ds.Zero();
   
@@ -1278,9 +1278,9 @@ FiberSectionAsym3d::getStressResultantSensitivity(int gradIndex, bool conditiona
   double sig_dAdh = 0;
   double tangent = 0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  static thread_local double yLocs[10000];
+  static thread_local double zLocs[10000];
+  static thread_local double fiberArea[10000];
 
 
   { // TODO
@@ -1291,9 +1291,9 @@ FiberSectionAsym3d::getStressResultantSensitivity(int gradIndex, bool conditiona
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  static thread_local double dydh[10000];
+  static thread_local double dzdh[10000];
+  static thread_local double areaDeriv[10000];
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1334,16 +1334,16 @@ FiberSectionAsym3d::getStressResultantSensitivity(int gradIndex, bool conditiona
     if (dzdh[i] != 0.0)
       ds(2) +=  dzdh[i] * (stress*A);
 
-    static Matrix as(1,3);
+    static thread_local Matrix as(1,3);
     as(0,0) = 1;
     as(0,1) = -y;
     as(0,2) = z;
     
-    static Matrix dasdh(1,3);
+    static thread_local Matrix dasdh(1,3);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     
-    static Matrix tmpMatrix(3,3);
+    static thread_local Matrix tmpMatrix(3,3);
     tmpMatrix.addMatrixTransposeProduct(0.0, as, dasdh, tangent);
     
     //ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -1360,7 +1360,7 @@ FiberSectionAsym3d::getStressResultantSensitivity(int gradIndex, bool conditiona
 const Matrix &
 FiberSectionAsym3d::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(4,4);
+  static thread_local Matrix something(4,4);
   
   something.Zero();
 
@@ -1380,8 +1380,8 @@ FiberSectionAsym3d::commitSensitivity(const Vector& defSens, int gradIndex, int
 
   //dedh = defSens;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  static thread_local double yLocs[10000];
+  static thread_local double zLocs[10000];
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1390,8 +1390,8 @@ FiberSectionAsym3d::commitSensitivity(const Vector& defSens, int gradIndex, int
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  static thread_local double dydh[10000];
+  static thread_local double dzdh[10000];
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -424,7 +424,7 @@ int LayeredMembraneSection::sendSelf(int commitTag, Channel& theChannel)
 	int dataTag = this->getDbTag();
 
 	//static ID iData(4);
-	static Vector iData(4);
+	static thread_local Vector iData(4);
 	iData(0) = this->getTag();
 	iData(1) = t_total;
 	iData(2) = numberLayers;
@@ -482,7 +482,7 @@ int LayeredMembraneSection::recvSelf(int commitTag, Channel& theChannel, FEM_Obj
 
 	int dataTag = this->getDbTag();
 
-	static Vector iData(4);
+	static thread_local Vector iData(4);
 	res += theChannel.recvVector(dataTag, commitTag, iData);
 
 	if (res < 0) {
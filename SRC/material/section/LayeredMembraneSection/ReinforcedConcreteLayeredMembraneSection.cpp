@@ -578,7 +578,7 @@ int ReinforcedConcreteLayeredMembraneSection::sendSelf(int commitTag, Channel& t
 	int res = 0;
 	int dataTag = this->getDbTag();
 
-	static ID iData(3);
+	static thread_local ID iData(3);
 	iData(0) = this->getTag();
 	iData(1) = numberReinforcedSteelLayers;
 	iData(2) = numberConcreteLayers;
@@ -669,7 +669,7 @@ int ReinforcedConcreteLayeredMembraneSection::recvSelf(int commitTag, Channel& t
 
 	int dataTag = this->getDbTag();
 
-	static ID iData(3);
+	static thread_local ID iData(3);
 	res += theChannel.recvID(dataTag, commitTag, iData);
 
 	if (res < 0) {
@@ -42,7 +42,7 @@ typedef SensitiveResponse<FrameSection> SectionResponse;
 #include <elementAPI.h>
 
 ID NDFiberSection2d::code(3);
-Matrix NDFiberSection2d::fs(3,3);
+thread_local Matrix NDFiberSection2d::fs(3,3);
 
 void * OPS_ADD_RUNTIME_VPV(OPS_NDFiberSection2d)
 {
@@ -139,10 +139,10 @@ NDFiberSection2d::NDFiberSection2d(int tag, int num, NDMaterial **mats,
     exit(-1);
   }
 
-  static double fiberLocs[10000];
+  static thread_local double fiberLocs[10000];
   sectionIntegr->getFiberLocations(numFibers, fiberLocs);
   
-  static double fiberArea[10000];
+  static thread_local double fiberArea[10000];
   sectionIntegr->getFiberWeights(numFibers, fiberArea);
 
   for (int i = 0; i < numFibers; i++) {
@@ -319,7 +319,7 @@ NDFiberSection2d::setTrialSectionDeformation(const Vector &deforms)
                d2 = deforms(2);
 
 
-  static Vector eps(2);
+  static thread_local Vector eps(2);
 
   double rootAlpha = 1.0;
   eps(1) = d2;
@@ -392,8 +392,8 @@ NDFiberSection2d::getSectionDeformation(void)
 const Matrix&
 NDFiberSection2d::getInitialTangent(void)
 {
-  static double kInitial[9];
-  static Matrix kInitialMatrix(kInitial, 3, 3);
+  static thread_local double kInitial[9];
+  static thread_local Matrix kInitialMatrix(kInitial, 3, 3);
   kInitial[0] = 0.0; 
   kInitial[1] = 0.0; 
   kInitial[2] = 0.0; 
@@ -706,7 +706,7 @@ NDFiberSection2d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(3);
+  static thread_local ID data(3);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = computeCentroid ? 1 : 0; // Now the ID data is really 3  
@@ -762,7 +762,7 @@ NDFiberSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(3);
+  static thread_local ID data(3);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -1061,17 +1061,17 @@ NDFiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 NDFiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(3);
+  static thread_local Vector ds(3);
   
   ds.Zero();
   
-  static Vector stress(2);
-  static Vector dsigdh(2);
-  static Vector sig_dAdh(2);
-  static Matrix tangent(2,2);
+  static thread_local Vector stress(2);
+  static thread_local Vector dsigdh(2);
+  static thread_local Vector sig_dAdh(2);
+  static thread_local Matrix tangent(2,2);
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  static thread_local double locsDeriv[10000];
+  static thread_local double areaDeriv[10000];
 
   {
     for (int i = 0; i < numFibers; i++) {
@@ -1140,14 +1140,14 @@ NDFiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 NDFiberSection2d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(3,3);
+  static thread_local Matrix dksdh(3,3);
   
   dksdh.Zero();
   /*
   double y, A, dydh, dAdh, tangent, dtangentdh;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  static thread_local double fiberLocs[10000];
+  static thread_local double fiberArea[10000];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -1160,8 +1160,8 @@ NDFiberSection2d::getInitialTangentSensitivity(int gradIndex)
     }
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  static thread_local double locsDeriv[10000];
+  static thread_local double areaDeriv[10000];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
@@ -1205,8 +1205,8 @@ NDFiberSection2d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  static thread_local double locsDeriv[10000];
+  static thread_local double areaDeriv[10000];
 
   for (int i = 0; i < numFibers; i++) {
     locsDeriv[i] = 0.0;
@@ -1216,7 +1216,7 @@ NDFiberSection2d::commitSensitivity(const Vector& defSens,
   double kappa = e(1);
   double gamma = e(2);
 
-  static Vector depsdh(2);
+  static thread_local Vector depsdh(2);
 
   double rootAlpha = 1.0;
   if (alpha != 1.0)
@@ -287,7 +287,7 @@ NDFiberSection3d::setTrialSectionDeformation (const Vector &deforms)
     rootAlpha = sqrt(alpha);
 
   int res = 0;
-  static Vector eps(3);
+  static thread_local Vector eps(3);
   for (int i = 0; i < numFibers; i++) {
     NDMaterial *theMat = theMaterials[i];
     const double y  = matData[3*i]   - yBar;
@@ -404,13 +404,13 @@ NDFiberSection3d::getSectionDeformation(void)
 const Matrix&
 NDFiberSection3d::getInitialTangent(void)
 {
-  static double kInitial[36];
-  static Matrix ki(kInitial, 6, 6);
+  static thread_local double kInitial[36];
+  static thread_local Matrix ki(kInitial, 6, 6);
   ki.Zero();
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  static thread_local double yLocs[10000];
+  static thread_local double zLocs[10000];
+  static thread_local double fiberArea[10000];
 
   {
     for (int i = 0; i < numFibers; i++) {
@@ -845,7 +845,7 @@ NDFiberSection3d::sendSelf(int commitTag, Channel &theChannel)
 
   // create an id to send objects tag and numFibers, 
   //     size 3 so no conflict with matData below if just 1 fiber
-  static ID data(3);
+  static thread_local ID data(3);
   data(0) = this->getTag();
   data(1) = numFibers;
   data(2) = computeCentroid ? 1 : 0; // Now the ID data is really 3    
@@ -901,7 +901,7 @@ NDFiberSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
-  static ID data(3);
+  static thread_local ID data(3);
   
   int dbTag = this->getDbTag();
   res += theChannel.recvID(dbTag, commitTag, data);
@@ -1216,19 +1216,19 @@ NDFiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(6);
+  static thread_local Vector ds(6);
   
   ds.Zero();
   
   double y, z, A;
-  static Vector stress(3);
-  static Vector dsigdh(3);
-  static Vector sig_dAdh(3);
-  static Matrix tangent(3,3);
+  static thread_local Vector stress(3);
+  static thread_local Vector dsigdh(3);
+  static thread_local Vector sig_dAdh(3);
+  static thread_local Matrix tangent(3,3);
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  static thread_local double yLocs[10000];
+  static thread_local double zLocs[10000];
+  static thread_local double fiberArea[10000];
 
   {
     for (int i = 0; i < numFibers; i++) {
@@ -1238,9 +1238,9 @@ NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  static thread_local double dydh[10000];
+  static thread_local double dzdh[10000];
+  static thread_local double areaDeriv[10000];
 
   {
     for (int i = 0; i < numFibers; i++) {
@@ -1306,7 +1306,7 @@ NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
       ds(4) += drootAlphadh * (stress(2)*A);
     }
 
-    static Matrix as(3,6);
+    static thread_local Matrix as(3,6);
     as(0,0) =  1;
     as(0,1) = -y;
     as(0,2) =  z;
@@ -1315,7 +1315,7 @@ NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     as(1,5) = -z;
     as(2,5) =  y;
     
-    static Matrix dasdh(3,6);
+    static thread_local Matrix dasdh(3,6);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     dasdh(1,3) = drootAlphadh;
@@ -1323,7 +1323,7 @@ NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     dasdh(1,5) = -dzdh[i];
     dasdh(2,5) = dydh[i];
     
-    static Matrix tmpMatrix(6,6);
+    static thread_local Matrix tmpMatrix(6,6);
     tmpMatrix.addMatrixTripleProduct(0.0, as, tangent, dasdh, 1.0);
     
     ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -1335,14 +1335,14 @@ NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 NDFiberSection3d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(6,6);
+  static thread_local Matrix dksdh(6,6);
   
   dksdh.Zero();
   /*
   double y, A, dydh, dAdh, tangent, dtangentdh;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  static thread_local double fiberLocs[10000];
+  static thread_local double fiberArea[10000];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -1355,8 +1355,8 @@ NDFiberSection3d::getInitialTangentSensitivity(int gradIndex)
     }
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  static thread_local double locsDeriv[10000];
+  static thread_local double areaDeriv[10000];
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
@@ -1403,8 +1403,8 @@ NDFiberSection3d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  static thread_local double dydh[10000];
+  static thread_local double dzdh[10000];
 
   { // TODO
     for (int i = 0; i < numFibers; i++) {
@@ -1413,7 +1413,7 @@ NDFiberSection3d::commitSensitivity(const Vector& defSens,
     }
   }
 
-  static Vector depsdh(3);
+  static thread_local Vector depsdh(3);
 
   double rootAlpha = 1.0;
   if (alpha != 1.0)
@@ -46,8 +46,6 @@ typedef SensitiveResponse<SectionForceDeformation> SectionResponse;
 
 // Assumes section order is less than or equal to maxOrder.
 // Can increase if needed!!!
-double ParallelSection::workArea[2*maxOrder*(maxOrder+1)];
-int    ParallelSection::codeArea[maxOrder];
 
 void * OPS_ADD_RUNTIME_VPV(OPS_ParallelSection)
 {
@@ -184,11 +182,11 @@ ParallelSection::ParallelSection (int tag, int numSecs,
     exit(-1);
   }
 
-  theCode = new ID(codeArea, order);
-  e = new Vector(workArea, order);
-  s = new Vector(&workArea[maxOrder], order);
-  ks = new Matrix(&workArea[2*maxOrder], order, order);
-  fs = new Matrix(&workArea[maxOrder*(maxOrder+2)], order, order);
+  theCode = new ID(order);
+  e = new Vector(order);
+  s = new Vector(order);
+  ks = new Matrix(order, order);
+  fs = new Matrix(order, order);
 
   if (theCode == 0 || e == 0 || s == 0 || ks == 0 || fs == 0) {
     opserr << "ParallelSection::ParallelSection -- out of memory\n";
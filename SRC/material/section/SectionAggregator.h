@@ -116,9 +116,6 @@ class SectionAggregator : public FrameSection
    
     int otherDbTag;
 
-    static double workArea[];
-    static int codeArea[];
-
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     Vector dedh; // MHS hack
 // AddingSensitivity:END ///////////////////////////////////////////
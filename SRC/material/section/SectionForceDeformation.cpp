@@ -538,7 +538,7 @@ SectionForceDeformation::setTrialSectionDeformation(const Vector& nouse, const V
   return -1;
 }
 
-static Vector errRes(3);
+static thread_local Vector errRes(3);
 
 const Vector &
 SectionForceDeformation::getTemperatureStress(const Vector &tData) //PK
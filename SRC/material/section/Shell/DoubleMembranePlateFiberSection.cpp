@@ -267,7 +267,7 @@ setTrialSectionDeformation( const Vector &strainResultant_from_element)
 {
   this->strainResultant = strainResultant_from_element ;
 
-  static Vector strain(numFibers) ;
+  static thread_local Vector strain(numFibers);
 
   int success = 0 ;
 
@@ -318,7 +318,7 @@ const Vector& DoubleMembranePlateFiberSection::getSectionDeformation( )
 const Vector&  DoubleMembranePlateFiberSection::getStressResultant( )
 {
 
-  static Vector stress(numFibers) ;
+  static thread_local Vector stress(numFibers);
 
   int i ;
 
@@ -391,11 +391,11 @@ const Vector&  DoubleMembranePlateFiberSection::getStressResultant( )
 //send back the tangent 
 const Matrix&  DoubleMembranePlateFiberSection::getSectionTangent( )
 {
-  static Matrix dd(5,5) ;
+  static thread_local Matrix dd(5,5);
 
-  static Matrix Aeps(5,8) ;
+  static thread_local Matrix Aeps(5,8);
 
-  static Matrix Asig(8,5) ;
+  static thread_local Matrix Asig(8,5);
 
   int i ;
 
@@ -730,7 +730,7 @@ DoubleMembranePlateFiberSection::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(2*numFibers+1);
+  static thread_local ID idData(2*numFibers+1);
   
   int i;
   for (i = 0; i < numFibers; i++) {
@@ -775,7 +775,7 @@ DoubleMembranePlateFiberSection::recvSelf(int commitTag, Channel &theChannel, FE
   
   int dataTag = this->getDbTag();
 
-  static ID idData(2*numFibers+1);
+  static thread_local ID idData(2*numFibers+1);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
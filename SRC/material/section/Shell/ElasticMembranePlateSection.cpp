@@ -308,7 +308,7 @@ int
 ElasticMembranePlateSection::sendSelf(int cTag, Channel &theChannel) 
 {
   int res = 0;
-  static Vector data(6);
+  static thread_local Vector data(6);
   data(0) = this->getTag();
   data(1) = Em;
   data(2) = nu;
@@ -329,7 +329,7 @@ ElasticMembranePlateSection::recvSelf(int cTag, Channel &theChannel,
 				      FEM_ObjectBroker &theBroker)
 {
   int res = 0;
-  static Vector data(6);
+  static thread_local Vector data(6);
   res = theChannel.recvVector(this->getDbTag(), cTag, data);
   if (res < 0) 
     opserr << "ElasticMembranePlateSection::recvSelf() - failed to recv data\n";
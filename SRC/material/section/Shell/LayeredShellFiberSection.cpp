@@ -352,7 +352,7 @@ setTrialSectionDeformation( const Vector &strainResultant_from_element)
 {
   this->strainResultant = strainResultant_from_element ;
 
-  static Vector strain(5) ;
+  static thread_local Vector strain(5);
 
   int success = 0 ;
 
@@ -393,7 +393,7 @@ const Vector& LayeredShellFiberSection::getSectionDeformation( )
 const Vector&  LayeredShellFiberSection::getStressResultant( )
 {
 
-  static Vector stress(5) ;
+  static thread_local Vector stress(5);
 
   int i ;
 
@@ -437,7 +437,7 @@ const Vector&  LayeredShellFiberSection::getStressResultant( )
 //send back the tangent 
 const Matrix&  LayeredShellFiberSection::getSectionTangent( )
 {
-  static Matrix dd(5,5) ;
+  static thread_local Matrix dd(5,5);
 
 //  static Matrix Aeps(5,8) ;
 
@@ -639,7 +639,7 @@ LayeredShellFiberSection::sendSelf(int commitTag, Channel &theChannel)
 
   int dataTag = this->getDbTag();
 
-  static ID iData(3);
+  static thread_local ID iData(3);
   iData(0) = this->getTag();
   iData(1) = nLayers;
 
@@ -706,7 +706,7 @@ LayeredShellFiberSection::recvSelf(int commitTag, Channel &theChannel, FEM_Objec
   
   int dataTag = this->getDbTag();
 
-  static ID iData(3);
+  static thread_local ID iData(3);
   res += theChannel.recvID(dataTag, commitTag, iData);
 
   if (res < 0) {
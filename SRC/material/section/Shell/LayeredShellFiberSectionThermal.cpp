@@ -257,7 +257,7 @@ setTrialSectionDeformation( const Vector &strainResultant_from_element)
  
   this->strainResultant = strainResultant_from_element ;
 
-  static Vector strain(6) ;
+  static thread_local Vector strain(6);
 
   int success = 0 ;
 
@@ -366,7 +366,7 @@ LayeredShellFiberSectionThermal::getTemperatureStress(const Vector& dataMixed)
 const Vector&  LayeredShellFiberSectionThermal::getStressResultant( )
 {
 
-  static Vector stress(5) ;
+  static thread_local Vector stress(5);
 
   int i ;
 
@@ -415,7 +415,7 @@ const Vector&  LayeredShellFiberSectionThermal::getStressResultant( )
 //send back the tangent 
 const Matrix&  LayeredShellFiberSectionThermal::getSectionTangent( )
 {
-  static Matrix dd(5,5) ;
+  static thread_local Matrix dd(5,5);
 
 //  static Matrix Aeps(5,8) ;
 
@@ -599,7 +599,7 @@ LayeredShellFiberSectionThermal::sendSelf(int commitTag, Channel &theChannel)
 
   int dataTag = this->getDbTag();
 
-  static ID iData(3);
+  static thread_local ID iData(3);
   iData(0) = this->getTag();
   iData(1) = nLayers;
 
@@ -666,7 +666,7 @@ LayeredShellFiberSectionThermal::recvSelf(int commitTag, Channel &theChannel, FE
   
   int dataTag = this->getDbTag();
 
-  static ID iData(3);
+  static thread_local ID iData(3);
   res += theChannel.recvID(dataTag, commitTag, iData);
 
   if (res < 0) {
@@ -247,7 +247,7 @@ setTrialSectionDeformation( const Vector &strainResultant_from_element)
 {
   this->strainResultant = strainResultant_from_element ;
 
-  static Vector strain(numFibers) ;
+  static thread_local Vector strain(numFibers);
 
   int success = 0 ;
 
@@ -288,7 +288,7 @@ const Vector& MembranePlateFiberSection::getSectionDeformation( )
 const Vector&  MembranePlateFiberSection::getStressResultant( )
 {
 
-  static Vector stress(numFibers) ;
+  static thread_local Vector stress(numFibers);
 
   int i ;
 
@@ -336,11 +336,11 @@ const Vector&  MembranePlateFiberSection::getStressResultant( )
 //send back the tangent 
 const Matrix&  MembranePlateFiberSection::getSectionTangent( )
 {
-  static Matrix dd(5,5) ;
+  static thread_local Matrix dd(5,5);
 
-  static Matrix Aeps(5,8) ;
+  static thread_local Matrix Aeps(5,8);
 
-  static Matrix Asig(8,5) ;
+  static thread_local Matrix Asig(8,5);
 
   int i ;
 
@@ -544,7 +544,7 @@ MembranePlateFiberSection::sendSelf(int commitTag, Channel &theChannel)
   // object - don't want to have to do the check if sending data
   int dataTag = this->getDbTag();
   
-  static Vector vectData(1);
+  static thread_local Vector vectData(1);
   vectData(0) = h;
 
   res += theChannel.sendVector(dataTag, commitTag, vectData);
@@ -556,7 +556,7 @@ MembranePlateFiberSection::sendSelf(int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(2*numFibers+1);
+  static thread_local ID idData(2*numFibers+1);
   
   int i;
   for (i = 0; i < numFibers; i++) {
@@ -601,7 +601,7 @@ MembranePlateFiberSection::recvSelf(int commitTag, Channel &theChannel, FEM_Obje
   
   int dataTag = this->getDbTag();
 
-  static Vector vectData(1);
+  static thread_local Vector vectData(1);
   res += theChannel.recvVector(dataTag, commitTag, vectData);
 
   if (res < 0) {
@@ -611,7 +611,7 @@ MembranePlateFiberSection::recvSelf(int commitTag, Channel &theChannel, FEM_Obje
 
   h = vectData(0);
 
-  static ID idData(2*numFibers+1);
+  static thread_local ID idData(2*numFibers+1);
   // Quad now receives the tags of its four external nodes
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
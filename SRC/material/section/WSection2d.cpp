@@ -42,8 +42,8 @@
 #include <NDMaterial.h>
 
 ID WSection2d::code(6);
-Vector WSection2d::s(6);
-Matrix WSection2d::ks(6,6);
+thread_local Vector WSection2d::s(6);
+thread_local Matrix WSection2d::ks(6,6);
 
 // constructors:
 WSection2d::WSection2d(int tag, NDMaterial &theMat,
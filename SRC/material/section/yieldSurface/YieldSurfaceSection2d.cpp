@@ -14,10 +14,10 @@
 #include <classTags.h>
 
 ID      YieldSurfaceSection2d::code(2);
-Vector  YieldSurfaceSection2d::dele(2);
-Vector  YieldSurfaceSection2d::surfaceForce(2);
-Matrix  YieldSurfaceSection2d::G(2,1);
-Matrix  YieldSurfaceSection2d::Ktp(2,2);
+thread_local Vector  YieldSurfaceSection2d::dele(2);
+thread_local Vector  YieldSurfaceSection2d::surfaceForce(2);
+thread_local Matrix  YieldSurfaceSection2d::G(2,1);
+thread_local Matrix  YieldSurfaceSection2d::Ktp(2,2);
 
 YieldSurfaceSection2d::YieldSurfaceSection2d(void)
   :SectionForceDeformation(0, SEC_TAG_YieldSurface2d),
@@ -59,10 +59,10 @@ class YieldSurfaceSection2d: public SectionForceDeformation
   bool use_Kr, split_step;
   
   static ID code;
-  static Vector dele;
-  static Vector surfaceForce;
-  static Matrix G;
-  static Matrix Ktp;
+  static thread_local Vector dele;
+  static thread_local Vector surfaceForce;
+  static thread_local Matrix G;
+  static thread_local Matrix Ktp;
 };
 
 #endif
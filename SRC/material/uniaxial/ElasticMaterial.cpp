@@ -33,6 +33,7 @@
 // What: "@(#) ElasticMaterial.C, revA"
 
 #include <ElasticMaterial.h>
+#include <UniaxialBatch.h>
 #include <Vector.h>
 #include <Channel.h>
 #include <Information.h>
@@ -160,6 +161,13 @@ ElasticMaterial::setTrial(double strain, double &stress, double &tangent, double
 }
 
 
+int
+ElasticMaterial::setTrialBatch(UniaxialMaterial *const *materials, int n,
+                               const double *strain, double *stress, double *tangent)
+{
+  return OpenSees::uniaxial_batch<ElasticMaterial, true>(materials, n, strain, stress, tangent);
+}
+
 double 
 ElasticMaterial::getStress(void)
 {
@@ -50,6 +50,9 @@ class ElasticMaterial : public UniaxialMaterial
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0); 
+    int setTrialBatch(UniaxialMaterial *const *materials, int n,
+                      const double *strain, double *stress, double *tangent);
+    bool isThreadSafe() const {return true;}
     double getStrain(void) {return trialStrain;};
     double getStrainRate(void) {return trialStrainRate;};
     double getStress(void);
@@ -36,6 +36,7 @@
 #include <float.h>
 #include <Vector.h>
 #include <HystereticMaterial.h>
+#include <UniaxialBatch.h>
 #include <Channel.h>
 #include <Information.h>
 #include <Parameter.h>
@@ -253,6 +254,13 @@ HystereticMaterial::setTrialStrain(double strain, double strainRate)
 }
 
 
+int
+HystereticMaterial::setTrialBatch(UniaxialMaterial *const *materials, int n,
+                                  const double *strain, double *stress, double *tangent)
+{
+  return OpenSees::uniaxial_batch<HystereticMaterial>(materials, n, strain, stress, tangent);
+}
+
 double
 HystereticMaterial::getStrain(void)
 {
@@ -60,6 +60,8 @@ class HystereticMaterial : public UniaxialMaterial
   const char *getClassType(void) const {return "HystereticMaterial";};
   
   int setTrialStrain(double strain, double strainRate = 0.0);
+  int setTrialBatch(UniaxialMaterial *const *materials, int n,
+                    const double *strain, double *stress, double *tangent);
   double getStrain(void);
   double getStress(void);
   double getTangent(void);
@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Batched state determination of uniaxial materials. The
+// fibers of a section come in runs made from the same material model (the
+// cover, the core, a layer of bars). Rather than making three virtual
+// calls for each fiber, the section calls setTrialBatch once per run on
+// the first material of the run. A model that overrides setTrialBatch with
+// uniaxial_batch<Model> evaluates the whole run with direct calls to its
+// own setTrialStrain, getStress and getTangent, which the compiler can
+// inline into one loop.
+//
+// The state of each fiber stays in its material object, so commit,
+// revert, recorders and parallel send/recv are unchanged.
+//
+// Written: cmp
+//
+#ifndef UniaxialBatch_h
+#define UniaxialBatch_h
+
+#include <OPS_Globals.h>
+#include <UniaxialMaterial.h>
+#include <Profiler.h>
+#include <algorithm>
+#include <typeinfo>
+#include <vector>
+
+namespace OpenSees {
+
+//
+// The body of setTrialBatch for a model T. Models that override
+// setTrial(strain, stress, tangent) pass ownSetTrial = true and have it
+// called directly; otherwise this does what UniaxialMaterial::setTrial
+// does, without the virtual calls. A class derived from T that does not
+// override setTrialBatch itself is set one material at a time.
+//
+template <class T, bool ownSetTrial = false>
+inline int
+uniaxial_batch(UniaxialMaterial *const *materials, int n,
+               const double *strain, double *stress, double *tangent)
+{
+  if (n > 0 && typeid(*materials[0]) != typeid(T))
+    return materials[0]->UniaxialMaterial::setTrialBatch(materials, n, strain, stress, tangent);
+
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    T *theMaterial = static_cast<T *>(materials[i]);
+    if constexpr (ownSetTrial) {
+      res += theMaterial->T::setTrial(strain[i], stress[i], tangent[i]);
+
+    } else {
+      const int ok = theMaterial->T::setTrialStrain(strain[i]);
+      if (ok == 0) {
+        stress[i]  = theMaterial->T::getStress();
+        tangent[i] = theMaterial->T::getTangent();
+      } else
+        opserr << "UniaxialMaterial::setTrial() - material failed in setTrialStrain()\n";
+      res += ok;
+    }
+  }
+  return res;
+}
+
+
+//
+// For each of materials[0], ..., materials[n-1], store in runEnd one
+// past the last index of the run of materials of the same class that it
+// belongs to.
+//
+inline void
+find_uniaxial_runs(UniaxialMaterial *const *materials, int n, int *runEnd)
+{
+  for (int last = n; last > 0; ) {
+    const std::type_info &type = typeid(*materials[last-1]);
+    int first = last - 1;
+    while (first > 0 && typeid(*materials[first-1]) == type)
+      first--;
+
+    std::fill(runEnd + first, runEnd + last, last);
+    last = first;
+  }
+}
+
+
+//
+// The runs of materials[0], ..., materials[n-1], kept in runEnd and found
+// again when the number of materials changes; a section clears runEnd
+// when it replaces materials without changing their number.
+//
+inline const int *
+find_uniaxial_runs(UniaxialMaterial *const *materials, int n, std::vector<int> &runEnd)
+{
+  if (static_cast<int>(runEnd.size()) != n) {
+    runEnd.resize(n);
+    find_uniaxial_runs(materials, n, runEnd.data());
+  }
+  return runEnd.data();
+}
+
+
+//
+// Set the trial strains of materials[first], ..., materials[last-1];
+// strain, stress and tangent are indexed from first.
+//
+inline int
+set_trial_runs(UniaxialMaterial *const *materials, const int *runEnd,
+               int first, int last,
+               const double *strain, double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i = first; i < last; ) {
+    const int end = std::min(runEnd[i], last);
+    const int j = i - first;
+
+    OPS_PROFILE(MaterialTrial, *materials[i]);
+    res += materials[i]->setTrialBatch(materials + i, end - i,
+                                       strain + j, stress + j, tangent + j);
+    i = end;
+  }
+  return res;
+}
+
+} // namespace OpenSees
+
+#endif
@@ -81,6 +81,18 @@ UniaxialMaterial::setTrial(double strain, double &stress, double &tangent, doubl
 }
 
 
+int
+UniaxialMaterial::setTrialBatch(UniaxialMaterial *const *materials, int n,
+                                const double *strain, double *stress, double *tangent)
+{
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += materials[i]->setTrial(strain[i], stress[i], tangent[i]);
+
+  return res;
+}
+
+
 int
 UniaxialMaterial::setTrial(double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate)
 {
@@ -113,6 +125,13 @@ UniaxialMaterial::getStrainRate()
 }
 
 
+bool
+UniaxialMaterial::isThreadSafe() const
+{
+  // materials must opt in
+  return false;
+}
+
 // default operation for damping tangent is zero
 double
 UniaxialMaterial::getDampTangent()
@@ -259,11 +278,11 @@ UniaxialMaterial::setResponse(const char **argv, int argc,
 int 
 UniaxialMaterial::getResponse(int responseID, Information &matInfo)
 {
-  static Vector stressStrain(2);
-  static Vector stressStrainTangent(3);
+  static thread_local Vector stressStrain(2);
+  static thread_local Vector stressStrainTangent(3);
 
-  static Vector tempData(2);  //L.jiang [SIF]
-  static Information infoData(tempData);  //L.jiang [SIF]
+  static thread_local Vector tempData(2);  //L.jiang [SIF]
+  static thread_local Information infoData(tempData);  //L.jiang [SIF]
 
   // each subclass must implement its own stuff   
 
@@ -58,6 +58,17 @@ class UniaxialMaterial : // public Material
     virtual int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0);
     virtual int setTrial(double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate = 0.0);
 
+    // setTrial for each of materials[0], ..., materials[n-1], which are
+    // of the same class as this one (materials[0] is this); see
+    // UniaxialBatch.h
+    virtual int setTrialBatch(UniaxialMaterial *const *materials, int n,
+                              const double *strain, double *stress, double *tangent);
+
+    // return true if setTrialStrain(), commitState(), revertToLastCommit()
+    // and the getStress() and getTangent() methods only modify state owned
+    // by this material, so that copies of it may be used concurrently
+    virtual bool isThreadSafe() const;
+
     virtual double getStrain() = 0;
     virtual double getStrainRate();
     virtual double getStress() = 0;
@@ -33,6 +33,7 @@
 
 
 #include <Concrete01.h>
+#include <UniaxialBatch.h>
 #include <Vector.h>
 #include <Matrix.h>
 #include <Channel.h>
@@ -389,6 +390,12 @@ double Concrete01::getStress ()
    return Tstress;
 }
 
+int Concrete01::setTrialBatch (UniaxialMaterial *const *materials, int n,
+                               const double *strain, double *stress, double *tangent)
+{
+   return OpenSees::uniaxial_batch<Concrete01, true>(materials, n, strain, stress, tangent);
+}
+
 double Concrete01::getStrain ()
 {
    return Tstrain;
@@ -52,6 +52,9 @@ class Concrete01 : public UniaxialMaterial
   
   int setTrialStrain(double strain, double strainRate = 0.0); 
   int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
+  int setTrialBatch(UniaxialMaterial *const *materials, int n,
+                    const double *strain, double *stress, double *tangent);
+  bool isThreadSafe() const {return true;}
   double getStrain(void);      
   double getStress(void);
   double getTangent(void);
@@ -41,6 +41,7 @@
 #include <math.h>
 
 #include <Concrete02.h>
+#include <UniaxialBatch.h>
 #include <OPS_Globals.h>
 #include <float.h>
 #include <Channel.h>
@@ -270,6 +271,13 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
 
 
 
+int
+Concrete02::setTrialBatch(UniaxialMaterial *const *materials, int n,
+                          const double *strain, double *stress, double *tangent)
+{
+  return OpenSees::uniaxial_batch<Concrete02>(materials, n, strain, stress, tangent);
+}
+
 double 
 Concrete02::getStrain(void)
 {
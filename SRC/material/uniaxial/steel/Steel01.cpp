@@ -25,6 +25,7 @@
 // Created: 06/99
 //
 #include <Steel01.h>
+#include <UniaxialBatch.h>
 #include <Vector.h>
 #include <Matrix.h>
 #include <Channel.h>
@@ -289,6 +290,12 @@ void Steel01::detectLoadReversal (double dStrain)
    }
 }
 
+int Steel01::setTrialBatch (UniaxialMaterial *const *materials, int n,
+                            const double *strain, double *stress, double *tangent)
+{
+   return OpenSees::uniaxial_batch<Steel01, true>(materials, n, strain, stress, tangent);
+}
+
 double Steel01::getStrain ()
 {
    return Tstrain;
@@ -35,6 +35,7 @@
 
 #include <stdlib.h>
 #include <Steel02.h>
+#include <UniaxialBatch.h>
 #include <float.h>
 #include <Channel.h>
 #include <Information.h>
@@ -364,6 +365,13 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
 
 
 
+int
+Steel02::setTrialBatch(UniaxialMaterial *const *materials, int n,
+                       const double *strain, double *stress, double *tangent)
+{
+  return OpenSees::uniaxial_batch<Steel02>(materials, n, strain, stress, tangent);
+}
+
 double 
 Steel02::getStrain(void)
 {
@@ -68,6 +68,9 @@ class Steel02 : public UniaxialMaterial
     UniaxialMaterial *getCopy(void);
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialBatch(UniaxialMaterial *const *materials, int n,
+                      const double *strain, double *stress, double *tangent);
+    bool isThreadSafe() const {return true;}
     double getStrain(void);      
     double getStress(void);
     double getTangent(void);
@@ -79,6 +79,7 @@ class ID
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class MemoryDatastore;
     
   private:
     static int ID_NOT_VALID_ENTRY;
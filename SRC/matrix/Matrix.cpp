@@ -26,6 +26,7 @@
 //
 #include "Matrix.h"
 #include "Vector.h"
+#include "Scratch.h"
 #include "Vector3D.h"
 #include "routines/cmx.h"
 #include "blasdecl.h"
@@ -39,15 +40,6 @@
 #include <math.h>
 #include <assert.h>
 
-#ifndef NO_STATIC_WORK
-# define MATRIX_WORK_AREA 400
-# define INT_WORK_AREA 20
-  int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
-  int Matrix::sizeIntWork = INT_WORK_AREA;
-  double *Matrix::matrixWork = nullptr;
-  int    *Matrix::intWork    = nullptr;
-#endif
-
 //#define MATRIX_BLAS
 //#define NO_WORK
 
@@ -59,11 +51,6 @@
 Matrix::Matrix()
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
 }
 
 
@@ -73,12 +60,6 @@ Matrix::Matrix(int nRows,int nCols)
 //assert(nRows > 0);
 //assert(nCols > 0);
 
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
-
   dataSize = numRows * numCols;
   data = nullptr;
 
@@ -92,24 +73,12 @@ Matrix::Matrix(double *theData, int row, int col)
 //assert(row > 0);
 //assert(col > 0);
 
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
-
 }
 
 
 Matrix::Matrix(const Matrix &other)
 : numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == nullptr) {
-    matrixWork = new double[sizeDoubleWork];
-    intWork    = new int[sizeIntWork];
-  }
-
   numRows  = other.numRows;
   numCols  = other.numCols;
   dataSize = other.dataSize;
@@ -152,13 +121,6 @@ Matrix::~Matrix()
       data = nullptr;
     }
   }
-#ifdef NO_STATIC_WORK
-  if (matrixWork != nullptr)
-    delete [] matrixWork;
-
-  if (intWork != nullptr)
-    delete [] intWork;
-#endif
 }
     
 
@@ -257,27 +219,11 @@ Matrix::Solve(const Vector &b, Vector &x)
     assert(numRows == x.Size());
     assert(numRows == b.Size());
 
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-      if (matrixWork != nullptr) {
-        delete [] matrixWork;
-        matrixWork = nullptr;
-      }
-      matrixWork = new double[dataSize];
-      sizeDoubleWork = dataSize;
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
+    // the factorization overwrites its input, so work on a copy
+    OpenSees::Scratch scratch;
+    double *matrixWork = scratch.doubles(dataSize);
+    int *intWork = scratch.ints(n);
 
-      if (intWork != nullptr) {
-        delete [] intWork;
-        intWork = nullptr;
-      }
-      intWork = new int[n];
-      sizeIntWork = n;  
-    }
- 
     // copy the data
     for (int i=0; i<dataSize; i++)
       matrixWork[i] = data[i];
@@ -306,31 +252,10 @@ Matrix::Solve(const Vector &b, Vector &x) const
     assert(numRows == x.Size());
     assert(numRows == b.Size());
 
-#if defined(NO_STATIC_WORK)
-    /* static */ double *matrixWork = nullptr;
-    /* static */ int *intWork = nullptr;
-    /* static */ int sizeDoubleWork = 0;
-    /* static */ int sizeIntWork    = 0;
-#endif
+    OpenSees::Scratch scratch;
+    double *matrixWork = scratch.doubles(dataSize);
+    int *intWork = scratch.ints(n);
 
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-      if (matrixWork != nullptr) {
-        delete [] matrixWork;
-        matrixWork = nullptr;
-      }
-      matrixWork = new double[dataSize];
-      sizeDoubleWork = dataSize;
-    }
-    if (n > sizeIntWork) {
-      if (intWork != nullptr) {
-        delete [] intWork;
-        intWork = nullptr;
-      }
-      intWork = new int[n];
-      sizeIntWork = n;  
-    }
- 
     // copy the data
     int i;
     for (i=0; i<dataSize; i++)
@@ -349,9 +274,6 @@ Matrix::Solve(const Vector &b, Vector &x) const
 
     DGESV(&n,&nrhs,Aptr,&ldA,iPIV,Xptr,&ldB,&info);
 
-    delete [] intWork;
-    delete [] matrixWork;
-
     return -abs(info);
 }
 
@@ -367,23 +289,9 @@ Matrix::Solve(const Matrix &b, Matrix &x) // const
     assert(n == b.numRows);
     assert(x.numCols == b.numCols);
 
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-      if (matrixWork != 0) {
-        delete [] matrixWork;
-        matrixWork = 0;
-      }
-      matrixWork = new double[dataSize];
-      sizeDoubleWork = dataSize;
-    }
-    if (n > sizeIntWork) {
-      if (intWork != nullptr) {
-        delete [] intWork;
-        intWork = 0;
-      }
-      intWork = new int[n];
-      sizeIntWork = n;
-    }
+    OpenSees::Scratch scratch;
+    double *matrixWork = scratch.doubles(dataSize);
+    int *intWork = scratch.ints(n);
 
     // copy the data
     int i;
@@ -457,37 +365,16 @@ Matrix::Invert()
       cmx_inv6(data, data, &info);
       break;
 
-    default:
-  
-      // check work area can hold all the data
-      if (dataSize > sizeDoubleWork) {
-        if (matrixWork != nullptr) {
-          delete [] matrixWork;
-          matrixWork = 0;
-        }
-        matrixWork = new double[dataSize];
-        sizeDoubleWork = dataSize;
-      }
+    default: {
+      OpenSees::Scratch scratch;
+      double *matrixWork = scratch.doubles(dataSize);
+      int *intWork = scratch.ints(n);
 
-      // check work area can hold all the data
-      if (n > sizeIntWork) {
-        if (intWork != 0) {
-          delete [] intWork;
-          intWork = nullptr;
-        }
-        intWork = new int[n];
-        sizeIntWork = n;  
-      }
-#if 0
-      // copy the data 
-      for (int i=0; i<dataSize; i++)
-        matrixWork[i] = data[i];
-#endif
       // theInverse = *this;
       int ldA = n;
       double *Wptr = matrixWork;
       double *Aptr = data;
-      int workSize = sizeDoubleWork;
+      int workSize = dataSize;
       
       int *iPIV = intWork;
 
@@ -495,7 +382,7 @@ Matrix::Invert()
       if (info != 0) 
         return -abs(info);
       DGETRI(&n,Aptr,&ldA,iPIV,Wptr,&workSize,&info);
-
+    }
   }
   return -abs(info);
 }
@@ -833,16 +720,13 @@ Matrix::addMatrixTripleProduct(double thisFact,
   if (thisFact == 1.0 && otherFact == 0.0)
     return 0;
 
-  // check work area can hold the temporary matrix
+  // the temporary matrix B*T is held in scratch memory
   int dimB = B.numCols;
   int sizeWork = dimB * numCols;
+  OpenSees::Scratch scratch;
+  double *matrixWork = scratch.doubles(sizeWork);
 
-  if (sizeWork > sizeDoubleWork) {
-    // TODO
-    this->addMatrix(thisFact, T^B*T, otherFact);
-    return 0;
-  }
-  else {
+  {
     int m = B.numRows,
         n = T.numCols,
         k = B.numCols;
@@ -942,15 +826,14 @@ Matrix::addMatrixTripleProduct(double thisFact,
     if (thisFact == 1.0 && otherFact == 0.0)
       return 0;
 
-    // check work area can hold the temporary matrix
+    // the temporary matrix B*C is held in scratch memory
     int sizeWork = B.numRows * numCols;
-#ifndef NO_WORK
-    if (sizeWork > sizeDoubleWork) {
-#endif
-      this->addMatrix(thisFact, A^B*C, otherFact);
-      return 0;
-#ifndef NO_WORK
-    }
+#ifdef NO_WORK
+    this->addMatrix(thisFact, A^B*C, otherFact);
+    return 0;
+#else
+    OpenSees::Scratch scratch;
+    double *matrixWork = scratch.doubles(sizeWork);
 
     // zero out the work area
     double *matrixWorkPtr = matrixWork;
@@ -29,7 +29,6 @@
 //
 #ifndef Matrix_h
 #define Matrix_h 
-#define NO_STATIC_WORK
 #include <assert.h>
 #include <cstddef>
 using std::size_t;
@@ -190,23 +189,12 @@ class Matrix
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class MemoryDatastore;
 
   protected:
 
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-#ifdef NO_STATIC_WORK
-    double *matrixWork = nullptr;
-    int *intWork = nullptr;
-    int sizeDoubleWork = 400;
-    int sizeIntWork = 20;
-#else
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
-#endif
-
     int numRows;
     int numCols;
     int dataSize;
@@ -0,0 +1,117 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <Scratch.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace OpenSees {
+
+// smallest block of memory the arena asks the system for
+static constexpr std::size_t minChunkSize = 4096;
+
+struct Scratch::Arena {
+  // the chunks are never moved or freed, so the pointers handed out stay
+  // valid while later chunks are added
+  std::vector<std::unique_ptr<double[]>> chunks;
+  std::vector<std::size_t> sizes;
+  std::size_t chunk  = 0;       // chunk at the top of the arena
+  std::size_t offset = 0;       // first free value in that chunk
+
+  // Matrix and Vector objects that are reused to view the memory
+  std::deque<Matrix> matrices;
+  std::deque<Vector> vectors;
+  std::size_t numMatrix = 0;
+  std::size_t numVector = 0;
+
+  double *take(std::size_t n) {
+    while (chunk < chunks.size() && offset + n > sizes[chunk]) {
+      chunk++;
+      offset = 0;
+    }
+    if (chunk == chunks.size()) {
+      const std::size_t size = std::max({n, minChunkSize, sizes.empty() ? 0 : 2*sizes.back()});
+      chunks.emplace_back(new double[size]);
+      sizes.push_back(size);
+      offset = 0;
+    }
+    double *values = chunks[chunk].get() + offset;
+    offset += n;
+    return values;
+  }
+};
+
+Scratch::Arena &
+Scratch::localArena()
+{
+  thread_local Scratch::Arena theArena;
+  return theArena;
+}
+
+Scratch::Scratch()
+:arena(localArena()),
+ chunk(arena.chunk), offset(arena.offset),
+ numMatrix(arena.numMatrix), numVector(arena.numVector)
+{
+
+}
+
+Scratch::~Scratch()
+{
+  arena.chunk = chunk;
+  arena.offset = offset;
+  arena.numMatrix = numMatrix;
+  arena.numVector = numVector;
+}
+
+double *
+Scratch::doubles(std::size_t n)
+{
+  return arena.take(n);
+}
+
+int *
+Scratch::ints(std::size_t n)
+{
+  static_assert(sizeof(int) <= sizeof(double), "an int must fit in a double");
+  return reinterpret_cast<int *>(arena.take(n));
+}
+
+Matrix &
+Scratch::matrix(int rows, int cols)
+{
+  double *values = arena.take(std::size_t(rows)*cols);
+  if (arena.numMatrix == arena.matrices.size())
+    arena.matrices.emplace_back(values, rows, cols);
+  else
+    arena.matrices[arena.numMatrix].setData(values, rows, cols);
+
+  Matrix &theMatrix = arena.matrices[arena.numMatrix++];
+  theMatrix.Zero();
+  return theMatrix;
+}
+
+Vector &
+Scratch::vector(int size)
+{
+  double *values = arena.take(size);
+  if (arena.numVector == arena.vectors.size())
+    arena.vectors.emplace_back(values, size);
+  else
+    arena.vectors[arena.numVector].setData(values, size);
+
+  Vector &theVector = arena.vectors[arena.numVector++];
+  theVector.Zero();
+  return theVector;
+}
+
+} // namespace OpenSees
@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Scratch hands out temporary memory, and Matrix and Vector
+// objects viewing it, from an arena private to the calling thread. The
+// arena is used like a stack: a Scratch object marks its top when it is
+// created and gives back everything taken through it when it goes out of
+// scope, so nested Scratch objects (one in an element, another in a
+// Matrix::Solve() it calls) do not interfere. Nothing is freed until the
+// thread exits, so after the first few calls no memory is allocated.
+//
+// This is meant for the temporaries of the state determination, which
+// used to live in class-static or function-static work areas and so could
+// not be used by more than one thread at a time:
+//
+//    OpenSees::Scratch scratch;
+//    Matrix &K = scratch.matrix(6, 6);
+//    Vector &p = scratch.vector(6);
+//
+// The Matrix and Vector references stay valid until the Scratch object
+// is destroyed; they must not be returned from the function.
+//
+// Written: cmp
+//
+#ifndef Scratch_h
+#define Scratch_h
+
+#include <cstddef>
+
+class Matrix;
+class Vector;
+
+namespace OpenSees {
+
+class Scratch
+{
+  public:
+    Scratch();
+    ~Scratch();
+
+    Scratch(const Scratch &) = delete;
+    Scratch &operator=(const Scratch &) = delete;
+
+    // uninitialized storage for n values
+    double *doubles(std::size_t n);
+    int    *ints(std::size_t n);
+
+    // zeroed objects of the given size, which must not be zero
+    Matrix &matrix(int rows, int cols);
+    Vector &vector(int size);
+
+  private:
+    struct Arena;
+    static Arena &localArena();
+    Arena &arena;
+
+    // the top of the arena when this object was created
+    std::size_t chunk, offset, numMatrix, numVector;
+};
+
+} // namespace OpenSees
+
+#endif
@@ -148,6 +148,7 @@ class Vector
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
+    friend class MemoryDatastore;
     
   private:
     int sz;
@@ -406,6 +406,17 @@ class OpenSeesPy:
 
 
 class Model:
+    """
+    A model with its own Tcl interpreter and runtime, which holds the
+    model builder, the domain, the analysis and the database.
+
+    Models created on different threads may be built and analyzed at the
+    same time. A model must only be used from the thread that created it:
+    Tcl requires this, and the analysis state that element and material
+    code reads through globals (the active domain and element, the time
+    step, the arguments being parsed) is kept per thread, not per model.
+    Models that share a thread take turns.
+    """
     def __init__(self, *args, echo_file=None, **kwds):
         self._openseespy = OpenSeesPy(echo_file=echo_file)
         if len(args) > 0 or len(kwds) > 0:
@@ -698,6 +709,7 @@ __all__ = [
     "nodeBounds",
     "start",
     "stop",
+    "profile",
     "modalDamping",
     "modalDampingQ",
     "setElementRayleighDampingFactors",
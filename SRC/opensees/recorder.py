@@ -67,10 +67,10 @@ class Recorder:
         if format is None:
             format = self.destination.split(".")[-1]
 
-        if format not in ["txt", "bin", "xml", "binary", "tcp"]:
+        if format not in ["txt", "bin", "ocb", "xml", "binary", "binaryColumnar", "tcp"]:
             raise ValueError("Unable to deduce format")
 
-        format = {"txt": "file", "bin": "binary"}.get(format, format)
+        format = {"txt": "file", "bin": "binary", "ocb": "binaryColumnar"}.get(format, format)
 
         self._args[0].flag = "-" + format
 
@@ -93,6 +93,91 @@ class Recorder:
 
 
 
+class ColumnarOutput:
+    """
+    Read a file written with the `-binaryColumnar` recorder option.
+
+    The file is memory-mapped; only its header, schema and chunk index
+    are read when it is opened, and each call to `column` touches only
+    the blocks of that one column.
+
+        out = ColumnarOutput("disp.ocb")
+        t   = out.time
+        u   = out.column("D1", tag=12)   # dof 1 of node 12
+    """
+    _header = [("magic", "S8"), ("version", "<u4"), ("value_size", "<u4"),
+               ("num_columns", "<u8"), ("num_rows", "<u8"), ("num_chunks", "<u8"),
+               ("schema_size", "<u8"), ("index_offset", "<u8"), ("reserved", "<u8")]
+
+    def __init__(self, filename):
+        import numpy as np
+        self._data = np.memmap(filename, dtype=np.uint8, mode="r")
+        header = self._data[:64].view(np.dtype(self._header))[0]
+        if header["magic"] != b"OPSCOLS" or header["version"] != 1:
+            raise ValueError(f"{filename} is not a columnar recorder file")
+
+        self._dtype = np.dtype("<f8" if header["value_size"] == 8 else "<f4")
+        ncol = int(header["num_columns"])
+
+        size = int(header["schema_size"])
+        self.columns = []
+        for line in bytes(self._data[64:64+size]).decode().splitlines():
+            name, tag, dof, context = line.split("\t", 3)
+            self.columns.append({"name": name, "tag": int(tag),
+                                 "dof": int(dof), "context": context})
+
+        # (offset of the values, number of rows) of each chunk
+        self._chunks = []
+        offset = 64 + (size + 7)//8*8
+        index  = int(header["index_offset"])
+        if index != 0:
+            offsets = self._data[index:index+8*int(header["num_chunks"])].view("<u8")
+        else:
+            offsets = None
+        while True:
+            if offsets is not None:
+                if len(self._chunks) == len(offsets):
+                    break
+                offset = int(offsets[len(self._chunks)])
+            if offset + 16 > len(self._data):
+                break
+            magic, nrow = self._data[offset:offset+8].view("<u4")
+            width = int(self._data[offset+8:offset+16].view("<u8")[0])
+            end = offset + 16 + int(nrow)*ncol*self._dtype.itemsize
+            if magic != 0x4B4E4843 or width != ncol or end > len(self._data):
+                break
+            self._chunks.append((offset + 16, int(nrow)))
+            offset = end
+
+        self.num_rows = sum(n for _, n in self._chunks)
+
+    def find(self, name, tag=None):
+        for j, column in enumerate(self.columns):
+            if column["name"] == name and (tag is None or column["tag"] == tag):
+                return j
+        raise KeyError(name if tag is None else (name, tag))
+
+    def column(self, name, tag=None):
+        """
+        Return the values of one column, given by its index or by its
+        response name and node or element tag. A file of a single chunk
+        gives a read-only view of the mapped file without copying.
+        """
+        import numpy as np
+        j = name if isinstance(name, int) else self.find(name, tag)
+        size = self._dtype.itemsize
+        blocks = [self._data[start + j*n*size:start + (j+1)*n*size].view(self._dtype)
+                  for start, n in self._chunks]
+        if len(blocks) == 1:
+            return blocks[0]
+        return np.concatenate(blocks) if blocks else np.empty(0, self._dtype)
+
+    @property
+    def time(self):
+        return self.column("time")
+
+
+
 #recorder Node 
 @recorder
 class Node(Recorder):
@@ -9,6 +9,7 @@ import os
 import sys
 import json
 import atexit
+import threading
 import pathlib
 import platform
 from contextlib import contextmanager
@@ -129,6 +130,8 @@ class Interpreter:
         self._tcl = _create_interp(verbose=verbose,
                                    preload=preload,
                                    enable_tk=enable_tk)
+        # Tcl only accepts calls from the thread that created the interpreter
+        self._thread = threading.get_ident()
 
         # TODO:
         if not safe:
@@ -153,7 +156,7 @@ class Interpreter:
         atexit.register(self.cleanup) #lambda : self.eval("wipe") if hasattr(self, "_tcl") else None)
 
     def cleanup(self):
-        if hasattr(self, "_tcl"):
+        if hasattr(self, "_tcl") and self._thread == threading.get_ident():
             self.eval("wipe")
 
 
@@ -50,6 +50,8 @@ class AlgorithmIncrements : public Recorder
     
     ~AlgorithmIncrements();    
 
+    const char *getClassType(void) const {return "AlgorithmIncrements";}
+
     int plotData(const Vector &X, const Vector &B);
 
     int record(int commitTag, double timeStamp);
@@ -59,6 +59,8 @@ class DamageRecorder: public Recorder
 		    bool echotimeflag, double deltat, double relDeltaTTol, OPS_Stream &theOutputStream);
 
     ~DamageRecorder();
+
+    const char *getClassType(void) const {return "DamageRecorder";}
     int record(int commitTag, double timeStamp);
     int playback(int commitTag);
 
@@ -49,6 +49,8 @@ class DatastoreRecorder: public Recorder
   public:
     DatastoreRecorder(FE_Datastore &theDatastore);
     ~DatastoreRecorder();
+
+    const char *getClassType(void) const {return "DatastoreRecorder";}
     int record(int commitTag, double timeStamp);
     int playback(int commitTag);
     int restart(void);
@@ -58,6 +58,8 @@ class DriftRecorder: public Recorder
   
   ~DriftRecorder();
 
+  const char *getClassType(void) const {return "DriftRecorder";}
+
   int record(int commitTag, double timeStamp);
   int restart(void);    
   int flush(void);    
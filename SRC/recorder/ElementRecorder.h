@@ -64,6 +64,8 @@ class ElementRecorder: public Recorder
 
     ~ElementRecorder();
 
+    const char *getClassType(void) const {return "ElementRecorder";}
+
     int record(int commitTag, double timeStamp);
     int restart(void);    
     int flush(void);    
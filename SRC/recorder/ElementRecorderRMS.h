@@ -57,6 +57,8 @@ class ElementRecorderRMS: public Recorder
     
     ~ElementRecorderRMS();
 
+    const char *getClassType(void) const {return "ElementRecorderRMS";}
+
     int record(int commitTag, double timeStamp);
     int restart(void);    
     int flush(void);    
@@ -53,6 +53,8 @@ class EnvelopeDriftRecorder: public Recorder
 			bool echoTime = false);
   
   ~EnvelopeDriftRecorder();
+
+  const char *getClassType(void) const {return "EnvelopeDriftRecorder";}
   
   int record(int commitTag, double timeStamp);
   int restart(void);    
@@ -59,6 +59,8 @@ class EnvelopeElementRecorder: public Recorder
 
     ~EnvelopeElementRecorder();
 
+    const char *getClassType(void) const {return "EnvelopeElementRecorder";}
+
     int record(int commitTag, double timeStamp);
     int restart(void);    
     int flush(void);    
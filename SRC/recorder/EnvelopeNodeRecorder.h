@@ -65,6 +65,9 @@ class EnvelopeNodeRecorder: public Recorder
     
     ~EnvelopeNodeRecorder();
 
+    const char *getClassType(void) const {return "EnvelopeNodeRecorder";}
+    NodeData getDataFlag(void) const {return dataFlag;}
+
     int record(int commitTag, double timeStamp);
     int restart(void);    
     int flush(void);    
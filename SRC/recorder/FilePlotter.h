@@ -48,6 +48,8 @@ class FilePlotter : public Recorder
     
     ~FilePlotter();    
 
+    const char *getClassType(void) const {return "FilePlotter";}
+
     int plotFile();
     int plotFiles();
 
@@ -62,6 +62,8 @@ class GSA_Recorder: public Recorder
 		 double deltaT = 0.0, double relDeltaTTol = 0.00001);
 
     ~GSA_Recorder();
+
+    const char *getClassType(void) const {return "GSA_Recorder";}
     int record(int commitTag, double timeStamp);
     int playback(int commitTag);
     int restart(void);    
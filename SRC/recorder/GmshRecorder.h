@@ -61,6 +61,8 @@ public:
     GmshRecorder();
     ~GmshRecorder();
 
+    const char *getClassType(void) const {return "GmshRecorder";}
+
     int record(int commitTag, double timeStamp);
     int restart();
     int flush();
@@ -68,6 +68,8 @@ private:
 public:
 	MPCORecorder();
 	~MPCORecorder();
+
+	const char *getClassType(void) const {return "MPCORecorder";}
 	int record(int commitTag, double timeStamp);
 	virtual int restart(void);
 	virtual int domainChanged(void);
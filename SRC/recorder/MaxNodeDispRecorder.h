@@ -50,6 +50,8 @@ class MaxNodeDispRecorder: public Recorder
   public:
     MaxNodeDispRecorder(int dof, const ID &theNodes, Domain &theDomain);
     ~MaxNodeDispRecorder();
+
+    const char *getClassType(void) const {return "MaxNodeDispRecorder";}
     int record(int commitTag, double timeStamp);
     int playback(int commitTag);
 
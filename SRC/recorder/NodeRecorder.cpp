@@ -47,6 +47,7 @@
 #include <TCP_Stream.h>
 
 #include <stdlib.h>
+#include <string>
 #include <string.h>
 #include <assert.h>
 #include <math.h>
@@ -892,11 +893,9 @@ NodeRecorder::initialize(void)
   sprintf(nodeCrdData,"coord");
 
   if (echoTimeFlag == true) {
-    if (theNodalTags != 0 && addColumnInfo == 1) {
-      theOutputHandler->tag("TimeOutput");
-      theOutputHandler->tag("ResponseType", "time");
-      theOutputHandler->endTag();
-    }
+    theOutputHandler->tag("TimeOutput");
+    theOutputHandler->tag("ResponseType", "time");
+    theOutputHandler->endTag();
   }
 
   for (int i=0; i<numValidNodes; i++) {
@@ -916,6 +915,15 @@ NodeRecorder::initialize(void)
         theOutputHandler->attr(nodeCrdData, 0.0);      
     }
 
+    // the dofs of the responses that follow, numbered from 1, for the
+    // schema of a columnar file
+    if (theOutputHandler->getClassTag() == OPS_STREAM_TAGS_ColumnarFileStream) {
+      std::string dofs;
+      for (int k=0; k<theDofs->Size(); k++)
+        dofs += (k > 0 ? " " : "") + std::to_string((*theDofs)(k)+1);
+      theOutputHandler->attr("dofs", dofs.c_str());
+    }
+
     for (int k=0; k<theDofs->Size(); k++) {
       sprintf(outputData, "%s%d", dataType, k+1);
       theOutputHandler->tag("ResponseType",outputData);
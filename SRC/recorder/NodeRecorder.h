@@ -64,6 +64,9 @@ class NodeRecorder: public Recorder
     
     ~NodeRecorder();
 
+    const char *getClassType(void) const {return "NodeRecorder";}
+    NodeData getDataFlag(void) const {return dataFlag;}
+
     int record(int commitTag, double timeStamp);
     int flush();
 
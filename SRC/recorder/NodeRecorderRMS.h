@@ -51,6 +51,9 @@ class NodeRecorderRMS: public Recorder
     
     ~NodeRecorderRMS();
 
+    const char *getClassType(void) const {return "NodeRecorderRMS";}
+    NodeData getDataFlag(void) const {return dataFlag;}
+
     int record(int commitTag, double timeStamp);
     int restart(void);    
     int flush(void);    
@@ -64,6 +64,8 @@ class NormElementRecorder: public Recorder
 
     ~NormElementRecorder();
 
+    const char *getClassType(void) const {return "NormElementRecorder";}
+
     int record(int commitTag, double timeStamp);
     int restart(void);    
     int flush(void);    
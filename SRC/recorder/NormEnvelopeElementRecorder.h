@@ -59,6 +59,8 @@ class NormEnvelopeElementRecorder: public Recorder
 
     ~NormEnvelopeElementRecorder();
 
+    const char *getClassType(void) const {return "NormEnvelopeElementRecorder";}
+
     int record(int commitTag, double timeStamp);
     int restart(void);    
     int flush(void);    
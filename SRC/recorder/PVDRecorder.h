@@ -58,6 +58,8 @@ public:
     PVDRecorder();
     ~PVDRecorder();
 
+    const char *getClassType(void) const {return "PVDRecorder";}
+
     int record(int commitTag, double timeStamp);
     int restart();
     int flush();
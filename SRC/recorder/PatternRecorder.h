@@ -53,6 +53,8 @@ class PatternRecorder: public Recorder
 		 int startFlag = 0); 
 
     ~PatternRecorder();
+
+    const char *getClassType(void) const {return "PatternRecorder";}
     int record(int commitTag, double timeStamp);
     int playback(int commitTag);
     int restart(void);    
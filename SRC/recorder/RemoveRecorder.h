@@ -82,6 +82,8 @@ class RemoveRecorder: public Recorder
 		  const char *thefileNameinf =0);
    
    ~RemoveRecorder();
+
+   const char *getClassType(void) const {return "RemoveRecorder";}
    int record(int commitTag, double timeStamp);
    int playback(int commitTag);
    
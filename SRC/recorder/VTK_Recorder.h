@@ -72,6 +72,8 @@ public:
 	       const std::vector<EleData>& edata, int ind=2, int pre=10, double dt=0, double rTolDt=0.00001);
   VTK_Recorder();
   ~VTK_Recorder();
+
+  const char *getClassType(void) const {return "VTK_Recorder";}
   
   int record(int commitTag, double timeStamp);
   int restart();
@@ -17,6 +17,8 @@ class YsVisual : public Recorder
 public:
 	virtual ~YsVisual();
 
+	const char *getClassType(void) const {return "YsVisual";}
+
 	YsVisual(Element* theEle, const char *title, double scale,
 	         int xLoc, int yLoc, int width, int height);
 	
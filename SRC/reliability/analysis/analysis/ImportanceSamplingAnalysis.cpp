@@ -38,6 +38,8 @@
 #include <ProbabilityTransformation.h>
 #include <FunctionEvaluator.h>
 #include <RandomNumberGenerator.h>
+#include <PhiloxRandGenerator.h>
+#include <SampleWorkers.h>
 #include <RandomVariable.h>
 #include <NormalRV.h>
 #include <Vector.h>
@@ -80,6 +82,7 @@ theOpenSeesDomain(passedOpenSeesDomain)
 	printFlag = passedPrintFlag;
 	strcpy(fileName,passedFileName);
 	analysisTypeTag = passedAnalysisTypeTag;
+	numWorkers = 1;
 }
 
 
@@ -92,6 +95,14 @@ ImportanceSamplingAnalysis::~ImportanceSamplingAnalysis()
 
 
 
+void
+ImportanceSamplingAnalysis::setNumWorkers(int passedNumWorkers)
+{
+	numWorkers = passedNumWorkers > 1 ? passedNumWorkers : 1;
+}
+
+
+
 int 
 ImportanceSamplingAnalysis::analyze(void)
 {
@@ -213,23 +224,34 @@ ImportanceSamplingAnalysis::analyze(void)
 	ofstream resultsOutputFile( fileName, ios::out );
 
 
-	bool isFirstSimulation = true;
-	while( ( k <= numberOfSimulations && govCov > targetCOV || k <= 2 ) ) {
+	// A counter-based generator gives every sample its own stream, so the
+	// samples can be evaluated by several workers and still reproduce the
+	// serial results; any other generator has to be advanced in order.
+	PhiloxRandGenerator *theStreamGenerator = dynamic_cast<PhiloxRandGenerator *>(theRandomNumberGenerator);
+	int workers = numWorkers;
+	if (workers > 1 && theStreamGenerator == 0) {
+		opserr << "WARNING ImportanceSamplingAnalysis::analyze() - the samples can only be" << endln
+			<< " run in parallel with a counter-based random number generator; running serially." << endln;
+		workers = 1;
+	}
 
-		// Keep the user posted
-		if (printFlag == 1 || printFlag == 2) {
-            sprintf(myString,"%li",k);
-			opserr << "Sample #" << myString << ":" << endln;
-		}
 
-		
+	// Evaluate the limit-state functions at sample k; the record holds
+	// the g-function values followed by the ratio phi/h at the u-point
+	bool isFirstSimulation = true;
+	auto evaluate = [&](long int k, double *record) -> int {
+
 		// Create array of standard normal random numbers
+		if (theStreamGenerator != 0) {
+			theStreamGenerator->setSample(k);
+		}
 		if (isFirstSimulation) {
 			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
 		}
 		else {
 			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
 		}
+		isFirstSimulation = false;
 		seed = theRandomNumberGenerator->getSeed();
 		if (result < 0) {
 			opserr << "ImportanceSamplingAnalysis::analyze() - could not generate" << endln
@@ -252,7 +274,6 @@ ImportanceSamplingAnalysis::analyze(void)
         
         // update domain with new x values
         for (int j = 0; j < numRV; j++) {
-            RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtrFromIndex(j);
             int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
             Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
             
@@ -277,26 +298,59 @@ ImportanceSamplingAnalysis::analyze(void)
 			FEconvergence = false;
 		}
 
-
-		LimitStateFunctionIter &lsfIter = theReliabilityDomain->getLimitStateFunctions();
-		LimitStateFunction *theLimitStateFunction;
 		// Loop over number of limit-state functions
 		for (int lsf = 0; lsf < numLsf; lsf++ ) {
-		//while ((theLimitStateFunction = lsfIter()) != 0) {
-            theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
-            int lsfTag = theLimitStateFunction->getTag();
+            LimitStateFunction *theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
 
 			// Set tag of "active" limit-state function
-			theReliabilityDomain->setTagOfActiveLimitStateFunction(lsfTag);
+			theReliabilityDomain->setTagOfActiveLimitStateFunction(theLimitStateFunction->getTag());
 
             // set and evaluate LSF
             const char *lsfExpression = theLimitStateFunction->getExpression();
             theGFunEvaluator->setExpression(lsfExpression);
             
-            gFunctionValue = theGFunEvaluator->evaluateExpression();
+            record[lsf] = theGFunEvaluator->evaluateExpression();
             if (!FEconvergence) {
-				gFunctionValue = -1.0;
+				record[lsf] = -1.0;
 			}
+		}
+
+		// Compute values of joint distributions at the u-point
+		phi = factor1 * exp( -0.5 * (u ^ u) );
+		//temp1 = inv_covariance ^ (u-startPointY);
+		//temp2 = temp1 ^ (u-startPointY);
+		temp2 = 0.0;
+		for (int i = 0; i < numRV; i++) {
+		  double uy = u(i)-startPointY(i);
+		  temp2 += uy*uy;
+		}
+		temp2 /= samplingStdv*samplingStdv;
+		h   = factor2 * exp( -0.5 * temp2 );
+		record[numLsf] = phi / h;
+
+		return 0;
+	};
+
+
+	// Fold the record of sample k into the statistics, in sample order
+	bool simulationFailed = false;
+	auto reduce = [&](long int sample, int status, const double *record) -> bool {
+
+		if (status < 0) {
+			simulationFailed = true;
+			return true;
+		}
+		k = sample;
+
+		// Keep the user posted
+		if (printFlag == 1 || printFlag == 2) {
+            sprintf(myString,"%li",k);
+			opserr << "Sample #" << myString << ":" << endln;
+		}
+
+		for (int lsf = 0; lsf < numLsf; lsf++ ) {
+            int lsfTag = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf)->getTag();
+			gFunctionValue = record[lsf];
 
 			
 			// ESTIMATION OF FAILURE PROBABILITY
@@ -312,21 +366,8 @@ ImportanceSamplingAnalysis::analyze(void)
 				}
 
 
-				// Compute values of joint distributions at the u-point
-				phi = factor1 * exp( -0.5 * (u ^ u) );
-				//temp1 = inv_covariance ^ (u-startPointY);
-				//temp2 = temp1 ^ (u-startPointY);
-				temp2 = 0.0;
-				for (int i = 0; i < numRV; i++) {
-				  double uy = u(i)-startPointY(i);
-				  temp2 += uy*uy;
-				}
-				temp2 /= samplingStdv*samplingStdv;
-				h   = factor2 * exp( -0.5 * temp2 );
-
-
 				// Update sums
-				q = I * phi / h;
+				q = I * record[numLsf];
 				sum_q(lsf) = sum_q(lsf) + q;
 				sum_q_squared(lsf) = sum_q_squared(lsf) + q*q;
 
@@ -465,14 +506,15 @@ ImportanceSamplingAnalysis::analyze(void)
 			outputFile.close();
 		}
 
-		// Increment k (the simulation number counter)
-		k++;
-		isFirstSimulation = false;
+		// Stop once the target coefficient of variation is reached
+		return !( (k+1) <= numberOfSimulations && govCov > targetCOV || (k+1) <= 2 );
+	};
 
+	SampleWorkers theWorkers(workers, numLsf+1);
+	k = theWorkers.run(k, numberOfSimulations > 2 ? numberOfSimulations : 2, evaluate, reduce);
+	if (k < 0 || simulationFailed) {
+		return -1;
 	}
-
-	// Step 'k' back a step now that we went out
-	k--;
 	opserr << endln;
 
 
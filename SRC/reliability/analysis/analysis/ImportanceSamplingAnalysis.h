@@ -65,6 +65,10 @@ public:
 	
 	int analyze(void);
 
+	// number of worker processes evaluating the samples; more than one
+	// requires a PhiloxRandGenerator so the results match a serial run
+	void setNumWorkers(int numWorkers);
+
 protected:
 	
 private:
@@ -80,6 +84,7 @@ private:
 	int printFlag;
 	char fileName[256];
 	int analysisTypeTag;
+	int numWorkers;
 };
 
 #endif
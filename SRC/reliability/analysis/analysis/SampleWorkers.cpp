@@ -0,0 +1,211 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <SampleWorkers.h>
+#include <OPS_Globals.h>
+#include <RecordWriter.h>
+#include <threads/global_pool.hpp>
+#include <algorithm>
+#include <map>
+#include <vector>
+#include <stdio.h>
+
+#if !defined(_WIN32)
+#  include <errno.h>
+#  include <poll.h>
+#  include <signal.h>
+#  include <sys/types.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+
+// a record is sent as [sample, status, values...]
+static bool
+writeRecord(int fd, const std::vector<double> &record)
+{
+  const char *data = reinterpret_cast<const char *>(record.data());
+  std::size_t left = record.size()*sizeof(double);
+  while (left > 0) {
+    const ssize_t n = write(fd, data, left);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    data += n;
+    left -= n;
+  }
+  return true;
+}
+
+// returns false at the end of the stream
+static bool
+readRecord(int fd, std::vector<double> &record)
+{
+  char *data = reinterpret_cast<char *>(record.data());
+  std::size_t left = record.size()*sizeof(double);
+  while (left > 0) {
+    const ssize_t n = read(fd, data, left);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    data += n;
+    left -= n;
+  }
+  return true;
+}
+#endif
+
+
+SampleWorkers::SampleWorkers(int numWorkers, int recordSize)
+:numWorkers(numWorkers), recordSize(recordSize)
+{
+
+}
+
+
+long
+SampleWorkers::runSerial(long first, long last, const Evaluate &evaluate, const Reduce &reduce)
+{
+  std::vector<double> record(std::max(recordSize, 1));
+  for (long k=first; k<=last; k++) {
+    const int status = evaluate(k, record.data());
+    if (reduce(k, status, record.data()))
+      return k;
+  }
+  return last;
+}
+
+
+long
+SampleWorkers::run(long first, long last, const Evaluate &evaluate, const Reduce &reduce)
+{
+#if defined(_WIN32)
+  return this->runSerial(first, last, evaluate, reduce);
+#else
+  const int n = static_cast<int>(std::min<long>(numWorkers, last - first + 1));
+  if (n <= 1)
+    return this->runSerial(first, last, evaluate, reduce);
+
+  // anything still buffered would otherwise be written by every worker
+  OpenSees::RecordWriter::beforeFork();
+  opserr.flush();
+  fflush(nullptr);
+
+  std::vector<pid_t> pids;
+  std::vector<int>   fds;
+  for (int w=0; w<n; w++) {
+    int fd[2];
+    if (pipe(fd) < 0)
+      break;
+
+    const pid_t pid = fork();
+    if (pid == 0) {
+      close(fd[0]);
+      for (int other : fds)
+        close(other);
+
+      // none of the threads of this process were copied into the worker;
+      // it runs its analyses on a pool of a single thread
+      OpenSees::restart_thread_pool_after_fork(1);
+      OpenSees::RecordWriter::afterForkChild();
+
+      std::vector<double> record(2 + recordSize);
+      for (long k=first+w; k<=last; k+=n) {
+        const int status = evaluate(k, &record[2]);
+        record[0] = static_cast<double>(k);
+        record[1] = static_cast<double>(status);
+        if (!writeRecord(fd[1], record))
+          break;
+      }
+      close(fd[1]);
+      _exit(0);
+    }
+
+    close(fd[1]);
+    if (pid < 0) {
+      close(fd[0]);
+      break;
+    }
+    pids.push_back(pid);
+    fds.push_back(fd[0]);
+  }
+
+  auto stopWorkers = [&]() {
+    for (int fd : fds)
+      close(fd);
+    for (pid_t pid : pids) {
+      kill(pid, SIGKILL);
+      waitpid(pid, nullptr, 0);
+    }
+  };
+
+  // every worker has to start, since each owns a share of the samples
+  if (static_cast<int>(pids.size()) < n) {
+    opserr << "WARNING SampleWorkers::run() - could only start " << static_cast<int>(pids.size())
+           << " of " << n << " workers; running the samples serially\n";
+    stopWorkers();
+    return this->runSerial(first, last, evaluate, reduce);
+  }
+
+  std::vector<struct pollfd> polls(n);
+  for (int w=0; w<n; w++) {
+    polls[w].fd = fds[w];
+    polls[w].events = POLLIN;
+  }
+
+  std::map<long, std::vector<double>> pending;
+  std::vector<double> record(2 + recordSize);
+  long next = first;
+  int numOpen = n;
+  bool done = false;
+  bool failed = false;
+
+  while (!done && next <= last) {
+    if (poll(polls.data(), polls.size(), -1) < 0) {
+      if (errno == EINTR)
+        continue;
+      failed = true;
+      break;
+    }
+
+    for (struct pollfd &p : polls) {
+      if (p.fd < 0 || p.revents == 0)
+        continue;
+      if (readRecord(p.fd, record))
+        pending.emplace(static_cast<long>(record[0]), record);
+      else {
+        // the worker is finished; poll() skips negative descriptors
+        p.fd = -p.fd - 1;
+        numOpen--;
+      }
+    }
+
+    // reduce in sample order whatever is ready
+    for (auto ready = pending.find(next); ready != pending.end(); ready = pending.find(next)) {
+      const std::vector<double> &values = ready->second;
+      done = reduce(next, static_cast<int>(values[1]), &values[2]);
+      pending.erase(ready);
+      if (done)
+        break;
+      next++;
+    }
+
+    if (!done && next <= last && numOpen == 0) {
+      opserr << "WARNING SampleWorkers::run() - a worker stopped before sample " << next << "\n";
+      failed = true;
+      break;
+    }
+  }
+
+  stopWorkers();
+
+  if (failed)
+    return -1;
+  return done ? next : last;
+#endif
+}
@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SampleWorkers runs the realizations of a sampling analysis
+// on several worker processes. Each worker is a fork() of the calling
+// process, and so starts with its own copy of the Domain, the
+// ReliabilityDomain and the interpreter, in the state they had when
+// run() was called; nothing has to be sent to set it up. Worker w
+// evaluates samples first+w, first+w+n, ... and pipes a fixed-size record
+// back for each one.
+//
+// The records are reduced by the calling process strictly in sample
+// order, so as long as evaluating a sample depends on nothing but its
+// number (e.g., its random numbers come from a PhiloxRandGenerator
+// stream), the results do not depend on the number of workers and match
+// those of a serial run. Samples that finish ahead of the reduction wait
+// in memory; once the reduction asks to stop, the workers are stopped
+// and their remaining results discarded.
+//
+// Threads are not copied by fork(), so before forking the recorder
+// writer is drained, and each worker starts its own writer and a thread
+// pool of one thread. Other threads of the caller that may be writing
+// (e.g., a checkpoint) must be finished before run() is called.
+//
+// With one worker, or where fork() is not available, the samples are
+// evaluated in turn by the calling process.
+//
+// Written: cmp
+//
+#ifndef SampleWorkers_h
+#define SampleWorkers_h
+
+#include <functional>
+
+class SampleWorkers
+{
+  public:
+    // fills the record of a sample; a negative return marks the sample
+    // as failed, which is passed on to the reduction
+    typedef std::function<int (long sample, double *record)> Evaluate;
+
+    // folds the record of a sample into the results; returns true when
+    // no more samples are needed
+    typedef std::function<bool (long sample, int status, const double *record)> Reduce;
+
+    SampleWorkers(int numWorkers, int recordSize);
+
+    // evaluates samples first, first+1, ..., last and returns the
+    // number of the last one reduced, or -1 if the workers failed
+    long run(long first, long last, const Evaluate &evaluate, const Reduce &reduce);
+
+  private:
+    long runSerial(long first, long last, const Evaluate &evaluate, const Reduce &reduce);
+
+    int numWorkers;
+    int recordSize;
+};
+
+#endif
@@ -0,0 +1,176 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <PhiloxRandGenerator.h>
+#include <math.h>
+#include <time.h>
+#include <stdint.h>
+
+namespace {
+
+// one block of the Philox4x32-10 bijection
+void
+philox(uint32_t ctr[4], uint32_t key0, uint32_t key1)
+{
+  constexpr uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+  constexpr uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+
+  for (int round=0; round<10; round++) {
+    const uint64_t p0 = uint64_t(M0)*ctr[0];
+    const uint64_t p1 = uint64_t(M1)*ctr[2];
+    const uint32_t c0 = uint32_t(p1 >> 32) ^ ctr[1] ^ key0;
+    const uint32_t c2 = uint32_t(p0 >> 32) ^ ctr[3] ^ key1;
+    ctr[1] = uint32_t(p1);
+    ctr[3] = uint32_t(p0);
+    ctr[0] = c0;
+    ctr[2] = c2;
+    key0 += W0;
+    key1 += W1;
+  }
+}
+
+// two doubles in (0,1) from block j of the stream of a sample
+void
+block(int seed, long sample, uint32_t j, double &u0, double &u1)
+{
+  const uint64_t s = uint64_t(sample);
+  uint32_t ctr[4] = {j, 0, uint32_t(s), uint32_t(s >> 32)};
+  philox(ctr, uint32_t(seed), 0x5EED5EED);
+
+  // 53 random bits each, offset by half a step so neither 0 nor 1 occurs
+  constexpr double step = 1.0/9007199254740992.0;
+  u0 = ((ctr[0] >> 5)*67108864.0 + (ctr[1] >> 6) + 0.5)*step;
+  u1 = ((ctr[2] >> 5)*67108864.0 + (ctr[3] >> 6) + 0.5)*step;
+}
+
+} // namespace
+
+
+PhiloxRandGenerator::PhiloxRandGenerator(int passedSeed)
+:RandomNumberGenerator(), generatedNumbers(1), seed(0), sample(0)
+{
+  this->setSeed(passedSeed);
+}
+
+
+PhiloxRandGenerator::~PhiloxRandGenerator()
+{
+
+}
+
+
+void
+PhiloxRandGenerator::uniforms(int seed, long sample, int n, double *u)
+{
+  for (int i=0; i<n; i+=2) {
+    double u0, u1;
+    block(seed, sample, uint32_t(i/2), u0, u1);
+    u[i] = u0;
+    if (i+1 < n)
+      u[i+1] = u1;
+  }
+}
+
+
+void
+PhiloxRandGenerator::normals(int seed, long sample, int n, double *z)
+{
+  // Box-Muller transform of each pair of uniforms
+  const double twopi = 2.0*acos(-1.0);
+  for (int i=0; i<n; i+=2) {
+    double u0, u1;
+    block(seed, sample, uint32_t(i/2), u0, u1);
+    const double r = sqrt(-2.0*log(u0));
+    z[i] = r*cos(twopi*u1);
+    if (i+1 < n)
+      z[i+1] = r*sin(twopi*u1);
+  }
+}
+
+
+int
+PhiloxRandGenerator::generate_nIndependentUniformNumbers(int n, double lower, double upper, int seedIn)
+{
+  if (seedIn != 0)
+    this->setSeed(seedIn);
+
+  if (generatedNumbers.Size() != n)
+    generatedNumbers.resize(n);
+
+  double *u = &generatedNumbers(0);
+  uniforms(seed, sample++, n, u);
+  for (int i=0; i<n; i++)
+    u[i] = lower + (upper - lower)*u[i];
+
+  return 0;
+}
+
+
+int
+PhiloxRandGenerator::generate_nIndependentStdNormalNumbers(int n, int seedIn)
+{
+  if (seedIn != 0)
+    this->setSeed(seedIn);
+
+  if (generatedNumbers.Size() != n)
+    generatedNumbers.resize(n);
+
+  normals(seed, sample++, n, &generatedNumbers(0));
+  return 0;
+}
+
+
+const Vector &
+PhiloxRandGenerator::getGeneratedNumbers()
+{
+  return generatedNumbers;
+}
+
+
+int
+PhiloxRandGenerator::getSeed()
+{
+  return seed;
+}
+
+
+void
+PhiloxRandGenerator::setSeed(int passedSeed)
+{
+  seed = passedSeed != 0 ? passedSeed : int(time(NULL));
+}
+
+
+void
+PhiloxRandGenerator::setSample(long passedSample)
+{
+  sample = passedSample;
+}
+
+
+long
+PhiloxRandGenerator::getSample() const
+{
+  return sample;
+}
+
+
+double
+PhiloxRandGenerator::generate_singleUniformNumber(double lower, double upper)
+{
+  generate_nIndependentUniformNumbers(1, lower, upper);
+  return generatedNumbers(0);
+}
+
+
+double
+PhiloxRandGenerator::generate_singleStdNormalNumber()
+{
+  generate_nIndependentStdNormalNumbers(1);
+  return generatedNumbers(0);
+}
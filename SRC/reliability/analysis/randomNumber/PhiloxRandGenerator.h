@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: PhiloxRandGenerator is a counter-based random number
+// generator (Philox4x32-10, Salmon et al., SC'11). The numbers are a
+// function of the seed, the number of the sample they belong to and
+// their position within it, not of a hidden state that has to be
+// advanced in order. Every sample of a simulation thus has its own
+// stream, which can be formed by any worker in any order and still give
+// the same realization as a serial run.
+//
+// Each generate_n...() call takes the stream of the current sample and
+// moves on to the next, so a serial simulation that never calls
+// setSample() draws samples 0, 1, 2, ... in turn.
+//
+// Written: cmp
+//
+#ifndef PhiloxRandGenerator_h
+#define PhiloxRandGenerator_h
+
+#include <RandomNumberGenerator.h>
+#include <Vector.h>
+
+class PhiloxRandGenerator : public RandomNumberGenerator
+{
+  public:
+    PhiloxRandGenerator(int seed = 0);
+    ~PhiloxRandGenerator();
+
+    int     generate_nIndependentStdNormalNumbers(int n, int seed=0);
+    int     generate_nIndependentUniformNumbers(int n, double lower, double upper, int seed=0);
+    const   Vector &getGeneratedNumbers();
+    int     getSeed();
+
+    double  generate_singleStdNormalNumber();
+    double  generate_singleUniformNumber(double lower=0.0, double upper=1.0);
+    void    setSeed(int passedSeed=0);
+
+    // the sample whose stream the next generate_n...() call returns
+    void    setSample(long sample);
+    long    getSample() const;
+
+    // the first n numbers of the stream of a sample; these have no state
+    // and may be called from several threads at once
+    static void uniforms(int seed, long sample, int n, double *u);
+    static void normals(int seed, long sample, int n, double *z);
+
+  private:
+    Vector generatedNumbers;
+    int    seed;
+    long   sample;
+};
+
+#endif
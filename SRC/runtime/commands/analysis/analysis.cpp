@@ -68,6 +68,7 @@ G3_AddTclAnalysisAPI(Tcl_Interp *interp, Domain* domain)
   Tcl_CreateCommand(interp, "_clearAnalysis", &TclCommand_clearAnalysis, builder, nullptr);
 
   Tcl_CreateCommand(interp, "numberer",   TclCommand_setNumberer, builder, nullptr);
+  G3_AddTclSnapshotCommand(interp, builder);
 
 
   static int ncmd = sizeof(tcl_analysis_cmds)/sizeof(char_cmd);
@@ -347,7 +348,11 @@ static int
 modalProperties(ClientData clientData, Tcl_Interp *interp, int argc,
                 TCL_Char ** const argv)
 {
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
   G3_Runtime *rt = G3_getRuntime(interp);
+  // the modal commands find the model through the runtime
+  *G3_getAnalysisModelPtr(rt) = builder->getAnalysisModel();
   OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, nullptr);
   OPS_DomainModalProperties(rt);
   return TCL_OK;
@@ -357,9 +362,13 @@ static int
 responseSpectrum(ClientData clientData, Tcl_Interp *interp, int argc,
                  TCL_Char ** const argv)
 {
+  assert(clientData != nullptr);
+  BasicAnalysisBuilder *builder = (BasicAnalysisBuilder*)clientData;
   OPS_ResetInputNoBuilder(clientData, interp, 1, argc, argv, nullptr);
   G3_Runtime *rt = G3_getRuntime(interp);
-  OPS_ResponseSpectrumAnalysis(rt);
+  *G3_getAnalysisModelPtr(rt) = builder->getAnalysisModel();
+  if (OPS_ResponseSpectrumAnalysis(rt) < 0)
+    return TCL_ERROR;
   return TCL_OK;
 }
 
@@ -525,6 +534,10 @@ printA(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const ar
   FullGenLinLapackSolver *theSolver = new FullGenLinLapackSolver();
   FullGenLinSOE theSOE(*theSolver);
 
+  // assemble on as many threads as the analysis does
+  if (oldSOE != nullptr)
+    theSOE.setNumThreads(oldSOE->getNumThreads());
+
   builder->set(&theSOE, false);
   // invoke domainChange which constructs a graph and passes
   // it to the SOE. Otherwise, getA() returns null
@@ -735,6 +748,9 @@ TclCommand_clearAnalysis(ClientData cd, Tcl_Interp *interp, int argc, TCL_Char *
     static int ncmd = sizeof(tcl_analysis_cmds)/sizeof(char_cmd);
     for (int i = 0; i < ncmd; ++i)
       Tcl_DeleteCommand(interp, tcl_analysis_cmds[i].name);
+    Tcl_DeleteCommand(interp, "checkpoint");
+    Tcl_DeleteCommand(interp, "restart");
+    Tcl_DeleteCommand(interp, "snapshot");
 
     Tcl_CreateCommand(interp, "wipeAnalysis",  &wipeAnalysis, nullptr, nullptr);
     Tcl_CreateCommand(interp, "_clearAnalysis", &TclCommand_clearAnalysis, nullptr, nullptr);
@@ -30,6 +30,7 @@ extern Tcl_CmdProc specifyIntegrator;
 extern Tcl_CmdProc specifySOE;
 extern Tcl_CmdProc specifySysOfEqnTable;
 extern Tcl_CmdProc TclCommand_systemSize;
+extern Tcl_CmdProc TclCommand_systemTimes;
 
 // commands/analysis/algorithm.cpp
 extern Tcl_CmdProc TclCommand_specifyAlgorithm;
@@ -49,12 +50,17 @@ extern Tcl_CmdProc TclCommand_algorithmRecorder;
 extern Tcl_CmdProc TclCommand_sensitivityAlgorithm;
 extern Tcl_CmdProc TclCommand_sensLambda;
 
+// from commands/analysis/snapshot.cpp
+class BasicAnalysisBuilder;
+extern int G3_AddTclSnapshotCommand(Tcl_Interp *, BasicAnalysisBuilder *);
+
 struct char_cmd {
   const char* name;
   Tcl_CmdProc*  func;
 }  const tcl_analysis_cmds[] =  {
     {"system",              &specifySysOfEqnTable},
     {"systemSize",          &TclCommand_systemSize},
+    {"systemTimes",         &TclCommand_systemTimes},
 
     {"test",                &specifyCTest},
     {"testIter",            &getCTestIter},
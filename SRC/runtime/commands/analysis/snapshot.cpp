@@ -0,0 +1,412 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file implements the snapshot command, which keeps the
+// committed state of the model in memory so that many analyses can start
+// from it without building the model again:
+//
+//    snapshot save    $name
+//    snapshot restore $name
+//    snapshot remove  $name
+//    snapshot size    $name
+//
+// Snapshots are shared by the interpreters of a process. Restoring a
+// snapshot into the objects it was saved from, while the Domain holds just
+// those objects, receives the state into them; state that was not formed
+// at the save, e.g. nodal velocities, is zeroed. Otherwise the Domain is
+// cleared (recorders included) and its objects are made again from the
+// snapshot, which removes objects added since the save and gives each
+// interpreter its own copy of a model built once; later snapshots of that
+// copy restore into it in place.
+//
+// The checkpoint and restart commands keep the committed state in a file
+// instead, so that a long run can be resumed in another process:
+//
+//    checkpoint $file <-every $seconds>
+//    restart    $file
+//
+// checkpoint is called between steps of the analysis. It saves the state
+// as a snapshot does and writes it on another thread while the analysis
+// goes on; with -every it does nothing, and returns 0, until that many
+// seconds have passed since the last checkpoint. restart makes the objects
+// of the Domain again from the file. The analysis is defined again by the
+// script after restart; the integrator takes its state from the restored
+// nodes, and solvers and algorithms keep no state between steps.
+//
+// Written: cmp
+//
+#include <tcl.h>
+#include <Parsing.h>
+#include <assert.h>
+#include <string.h>
+#include <map>
+#include <mutex>
+#include <set>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <G3_Logging.h>
+#include <BasicAnalysisBuilder.h>
+#include <TclPackageClassBroker.h>
+#include <MemoryDatastore.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <SP_Constraint.h>
+#include <SP_ConstraintIter.h>
+#include <MP_Constraint.h>
+#include <MP_ConstraintIter.h>
+#include <Pressure_Constraint.h>
+#include <Pressure_ConstraintIter.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <NodalLoad.h>
+#include <NodalLoadIter.h>
+#include <ElementalLoad.h>
+#include <ElementalLoadIter.h>
+#include <Parameter.h>
+#include <ParameterIter.h>
+
+namespace {
+
+struct Snapshot {
+  MemoryDatastore::Handle records;
+  int objects;      // the objects it was saved from
+  int geoTag;       // the domain stamp when it was saved
+  std::vector<int> layout;
+};
+
+struct Snapshots {
+  std::mutex mutex;
+  std::map<std::string, Snapshot> named;
+};
+
+Snapshots &
+snapshots()
+{
+  static Snapshots theSnapshots;
+  return theSnapshots;
+}
+
+// the number and tags of the objects in iter
+template <typename Iter>
+void
+appendTags(std::vector<int> &layout, Iter &iter)
+{
+  const std::size_t start = layout.size();
+  layout.push_back(0);
+  for (auto *object = iter(); object != nullptr; object = iter())
+    layout.push_back(object->getTag());
+  layout[start] = static_cast<int>(layout.size() - start - 1);
+}
+
+// The tags of the objects of the Domain. Loads and load patterns do not
+// change the domain stamp, so this tells whether the objects are those a
+// snapshot was saved from.
+std::vector<int>
+getLayout(Domain &domain)
+{
+  std::vector<int> layout;
+  appendTags(layout, domain.getNodes());
+  appendTags(layout, domain.getElements());
+  appendTags(layout, domain.getSPs());
+  appendTags(layout, domain.getPCs());
+  appendTags(layout, domain.getMPs());
+  appendTags(layout, domain.getParameters());
+
+  LoadPatternIter &thePatterns = domain.getLoadPatterns();
+  std::vector<LoadPattern *> patterns;
+  for (LoadPattern *pattern = thePatterns(); pattern != nullptr; pattern = thePatterns())
+    patterns.push_back(pattern);
+
+  layout.push_back(static_cast<int>(patterns.size()));
+  for (LoadPattern *pattern : patterns) {
+    layout.push_back(pattern->getTag());
+    appendTags(layout, pattern->getNodalLoads());
+    appendTags(layout, pattern->getElementalLoads());
+    appendTags(layout, pattern->getSPs());
+  }
+  return layout;
+}
+
+// identifies objects made by an interpreter, or made again from them
+int
+newObjects()
+{
+  static std::atomic<int> lastObjects(0);
+  return ++lastObjects;
+}
+
+struct SnapshotStore;
+
+// the stores of all interpreters, so their checkpoints can be finished
+std::mutex                   storesMutex;
+std::set<SnapshotStore *>    stores;
+
+// the datastore of an interpreter, kept as long as its analysis commands
+struct SnapshotStore {
+  SnapshotStore(BasicAnalysisBuilder *builder)
+  : builder(builder), datastore(*builder->getDomain(), broker), objects(newObjects())
+  {
+    std::lock_guard<std::mutex> lock(storesMutex);
+    stores.insert(this);
+  }
+
+  ~SnapshotStore()
+  {
+    {
+      std::lock_guard<std::mutex> lock(storesMutex);
+      stores.erase(this);
+    }
+    if (writer.joinable())
+      writer.join();
+  }
+
+  BasicAnalysisBuilder *builder;
+  TclPackageClassBroker broker;
+  MemoryDatastore       datastore;
+  int                   objects;   // where the objects of the Domain came from
+
+  std::thread           writer;    // writes the last checkpoint
+  std::chrono::steady_clock::time_point lastCheckpoint;
+};
+
+// all snapshots are committed under the same tag; each holds its own records
+constexpr int snapshotCommitTag = 0;
+
+} // namespace
+
+
+// Make records the state of the Domain; in place when they were saved
+// from its objects as they are now
+static int
+restoreRecords(SnapshotStore *store, const MemoryDatastore::Handle &records,
+               int objects, bool inPlace)
+{
+  Domain *domain = store->builder->getDomain();
+
+  // the analysis model refers to the objects that are replaced, and
+  // a cleared Domain makes all of its objects again
+  if (!inPlace) {
+    store->builder->clearModel();
+    domain->clearAll();
+    store->objects = objects;
+  }
+
+  store->datastore.assign(records);
+  if (store->datastore.restoreState(snapshotCommitTag) < 0)
+    return -1;
+
+  if (inPlace && store->builder->domainStateRestored() < 0) {
+    opserr << G3_ERROR_PROMPT << "integrator failed to read the restored state\n";
+    return -1;
+  }
+  return 0;
+}
+
+
+static int
+TclCommand_snapshot(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  SnapshotStore *store = (SnapshotStore *)clientData;
+  MemoryDatastore &datastore = store->datastore;
+  Domain *domain = store->builder->getDomain();
+
+  if (argc < 3) {
+    opserr << G3_ERROR_PROMPT << "want snapshot save|restore|remove|size $name\n";
+    return TCL_ERROR;
+  }
+
+  const std::string name(argv[2]);
+  Snapshots &theSnapshots = snapshots();
+
+  if (strcmp(argv[1], "save") == 0) {
+    if (datastore.commitState(snapshotCommitTag) < 0) {
+      opserr << G3_ERROR_PROMPT << "failed to save the state of the domain\n";
+      return TCL_ERROR;
+    }
+
+    const Snapshot snapshot{datastore.share(), store->objects, domain->hasDomainChanged(),
+                            getLayout(*domain)};
+    std::lock_guard<std::mutex> lock(theSnapshots.mutex);
+    theSnapshots.named[name] = snapshot;
+    return TCL_OK;
+
+  } else if (strcmp(argv[1], "restore") == 0) {
+    Snapshot snapshot;
+    {
+      std::lock_guard<std::mutex> lock(theSnapshots.mutex);
+      auto found = theSnapshots.named.find(name);
+      if (found == theSnapshots.named.end()) {
+        opserr << G3_ERROR_PROMPT << "no snapshot named " << name.c_str() << "\n";
+        return TCL_ERROR;
+      }
+      snapshot = found->second;
+    }
+
+    // objects added or removed since the save are undone by making
+    // the Domain again
+    const bool inPlace = snapshot.objects == store->objects
+                      && snapshot.geoTag  == domain->hasDomainChanged()
+                      && snapshot.layout  == getLayout(*domain);
+
+    if (restoreRecords(store, snapshot.records, snapshot.objects, inPlace) < 0) {
+      opserr << G3_ERROR_PROMPT << "failed to restore snapshot " << name.c_str() << "\n";
+      return TCL_ERROR;
+    }
+    return TCL_OK;
+
+  } else if (strcmp(argv[1], "remove") == 0) {
+    std::lock_guard<std::mutex> lock(theSnapshots.mutex);
+    theSnapshots.named.erase(name);
+    return TCL_OK;
+
+  } else if (strcmp(argv[1], "size") == 0) {
+    MemoryDatastore::Handle records;
+    {
+      std::lock_guard<std::mutex> lock(theSnapshots.mutex);
+      auto found = theSnapshots.named.find(name);
+      if (found == theSnapshots.named.end()) {
+        opserr << G3_ERROR_PROMPT << "no snapshot named " << name.c_str() << "\n";
+        return TCL_ERROR;
+      }
+      records = found->second.records;
+    }
+    const std::size_t numBytes = MemoryDatastore::getNumBytes(records);
+    Tcl_SetObjResult(interp, Tcl_NewWideIntObj(static_cast<Tcl_WideInt>(numBytes)));
+    return TCL_OK;
+  }
+
+  opserr << G3_ERROR_PROMPT << "unknown snapshot option " << argv[1]
+         << ", want save, restore, remove or size\n";
+  return TCL_ERROR;
+}
+
+
+static int
+TclCommand_checkpoint(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  SnapshotStore *store = (SnapshotStore *)clientData;
+
+  if (argc != 2 && argc != 4) {
+    opserr << G3_ERROR_PROMPT << "want checkpoint $file <-every $seconds>\n";
+    return TCL_ERROR;
+  }
+
+  double every = 0.0;
+  if (argc == 4) {
+    if (strcmp(argv[2], "-every") != 0) {
+      opserr << G3_ERROR_PROMPT << "unknown checkpoint option " << argv[2] << ", want -every\n";
+      return TCL_ERROR;
+    }
+    if (Tcl_GetDouble(interp, argv[3], &every) != TCL_OK || every < 0.0) {
+      opserr << G3_ERROR_PROMPT << "invalid checkpoint interval " << argv[3] << "\n";
+      return TCL_ERROR;
+    }
+  }
+
+  const auto now = std::chrono::steady_clock::now();
+  if (store->writer.joinable()
+      && std::chrono::duration<double>(now - store->lastCheckpoint).count() < every) {
+    Tcl_SetObjResult(interp, Tcl_NewIntObj(0));
+    return TCL_OK;
+  }
+
+  // the previous file is finished before its records are let go of
+  if (store->writer.joinable())
+    store->writer.join();
+
+  if (store->datastore.commitState(snapshotCommitTag) < 0) {
+    opserr << G3_ERROR_PROMPT << "failed to save the state of the domain\n";
+    return TCL_ERROR;
+  }
+
+  // the shared records stay as they are while the analysis writes new ones
+  const MemoryDatastore::Handle records = store->datastore.share();
+  const std::string fileName(argv[1]);
+  store->writer = std::thread([records, fileName]() {
+    MemoryDatastore::write(records, fileName.c_str());
+  });
+  store->lastCheckpoint = now;
+
+  Tcl_SetObjResult(interp, Tcl_NewIntObj(1));
+  return TCL_OK;
+}
+
+
+static int
+TclCommand_restart(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  SnapshotStore *store = (SnapshotStore *)clientData;
+
+  if (argc != 2) {
+    opserr << G3_ERROR_PROMPT << "want restart $file\n";
+    return TCL_ERROR;
+  }
+
+  // a checkpoint of this run may still be writing the same file
+  if (store->writer.joinable())
+    store->writer.join();
+
+  const MemoryDatastore::Handle records = MemoryDatastore::read(argv[1]);
+  if (records == nullptr)
+    return TCL_ERROR;
+
+  if (restoreRecords(store, records, newObjects(), false) < 0) {
+    opserr << G3_ERROR_PROMPT << "failed to restart from " << argv[1] << "\n";
+    return TCL_ERROR;
+  }
+  return TCL_OK;
+}
+
+
+// a checkpoint still being written when the process exits is finished
+static void
+finishCheckpoint(ClientData clientData)
+{
+  SnapshotStore *store = (SnapshotStore *)clientData;
+  if (store->writer.joinable())
+    store->writer.join();
+}
+
+
+// wait for the checkpoints of every interpreter, e.g. before fork()
+void
+G3_FinishCheckpoints()
+{
+  std::lock_guard<std::mutex> lock(storesMutex);
+  for (SnapshotStore *store : stores)
+    if (store->writer.joinable())
+      store->writer.join();
+}
+
+
+static void
+deleteSnapshotStore(ClientData clientData)
+{
+  Tcl_DeleteExitHandler(&finishCheckpoint, clientData);
+  delete (SnapshotStore *)clientData;
+}
+
+
+int
+G3_AddTclSnapshotCommand(Tcl_Interp *interp, BasicAnalysisBuilder *builder)
+{
+  // the commands share one store, deleted with the snapshot command
+  SnapshotStore *store = new SnapshotStore(builder);
+  Tcl_CreateCommand(interp, "checkpoint", &TclCommand_checkpoint, (ClientData)store, nullptr);
+  Tcl_CreateCommand(interp, "restart",    &TclCommand_restart,    (ClientData)store, nullptr);
+  Tcl_CreateCommand(interp, "snapshot",   &TclCommand_snapshot,   (ClientData)store, &deleteSnapshotStore);
+  Tcl_CreateExitHandler(&finishCheckpoint, (ClientData)store);
+  return TCL_OK;
+}
@@ -8,6 +8,7 @@
 // solver.
 //
 #include <string>
+#include <vector>
 #include <algorithm>
 #ifdef _MSC_VER 
 #  include <string.h>
@@ -23,6 +24,7 @@
 // #include "analysis.h"
 #include "solver.hpp"
 #include "BasicAnalysisBuilder.h"
+#include <threads/global_pool.hpp>
 
 // system of eqn and solvers
 #include <SProfileSPDLinSolver.h>
@@ -30,6 +32,8 @@
 #include <ProfileSPDLinDirectThreadSolver.h>
 #include <SparseGenColLinSOE.h>
 #include <SparseGenRowLinSOE.h>
+#include <SupernodalSolver.h>
+#include <AmgclSolver.h>
 #include <SymSparseLinSOE.h>
 #include <SymSparseLinSolver.h>
 
@@ -94,6 +98,46 @@ TclCommand_systemSize(ClientData clientData, Tcl_Interp *interp, int argc, TCL_C
 }
 #endif
 
+//
+// systemTimes <-reset>
+//
+// Returns a dictionary with the time spent in, and number of times
+// through, each phase of the solver of the current system, e.g.
+//   ordering {0.01 1} symbolic {0.02 1} numeric {1.5 120} solve {0.3 600}
+//
+int
+TclCommand_systemTimes(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  LinearSOE *theSOE = ((BasicAnalysisBuilder *)clientData)->getLinearSOE();
+
+  if (theSOE == nullptr || theSOE->getSolver() == nullptr) {
+    opserr << G3_ERROR_PROMPT << "no system has been set\n";
+    return TCL_ERROR;
+  }
+  LinearSOESolver *theSolver = theSOE->getSolver();
+
+  if (argc > 1 && strcmp(argv[1], "-reset") == 0) {
+    theSolver->resetPhaseTimes();
+    return TCL_OK;
+  }
+
+  static const char *names[LinearSOESolver::NumPhases] = {
+    "ordering", "symbolic", "numeric", "solve"
+  };
+
+  Tcl_Obj *result = Tcl_NewDictObj();
+  for (int i=0; i<LinearSOESolver::NumPhases; i++) {
+    Tcl_Obj *phase[2] = {
+      Tcl_NewDoubleObj(theSolver->getPhaseTime(i)),
+      Tcl_NewIntObj(theSolver->getPhaseCount(i))
+    };
+    Tcl_DictObjPut(interp, result, Tcl_NewStringObj(names[i], -1), Tcl_NewListObj(2, phase));
+  }
+  Tcl_SetObjResult(interp, result);
+  return TCL_OK;
+}
+
 int
 specifySysOfEqnTable(ClientData clientData, Tcl_Interp *interp, int argc, G3_Char ** const argv)
 {
@@ -104,11 +148,34 @@ specifySysOfEqnTable(ClientData clientData, Tcl_Interp *interp, int argc, G3_Cha
     return TCL_ERROR;
   }
 
-  LinearSOE* theSOE = G3Parse_newLinearSOE(clientData, interp, argc, argv);
+  // the -threads option applies to every system type, so it is
+  // removed before the remaining arguments are parsed
+  int numThreads = 1;
+  std::vector<G3_Char *> args;
+  for (int i=0; i<argc; i++) {
+    if (i > 1 && strcmp(argv[i], "-threads") == 0) {
+      if (i+1 >= argc || Tcl_GetInt(interp, argv[i+1], &numThreads) != TCL_OK || numThreads < 1) {
+        opserr << G3_ERROR_PROMPT << "-threads requires a positive integer\n";
+        return TCL_ERROR;
+      }
+      i++;
+    } else
+      args.push_back(argv[i]);
+  }
+
+  LinearSOE* theSOE = G3Parse_newLinearSOE(clientData, interp, (int)args.size(), args.data());
 
   if (theSOE == nullptr)
     return TCL_ERROR;
 
+  if (numThreads > 1) {
+    if (!theSOE->isThreadSafe())
+      opserr << G3_WARN_PROMPT << "system " << argv[1] 
+             << " does not support threaded assembly; -threads ignored\n";
+    theSOE->setNumThreads(numThreads);
+    OpenSees::set_thread_count(numThreads);
+  }
+
   BasicAnalysisBuilder* builder = (BasicAnalysisBuilder*)clientData;
 
   builder->set(theSOE);
@@ -207,6 +274,84 @@ specify_SparseSPD(G3_Runtime *rt, int argc, G3_Char ** const argv)
 }
 
 
+//
+// system Supernodal <-spd>
+//
+// Multifrontal solver that factors independent parts of the model
+// on the threads set with -threads (or setNumThreads).
+//
+LinearSOE*
+specifySupernodal(G3_Runtime* rt, int argc, G3_Char ** const argv)
+{
+  bool symmetric = false;
+  for (int i=2; i<argc; i++) {
+    if (strcmp(argv[i], "-spd") == 0 || strcmp(argv[i], "-symmetric") == 0)
+      symmetric = true;
+    else {
+      opserr << G3_ERROR_PROMPT << "system Supernodal - unknown option " << argv[i] << "\n";
+      return nullptr;
+    }
+  }
+  return new SparseGenColLinSOE(*new SupernodalSolver(symmetric));
+}
+
+//
+// system Amgcl <-solver cg|bicgstab|gmres> <-tol tol> <-maxIter n>
+//              <-reuse factor> <-noRigidBodyModes> <-coarseEnough n>
+//
+// Krylov solver with a smoothed aggregation AMG preconditioner; the
+// preconditioner is rebuilt once the iterations exceed factor times
+// those needed when it was last built (0 rebuilds it for every tangent).
+// Levels of at most n equations are solved directly.
+//
+LinearSOE*
+specifyAmgcl(G3_Runtime* rt, int argc, G3_Char ** const argv)
+{
+  Tcl_Interp *interp = G3_getInterpreter(rt);
+
+  AmgclSolver::Method method = AmgclSolver::CG;
+  double tol = 1.0e-8;
+  int maxIter = 1000;
+  double reuse = 2.0;
+  bool rigidBodyModes = true;
+  int coarseEnough = 500;
+
+  for (int i=2; i<argc; i++) {
+    if (strcmp(argv[i], "-solver") == 0 && i+1 < argc) {
+      i++;
+      if (strcasecmp(argv[i], "cg") == 0)
+        method = AmgclSolver::CG;
+      else if (strcasecmp(argv[i], "bicgstab") == 0)
+        method = AmgclSolver::BiCGStab;
+      else if (strcasecmp(argv[i], "gmres") == 0)
+        method = AmgclSolver::GMRES;
+      else {
+        opserr << G3_ERROR_PROMPT << "system Amgcl - unknown solver " << argv[i] << "\n";
+        return nullptr;
+      }
+    } else if (strcmp(argv[i], "-tol") == 0 && i+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++i], &tol) != TCL_OK)
+        return nullptr;
+    } else if (strcmp(argv[i], "-maxIter") == 0 && i+1 < argc) {
+      if (Tcl_GetInt(interp, argv[++i], &maxIter) != TCL_OK)
+        return nullptr;
+    } else if (strcmp(argv[i], "-reuse") == 0 && i+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++i], &reuse) != TCL_OK)
+        return nullptr;
+    } else if (strcmp(argv[i], "-noRigidBodyModes") == 0) {
+      rigidBodyModes = false;
+    } else if (strcmp(argv[i], "-coarseEnough") == 0 && i+1 < argc) {
+      if (Tcl_GetInt(interp, argv[++i], &coarseEnough) != TCL_OK)
+        return nullptr;
+    } else {
+      opserr << G3_ERROR_PROMPT << "system Amgcl - unknown option " << argv[i] << "\n";
+      return nullptr;
+    }
+  }
+
+  return new SparseGenRowLinSOE(*new AmgclSolver(method, tol, maxIter, reuse, rigidBodyModes, coarseEnough));
+}
+
 #ifdef _THREADS
 #  include "contrib/sys_of_eqn/ThreadedSuperLU/ThreadedSuperLU.h"
 #else
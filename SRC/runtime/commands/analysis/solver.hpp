@@ -92,6 +92,8 @@ typedef LinearSOE*(G3_SysOfEqnSpecifier)(G3_Runtime*, int, G3_Char**);
 // Specifiers defined in solver.cpp
 G3_SysOfEqnSpecifier specify_SparseSPD;
 G3_SysOfEqnSpecifier specifySparseGen;
+G3_SysOfEqnSpecifier specifySupernodal;
+G3_SysOfEqnSpecifier specifyAmgcl;
 TclDispatch<LinearSOE*> TclDispatch_newMumpsLinearSOE;
 // TclDispatch<LinearSOE*> TclDispatch_newUmfpackLinearSOE;
 LinearSOE* TclDispatch_newUmfpackLinearSOE(ClientData, Tcl_Interp*, int, const char** const);
@@ -134,6 +136,9 @@ std::unordered_map<std::string, struct soefps> soe_table = {
   {"sparsegeneral", {specifySparseGen, nullptr, nullptr}},
   {"superlu",       {specifySparseGen, nullptr, nullptr}},
 
+  {"supernodal",    {specifySupernodal, nullptr, nullptr}},
+  {"amgcl",         {specifyAmgcl, nullptr, nullptr}},
+
   {"sparsesym", {
      specify_SparseSPD, nullptr, nullptr}},
 
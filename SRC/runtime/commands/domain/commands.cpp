@@ -73,6 +73,9 @@ extern "C" int OPS_ResetInputNoBuilder(ClientData clientData,
 Tcl_CmdProc TclCommand_record;
 Tcl_CmdProc TclCommand_setLoadConst;
 Tcl_CmdProc TclCommand_setCreep;
+Tcl_CmdProc TclCommand_setNumThreads;
+Tcl_CmdProc TclCommand_getNumThreads;
+Tcl_CmdProc TclCommand_setNodalStateStorage;
 
 
 // TODO: reimplement defaultUnits and setParameter
@@ -93,6 +96,9 @@ G3_AddTclDomainCommands(Tcl_Interp *interp, Domain* the_domain)
   Tcl_CreateCommand(interp, "setTime",             &TclCommand_setTime,  domain, nullptr);
   Tcl_CreateCommand(interp, "getTime",             &TclCommand_getTime,  domain, nullptr);
   Tcl_CreateCommand(interp, "setCreep",            &TclCommand_setCreep, nullptr, nullptr);
+  Tcl_CreateCommand(interp, "setNumThreads",       &TclCommand_setNumThreads, domain, nullptr);
+  Tcl_CreateCommand(interp, "getNumThreads",       &TclCommand_getNumThreads, domain, nullptr);
+  Tcl_CreateCommand(interp, "setNodalStateStorage", &TclCommand_setNodalStateStorage, domain, nullptr);
 
   // DAMPING
   Tcl_CreateCommand(interp, "rayleigh",            &rayleighDamping, domain, nullptr);
@@ -45,6 +45,7 @@
 // databases that can be added dynamically
 
 #include <packages.h>
+#include <G3_Runtime.h>
 
 typedef struct databasePackageCommand {
   char *funcName;
@@ -62,12 +63,13 @@ int save(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const
 
 int restore(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv);
 
-extern FE_Datastore *theDatabase;
-
 int
 TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv,
                Domain &theDomain, FEM_ObjectBroker &theBroker)
 {
+  // the database belongs to the runtime of this interpreter
+  FE_Datastore *&theDatabase = G3_getRuntime(interp)->m_database;
+
   if (createdDatabaseCommands == false) {
 
     // create the commands to commit and reset
@@ -167,6 +169,7 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **
 int
 save(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
 {
+  FE_Datastore *theDatabase = G3_getRuntime(interp)->m_database;
 
   if (theDatabase == nullptr) {
     opserr << "WARNING: save - no database has been constructed\n";
@@ -197,6 +200,7 @@ save(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv
 int
 restore(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
 {
+  FE_Datastore *theDatabase = G3_getRuntime(interp)->m_database;
 
   if (theDatabase == 0) {
     opserr << "WARNING: restore - no database has been constructed\n";
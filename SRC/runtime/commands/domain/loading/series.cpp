@@ -457,6 +457,7 @@ TclDispatch_newTimeSeries(ClientData clientData, Tcl_Interp *interp, int argc, T
     Vector *dataTime = nullptr;
     bool useLast = false;
     bool prependZero = false;
+    bool binary = false;
     double startTime = 0.0;
 
     struct stat fileInfo;
@@ -616,6 +617,11 @@ TclDispatch_newTimeSeries(ClientData clientData, Tcl_Interp *interp, int argc, T
         prependZero = true;
       }
 
+      else if (strcmp(argv[endMarker], "-binary") == 0) {
+        // the files hold native float64 values
+        binary = true;
+      }
+
       else if (strcmp(argv[endMarker], "-startTime") == 0 ||
                strcmp(argv[endMarker], "-tStart") == 0) {
         // allow user to specify the start time
@@ -634,15 +640,15 @@ TclDispatch_newTimeSeries(ClientData clientData, Tcl_Interp *interp, int argc, T
 
     if (filePathName != 0 && fileTimeName == 0 && timeIncr != 0.0) {
       theSeries = new PathSeries(tag, argv[filePathName], timeIncr, cFactor,
-                                 useLast, prependZero, startTime);
+                                 useLast, prependZero, startTime, binary);
     }
 
     else if (fileName != 0) {
-      theSeries = new PathTimeSeries(tag, argv[fileName], cFactor, useLast);
+      theSeries = new PathTimeSeries(tag, argv[fileName], cFactor, useLast, binary);
 
     } else if (filePathName != 0 && fileTimeName != 0) {
       theSeries = new PathTimeSeries(tag, argv[filePathName],
-                                     argv[fileTimeName], cFactor, useLast);
+                                     argv[fileTimeName], cFactor, useLast, binary);
 
     } else if (dataPath != 0 && dataTime == 0 && timeIncr != 0.0) {
       theSeries = new PathSeries(tag, *dataPath, timeIncr, cFactor, useLast,
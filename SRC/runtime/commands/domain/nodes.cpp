@@ -28,8 +28,8 @@
 #include <MP_ConstraintIter.h>
 
 // TODO(cmp): Remove global vars
-static char *resDataPtr  = nullptr;
-static int   resDataSize = 0;
+static thread_local char *resDataPtr  = nullptr;
+static thread_local int   resDataSize = 0;
 
 
 int
@@ -41,6 +41,7 @@
 #include <DataFileStreamAdd.h>
 #include <XmlFileStream.h>
 #include <BinaryFileStream.h>
+#include <ColumnarFileStream.h>
 #include <DatabaseStream.h>
 #include <DummyStream.h>
 #include <TCP_Stream.h>
@@ -61,7 +62,6 @@
 #include <RemoveRecorder.h>
 
 #define MAX_NDF 6
-extern FE_Datastore    *theDatabase;
 extern FEM_ObjectBroker theBroker;
 
 OPS_Routine OPS_PVDRecorder;
@@ -98,6 +98,8 @@ struct OutputOptions {
   int writeBufferSize   = 0;
   bool doScientific     = false;
   bool closeOnWrite     = false;
+  bool async            = false;
+  bool singlePrecision  = false;
 
   FE_Datastore *theDatabase = nullptr;
 
@@ -107,6 +109,7 @@ struct OutputOptions {
     XML_STREAM,
     DATABASE_STREAM,
     BINARY_STREAM,
+    BINARY_COLUMNAR_STREAM,
     DATA_STREAM_CSV,
     TCP_STREAM,
     DATA_STREAM_ADD,
@@ -127,12 +130,14 @@ createOutputStream(OutputOptions &options)
   // construct the DataHandler
   if (options.filename != nullptr) {
     if (options.eMode == OutputOptions::DATA_STREAM) {
-      theOutputStream = new DataFileStream(
+      DataFileStream *theFileStream = new DataFileStream(
           options.filename, 
           openMode::OVERWRITE, 2, 0, 
           options.closeOnWrite, 
           options.precision, 
           options.doScientific);
+      theFileStream->setAsync(options.async);
+      theOutputStream = theFileStream;
 
     } else if (options.eMode == OutputOptions::DATA_STREAM_ADD) {
       theOutputStream = new DataFileStreamAdd(
@@ -143,18 +148,23 @@ createOutputStream(OutputOptions &options)
           options.doScientific);
 
     } else if (options.eMode == OutputOptions::DATA_STREAM_CSV) {
-      theOutputStream = new DataFileStream(
+      DataFileStream *theFileStream = new DataFileStream(
           options.filename, 
           openMode::OVERWRITE, 2, 1, 
           options.closeOnWrite, 
           options.precision, 
           options.doScientific);
+      theFileStream->setAsync(options.async);
+      theOutputStream = theFileStream;
 
     } else if (options.eMode == OutputOptions::XML_STREAM) {
       theOutputStream = new XmlFileStream(options.filename);
 
     } else if (options.eMode == OutputOptions::BINARY_STREAM) {
       theOutputStream = new BinaryFileStream(options.filename);
+
+    } else if (options.eMode == OutputOptions::BINARY_COLUMNAR_STREAM) {
+      theOutputStream = new ColumnarFileStream(options.filename, options.singlePrecision);
     }
 
   } else if (options.eMode == OutputOptions::TCP_STREAM && options.inetAddr != 0) {
@@ -295,6 +305,16 @@ parseOutputOption(OutputOptions *options, Tcl_Interp* interp, int argc, TCL_Char
       loc++;
     }
 
+    else if (strcmp(argv[loc], "-async") == 0) {
+      options->async = true;
+      loc++;
+    }
+
+    else if (strcmp(argv[loc], "-float32") == 0) {
+      options->singlePrecision = true;
+      loc++;
+    }
+
     else if (strcmp(argv[loc], "-buffer") == 0 ||
              strcmp(argv[loc], "-bufferSize") == 0) {
       loc++;
@@ -323,6 +343,9 @@ parseOutputOption(OutputOptions *options, Tcl_Interp* interp, int argc, TCL_Char
       else if ((strcmp(argv[loc], "-binary") == 0)) {
         eMode = OutputOptions::BINARY_STREAM;
       }
+      else if ((strcmp(argv[loc], "-binaryColumnar") == 0)) {
+        eMode = OutputOptions::BINARY_COLUMNAR_STREAM;
+      }
       else if ((strcmp(argv[loc], "-TCP") == 0) ||
                (strcmp(argv[loc], "-tcp") == 0)) {
         options->inetAddr = argv[loc + 1];
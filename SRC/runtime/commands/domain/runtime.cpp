@@ -98,3 +98,54 @@ TclCommand_getTime(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char
   return TCL_OK;
 }
 
+
+int
+TclCommand_setNumThreads(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  Domain* domain = (Domain*)clientData;
+
+  if (argc < 2) {
+    opserr << "WARNING illegal command - setNumThreads numThreads? \n";
+    return TCL_ERROR;
+  }
+  int numThreads;
+  if (Tcl_GetInt(interp, argv[1], &numThreads) != TCL_OK) {
+    opserr << "WARNING reading thread count - setNumThreads numThreads? \n";
+    return TCL_ERROR;
+  }
+  domain->setNumThreads(numThreads);
+  return TCL_OK;
+}
+
+int
+TclCommand_getNumThreads(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  Domain* domain = (Domain*)clientData;
+
+  Tcl_SetObjResult(interp, Tcl_NewIntObj(domain->getNumThreads()));
+  return TCL_OK;
+}
+
+int
+TclCommand_setNodalStateStorage(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char ** const argv)
+{
+  assert(clientData != nullptr);
+  Domain* domain = (Domain*)clientData;
+
+  if (argc < 2) {
+    opserr << "WARNING illegal command - setNodalStateStorage contiguous|node \n";
+    return TCL_ERROR;
+  }
+
+  if (strcmp(argv[1], "contiguous") == 0)
+    domain->setNodalStateStorage(true);
+  else if (strcmp(argv[1], "node") == 0)
+    domain->setNodalStateStorage(false);
+  else {
+    opserr << "WARNING unknown storage " << argv[1] << " - setNodalStateStorage contiguous|node \n";
+    return TCL_ERROR;
+  }
+  return TCL_OK;
+}
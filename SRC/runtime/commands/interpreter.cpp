@@ -14,6 +14,8 @@
 #include <G3_Runtime.h>
 #include <OPS_Globals.h>
 #include <Timer.h>
+#include <Profiler.h>
+#include <string>
 #include "interpreter.h"
 
 static Tcl_ObjCmdProc *Tcl_putsCommand = nullptr;
@@ -22,6 +24,7 @@ static Timer *theTimer = nullptr;
 class ProgressBar;
 Tcl_ObjCmdProc TclObjCommand_progress;
 extern ProgressBar* progress_bar_ptr;
+Tcl_ObjCmdProc TclObjCommand_sample;
 
 
 const char *getInterpPWD(Tcl_Interp *interp);
@@ -68,6 +71,38 @@ timer(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** const argv
   return TCL_ERROR;
 }
 
+//
+// profile on|off|reset
+// profile ?report? ?-json?
+//
+static int
+profile(ClientData clientData, Tcl_Interp* interp, int argc, TCL_Char** const argv)
+{
+  bool json = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "on") == 0 || strcmp(argv[i], "start") == 0)
+      OpenSees::Profiler::enable(true);
+    else if (strcmp(argv[i], "off") == 0 || strcmp(argv[i], "stop") == 0)
+      OpenSees::Profiler::enable(false);
+    else if (strcmp(argv[i], "reset") == 0)
+      OpenSees::Profiler::reset();
+    else if (strcmp(argv[i], "-json") == 0)
+      json = true;
+    else if (strcmp(argv[i], "report") != 0) {
+      opserr << "Unknown argument '" << argv[i] << "'\n";
+      opserr << "Want: profile on|off|reset|report ?-json?\n";
+      return TCL_ERROR;
+    }
+  }
+
+  // with no action, report
+  if (argc == 1 || json || strcmp(argv[argc-1], "report") == 0) {
+    const std::string report = OpenSees::Profiler::report(json);
+    Tcl_SetObjResult(interp, Tcl_NewStringObj(report.c_str(), -1));
+  }
+  return TCL_OK;
+}
+
 //
 // revised puts command to send to stderr
 //
@@ -379,6 +414,7 @@ Init_OpenSees(Tcl_Interp *interp)
   Tcl_CreateCommand(interp, "start",               startTimer,   nullptr, nullptr);
   Tcl_CreateCommand(interp, "stop",                stopTimer,    nullptr, nullptr);
   Tcl_CreateCommand(interp, "timer",               timer,        nullptr, nullptr);
+  Tcl_CreateCommand(interp, "profile",             profile,      nullptr, nullptr);
 
   // File utilities
   Tcl_CreateCommand(interp, "setMaxOpenFiles",     maxOpenFiles,        nullptr, nullptr);
@@ -393,6 +429,7 @@ Init_OpenSees(Tcl_Interp *interp)
   Tcl_CreateObjCommand(interp, "source",           OPS_SourceCmd, nullptr, nullptr);
   Tcl_CreateObjCommand(interp, "pragma",           TclObjCommand_pragma, nullptr, nullptr);
   Tcl_CreateObjCommand(interp, "progress",         TclObjCommand_progress, (ClientData)&progress_bar_ptr, nullptr);
+  Tcl_CreateObjCommand(interp, "sample",           TclObjCommand_sample, nullptr, nullptr);
 
   //
   static int ncmd = sizeof(InterpreterCommands)/sizeof(char_cmd);
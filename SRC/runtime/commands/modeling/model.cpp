@@ -16,6 +16,7 @@
 #include <tcl.h>
 #include <Logging.h>
 #include <runtimeAPI.h>
+#include <G3_Runtime.h>
 #include <Domain.h>
 #include <FE_Datastore.h>
 
@@ -26,11 +27,6 @@
    extern PartitionedDomain theDomain;
 #endif
 
-
-bool builtModel = false;
-
-FE_Datastore *theDatabase = nullptr;
-
 extern int G3_AddTclAnalysisAPI(Tcl_Interp *, Domain*);
 extern int G3_AddTclDomainCommands(Tcl_Interp *, Domain*);
 
@@ -239,9 +235,13 @@ TclCommand_wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Ch
   Tcl_Eval(interp, "_clearAnalysis");
 
   BasicModelBuilder *builder = static_cast<BasicModelBuilder*>(clientData);
+  G3_Runtime *rt = G3_getRuntime(interp);
 
-  if (theDatabase != nullptr)
-    delete theDatabase;
+  if (rt != nullptr) {
+    delete rt->m_database;
+    rt->m_database = nullptr;
+    rt->model_is_built = false;
+  }
 
   if (builder != nullptr) {
     Domain* theDomain = builder->getDomain();
@@ -249,7 +249,6 @@ TclCommand_wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Ch
     ops_TheActiveDomain = nullptr;
     delete theDomain;
     delete builder;
-    builtModel = false;
   }
   Tcl_CreateCommand(interp, "model", &TclCommand_specifyModel, nullptr, nullptr);
   Tcl_CreateCommand(interp, "wipe",  &TclCommand_wipeModel,    nullptr, nullptr);
@@ -260,8 +259,6 @@ TclCommand_wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Ch
   OPS_PARTITIONED = false;
 #endif
 
-  theDatabase = nullptr;
-
   // the domain deletes the record objects,
   // just have to delete the private array
   return TCL_OK;
@@ -275,14 +272,13 @@ buildModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char *argv[]
   G3_Runtime *rt = G3_getRuntime(interp);
   BasicModelBuilder* builder = (BasicModelBuilder*)G3_getModelBuilder(rt);
 
-  // TODO: Remove `builtModel` var.
   // to build the model make sure the ModelBuilder has been constructed
   // and that the model has not already been constructed
-  if (builder != 0 && builtModel == false) {
-    builtModel = true;
+  if (builder != 0 && rt->model_is_built == false) {
+    rt->model_is_built = true;
     return builder->buildFE_Model();
 
-  } else if (builder != 0 && builtModel == true) {
+  } else if (builder != 0 && rt->model_is_built == true) {
     opserr << G3_ERROR_PROMPT << "Model has already been built - not built again \n";
     return TCL_ERROR;
 
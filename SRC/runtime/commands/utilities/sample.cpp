@@ -0,0 +1,167 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: This file implements the sample command, which evaluates a
+// script for many realizations of a vector of random numbers:
+//
+//    sample $numSamples $numRandom $command <-seed $seed> <-workers $n>
+//                                           <-size $m> <-uniform>
+//
+// Sample k = 0, 1, ..., numSamples-1 is evaluated by calling
+//
+//    {*}$command $k $x
+//
+// at global level, where $x holds the first numRandom numbers of the
+// stream of sample k of a PhiloxRandGenerator with the given seed; these
+// are standard normal, or uniform on (0,1) with -uniform. The command
+// returns a list of m numbers (1 by default), and sample returns the list
+// of these lists in sample order.
+//
+// The samples are evaluated by SampleWorkers on n worker processes, each a
+// fork() of this one, so a command may build and analyze a model of its
+// own without affecting the others. Since the numbers of a sample depend
+// only on the seed and the number of the sample, the result is the same
+// for any number of workers. Checkpoints still being written are finished
+// before the workers are started. With one worker, the default, the
+// samples are evaluated in turn by this interpreter.
+//
+// Written: cmp
+//
+#include <tcl.h>
+#include <string.h>
+#include <vector>
+#include <G3_Logging.h>
+#include <PhiloxRandGenerator.h>
+#include <SampleWorkers.h>
+
+// a checkpoint being written must not be copied into the workers
+void G3_FinishCheckpoints();
+
+int
+TclObjCommand_sample(ClientData clientData, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+  if (objc < 4) {
+    opserr << G3_ERROR_PROMPT << "want sample $numSamples $numRandom $command "
+           << "<-seed $seed> <-workers $n> <-size $m> <-uniform>\n";
+    return TCL_ERROR;
+  }
+
+  int numSamples, numRandom;
+  if (Tcl_GetIntFromObj(interp, objv[1], &numSamples) != TCL_OK || numSamples < 0) {
+    opserr << G3_ERROR_PROMPT << "invalid number of samples " << Tcl_GetString(objv[1]) << "\n";
+    return TCL_ERROR;
+  }
+  if (Tcl_GetIntFromObj(interp, objv[2], &numRandom) != TCL_OK || numRandom < 0) {
+    opserr << G3_ERROR_PROMPT << "invalid number of random numbers " << Tcl_GetString(objv[2]) << "\n";
+    return TCL_ERROR;
+  }
+  Tcl_Obj *command = objv[3];
+
+  int seed = 0;
+  int numWorkers = 1;
+  int size = 1;
+  bool uniform = false;
+  for (int i=4; i<objc; i++) {
+    const char *option = Tcl_GetString(objv[i]);
+    if (strcmp(option, "-uniform") == 0) {
+      uniform = true;
+      continue;
+    }
+
+    if (i+1 == objc) {
+      opserr << G3_ERROR_PROMPT << "missing value for sample option " << option << "\n";
+      return TCL_ERROR;
+    }
+    int *value;
+    if (strcmp(option, "-seed") == 0)
+      value = &seed;
+    else if (strcmp(option, "-workers") == 0)
+      value = &numWorkers;
+    else if (strcmp(option, "-size") == 0)
+      value = &size;
+    else {
+      opserr << G3_ERROR_PROMPT << "unknown sample option " << option
+             << ", want -seed, -workers, -size or -uniform\n";
+      return TCL_ERROR;
+    }
+    if (Tcl_GetIntFromObj(interp, objv[++i], value) != TCL_OK) {
+      opserr << G3_ERROR_PROMPT << "invalid value for sample option " << option << "\n";
+      return TCL_ERROR;
+    }
+  }
+
+  if (numWorkers < 1 || size < 1) {
+    opserr << G3_ERROR_PROMPT << "sample needs at least one worker and one result\n";
+    return TCL_ERROR;
+  }
+
+  // calls the command for a sample and reads its results into the record
+  std::vector<double> x(numRandom);
+  SampleWorkers::Evaluate evaluate = [&](long k, double *record) -> int {
+    if (uniform)
+      PhiloxRandGenerator::uniforms(seed, k, numRandom, x.data());
+    else
+      PhiloxRandGenerator::normals(seed, k, numRandom, x.data());
+
+    Tcl_Obj *numbers = Tcl_NewListObj(0, nullptr);
+    for (double xi : x)
+      Tcl_ListObjAppendElement(interp, numbers, Tcl_NewDoubleObj(xi));
+
+    Tcl_Obj *call = Tcl_DuplicateObj(command);
+    Tcl_IncrRefCount(call);
+    Tcl_ListObjAppendElement(interp, call, Tcl_NewLongObj(k));
+    Tcl_ListObjAppendElement(interp, call, numbers);
+    int status = Tcl_EvalObjEx(interp, call, TCL_EVAL_GLOBAL);
+    Tcl_DecrRefCount(call);
+
+    Tcl_Obj **results;
+    int numResults = 0;
+    if (status == TCL_OK)
+      status = Tcl_ListObjGetElements(interp, Tcl_GetObjResult(interp), &numResults, &results);
+    if (status == TCL_OK && numResults != size) {
+      Tcl_SetObjResult(interp, Tcl_ObjPrintf("returned %d numbers instead of %d", numResults, size));
+      status = TCL_ERROR;
+    }
+    for (int i=0; status == TCL_OK && i<size; i++)
+      status = Tcl_GetDoubleFromObj(interp, results[i], &record[i]);
+
+    if (status != TCL_OK) {
+      opserr << G3_ERROR_PROMPT << "sample " << (int)k << " failed: "
+             << Tcl_GetStringResult(interp) << "\n";
+      return -1;
+    }
+    return 0;
+  };
+
+  Tcl_Obj *samples = Tcl_NewListObj(0, nullptr);
+  Tcl_IncrRefCount(samples);
+  bool failed = false;
+  SampleWorkers::Reduce reduce = [&](long k, int status, const double *record) -> bool {
+    if (status < 0) {
+      failed = true;
+      return true;
+    }
+    Tcl_Obj *results = Tcl_NewListObj(0, nullptr);
+    for (int i=0; i<size; i++)
+      Tcl_ListObjAppendElement(interp, results, Tcl_NewDoubleObj(record[i]));
+    Tcl_ListObjAppendElement(interp, samples, results);
+    return false;
+  };
+
+  if (numWorkers > 1)
+    G3_FinishCheckpoints();
+
+  SampleWorkers theWorkers(numWorkers, size);
+  if (numSamples > 0 && (theWorkers.run(0, numSamples-1, evaluate, reduce) < 0 || failed)) {
+    Tcl_DecrRefCount(samples);
+    opserr << G3_ERROR_PROMPT << "failed to evaluate the samples\n";
+    return TCL_ERROR;
+  }
+
+  Tcl_SetObjResult(interp, samples);
+  Tcl_DecrRefCount(samples);
+  return TCL_OK;
+}
@@ -29,10 +29,13 @@
 
 #include <TimeSeries.h>
 
-static Tcl_Interp *theInterp       = nullptr;
-static TCL_Char **currentArgv      = nullptr;
-static int currentArg = 0;
-static int maxArg     = 0;
+// The arguments of the command being parsed. Each interpreter is bound
+// to the thread that created it, so these are kept per thread to let
+// models be built concurrently.
+static thread_local Tcl_Interp *theInterp  = nullptr;
+static thread_local TCL_Char **currentArgv = nullptr;
+static thread_local int currentArg = 0;
+static thread_local int maxArg     = 0;
 
 
 extern const char *getInterpPWD(Tcl_Interp *interp);
@@ -284,9 +287,7 @@ extern "C" int OPS_SetDoubleDictListOutput(
 //
 
 
-extern bool builtModel;
-extern FE_Datastore *theDatabase;
-static BasicModelBuilder *theModelBuilder = nullptr;
+static thread_local BasicModelBuilder *theModelBuilder = nullptr;
 
 G3_Runtime *
 G3_getRuntime(Tcl_Interp *interp)
@@ -431,14 +432,21 @@ OPS_GetNDM(void)
 bool *
 OPS_builtModel(void) 
 {
-  return &builtModel;
+  // the flag belongs to the runtime of the interpreter that is parsing
+  static thread_local bool noModel = false;
+  G3_Runtime *rt = theInterp != nullptr ? G3_getRuntime(theInterp) : nullptr;
+  return rt != nullptr ? &rt->model_is_built : &noModel;
 }
 
 AnalysisModel **
 G3_getAnalysisModelPtr(G3_Runtime *rt){return rt->m_analysis_model_ptr;}
 
 FE_Datastore *
-OPS_GetFEDatastore() {return theDatabase;}
+OPS_GetFEDatastore()
+{
+  G3_Runtime *rt = theInterp != nullptr ? G3_getRuntime(theInterp) : nullptr;
+  return rt != nullptr ? rt->m_database : nullptr;
+}
 
 const char *
 OPS_GetInterpPWD() {return getInterpPWD(theInterp);}
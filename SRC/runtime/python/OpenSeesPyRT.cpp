@@ -15,16 +15,37 @@ namespace py = pybind11;
 #include <elementAPI.h> // G3_getRuntime/SafeBuilder
 #include <runtime/runtime/BasicModelBuilder.h>
 
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <Domain.h>
 #include <Vector.h>
+#include <Matrix.h>
 #include <Node.h>
+#include <HeapNode.h>
+#include <NodeIter.h>
+#include <NodalStateStore.h>
+#include <NodalLoad.h>
+#include <SP_Constraint.h>
 #include <NodeData.h>
 #include <Element.h>
+#include <Information.h>
+#include <Response.h>
+#include <DummyStream.h>
 #include <SectionForceDeformation.h>
 #include <UniaxialMaterial.h>
 #include <NDMaterial.h>
 #include <HystereticBackbone.h>
 #include <ManderBackbone.h>
+#include <Truss.h>
+#include <CorotTruss.h>
+#include <FourNodeQuad.h>
+#include <Brick.h>
 
 // 
 // ANALYSIS
@@ -267,6 +288,440 @@ ground_motion(
 
 }
 
+//
+// BULK MODEL CONSTRUCTION
+//
+// These create nodes, constraints, loads and elements from whole arrays
+// at once, without forming and parsing a command for each one. Parameters
+// that are the same for every item may be given as a single value.
+//
+
+template <typename T>
+static inline T
+broadcast(const py::array_t<T, ARRAY_FLAGS> &values, py::ssize_t i)
+{
+  return values.size() == 1 ? values.data()[0] : values.data()[i];
+}
+
+static void
+check_shape(const py::array &array, py::ssize_t rows, py::ssize_t cols, const char *name)
+{
+  if (array.ndim() != 2 || array.shape(0) != rows || array.shape(1) != cols)
+    throw std::runtime_error(std::string(name) + " must have shape ("
+                             + std::to_string(rows) + ", " + std::to_string(cols) + ")");
+}
+
+static void
+check_broadcast(const py::array &array, py::ssize_t size, const char *name)
+{
+  if (array.size() != 1 && array.size() != size)
+    throw std::runtime_error(std::string(name) + " must have one value or one for each item");
+}
+
+static int
+add_nodes(BasicModelBuilder& builder,
+          py::array_t<int, ARRAY_FLAGS> tags,
+          py::array_t<double, ARRAY_FLAGS> coords,
+          int ndf,
+          std::optional<py::array_t<double, ARRAY_FLAGS>> mass)
+{
+  Domain *domain = builder.getDomain();
+  const int ndm = builder.getNDM();
+  if (ndf <= 0)
+    ndf = builder.getNDF();
+
+  const py::ssize_t n = tags.size();
+  check_shape(coords, n, ndm, "coords");
+  if (mass)
+    check_shape(*mass, n, ndf, "mass");
+
+  domain->reserve(static_cast<int>(n), 0);
+
+  const int    *tag = tags.data();
+  const double *x   = coords.data();
+  Matrix M(ndf, ndf);
+  for (py::ssize_t i=0; i<n; i++) {
+    const double *xi = x + i*ndm;
+    Node *theNode = nullptr;
+    switch (ndm) {
+    case 1:
+      theNode = new HeapNode(tag[i], ndf, xi[0]);
+      break;
+    case 2:
+      theNode = new HeapNode(tag[i], ndf, xi[0], xi[1]);
+      break;
+    case 3:
+      theNode = new HeapNode(tag[i], ndf, xi[0], xi[1], xi[2]);
+      break;
+    default:
+      throw std::runtime_error("unsupported model dimension");
+    }
+
+    if (mass) {
+      const double *mi = mass->data() + i*ndf;
+      for (int j=0; j<ndf; j++)
+        M(j, j) = mi[j];
+      theNode->setMass(M);
+    }
+
+    if (domain->addNode(theNode) == false) {
+      delete theNode;
+      throw std::runtime_error("could not add node " + std::to_string(tag[i]));
+    }
+  }
+  return static_cast<int>(n);
+}
+
+static int
+fix_nodes(BasicModelBuilder& builder,
+          py::array_t<int, ARRAY_FLAGS> tags,
+          py::array_t<int, ARRAY_FLAGS> fixity)
+{
+  Domain *domain = builder.getDomain();
+  const py::ssize_t n = tags.size();
+  if (fixity.ndim() != 2 || fixity.shape(0) != n)
+    throw std::runtime_error("fixity must have one row for each node");
+  const int ndf = static_cast<int>(fixity.shape(1));
+
+  int count = 0;
+  const int *tag = tags.data();
+  const int *fix = fixity.data();
+  for (py::ssize_t i=0; i<n; i++) {
+    for (int j=0; j<ndf; j++) {
+      if (fix[i*ndf + j] == 0)
+        continue;
+      SP_Constraint *theSP = new SP_Constraint(tag[i], j, 0.0, true);
+      if (domain->addSP_Constraint(theSP) == false) {
+        delete theSP;
+        throw std::runtime_error("could not fix node " + std::to_string(tag[i])
+                                 + " - node may already be constrained");
+      }
+      count++;
+    }
+  }
+  return count;
+}
+
+static int
+add_nodal_loads(BasicModelBuilder& builder,
+                int pattern,
+                py::array_t<int, ARRAY_FLAGS> tags,
+                py::array_t<double, ARRAY_FLAGS> forces,
+                bool constant)
+{
+  Domain *domain = builder.getDomain();
+  const py::ssize_t n = tags.size();
+  if (forces.ndim() != 2 || forces.shape(0) != n)
+    throw std::runtime_error("forces must have one row for each node");
+  const int ndf = static_cast<int>(forces.shape(1));
+
+  const int    *tag = tags.data();
+  const double *f   = forces.data();
+  Vector load(ndf);
+  for (py::ssize_t i=0; i<n; i++) {
+    for (int j=0; j<ndf; j++)
+      load(j) = f[i*ndf + j];
+
+    NodalLoad *theLoad = new NodalLoad(builder.getNodalLoadTag(), tag[i], load, constant);
+    if (domain->addNodalLoad(theLoad, pattern) == false) {
+      delete theLoad;
+      throw std::runtime_error("could not add load to node " + std::to_string(tag[i]));
+    }
+    builder.incrNodalLoadTag();
+  }
+  return static_cast<int>(n);
+}
+
+static int
+add_elements(BasicModelBuilder& builder,
+             const std::string &type,
+             py::array_t<int, ARRAY_FLAGS> tags,
+             py::array_t<int, ARRAY_FLAGS> nodes,
+             py::array_t<int, ARRAY_FLAGS> materials,
+             py::array_t<double, ARRAY_FLAGS> area,
+             py::array_t<double, ARRAY_FLAGS> thickness,
+             double density,
+             const std::string &plane)
+{
+  enum class Kind {Truss, CorotTruss, Quad, Brick};
+  Kind kind;
+  int nen;
+  if (type == "Truss" || type == "truss") {
+    kind = Kind::Truss;
+    nen  = 2;
+  } else if (type == "CorotTruss" || type == "corotTruss") {
+    kind = Kind::CorotTruss;
+    nen  = 2;
+  } else if (type == "FourNodeQuad" || type == "quad") {
+    kind = Kind::Quad;
+    nen  = 4;
+  } else if (type == "Brick" || type == "stdBrick") {
+    kind = Kind::Brick;
+    nen  = 8;
+  } else
+    throw std::runtime_error("bulk construction is not available for element type " + type);
+
+  Domain *domain = builder.getDomain();
+  const int ndm = builder.getNDM();
+  const py::ssize_t n = tags.size();
+  check_shape(nodes, n, nen, "nodes");
+  check_broadcast(materials, n, "materials");
+  check_broadcast(area,      n, "area");
+  check_broadcast(thickness, n, "thickness");
+
+  // look up each material once; the plane stress/strain copies used by
+  // the quads are made here and deleted when done, as the quad command does
+  std::unordered_map<int, UniaxialMaterial*> uniaxial;
+  std::unordered_map<int, NDMaterial*> continuum;
+  struct Cleanup {
+    std::unordered_map<int, NDMaterial*> &copies;
+    bool owned;
+    ~Cleanup() {
+      if (owned)
+        for (auto &entry : copies)
+          delete entry.second;
+    }
+  } cleanup {continuum, kind == Kind::Quad};
+
+  auto getUniaxial = [&](int matTag) -> UniaxialMaterial& {
+    auto found = uniaxial.find(matTag);
+    if (found != uniaxial.end())
+      return *found->second;
+    UniaxialMaterial *material = builder.getTypedObject<UniaxialMaterial>(matTag);
+    if (material == nullptr)
+      throw std::runtime_error("no uniaxial material with tag " + std::to_string(matTag));
+    uniaxial.emplace(matTag, material);
+    return *material;
+  };
+
+  auto getContinuum = [&](int matTag) -> NDMaterial& {
+    auto found = continuum.find(matTag);
+    if (found != continuum.end())
+      return *found->second;
+    NDMaterial *material = builder.getTypedObject<NDMaterial>(matTag);
+    if (material != nullptr && kind == Kind::Quad)
+      material = material->getCopy(plane.c_str());
+    if (material == nullptr)
+      throw std::runtime_error("no suitable nD material with tag " + std::to_string(matTag));
+    continuum.emplace(matTag, material);
+    return *material;
+  };
+
+  domain->reserve(0, static_cast<int>(n));
+
+  const int *tag  = tags.data();
+  const int *conn = nodes.data();
+  for (py::ssize_t i=0; i<n; i++) {
+    const int *ni = conn + i*nen;
+    const int matTag = broadcast(materials, i);
+    Element *theElement = nullptr;
+    switch (kind) {
+    case Kind::Truss:
+      theElement = new Truss(tag[i], ndm, ni[0], ni[1], getUniaxial(matTag),
+                             broadcast(area, i), density);
+      break;
+    case Kind::CorotTruss:
+      theElement = new CorotTruss(tag[i], ndm, ni[0], ni[1], getUniaxial(matTag),
+                                  broadcast(area, i), density);
+      break;
+    case Kind::Quad: {
+      std::array<int,4> quadNodes {ni[0], ni[1], ni[2], ni[3]};
+      theElement = new FourNodeQuad(tag[i], quadNodes, getContinuum(matTag),
+                                    broadcast(thickness, i), 0.0, density, 0.0, 0.0);
+      break;
+    }
+    case Kind::Brick:
+      theElement = new Brick(tag[i], ni[0], ni[1], ni[2], ni[3], ni[4], ni[5], ni[6], ni[7],
+                             getContinuum(matTag));
+      break;
+    }
+
+    if (domain->addElement(theElement) == false) {
+      delete theElement;
+      throw std::runtime_error("could not add element " + std::to_string(tag[i]));
+    }
+  }
+  return static_cast<int>(n);
+}
+
+//
+// RESPONSE ARRAYS
+//
+// Nodal responses for the whole Domain in one array, with a row for each
+// node in the order given by getNodeTags(). When the Domain keeps its
+// nodal state contiguously (setNodalStateStorage) and all nodes have the
+// same number of dof, the displacements, velocities and accelerations are
+// returned as read-only views of that storage; they follow the analysis
+// without being fetched again, until nodes are added or removed. Other
+// responses are gathered into an array that can be passed back in as
+// `out` to be filled again at the next step; `out` must be a writeable
+// C-contiguous float64 array of the right shape.
+//
+
+static NodeData
+node_data(const std::string &type)
+{
+  if (type == "disp"  || type == "displ")  return NodeData::Disp;
+  if (type == "vel"   || type == "veloc")  return NodeData::Vel;
+  if (type == "accel")                     return NodeData::Accel;
+  if (type == "incrDisp")                  return NodeData::IncrDisp;
+  if (type == "incrDeltaDisp")             return NodeData::IncrDeltaDisp;
+  if (type == "reaction" || type == "react") return NodeData::Reaction;
+  throw std::runtime_error("unknown nodal response " + type);
+}
+
+static py::array_t<int>
+node_tags(Domain& domain)
+{
+  py::array_t<int> tags(domain.getNumNodes());
+  int *tag = tags.mutable_data();
+  Node *theNode;
+  NodeIter &theNodes = domain.getNodes();
+  while ((theNode = theNodes()) != nullptr)
+    *tag++ = theNode->getTag();
+  return tags;
+}
+
+static py::array
+node_responses(py::object self, const std::string &type, py::object out)
+{
+  Domain &domain = self.cast<Domain&>();
+  const NodeData data = node_data(type);
+  const py::ssize_t numNodes = domain.getNumNodes();
+
+  const NodalStateStore *store = domain.getNodalStateStore();
+  int ndf;
+  std::size_t stride;
+  const double *values = store != nullptr ? store->getValues(data, ndf, stride) : nullptr;
+  if (values != nullptr && out.is_none()) {
+    // the base shares the storage, so the values outlive a rebuild of
+    // the store (or the Domain) for as long as the view is held
+    py::capsule base(new std::shared_ptr<const void>(store->getOwner()),
+                     [](void *owner) { delete static_cast<std::shared_ptr<const void>*>(owner); });
+    py::array view(py::dtype::of<double>(),
+                   {numNodes, static_cast<py::ssize_t>(ndf)},
+                   {static_cast<py::ssize_t>(stride*sizeof(double)), static_cast<py::ssize_t>(sizeof(double))},
+                   values, base);
+    view.attr("setflags")(py::arg("write") = false);
+    return view;
+  }
+
+  // otherwise copy from each node into one array
+  Node *theNode;
+  int width = 0;
+  NodeIter &theNodes = domain.getNodes();
+  while ((theNode = theNodes()) != nullptr)
+    width = std::max(width, theNode->getNumberDOF());
+
+  py::array result;
+  if (out.is_none())
+    result = py::array_t<double, py::array::c_style>({numNodes, static_cast<py::ssize_t>(width)});
+  else {
+    // out is filled in place, so it must already be what would be returned
+    if (!py::isinstance<py::array>(out))
+      throw py::type_error("out must be a numpy array");
+    result = py::reinterpret_borrow<py::array>(out);
+    if (result.dtype().kind() != 'f' || result.itemsize() != sizeof(double))
+      throw py::type_error("out must have dtype float64");
+    if (!(result.flags() & py::array::c_style) || !result.writeable())
+      throw py::value_error("out must be a writeable C-contiguous array");
+    if (result.ndim() != 2 || result.shape(0) != numNodes || result.shape(1) != width)
+      throw py::value_error("out must have shape (" + std::to_string(numNodes)
+                            + ", " + std::to_string(width) + ")");
+  }
+
+  double *row = static_cast<double*>(result.mutable_data());
+  NodeIter &theNodes2 = domain.getNodes();
+  while ((theNode = theNodes2()) != nullptr) {
+    const Vector *response = theNode->getResponse(data);
+    const int n = response != nullptr ? response->Size() : 0;
+    for (int j=0; j<width; j++)
+      row[j] = j < n ? (*response)(j) : 0.0;
+    row += width;
+  }
+  return result;
+}
+
+// Collects one response from a set of elements into a single array each
+// step, like an ElementRecorder that writes to memory. The Response
+// objects are set up once and the same array is filled by every call.
+class ElementResponses
+{
+public:
+  ElementResponses(Domain &domain, py::array_t<int, ARRAY_FLAGS> tags,
+                   const std::vector<std::string> &args)
+  {
+    std::vector<const char *> argv;
+    for (const std::string &arg : args)
+      argv.push_back(arg.c_str());
+
+    DummyStream output;
+    const int *tag = tags.data();
+    const py::ssize_t numEle = tags.size();
+    responses.reserve(numEle);
+    offsets.reserve(numEle + 1);
+    offsets.push_back(0);
+    for (py::ssize_t i=0; i<numEle; i++) {
+      Element *theElement = domain.getElement(tag[i]);
+      if (theElement == nullptr)
+        throw std::runtime_error("no element with tag " + std::to_string(tag[i]));
+
+      Response *theResponse = theElement->setResponse(argv.data(), static_cast<int>(argv.size()), output);
+      if (theResponse == nullptr)
+        throw std::runtime_error("element " + std::to_string(tag[i]) + " has no such response");
+
+      responses.push_back(theResponse);
+      offsets.push_back(offsets.back() + theResponse->getInformation().getData().Size());
+    }
+
+    // elements with the same number of values give a 2D array
+    const py::ssize_t total = offsets.back();
+    const py::ssize_t width = numEle > 0 ? offsets[1] : 0;
+    bool uniform = true;
+    for (py::ssize_t i=0; i<numEle; i++)
+      uniform = uniform && offsets[i+1] - offsets[i] == width;
+    if (uniform)
+      values = py::array_t<double>({numEle, width});
+    else
+      values = py::array_t<double>(total);
+  }
+
+  ElementResponses(const ElementResponses &) = delete;
+  ElementResponses &operator=(const ElementResponses &) = delete;
+
+  ~ElementResponses()
+  {
+    for (Response *theResponse : responses)
+      delete theResponse;
+  }
+
+  py::array_t<double>
+  gather()
+  {
+    double *data = values.mutable_data();
+    for (std::size_t i=0; i<responses.size(); i++) {
+      if (responses[i]->getResponse() < 0)
+        throw std::runtime_error("failed to get element response");
+      const Vector &response = responses[i]->getInformation().getData();
+      for (int j=0; j<response.Size(); j++)
+        data[offsets[i] + j] = response(j);
+    }
+    return values;
+  }
+
+  // start of the values of each element in the flattened array
+  py::array_t<py::ssize_t>
+  getOffsets() const
+  {
+    return py::array_t<py::ssize_t>(offsets.size(), offsets.data());
+  }
+
+private:
+  std::vector<Response*> responses;
+  std::vector<py::ssize_t> offsets;
+  py::array_t<double> values;
+};
+
 void
 init_obj_module(py::module &m)
 {
@@ -486,6 +941,31 @@ init_obj_module(py::module &m)
     .def ("getHystereticBackbone", [](BasicModelBuilder& builder, int tag){
         return std::unique_ptr<HystereticBackbone, py::nodelete>(builder.getTypedObject<HystereticBackbone>(tag));
     })
+    .def ("getDomain", [](BasicModelBuilder& builder){
+        return std::unique_ptr<Domain, py::nodelete>(builder.getDomain());
+    })
+    //
+    // Bulk construction from arrays
+    //
+    .def ("addNodes", &add_nodes,
+        "Create a node for each tag with the coordinates in the matching row of coords.",
+        py::arg("tags"), py::arg("coords"), py::arg("ndf") = 0, py::arg("mass") = py::none()
+    )
+    .def ("fixNodes", &fix_nodes,
+        "Fix the DOFs of each node that are nonzero in the matching row of fixity.",
+        py::arg("tags"), py::arg("fixity")
+    )
+    .def ("addNodalLoads", &add_nodal_loads,
+        "Add the forces in each row to the matching node in the given load pattern.",
+        py::arg("pattern"), py::arg("tags"), py::arg("forces"), py::arg("constant") = false
+    )
+    .def ("addElements", &add_elements,
+        "Create elements of one type from a table of connectivity; supported types "
+        "are Truss, CorotTruss, FourNodeQuad and Brick.",
+        py::arg("type"), py::arg("tags"), py::arg("nodes"), py::arg("materials"),
+        py::arg("area") = 1.0, py::arg("thickness") = 1.0, py::arg("density") = 0.0,
+        py::arg("plane") = "PlaneStrain"
+    )
   ;
 
   py::class_<Domain>(m, "_Domain")
@@ -499,6 +979,28 @@ init_obj_module(py::module &m)
       return copy_vector(*domain.getNodeResponse(node, typ));
     })
     .def ("getTime", &Domain::getCurrentTime)
+    .def ("setNodalStateStorage", &Domain::setNodalStateStorage,
+        "Keep the nodal state of all nodes in contiguous arrays.",
+        py::arg("contiguous") = true
+    )
+    .def ("getNodeTags", &node_tags,
+        "Tags of the nodes, in the order of the rows of getNodeResponses()."
+    )
+    .def ("getNodeResponses", &node_responses,
+        "A response of every node as an array with a row per node.",
+        py::arg("type"), py::arg("out") = py::none()
+    )
+  ;
+
+  py::class_<ElementResponses>(m, "ElementResponses",
+     "One response of a set of elements, gathered into one array each step."
+     )
+    .def (py::init<Domain&, py::array_t<int, ARRAY_FLAGS>, const std::vector<std::string>&>(),
+          py::arg("domain"), py::arg("tags"), py::arg("args"),
+          py::keep_alive<1, 2>()
+    )
+    .def ("gather",     &ElementResponses::gather)
+    .def ("getOffsets", &ElementResponses::getOffsets)
   ;
   
   py::class_<G3_Runtime>(m, "_Runtime")
@@ -125,6 +125,7 @@ BasicAnalysisBuilder::wipe()
     delete theAnalysisModel;
     theAnalysisModel = new AnalysisModel();
   }
+  modelBuilt = false;
 }
 
 void
@@ -227,6 +228,17 @@ BasicAnalysisBuilder::domainChanged(void)
 
   opsdbg << G3_DEBUG_PROMPT << "Domain changed\n";
 
+  // if only elements were added or removed since the model was built,
+  // patch the model for those elements
+  std::vector<int> eleTags;
+  if (modelBuilt && theHandler != nullptr && domain->getElementChanges(eleTags)) {
+    domain->resetElementChanges();
+    if (this->elementsChanged(eleTags) == 0)
+      return 0;
+  }
+  domain->resetElementChanges();
+  modelBuilt = false;
+
   theAnalysisModel->clearAll();
   if (theHandler != nullptr) {
     theHandler->clearAll();
@@ -299,6 +311,81 @@ BasicAnalysisBuilder::domainChanged(void)
 //    return -5;
 //  }
 
+  modelBuilt = true;
+  return 0;
+}
+
+//
+// The integrators keep the committed response of the model they last
+// saw (e.g., U, Udot and Udotdot of Newmark); read it again from a
+// Domain whose nodes and elements received a committed state. When the
+// Domain has changed the model is built again at the next step anyway.
+//
+int
+BasicAnalysisBuilder::domainStateRestored(void)
+{
+  if (!modelBuilt || theDomain->hasDomainChanged() != domainStamp)
+    return 0;
+
+  switch (this->CurrentAnalysisFlag) {
+  case STATIC_ANALYSIS:
+    return theStaticIntegrator->domainChanged();
+
+  case TRANSIENT_ANALYSIS:
+    return theTransientIntegrator->domainChanged();
+
+  default:
+    return 0;
+  }
+}
+
+void
+BasicAnalysisBuilder::clearModel(void)
+{
+  theAnalysisModel->clearAll();
+  if (theHandler != nullptr)
+    theHandler->clearAll();
+
+  domainStamp = 0;
+  modelBuilt  = false;
+}
+
+//
+// Patch the AnalysisModel for the elements with the given tags, which
+// have been added to or removed from the Domain since the model was
+// built. The DOF_Groups and equation numbers are kept, and the SOE is
+// only resized if an added element couples equations that its matrix
+// does not already store. Removing elements never needs a resize; the
+// entries they leave behind are simply assembled as zero. Returns a
+// negative number if the model has to be rebuilt instead.
+//
+int
+BasicAnalysisBuilder::elementsChanged(const std::vector<int> &eleTags)
+{
+  std::vector<FE_Element *> created;
+  if (theHandler->handleElements(eleTags, created) < 0)
+    return -1;
+
+  bool resize = false;
+  for (FE_Element *fePtr : created)
+    if (theSOE == nullptr || !theSOE->hasStructure(fePtr->getID())) {
+      resize = true;
+      break;
+    }
+
+  if (resize) {
+    Graph &theGraph = theAnalysisModel->getDOFGraph();
+    if (theSOE != nullptr && theSOE->setSize(theGraph) < 0) {
+      opserr << "BasicAnalysisBuilder::elementsChanged() - LinearSOE::setSize() failed\n";
+      return -3;
+    }
+    if (theEigenSOE != nullptr && theEigenSOE->setSize(theGraph) < 0)
+      return -3;
+    theAnalysisModel->clearDOFGraph();
+  }
+
+  opsdbg << G3_DEBUG_PROMPT << "Patched model for " << (int)eleTags.size() 
+         << " changed elements" << (resize ? ", system resized\n" : "\n");
   return 0;
 }
 
@@ -638,6 +725,7 @@ BasicAnalysisBuilder::set(ConstraintHandler* obj)
     delete theHandler;
 
   theHandler = obj;
+  modelBuilt = false;
 }
 
 void
@@ -652,6 +740,8 @@ BasicAnalysisBuilder::set(DOF_Numberer* obj)
   theNumberer->setLinks(*theAnalysisModel);
 
   domainStamp = 0;
+
+  modelBuilt = false;
   return;
 }
 
@@ -690,6 +780,9 @@ BasicAnalysisBuilder::set(LinearSOE* obj, bool free)
 
 
   domainStamp = 0;
+
+
+  modelBuilt = false;
 }
 
 
@@ -698,6 +791,11 @@ BasicAnalysisBuilder::getLinearSOE() {
   return theSOE;
 }
 
+AnalysisModel*
+BasicAnalysisBuilder::getAnalysisModel() {
+  return theAnalysisModel;
+}
+
 
 void
 BasicAnalysisBuilder::set(StaticIntegrator& obj)
@@ -712,8 +810,10 @@ BasicAnalysisBuilder::set(StaticIntegrator& obj)
   if (domainStamp != 0 && this->CurrentAnalysisFlag != EMPTY_ANALYSIS)
     theStaticIntegrator->domainChanged();
 
-  else
+  else {
     domainStamp = 0;
+    modelBuilt = false;
+  }
 }
 
 void
@@ -732,8 +832,10 @@ BasicAnalysisBuilder::set(TransientIntegrator& obj, bool free)
   if (domainStamp != 0  && this->CurrentAnalysisFlag != EMPTY_ANALYSIS)
     theTransientIntegrator->domainChanged();
 
-  else
+  else {
     domainStamp = 0;
+    modelBuilt = false;
+  }
 }
 
 void
@@ -765,6 +867,8 @@ BasicAnalysisBuilder::set(EigenSOE &theNewSOE)
     theEigenSOE->setLinearSOE(*theSOE);
 
     domainStamp = 0;
+
+    modelBuilt = false;
   }
 
 }
@@ -818,6 +922,7 @@ int
 BasicAnalysisBuilder::setStaticAnalysis()
 {
   domainStamp = 0;
+  modelBuilt = false;
   this->fillDefaults(STATIC_ANALYSIS);
   this->setLinks(STATIC_ANALYSIS);
 
@@ -830,6 +935,7 @@ int
 BasicAnalysisBuilder::setTransientAnalysis()
 {
   domainStamp = 0;
+  modelBuilt = false;
   this->CurrentAnalysisFlag = TRANSIENT_ANALYSIS;
   this->fillDefaults(TRANSIENT_ANALYSIS);
   this->setLinks(TRANSIENT_ANALYSIS);
@@ -873,6 +979,7 @@ BasicAnalysisBuilder::newEigenAnalysis(int typeSolver, double shift)
 
   if (theEigenSOE == nullptr) {
     domainStamp = 0;
+    modelBuilt = false;
     if (typeSolver == EigenSOE_TAGS_SymBandEigenSOE) {
       SymBandEigenSolver *theEigenSolver = new SymBandEigenSolver();
       theEigenSOE = new SymBandEigenSOE(*theEigenSolver, *theAnalysisModel);
@@ -914,6 +1021,9 @@ BasicAnalysisBuilder::eigen(int numMode, bool generalized, bool findSmallest)
                          //  which isnt updated here
 //    result = this->domainChanged();
 
+    // the next domainChanged() must also be a full one, so that the
+    // integrator sees the rebuilt model
+    modelBuilt = false;
     theAnalysisModel->clearAll();
     theHandler->clearAll();
 
@@ -27,6 +27,8 @@
 #ifndef BasicAnalysisBulider_h
 #define BasicAnalysisBulider_h
 
+#include <vector>
+
 class Domain;
 class G3_Table;
 class ConstraintHandler;
@@ -67,6 +69,7 @@ public:
     void set(EigenSOE& obj);
 
     LinearSOE* getLinearSOE();
+    AnalysisModel* getAnalysisModel();
 
     Domain* getDomain();
     int initialize();
@@ -88,6 +91,12 @@ public:
     ConvergenceTest*     getConvergenceTest();
 
     int domainChanged();
+    // bring the integrator in step with a Domain whose committed state
+    // was received in place, e.g. from a snapshot
+    int domainStateRestored();
+    // drop the model built from the objects of the Domain, e.g. before
+    // the Domain replaces them with ones received from a datastore
+    void clearModel();
 
     // Performing analysis
     int analyze(int num_steps, double size_steps, int flag=Increment|Iterate|Commit);
@@ -106,6 +115,7 @@ public:
 private:
     void setLinks(CurrentAnalysis flag = EMPTY_ANALYSIS);
     void fillDefaults(enum CurrentAnalysis flag);
+    int  elementsChanged(const std::vector<int> &eleTags);
 
     Domain                    *theDomain;
     ConstraintHandler         *theHandler;
@@ -119,6 +129,7 @@ private:
     ConvergenceTest           *theTest;
 
     int domainStamp;
+    bool modelBuilt = false;  // the model may be patched incrementally
     int numEigen = 0;
 
     int numSubLevels = 0;
@@ -24,6 +24,7 @@ class ConstraintHandler;
 class LinearSOE;
 class EigenSOE;
 class DOF_Numberer;
+class FE_Datastore;
 
 
 class G3_Runtime {
@@ -35,6 +36,7 @@ public:
   BasicModelBuilder *m_builder = nullptr;
   Domain            *m_domain  = nullptr;
   bool            model_is_built=false;
+  FE_Datastore   *m_database = nullptr;
 
 // ANALYSIS
   AnalysisModel  *m_analysis_model     = nullptr;
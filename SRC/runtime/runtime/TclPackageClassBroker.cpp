@@ -18,13 +18,8 @@
 #  include <mpi.h>
 #endif
 
-#include <Hash.h>
-using namespace OpenSees::Hash;
-using namespace OpenSees::Hash::literals;
-#define DISPATCH(symbol) case  hasher<std::string>()(#symbol): return new symbol();
-//
-// case hasher<std::string>()(Truss::class_name):  return new Truss();
-//
+// the objects are sent with their class tags, e.g. ELE_TAG_Truss
+#define DISPATCH(symbol) case ELE_TAG_ ## symbol: return new symbol();
 #include "packages.h"
 #include <TclPackageClassBroker.h>
 
@@ -612,7 +607,7 @@ TclPackageClassBroker::getPtrNewGraphNumberer(int classTag)
 Element *
 TclPackageClassBroker::getNewElement(int classTag)
 {
-  switch ((std::size_t)classTag) {
+  switch (classTag) {
 
     DISPATCH(Truss);
     DISPATCH(Truss2);
@@ -647,7 +642,8 @@ TclPackageClassBroker::getNewElement(int classTag)
     DISPATCH(EightNodeQuad);
     DISPATCH(ConstantPressureVolumeQuad);
     DISPATCH(BBarFourNodeQuadUP);
-    DISPATCH(NineFourNodeQuadUP);
+  case ELE_TAG_Nine_Four_Node_QuadUP:
+    return new NineFourNodeQuadUP();
 
 #if defined(OPSDEF_Elements_UW)
     DISPATCH(SSPquad);
@@ -667,7 +663,8 @@ TclPackageClassBroker::getNewElement(int classTag)
     DISPATCH(BbarBrick);
     DISPATCH(BBarBrickUP);
     DISPATCH(BrickUP);
-    DISPATCH(TwentyEightNodeBrickUP);
+  case ELE_TAG_Twenty_Eight_Node_BrickUP:
+    return new TwentyEightNodeBrickUP();
 
 // Shells
     DISPATCH(ShellMITC4);
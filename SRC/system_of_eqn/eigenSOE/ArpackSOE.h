@@ -45,6 +45,8 @@ class ArpackSOE : public EigenSOE
 
     ~ArpackSOE();
 
+    const char *getClassType(void) const {return "ArpackSOE";}
+
     int setLinks(AnalysisModel &theModel);   
     int setLinearSOE(LinearSOE &theSOE);    
 
@@ -13,8 +13,7 @@
 #include <BandArpackSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
-#include <Vertex.h>
-#include <VertexIter.h>
+#include <ID.h>
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -52,14 +51,17 @@ BandArpackSOE::setSize(Graph &theGraph)
     numSubD = 0;
     numSuperD = 0;
 
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-    
-    while ((vertexPtr = theVertices()) != 0) {
-      int vertexNum = vertexPtr->getTag();
-      const ID &theAdjacency = vertexPtr->getAdjacency();
-      for (int i=0; i<theAdjacency.Size(); i++) {
-          int otherNum = theAdjacency(i);
+    const int *adjStart, *adjIndex;
+    if (!theGraph.getCompressed(adjStart, adjIndex)) {
+      opserr << "WARNING BandArpackSOE::setSize - vertices not numbered 0 through "
+             << size-1 << "\n";
+      size = 0;
+      return -1;
+    }
+
+    for (int vertexNum=0; vertexNum<size; vertexNum++) {
+      for (int k=adjStart[vertexNum]; k<adjStart[vertexNum+1]; k++) {
+          int otherNum = adjIndex[k];
           int diff = vertexNum - otherNum;
           if (diff > 0) {
             if (diff > numSuperD)
@@ -34,6 +34,8 @@ class BandArpackSOE : public EigenSOE
 
     virtual ~BandArpackSOE();
 
+    const char *getClassType(void) const {return "BandArpackSOE";}
+
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
     
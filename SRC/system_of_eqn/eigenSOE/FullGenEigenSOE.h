@@ -43,6 +43,8 @@ public:
 
     virtual ~FullGenEigenSOE();
 
+    const char *getClassType(void) const {return "FullGenEigenSOE";}
+
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
 
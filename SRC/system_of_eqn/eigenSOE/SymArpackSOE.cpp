@@ -12,8 +12,7 @@
 #include "SymArpackSolver.h"
 #include <Matrix.h>
 #include <Graph.h>
-#include <Vertex.h>
-#include <VertexIter.h>
+#include <ID.h>
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -70,14 +69,15 @@ SymArpackSOE::setSize(Graph &theGraph)
     int result = 0;
     size = theGraph.getNumVertex();
 
-    // fist itearte through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0) {
-        const ID &theAdjacency = theVertex->getAdjacency();
-      newNNZ += theAdjacency.Size(); 
+    // the adjacency of the graph gives the off-diagonal entries
+    const int *adjStart, *adjIndex;
+    if (!theGraph.getCompressed(adjStart, adjIndex)) {
+      opserr << "WARNING:SymArpackSOE::setSize :";
+      opserr << " vertices not numbered 0 through " << size-1 << " - size set to 0\n";
+      size = 0;
+      return -1;
     }
+    int newNNZ = adjStart[size];
     nnz = newNNZ;
 
     if (colA != 0)
@@ -105,47 +105,10 @@ SymArpackSOE::setSize(Graph &theGraph)
 
     // fill in rowStartA and colA
     if (size != 0) {
-      rowStartA[0] = 0;
-      int startLoc = 0;
-      int lastLoc = 0;
-
-      for (int a=0; a<size; a++) {
-         theVertex = theGraph.getVertexPtr(a);
-         if (theVertex == 0) {
-              opserr << "WARNING:SymArpackSOE::setSize :";
-              opserr << " vertex " << a << " not in graph! - size set to 0\n";
-              size = 0;
-              return -1;
-         }
-
-         const ID &theAdjacency = theVertex->getAdjacency();
-         int idSize = theAdjacency.Size();
-      
-         // now we have to place the entries in the ID into order in colA
-         for (int i=0; i<idSize; i++) {
-            int row = theAdjacency(i);
-            bool foundPlace = false;
-       
-            for (int j=startLoc; j<lastLoc; j++) {
-                if (colA[j] > row) { 
-                  // move the entries already there one further on
-                  // and place col in current location
-                  for (int k=lastLoc; k>j; k--)
-                    colA[k] = colA[k-1];
-                  colA[j] = row;
-                  foundPlace = true;
-                  j = lastLoc;
-              }
-            }
-              
-            if (foundPlace == false) // put in at the end
-              colA[lastLoc] = row;
-
-            lastLoc++;
-         }
-         rowStartA[a+1] = lastLoc;;          
-         startLoc = lastLoc;
-      }
+      for (int a=0; a<=size; a++)
+        rowStartA[a] = adjStart[a];
+      for (int k=0; k<newNNZ; k++)
+        colA[k] = adjIndex[k];
     }
 
     // begin to choose different ordering schema.
@@ -38,6 +38,8 @@ class SymArpackSOE : public EigenSOE
 
     virtual ~SymArpackSOE();
 
+    const char *getClassType(void) const {return "SymArpackSOE";}
+
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
     
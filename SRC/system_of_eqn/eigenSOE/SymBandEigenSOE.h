@@ -45,6 +45,8 @@ class SymBandEigenSOE : public EigenSOE
 
     virtual ~SymBandEigenSOE();
 
+    const char *getClassType(void) const {return "SymBandEigenSOE";}
+
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
     
@@ -32,15 +32,17 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include <Profiler.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
-    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
+    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver),
+     numThreads(1)
 {
 
 }
 
 LinearSOE::LinearSOE(int classtag)
-:MovableObject(classtag), theModel(0), theSolver(0)
+:MovableObject(classtag), theModel(0), theSolver(0), numThreads(1)
 {
 
 }
@@ -55,8 +57,10 @@ LinearSOE::~LinearSOE()
 int 
 LinearSOE::solve(void)
 {
-  if (theSolver != 0)
+  if (theSolver != 0) {
+    OPS_PROFILE(SystemSolve, *this);
     return (theSolver->solve());
+  }
   else 
     return -1;
 }
@@ -91,6 +95,30 @@ LinearSOE::getSolver(void)
     return theSolver;
 }
 
+bool
+LinearSOE::isThreadSafe(void) const
+{
+  return false;
+}
+
+bool
+LinearSOE::hasStructure(const ID &id) const
+{
+  return false;
+}
+
+void
+LinearSOE::setNumThreads(int n)
+{
+  numThreads = n < 1 ? 1 : n;
+}
+
+int
+LinearSOE::getNumThreads(void) const
+{
+  return numThreads;
+}
+
 int 
 LinearSOE::setLinks(AnalysisModel &theModel)
 {
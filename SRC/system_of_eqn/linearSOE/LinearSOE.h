@@ -79,6 +79,20 @@ class LinearSOE : public MovableObject
     virtual void setX(const Vector &X) =0;
     
     LinearSOESolver *getSolver(void);
+
+    // Threaded assembly. An SOE returns true from isThreadSafe() if
+    // addA() and addB() may be called concurrently from several threads
+    // provided the ID arrays passed to the concurrent calls share no
+    // equation numbers.
+    virtual bool isThreadSafe(void) const;
+    void setNumThreads(int numThreads);
+    int  getNumThreads(void) const;
+
+    // Incremental re-analysis. An SOE returns true from hasStructure()
+    // if its matrix already stores every entry coupling the equations
+    // in id, i.e. an FE_Element with that ID can be assembled without
+    // the SOE being resized.
+    virtual bool hasStructure(const ID &id) const;
     
   protected:
     int setSolver(LinearSOESolver &newSolver);	        
@@ -86,6 +100,7 @@ class LinearSOE : public MovableObject
     
   private:
     LinearSOESolver *theSolver;    
+    int numThreads;
 };
 
 
@@ -48,6 +48,27 @@ LinearSOESolver::~LinearSOESolver()
     
 }
 
+double
+LinearSOESolver::getPhaseTime(int phase) const
+{
+    if (phase < 0 || phase >= NumPhases)
+      return 0.0;
+    return phaseTime[phase];
+}
 
+int
+LinearSOESolver::getPhaseCount(int phase) const
+{
+    if (phase < 0 || phase >= NumPhases)
+      return 0;
+    return phaseCount[phase];
+}
 
-
+void
+LinearSOESolver::resetPhaseTimes(void)
+{
+    for (int i=0; i<NumPhases; i++) {
+      phaseTime[i] = 0.0;
+      phaseCount[i] = 0;
+    }
+}
@@ -34,6 +34,7 @@
 #define LinearSOESolver_h
 #include <Logging.h> // TODO: remove
 #include <MovableObject.h>
+#include <chrono>
 class LinearSOE;
 
 class LinearSOESolver : public MovableObject
@@ -45,11 +46,36 @@ class LinearSOESolver : public MovableObject
     virtual int solve(void) = 0;
     virtual int setSize(void) = 0;
     virtual double getDeterminant(void) {return 1.0;};
+
+    // Time (in seconds) spent in, and number of times through, each
+    // phase of the solution since the solver was created or the
+    // times were reset. Solvers which do not time a phase, or do not
+    // separate it from another, report zero for it.
+    enum Phase {Ordering, Symbolic, Numeric, Substitution, NumPhases};
+    double getPhaseTime(int phase) const;
+    int    getPhaseCount(int phase) const;
+    void   resetPhaseTimes(void);
     
   protected:
+    // adds the time from construction to destruction to a phase
+    class PhaseTimer {
+      public:
+        PhaseTimer(LinearSOESolver &solver, Phase phase)
+          : solver(solver), phase(phase), start(std::chrono::steady_clock::now()) {}
+        ~PhaseTimer() {
+          std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+          solver.phaseTime[phase] += elapsed.count();
+          solver.phaseCount[phase]++;
+        }
+      private:
+        LinearSOESolver &solver;
+        Phase phase;
+        std::chrono::steady_clock::time_point start;
+    };
     
   private:
-
+    double phaseTime[NumPhases] {};
+    int    phaseCount[NumPhases] {};
 };
 
 #endif
@@ -27,8 +27,7 @@
 #include <BandGenLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
-#include <Vertex.h>
-#include <VertexIter.h>
+#include <ID.h>
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -126,14 +125,17 @@ BandGenLinSOE::setSize(Graph &theGraph)
     numSubD = 0;
     numSuperD = 0;
 
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-    
-    while ((vertexPtr = theVertices()) != nullptr) {
-        int vertexNum = vertexPtr->getTag();
-        const ID &theAdjacency = vertexPtr->getAdjacency();
-        for (int i=0; i<theAdjacency.Size(); i++) {
-            int otherNum = theAdjacency(i);
+    const int *adjStart, *adjIndex;
+    if (!theGraph.getCompressed(adjStart, adjIndex)) {
+        opserr << "WARNING BandGenLinSOE::setSize - vertices not numbered 0 through "
+               << size-1 << "\n";
+        size = 0;
+        return -1;
+    }
+
+    for (int vertexNum=0; vertexNum<size; vertexNum++) {
+        for (int k=adjStart[vertexNum]; k<adjStart[vertexNum+1]; k++) {
+            int otherNum = adjIndex[k];
             int diff = vertexNum - otherNum;
             if (diff > 0) {
                 if (diff > numSuperD)
@@ -396,6 +398,27 @@ BandGenLinSOE::setB(const Vector &v, double fact)
 }
 
 
+bool
+BandGenLinSOE::hasStructure(const ID &id) const
+{
+    // every pair must lie within the bands
+    int idSize = id.Size();
+    for (int i=0; i<idSize; i++) {
+	int col = id(i);
+	if (col < 0 || col >= size)
+	    continue;
+	for (int j=0; j<idSize; j++) {
+	    int row = id(j);
+	    if (row < 0 || row >= size)
+		continue;
+	    int diff = col - row;
+	    if (diff > numSuperD || -diff > numSubD)
+		return false;
+	}
+    }
+    return true;
+}
+
 void 
 BandGenLinSOE::zeroA(void)
 {
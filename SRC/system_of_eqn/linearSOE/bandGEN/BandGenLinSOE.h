@@ -48,12 +48,16 @@ class BandGenLinSOE : public LinearSOE
     
     virtual ~BandGenLinSOE();
 
+    const char *getClassType(void) const {return "BandGenLinSOE";}
+
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
     
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
+    virtual bool isThreadSafe(void) const {return true;}
+    virtual bool hasStructure(const ID &id) const;
     virtual int setB(const Vector &, double fact = 1.0);        
 
     virtual void zeroA(void);
@@ -47,10 +47,14 @@ class DistributedBandGenLinSOE : public BandGenLinSOE
 
     ~DistributedBandGenLinSOE();
 
+    const char *getClassType(void) const {return "DistributedBandGenLinSOE";}
+
     // these methods need to be rewritten
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);
+    bool isThreadSafe(void) const {return false;}
+    bool hasStructure(const ID &id) const {return false;}
     int setB(const Vector &, double fact = 1.0);            
     void zeroB(void);
     const Vector &getB(void);
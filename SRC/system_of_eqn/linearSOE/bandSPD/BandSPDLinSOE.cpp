@@ -27,8 +27,7 @@
 #include <BandSPDLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
-#include <Vertex.h>
-#include <VertexIter.h>
+#include <ID.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <Logging.h>
@@ -125,14 +124,17 @@ BandSPDLinSOE::setSize(Graph &theGraph)
     size = theGraph.getNumVertex();
     half_band = 0;
     
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-    
-    while ((vertexPtr = theVertices()) != nullptr) {
-        int vertexNum = vertexPtr->getTag();
-        const ID &theAdjacency = vertexPtr->getAdjacency();
-        for (int i=0; i<theAdjacency.Size(); i++) {
-            int otherNum = theAdjacency(i);
+    const int *adjStart, *adjIndex;
+    if (!theGraph.getCompressed(adjStart, adjIndex)) {
+        opserr << "WARNING BandSPDLinSOE::setSize - vertices not numbered 0 through "
+               << size-1 << "\n";
+        size = 0;
+        return -1;
+    }
+
+    for (int vertexNum=0; vertexNum<size; vertexNum++) {
+        for (int k=adjStart[vertexNum]; k<adjStart[vertexNum+1]; k++) {
+            int otherNum = adjIndex[k];
             int diff = vertexNum-otherNum;
             if (half_band < diff)
                 half_band = diff;
@@ -345,6 +347,25 @@ BandSPDLinSOE::setB(const Vector &v, double fact)
     return 0;
 }
 
+bool
+BandSPDLinSOE::hasStructure(const ID &id) const
+{
+    // every pair must lie within the half band
+    int idSize = id.Size();
+    for (int i=0; i<idSize; i++) {
+	int col = id(i);
+	if (col < 0 || col >= size)
+	    continue;
+	int minColRow = col - half_band + 1;
+	for (int j=0; j<idSize; j++) {
+	    int row = id(j);
+	    if (row >= 0 && row <= col && row < minColRow)
+		return false;
+	}
+    }
+    return true;
+}
+
 void 
 BandSPDLinSOE::zeroA(void)
 {
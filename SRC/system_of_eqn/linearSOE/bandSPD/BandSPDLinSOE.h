@@ -54,6 +54,8 @@ class BandSPDLinSOE : public LinearSOE
 
     virtual ~BandSPDLinSOE();
 
+    const char *getClassType(void) const {return "BandSPDLinSOE";}
+
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
 
@@ -61,6 +63,8 @@ class BandSPDLinSOE : public LinearSOE
     virtual int addColA(const Vector &col, int colIndex, double fact = 1.0);
 
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
+    virtual bool isThreadSafe(void) const {return true;}
+    virtual bool hasStructure(const ID &id) const;
     virtual int setB(const Vector &, double fact = 1.0);        
     
     virtual void zeroA(void);
@@ -117,6 +117,7 @@ DiagonalSOE::setSize(Graph &theGraph)
     B[l] = 0;
     X[l] = 0;
   }
+  isAfactored = false;
     
   // invoke setSize() on the Solver
   LinearSOESolver *the_Solver = this->getSolver();
@@ -41,10 +41,14 @@ class DiagonalSOE : public LinearSOE
 
     ~DiagonalSOE();
 
+    const char *getClassType(void) const {return "DiagonalSOE";}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
+    bool isThreadSafe(void) const {return true;}
+    bool hasStructure(const ID &id) const {return true;}
     int setB(const Vector &, double fact = 1.0);        
     
     void zeroA(void);
@@ -49,6 +49,8 @@ class DistributedDiagonalSOE : public LinearSOE
     DistributedDiagonalSOE();
     ~DistributedDiagonalSOE();
 
+    const char *getClassType(void) const {return "DistributedDiagonalSOE";}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
@@ -33,6 +33,8 @@ class MPIDiagonalSOE : public LinearSOE
     MPIDiagonalSOE(MPIDiagonalSolver &theSolver);
     ~MPIDiagonalSOE();
 
+    const char *getClassType(void) const {return "MPIDiagonalSOE";}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     //void testSize(Graph &theGraph);
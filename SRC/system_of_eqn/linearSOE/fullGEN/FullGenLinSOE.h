@@ -52,10 +52,14 @@ class FullGenLinSOE : public LinearSOE
 
     ~FullGenLinSOE();
 
+    const char *getClassType(void) const {return "FullGenLinSOE";}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
+    bool isThreadSafe(void) const {return true;}
+    bool hasStructure(const ID &id) const {return true;}
     int setB(const Vector &, double fact = 1.0);        
     int addColA(const Vector &col, int colIndex, double fact = 1.0);
     
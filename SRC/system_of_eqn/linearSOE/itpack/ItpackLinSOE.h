@@ -43,6 +43,8 @@ class ItpackLinSOE : public LinearSOE
 
     ~ItpackLinSOE();
 
+    const char *getClassType(void) const {return "ItpackLinSOE";}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
@@ -52,6 +52,8 @@ class MumpsParallelSOE : public MumpsSOE
     
     ~MumpsParallelSOE();
 
+    const char *getClassType(void) const {return "MumpsParallelSOE";}
+
     // these methods need to be rewritten
     int setSize(Graph &theGraph);
 
@@ -56,6 +56,8 @@ class MumpsSOE : public LinearSOE
 
     virtual ~MumpsSOE();
 
+    const char *getClassType(void) const {return "MumpsSOE";}
+
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
@@ -39,6 +39,8 @@ class PARDISOGenLinSOE : public LinearSOE
 
     ~PARDISOGenLinSOE();
 
+    const char *getClassType(void) const {return "PARDISOGenLinSOE";}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
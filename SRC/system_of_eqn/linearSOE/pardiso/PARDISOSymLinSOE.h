@@ -46,6 +46,8 @@ public:
 
 	~PARDISOSymLinSOE();
 
+	const char *getClassType(void) const {return "PARDISOSymLinSOE";}
+
 	int getNumEqn(void) const;
 	int setSize(Graph &theGraph);
 	int addA(const Matrix &, const ID &, double fact = 1.0);
@@ -65,6 +65,8 @@ public:
 
     ~PetscSOE();
 
+    const char *getClassType(void) const {return "PetscSOE";}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     int setSize(int MaxDOFtag);
@@ -54,6 +54,8 @@ class ShadowPetscSOE : public LinearSOE
     
     ~ShadowPetscSOE();
 
+    const char *getClassType(void) const {return "ShadowPetscSOE";}
+
     int solve(void);    
 
     int getNumEqn(void) const;
@@ -47,9 +47,13 @@ class DistributedProfileSPDLinSOE : public ProfileSPDLinSOE
     
     ~DistributedProfileSPDLinSOE();
 
+    const char *getClassType(void) const {return "DistributedProfileSPDLinSOE";}
+
     // these methods need to be rewritten
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
+    bool isThreadSafe(void) const {return false;}
+    bool hasStructure(const ID &id) const {return false;}
     int setB(const Vector &, double fact = 1.0);            
     void zeroB(void);
     int setSize(Graph &theGraph);
@@ -28,8 +28,7 @@
 #include <ProfileSPDLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
-#include <Vertex.h>
-#include <VertexIter.h>
+#include <ID.h>
 #include <math.h>
 
 #include <Channel.h>
@@ -142,24 +141,21 @@ ProfileSPDLinSOE::setSize(Graph &theGraph)
     // now we go through the vertices to find the height of each col and
     // width of each row from the connectivity information.
     
-    Vertex *vertexPtr;
-    VertexIter &theVertices = theGraph.getVertices();
-
-    while ((vertexPtr = theVertices()) != 0) {
-	int vertexNum = vertexPtr->getTag();
-	const ID &theAdjacency = vertexPtr->getAdjacency();
-	int iiDiagLoc = iDiagLoc[vertexNum];
-	int *iiDiagLocPtr = &(iDiagLoc[vertexNum]);
-
-	for (int i=0; i<theAdjacency.Size(); i++) {
-	    int otherNum = theAdjacency(i);
-	    int diff = vertexNum-otherNum;
-	    if (diff > 0) {
-		if (iiDiagLoc < diff) {
-		    iiDiagLoc = diff;
-		    *iiDiagLocPtr = diff;
-		}
-	    } 
+    const int *adjStart, *adjIndex;
+    if (!theGraph.getCompressed(adjStart, adjIndex)) {
+	opserr << "WARNING ProfileSPDLinSOE::setSize() - vertices not numbered 0 through ";
+	opserr << size-1 << "\n";
+	size = 0;
+	return -1;
+    }
+
+    // the adjacency is in increasing order, so the first entry of each
+    // vertex gives the height of its column
+    for (int vertexNum=0; vertexNum<size; vertexNum++) {
+	if (adjStart[vertexNum+1] > adjStart[vertexNum]) {
+	    int diff = vertexNum - adjIndex[adjStart[vertexNum]];
+	    if (diff > 0)
+		iDiagLoc[vertexNum] = diff;
 	}
     }
 
@@ -432,6 +428,29 @@ ProfileSPDLinSOE::setB(const Vector &v, double fact)
     return 0;
 }
 
+bool
+ProfileSPDLinSOE::hasStructure(const ID &id) const
+{
+    // every pair must lie within the profile of its column
+    int idSize = id.Size();
+    for (int i=0; i<idSize; i++) {
+	int col = id(i);
+	if (col < 0 || col >= size)
+	    continue;
+	int minColRow;
+	if (col == 0)
+	    minColRow = 0;
+	else
+	    minColRow = col - (iDiagLoc[col] - iDiagLoc[col-1]) +1;
+	for (int j=0; j<idSize; j++) {
+	    int row = id(j);
+	    if (row >= 0 && row <= col && row < minColRow)
+		return false;
+	}
+    }
+    return true;
+}
+
 void 
 ProfileSPDLinSOE::zeroA(void)
 {
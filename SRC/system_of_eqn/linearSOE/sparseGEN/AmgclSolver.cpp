@@ -0,0 +1,403 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <AmgclSolver.h>
+#include <SparseGenRowLinSOE.h>
+#include <AnalysisModel.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Vector.h>
+#include <ID.h>
+#include <classTags.h>
+#include <algorithm>
+
+#define AMGCL_NO_BOOST
+#include <amgcl/backend/builtin.hpp>
+#include <amgcl/adapter/zero_copy.hpp>
+#include <amgcl/amg.hpp>
+#include <amgcl/coarsening/smoothed_aggregation.hpp>
+#include <amgcl/relaxation/ilu0.hpp>
+#include <amgcl/solver/cg.hpp>
+#include <amgcl/solver/bicgstab.hpp>
+#include <amgcl/solver/gmres.hpp>
+
+struct AmgclSolver::Data {
+  typedef amgcl::backend::builtin<double> Backend;
+  typedef amgcl::amg<Backend,
+                     amgcl::coarsening::smoothed_aggregation,
+                     amgcl::relaxation::ilu0> Precond;
+
+  std::vector<ptrdiff_t> ptr, col;      // structure of A as AMGCL indices
+  std::vector<double> val;              // coefficients of the blocked system
+  std::vector<ptrdiff_t> source;        // their index in the SOE, or -1
+  std::shared_ptr<Backend::matrix> A;   // view of the coefficients
+  std::unique_ptr<Precond> P;
+  std::vector<double> rhs, x;
+};
+
+AmgclSolver::AmgclSolver(Method method, double tol, int maxIter, double reuse,
+                         bool rigidBodyModes, int coarseEnough)
+:SparseGenRowLinSolver(SOLVER_TAGS_AmgclSolver),
+ data(new Data()),
+ method(method), tol(tol), maxIter(maxIter), reuse(reuse),
+ rigidBodyModes(rigidBodyModes), coarseEnough(coarseEnough),
+ numModes(0), blockSize(1),
+ setupIterations(0), numIterations(0), residual(0.0)
+{
+
+}
+
+AmgclSolver::~AmgclSolver()
+{
+
+}
+
+int
+AmgclSolver::setSize(void)
+{
+  const int n = theSOE->size;
+  data->P.reset();
+  data->A.reset();
+  data->val.clear();
+  data->source.clear();
+  if (n <= 0)
+    return n == 0 ? 0 : -1;
+
+  PhaseTimer timer(*this, LinearSOESolver::Symbolic);
+
+  if (this->formNullSpace() < 0)
+    return -1;
+
+  if (blockRows.empty()) {
+    // AMGCL takes the structure with its own index type; the values are
+    // used in place
+    data->ptr.assign(theSOE->rowStartA, theSOE->rowStartA + n + 1);
+    data->col.assign(theSOE->colA, theSOE->colA + theSOE->nnz);
+    data->A = amgcl::adapter::zero_copy(n, data->ptr.data(), data->col.data(), theSOE->A);
+    return 0;
+  }
+
+  // the blocked system has the rows of each node together; fixed dofs
+  // get a unit diagonal and no coupling, so their solution is zero
+  const int numRows = blockRows.size();
+  std::vector<ptrdiff_t> rowOf(n);
+  for (int r=0; r<numRows; r++)
+    if (blockRows[r] >= 0)
+      rowOf[blockRows[r]] = r;
+
+  std::vector<ptrdiff_t> &ptr = data->ptr;
+  ptr.assign(numRows + 1, 0);
+  for (int r=0; r<numRows; r++) {
+    const int eq = blockRows[r];
+    ptr[r+1] = ptr[r] + (eq < 0 ? 1 : theSOE->rowStartA[eq+1] - theSOE->rowStartA[eq]);
+  }
+
+  data->col.resize(ptr[numRows]);
+  data->source.resize(ptr[numRows]);
+  data->val.assign(ptr[numRows], 0.0);
+  std::vector<std::pair<ptrdiff_t,ptrdiff_t>> row;
+  for (int r=0; r<numRows; r++) {
+    const int eq = blockRows[r];
+    row.clear();
+    if (eq < 0)
+      row.emplace_back(r, -1);
+    else
+      for (int k=theSOE->rowStartA[eq]; k<theSOE->rowStartA[eq+1]; k++)
+        row.emplace_back(rowOf[theSOE->colA[k]], k);
+
+    // AMGCL expects the columns of each row in order
+    std::sort(row.begin(), row.end());
+    for (std::size_t k=0; k<row.size(); k++) {
+      data->col[ptr[r]+k]    = row[k].first;
+      data->source[ptr[r]+k] = row[k].second;
+    }
+  }
+  data->A = amgcl::adapter::zero_copy(numRows, ptr.data(), data->col.data(), data->val.data());
+
+  return 0;
+}
+
+int
+AmgclSolver::formNullSpace(void)
+{
+  nullSpace.clear();
+  blockRows.clear();
+  numModes = 0;
+  blockSize = 1;
+
+  AnalysisModel *theModel = theSOE->theModel;
+  if (!rigidBodyModes || theModel == nullptr || theModel->getDomainPtr() == nullptr)
+    return 0;
+  Domain *theDomain = theModel->getDomainPtr();
+
+  // the modes are formed about the centroid of the nodes; the rows are
+  // blocked by node when every equation belongs to a node and all the
+  // nodes have the same number of dofs
+  int ndm = 0, numNodes = 0, ndf = -1;
+  bool uniform = true;
+  double center[3] = {0.0, 0.0, 0.0};
+  std::vector<std::pair<int, DOF_Group*>> nodes;
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDOFs = theModel->getDOFs();
+  while ((dofPtr = theDOFs()) != nullptr) {
+    const ID &id = dofPtr->getID();
+    Node *theNode = theDomain->getNode(dofPtr->getNodeTag());
+    if (theNode == nullptr) {
+      uniform = false;
+      continue;
+    }
+    const Vector &crds = theNode->getCrds();
+    ndm = std::max(ndm, std::min(crds.Size(), 3));
+    for (int i=0; i<crds.Size() && i<3; i++)
+      center[i] += crds(i);
+    numNodes++;
+
+    if (ndf < 0)
+      ndf = id.Size();
+    else if (ndf != id.Size())
+      uniform = false;
+
+    // nodes are ordered by their first equation to keep the bandwidth
+    int first = -1;
+    for (int d=0; d<id.Size(); d++)
+      if (id(d) >= 0 && (first < 0 || id(d) < first))
+        first = id(d);
+    if (first >= 0)
+      nodes.emplace_back(first, dofPtr);
+  }
+  if (numNodes == 0)
+    return 0;
+  for (int i=0; i<3; i++)
+    center[i] /= numNodes;
+
+  numModes = ndm == 3 ? 6 : (ndm == 2 ? 3 : 1);
+
+  const int n = theSOE->size;
+  if (uniform && ndf > 1 && int(nodes.size())*ndf >= n) {
+    std::sort(nodes.begin(), nodes.end(),
+              [](const std::pair<int,DOF_Group*> &a, const std::pair<int,DOF_Group*> &b) {
+                return a.first < b.first;
+              });
+    // each equation must appear exactly once
+    std::vector<char> seen(n, 0);
+    int numEqn = 0;
+    blockRows.assign(nodes.size()*ndf, -1);
+    for (std::size_t i=0; i<nodes.size(); i++) {
+      const ID &id = nodes[i].second->getID();
+      for (int d=0; d<ndf; d++) {
+        const int eq = id(d);
+        if (eq >= 0 && eq < n && !seen[eq]) {
+          seen[eq] = 1;
+          blockRows[i*ndf + d] = eq;
+          numEqn++;
+        }
+      }
+    }
+    if (numEqn == n)
+      blockSize = ndf;
+    else
+      blockRows.clear();
+  }
+
+  const std::size_t numRows = blockRows.empty() ? n : blockRows.size();
+  nullSpace.assign(numRows*numModes, 0.0);
+
+  auto addNode = [&](DOF_Group *dofPtr, long row) {
+    Node *theNode = theDomain->getNode(dofPtr->getNodeTag());
+    if (theNode == nullptr)
+      return;
+
+    const Vector &crds = theNode->getCrds();
+    double x[3] = {0.0, 0.0, 0.0};
+    for (int i=0; i<crds.Size() && i<3; i++)
+      x[i] = crds(i) - center[i];
+
+    // nodes with rotations carry them after the translations
+    const ID &id = dofPtr->getID();
+    const int ndf = id.Size();
+    const bool rotations = (ndm == 3 && ndf == 6) || (ndm == 2 && ndf == 3);
+
+    for (int d=0; d<ndf; d++) {
+      // blocked rows are given for every dof of the node, fixed or not
+      const long eq = row < 0 ? id(d) : row + d;
+      if (eq < 0 || eq >= long(numRows))
+        continue;
+      double *b = &nullSpace[std::size_t(eq)*numModes];
+
+      if (d < ndm)
+        b[d] = 1.0;
+      else if (rotations)
+        b[d] = 1.0;
+
+      if (ndm == 3) {
+        // rotations about x, y and z
+        switch (d) {
+          case 0: b[4] =  x[2]; b[5] = -x[1]; break;
+          case 1: b[3] = -x[2]; b[5] =  x[0]; break;
+          case 2: b[3] =  x[1]; b[4] = -x[0]; break;
+        }
+      } else if (ndm == 2) {
+        switch (d) {
+          case 0: b[2] = -x[1]; break;
+          case 1: b[2] =  x[0]; break;
+        }
+      }
+    }
+  };
+
+  if (!blockRows.empty()) {
+    for (std::size_t i=0; i<nodes.size(); i++)
+      addNode(nodes[i].second, i*blockSize);
+  } else {
+    DOF_GrpIter &theDOFs2 = theModel->getDOFs();
+    while ((dofPtr = theDOFs2()) != nullptr)
+      addNode(dofPtr, -1);
+  }
+  return 0;
+}
+
+void
+AmgclSolver::setup(void)
+{
+  PhaseTimer timer(*this, LinearSOESolver::Numeric);
+
+  Data::Precond::params prm;
+  if (numModes > 0) {
+    prm.coarsening.nullspace.cols = numModes;
+    prm.coarsening.nullspace.B = nullSpace;
+    // aggregate whole nodes; with scalar aggregates of 1 dof each
+    // aggregate still carries all the modes and the levels hardly coarsen
+    prm.coarsening.aggr.block_size = blockSize;
+    // the modes carry the coupling of the dofs of a node, so every
+    // connection is taken as strong
+    prm.coarsening.aggr.eps_strong = 0.0;
+  }
+  // the coarsest level is solved with a skyline LU, whose cost grows
+  // with the square of its bandwidth
+  if (coarseEnough > 0)
+    prm.coarse_enough = coarseEnough;
+  data->P.reset(new Data::Precond(*data->A, prm));
+}
+
+void
+AmgclSolver::iterate(void)
+{
+  PhaseTimer timer(*this, LinearSOESolver::Substitution);
+
+  typedef Data::Backend Backend;
+  const int n = blockRows.empty() ? theSOE->size : int(blockRows.size());
+  std::vector<double> &rhs = data->rhs;
+  std::vector<double> &x = data->x;
+  if (blockRows.empty())
+    rhs.assign(theSOE->B, theSOE->B + n);
+  else {
+    rhs.assign(n, 0.0);
+    for (int r=0; r<n; r++)
+      if (blockRows[r] >= 0)
+        rhs[r] = theSOE->B[blockRows[r]];
+  }
+  x.assign(n, 0.0);
+
+  std::size_t iters = 0;
+  switch (method) {
+    case BiCGStab: {
+      amgcl::solver::bicgstab<Backend>::params prm;
+      prm.tol = tol;
+      prm.maxiter = maxIter;
+      amgcl::solver::bicgstab<Backend> krylov(n, prm);
+      std::tie(iters, residual) = krylov(*data->A, *data->P, rhs, x);
+      break;
+    }
+    case GMRES: {
+      amgcl::solver::gmres<Backend>::params prm;
+      prm.tol = tol;
+      prm.maxiter = maxIter;
+      amgcl::solver::gmres<Backend> krylov(n, prm);
+      std::tie(iters, residual) = krylov(*data->A, *data->P, rhs, x);
+      break;
+    }
+    default: {
+      amgcl::solver::cg<Backend>::params prm;
+      prm.tol = tol;
+      prm.maxiter = maxIter;
+      amgcl::solver::cg<Backend> krylov(n, prm);
+      std::tie(iters, residual) = krylov(*data->A, *data->P, rhs, x);
+      break;
+    }
+  }
+  numIterations = static_cast<int>(iters);
+  if (blockRows.empty())
+    std::copy(x.begin(), x.end(), theSOE->X);
+  else
+    for (int r=0; r<n; r++)
+      if (blockRows[r] >= 0)
+        theSOE->X[blockRows[r]] = x[r];
+}
+
+int
+AmgclSolver::solve(void)
+{
+  const int n = theSOE->size;
+  if (n == 0)
+    return 0;
+
+  if (data->A == nullptr) {
+    opserr << "WARNING AmgclSolver::solve() - setSize() has not been called\n";
+    return -1;
+  }
+
+  // the blocked system takes the current coefficients of the SOE
+  for (std::size_t k=0; k<data->source.size(); k++)
+    data->val[k] = data->source[k] < 0 ? 1.0 : theSOE->A[data->source[k]];
+
+  // keep the hierarchy of an earlier tangent while it still works
+  bool fresh = false;
+  if (data->P == nullptr
+      || (!theSOE->factored && (reuse <= 0.0 || numIterations > reuse*std::max(setupIterations, 1)))) {
+    this->setup();
+    fresh = true;
+  }
+
+  this->iterate();
+
+  if (!(residual <= tol) && !fresh) {
+    this->setup();
+    fresh = true;
+    this->iterate();
+  }
+
+  if (fresh)
+    setupIterations = numIterations;
+
+  theSOE->factored = true;
+
+  if (!(residual <= tol)) {
+    opserr << "WARNING AmgclSolver::solve() - no convergence in "
+           << numIterations << " iterations, residual " << residual << "\n";
+    return -1;
+  }
+  return 0;
+}
+
+int
+AmgclSolver::sendSelf(int cTag, Channel &theChannel)
+{
+  // nothing to do
+  return 0;
+}
+
+int
+AmgclSolver::recvSelf(int ctag,
+                      Channel &theChannel,
+                      FEM_ObjectBroker &theBroker)
+{
+  // nothing to do
+  return 0;
+}
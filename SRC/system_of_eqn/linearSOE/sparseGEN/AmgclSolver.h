@@ -0,0 +1,87 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: AmgclSolver solves a SparseGenRowLinSOE with a Krylov
+// method (CG, BiCGStab or GMRES) preconditioned by smoothed aggregation
+// algebraic multigrid from the bundled AMGCL library. Unlike the direct
+// solvers its memory grows only linearly with the number of equations,
+// which makes it the solver of choice for large 3d continuum models.
+//
+// The rigid body modes of the model, formed from the coordinates of the
+// nodes, are given to the aggregation as the near null space, so that
+// the coarse levels can represent the translations and rotations that
+// the smoothers cannot reduce. When all the nodes have the same number
+// of dofs, AMGCL is given a copy of the system with the rows of each node
+// together, fixed dofs included, and aggregates whole nodes. The levels
+// are smoothed with ILU(0); the cheaper SPAI(0) needs over ten times as many
+// iterations on solid models, more than the modes save. The near null
+// space relies on the fix to tentative_prolongation.hpp noted in
+// OTHER/AMGCL/README.md.
+//
+// Setting up the hierarchy usually costs more than a few iterations, so
+// when the tangent changes the hierarchy of an earlier tangent is kept
+// as long as the number of iterations stays within a factor (reuse) of
+// the number needed right after the hierarchy was built. It is rebuilt
+// when that is exceeded, when the iterations fail to converge, or when
+// the structure of the SOE changes.
+//
+// Written: cmp
+//
+#ifndef AmgclSolver_h
+#define AmgclSolver_h
+
+#include <SparseGenRowLinSolver.h>
+#include <vector>
+#include <memory>
+
+class AmgclSolver : public SparseGenRowLinSolver
+{
+  public:
+    enum Method {CG, BiCGStab, GMRES};
+
+    AmgclSolver(Method method = CG,
+                double tol = 1.0e-8,
+                int maxIter = 1000,
+                double reuse = 2.0,
+                bool rigidBodyModes = true,
+                int coarseEnough = 500);
+    ~AmgclSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int getNumIterations(void) const {return numIterations;}
+    double getResidual(void) const {return residual;}
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+  private:
+    int  formNullSpace(void);
+    void setup(void);
+    void iterate(void);
+
+    struct Data;                 // AMGCL types, kept out of this header
+    std::unique_ptr<Data> data;
+
+    Method method;
+    double tol;
+    int    maxIter;
+    double reuse;
+    bool   rigidBodyModes;
+    int    coarseEnough;         // largest level solved directly
+
+    std::vector<double> nullSpace; // numModes values for each row
+    int    numModes;
+    std::vector<int> blockRows;  // equation of each blocked row, or -1
+    int    blockSize;            // dofs per node when blocked, else 1
+
+    int    setupIterations;      // iterations with a fresh hierarchy
+    int    numIterations;        // iterations of the last solve
+    double residual;             // relative residual of the last solve
+};
+
+#endif
@@ -48,10 +48,14 @@ class DistributedSparseGenColLinSOE : public SparseGenColLinSOE
     
     ~DistributedSparseGenColLinSOE();
 
+    const char *getClassType(void) const {return "DistributedSparseGenColLinSOE";}
+
     // these methods need to be rewritten
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
+    bool isThreadSafe(void) const {return false;}
+    bool hasStructure(const ID &id) const {return false;}
     int setB(const Vector &, double fact = 1.0);            
     const Vector &getB(void);
     void zeroB(void);
@@ -48,6 +48,8 @@ class DistributedSparseGenRowLinSOE : public LinearSOE
     DistributedSparseGenRowLinSOE(DistributedSparseGenRowLinSolver &theSolver);        
     ~DistributedSparseGenRowLinSOE();
 
+    const char *getClassType(void) const {return "DistributedSparseGenRowLinSOE";}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
@@ -49,6 +49,8 @@ class PFEMCompressibleLinSOE : public PFEMLinSOE
 
     virtual ~PFEMCompressibleLinSOE();
 
+    const char *getClassType(void) const {return "PFEMCompressibleLinSOE";}
+
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual void zeroA(void);
     
@@ -47,6 +47,8 @@ class PFEMDiaLinSOE : public PFEMLinSOE
 
     virtual ~PFEMDiaLinSOE();
 
+    const char *getClassType(void) const {return "PFEMDiaLinSOE";}
+
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual void zeroA(void);
     
@@ -49,6 +49,8 @@ public:
 
     virtual ~PFEMGeneralLinSOE();
 
+    const char *getClassType(void) const {return "PFEMGeneralLinSOE";}
+
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual void zeroA(void);
 
@@ -55,6 +55,8 @@ class PFEMLinSOE : public LinearSOE
 
     virtual ~PFEMLinSOE();
 
+    const char *getClassType(void) const {return "PFEMLinSOE";}
+
     virtual int solve(void);
 
     virtual int getNumEqn(void) const;
@@ -44,6 +44,8 @@ class PFEMQuasiLinSOE : public PFEMLinSOE
 
     virtual ~PFEMQuasiLinSOE();
 
+    const char *getClassType(void) const {return "PFEMQuasiLinSOE";}
+
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual void zeroA(void);
     
@@ -48,6 +48,8 @@ class PFEMUnifiedLinSOE : public PFEMLinSOE
 
     virtual ~PFEMUnifiedLinSOE();
 
+    const char *getClassType(void) const {return "PFEMUnifiedLinSOE";}
+
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual void zeroA(void);
     
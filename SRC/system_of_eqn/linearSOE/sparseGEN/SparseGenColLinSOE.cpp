@@ -31,12 +31,14 @@
 //
 #include <assert.h>
 #include <stdlib.h>
+#include <vector>
+#include <algorithm>
 #include <SparseGenColLinSOE.h>
 #include <SparseGenColLinSolver.h>
 #include <Matrix.h>
+#include <AnalysisModel.h>
 #include <Graph.h>
-#include <Vertex.h>
-#include <VertexIter.h>
+#include <ID.h>
 #include <math.h>
 
 #include <Channel.h>
@@ -49,7 +51,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &the_Solver)
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), structureStamp(0)
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -60,7 +62,7 @@ SparseGenColLinSOE::SparseGenColLinSOE()
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), structureStamp(0)
 {
 
 }
@@ -70,7 +72,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(int classTag)
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), structureStamp(0)
 {
 
 }
@@ -81,7 +83,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &the_Solver, int cl
    size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
    vectX(0), vectB(0),
    Asize(0), Bsize(0),
-   factored(false)
+   factored(false), structureStamp(0)
 {
   //    the_Solver.setLinearSOE(*this);
 }
@@ -94,7 +96,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(int N, int NNZ, int *ColStartA, int *RowA
  rowA(RowA), colStartA(ColStartA), 
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), structureStamp(0)
 {
 
     A = new double[NNZ]{};
@@ -150,14 +152,21 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
     int oldSize = size;
     size = theGraph.getNumVertex();
 
-    // fist itearte through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0) {
-        const ID &theAdjacency = theVertex->getAdjacency();
-        newNNZ += theAdjacency.Size() +1; // the +1 is for the diag entry
+    // keep the old pattern to see if it changes
+    std::vector<int> oldColStart, oldRow;
+    if (colStartA != 0 && oldSize > 0) {
+      oldColStart.assign(colStartA, colStartA + oldSize+1);
+      oldRow.assign(rowA, rowA + colStartA[oldSize]);
     }
+
+    // the adjacency of the graph gives the off-diagonal entries
+    const int *adjStart, *adjIndex;
+    if (!theGraph.getCompressed(adjStart, adjIndex)) {
+      size = 0;
+      structureStamp++;
+      return -1;
+    }
+    int newNNZ = adjStart[size] + size; // the + size is for the diag entries
     nnz = newNNZ;
 
     if (newNNZ > Asize) { // we have to get more space for A and rowA
@@ -201,52 +210,28 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
         vectB = new Vector(B,size);        
     }
 
-    // fill in colStartA and rowA
+    // fill in colStartA and rowA, placing the diag in order
     if (size != 0) {
-      colStartA[0] = 0;
-      int startLoc = 0;
       int lastLoc = 0;
       for (int a=0; a<size; a++) {
-
-        theVertex = theGraph.getVertexPtr(a);
-        if (theVertex == 0) {
-          // opserr << "WARNING:SparseGenColLinSOE::setSize :";
-          // opserr << " vertex " << a << " not in graph! - size set to 0\n";
-          size = 0;
-          return -1;
-        }
-
-        rowA[lastLoc++] = theVertex->getTag(); // place diag in first
-        const ID &theAdjacency = theVertex->getAdjacency();
-        int idSize = theAdjacency.Size();
-        
-        // now we have to place the entries in the ID into order in rowA
-        for (int i=0; i<idSize; i++) {
-
-          int row = theAdjacency(i);
-          bool foundPlace = false;
-          // find a place in rowA for current col
-          for (int j=startLoc; j<lastLoc; j++)
-            if (rowA[j] > row) { 
-              // move the entries already there one further on
-              // and place col in current location
-              for (int k=lastLoc; k>j; k--)
-                
-                rowA[k] = rowA[k-1];
-              rowA[j] = row;
-              foundPlace = true;
-              j = lastLoc;
-            }
-          if (foundPlace == false) // put in at the end
-            rowA[lastLoc] = row;
-
-          lastLoc++;
-        }
-        colStartA[a+1] = lastLoc;;            
-        startLoc = lastLoc;
+        colStartA[a] = lastLoc;
+        int k = adjStart[a];
+        for ( ; k<adjStart[a+1] && adjIndex[k] < a; k++)
+          rowA[lastLoc++] = adjIndex[k];
+        rowA[lastLoc++] = a;
+        for ( ; k<adjStart[a+1]; k++)
+          rowA[lastLoc++] = adjIndex[k];
       }
+      colStartA[size] = lastLoc;
     }
 
+    if (oldColStart.size() != (std::size_t)size+1
+        || !std::equal(oldColStart.begin(), oldColStart.end(), colStartA)
+        || !std::equal(oldRow.begin(), oldRow.end(), rowA))
+      structureStamp++;
+
+    if (theModel != nullptr)
+      scatterMap.build(*theModel, colStartA, rowA, size, true);
     
     // invoke setSize() on the Solver    
     LinearSOESolver *the_Solver = this->getSolver();
@@ -271,6 +256,9 @@ SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
     if (fact == 0.0)  
         return 0;
 
+    if (scatterMap.add(A, m, id, fact))
+        return 0;
+
     int idSize = id.Size();
  
     if (fact == 1.0) { // do not need to multiply 
@@ -377,6 +365,12 @@ SparseGenColLinSOE::setB(const Vector &v, double fact)
     return 0;
 }
 
+bool
+SparseGenColLinSOE::hasStructure(const ID &id) const
+{
+    return SparseScatterMap::hasEntries(id, colStartA, rowA, size, true);
+}
+
 void 
 SparseGenColLinSOE::zeroA(void)
 {
@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <SparseScatterMap.h>
 
 class SparseGenColLinSolver;
 
@@ -53,10 +54,14 @@ class SparseGenColLinSOE : public LinearSOE
 
     virtual ~SparseGenColLinSOE();
 
+    const char *getClassType(void) const {return "SparseGenColLinSOE";}
+
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
+    virtual bool isThreadSafe(void) const {return true;}
+    virtual bool hasStructure(const ID &id) const;
     virtual int setB(const Vector &, double fact = 1.0);        
     
     virtual void zeroA(void);
@@ -86,6 +91,7 @@ class SparseGenColLinSOE : public LinearSOE
 #endif
 #endif
     friend class PFEMSolver;
+    friend class SupernodalSolver;
 
   protected:
     int size;            // order of A
@@ -96,8 +102,10 @@ class SparseGenColLinSOE : public LinearSOE
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
+    int structureStamp;  // changed when setSize() changes rowA or colStartA
     
   private:
+    SparseScatterMap scatterMap; // locations in A of the element entries
 
 };
 
@@ -26,9 +26,9 @@
 #include <SparseGenRowLinSOE.h>
 #include <SparseGenRowLinSolver.h>
 #include <Matrix.h>
+#include <AnalysisModel.h>
 #include <Graph.h>
-#include <Vertex.h>
-#include <VertexIter.h>
+#include <ID.h>
 #include <math.h>
 #include <assert.h>
 
@@ -128,14 +128,13 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
     int oldSize = size;
     size = theGraph.getNumVertex();
 
-    // fist itearte through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int newNNZ = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0) {
-	const ID &theAdjacency = theVertex->getAdjacency();
-	newNNZ += theAdjacency.Size() +1; // the +1 is for the diag entry
+    // the adjacency of the graph gives the off-diagonal entries
+    const int *adjStart, *adjIndex;
+    if (!theGraph.getCompressed(adjStart, adjIndex)) {
+      size = 0;
+      return -1;
     }
+    int newNNZ = adjStart[size] + size; // the + size is for the diag entries
     nnz = newNNZ;
 
     if (newNNZ > Asize) { // we have to get more space for A and colA
@@ -189,51 +188,24 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
 	vectB = new Vector(B,size);	
     }
 
-    // fill in rowStartA and colA
+    // fill in rowStartA and colA, placing the diag in order
     if (size != 0) {
-      rowStartA[0] = 0;
-      int startLoc = 0;
       int lastLoc = 0;
       for (int a=0; a<size; a++) {
-
-	theVertex = theGraph.getVertexPtr(a);
-	if (theVertex == 0) {
-	  // opserr << "WARNING:SparseGenRowLinSOE::setSize :";
-	  // opserr << " vertex " << a << " not in graph! - size set to 0\n";
-	  size = 0;
-	  return -1;
-	}
-
-	colA[lastLoc++] = theVertex->getTag(); // place diag in first
-	const ID &theAdjacency = theVertex->getAdjacency();
-	int idSize = theAdjacency.Size();
-	
-	// now we have to place the entries in the ID into order in colA
-	for (int i=0; i<idSize; i++) {
-
-	  int  row = theAdjacency(i);
-	  bool foundPlace = false;
-	  // find a place in colA for current col
-	  for (int j=startLoc; j<lastLoc; j++)
-	    if (colA[j] > row) { 
-	      // move the entries already there one further on
-	      // and place col in current location
-	      for (int k=lastLoc; k>j; k--)
-		colA[k] = colA[k-1];
-	      colA[j] = row;
-	      foundPlace = true;
-	      j = lastLoc;
-	    }
-	  if (foundPlace == false) // put in at the end
-	    colA[lastLoc] = row;
-
-	  lastLoc++;
-	}
-	rowStartA[a+1] = lastLoc;;	    
-	startLoc = lastLoc;
+	rowStartA[a] = lastLoc;
+	int k = adjStart[a];
+	for ( ; k<adjStart[a+1] && adjIndex[k] < a; k++)
+	  colA[lastLoc++] = adjIndex[k];
+	colA[lastLoc++] = a;
+	for ( ; k<adjStart[a+1]; k++)
+	  colA[lastLoc++] = adjIndex[k];
       }
+      rowStartA[size] = lastLoc;
     }
 
+    if (theModel != nullptr)
+      scatterMap.build(*theModel, rowStartA, colA, size, false);
+
     // invoke setSize() on the Solver   
      LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -254,6 +226,9 @@ SparseGenRowLinSOE::addA(const Matrix &m, const ID &id, double fact)
     if (fact == 0.0)  
 	return 0;
 
+    if (scatterMap.add(A, m, id, fact))
+	return 0;
+
     const int idSize = id.Size();
     
     // check that m and id are of similar size
@@ -368,6 +343,12 @@ SparseGenRowLinSOE::setB(const Vector &v, double fact)
     return 0;
 }
 
+bool
+SparseGenRowLinSOE::hasStructure(const ID &id) const
+{
+    return SparseScatterMap::hasEntries(id, rowStartA, colA, size, false);
+}
+
 void 
 SparseGenRowLinSOE::zeroA(void)
 {
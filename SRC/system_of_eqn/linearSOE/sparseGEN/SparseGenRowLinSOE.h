@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <SparseScatterMap.h>
 
 class SparseGenRowLinSolver;
 
@@ -48,10 +49,14 @@ class SparseGenRowLinSOE : public LinearSOE
 
     ~SparseGenRowLinSOE();
 
+    const char *getClassType(void) const {return "SparseGenRowLinSOE";}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
+    bool isThreadSafe(void) const {return true;}
+    bool hasStructure(const ID &id) const;
     int setB(const Vector &, double fact = 1.0);        
     
     void zeroA(void);
@@ -71,6 +76,7 @@ class SparseGenRowLinSOE : public LinearSOE
     friend class CulaSparseSolverS4;    
     friend class CulaSparseSolverS5;    
 	friend class CuSPSolver;
+    friend class AmgclSolver;
 
   protected:
     
@@ -83,6 +89,7 @@ class SparseGenRowLinSOE : public LinearSOE
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
+    SparseScatterMap scatterMap; // locations in A of the element entries
 };
 
 
@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <SparseScatterMap.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <Matrix.h>
+#include <ID.h>
+
+void
+SparseScatterMap::clear(void)
+{
+  entries.clear();
+  ids.clear();
+  slots.clear();
+}
+
+void
+SparseScatterMap::build(AnalysisModel &theModel,
+                        const int *start, const int *index, int size, bool columns)
+{
+  this->clear();
+
+  FE_Element *elePtr;
+  FE_EleIter &theEles = theModel.getFEs();
+  while ((elePtr = theEles()) != nullptr)
+    this->insert(elePtr->getID(), start, index, size, columns);
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDOFs = theModel.getDOFs();
+  while ((dofPtr = theDOFs()) != nullptr)
+    this->insert(dofPtr->getID(), start, index, size, columns);
+}
+
+void
+SparseScatterMap::insert(const ID &id,
+                         const int *start, const int *index, int size, bool columns)
+{
+  const int n = id.Size();
+  Entry entry {ids.size(), slots.size(), n};
+
+  for (int i=0; i<n; i++)
+    ids.push_back(id(i));
+
+  // slots are stored in the (column-major) order of the matrix data
+  for (int c=0; c<n; c++) {
+    for (int r=0; r<n; r++) {
+      slots.push_back(find(id(r), id(c), start, index, size, columns));
+    }
+  }
+
+  entries[&id] = entry;
+}
+
+int
+SparseScatterMap::find(int row, int col,
+                       const int *start, const int *index, int size, bool columns)
+{
+  if (row < 0 || row >= size || col < 0 || col >= size)
+    return -1;
+
+  const int line  = columns ? col : row;
+  const int other = columns ? row : col;
+  for (int k=start[line]; k<start[line+1]; k++)
+    if (index[k] == other)
+      return k;
+  return -1;
+}
+
+bool
+SparseScatterMap::hasEntries(const ID &id,
+                             const int *start, const int *index, int size, bool columns)
+{
+  const int n = id.Size();
+  for (int c=0; c<n; c++) {
+    if (id(c) < 0 || id(c) >= size)
+      continue;
+    for (int r=0; r<n; r++)
+      if (id(r) >= 0 && id(r) < size
+          && find(id(r), id(c), start, index, size, columns) < 0)
+        return false;
+  }
+  return true;
+}
+
+bool
+SparseScatterMap::add(double *A, const Matrix &m, const ID &id, double fact) const
+{
+  auto found = entries.find(&id);
+  if (found == entries.end())
+    return false;
+
+  const Entry &entry = found->second;
+  const int n = entry.size;
+  if (n != id.Size() || n != m.noRows() || n != m.noCols())
+    return false;
+
+  for (int i=0; i<n; i++)
+    if (ids[entry.first+i] != id(i))
+      return false;
+
+  const int *loc = &slots[entry.slot];
+  if (fact == 1.0) {
+    for (int c=0; c<n; c++)
+      for (int r=0; r<n; r++, loc++)
+        if (*loc >= 0)
+          A[*loc] += m(r,c);
+  } else {
+    for (int c=0; c<n; c++)
+      for (int r=0; r<n; r++, loc++)
+        if (*loc >= 0)
+          A[*loc] += fact*m(r,c);
+  }
+  return true;
+}
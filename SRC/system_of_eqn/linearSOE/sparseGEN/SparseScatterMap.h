@@ -0,0 +1,65 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SparseScatterMap records, for the ID of every FE_Element
+// and DOF_Group in an AnalysisModel, the location in a compressed
+// sparse (row or column) array of each entry of the matrix that is
+// assembled with that ID. Once built, addA() on a sparse SOE reduces to
+// a gather/scatter instead of a search of the row or column for every
+// entry.
+//
+// The map is keyed on the address of the ID returned by getID(); the
+// contents of the ID are compared on lookup, so an ID which was not
+// recorded (or has changed since) is reported as missing and the SOE
+// falls back to searching.
+//
+// Written: cmp
+//
+#ifndef SparseScatterMap_h
+#define SparseScatterMap_h
+
+#include <vector>
+#include <unordered_map>
+
+class AnalysisModel;
+class Matrix;
+class ID;
+
+class SparseScatterMap
+{
+  public:
+    void clear(void);
+
+    // start/index are the compressed storage arrays of an order size
+    // system; columns is true if start points to the columns (CSC),
+    // false if it points to the rows (CSR).
+    void build(AnalysisModel &theModel,
+               const int *start, const int *index, int size, bool columns);
+
+    // A += fact*m for the entries of m addressed by id; returns false
+    // without touching A if id has not been recorded.
+    bool add(double *A, const Matrix &m, const ID &id, double fact) const;
+
+    // true if the compressed storage holds every entry coupling the
+    // equations in id
+    static bool hasEntries(const ID &id,
+                           const int *start, const int *index, int size, bool columns);
+
+  private:
+    void insert(const ID &id, const int *start, const int *index, int size, bool columns);
+    static int find(int row, int col, const int *start, const int *index, int size, bool columns);
+
+    struct Entry {
+      std::size_t first; // location of the ID in ids
+      std::size_t slot;  // location of the first entry in slots
+      int size;
+    };
+    std::unordered_map<const ID *, Entry> entries;
+    std::vector<int> ids;
+    std::vector<int> slots; // -1 if the entry is not stored
+};
+
+#endif
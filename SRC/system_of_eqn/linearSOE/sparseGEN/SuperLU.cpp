@@ -81,7 +81,7 @@ SuperLU::SuperLU(int perm,
 		 int relx, 
 		 char symm)
 :SparseGenColLinSolver(SOLVER_TAGS_SuperLU),
- perm_r(0),perm_c(0), etree(0), sizePerm(0),
+ perm_r(0),perm_c(0), etree(0), sizePerm(0), permStamp(-1),
  relax(relx), permSpec(perm), panelSize(panel), 
  drop_tol(drop_tolerance), symmetric(symm)
 {
@@ -228,8 +228,11 @@ SuperLU::solve(void)
 	  Destroy_CompCol_Matrix(&U);	  
 	}
 
-	dgstrf(&options, &AC, relax, panelSize,
-	       etree, NULL, 0, perm_c, perm_r, &L, &U, &Glu, &stat, &info);
+	{
+	  PhaseTimer timer(*this, Numeric);
+	  dgstrf(&options, &AC, relax, panelSize,
+	         etree, NULL, 0, perm_c, perm_r, &L, &U, &Glu, &stat, &info);
+	}
 
 
 	if (info != 0) {	
@@ -249,7 +252,10 @@ SuperLU::solve(void)
     // do forward and backward substitution
     trans_t trans = NOTRANS;
     int info;
-    dgstrs (trans, &L, &U, perm_c, perm_r, &B, &stat, &info);    
+    {
+      PhaseTimer timer(*this, Substitution);
+      dgstrs (trans, &L, &U, perm_c, perm_r, &B, &stat, &info);    
+    }
 
     if (info != 0) {	
        opserr << "WARNING SuperLU::solve(void)- ";
@@ -295,24 +301,46 @@ SuperLU::setSize()
       }
 
       // initialisation
-      StatInit(&stat);
+      if (permStamp == -1)
+        StatInit(&stat);
+
+      // release the matrices formed for the previous structure
+      if (A.ncol != 0)
+	SUPERLU_FREE(A.Store);
+      if (B.ncol != 0)
+	SUPERLU_FREE(B.Store);
+      if (AC.ncol != 0) {
+	NCPformat *ACstore = (NCPformat *)AC.Store;
+	SUPERLU_FREE(ACstore->colbeg);
+	SUPERLU_FREE(ACstore->colend);
+	SUPERLU_FREE(ACstore);
+      }
 
       // create the SuperMatrix A	
       dCreate_CompCol_Matrix(&A, n, n, theSOE->nnz, theSOE->A, 
 			     theSOE->rowA, theSOE->colStartA, 
 			     SLU_NC, SLU_D, SLU_GE);
 
-      // obtain and apply column permutation to give SuperMatrix AC
-      get_perm_c(permSpec, &A, perm_c);
+      // obtain the column permutation, unless the pattern is
+      // the same as the one it was obtained for
+      if (permStamp != theSOE->structureStamp) {
+	PhaseTimer timer(*this, Ordering);
+	get_perm_c(permSpec, &A, perm_c);
+	permStamp = theSOE->structureStamp;
 
-      sp_preorder(&options, &A, perm_c, etree, &AC);
+	// set the refact variable to 'N' after first factorization with new size 
+	// can set to 'Y'.
+	options.Fact = DOFACT;
+      }
+
+      // apply the column permutation to give SuperMatrix AC
+      {
+	PhaseTimer timer(*this, Symbolic);
+	sp_preorder(&options, &A, perm_c, etree, &AC);
+      }
 
       // create the rhs SuperMatrix B 
       dCreate_Dense_Matrix(&B, n, 1, theSOE->X, n, SLU_DN, SLU_D, SLU_GE);
-	
-      // set the refact variable to 'N' after first factorization with new size 
-      // can set to 'Y'.
-      options.Fact = DOFACT;
 
       if (symmetric == 'Y')
 	options.SymmetricMode=YES;
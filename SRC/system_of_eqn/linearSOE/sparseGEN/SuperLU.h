@@ -72,6 +72,7 @@ class SuperLU : public SparseGenColLinSolver
     int *perm_c;
     int *etree;
     int sizePerm;
+    int permStamp;       // SOE structure perm_c was formed for
     int relax, permSpec, panelSize;
     double drop_tol;
     char symmetric;
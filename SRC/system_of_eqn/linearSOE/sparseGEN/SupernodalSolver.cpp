@@ -0,0 +1,830 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <SupernodalSolver.h>
+#include <SparseGenColLinSOE.h>
+#include <classTags.h>
+#include <blasdecl.h>
+#include <threads/global_pool.hpp>
+#include <algorithm>
+#include <queue>
+#include <cmath>
+
+// bundled METIS 4
+extern "C" void METIS_NodeND(int *nvtxs, int *xadj, int *adjncy, int *numflag,
+                             int *options, int *perm, int *iperm);
+
+// columns eliminated between Level 3 updates of a front
+static constexpr int panelWidth = 64;
+
+// fewest columns of a front update worth handing to another thread
+static constexpr int minColumnsPerBlock = 64;
+
+// a diagonal pivot is kept unless it is smaller than this fraction of
+// the largest entry of its column among the rows of the supernode
+static constexpr double pivotThreshold = 0.1;
+
+SupernodalSolver::SupernodalSolver(bool symmetric)
+:SparseGenColLinSolver(SOLVER_TAGS_SupernodalSolver),
+ symmetric(symmetric), symbolicStamp(-1), size(0), pivotsOrdered(false), numSuper(0)
+{
+
+}
+
+SupernodalSolver::~SupernodalSolver()
+{
+
+}
+
+int
+SupernodalSolver::setLinearSOE(SparseGenColLinSOE &theSOE)
+{
+  symbolicStamp = -1;
+  return this->SparseGenColLinSolver::setLinearSOE(theSOE);
+}
+
+int
+SupernodalSolver::setSize(void)
+{
+  const int n = theSOE->size;
+  if (n < 0) {
+    opserr << "WARNING SupernodalSolver::setSize() - order of system < 0\n";
+    return -1;
+  }
+
+  if (n == size && symbolicStamp == theSOE->structureStamp)
+    return 0;
+
+  size = n;
+  L.clear();
+  U.clear();
+  pivotsOrdered = false;
+  if (n == 0) {
+    numSuper = 0;
+    symbolicStamp = theSOE->structureStamp;
+    return 0;
+  }
+
+  // adjacency of the (symmetrized) pattern of A, without the diagonal
+  const int *colStart = theSOE->colStartA;
+  const int *rowA = theSOE->rowA;
+  xadj.assign(n+1, 0);
+  adjncy.clear();
+  for (int j=0; j<n; j++)
+    for (int p=colStart[j]; p<colStart[j+1]; p++)
+      if (rowA[p] != j) {
+        xadj[j+1]++;
+        xadj[rowA[p]+1]++;
+      }
+  for (int j=0; j<n; j++)
+    xadj[j+1] += xadj[j];
+
+  adjncy.resize(xadj[n]);
+  {
+    std::vector<int> next(xadj.begin(), xadj.end()-1);
+    for (int j=0; j<n; j++)
+      for (int p=colStart[j]; p<colStart[j+1]; p++)
+        if (rowA[p] != j) {
+          adjncy[next[j]++] = rowA[p];
+          adjncy[next[rowA[p]]++] = j;
+        }
+  }
+
+  // drop the duplicates of entries that appear on both sides
+  int numEdges = 0;
+  for (int j=0, p=0; j<n; j++) {
+    const int end = xadj[j+1];
+    std::sort(adjncy.begin()+p, adjncy.begin()+end);
+    xadj[j] = numEdges;
+    for (int k=p; k<end; k++)
+      if (k == p || adjncy[k] != adjncy[k-1])
+        adjncy[numEdges++] = adjncy[k];
+    p = end;
+  }
+  xadj[n] = numEdges;
+  adjncy.resize(numEdges);
+
+  {
+    PhaseTimer timer(*this, LinearSOESolver::Ordering);
+    this->order(xadj, adjncy);
+  }
+  {
+    PhaseTimer timer(*this, LinearSOESolver::Symbolic);
+    this->analyze(xadj, adjncy);
+  }
+
+  symbolicStamp = theSOE->structureStamp;
+  return 0;
+}
+
+void
+SupernodalSolver::order(const std::vector<int> &xadj, const std::vector<int> &adjncy)
+{
+  int n = size;
+  perm.resize(n);
+  iperm.resize(n);
+
+  if (adjncy.empty()) {
+    for (int i=0; i<n; i++)
+      perm[i] = iperm[i] = i;
+    return;
+  }
+
+  // METIS takes non-const arrays but does not change them
+  std::vector<int> metisXadj(xadj), metisAdjncy(adjncy);
+  int numflag = 0;
+  int options[8] = {0};
+  METIS_NodeND(&n, metisXadj.data(), metisAdjncy.data(), &numflag, options,
+               perm.data(), iperm.data());
+}
+
+bool
+SupernodalSolver::orderZeroPivots(void)
+{
+  // a zero on the diagonal (e.g., for the Lagrange multiplier of a
+  // constraint) is only filled in by the elimination of its neighbors,
+  // so such equations are moved after the last of their neighbors;
+  // returns true if the ordering changed
+  if (symmetric)
+    return false;
+
+  const int n = size;
+  const int *colStart = theSOE->colStartA;
+  const int *rowA = theSOE->rowA;
+  const double *A = theSOE->A;
+  std::vector<char> zero(n, 1);
+  for (int q=0; q<n; q++)
+    for (int p=colStart[q]; p<colStart[q+1]; p++)
+      if (rowA[p] == q && A[p] != 0.0)
+        zero[q] = 0;
+
+  std::vector<int> position(n);
+  bool moved = false;
+  for (int q=0; q<n; q++) {
+    position[q] = 2*iperm[q];
+    if (!zero[q])
+      continue;
+    for (int p=xadj[q]; p<xadj[q+1]; p++) {
+      const int after = 2*iperm[adjncy[p]] + 1;
+      if (!zero[adjncy[p]] && after > position[q]) {
+        position[q] = after;
+        moved = true;
+      }
+    }
+  }
+  if (!moved)
+    return false;
+
+  std::stable_sort(perm.begin(), perm.end(),
+                   [&](int a, int b) {return position[a] < position[b];});
+  for (int k=0; k<n; k++)
+    iperm[perm[k]] = k;
+  return true;
+}
+
+void
+SupernodalSolver::analyze(const std::vector<int> &xadj, const std::vector<int> &adjncy)
+{
+  const int n = size;
+
+  //
+  // elimination tree of the ordered matrix
+  //
+  std::vector<int> etree(n, -1), ancestor(n, -1);
+  for (int k=0; k<n; k++) {
+    const int q = perm[k];
+    for (int p=xadj[q]; p<xadj[q+1]; p++) {
+      int i = iperm[adjncy[p]];
+      while (i != -1 && i < k) {
+        const int next = ancestor[i];
+        ancestor[i] = k;
+        if (next == -1)
+          etree[i] = k;
+        i = next;
+      }
+    }
+  }
+
+  //
+  // postorder the tree, so that every subtree is a contiguous range
+  // of columns, and renumber the equations in that order
+  //
+  {
+    std::vector<int> head(n, -1), next(n, -1), post, stack;
+    for (int j=n-1; j>=0; j--)
+      if (etree[j] != -1) {
+        next[j] = head[etree[j]];
+        head[etree[j]] = j;
+      }
+
+    post.reserve(n);
+    for (int root=0; root<n; root++) {
+      if (etree[root] != -1)
+        continue;
+      stack.push_back(root);
+      while (!stack.empty()) {
+        const int j = stack.back();
+        const int child = head[j];
+        if (child == -1) {
+          post.push_back(j);
+          stack.pop_back();
+        } else {
+          head[j] = next[child];
+          stack.push_back(child);
+        }
+      }
+    }
+
+    std::vector<int> newPerm(n), position(n), newTree(n);
+    for (int k=0; k<n; k++)
+      position[post[k]] = k;
+    for (int k=0; k<n; k++) {
+      newPerm[k] = perm[post[k]];
+      newTree[k] = etree[post[k]] == -1 ? -1 : position[etree[post[k]]];
+    }
+    perm.swap(newPerm);
+    etree.swap(newTree);
+    for (int k=0; k<n; k++)
+      iperm[perm[k]] = k;
+  }
+
+  //
+  // number of entries in each column of L, by walking the row
+  // subtree of each row
+  //
+  std::vector<int> colCount(n, 1), mark(n, -1), numChild(n, 0);
+  for (int k=0; k<n; k++) {
+    mark[k] = k;
+    const int q = perm[k];
+    for (int p=xadj[q]; p<xadj[q+1]; p++)
+      for (int j=iperm[adjncy[p]]; j < k && mark[j] != k; j=etree[j]) {
+        colCount[j]++;
+        mark[j] = k;
+      }
+    if (etree[k] != -1)
+      numChild[etree[k]]++;
+  }
+
+  //
+  // fundamental supernodes, i.e., chains of columns with nested
+  // structure, amalgamated with their parent while that adds few
+  // explicit zeros
+  //
+  auto entries = [](double ncol, double nrow) {return ncol*nrow - 0.5*ncol*(ncol - 1.0);};
+
+  first.clear();
+  for (int j=0; j<n; ) {
+    int last = j + 1;
+    while (last < n && etree[last-1] == last && numChild[last] == 1
+           && colCount[last-1] == colCount[last] + 1)
+      last++;
+    first.push_back(j);
+    j = last;
+  }
+  first.push_back(n);
+
+  {
+    std::vector<int> merged {0};
+    int    ncol = first[1] - first[0];
+    int    nrow = colCount[first[0]];
+    double nz   = entries(ncol, nrow);
+    for (std::size_t s=1; s+1<first.size(); s++) {
+      const int f = first[s];
+      const int parentCol = first[s+1] - first[s];
+      const double parentNz = entries(parentCol, colCount[f]);
+
+      if (etree[f-1] == f) {
+        const int    mergedCol = ncol + parentCol;
+        const int    mergedRow = ncol + colCount[f];
+        const double zeros = 1.0 - (nz + parentNz)/entries(mergedCol, mergedRow);
+        if (mergedCol <= 4
+            || (mergedCol <= 16 && zeros < 0.8)
+            || (mergedCol <= 48 && zeros < 0.1)
+            || zeros < 0.05) {
+          ncol = mergedCol;
+          nrow = mergedRow;
+          nz  += parentNz;
+          continue;
+        }
+      }
+      merged.push_back(f);
+      ncol = parentCol;
+      nrow = colCount[f];
+      nz   = parentNz;
+    }
+    merged.push_back(n);
+    first.swap(merged);
+  }
+  numSuper = static_cast<int>(first.size()) - 1;
+
+  std::vector<int> super(n);
+  for (int s=0; s<numSuper; s++)
+    for (int j=first[s]; j<first[s+1]; j++)
+      super[j] = s;
+
+  parent.assign(numSuper, -1);
+  childStart.assign(numSuper+1, 0);
+  for (int s=0; s<numSuper; s++) {
+    const int up = etree[first[s+1]-1];
+    if (up != -1) {
+      parent[s] = super[up];
+      childStart[parent[s]+1]++;
+    }
+  }
+  for (int s=0; s<numSuper; s++)
+    childStart[s+1] += childStart[s];
+  children.resize(childStart[numSuper]);
+  {
+    std::vector<int> next(childStart.begin(), childStart.end()-1);
+    for (int s=0; s<numSuper; s++)
+      if (parent[s] != -1)
+        children[next[parent[s]]++] = s;
+  }
+
+  //
+  // rows of each front: those of the columns of A in the supernode
+  // and of the fronts of its children, below the supernode
+  //
+  start.assign(numSuper+1, 0);
+  index.clear();
+  relative.clear();
+  std::vector<int> position(n, -1), rows;
+  mark.assign(n, -1);
+  for (int s=0; s<numSuper; s++) {
+    const int f = first[s], l = first[s+1];
+    rows.clear();
+    for (int j=f; j<l; j++) {
+      const int q = perm[j];
+      for (int p=xadj[q]; p<xadj[q+1]; p++) {
+        const int i = iperm[adjncy[p]];
+        if (i >= l && mark[i] != s) {
+          mark[i] = s;
+          rows.push_back(i);
+        }
+      }
+    }
+    for (int c=childStart[s]; c<childStart[s+1]; c++) {
+      const int child = children[c];
+      const int nc = first[child+1] - first[child];
+      for (int k=start[child]+nc; k<start[child+1]; k++) {
+        const int i = index[k];
+        if (i >= l && mark[i] != s) {
+          mark[i] = s;
+          rows.push_back(i);
+        }
+      }
+    }
+    std::sort(rows.begin(), rows.end());
+
+    for (int j=f; j<l; j++)
+      index.push_back(j);
+    index.insert(index.end(), rows.begin(), rows.end());
+    start[s+1] = static_cast<int>(index.size());
+
+    // positions of the rows of the children in this front
+    for (int k=start[s]; k<start[s+1]; k++)
+      position[index[k]] = k - start[s];
+    relative.resize(index.size(), -1);
+    for (int c=childStart[s]; c<childStart[s+1]; c++) {
+      const int child = children[c];
+      const int nc = first[child+1] - first[child];
+      for (int k=start[child]+nc; k<start[child+1]; k++)
+        relative[k] = position[index[k]];
+    }
+  }
+
+  //
+  // where each entry of A goes: entry (i,j) of the ordered matrix is
+  // assembled into the front of the supernode of column min(i,j)
+  //
+  const int *colStart = theSOE->colStartA;
+  const int *rowA = theSOE->rowA;
+  assemblyStart.assign(numSuper+1, 0);
+  for (int q=0; q<n; q++)
+    for (int p=colStart[q]; p<colStart[q+1]; p++) {
+      const int i = iperm[rowA[p]], j = iperm[q];
+      if (symmetric && i < j)
+        continue;
+      assemblyStart[super[std::min(i, j)]+1]++;
+    }
+  for (int s=0; s<numSuper; s++)
+    assemblyStart[s+1] += assemblyStart[s];
+
+  source.resize(assemblyStart[numSuper]);
+  target.resize(assemblyStart[numSuper]);
+  {
+    std::vector<int> next(assemblyStart.begin(), assemblyStart.end()-1);
+    for (int q=0; q<n; q++)
+      for (int p=colStart[q]; p<colStart[q+1]; p++) {
+        const int i = iperm[rowA[p]], j = iperm[q];
+        if (symmetric && i < j)
+          continue;
+        source[next[super[std::min(i, j)]]++] = p;
+      }
+  }
+  std::vector<int> column(colStart[n]);
+  for (int q=0; q<n; q++)
+    for (int p=colStart[q]; p<colStart[q+1]; p++)
+      column[p] = q;
+
+  for (int s=0; s<numSuper; s++) {
+    const std::size_t m = start[s+1] - start[s];
+    for (int k=start[s]; k<start[s+1]; k++)
+      position[index[k]] = k - start[s];
+    for (int k=assemblyStart[s]; k<assemblyStart[s+1]; k++) {
+      const int p = source[k];
+      target[k] = position[iperm[rowA[p]]] + m*position[iperm[column[p]]];
+    }
+  }
+
+  //
+  // storage for the factors, and the work in each subtree
+  //
+  offsetL.assign(numSuper+1, 0);
+  offsetU.assign(numSuper+1, 0);
+  work.assign(numSuper, 0.0);
+  firstDescendant.resize(numSuper);
+  for (int s=0; s<numSuper; s++) {
+    const std::size_t m  = start[s+1] - start[s];
+    const std::size_t nc = first[s+1] - first[s];
+    offsetL[s+1] = offsetL[s] + m*nc;
+    offsetU[s+1] = offsetU[s] + (symmetric ? 0 : nc*(m - nc));
+
+    work[s] += double(nc)*double(m)*double(m);
+    firstDescendant[s] = s;
+    for (int c=childStart[s]; c<childStart[s+1]; c++) {
+      work[s] += work[children[c]];
+      firstDescendant[s] = std::min(firstDescendant[s], firstDescendant[children[c]]);
+    }
+  }
+}
+
+void
+SupernodalSolver::updateFront(double *F, int m, int k, int kb, int c0, int c1) const
+{
+  // apply the eliminated columns [k, kb) to columns [c0, c1) of the front
+  double one = 1.0, minusOne = -1.0;
+  int K = kb - k;
+  int N = c1 - c0;
+
+  if (symmetric) {
+    int M = m - c0;
+    DGEMM("N", "T", &M, &N, &K, &minusOne, F + c0 + std::size_t(k)*m, &m,
+          F + c0 + std::size_t(k)*m, &m, &one, F + c0 + std::size_t(c0)*m, &m);
+    return;
+  }
+
+  // rows [k, kb) of U
+  for (int c=c0; c<c1; c++) {
+    double *Fc = F + std::size_t(c)*m;
+    for (int j=k; j<kb; j++) {
+      const double u = Fc[j];
+      if (u != 0.0) {
+        const double *Fj = F + std::size_t(j)*m;
+        for (int r=j+1; r<kb; r++)
+          Fc[r] -= Fj[r]*u;
+      }
+    }
+  }
+
+  int M = m - kb;
+  if (M > 0)
+    DGEMM("N", "N", &M, &N, &K, &minusOne, F + kb + std::size_t(k)*m, &m,
+          F + k + std::size_t(c0)*m, &m, &one, F + kb + std::size_t(c0)*m, &m);
+}
+
+int
+SupernodalSolver::factorFront(double *F, int m, int n, int *rowPivot, bool parallel) const
+{
+  // eliminate the first n columns of the m x m front F, interchanging
+  // rows among the first n for LU and storing in rowPivot[j] the row
+  // swapped with row j; returns the column of a zero (or, for Cholesky,
+  // non-positive) pivot, or -1
+  OpenSees::thread_pool &pool = OpenSees::global_thread_pool();
+
+  for (int k=0; k<n; k+=panelWidth) {
+    const int kb = std::min(k + panelWidth, n);
+
+    // unblocked elimination of the panel
+    for (int j=k; j<kb; j++) {
+      double *Fj = F + std::size_t(j)*m;
+      double d = Fj[j];
+      if (symmetric) {
+        if (!(d > 0.0))
+          return j;
+        d = std::sqrt(d);
+        Fj[j] = d;
+      } else {
+        int p = j;
+        double largest = std::fabs(d);
+        for (int i=j+1; i<n; i++)
+          if (std::fabs(Fj[i]) > largest) {
+            largest = std::fabs(Fj[i]);
+            p = i;
+          }
+        if (largest == 0.0)
+          return j;
+
+        if (std::fabs(d) < pivotThreshold*largest) {
+          for (int c=0; c<m; c++)
+            std::swap(F[j + std::size_t(c)*m], F[p + std::size_t(c)*m]);
+          d = Fj[j];
+        } else
+          p = j;
+        rowPivot[j] = p;
+      }
+
+      for (int i=j+1; i<m; i++)
+        Fj[i] /= d;
+
+      for (int c=j+1; c<kb; c++) {
+        double *Fc = F + std::size_t(c)*m;
+        const double u = symmetric ? Fj[c] : Fc[j];
+        if (u != 0.0)
+          for (int i = symmetric ? c : j+1; i<m; i++)
+            Fc[i] -= Fj[i]*u;
+      }
+    }
+
+    // update of the rest of the front
+    const int numCols = m - kb;
+    const int numBlocks = std::min<int>(numCols/minColumnsPerBlock, 2*pool.get_thread_count());
+    if (numCols == 0)
+      continue;
+    else if (!parallel || numBlocks < 2)
+      this->updateFront(F, m, k, kb, kb, m);
+    else
+      pool.submit_blocks<int>(kb, m, [=](int c0, int c1) {
+        this->updateFront(F, m, k, kb, c0, c1);
+      }, numBlocks).wait();
+  }
+  return -1;
+}
+
+int
+SupernodalSolver::factorSupernode(int s, std::vector<std::vector<double>> &updates, bool parallel)
+{
+  const int n = first[s+1] - first[s];
+  const int m = start[s+1] - start[s];
+  const int r = m - n;
+
+  // assemble the front from A and the updates of the children
+  std::vector<double> front(std::size_t(m)*m, 0.0);
+  double *F = front.data();
+  const double *A = theSOE->A;
+  for (int k=assemblyStart[s]; k<assemblyStart[s+1]; k++)
+    F[target[k]] += A[source[k]];
+
+  for (int c=childStart[s]; c<childStart[s+1]; c++) {
+    const int child = children[c];
+    const int nc = first[child+1] - first[child];
+    const int rc = start[child+1] - start[child] - nc;
+    const int *rel = &relative[start[child] + nc];
+    const double *Uc = updates[child].data();
+    for (int j=0; j<rc; j++) {
+      double *Fj = F + std::size_t(rel[j])*m;
+      for (int i = symmetric ? j : 0; i<rc; i++)
+        Fj[rel[i]] += Uc[i + std::size_t(j)*rc];
+    }
+    std::vector<double>().swap(updates[child]);
+  }
+
+  const int pivot = this->factorFront(F, m, n, &rowPivot[first[s]], parallel);
+  if (pivot >= 0) {
+    opserr << "WARNING SupernodalSolver::solve() - ";
+    if (symmetric)
+      opserr << "matrix not positive definite at equation " << perm[first[s] + pivot] << "\n";
+    else
+      opserr << "zero pivot at equation " << perm[first[s] + pivot]
+             << "; the matrix is singular or needs row interchanges between"
+                " supernodes (use UmfPack or SparseGeneral)\n";
+    return -2;
+  }
+
+  // keep the factors
+  std::copy(F, F + std::size_t(m)*n, &L[offsetL[s]]);
+  if (!symmetric) {
+    double *Us = &U[offsetU[s]];
+    for (int c=n; c<m; c++)
+      for (int i=0; i<n; i++)
+        Us[i + std::size_t(c-n)*n] = F[i + std::size_t(c)*m];
+  }
+
+  // and pass the update matrix on to the parent
+  if (r > 0 && parent[s] != -1) {
+    std::vector<double> &Us = updates[s];
+    Us.resize(std::size_t(r)*r);
+    for (int j=0; j<r; j++)
+      std::copy(F + n + std::size_t(n+j)*m, F + m + std::size_t(n+j)*m,
+                Us.data() + std::size_t(j)*r);
+  }
+  return 0;
+}
+
+int
+SupernodalSolver::factor(void)
+{
+  OpenSees::thread_pool &pool = OpenSees::global_thread_pool();
+  const int numThreads = pool.get_thread_count();
+  const bool parallel = numThreads > 1 && !OpenSees::in_thread_pool();
+
+  L.resize(offsetL[numSuper]);
+  U.resize(offsetU[numSuper]);
+  rowPivot.resize(size);
+  std::vector<std::vector<double>> updates(numSuper);
+
+  // split the tree into subtrees small enough to balance over the
+  // threads; the supernodes above them are left to this thread
+  std::vector<int> subtrees;
+  std::vector<char> inSubtree(numSuper, 0);
+  if (parallel) {
+    double total = 0.0;
+    auto lighter = [&](int a, int b) {return work[a] < work[b];};
+    std::priority_queue<int, std::vector<int>, decltype(lighter)> heaviest(lighter);
+    for (int s=0; s<numSuper; s++)
+      if (parent[s] == -1) {
+        heaviest.push(s);
+        total += work[s];
+      }
+
+    const double target = total/(4.0*numThreads);
+    while (!heaviest.empty()) {
+      const int s = heaviest.top();
+      if (work[s] <= target || childStart[s] == childStart[s+1])
+        break;
+      heaviest.pop();
+      for (int c=childStart[s]; c<childStart[s+1]; c++)
+        heaviest.push(children[c]);
+    }
+    for (; !heaviest.empty(); heaviest.pop())
+      subtrees.push_back(heaviest.top());
+
+    for (int root : subtrees)
+      for (int s=firstDescendant[root]; s<=root; s++)
+        inSubtree[s] = 1;
+  }
+
+  if (subtrees.size() > 1) {
+    const int numSubtrees = static_cast<int>(subtrees.size());
+    OpenSees::multi_future<int> results = pool.submit_blocks<int>(0, numSubtrees,
+      [&](int a, int b) -> int {
+        for (int t=a; t<b; t++) {
+          const int root = subtrees[t];
+          for (int s=firstDescendant[root]; s<=root; s++)
+            if (this->factorSupernode(s, updates, false) < 0)
+              return -2;
+        }
+        return 0;
+      }, numSubtrees);
+
+    int result = 0;
+    for (int res : results.get())
+      result = std::min(result, res);
+    if (result < 0)
+      return result;
+  } else
+    std::fill(inSubtree.begin(), inSubtree.end(), 0);
+
+  for (int s=0; s<numSuper; s++)
+    if (!inSubtree[s] && this->factorSupernode(s, updates, parallel) < 0)
+      return -2;
+
+  return 0;
+}
+
+int
+SupernodalSolver::solve(void)
+{
+  const int n = theSOE->size;
+  if (n == 0)
+    return 0;
+
+  if (symbolicStamp != theSOE->structureStamp || size != n) {
+    opserr << "WARNING SupernodalSolver::solve() - setSize() has not been called\n";
+    return -1;
+  }
+
+  if (theSOE->factored == false) {
+    if (!pivotsOrdered) {
+      pivotsOrdered = true;
+      if (this->orderZeroPivots()) {
+        PhaseTimer timer(*this, LinearSOESolver::Symbolic);
+        this->analyze(xadj, adjncy);
+      }
+    }
+
+    PhaseTimer timer(*this, LinearSOESolver::Numeric);
+    if (this->factor() < 0)
+      return -2;
+    theSOE->factored = true;
+  }
+
+  PhaseTimer timer(*this, LinearSOESolver::Substitution);
+
+  y.resize(n);
+  const double *B = theSOE->B;
+  for (int i=0; i<n; i++)
+    y[i] = B[perm[i]];
+
+  // forward substitution
+  for (int s=0; s<numSuper; s++) {
+    const int f  = first[s];
+    const int nc = first[s+1] - f;
+    const int m  = start[s+1] - start[s];
+    const int *rows = &index[start[s]];
+    const double *Ls = &L[offsetL[s]];
+    if (!symmetric)
+      for (int j=0; j<nc; j++)
+        std::swap(y[f+j], y[f+rowPivot[f+j]]);
+    for (int j=0; j<nc; j++) {
+      const double *Lj = Ls + std::size_t(j)*m;
+      if (symmetric)
+        y[f+j] /= Lj[j];
+      const double yj = y[f+j];
+      for (int i=j+1; i<m; i++)
+        y[rows[i]] -= Lj[i]*yj;
+    }
+  }
+
+  // back substitution
+  for (int s=numSuper-1; s>=0; s--) {
+    const int f  = first[s];
+    const int nc = first[s+1] - f;
+    const int m  = start[s+1] - start[s];
+    const int *rows = &index[start[s]];
+    const double *Ls = &L[offsetL[s]];
+    if (symmetric) {
+      for (int j=nc-1; j>=0; j--) {
+        const double *Lj = Ls + std::size_t(j)*m;
+        double sum = y[f+j];
+        for (int i=j+1; i<m; i++)
+          sum -= Lj[i]*y[rows[i]];
+        y[f+j] = sum/Lj[j];
+      }
+    } else {
+      const double *Us = &U[offsetU[s]];
+      for (int c=nc; c<m; c++) {
+        const double yc = y[rows[c]];
+        const double *Uc = Us + std::size_t(c-nc)*nc;
+        for (int j=0; j<nc; j++)
+          y[f+j] -= Uc[j]*yc;
+      }
+      for (int j=nc-1; j>=0; j--) {
+        const double *Lj = Ls + std::size_t(j)*m;
+        const double yj = y[f+j]/Lj[j];
+        y[f+j] = yj;
+        for (int i=0; i<j; i++)
+          y[f+i] -= Lj[i]*yj;
+      }
+    }
+  }
+
+  double *X = theSOE->X;
+  for (int i=0; i<n; i++)
+    X[perm[i]] = y[i];
+
+  return 0;
+}
+
+double
+SupernodalSolver::getDeterminant(void)
+{
+  // the ordering is symmetric, so only the row interchanges change the sign
+  double det = 1.0;
+  if (theSOE == nullptr || !theSOE->factored)
+    return det;
+
+  for (int s=0; s<numSuper; s++) {
+    const int nc = first[s+1] - first[s];
+    const int m  = start[s+1] - start[s];
+    const double *Ls = &L[offsetL[s]];
+    for (int j=0; j<nc; j++) {
+      const double d = Ls[j + std::size_t(j)*m];
+      det *= symmetric ? d*d : d;
+      if (!symmetric && rowPivot[first[s]+j] != j)
+        det = -det;
+    }
+  }
+  return det;
+}
+
+int
+SupernodalSolver::sendSelf(int cTag, Channel &theChannel)
+{
+  // nothing to do
+  return 0;
+}
+
+int
+SupernodalSolver::recvSelf(int ctag,
+                           Channel &theChannel,
+                           FEM_ObjectBroker &theBroker)
+{
+  // nothing to do
+  return 0;
+}
@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: SupernodalSolver is a multifrontal sparse direct solver
+// for the SparseGenColLinSOE. The equations are ordered by nested
+// dissection (METIS), the elimination tree is postordered and its
+// columns grouped into (relaxed) supernodes, and each supernode is
+// eliminated as a dense frontal matrix with Level 3 BLAS.
+//
+// The matrix is assumed to have a symmetric pattern, as every matrix
+// assembled from a Graph of the model does. For general matrices the
+// factorization is LU with threshold partial pivoting among the rows of
+// each supernode; for symmetric positive definite matrices (the -spd
+// option) it is a Cholesky factorization, which uses only the lower
+// triangle and half the work.
+//
+// Rows are not interchanged between supernodes, so a pivot that is zero
+// until its neighbors are eliminated must be ordered after them. That is
+// the case for the Lagrange multipliers of constraints: equations with a
+// zero on the diagonal are moved after all of their neighbors when the
+// matrix is first factored.
+//
+// Independent subtrees of the supernodal elimination tree are factored
+// concurrently on the shared thread pool. The supernodes above those
+// subtrees are factored in order by the calling thread, with the update
+// of each large frontal matrix split by columns over the pool.
+//
+// The ordering and symbolic analysis are redone only when the structure
+// of the SOE changes, and the numeric factorization only when A has been
+// changed since the last solve.
+//
+// Written: cmp
+//
+#ifndef SupernodalSolver_h
+#define SupernodalSolver_h
+
+#include <SparseGenColLinSolver.h>
+#include <vector>
+#include <cstddef>
+
+class SupernodalSolver : public SparseGenColLinSolver
+{
+  public:
+    SupernodalSolver(bool symmetric = false);
+    ~SupernodalSolver();
+
+    int solve(void);
+    int setSize(void);
+    int setLinearSOE(SparseGenColLinSOE &theSOE);
+    double getDeterminant(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+  private:
+    void order(const std::vector<int> &xadj, const std::vector<int> &adjncy);
+    void analyze(const std::vector<int> &xadj, const std::vector<int> &adjncy);
+    bool orderZeroPivots(void);
+    int  factor(void);
+    int  factorSupernode(int s, std::vector<std::vector<double>> &updates, bool parallel);
+    int  factorFront(double *F, int m, int n, int *rowPivot, bool parallel) const;
+    void updateFront(double *F, int m, int k, int kb, int c0, int c1) const;
+
+    bool symmetric;      // Cholesky instead of LU
+    int  symbolicStamp;  // SOE structure the analysis was done for
+    int  size;
+
+    std::vector<int> perm, iperm;  // perm[new] = old, iperm[old] = new
+
+    // adjacency of the pattern of A, kept to order it again
+    std::vector<int> xadj, adjncy;
+    bool pivotsOrdered;            // zero diagonals have been ordered last
+
+    // supernode s holds columns [first[s], first[s+1]) of the ordered
+    // matrix; the rows of its front are index[start[s]:start[s+1]], the
+    // columns of s followed by the rows below them, and relative[k] is
+    // the position of row index[k] in the front of the parent.
+    int numSuper;
+    std::vector<int> first, start, index, relative;
+    std::vector<int> parent, childStart, children, firstDescendant;
+    std::vector<double> work;      // flops in the subtree of each supernode
+
+    // A[source[k]] is added to entry target[k] of the front of s,
+    // for k in [assemblyStart[s], assemblyStart[s+1])
+    std::vector<int> assemblyStart, source;
+    std::vector<std::size_t> target;
+
+    // factors: the first n columns of each front (L, with U11 in the
+    // upper triangle for LU) and, for LU, its first n rows to the right
+    // of the diagonal block (U12)
+    std::vector<std::size_t> offsetL, offsetU;
+    std::vector<double> L, U;
+    std::vector<int> rowPivot;     // row of its front swapped with each column
+    std::vector<double> y;
+};
+
+#endif
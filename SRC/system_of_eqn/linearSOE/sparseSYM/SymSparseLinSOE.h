@@ -37,6 +37,8 @@ class SymSparseLinSOE : public LinearSOE
 
     ~SymSparseLinSOE();
 
+    const char *getClassType(void) const {return "SymSparseLinSOE";}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
@@ -31,9 +31,8 @@
 #include <UmfpackGenLinSOE.h>
 #include <UmfpackGenLinSolver.h>
 #include <Matrix.h>
+#include <AnalysisModel.h>
 #include <Graph.h>
-#include <Vertex.h>
-#include <VertexIter.h>
 #include <math.h>
 #include <stdlib.h>
 
@@ -75,57 +74,50 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
 	return -1;
     }
 
-    // fist itearte through the vertices of the graph to get nnz
-    Vertex *theVertex;
-    int nnz = 0;
-    VertexIter &theVertices = theGraph.getVertices();
-    while ((theVertex = theVertices()) != 0) {
-	const ID &theAdjacency = theVertex->getAdjacency();
-	nnz += theAdjacency.Size() +1; // the +1 is for the diag entry
+    // the adjacency of the graph gives the off-diagonal entries
+    const int *adjStart, *adjIndex;
+    if (!theGraph.getCompressed(adjStart, adjIndex)) {
+	opserr << "WARNING:UmfpackGenLinSOE::setSize :";
+	opserr << " vertices not numbered 0 through " << size-1 << " - size set to 0\n";
+	Ap.clear();
+	Ai.clear();
+	structureStamp++;
+	return -1;
     }
+    int nnz = adjStart[size] + size; // the + size is for the diag entries
+
+    // keep the old pattern to see if it changes
+    std::vector<int> oldAp, oldAi;
+    oldAp.swap(Ap);
+    oldAi.swap(Ai);
 
     // resize A, B, X
     Ap.reserve(size+1);
     Ai.reserve(nnz);
-    Ax.resize(nnz,0.0);
+    Ax.assign(nnz,0.0);
+    factored = false;
     B.resize(size);
     B.Zero();
     X.resize(size);
     X.Zero();
 
-    // fill in Ai and Ap
+    // fill in Ai and Ap, placing the diag in order
     Ap.push_back(0);
     for (int a=0; a<size; a++) {
+	int k = adjStart[a];
+	for ( ; k<adjStart[a+1] && adjIndex[k] < a; k++)
+	    Ai.push_back(adjIndex[k]);
+	Ai.push_back(a);
+	for ( ; k<adjStart[a+1]; k++)
+	    Ai.push_back(adjIndex[k]);
+	Ap.push_back(Ai.size());
+    }
 
-	theVertex = theGraph.getVertexPtr(a);
-	if (theVertex == 0) {
-	    opserr << "WARNING:UmfpackGenLinSOE::setSize :";
-	    opserr << " vertex " << a << " not in graph! - size set to 0\n";
-	    size = 0;
-	    return -1;
-	}
-
-	const ID &theAdjacency = theVertex->getAdjacency();
-	int idSize = theAdjacency.Size();
-	ID col(0,idSize+1);
-
-	// diagonal
-	col.insert(theVertex->getTag());
-
-	// now we have to place the entries in the ID into order in Ai
-	for (int i=0; i<idSize; i++) {
-	    int row = theAdjacency(i);
-	    col.insert(row);
-	}
-
-	// copy to Ai
-	for (int i=0; i<col.Size(); i++) {
-	    Ai.push_back(col(i));
-	}
+    if (Ap != oldAp || Ai != oldAi)
+	structureStamp++;
 
-	// set Ap
-	Ap.push_back(Ap[a]+col.Size());
-    }
+    if (theModel != nullptr)
+	scatterMap.build(*theModel, Ap.data(), Ai.data(), size, true);
 
     // invoke setSize() on the Solver
     LinearSOESolver *the_Solver = this->getSolver();
@@ -154,6 +146,9 @@ UmfpackGenLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	return -1;
     }
 
+    if (scatterMap.add(Ax.data(), m, id, fact))
+	return 0;
+
     int size = X.Size();
     if (fact == 1.0) { // do not need to multiply
 	for (int j=0; j<idSize; j++) {
@@ -273,10 +268,19 @@ UmfpackGenLinSOE::setB(const Vector &v, double fact)
     return 0;
 }
 
+bool
+UmfpackGenLinSOE::hasStructure(const ID &id) const
+{
+    if (Ap.empty())
+	return false;
+    return SparseScatterMap::hasEntries(id, Ap.data(), Ai.data(), int(Ap.size())-1, true);
+}
+
 void
 UmfpackGenLinSOE::zeroA(void)
 {
     Ax.assign(Ax.size(),0.0);
+    factored = false;
 }
 
 void
@@ -30,6 +30,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <SparseScatterMap.h>
 #include <vector>
 
 class UmfpackGenLinSolver;
@@ -42,10 +43,14 @@ public:
 
     ~UmfpackGenLinSOE();
 
+    const char *getClassType(void) const {return "UmfpackGenLinSOE";}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
+    bool isThreadSafe(void) const {return true;}
+    bool hasStructure(const ID &id) const;
     int setB(const Vector &, double fact = 1.0);        
     
     void zeroA(void);
@@ -71,6 +76,13 @@ private:
     Vector X,B;
     std::vector<int> Ap, Ai;
     std::vector<double> Ax;
+    SparseScatterMap scatterMap; // locations in Ax of the element entries
+
+    // changed whenever setSize() changes the pattern of Ap and Ai, so
+    // the solver can keep its symbolic analysis otherwise
+    int structureStamp = 0;
+    // false if Ax has changed since the solver last factored it
+    bool factored = false;
 };
 
 
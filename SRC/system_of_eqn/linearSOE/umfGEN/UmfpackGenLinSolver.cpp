@@ -36,7 +36,7 @@
 
 UmfpackGenLinSolver::UmfpackGenLinSolver(bool doDet_)
     :LinearSOESolver(SOLVER_TAGS_UmfpackGenLinSolver), 
-     Symbolic(nullptr), theSOE(nullptr),
+     Symbolic(nullptr), Numeric(nullptr), symbolicStamp(-1), theSOE(nullptr),
      det(0.0), doDet(doDet_)
 {
 }
@@ -44,6 +44,8 @@ UmfpackGenLinSolver::UmfpackGenLinSolver(bool doDet_)
 
 UmfpackGenLinSolver::~UmfpackGenLinSolver()
 {
+    if (Numeric != nullptr)
+	umfpack_di_free_numeric(&Numeric);
     if (Symbolic != nullptr) {
 	umfpack_di_free_symbolic(&Symbolic);
     }
@@ -75,27 +77,38 @@ UmfpackGenLinSolver::solve()
     //     return -1;
     // }
     
-    //  perform the numerical factorization
-    // numerical analysis
-    void* Numeric = nullptr;
-    int status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
-
-    // check error
-    if (status!=UMFPACK_OK) {
-      // TODO
-      // opserr<<"WARNING: numeric analysis returns "<<status<<" -- Umfpackgenlinsolver::solve\n";
-	return -1;
+    //  perform the numerical factorization, unless A is unchanged
+    //  since the last one (e.g., modified Newton iterations)
+    if (!theSOE->factored || Numeric == nullptr) {
+	if (Numeric != nullptr)
+	    umfpack_di_free_numeric(&Numeric);
+
+	int status;
+	{
+	    PhaseTimer timer(*this, LinearSOESolver::Numeric);
+	    status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
+	}
+
+	// check error
+	if (status!=UMFPACK_OK) {
+	  // TODO
+	  // opserr<<"WARNING: numeric analysis returns "<<status<<" -- Umfpackgenlinsolver::solve\n";
+	    if (Numeric != nullptr)
+		umfpack_di_free_numeric(&Numeric);
+	    return -1;
+	}
+
+	if (doDet == true)
+	  umfpack_di_get_determinant(&det, nullptr, Numeric, Info);
+
+	theSOE->factored = true;
     }
 
     // solve
-    status = umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
-    
-    if (doDet == true)
-      umfpack_di_get_determinant(&det, nullptr, Numeric, Info);
-
-    // delete Numeric
-    if (Numeric != nullptr) {
-	umfpack_di_free_numeric(&Numeric);
+    int status;
+    {
+	PhaseTimer timer(*this, Substitution);
+	status = umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
     }
 
     // check error
@@ -124,6 +137,14 @@ UmfpackGenLinSolver::setSize()
     int* Ai = &(theSOE->Ai[0]);
     double* Ax = &(theSOE->Ax[0]);
 
+    // the numeric factorization is of the old A in any case
+    if (Numeric != nullptr)
+	umfpack_di_free_numeric(&Numeric);
+
+    // keep the symbolic analysis if the pattern has not changed
+    if (Symbolic != nullptr && symbolicStamp == theSOE->structureStamp)
+	return 0;
+
     // symbolic analysis
     if (Symbolic != nullptr) {
 	umfpack_di_free_symbolic(&Symbolic);
@@ -131,14 +152,20 @@ UmfpackGenLinSolver::setSize()
 
     //  perform a column pre-ordering to reduce fill-in
     //  and a symbolic factorization.
-    int status = umfpack_di_symbolic(n,n,Ap,Ai,Ax,&Symbolic,Control,Info);
+    int status;
+    {
+	PhaseTimer timer(*this, LinearSOESolver::Symbolic);
+	status = umfpack_di_symbolic(n,n,Ap,Ai,Ax,&Symbolic,Control,Info);
+    }
 
     // check error
     if (status!=UMFPACK_OK) {
 	// opserr<<"WARNING: symbolic analysis returns "<<status<<" -- Umfpackgenlinsolver::setsize\n";
 	Symbolic = 0;
+	symbolicStamp = -1;
 	return -1;
     }
+    symbolicStamp = theSOE->structureStamp;
     return 0;
 }
 
@@ -54,6 +54,8 @@ class UmfpackGenLinSolver : public LinearSOESolver
 
   private:
     void *Symbolic;
+    void *Numeric;        // kept until the SOE changes A
+    int symbolicStamp;    // SOE structure the Symbolic was formed for
     double Control[UMFPACK_CONTROL], Info[UMFPACK_INFO];
     UmfpackGenLinSOE *theSOE;
     double det;
@@ -50,13 +50,14 @@ HashMapOfTaggedObjects::~HashMapOfTaggedObjects()
 int
 HashMapOfTaggedObjects::setSize(int newSize)
 {
-    // no setSize for map template .. can only check enough space available
+    // check enough space available, then make room for the buckets
     int maxSize = int(theMap.max_size());
     if (newSize > maxSize) {
       opserr << "HashMapOfTaggedObjects::setSize - failed as map STL has a max size of " << maxSize << "\n";
       return -1;
     } 
    
+    theMap.reserve(newSize);
     return 0;
 }
 
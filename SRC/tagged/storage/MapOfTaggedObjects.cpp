@@ -67,6 +67,13 @@ MapOfTaggedObjects::addComponent(TaggedObject *newComponent)
     MAP_TAGGED_ITERATOR theEle;
     int tag = newComponent->getTag();
 
+    // objects are mostly added in increasing tag order, in which case the
+    // end of the map is the place to insert and no search is needed
+    if (theMap.empty() || theMap.rbegin()->first < tag) {
+      theMap.emplace_hint(theMap.end(), tag, newComponent);
+      return true;
+    }
+
     // check if the ele already in map, if not we add
     std::pair<MAP_TAGGED_ITERATOR,bool> res = theMap.insert(MAP_TAGGED_TYPE(tag,newComponent));    
     if (res.second == false) {
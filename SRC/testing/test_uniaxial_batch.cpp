@@ -0,0 +1,184 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Checks that setTrialBatch gives the same stresses and
+// tangents as setTrial on each material, for every model that overrides
+// it with uniaxial_batch, for classes derived from those models that do
+// not override it (which must be set one material at a time, through
+// their own setTrialStrain or setTrial), and for fibers of mixed classes
+// set in runs as a section sets them. Each material is driven through
+// cycles of growing amplitude and committed after every step, and the
+// results must be identical, not only close.
+//
+// Written: cmp
+//
+#include <OPS_Globals.h>
+#include <UniaxialMaterial.h>
+#include <UniaxialBatch.h>
+#include <Steel01.h>
+#include <Steel02.h>
+#include <Concrete01.h>
+#include <Concrete02.h>
+#include <ElasticMaterial.h>
+#include <HystereticMaterial.h>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// a Steel02 whose strain is halved, with no setTrialBatch of its own
+class HalfStrainSteel02 : public Steel02
+{
+  public:
+    HalfStrainSteel02(int tag) : Steel02(tag, 60.0, 29000.0, 0.01, 18.0, 0.925, 0.15) {}
+    int setTrialStrain(double strain, double strainRate = 0.0) {
+      return Steel02::setTrialStrain(0.5*strain, strainRate);
+    }
+};
+
+// an ElasticMaterial whose stress is doubled by its setTrial, with no
+// setTrialBatch of its own
+class DoubledElastic : public ElasticMaterial
+{
+  public:
+    DoubledElastic(int tag) : ElasticMaterial(tag, 29000.0, 0.0, 14500.0) {}
+    int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0) {
+      int res = ElasticMaterial::setTrial(strain, stress, tangent, strainRate);
+      stress  *= 2.0;
+      tangent *= 2.0;
+      return res;
+    }
+};
+
+static UniaxialMaterial *
+makeMaterial(int kind, int tag)
+{
+  switch (kind) {
+    case 0: return new Steel01(tag, 60.0, 29000.0, 0.02);
+    case 1: return new Steel02(tag, 60.0, 29000.0, 0.01, 18.0, 0.925, 0.15);
+    case 2: return new Concrete01(tag, -4.0, -0.002, -0.8, -0.006);
+    case 3: return new Concrete02(tag, -4.0, -0.002, -0.8, -0.006, 0.1, 0.4, 200.0);
+    case 4: return new ElasticMaterial(tag, 29000.0, 0.0, 20000.0);
+    case 5: return new HystereticMaterial(tag, 60.0, 0.002, 70.0, 0.02, -60.0, -0.002, -70.0, -0.02,
+                                          0.8, 0.2, 0.0, 0.01, 0.0);
+    case 6: return new HalfStrainSteel02(tag);
+    case 7: return new DoubledElastic(tag);
+  }
+  return nullptr;
+}
+
+static const char *kindNames[] = {
+  "Steel01", "Steel02", "Concrete01", "Concrete02", "ElasticMaterial",
+  "HystereticMaterial", "Steel02 (derived)", "ElasticMaterial (derived)"
+};
+static const int numKinds = 8;
+
+// the strain of material i at step k: cycles of growing amplitude, out of
+// phase from one material to the next
+static double
+strainHistory(int i, int k)
+{
+  return 0.0004*k*std::sin(0.3*k + 0.7*i) - 0.0001*k*(i % 3 == 0);
+}
+
+// drive the materials through numSteps steps, setting them all with
+// setTrialBatch on runs of the same class (batch) or one at a time with
+// setTrial, and return their stresses and tangents after every step
+static std::vector<double>
+drive(const std::vector<int> &kinds, int numSteps, bool batch)
+{
+  const int n = static_cast<int>(kinds.size());
+  std::vector<UniaxialMaterial *> materials(n);
+  for (int i = 0; i < n; i++)
+    materials[i] = makeMaterial(kinds[i], i + 1);
+
+  std::vector<int> runEnd;
+  std::vector<double> strain(n), stress(n), tangent(n), results;
+  int res = 0;
+  for (int k = 1; k <= numSteps; k++) {
+    for (int i = 0; i < n; i++)
+      strain[i] = strainHistory(i, k);
+
+    if (batch) {
+      const int *runs = OpenSees::find_uniaxial_runs(materials.data(), n, runEnd);
+      res += OpenSees::set_trial_runs(materials.data(), runs, 0, n,
+                                      strain.data(), stress.data(), tangent.data());
+    } else {
+      for (int i = 0; i < n; i++)
+        res += materials[i]->setTrial(strain[i], stress[i], tangent[i]);
+    }
+
+    for (int i = 0; i < n; i++) {
+      // the values returned must be those the material now holds, but
+      // for DoubledElastic, which only doubles what setTrial returns
+      if (stress[i] != materials[i]->getStress() && kinds[i] != 7)
+        res++;
+      results.push_back(stress[i]);
+      results.push_back(tangent[i]);
+      materials[i]->commitState();
+    }
+  }
+
+  for (UniaxialMaterial *theMaterial : materials)
+    delete theMaterial;
+
+  if (res != 0)
+    results.push_back(NAN);
+  return results;
+}
+
+static int
+check(const char *name, const std::vector<int> &kinds, int numSteps)
+{
+  const std::vector<double> batch  = drive(kinds, numSteps, true);
+  const std::vector<double> scalar = drive(kinds, numSteps, false);
+
+  if (batch.size() != scalar.size()) {
+    std::printf("FAILED %s: the materials failed\n", name);
+    return 1;
+  }
+  for (std::size_t i = 0; i < batch.size(); i++)
+    if (!(batch[i] == scalar[i])) {
+      std::printf("FAILED %s: step %zu, material %zu: %.17g with setTrialBatch, %.17g with setTrial\n",
+                  name, i/(2*kinds.size()) + 1, (i/2) % kinds.size(), batch[i], scalar[i]);
+      return 1;
+    }
+
+  std::printf("passed %s\n", name);
+  return 0;
+}
+
+int
+main(void)
+{
+  const int numSteps = 200;
+  int failed = 0;
+
+  // a run of each class on its own
+  for (int kind = 0; kind < numKinds; kind++)
+    failed += check(kindNames[kind], std::vector<int>(40, kind), numSteps);
+
+  // a derived class after its base, which must not be set as the base
+  failed += check("Steel02 then derived", {1, 1, 1, 6, 6, 6, 1}, numSteps);
+  failed += check("derived then ElasticMaterial", {7, 7, 4, 4, 4, 7}, numSteps);
+
+  // runs of mixed lengths, as in a section of cover, core and bars
+  std::vector<int> section;
+  for (int i = 0; i < 60; i++)
+    section.push_back(i < 10 || i >= 50 ? 2 : (i % 7 == 0 ? 0 : 3));
+  for (int kind = 0; kind < numKinds; kind++)
+    section.insert(section.begin() + 3*kind, kind);
+  failed += check("mixed section", section, numSteps);
+
+  // the derived Steel02 must not give the stresses of its base
+  const std::vector<double> half = drive({6}, 20, true);
+  const std::vector<double> full = drive({1}, 20, true);
+  if (half == full) {
+    std::printf("FAILED the derived Steel02 was set as its base\n");
+    failed++;
+  }
+
+  return failed == 0 ? 0 : 1;
+}
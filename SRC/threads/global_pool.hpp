@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: A single process-wide instance of OpenSees::thread_pool
+// that is shared by all of the components which perform intra-process
+// parallel work (element state determination, assembly, fiber section
+// integration). Sharing one pool avoids oversubscribing the machine when
+// several of these are active at once.
+//
+// Tasks submitted to the pool are picked up by whichever worker is free
+// next, so splitting a loop into more blocks than there are threads
+// balances uneven work (e.g., a mix of elastic and inelastic elements).
+//
+// Written: cmp
+//
+#pragma once
+#include <threads/thread_pool.hpp>
+#include <memory>
+
+namespace OpenSees {
+
+inline std::unique_ptr<thread_pool>&
+global_thread_pool_ptr()
+{
+  static std::unique_ptr<thread_pool> pool = std::make_unique<thread_pool>(1);
+  return pool;
+}
+
+//
+// Return the shared pool. The pool is created on first use with a
+// single worker, so threaded code paths which test get_thread_count()
+// stay serial until the user asks for more threads (e.g., with the
+// setNumThreads command).
+//
+inline thread_pool&
+global_thread_pool()
+{
+  return *global_thread_pool_ptr();
+}
+
+inline concurrency_t
+get_thread_count()
+{
+  return global_thread_pool().get_thread_count();
+}
+
+//
+// Resize the shared pool; waits for any queued work to finish first.
+//
+inline void
+set_thread_count(concurrency_t num_threads)
+{
+  if (num_threads != global_thread_pool().get_thread_count())
+    global_thread_pool().reset(num_threads);
+}
+
+//
+// Start the shared pool again in a child made by fork(). Only the thread
+// that forked is copied into the child, so the workers of the pool are
+// gone, and any task given to it would wait forever; its mutex may even
+// be held by one of them. The old pool is abandoned without being
+// destroyed, and a new one with num_threads workers takes its place.
+//
+inline void
+restart_thread_pool_after_fork(concurrency_t num_threads)
+{
+  global_thread_pool_ptr().release();
+  global_thread_pool_ptr() = std::make_unique<thread_pool>(num_threads);
+}
+
+//
+// True when called from one of the worker threads of any pool. Work
+// that would otherwise be submitted to the pool must run serially in
+// that case, since a worker that blocks waiting on tasks queued behind
+// it can deadlock the pool.
+//
+inline bool
+in_thread_pool()
+{
+  return this_thread::get_pool().has_value();
+}
+
+} // namespace OpenSees
@@ -0,0 +1,186 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Written: cmp
+//
+#include <Profiler.h>
+#include <MovableObject.h>
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <iomanip>
+#include <unordered_map>
+#include <vector>
+#include <stdint.h>
+
+namespace OpenSees {
+
+std::atomic<bool> Profiler::enabled(false);
+
+namespace {
+
+const char *phaseNames[Profiler::NumPhases] = {
+  "element.update",
+  "element.tangent",
+  "element.residual",
+  "material.setTrial",
+  "system.addA",
+  "system.solve",
+  "test",
+  "recorder.record"
+};
+
+struct Entry {
+  std::string type;
+  uint64_t calls = 0;
+  int64_t  nanoseconds = 0;
+};
+
+// the totals of one thread; the lock is only contended while a report
+// is being made
+struct Table {
+  std::mutex mutex;
+  std::unordered_map<uint64_t, Entry> entries;
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<Table>> tables;
+};
+
+// never destroyed, since pool threads may still be profiling while
+// static objects are destroyed at exit
+Registry &
+registry()
+{
+  static Registry *theRegistry = new Registry();
+  return *theRegistry;
+}
+
+Table &
+localTable()
+{
+  thread_local std::shared_ptr<Table> table = []() {
+    std::shared_ptr<Table> table = std::make_shared<Table>();
+    Registry &theRegistry = registry();
+    std::lock_guard<std::mutex> lock(theRegistry.mutex);
+    theRegistry.tables.push_back(table);
+    return table;
+  }();
+  return *table;
+}
+
+uint64_t
+makeKey(int phase, int classTag)
+{
+  return (uint64_t(phase) << 32) | uint32_t(classTag);
+}
+
+} // namespace
+
+
+void
+Profiler::enable(bool on)
+{
+  enabled.store(on, std::memory_order_relaxed);
+}
+
+
+void
+Profiler::reset(void)
+{
+  Registry &theRegistry = registry();
+  std::lock_guard<std::mutex> lock(theRegistry.mutex);
+  for (const std::shared_ptr<Table> &table : theRegistry.tables) {
+    std::lock_guard<std::mutex> tableLock(table->mutex);
+    table->entries.clear();
+  }
+}
+
+
+void
+Profiler::add(Phase phase, const MovableObject &object, Clock::duration time)
+{
+  const int classTag = object.getClassTag();
+
+  Table &table = localTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  Entry &entry = table.entries[makeKey(phase, classTag)];
+  if (entry.calls == 0 && entry.type.empty())
+    entry.type = object.getClassType();
+  entry.calls++;
+  entry.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(time).count();
+}
+
+
+std::string
+Profiler::report(bool json)
+{
+  // merge the tables of all threads
+  std::map<uint64_t, Entry> totals;
+  {
+    Registry &theRegistry = registry();
+    std::lock_guard<std::mutex> lock(theRegistry.mutex);
+    for (const std::shared_ptr<Table> &table : theRegistry.tables) {
+      std::lock_guard<std::mutex> tableLock(table->mutex);
+      for (const auto &item : table->entries) {
+        Entry &total = totals[item.first];
+        if (total.type.empty())
+          total.type = item.second.type;
+        total.calls       += item.second.calls;
+        total.nanoseconds += item.second.nanoseconds;
+      }
+    }
+  }
+
+  std::vector<std::pair<uint64_t, Entry>> rows(totals.begin(), totals.end());
+  std::stable_sort(rows.begin(), rows.end(), [](const std::pair<uint64_t, Entry> &a,
+                                                const std::pair<uint64_t, Entry> &b) {
+    return a.second.nanoseconds > b.second.nanoseconds;
+  });
+
+  std::ostringstream out;
+  if (json) {
+    // no white space, so the result reads as a single Tcl word
+    out << "[";
+    for (std::size_t i = 0; i < rows.size(); i++) {
+      const Entry &entry = rows[i].second;
+      out << (i == 0 ? "" : ",")
+          << "{\"phase\":\"" << phaseNames[rows[i].first >> 32] << "\""
+          << ",\"class\":\"" << entry.type << "\""
+          << ",\"classTag\":" << int(uint32_t(rows[i].first))
+          << ",\"calls\":" << entry.calls
+          << ",\"seconds\":" << std::setprecision(9) << 1e-9*entry.nanoseconds
+          << "}";
+    }
+    out << "]";
+    return out.str();
+  }
+
+  out << std::left  << std::setw(20) << "phase"
+                    << std::setw(32) << "class"
+      << std::right << std::setw(8)  << "tag"
+                    << std::setw(14) << "calls"
+                    << std::setw(14) << "total (s)"
+                    << std::setw(14) << "mean (us)" << "\n";
+
+  out << std::fixed;
+  for (const std::pair<uint64_t, Entry> &row : rows) {
+    const Entry &entry = row.second;
+    out << std::left  << std::setw(20) << phaseNames[row.first >> 32]
+                      << std::setw(32) << entry.type
+        << std::right << std::setw(8)  << int(uint32_t(row.first))
+                      << std::setw(14) << entry.calls
+                      << std::setw(14) << std::setprecision(6) << 1e-9*entry.nanoseconds
+                      << std::setw(14) << std::setprecision(3)
+                      << 1e-3*entry.nanoseconds/std::max<uint64_t>(entry.calls, 1) << "\n";
+  }
+  return out.str();
+}
+
+} // namespace OpenSees
@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+//        OpenSees - Open System for Earthquake Engineering Simulation
+//
+//===----------------------------------------------------------------------===//
+//
+// Description: Profiler accumulates the wall-clock time and the number of
+// calls spent in the state determination and solution phases of an
+// analysis, per phase and per class. Where Timer measures a whole run,
+// Profiler answers which element, material or solver the run spent its
+// time in:
+//
+//    void
+//    FE_Element::addKtToTang(double fact)
+//    {
+//      OPS_PROFILE(ElementTangent, *myEle);
+//      ...
+//    }
+//
+// Profiling is off by default, when a scope costs one relaxed load and a
+// branch. When it is on, each thread adds to its own table, and the
+// tables are merged when a report is made. Times are inclusive: the time
+// of the materials of an element is also counted in that element.
+//
+// Written: cmp
+//
+#ifndef Profiler_h
+#define Profiler_h
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+class MovableObject;
+
+namespace OpenSees {
+
+class Profiler
+{
+  public:
+    enum Phase {
+      ElementUpdate,
+      ElementTangent,
+      ElementResidual,
+      MaterialTrial,
+      SystemAssemble,
+      SystemSolve,
+      ConvergenceTest,
+      RecorderRecord,
+      NumPhases
+    };
+
+    typedef std::chrono::steady_clock Clock;
+
+    static bool isEnabled(void) {return enabled.load(std::memory_order_relaxed);}
+    static void enable(bool on);
+
+    // forget everything accumulated so far
+    static void reset(void);
+
+    // the totals, slowest first, as a table or as a compact JSON array
+    // of {"phase", "class", "classTag", "calls", "seconds"} objects
+    static std::string report(bool json = false);
+
+    static void add(Phase phase, const MovableObject &object, Clock::duration time);
+
+    class Scope {
+      public:
+        Scope(Phase phase, const MovableObject &object)
+        :phase(phase), object(Profiler::isEnabled() ? &object : nullptr)
+        {
+          if (this->object != nullptr)
+            start = Clock::now();
+        }
+
+        ~Scope()
+        {
+          if (object != nullptr)
+            Profiler::add(phase, *object, Clock::now() - start);
+        }
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+      private:
+        Phase phase;
+        const MovableObject *object;
+        Clock::time_point start;
+    };
+
+  private:
+    static std::atomic<bool> enabled;
+};
+
+} // namespace OpenSees
+
+#define OPS_PROFILE_NAME(n) opsProfileScope ## n
+#define OPS_PROFILE_SCOPE(n, phase, object) \
+  OpenSees::Profiler::Scope OPS_PROFILE_NAME(n)(OpenSees::Profiler::phase, object)
+
+// time the rest of the enclosing block as the given phase of object
+#define OPS_PROFILE(phase, object) OPS_PROFILE_SCOPE(__COUNTER__, phase, object)
+
+#endif
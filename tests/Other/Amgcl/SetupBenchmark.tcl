@@ -0,0 +1,86 @@
+# Setup and solve times of system Amgcl for an elastic brick cantilever
+#
+# The cantilever has 12 by 12 by nz stdBrick elements and is fixed at z=0.
+# For each size one step is solved with and without the rigid body modes,
+# and with UmfPack; the numeric phase (AMG hierarchy or factorization) and
+# the solve phase are reported from systemTimes.
+#
+#   OpenSees SetupBenchmark.tcl ?nz ...?
+
+set sizes {}
+if {[info exists argv]} {
+    foreach arg $argv {
+        if {[string is integer -strict $arg]} { lappend sizes $arg }
+    }
+}
+if {[llength $sizes] == 0} {
+    set sizes {5 10 15}
+}
+
+proc buildCantilever {nx ny nz} {
+    wipe
+    model Basic -ndm 3 -ndf 3
+    nDMaterial ElasticIsotropic 1 30000.0 0.25
+    set L 1.0
+    for {set k 0} {$k <= $nz} {incr k} {
+        for {set j 0} {$j <= $ny} {incr j} {
+            for {set i 0} {$i <= $nx} {incr i} {
+                set tag [expr 1 + $i + ($nx+1)*($j + ($ny+1)*$k)]
+                node $tag [expr $i*$L] [expr $j*$L] [expr $k*$L]
+                if {$k == 0} { fix $tag 1 1 1 }
+            }
+        }
+    }
+    set e 1
+    for {set k 0} {$k < $nz} {incr k} {
+        for {set j 0} {$j < $ny} {incr j} {
+            for {set i 0} {$i < $nx} {incr i} {
+                set n1 [expr 1 + $i + ($nx+1)*($j + ($ny+1)*$k)]
+                set n2 [expr $n1 + 1]
+                set n4 [expr $n1 + $nx + 1]
+                set n3 [expr $n4 + 1]
+                set d  [expr ($nx+1)*($ny+1)]
+                element stdBrick $e $n1 $n2 $n3 $n4 [expr $n1+$d] [expr $n2+$d] [expr $n3+$d] [expr $n4+$d] 1
+                incr e
+            }
+        }
+    }
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        set top [expr ($nx+1)*($ny+1)*$nz]
+        for {set n 1} {$n <= ($nx+1)*($ny+1)} {incr n} {
+            load [expr $top + $n] 1.0 0.5 -0.2
+        }
+    }
+    constraints Plain
+    numberer RCM
+    test NormDispIncr 1.0e-8 4
+    algorithm Linear
+    integrator LoadControl 1.0
+}
+
+proc timeStep {args} {
+    eval system $args
+    analysis Static
+    if {[analyze 1] != 0} {
+        return "failed"
+    }
+    set times [systemTimes]
+    return [format "%7.3f %7.3f" [lindex [dict get $times numeric] 0] [lindex [dict get $times solve] 0]]
+}
+
+set systems {{Amgcl} {Amgcl -noRigidBodyModes} {UmfPack}}
+puts "setup and solve times in seconds"
+puts [format "%8s  %16s %16s %16s" dofs "Amgcl" "-noRigidBody" "UmfPack"]
+foreach nz $sizes {
+    set nx 12
+    set ny 12
+    set dofs [expr 3*($nx+1)*($ny+1)*$nz]
+    set times {}
+    foreach system $systems {
+        buildCantilever $nx $ny $nz
+        lappend times [eval timeStep $system]
+    }
+    puts [format "%8d  %16s %16s %16s" $dofs {*}$times]
+}
+wipe
@@ -0,0 +1,157 @@
+# Writing recorder files on the background writer
+#
+# A chain of 600 bars is shaken with recorders of its displacements,
+# velocities (as csv) and bar forces, each written once directly and once
+# with -async. The async files must be byte for byte the same
+# as the others:
+#  - after a full analysis and a wipe, with some 1.8 million values in
+#    all, more than the bounded buffer of the writer holds;
+#  - after a wipe right after a few steps, with rows still pending;
+#  - in another process that samples on two workers in the middle of the
+#    analysis and exits right after its last step without a wipe.
+
+puts "AsyncRecorders.tcl: files written with -async are the same as those written directly"
+
+set asyncChain {
+proc asyncChain {numSteps} {
+    set numBars 600
+
+    wipe
+    model Basic -ndm 1 -ndf 1
+    for {set i 0} {$i <= $numBars} {incr i} {
+        node [expr $i + 1] [expr 1.0*$i] -mass [expr 1.0 + 0.001*$i]
+    }
+    fix 1 1
+    uniaxialMaterial Elastic 1 1000.0
+    for {set i 1} {$i <= $numBars} {incr i} {
+        element Truss $i $i [expr $i + 1] [expr 1.0 + 0.0005*$i] 1
+    }
+    timeSeries Sine 1 0.0 100.0 0.8
+    pattern Plain 1 1 { load [expr $numBars + 1] 10.0 }
+
+    foreach mode {"" -async} name {Direct Async} {
+        eval recorder Node    -file AsyncNode$name.out    $mode -time -nodeRange 1 [expr $numBars + 1] -dof 1 disp
+        eval recorder Node    -csv  AsyncNode$name.csv    $mode -time -nodeRange 1 [expr $numBars + 1] -dof 1 vel
+        eval recorder Element -file AsyncElement$name.out $mode -time -eleRange 1 $numBars axialForce
+    }
+
+    system BandSPD
+    numberer Plain
+    constraints Plain
+    algorithm Linear
+    integrator Newmark 0.5 0.25
+    analysis Transient
+    return [analyze $numSteps 0.01]
+}
+}
+eval $asyncChain
+
+set asyncFiles {AsyncNode%s.out AsyncNode%s.csv AsyncElement%s.out}
+
+proc readFile {fileName} {
+    set file [open $fileName r]
+    fconfigure $file -translation binary
+    set data [read $file]
+    close $file
+    return $data
+}
+
+# the number of rows of the files, or -1 if an async file differs
+proc compareFiles {} {
+    global asyncFiles
+    set rows {}
+    foreach pattern $asyncFiles {
+        set direct [format $pattern Direct]
+        set async  [format $pattern Async]
+        if {[catch {
+            set a [readFile $direct]
+            set b [readFile $async]
+        }]} {
+            return -1
+        }
+        if {$a ne $b} {
+            puts "failed to write $async as $direct"
+            return -1
+        }
+        lappend rows [llength [split [string trim $a] "\n"]]
+    }
+    return [lsort -unique $rows]
+}
+
+proc deleteFiles {} {
+    global asyncFiles
+    foreach pattern $asyncFiles {
+        file delete -force [format $pattern Direct] [format $pattern Async]
+    }
+}
+
+set testOK 0
+
+# a full analysis
+if {[asyncChain 1000] != 0} {
+    set testOK -1
+    puts "failed to analyze the chain"
+}
+wipe
+set rows [compareFiles]
+puts "full analysis: $rows rows"
+if {$rows != 1000} {
+    set testOK -1
+    puts "failed to write the rows of a full analysis: $rows"
+}
+deleteFiles
+
+# a wipe with rows pending
+asyncChain 7
+wipe
+set rows [compareFiles]
+puts "wipe after 7 steps: $rows rows"
+if {$rows != 7} {
+    set testOK -1
+    puts "failed to write the rows pending at a wipe: $rows"
+}
+deleteFiles
+
+# an exit with rows pending, after a fork
+set script [string cat $asyncChain {
+proc sampleChain {k z} {
+    wipe
+    return $k
+}
+asyncChain 200
+puts [sample 4 1 sampleChain -seed 7 -workers 2]
+analyze 100 0.01
+exit
+}]
+set scriptFile AsyncRecorders.run.tcl
+set file [open $scriptFile w]
+puts $file $script
+close $file
+
+set exe [info nameofexecutable]
+if {$exe == ""} {
+    set exe [file readlink /proc/self/exe]
+}
+if {[catch {exec -ignorestderr $exe $scriptFile} message]} {
+    set testOK -1
+    puts "failed to run the chain in another process: $message"
+} else {
+    set rows [compareFiles]
+    puts "exit after 300 steps and a fork: $rows rows"
+    if {$rows != 300} {
+        set testOK -1
+        puts "failed to write the rows pending at exit once: $rows"
+    }
+}
+file delete -force $scriptFile
+deleteFiles
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test AsyncRecorders.tcl \n\n"
+    puts $results "| PASSED |  AsyncRecorders.tcl"
+} else {
+    puts "FAILED Verification Test AsyncRecorders.tcl \n\n"
+    puts $results "FAILED : AsyncRecorders.tcl"
+}
+close $results
@@ -0,0 +1,68 @@
+# Element damping forces in an explicit analysis
+#
+# A mass on a zeroLength element with a spring k and, through -dampMats,
+# a dashpot c, under a constant load P. The dashpot force is only part of
+# getResistingForceIncInertia(), so ExplicitDifference must ask the
+# element for it even though the element has no Rayleigh damping.
+#
+# Starting from rest, the leap-frog steps give
+#   v = v + dt a,  u = u + dt v,  a = (P - k u - c v)/m
+
+puts "ExplicitElementDamping.tcl: damping of elements in an explicit analysis"
+
+set k  100.0
+set c  4.0
+set m  2.0
+set P  10.0
+set dt 0.01
+set numSteps 10
+
+wipe
+model Basic -ndm 1 -ndf 1
+node 1 0.0
+node 2 0.0 -mass $m
+fix 1 1
+uniaxialMaterial Elastic 1 $k
+uniaxialMaterial Elastic 2 $c
+element zeroLength 1 1 2 -mat 1 -dir 1 -dampMats 2
+timeSeries Constant 1
+pattern Plain 1 1 { load 2 $P }
+
+constraints Plain
+numberer Plain
+system Diagonal
+algorithm Linear
+integrator ExplicitDifference
+analysis Transient
+analyze $numSteps $dt
+
+set u 0.0
+set v 0.0
+set a 0.0
+for {set i 0} {$i < $numSteps} {incr i} {
+    set v [expr $v + $dt*$a]
+    set u [expr $u + $dt*$v]
+    set a [expr ($P - $k*$u - $c*$v)/$m]
+}
+set osU [nodeDisp 2 1]
+set osA [nodeAccel 2 1]
+
+set testOK 0
+set tol 1.0e-10
+set formatString {%10s%15.8f%15.8f}
+puts [format $formatString OpenSees: $osU $osA]
+puts [format $formatString exact: $u $a]
+if {abs($osU-$u) > $tol*abs($u) || abs($osA-$a) > $tol*abs($a)} {
+    set testOK -1
+    puts "failed response with element damping"
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test ExplicitElementDamping.tcl \n\n"
+    puts $results "| PASSED |  ExplicitElementDamping.tcl"
+} else {
+    puts "FAILED Verification Test ExplicitElementDamping.tcl \n\n"
+    puts $results "FAILED : ExplicitElementDamping.tcl"
+}
+close $results
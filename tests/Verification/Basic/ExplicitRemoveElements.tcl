@@ -0,0 +1,72 @@
+# Removing elements during an explicit analysis
+#
+# Node 2 is held by 2 bars with mass, under a constant load P. After one
+# step of ExplicitDifference, bar 1 is removed; the analysis model is then
+# patched instead of being built again, and the lumped mass must be formed
+# again without the mass of bar 1.
+#
+# Starting from rest, the leap-frog steps give
+#   a1 = P/M1,  u2 = dt^2 a1,  a2 = (P - k2 u2)/M2
+# where M1 is the mass with both bars, and k2 and M2 are those of bar 2.
+
+puts "ExplicitRemoveElements.tcl: removing elements in an explicit analysis"
+
+set E    1000.0
+set A1   2.0
+set A2   1.0
+set rho1 3.0
+set rho2 0.5
+set L    10.0
+set m    1.0
+set P    10.0
+set dt   0.01
+
+wipe
+model Basic -ndm 2 -ndf 2
+node 1 0.0 0.0
+node 2 $L  0.0 -mass $m $m
+fix 1 1 1
+fix 2 0 1
+uniaxialMaterial Elastic 1 $E
+element Truss 1 1 2 $A1 1 -rho $rho1
+element Truss 2 1 2 $A2 1 -rho $rho2
+timeSeries Constant 1
+pattern Plain 1 1 { load 2 $P 0.0 }
+
+constraints Plain
+numberer Plain
+system Diagonal
+algorithm Linear
+integrator ExplicitDifference
+analysis Transient
+
+analyze 1 $dt
+remove element 1
+analyze 1 $dt
+
+set M1 [expr $m + 0.5*($rho1 + $rho2)*$L]
+set M2 [expr $m + 0.5*$rho2*$L]
+set k2 [expr $E*$A2/$L]
+set u2 [expr $dt*$dt*$P/$M1]
+set exactA [expr ($P - $k2*$u2)/$M2]
+set osA [nodeAccel 2 1]
+
+set testOK 0
+set tol 1.0e-10
+set formatString {%10s%15.8f}
+puts [format $formatString removed: $osA]
+puts [format $formatString exact: $exactA]
+if {abs($osA-$exactA) > $tol*abs($exactA)} {
+    set testOK -1
+    puts "failed accel after removing elements"
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test ExplicitRemoveElements.tcl \n\n"
+    puts $results "| PASSED |  ExplicitRemoveElements.tcl"
+} else {
+    puts "FAILED Verification Test ExplicitRemoveElements.tcl \n\n"
+    puts $results "FAILED : ExplicitRemoveElements.tcl"
+}
+close $results
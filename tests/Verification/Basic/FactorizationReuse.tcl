@@ -0,0 +1,184 @@
+# Reusing the symbolic analysis and the factors of the sparse direct solvers
+#
+# A truss of Steel01 bars is pushed past yield with system UmfPack and
+# with system SparseGeneral (SuperLU), and the phase counts of systemTimes
+# are checked as the analysis goes on:
+#  - two steps of Newton on the same structure do the symbolic analysis
+#    (the ordering for SuperLU) once and factor every tangent;
+#  - ModifiedNewton solves many times with the one factorization of the
+#    tangent of each step;
+#  - a bar added between two nodes that are already joined keeps the
+#    structure stamp, so the symbolic analysis is kept;
+#  - a new node and bar change the structure and stamp, so it is redone.
+# After every phase the displacements must match those of FullGeneral.
+
+puts "FactorizationReuse.tcl: UmfPack and SuperLU keep their analysis while the structure is the same"
+
+proc reuseTruss {system} {
+    wipe
+    model Basic -ndm 2 -ndf 2
+    for {set j 0} {$j <= 4} {incr j} {
+        for {set i 0} {$i <= 3} {incr i} {
+            node [expr 10*$j + $i + 1] [expr 2.0*$i] [expr 2.0*$j]
+        }
+    }
+    fix 1 1 1
+    fix 4 1 1
+    uniaxialMaterial Steel01 1 250.0 2.0e5 0.3
+    set tag 1
+    for {set j 0} {$j <= 4} {incr j} {
+        for {set i 1} {$i <= 4} {incr i} {
+            set n [expr 10*$j + $i]
+            if {$i < 4} {
+                element Truss $tag $n [expr $n + 1] 0.001 1
+                incr tag
+            }
+            if {$j < 4} {
+                element Truss $tag $n [expr $n + 10] 0.001 1
+                incr tag
+                if {$i < 4} {
+                    element Truss $tag $n [expr $n + 11] 0.0005 1
+                    incr tag
+                }
+            }
+        }
+    }
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        load 41 0.15 -0.02
+        load 44 0.15 -0.02
+    }
+
+    eval system $system
+    numberer RCM
+    constraints Plain
+    test NormDispIncr 1.0e-10 200
+    algorithm Newton
+    integrator LoadControl 0.4
+    analysis Static
+}
+
+proc reuseDisp {} {
+    set disp {}
+    foreach node [getNodeTags] {
+        lappend disp {*}[nodeDisp $node]
+    }
+    return $disp
+}
+
+# the counts of the symbolic analysis, numeric and solve phases; SuperLU
+# orders the columns once for each structure, and sets up the permuted
+# matrix on every change of the domain
+proc reuseCounts {} {
+    set times [systemTimes]
+    set analysis [lindex [dict get $times ordering] 1]
+    if {$analysis == 0} {
+        set analysis [lindex [dict get $times symbolic] 1]
+    }
+    return [list $analysis [lindex [dict get $times numeric] 1] [lindex [dict get $times solve] 1]]
+}
+
+# the displacements and phase counts after each phase
+proc reuseRun {system} {
+    reuseTruss $system
+    set phases {}
+
+    analyze 1
+    lappend phases [list [reuseDisp] [reuseCounts]]
+    analyze 1
+    lappend phases [list [reuseDisp] [reuseCounts]]
+
+    algorithm ModifiedNewton
+    analyze 2
+    lappend phases [list [reuseDisp] [reuseCounts]]
+    algorithm Newton
+
+    # a second bar beside the bar from node 41 to 42
+    element Truss 100 41 42 0.001 1
+    analyze 1
+    lappend phases [list [reuseDisp] [reuseCounts]]
+
+    # a new node, braced to the top of the truss
+    node 100 8.0 8.0
+    fix 100 0 1
+    element Truss 101 44 100 0.001 1
+    analyze 1
+    lappend phases [list [reuseDisp] [reuseCounts]]
+    return $phases
+}
+
+proc reuseDifference {a b} {
+    if {[llength $a] != [llength $b]} {
+        return Inf
+    }
+    set scale 0.0
+    set diff  0.0
+    foreach x $a y $b {
+        if {abs($x) > $scale} { set scale [expr abs($x)] }
+        if {abs($x - $y) > $diff} { set diff [expr abs($x - $y)] }
+    }
+    return [expr {$diff/$scale}]
+}
+
+set testOK 0
+set tol 1.0e-9
+
+set reference [reuseRun FullGeneral]
+
+# the bars must yield for the tangent to change between steps
+set first [lindex $reference 0 0]
+set last  [lindex $reference 1 0]
+if {[reuseDifference $last [lmap x $first {expr 2.0*$x}]] < 1.0e-3} {
+    set testOK -1
+    puts "failed to push the truss past yield"
+}
+
+foreach system {UmfPack SparseGeneral} {
+    set phases [reuseRun $system]
+    foreach phase $phases ref $reference name {step {second step} ModifiedNewton {same structure} {new structure}} {
+        set d [reuseDifference [lindex $phase 0] [lindex $ref 0]]
+        if {$d > $tol} {
+            set testOK -1
+            puts "failed to find the displacements after the $name with $system: relative difference $d"
+        }
+    }
+    puts "$system symbolic, numeric and solve counts: [lmap phase $phases {lindex $phase 1}]"
+
+    lassign [lindex $phases 0 1] s1 n1 v1
+    lassign [lindex $phases 1 1] s2 n2 v2
+    lassign [lindex $phases 2 1] s3 n3 v3
+    lassign [lindex $phases 3 1] s4 n4 v4
+    lassign [lindex $phases 4 1] s5 n5 v5
+
+    if {$s1 != 1 || $s2 != 1} {
+        set testOK -1
+        puts "failed to keep the symbolic analysis between steps with $system"
+    }
+    if {$n2 != $v2} {
+        set testOK -1
+        puts "failed to factor every tangent of Newton with $system"
+    }
+    if {$n3 - $n2 != 2 || $v3 - $v2 < 6} {
+        set testOK -1
+        puts "failed to reuse the factors of ModifiedNewton with $system"
+    }
+    if {$s4 != $s3 || $n4 == $n3} {
+        set testOK -1
+        puts "failed to keep the stamp of the same structure with $system"
+    }
+    if {$s5 != $s4 + 1} {
+        set testOK -1
+        puts "failed to change the stamp of a new structure with $system"
+    }
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test FactorizationReuse.tcl \n\n"
+    puts $results "| PASSED |  FactorizationReuse.tcl"
+} else {
+    puts "FAILED Verification Test FactorizationReuse.tcl \n\n"
+    puts $results "FAILED : FactorizationReuse.tcl"
+}
+close $results
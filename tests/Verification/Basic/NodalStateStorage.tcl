@@ -0,0 +1,171 @@
+# Committing and reverting nodal state with and without contiguous storage
+#
+# A braced frame is shaken past the yield of its Steel01 braces three
+# times: with the state in the nodes, with setNodalStateStorage
+# contiguous, and switching between the two during the analysis. Each run
+#  - takes steps, which commit the nodes;
+#  - fails a step (a test of one iteration), which reverts the domain to
+#    the last commit, and calls printA, which reverts it again;
+#  - adds a node and a brace, so the contiguous store is built again;
+#  - resets the model to the start and takes more steps.
+# The displacements, velocities and accelerations of the nodes and the
+# forces of the elements after each phase must be identical in the three
+# runs, and a reverted step must leave the state of the last commit.
+
+puts "NodalStateStorage.tcl: commit and revert give the same state with and without contiguous nodal storage"
+
+proc storeFrame {} {
+    wipe
+    model Basic -ndm 2 -ndf 3
+    for {set j 0} {$j <= 3} {incr j} {
+        for {set i 0} {$i <= 4} {incr i} {
+            node [expr 10*$j + $i + 1] [expr 5.0*$i] [expr 3.0*$j] -mass 2.0 2.0 0.01
+        }
+    }
+    for {set i 1} {$i <= 5} {incr i} {
+        fix $i 1 1 1
+    }
+    uniaxialMaterial Steel01 1 250.0 2.0e5 0.01
+    geomTransf Linear 1
+    set tag 1
+    for {set j 0} {$j < 3} {incr j} {
+        for {set i 1} {$i <= 5} {incr i} {
+            set n [expr 10*$j + $i]
+            element elasticBeamColumn $tag $n [expr $n + 10] 0.02 2.0e5 1.0e-4 1
+            incr tag
+            if {$i < 5} {
+                element elasticBeamColumn $tag [expr $n + 10] [expr $n + 11] 0.02 2.0e5 2.0e-4 1
+                incr tag
+                element Truss $tag $n [expr $n + 11] 0.002 1
+                incr tag
+            }
+        }
+    }
+    timeSeries Sine 1 0.0 100.0 0.6 -factor 6.0
+    pattern UniformExcitation 1 1 -accel 1
+
+    system BandGeneral
+    numberer RCM
+    constraints Plain
+    test NormDispIncr 1.0e-10 20
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+}
+
+proc storeState {} {
+    set state {}
+    foreach node [getNodeTags] {
+        lappend state {*}[nodeDisp $node] {*}[nodeVel $node] {*}[nodeAccel $node]
+    }
+    foreach ele [getEleTags] {
+        lappend state {*}[eleForce $ele]
+    }
+    return $state
+}
+
+# steps of the analysis, keeping the largest axial force of the braces
+proc storeSteps {numSteps} {
+    global storeBraceForce
+    for {set k 0} {$k < $numSteps} {incr k} {
+        analyze 1 0.02
+        foreach ele [getEleTags] {
+            if {[eleType $ele] == "Truss"} {
+                set force [lindex [eleResponse $ele axialForce] 0]
+                if {abs($force) > $storeBraceForce} { set storeBraceForce [expr abs($force)] }
+            }
+        }
+    }
+}
+
+# a step that fails and reverts the domain, then printA, which reverts too
+proc storeFailStep {} {
+    test NormDispIncr 1.0e-16 1
+    set failed [analyze 1 0.02]
+    test NormDispIncr 1.0e-10 20
+    printA -ret
+    return $failed
+}
+
+# the states after each phase, and whether the reverted states were kept
+proc storeRun {storage} {
+    global storeReverts storeBraceForce
+    set storeReverts 0
+    set storeBraceForce 0.0
+
+    storeFrame
+    if {$storage == "contiguous"} {
+        setNodalStateStorage contiguous
+    }
+    set states {}
+
+    storeSteps 10
+    lappend states [storeState]
+    if {[storeFailStep] == 0 || [storeState] != [lindex $states end]} {
+        incr storeReverts
+    }
+
+    if {$storage == "switch"} {
+        setNodalStateStorage contiguous
+    }
+    storeSteps 10
+    lappend states [storeState]
+    if {[storeFailStep] == 0 || [storeState] != [lindex $states end]} {
+        incr storeReverts
+    }
+
+    # a brace of the top story to a new support
+    node 100 25.0 9.0 -mass 2.0 2.0 0.01
+    fix 100 1 1 1
+    element Truss 100 34 100 0.002 1
+    storeSteps 10
+    lappend states [storeState]
+
+    if {$storage == "switch"} {
+        setNodalStateStorage node
+    }
+    reset
+    lappend states [storeState]
+    storeSteps 5
+    lappend states [storeState]
+    return $states
+}
+
+set testOK 0
+
+set reference [storeRun node]
+if {$storeReverts != 0} {
+    set testOK -1
+    puts "failed to revert failed steps with the state in the nodes"
+}
+foreach storage {contiguous switch} {
+    set states [storeRun $storage]
+    if {$storeReverts != 0} {
+        set testOK -1
+        puts "failed to revert failed steps with storage $storage"
+    }
+    foreach phase {steps {a revert} {the new brace} reset {steps after the reset}} a $reference b $states {
+        if {$a != $b} {
+            set testOK -1
+            puts "failed to reproduce the state after $phase with storage $storage"
+        }
+    }
+}
+wipe
+
+# the braces must yield, at 0.5, for the history of the elements to matter
+puts [format "largest brace force: %.4g" $storeBraceForce]
+if {$storeBraceForce < 0.5} {
+    set testOK -1
+    puts "failed to yield the braces"
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test NodalStateStorage.tcl \n\n"
+    puts $results "| PASSED |  NodalStateStorage.tcl"
+} else {
+    puts "FAILED Verification Test NodalStateStorage.tcl \n\n"
+    puts $results "FAILED : NodalStateStorage.tcl"
+}
+close $results
@@ -0,0 +1,186 @@
+# Evaluating random samples of a model on several workers
+#
+# A bar of length L and area A has a lognormal modulus E = E0 exp(0.1 z1)
+# and is pulled by a normal load P = P0 (1 + 0.2 z2), where z1 and z2 are
+# the standard normal numbers of each sample. The sample command builds
+# and analyzes the bar for every sample; its end displacement must be
+# P L/(E A). With the same seed, the samples must be identical for any
+# number of workers, while another seed must give other numbers.
+#
+# A 3d column of 128 fibers, whose yield stress is random, is sampled the
+# same way. Its samples are also drawn on two workers by another process
+# that has a thread pool of two threads, an async recorder and a
+# checkpoint being written when it forks; they must match the serial
+# samples, and the recorder must hold the rows of that process only once.
+
+puts "ParallelSampling.tcl: the same samples of a bar and a fiber column for any number of workers"
+
+set L  2.0
+set A  0.01
+set E0 2.0e8
+set P0 1000.0
+set numSamples 20
+
+proc bar {k z} {
+    global L A E0 P0
+    lassign $z z1 z2
+    set E [expr $E0*exp(0.1*$z1)]
+    set P [expr $P0*(1.0 + 0.2*$z2)]
+
+    wipe
+    model Basic -ndm 1 -ndf 1
+    node 1 0.0
+    node 2 $L
+    fix 1 1
+    uniaxialMaterial Elastic 1 $E
+    element Truss 1 1 2 $A 1
+    timeSeries Linear 1
+    pattern Plain 1 1 { load 2 $P }
+    system BandGeneral
+    numberer Plain
+    constraints Plain
+    test NormDispIncr 1.0e-12 10
+    algorithm Newton
+    integrator LoadControl 1.0
+    analysis Static
+    analyze 1
+    return [list [nodeDisp 2 1] $z1 $z2]
+}
+
+set testOK 0
+set tol 1.0e-12
+
+set serial [sample $numSamples 2 bar -seed 7 -size 3]
+foreach s $serial {
+    lassign $s u z1 z2
+    set exact [expr $P0*(1.0 + 0.2*$z2)*$L/($E0*exp(0.1*$z1)*$A)]
+    if {abs($u-$exact) > $tol*abs($exact)} {
+        set testOK -1
+        puts "failed displacement $u, want $exact"
+        break
+    }
+}
+
+foreach numWorkers {2 3} {
+    set parallel [sample $numSamples 2 bar -seed 7 -workers $numWorkers -size 3]
+    puts [format "%2d workers: %d of %d samples" $numWorkers [llength $parallel] $numSamples]
+    if {$parallel != $serial} {
+        set testOK -1
+        puts "failed to reproduce the samples on $numWorkers workers"
+    }
+}
+
+if {[sample $numSamples 2 bar -seed 8 -size 3] == $serial} {
+    set testOK -1
+    puts "failed to change the samples with the seed"
+}
+
+set column {
+proc column {k z} {
+    wipe
+    model Basic -ndm 3 -ndf 6
+    uniaxialMaterial Steel01 1 [expr 400000.0*(1.0 + 0.1*[lindex $z 0])] 2.0e8 0.01
+    section Fiber 1 -GJ 1.0e6 {
+        patch rect 1 16 8 -0.2 -0.15 0.2 0.15
+    }
+    geomTransf Linear 1 1.0 0.0 0.0
+    node 1 0.0 0.0 0.0
+    node 2 0.0 0.0 3.0
+    fix 1 1 1 1 1 1 1
+    element forceBeamColumn 1 1 2 5 1 1
+    timeSeries Linear 1
+    pattern Plain 1 1 { load 2 1500.0 1000.0 -2000.0 0.0 0.0 0.0 }
+    system BandGeneral
+    numberer RCM
+    constraints Plain
+    test NormDispIncr 1.0e-10 20
+    algorithm Newton
+    integrator LoadControl 0.1
+    analysis Static
+    return [list [analyze 10] [nodeDisp 2 1] [nodeDisp 2 2]]
+}
+}
+eval $column
+
+set serialColumn [sample 3 1 column -seed 7 -size 3]
+foreach s $serialColumn {
+    if {[lindex $s 0] != 0} {
+        set testOK -1
+        puts "failed to analyze the column"
+        break
+    }
+}
+if {[sample 3 1 column -seed 7 -size 3 -workers 2] != $serialColumn} {
+    set testOK -1
+    puts "failed to reproduce the column samples on 2 workers"
+}
+
+set script [string cat $column {
+model Basic -ndm 1 -ndf 1
+node 1 0.0
+node 2 1.0
+fix 1 1
+uniaxialMaterial Elastic 1 100.0
+element Truss 1 1 2 1.0 1
+timeSeries Linear 1
+pattern Plain 1 1 { load 2 1.0 }
+recorder Node -file ParallelSampling.out -async -node 2 -dof 1 disp
+system BandGeneral
+numberer Plain
+constraints Plain
+test NormDispIncr 1.0e-12 10
+algorithm Newton
+integrator LoadControl 0.1
+analysis Static
+setNumThreads 2
+analyze 5
+checkpoint ParallelSampling.bin
+puts [sample 3 1 column -seed 7 -size 3 -workers 2]
+}]
+
+set scriptFile ParallelSampling.run.tcl
+set file [open $scriptFile w]
+puts $file $script
+close $file
+
+set exe [info nameofexecutable]
+if {$exe == ""} {
+    set exe [file readlink /proc/self/exe]
+}
+
+if {[catch {
+    set forked [lindex [split [string trim [exec -ignorestderr $exe $scriptFile]] "\n"] end]
+    set file [open ParallelSampling.out r]
+    set rows [llength [split [string trim [read $file]] "\n"]]
+    close $file
+} message]} {
+    set testOK -1
+    puts "failed to sample in another process: $message"
+} else {
+    if {$forked != $serialColumn} {
+        set testOK -1
+        puts "failed to reproduce the column samples on a pool of two threads"
+    }
+    if {$rows != 5} {
+        set testOK -1
+        puts "failed to record the rows once: $rows rows"
+    }
+}
+file delete -force $scriptFile ParallelSampling.out ParallelSampling.bin
+
+# a failed sample fails the command
+if {[catch {sample 4 2 {error "no analysis"} -seed 7 -workers 2}] == 0} {
+    set testOK -1
+    puts "failed to report a failed sample"
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test ParallelSampling.tcl \n\n"
+    puts $results "| PASSED |  ParallelSampling.tcl"
+} else {
+    puts "FAILED Verification Test ParallelSampling.tcl \n\n"
+    puts $results "FAILED : ParallelSampling.tcl"
+}
+close $results
@@ -0,0 +1,126 @@
+# Families of peridynamic particles from the cell list
+#
+# The families that peri fam builds from the cells of PeriNeighborGrid
+# must be the families of a search over all pairs of particles: the
+# particles closer than the horizon, other than the particle itself and
+# those at the same point, in ascending order. They are compared for
+#  - a cloud of random particles in 2D, with two particles at the same
+#    point and one far from the others, so the cells are widened;
+#  - the regular grid of particles of tests/peridynamics, whose horizon
+#    is just over three spacings;
+#  - a cloud of random particles in 3D;
+# each built on one thread and with setNumThreads 4.
+
+puts "PeriFamilies.tcl: the families from the cell list are those of a search over all pairs"
+
+# the particles of the cloud, in a box of the given sizes
+proc periCloud {numParticles sizes} {
+    set particles {}
+    for {set i 0} {$i < $numParticles} {incr i} {
+        set x {}
+        foreach size $sizes {
+            lappend x [expr {$size*(rand() - 0.5)}]
+        }
+        lappend particles $x
+    }
+    return $particles
+}
+
+# the families of a search over all pairs, with the test of create_fam
+proc periAllPairs {particles delta} {
+    set families {}
+    foreach xi $particles {
+        set fam {}
+        set j 0
+        foreach xj $particles {
+            set dist 0.0
+            foreach a $xi b $xj {
+                set dist [expr {$dist + ($b - $a)*($b - $a)}]
+            }
+            set dist [expr {sqrt($dist)}]
+            if {$dist < $delta && $dist > 1.0e-8*$delta} {
+                lappend fam $j
+            }
+            incr j
+        }
+        lappend families $fam
+    }
+    return $families
+}
+
+# the families from peri fam
+proc periFamilies {particles delta maxfam numThreads} {
+    set ndim [llength [lindex $particles 0]]
+    wipe
+    model Basic -ndm $ndim
+    if {$numThreads > 1} {
+        setNumThreads $numThreads
+    }
+    if {$ndim == 2} {
+        peri init 2 [llength $particles] $maxfam e
+    } else {
+        peri init 3 [llength $particles] $maxfam x
+    }
+    set i 0
+    foreach x $particles {
+        peri node $i {*}$x
+        incr i
+    }
+    peri fam $delta
+    return [peri prin fam -ret]
+}
+
+set testOK 0
+expr {srand(11)}
+
+set cloud2d [periCloud 900 {10.0 10.0}]
+lappend cloud2d [lindex $cloud2d 17] {1000.0 -500.0}
+
+set space 0.25
+set grid2d {}
+for {set i 0} {$i <= 40} {incr i} {
+    for {set j 0} {$j <= 40} {incr j} {
+        lappend grid2d [list [expr {-5.0 + $space*$i}] [expr {-5.0 + $space*$j}]]
+    }
+}
+
+set cloud3d [periCloud 500 {4.0 4.0 4.0}]
+
+set maxfam 200
+foreach name {"2D cloud" "2D grid" "3D cloud"} particles [list $cloud2d $grid2d $cloud3d] delta [list 0.8 [expr {3.01*$space}] 0.9] {
+    set expected [periAllPairs $particles $delta]
+    set largest 0
+    foreach fam $expected {
+        if {[llength $fam] > $largest} { set largest [llength $fam] }
+    }
+    puts "$name: [llength $particles] particles, up to $largest neighbors"
+    if {$largest >= $maxfam || $largest < 10} {
+        set testOK -1
+        puts "failed to choose a horizon for the $name"
+    }
+    foreach numThreads {1 4} {
+        set families [periFamilies $particles $delta $maxfam $numThreads]
+        if {$families != $expected} {
+            set testOK -1
+            puts "failed to find the families of the $name on $numThreads threads"
+        }
+    }
+}
+
+# the two particles at the same point are not in each other's family
+set families [periFamilies $cloud2d 0.8 $maxfam 1]
+if {[lsearch [lindex $families 17] 900] >= 0 || [lindex $families 901] != {}} {
+    set testOK -1
+    puts "failed to leave particles at the same point out of the families"
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test PeriFamilies.tcl \n\n"
+    puts $results "| PASSED |  PeriFamilies.tcl"
+} else {
+    puts "FAILED Verification Test PeriFamilies.tcl \n\n"
+    puts $results "FAILED : PeriFamilies.tcl"
+}
+close $results
@@ -0,0 +1,171 @@
+# Profiling the phases of an analysis
+#
+# A column of fibers of Steel01, braced by a truss, is pushed with a
+# recorder of its top, and the profile command is checked:
+#  - nothing is counted while profiling is off;
+#  - after profile on (or start), the report has a row for each phase
+#    of the element, material, system, test and recorder, and the calls
+#    counted agree with the steps and iterations of the analysis;
+#  - the report -json has the same rows as the table;
+#  - profile off (or stop) keeps the totals, and profile reset clears them.
+
+puts "Profile.tcl: profile counts the calls of the phases of an analysis"
+
+proc profileColumn {} {
+    wipe
+    model Basic -ndm 2 -ndf 3
+    node 1 0.0 0.0
+    node 2 0.0 3.0
+    node 3 2.0 0.0
+    fix 1 1 1 1
+    fix 3 1 1 1
+    uniaxialMaterial Steel01 1 400.0 2.0e5 0.01
+    uniaxialMaterial Elastic 2 2.0e5
+    section Fiber 1 {
+        patch rect 1 8 1 -0.2 -0.15 0.2 0.15
+    }
+    geomTransf Linear 1
+    element forceBeamColumn 1 1 2 5 1 1
+    element Truss 2 3 2 0.001 2
+    timeSeries Linear 1
+    pattern Plain 1 1 { load 2 20.0 -100.0 0.0 }
+    recorder Node -file ProfileTop.out -time -node 2 -dof 1 2 disp
+
+    system BandGeneral
+    numberer Plain
+    constraints Plain
+    test NormDispIncr 1.0e-10 20
+    algorithm Newton
+    integrator LoadControl 0.1
+    analysis Static
+}
+
+# the steps and the iterations of the analysis
+proc profileAnalyze {numSteps} {
+    set iterations 0
+    for {set step 0} {$step < $numSteps} {incr step} {
+        if {[analyze 1] != 0} {
+            return -code error "step $step failed"
+        }
+        incr iterations [testIter]
+    }
+    return $iterations
+}
+
+# the calls of the rows of the table, by phase and class
+proc profileTable {} {
+    set calls {}
+    foreach line [lrange [split [string trim [profile report]] "\n"] 1 end] {
+        dict set calls [lindex $line 0] [lindex $line 1] [lindex $line 3]
+    }
+    return $calls
+}
+
+# the calls of the rows of the JSON report, by phase and class
+proc profileJson {} {
+    set calls {}
+    foreach {match phase class n} [regexp -all -inline \
+            {\{"phase":"([^"]+)","class":"([^"]+)","classTag":-?[0-9]+,"calls":([0-9]+),"seconds":[^\}]+\}} \
+            [profile report -json]] {
+        dict set calls $phase $class $n
+    }
+    return $calls
+}
+
+proc profileCalls {calls phase class} {
+    if {[dict exists $calls $phase $class]} {
+        return [dict get $calls $phase $class]
+    }
+    return 0
+}
+
+set testOK 0
+profile off
+profile reset
+
+profileColumn
+profileAnalyze 2
+if {[profile report -json] != {[]}} {
+    set testOK -1
+    puts "failed to leave the profile empty while it is off"
+}
+
+profile on
+set numSteps 8
+set iterations [profileAnalyze $numSteps]
+set table [profileTable]
+set json  [profileJson]
+puts [profile report]
+
+if {$table != $json} {
+    set testOK -1
+    puts "failed to report the same rows as a table and as JSON"
+}
+
+foreach {phase class} {
+    element.update   ForceBeamColumn2d
+    element.tangent  ForceBeamColumn2d
+    element.residual ForceBeamColumn2d
+    element.update   Truss
+    material.setTrial Steel01
+    system.addA      BandGenLinSOE
+} {
+    if {[profileCalls $table $phase $class] == 0} {
+        set testOK -1
+        puts "failed to profile $phase of $class"
+    }
+}
+
+# each iteration solves once, tests once, and updates and forms the
+# tangent of each element once; each step records once
+set solves [profileCalls $table system.solve BandGenLinSOE]
+set tests  [profileCalls $table test CTestNormDispIncr]
+set updates [profileCalls $table element.update Truss]
+set records [profileCalls $table recorder.record NodeRecorder]
+puts "$numSteps steps, $iterations iterations: $solves solves, $tests tests, $updates updates, $records records"
+if {$solves != $iterations || $tests != $iterations || $updates != $iterations} {
+    set testOK -1
+    puts "failed to count the calls of the iterations"
+}
+if {$records != $numSteps} {
+    set testOK -1
+    puts "failed to count the calls of the recorder"
+}
+
+# off keeps the totals, and start and stop are the same as on and off
+profile stop
+profileAnalyze 2
+if {[profileTable] != $table} {
+    set testOK -1
+    puts "failed to stop counting when profiling is off"
+}
+profile start
+profileAnalyze 1
+if {[profileCalls [profileTable] recorder.record NodeRecorder] != $numSteps + 1} {
+    set testOK -1
+    puts "failed to count again when profiling is started"
+}
+profile off
+
+if {![catch {profile sideways}]} {
+    set testOK -1
+    puts "failed to reject an unknown argument"
+}
+
+profile reset
+if {[profile report -json] != {[]} || [profileTable] != {}} {
+    set testOK -1
+    puts "failed to clear the profile"
+}
+wipe
+file delete -force ProfileTop.out
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test Profile.tcl \n\n"
+    puts $results "| PASSED |  Profile.tcl"
+} else {
+    puts "FAILED Verification Test Profile.tcl \n\n"
+    puts $results "FAILED : Profile.tcl"
+}
+close $results
@@ -0,0 +1,70 @@
+# Removing elements between steps of an analysis
+#
+# 5 elastic bars meet at node 6. After one step, bars 4 and 5 are removed
+# and the analysis continues; the analysis model is then patched for the
+# removed elements instead of being built again. The displacement after
+# the second step must be that of the 3 remaining bars under the total load.
+
+puts "RemoveElements.tcl: removing several elements between analysis steps"
+
+set A 10.0
+set E 3000.0
+set P 100.0
+
+proc buildBars {numBars} {
+    global A E P
+    wipe
+    model Basic -ndm 2 -ndf 2
+    node 1 -100.0 0.0
+    node 2  -50.0 0.0
+    node 3    0.0 0.0
+    node 4   50.0 0.0
+    node 5  100.0 0.0
+    node 6    0.0 -100.0
+    for {set i 1} {$i <= 5} {incr i} { fix $i 1 1 }
+    uniaxialMaterial Elastic 1 $E
+    for {set i 1} {$i <= $numBars} {incr i} { element Truss $i $i 6 $A 1 }
+    timeSeries Linear 1
+    pattern Plain 1 1 { load 6 [expr 0.3*$P] -$P }
+    numberer Plain
+    constraints Plain
+    algorithm Linear
+    system BandGeneral
+    integrator LoadControl 1.0
+    analysis Static
+}
+
+# the 3 bars from the start
+buildBars 3
+analyze 2
+set exactU [nodeDisp 6 1]
+set exactV [nodeDisp 6 2]
+
+# all 5 bars, then remove 2 of them
+buildBars 5
+analyze 1
+remove element 4
+remove element 5
+analyze 1
+set osU [nodeDisp 6 1]
+set osV [nodeDisp 6 2]
+
+set testOK 0
+set tol 1.0e-10
+set formatString {%10s%15.8f%15.8f}
+puts [format $formatString removed: $osU $osV]
+puts [format $formatString exact: $exactU $exactV]
+if {abs($osU-$exactU) > $tol || abs($osV-$exactV) > $tol} {
+    set testOK -1
+    puts "failed disp after removing elements"
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test RemoveElements.tcl \n\n"
+    puts $results "| PASSED |  RemoveElements.tcl"
+} else {
+    puts "FAILED Verification Test RemoveElements.tcl \n\n"
+    puts $results "FAILED : RemoveElements.tcl"
+}
+close $results
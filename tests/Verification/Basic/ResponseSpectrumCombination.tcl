@@ -0,0 +1,170 @@
+# Combining the modes of a response spectrum analysis by SRSS and CQC
+#
+# Two masses on a chain of two springs, whose modes follow in closed form
+# from the 2 by 2 eigenvalue problem. The peak modal displacements
+#     u_n = Gamma_n phi_n Sa(T_n) / omega_n^2
+# are combined by SRSS and by CQC with the correlation coefficients of
+# Der Kiureghian (1981), and compared with the displacements committed by
+# responseSpectrum -combine, and with those recorded by a node recorder.
+# Element forces, reactions and velocities are not combined, so the
+# analysis must fail while a recorder of them is set. A -scale factor
+# scales the displacements of a single mode as well.
+
+puts "ResponseSpectrumCombination.tcl: SRSS and CQC of a 2 dof spring chain"
+
+set m1 10.0
+set m2 10.0
+set k1 1000.0
+set k2 500.0
+set zeta 0.05
+set Tn {0.1 2.0}
+set Sa {3.0 1.0}
+set pi [expr acos(-1.0)]
+
+proc buildModel {} {
+    global m1 m2 k1 k2
+    wipe
+    model Basic -ndm 2 -ndf 2
+    node 1 0.0 0.0
+    node 2 1.0 0.0
+    node 3 2.0 0.0
+    fix 1 1 1
+    fix 2 0 1
+    fix 3 0 1
+    mass 2 $m1 0.0
+    mass 3 $m2 0.0
+    uniaxialMaterial Elastic 1 $k1
+    uniaxialMaterial Elastic 2 $k2
+    element Truss 1 1 2 1.0 1
+    element Truss 2 2 3 1.0 2
+    constraints Plain
+    numberer Plain
+    system FullGeneral
+    test NormDispIncr 1.0e-12 10
+    algorithm Linear
+    integrator LoadControl 0.0
+    analysis Static
+    eigen -fullGenLapack 2
+    modalProperties
+}
+
+proc spectrum {T} {
+    global Tn Sa
+    set T0 [lindex $Tn 0]; set T1 [lindex $Tn 1]
+    set S0 [lindex $Sa 0]; set S1 [lindex $Sa 1]
+    return [expr $S0 + ($T-$T0)/($T1-$T0)*($S1-$S0)]
+}
+
+# the modes in closed form
+set a [expr $m1*$m2]
+set b [expr -(($k1+$k2)*$m2 + $k2*$m1)]
+set c [expr $k1*$k2]
+set root [expr sqrt($b*$b - 4.0*$a*$c)]
+set modes {}
+foreach lambda [list [expr (-$b - $root)/(2.0*$a)] [expr (-$b + $root)/(2.0*$a)]] {
+    set phi1 1.0
+    set phi2 [expr ($k1 + $k2 - $lambda*$m1)/$k2]
+    set gamma [expr ($m1*$phi1 + $m2*$phi2)/($m1*$phi1*$phi1 + $m2*$phi2*$phi2)]
+    set omega [expr sqrt($lambda)]
+    set factor [expr $gamma*[spectrum [expr 2.0*$pi/$omega]]/$lambda]
+    lappend modes [list $omega [expr $factor*$phi1] [expr $factor*$phi2]]
+}
+
+proc rho {wi wj} {
+    global zeta
+    set r [expr $wj/$wi]
+    return [expr 8.0*$zeta*$zeta*(1.0+$r)*$r*sqrt($r)/(pow(1.0-$r*$r,2) + 4.0*$zeta*$zeta*$r*pow(1.0+$r,2))]
+}
+
+set closedForm(SRSS) {}
+set closedForm(CQC)  {}
+foreach dof {1 2} {
+    set srss 0.0
+    set cqc  0.0
+    foreach mi $modes {
+        foreach mj $modes {
+            set ui [lindex $mi $dof]
+            set uj [lindex $mj $dof]
+            if {$mi == $mj} {
+                set srss [expr $srss + $ui*$uj]
+            }
+            set cqc [expr $cqc + [rho [lindex $mi 0] [lindex $mj 0]]*$ui*$uj]
+        }
+    }
+    lappend closedForm(SRSS) [expr sqrt($srss)]
+    lappend closedForm(CQC)  [expr sqrt($cqc)]
+}
+
+set testOK 0
+set tol 1.0e-10
+set formatString {%10s%15.8f%15.8f}
+foreach combination {SRSS CQC} {
+    buildModel
+    responseSpectrum 1 -Tn {*}$Tn -Sa {*}$Sa -combine $combination -damp $zeta
+    set u [list [nodeDisp 2 1] [nodeDisp 3 1]]
+    puts [format $formatString $combination: {*}$u]
+    puts [format $formatString exact: {*}$closedForm($combination)]
+    foreach ui $u ue $closedForm($combination) {
+        if {abs($ui-$ue) > $tol*abs($ue)} {
+            set testOK -1
+            puts "failed $combination displacement"
+        }
+    }
+}
+
+# the combined displacements are recorded
+buildModel
+recorder Node -file ResponseSpectrumCombination.out -node 2 3 -dof 1 disp
+responseSpectrum 1 -Tn {*}$Tn -Sa {*}$Sa -combine SRSS
+wipe
+set file [open ResponseSpectrumCombination.out r]
+set recorded [string trim [read $file]]
+close $file
+foreach ui $recorded ue $closedForm(SRSS) {
+    if {$ui == "" || abs($ui-$ue) > 1.0e-5*abs($ue)} {
+        set testOK -1
+        puts "failed to record the combined displacements: $recorded"
+        break
+    }
+}
+
+# the other responses of the combined step would come from the combined
+# displacements
+foreach recorderArgs {
+    {Element -ele 1 axialForce}
+    {Node -node 1 -dof 1 reaction}
+    {Node -node 2 -dof 1 vel}
+    {EnvelopeNode -node 2 -dof 1 accel}
+} {
+    buildModel
+    recorder [lindex $recorderArgs 0] -file ResponseSpectrumCombination.out {*}[lrange $recorderArgs 1 end]
+    if {[catch {responseSpectrum 1 -Tn {*}$Tn -Sa {*}$Sa -combine SRSS}] == 0} {
+        set testOK -1
+        puts "failed to refuse the recorder $recorderArgs"
+    }
+}
+wipe
+file delete -force ResponseSpectrumCombination.out
+
+# a scaled single mode
+buildModel
+responseSpectrum 1 -Tn {*}$Tn -Sa {*}$Sa -scale 2.0 -mode 1
+set u [list [nodeDisp 2 1] [nodeDisp 3 1]]
+foreach ui $u ue [lrange [lindex $modes 0] 1 2] {
+    if {abs($ui-2.0*$ue) > $tol*abs($ue)} {
+        set testOK -1
+        puts "failed to scale the displacements of mode 1: $u"
+        break
+    }
+}
+wipe
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test ResponseSpectrumCombination.tcl \n\n"
+    puts $results "| PASSED |  ResponseSpectrumCombination.tcl"
+} else {
+    puts "FAILED Verification Test ResponseSpectrumCombination.tcl \n\n"
+    puts $results "FAILED : ResponseSpectrumCombination.tcl"
+}
+close $results
@@ -0,0 +1,177 @@
+# Sharing the values of Path time series
+#
+# Series read from files, or given the same values, share one buffer of
+# values when the values are equal, and only then:
+#  - two binary files whose values differ but hash alike (their FNV-1a
+#    hashes are made to collide) must keep their own values;
+#  - a record read forty times, as a binary and as an ASCII file, must be
+#    held about once, which is checked on the resident size of the process
+#    where /proc/self/status gives it;
+#  - the values read from a file must stay the same once the file has
+#    been rewritten, or cut short.
+# The values of a series are its load factors after steps of LoadControl 1.0.
+
+puts "SeriesDataSharing.tcl: Path series share their values only when they are equal"
+
+proc writeDoubles {fileName values} {
+    set file [open $fileName w]
+    fconfigure $file -translation binary
+    puts -nonewline $file [binary format q* $values]
+    close $file
+}
+
+# the FNV-1a hash of the SeriesData cache, after the first word
+set fnvBasis 0xcbf29ce484222325
+set fnvPrime 0x100000001b3
+set mask64   0xFFFFFFFFFFFFFFFF
+proc doubleToWord {x} {
+    global mask64
+    binary scan [binary format q $x] w w
+    return [expr {$w & $mask64}]
+}
+proc fnvFirstHash {x} {
+    global fnvBasis fnvPrime mask64
+    return [expr {(($fnvBasis ^ [doubleToWord $x])*$fnvPrime) & $mask64}]
+}
+proc wordToDouble {w} {
+    if {$w >= 2**63} { set w [expr {$w - 2**64}] }
+    binary scan [binary format w $w] q x
+    return $x
+}
+
+# a bar, whose load patterns follow the series
+proc seriesModel {} {
+    wipe
+    model Basic -ndm 1 -ndf 1
+    node 1 0.0
+    node 2 1.0
+    fix 1 1
+    uniaxialMaterial Elastic 1 1.0
+    element Truss 1 1 2 1.0 1
+}
+
+# values of series 1, 2, ... at t = 1, 2, ..., numSteps
+proc seriesValues {numSeries numSteps} {
+    for {set i 1} {$i <= $numSeries} {incr i} {
+        pattern Plain $i $i {}
+    }
+    system BandGeneral
+    numberer Plain
+    constraints Plain
+    algorithm Linear
+    integrator LoadControl 1.0
+    analysis Static
+    set values {}
+    for {set step 1} {$step <= $numSteps} {incr step} {
+        analyze 1
+        for {set i 1} {$i <= $numSeries} {incr i} {
+            lappend values [getLoadFactor $i]
+        }
+    }
+    return $values
+}
+
+proc residentSize {} {
+    if {[catch {open /proc/self/status r} file]} {
+        return ""
+    }
+    set size ""
+    foreach line [split [read $file] "\n"] {
+        if {[lindex $line 0] == "VmRSS:"} {
+            set size [expr {[lindex $line 1]*1024}]
+        }
+    }
+    close $file
+    return $size
+}
+
+set testOK 0
+
+# two files of two values with the same hash
+set a [list 1.0 3.0]
+set b {}
+foreach first {2.0 5.0 7.0 9.0 11.0 13.0 17.0 19.0 23.0 29.0} {
+    set second [wordToDouble [expr {[fnvFirstHash 1.0] ^ [doubleToWord 3.0] ^ [fnvFirstHash $first]}]]
+    if {[string is double -strict $second] && abs($second) > 1.0e-100 && abs($second) < 1.0e100} {
+        set b [list $first $second]
+        break
+    }
+}
+if {$b == {}} {
+    set testOK -1
+    puts "failed to make two files with the same hash"
+} else {
+    writeDoubles SeriesDataA.bin $a
+    writeDoubles SeriesDataB.bin $b
+    seriesModel
+    timeSeries Path 1 -dt 1.0 -filePath SeriesDataA.bin -binary -useLast
+    timeSeries Path 2 -dt 1.0 -filePath SeriesDataB.bin -binary -useLast
+    set values [seriesValues 2 1]
+    puts "colliding files: [list $a $b] give [list $values]"
+    if {$values != [list [lindex $a 1] [lindex $b 1]]} {
+        set testOK -1
+        puts "failed to keep the values of files with the same hash apart"
+    }
+    wipe
+}
+
+# a record read forty times, held once
+set numValues 1000000
+set record {}
+for {set i 0} {$i < $numValues} {incr i} {
+    lappend record [expr {0.25*($i % 1000) - 100.0}]
+}
+writeDoubles SeriesDataRecord.bin $record
+set file [open SeriesDataRecord.txt w]
+puts $file [join $record "\n"]
+close $file
+unset record
+
+seriesModel
+set before [residentSize]
+for {set i 1} {$i <= 40} {incr i} {
+    if {$i % 2} {
+        timeSeries Path $i -dt 1.0 -filePath SeriesDataRecord.bin -binary
+    } else {
+        timeSeries Path $i -dt 1.0 -filePath SeriesDataRecord.txt
+    }
+}
+set after [residentSize]
+set values [seriesValues 40 3]
+if {[lsort -unique [lrange $values 0 39]] != -99.75 || [lsort -unique [lrange $values 80 119]] != -99.25} {
+    set testOK -1
+    puts "failed to read the record: [lsort -unique $values]"
+}
+if {$before != "" && $after != ""} {
+    set growth [expr {($after - $before)/(8.0*$numValues)}]
+    puts [format "forty series of the record take %.1f times its size" $growth]
+    if {$growth > 5.0} {
+        set testOK -1
+        puts "failed to share the record"
+    }
+}
+wipe
+
+# the values do not follow the file once it has been read
+writeDoubles SeriesDataA.bin {1.0 2.0 3.0 4.0}
+seriesModel
+timeSeries Path 1 -dt 1.0 -filePath SeriesDataA.bin -binary
+writeDoubles SeriesDataA.bin {5.0}
+set values [seriesValues 1 2]
+if {$values != {2.0 3.0}} {
+    set testOK -1
+    puts "failed to keep the values read from a file: $values"
+}
+wipe
+
+file delete -force SeriesDataA.bin SeriesDataB.bin SeriesDataRecord.bin SeriesDataRecord.txt
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test SeriesDataSharing.tcl \n\n"
+    puts $results "| PASSED |  SeriesDataSharing.tcl"
+} else {
+    puts "FAILED Verification Test SeriesDataSharing.tcl \n\n"
+    puts $results "FAILED : SeriesDataSharing.tcl"
+}
+close $results
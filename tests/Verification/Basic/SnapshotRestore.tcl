@@ -0,0 +1,111 @@
+# Running an analysis again from a snapshot of the model
+#
+# Two elastic bars with a mass at their joint are loaded by gravity, and
+# the state is saved with snapshot. A transient analysis is then run twice
+# from that snapshot:
+#  - restored in place, when the nodes had no velocity or acceleration
+#    at the save but do at the restore;
+#  - after a load pattern, a node and a bar are added, which the restore
+#    must remove.
+# Both runs must give the response of the first one.
+
+puts "SnapshotRestore.tcl: restoring the state of a model between analyses"
+
+wipe
+model Basic -ndm 2 -ndf 2
+node 1 0.0 0.0
+node 2 4.0 0.0
+node 3 2.0 3.0
+fix 1 1 1
+fix 2 1 1
+mass 3 10.0 10.0
+uniaxialMaterial Elastic 1 3000.0
+element Truss 1 1 3 10.0 1
+element Truss 2 2 3 10.0 1
+
+timeSeries Linear 1
+pattern Plain 1 1 { load 3 0.0 -50.0 }
+system BandGeneral
+numberer Plain
+constraints Plain
+test NormDispIncr 1.0e-12 10
+algorithm Newton
+integrator LoadControl 0.1
+analysis Static
+analyze 10
+loadConst -time 0.0
+
+timeSeries Sine 2 0.0 10.0 0.3
+pattern Plain 2 2 { load 3 20.0 0.0 }
+snapshot save gravity
+set nodeTags [getNodeTags]
+set eleTags  [getEleTags]
+
+proc shake {} {
+    wipeAnalysis
+    system BandGeneral
+    numberer Plain
+    constraints Plain
+    test NormDispIncr 1.0e-12 10
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+    analyze 50 0.01
+    return [list [nodeDisp 3 1] [nodeVel 3 1] [nodeAccel 3 1]]
+}
+
+set exact [shake]
+
+set testOK 0
+set tol 1.0e-12
+set formatString {%10s%15.8f%15.8f%15.8f}
+puts [format $formatString first: {*}$exact]
+
+# in place, with the velocities and accelerations of the first run
+snapshot restore gravity
+set inPlace [shake]
+puts [format $formatString inPlace: {*}$inPlace]
+foreach u $inPlace v $exact {
+    if {abs($u-$v) > $tol} {
+        set testOK -1
+        puts "failed response after restoring in place"
+        break
+    }
+}
+
+# with objects added since the save
+snapshot restore gravity
+pattern Plain 3 1 { load 3 100.0 0.0 }
+node 4 2.0 -3.0
+fix 4 1 1
+element Truss 3 3 4 10.0 1
+if {[catch {snapshot restore gravity}]} {
+    set testOK -1
+    puts "failed to restore with objects added"
+} else {
+    if {[getNodeTags] != $nodeTags || [getEleTags] != $eleTags} {
+        set testOK -1
+        puts "failed to remove the objects added"
+    }
+    set added [shake]
+    puts [format $formatString added: {*}$added]
+    foreach u $added v $exact {
+        if {abs($u-$v) > $tol} {
+            set testOK -1
+            puts "failed response after restoring with objects added"
+            break
+        }
+    }
+}
+
+snapshot remove gravity
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test SnapshotRestore.tcl \n\n"
+    puts $results "| PASSED |  SnapshotRestore.tcl"
+} else {
+    puts "FAILED Verification Test SnapshotRestore.tcl \n\n"
+    puts $results "FAILED : SnapshotRestore.tcl"
+}
+close $results
@@ -0,0 +1,184 @@
+# Assembling the tangent and the residual on several threads
+#
+# A frame of elastic beam-column columns (Linear transformation), braced
+# by trusses of Steel01 and Steel02 and tied by corotational trusses, is
+# pushed past yield and then shaken, first on one thread and then with
+# setNumThreads 4 and system FullGeneral -threads 4. The columns and the
+# trusses of these materials are updated and assembled concurrently,
+# while the braces of the middle bay, of ElasticPP which does not opt
+# in, are handled on the calling thread. After every step
+# the assembled tangent (printA) and residual (printB) and the
+# displacements must match those of the serial run to round-off, since
+# the threads add the elements in another order. The dynamic steps take
+# a fixed number of iterations so that their residual is not round-off.
+
+puts "ThreadedAssembly.tcl: the tangent, residual and displacements of threaded and serial assembly agree"
+
+set threadedBays    12
+set threadedStories 4
+
+proc threadedFrame {numThreads} {
+    global threadedBays threadedStories
+    set nx $threadedBays
+    set ny $threadedStories
+
+    wipe
+    model Basic -ndm 2 -ndf 3
+    if {$numThreads > 1} {
+        setNumThreads $numThreads
+    }
+
+    for {set j 0} {$j <= $ny} {incr j} {
+        for {set i 0} {$i <= $nx} {incr i} {
+            node [expr 100*$j + $i + 1] [expr 4.0*$i] [expr 3.0*$j] -mass 0.5 0.5 0.0
+        }
+    }
+    for {set i 0} {$i <= $nx} {incr i} {
+        fix [expr $i + 1] 1 1 1
+    }
+
+    uniaxialMaterial Steel01 1 250.0 2.0e5 0.02
+    uniaxialMaterial Steel02 2 300.0 2.0e5 0.01 18.0 0.925 0.15
+    uniaxialMaterial Elastic 3 2.0e5
+    uniaxialMaterial ElasticPP 4 2.0e5 0.002
+    geomTransf Linear 1
+
+    set tag 1
+    for {set j 1} {$j <= $ny} {incr j} {
+        for {set i 0} {$i <= $nx} {incr i} {
+            set n [expr 100*$j + $i + 1]
+            element elasticBeamColumn $tag [expr $n - 100] $n 0.02 2.0e5 1.0e-4 1
+            incr tag
+            if {$i < $nx} {
+                set mat [expr {$i == $nx/2 ? 4 : 1 + $tag % 2}]
+                element Truss $tag [expr $n - 100] [expr $n + 1] 0.01 $mat
+                incr tag
+                element Truss $tag [expr $n - 99] $n 0.01 $mat
+                incr tag
+                element corotTruss $tag $n [expr $n + 1] 0.015 3
+                incr tag
+            }
+        }
+    }
+
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        for {set j 1} {$j <= $ny} {incr j} {
+            load [expr 100*$j + 1] [expr 4.0*$j] -1.0 0.0
+        }
+    }
+
+    if {$numThreads > 1} {
+        system FullGeneral -threads $numThreads
+    } else {
+        system FullGeneral
+    }
+    numberer RCM
+    constraints Plain
+    test NormDispIncr 1.0e-10 50
+    algorithm Newton
+}
+
+# the tangent, residual and displacements after each step
+proc threadedSteps {} {
+    set states {}
+
+    integrator LoadControl 0.25
+    analysis Static
+    for {set step 0} {$step < 6} {incr step} {
+        if {[analyze 1] != 0} {
+            return -code error "static step $step failed"
+        }
+        lappend states [threadedState]
+    }
+
+    loadConst -time 0.0
+    timeSeries Sine 2 0.0 10.0 0.5 -factor 3.0
+    pattern UniformExcitation 2 1 -accel 2
+    wipeAnalysis
+    system FullGeneral -threads [getNumThreads]
+    numberer RCM
+    constraints Plain
+    test FixedNumIter 3
+    algorithm ModifiedNewton -initial
+    integrator Newmark 0.5 0.25
+    analysis Transient
+    for {set step 0} {$step < 6} {incr step} {
+        if {[analyze 1 0.05] != 0} {
+            return -code error "dynamic step $step failed"
+        }
+        lappend states [threadedState]
+    }
+    return $states
+}
+
+proc threadedState {} {
+    set disp {}
+    foreach node [getNodeTags] {
+        lappend disp {*}[nodeDisp $node]
+    }
+    return [list [printA -ret] [printB -ret] $disp]
+}
+
+# largest difference of two lists, relative to the largest entry of the
+# first or to 1.0, whichever is larger, as the residual of a converged
+# step is itself round-off
+proc threadedDifference {a b} {
+    if {[llength $a] != [llength $b]} {
+        return Inf
+    }
+    set scale 1.0
+    set diff  0.0
+    foreach x $a y $b {
+        if {abs($x) > $scale} { set scale [expr abs($x)] }
+        if {abs($x - $y) > $diff} { set diff [expr abs($x - $y)] }
+    }
+    return [expr {$diff/$scale}]
+}
+
+set testOK 0
+set tol 1.0e-10
+
+threadedFrame 1
+set serial [threadedSteps]
+set serialThreads [getNumThreads]
+
+threadedFrame 4
+set threaded [threadedSteps]
+set threadedThreads [getNumThreads]
+wipe
+
+if {$serialThreads != 1 || $threadedThreads != 4} {
+    set testOK -1
+    puts "failed to set the number of threads: $serialThreads and $threadedThreads"
+}
+
+set worst 0.0
+foreach s $serial t $threaded {
+    foreach name {tangent residual displacement} a $s b $t {
+        set d [threadedDifference $a $b]
+        if {$d > $worst} { set worst $d }
+        if {$d > $tol} {
+            set testOK -1
+            puts "failed to assemble the same $name on 4 threads: relative difference $d"
+        }
+    }
+}
+puts [format "largest relative difference over %d steps: %.2e" [llength $serial] $worst]
+
+# the tangent changes by much more than the change of geometry once the
+# braces yield
+if {[threadedDifference [lindex $serial 0 0] [lindex $serial 5 0]] < 1.0e-3} {
+    set testOK -1
+    puts "failed to push the frame past yield"
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test ThreadedAssembly.tcl \n\n"
+    puts $results "| PASSED |  ThreadedAssembly.tcl"
+} else {
+    puts "FAILED Verification Test ThreadedAssembly.tcl \n\n"
+    puts $results "FAILED : ThreadedAssembly.tcl"
+}
+close $results
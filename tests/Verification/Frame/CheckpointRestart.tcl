@@ -0,0 +1,134 @@
+# Restarting a dynamic analysis from a checkpoint file in another process
+#
+# A portal frame of fiber force and displacement based columns with
+# Rayleigh damping is shaken by a sine ground motion. One process writes a
+# checkpoint halfway through the record and exits; a second process
+# restarts from the file and finishes the record. The displacements and
+# velocities at the end must be those of the same analysis run without
+# interruption.
+
+puts "CheckpointRestart.tcl: continuing an analysis from a checkpoint in another process"
+
+set script {
+proc buildModel {} {
+    model Basic -ndm 2 -ndf 3
+    node 1 0.0 0.0
+    node 2 0.0 3.0
+    node 3 4.0 3.0
+    node 4 4.0 0.0
+    fix 1 1 1 1
+    fix 4 1 1 1
+    mass 2 10.0 10.0 0.0
+    mass 3 10.0 10.0 0.0
+    uniaxialMaterial Concrete01 1 -30000.0 -0.002 -20000.0 -0.006
+    uniaxialMaterial Steel01    2 400000.0 2.0e8 0.01
+    section Fiber 1 {
+        patch rect 1 8 2 -0.2 -0.2 0.2 0.2
+        layer straight 2 3 0.0005 -0.17 -0.17 -0.17 0.17
+        layer straight 2 3 0.0005  0.17 -0.17  0.17 0.17
+    }
+    geomTransf PDelta 1
+    geomTransf Linear 2
+    element forceBeamColumn 1 1 2 5 1 1
+    element dispBeamColumn  2 4 3 5 1 1
+    element elasticBeamColumn 3 2 3 0.1 2.0e8 0.001 2
+    timeSeries Sine 1 0.0 10.0 0.2
+    pattern UniformExcitation 1 1 -accel 1 -fact 3000.0
+    rayleigh 0.1 0.0 0.002 0.0
+}
+
+proc defineAnalysis {} {
+    system BandGeneral
+    numberer RCM
+    constraints Plain
+    test NormDispIncr 1.0e-10 20
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+}
+
+proc response {} {
+    set state {}
+    foreach node {2 3} {
+        lappend state {*}[nodeDisp $node] {*}[nodeVel $node]
+    }
+    return $state
+}
+
+switch [lindex $argv end] {
+    run {
+        buildModel
+        defineAnalysis
+        analyze 20 0.01
+        puts [response]
+    }
+    save {
+        buildModel
+        defineAnalysis
+        analyze 10 0.01
+        checkpoint CheckpointRestart.bin
+    }
+    restart {
+        model Basic -ndm 2 -ndf 3
+        restart CheckpointRestart.bin
+        defineAnalysis
+        analyze 10 0.01
+        puts [response]
+    }
+}
+}
+
+set scriptFile CheckpointRestart.run.tcl
+set file [open $scriptFile w]
+puts $file $script
+close $file
+
+set exe [info nameofexecutable]
+if {$exe == ""} {
+    set exe [file readlink /proc/self/exe]
+}
+
+proc runStep {step} {
+    global exe scriptFile
+    return [lindex [split [string trim [exec -ignorestderr $exe $scriptFile $step]] "\n"] end]
+}
+
+set testOK 0
+if {[catch {
+    set exact [runStep run]
+    runStep save
+    set restarted [runStep restart]
+} message]} {
+    set testOK -1
+    puts "failed to run the analysis: $message"
+}
+file delete -force $scriptFile CheckpointRestart.bin
+
+if {$testOK == 0} {
+    if {[llength $restarted] != [llength $exact]} {
+        set testOK -1
+        puts "failed to restart the analysis"
+    } else {
+        set scale 0.0
+        set error 0.0
+        foreach u $restarted v $exact {
+            if {abs($v) > $scale} { set scale [expr abs($v)] }
+            if {abs($u-$v) > $error} { set error [expr abs($u-$v)] }
+        }
+        puts [format "max difference %12.4e (max response %12.4e)" $error $scale]
+        if {$error > 1.0e-10*$scale} {
+            set testOK -1
+            puts "failed response after restart"
+        }
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test CheckpointRestart.tcl \n\n"
+    puts $results "| PASSED |  CheckpointRestart.tcl"
+} else {
+    puts "FAILED Verification Test CheckpointRestart.tcl \n\n"
+    puts $results "FAILED : CheckpointRestart.tcl"
+}
+close $results
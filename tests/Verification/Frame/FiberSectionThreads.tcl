@@ -0,0 +1,125 @@
+# Fiber section forces and stiffness on one thread and on several
+#
+# Two 3d cantilever columns, one of FiberSection3d and one of
+# FrameFiberSection3d, each of 16 by 8 concrete fibers and 8 bars, are
+# pushed into the inelastic range under axial load. A section of this
+# size is split into blocks on the thread pool when the pool has more
+# than one thread. The analysis runs in a process with the default pool
+# of one thread, and again in a process with setNumThreads 4; the
+# section forces and stiffness at every integration point must agree.
+
+puts "FiberSectionThreads.tcl: fiber section state on one and on four threads"
+
+set script {
+proc buildModel {} {
+    model Basic -ndm 3 -ndf 6
+    uniaxialMaterial Concrete01 1 -30000.0 -0.002 -20000.0 -0.006
+    uniaxialMaterial Steel01    2 400000.0 2.0e8 0.01
+    foreach {tag type} {1 Fiber 2 FrameFiber} {
+        section $type $tag -GJ 1.0e6 {
+            patch rect 1 16 8 -0.2 -0.15 0.2 0.15
+            layer straight 2 4 0.0005 -0.17 -0.12 -0.17 0.12
+            layer straight 2 4 0.0005  0.17 -0.12  0.17 0.12
+        }
+    }
+    geomTransf Linear 1 1.0 0.0 0.0
+    foreach column {1 2} {
+        set base [expr 10*$column]
+        node $base       [expr 2.0*$column] 0.0 0.0
+        node [expr $base+1] [expr 2.0*$column] 0.0 3.0
+        fix $base 1 1 1 1 1 1
+        element forceBeamColumn $column $base [expr $base+1] 5 $column 1
+    }
+    timeSeries Constant 1
+    pattern Plain 1 1 {
+        load 11 0.0 0.0 -500.0 0.0 0.0 0.0
+        load 21 0.0 0.0 -500.0 0.0 0.0 0.0
+    }
+    timeSeries Linear 2
+    pattern Plain 2 2 {
+        load 11 60.0 30.0 0.0 0.0 0.0 0.0
+        load 21 60.0 30.0 0.0 0.0 0.0 0.0
+    }
+}
+
+proc response {} {
+    set state {}
+    foreach column {1 2} {
+        for {set ip 1} {$ip <= 5} {incr ip} {
+            lappend state {*}[eleResponse $column section $ip force] {*}[eleResponse $column section $ip stiffness]
+        }
+    }
+    return $state
+}
+
+buildModel
+if {[lindex $argv end] == "threaded"} {
+    setNumThreads 4
+}
+system BandGeneral
+numberer RCM
+constraints Plain
+test NormDispIncr 1.0e-10 30
+algorithm Newton
+integrator LoadControl 0.1
+analysis Static
+if {[analyze 10] != 0} {
+    puts "failed to converge"
+} else {
+    puts [response]
+}
+}
+
+set scriptFile FiberSectionThreads.run.tcl
+set file [open $scriptFile w]
+puts $file $script
+close $file
+
+set exe [info nameofexecutable]
+if {$exe == ""} {
+    set exe [file readlink /proc/self/exe]
+}
+
+proc runStep {step} {
+    global exe scriptFile
+    return [lindex [split [string trim [exec -ignorestderr $exe $scriptFile $step]] "\n"] end]
+}
+
+set testOK 0
+if {[catch {
+    set serial   [runStep serial]
+    set threaded [runStep threaded]
+} message]} {
+    set testOK -1
+    puts "failed to run the analysis: $message"
+}
+file delete -force $scriptFile
+
+if {$testOK == 0} {
+    if {[llength $serial] != 2*5*(4+16) || [llength $threaded] != [llength $serial]} {
+        set testOK -1
+        puts "failed to read the section state"
+    } else {
+        set scale 0.0
+        set error 0.0
+        foreach u $threaded v $serial {
+            if {abs($v) > $scale} { set scale [expr abs($v)] }
+            if {abs($u-$v) > $error} { set error [expr abs($u-$v)] }
+        }
+        puts [format "max difference %12.4e (max value %12.4e)" $error $scale]
+        if {$error > 1.0e-12*$scale} {
+            set testOK -1
+            puts "failed section state on four threads"
+        }
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test FiberSectionThreads.tcl \n\n"
+    puts $results "| PASSED |  FiberSectionThreads.tcl"
+} else {
+    puts "FAILED Verification Test FiberSectionThreads.tcl \n\n"
+    puts $results "FAILED : FiberSectionThreads.tcl"
+}
+close $results
@@ -0,0 +1,93 @@
+# Frame solved by the symmetric direct solvers
+#
+# A 6 story, 3 bay elastic frame under lateral and gravity loads. Each
+# element stiffness is assembled into the symmetric storage of every
+# solver, so the displacements must be those of UmfPack.
+
+puts "SymmetricFrameSolvers.tcl: the symmetric direct solvers on an elastic frame"
+
+set numStory 6
+set numBay   3
+set H 3.0
+set B 6.0
+
+proc solveFrame {args} {
+    global numStory numBay H B
+    wipe
+    model Basic -ndm 2 -ndf 3
+    for {set j 0} {$j <= $numStory} {incr j} {
+        for {set i 0} {$i <= $numBay} {incr i} {
+            node [expr 10*$j + $i + 1] [expr $i*$B] [expr $j*$H]
+        }
+    }
+    for {set i 1} {$i <= $numBay+1} {incr i} { fix $i 1 1 1 }
+    geomTransf Linear 1
+    set e 1
+    for {set j 0} {$j < $numStory} {incr j} {
+        for {set i 1} {$i <= $numBay+1} {incr i} {
+            element elasticBeamColumn $e [expr 10*$j + $i] [expr 10*($j+1) + $i] 0.16 2.0e7 [expr 0.002 + 0.0001*$i] 1
+            incr e
+        }
+        for {set i 1} {$i <= $numBay} {incr i} {
+            element elasticBeamColumn $e [expr 10*($j+1) + $i] [expr 10*($j+1) + $i + 1] 0.12 2.0e7 0.0016 1
+            incr e
+        }
+    }
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        for {set j 1} {$j <= $numStory} {incr j} {
+            load [expr 10*$j + 1] [expr 10.0*$j] 0.0 0.0
+            for {set i 1} {$i <= $numBay+1} {incr i} { load [expr 10*$j + $i] 0.0 -50.0 [expr 0.5*$i] }
+        }
+    }
+    constraints Plain
+    numberer RCM
+    eval system $args
+    test NormDispIncr 1.0e-12 4
+    algorithm Linear
+    integrator LoadControl 1.0
+    analysis Static
+    if {[analyze 1] != 0} {
+        return {}
+    }
+    set disp {}
+    foreach node [getNodeTags] {
+        lappend disp {*}[nodeDisp $node]
+    }
+    return $disp
+}
+
+set testOK 0
+set exact [solveFrame UmfPack]
+set scale 0.0
+foreach u $exact {
+    if {abs($u) > $scale} { set scale [expr abs($u)] }
+}
+
+foreach solver {BandSPD ProfileSPD {SparseSYM 1} {SparseSYM 2} {SparseSYM 3}} {
+    set disp [solveFrame {*}$solver]
+    if {[llength $disp] != [llength $exact]} {
+        set testOK -1
+        puts [format "%15s  failed to solve" $solver]
+        continue
+    }
+    set error 0.0
+    foreach u $disp v $exact {
+        if {abs($u-$v) > $error} { set error [expr abs($u-$v)] }
+    }
+    puts [format "%15s  max difference %12.4e (max disp %12.4e)" $solver $error $scale]
+    if {$error > 1.0e-10*$scale} {
+        set testOK -1
+        puts "failed $solver"
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test SymmetricFrameSolvers.tcl \n\n"
+    puts $results "| PASSED |  SymmetricFrameSolvers.tcl"
+} else {
+    puts "FAILED Verification Test SymmetricFrameSolvers.tcl \n\n"
+    puts $results "FAILED : SymmetricFrameSolvers.tcl"
+}
+close $results
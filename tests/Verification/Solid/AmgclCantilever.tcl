@@ -0,0 +1,128 @@
+# Cantilevers solved with the AMG preconditioned Krylov solver
+#
+# An elastic brick cantilever (3 dofs per node) and a plane frame (3 dofs
+# per node, with rotations) are solved with system Amgcl, with and without
+# the rigid body modes and with enough levels that the coarsest is small.
+# The displacements are compared with those of UmfPack.
+
+puts "AmgclCantilever.tcl: system Amgcl against UmfPack"
+
+proc brickCantilever {nx ny nz} {
+    wipe
+    model Basic -ndm 3 -ndf 3
+    nDMaterial ElasticIsotropic 1 30000.0 0.25
+    for {set k 0} {$k <= $nz} {incr k} {
+        for {set j 0} {$j <= $ny} {incr j} {
+            for {set i 0} {$i <= $nx} {incr i} {
+                set tag [expr 1 + $i + ($nx+1)*($j + ($ny+1)*$k)]
+                node $tag [expr 1.0*$i] [expr 1.0*$j] [expr 1.0*$k]
+                if {$k == 0} { fix $tag 1 1 1 }
+            }
+        }
+    }
+    set d [expr ($nx+1)*($ny+1)]
+    set e 1
+    for {set k 0} {$k < $nz} {incr k} {
+        for {set j 0} {$j < $ny} {incr j} {
+            for {set i 0} {$i < $nx} {incr i} {
+                set n1 [expr 1 + $i + ($nx+1)*($j + ($ny+1)*$k)]
+                set n2 [expr $n1 + 1]
+                set n4 [expr $n1 + $nx + 1]
+                set n3 [expr $n4 + 1]
+                element stdBrick $e $n1 $n2 $n3 $n4 [expr $n1+$d] [expr $n2+$d] [expr $n3+$d] [expr $n4+$d] 1
+                incr e
+            }
+        }
+    }
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        for {set n 1} {$n <= $d} {incr n} {
+            load [expr $d*$nz + $n] 1.0 0.5 -0.2
+        }
+    }
+}
+
+proc planeFrame {numStory numBay} {
+    wipe
+    model Basic -ndm 2 -ndf 3
+    for {set j 0} {$j <= $numStory} {incr j} {
+        for {set i 0} {$i <= $numBay} {incr i} {
+            node [expr 100*$j + $i + 1] [expr 6.0*$i] [expr 3.0*$j]
+            if {$j == 0} { fix [expr $i + 1] 1 1 1 }
+        }
+    }
+    geomTransf Linear 1
+    set e 1
+    for {set j 0} {$j < $numStory} {incr j} {
+        for {set i 1} {$i <= $numBay+1} {incr i} {
+            element elasticBeamColumn $e [expr 100*$j + $i] [expr 100*($j+1) + $i] 0.16 2.0e7 0.002 1
+            incr e
+        }
+        for {set i 1} {$i <= $numBay} {incr i} {
+            element elasticBeamColumn $e [expr 100*($j+1) + $i] [expr 100*($j+1) + $i + 1] 0.12 2.0e7 0.0016 1
+            incr e
+        }
+    }
+    timeSeries Linear 1
+    pattern Plain 1 1 {
+        for {set j 1} {$j <= $numStory} {incr j} {
+            load [expr 100*$j + 1] [expr 10.0*$j] 0.0 0.0
+            for {set i 1} {$i <= $numBay+1} {incr i} { load [expr 100*$j + $i] 0.0 -50.0 0.0 }
+        }
+    }
+}
+
+proc solve {model args} {
+    eval $model
+    constraints Plain
+    numberer RCM
+    eval system $args
+    test NormDispIncr 1.0e-12 4
+    algorithm Linear
+    integrator LoadControl 1.0
+    analysis Static
+    if {[analyze 1] != 0} {
+        return {}
+    }
+    set disp {}
+    foreach node [getNodeTags] {
+        lappend disp {*}[nodeDisp $node]
+    }
+    return $disp
+}
+
+set testOK 0
+foreach model {{brickCantilever 4 4 12} {planeFrame 20 4}} {
+    set exact [solve $model UmfPack]
+    set scale 0.0
+    foreach u $exact {
+        if {abs($u) > $scale} { set scale [expr abs($u)] }
+    }
+    foreach system {{Amgcl} {Amgcl -noRigidBodyModes} {Amgcl -coarseEnough 50} {Amgcl -solver gmres}} {
+        set disp [solve $model {*}$system -tol 1.0e-10]
+        if {[llength $disp] != [llength $exact]} {
+            set testOK -1
+            puts "failed $model: $system did not solve"
+            continue
+        }
+        set error 0.0
+        foreach u $disp v $exact {
+            if {abs($u-$v) > $error} { set error [expr abs($u-$v)] }
+        }
+        puts [format "%24s %30s  max difference %12.4e (max disp %12.4e)" $model $system $error $scale]
+        if {$error > 1.0e-6*$scale} {
+            set testOK -1
+            puts "failed $model: $system"
+        }
+    }
+}
+
+set results [open README.md a+]
+if {$testOK == 0} {
+    puts "PASSED Verification Test AmgclCantilever.tcl \n\n"
+    puts $results "| PASSED |  AmgclCantilever.tcl"
+} else {
+    puts "FAILED Verification Test AmgclCantilever.tcl \n\n"
+    puts $results "FAILED : AmgclCantilever.tcl"
+}
+close $results
@@ -11,6 +11,19 @@ source sdofTransient.tcl
 source SmallEigen.tcl
 source NewmarkIntegrator.tcl
 source mdofModal.tcl
+source ResponseSpectrumCombination.tcl
+source RemoveElements.tcl
+source ExplicitRemoveElements.tcl
+source ExplicitElementDamping.tcl
+source SnapshotRestore.tcl
+source ParallelSampling.tcl
+source SeriesDataSharing.tcl
+source ThreadedAssembly.tcl
+source AsyncRecorders.tcl
+source NodalStateStorage.tcl
+source FactorizationReuse.tcl
+source PeriFamilies.tcl
+source Profile.tcl
 cd ..
 
 source Truss/PlanarTruss.tcl
@@ -20,10 +33,17 @@ source Frame/PortalFrame2d.tcl
 source Frame/EigenFrame.tcl
 source Frame/EigenFrame.Extra.tcl
 source Frame/AISC25.tcl
+source Frame/ConstrainedFrameSolvers.tcl
+source Frame/SymmetricFrameSolvers.tcl
+source Frame/CheckpointRestart.tcl
+source Frame/FiberSectionThreads.tcl
 
 source Plane/PlaneStrain.tcl
 source Plane/QuadBending.tcl
 
+# Solids
+source Solid/AmgclCantilever.tcl
+
 # Shells
 source Shell/PinchedCylinder.tcl
 source Shell/PlanarShearWall.tcl
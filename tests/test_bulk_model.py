@@ -0,0 +1,184 @@
+"""
+Build the same models twice, once with a command for each node, constraint,
+load and element, and once from arrays with the bulk methods of the model
+builder (addNodes, fixNodes, addNodalLoads and addElements). Both models
+are analyzed, and their displacements, reactions and eigenvalues must be
+identical.
+"""
+import numpy as np
+import opensees.openseespy as ops
+
+
+def builder_of(model):
+    # OpenSeesPyRT may only be imported once Tcl has loaded the library
+    from opensees import OpenSeesPyRT
+    return OpenSeesPyRT.get_builder(model._openseespy._interp._tcl.interpaddr())
+
+
+#
+# A 2D panel of quads on a grid of nx by ny cells, braced by a truss and a
+# corotational truss along each diagonal of the bottom row of cells
+#
+nx, ny = 4, 3
+width, height = 1.0, 0.5
+rho = 2.0
+
+coords = np.array([[width*i, height*j] for j in range(ny+1) for i in range(nx+1)])
+node_tags = np.arange(1, len(coords)+1, dtype=np.int32)
+def node(i, j):
+    return 1 + j*(nx+1) + i
+
+quads = np.array([[node(i, j), node(i+1, j), node(i+1, j+1), node(i, j+1)]
+                  for j in range(ny) for i in range(nx)], dtype=np.int32)
+quad_tags = np.arange(1, len(quads)+1, dtype=np.int32)
+
+trusses = np.array([[node(i, 0), node(i+1, 1)] for i in range(nx)], dtype=np.int32)
+truss_tags = np.arange(101, 101+len(trusses), dtype=np.int32)
+truss_area = np.linspace(0.01, 0.04, len(trusses))
+
+corots = np.array([[node(i+1, 0), node(i, 1)] for i in range(nx)], dtype=np.int32)
+corot_tags = np.arange(201, 201+len(corots), dtype=np.int32)
+
+mass = np.full((len(coords), 2), 0.5)
+
+base = np.array([node(i, 0) for i in range(nx+1)], dtype=np.int32)
+fixity = np.ones((len(base), 2), dtype=np.int32)
+fixity[1:-1, 0] = 0
+
+top = np.array([node(i, ny) for i in range(nx+1)], dtype=np.int32)
+forces = np.array([[10.0 + i, -5.0*i] for i in range(nx+1)])
+
+
+def panel_materials(model):
+    model.nDMaterial("ElasticIsotropic", 1, 30000.0, 0.2)
+    model.uniaxialMaterial("Elastic", 2, 200000.0)
+    model.timeSeries("Linear", 1)
+    model.pattern("Plain", 1, 1)
+
+
+def panel_by_command(model):
+    panel_materials(model)
+    for tag, (x, y) in zip(node_tags, coords):
+        model.node(int(tag), float(x), float(y))
+    for tag, m in zip(node_tags, mass):
+        model.mass(int(tag), *map(float, m))
+    for tag, fix in zip(base, fixity):
+        model.fix(int(tag), *map(int, fix))
+    for tag, nodes in zip(quad_tags, quads):
+        model.element("quad", int(tag), *map(int, nodes), 0.2, "PlaneStrain", 1, 0.0, rho, 0.0, 0.0)
+    for tag, nodes, area in zip(truss_tags, trusses, truss_area):
+        model.element("Truss", int(tag), *map(int, nodes), float(area), 2, "-rho", rho)
+    for tag, nodes in zip(corot_tags, corots):
+        model.element("corotTruss", int(tag), *map(int, nodes), 0.02, 2, "-rho", rho)
+    for tag, force in zip(top, forces):
+        model.load(int(tag), *map(float, force))
+
+
+def panel_in_bulk(model):
+    panel_materials(model)
+    builder = builder_of(model)
+    assert builder.addNodes(node_tags, coords, mass=mass) == len(node_tags)
+    assert builder.fixNodes(base, fixity) == int(fixity.sum())
+    assert builder.addElements("quad", quad_tags, quads, 1, thickness=0.2,
+                               density=rho, plane="PlaneStrain") == len(quads)
+    assert builder.addElements("Truss", truss_tags, trusses, 2, area=truss_area,
+                               density=rho) == len(trusses)
+    assert builder.addElements("CorotTruss", corot_tags, corots, 2, area=0.02,
+                               density=rho) == len(corots)
+    assert builder.addNodalLoads(1, top, forces) == len(top)
+
+
+#
+# A 3D column of bricks, fixed at the base and loaded at the top
+#
+nz = 3
+brick_coords = np.array([[x, y, 0.5*k] for k in range(nz+1)
+                         for (x, y) in [(0, 0), (1, 0), (1, 1), (0, 1)]], dtype=float)
+brick_tags = np.arange(1, nz+1, dtype=np.int32)
+bricks = np.array([[4*k + 1, 4*k + 2, 4*k + 3, 4*k + 4,
+                    4*k + 5, 4*k + 6, 4*k + 7, 4*k + 8] for k in range(nz)], dtype=np.int32)
+brick_nodes = np.arange(1, len(brick_coords)+1, dtype=np.int32)
+brick_base  = brick_nodes[:4]
+brick_top   = brick_nodes[-4:]
+brick_loads = np.array([[1.0, 0.5*i, -2.0] for i in range(4)])
+
+
+def column_by_command(model):
+    model.nDMaterial("ElasticIsotropic", 1, 30000.0, 0.2)
+    model.timeSeries("Linear", 1)
+    model.pattern("Plain", 1, 1)
+    for tag, xyz in zip(brick_nodes, brick_coords):
+        model.node(int(tag), *map(float, xyz))
+    for tag in brick_base:
+        model.fix(int(tag), 1, 1, 1)
+    for tag, nodes in zip(brick_tags, bricks):
+        model.element("stdBrick", int(tag), *map(int, nodes), 1)
+    for tag, force in zip(brick_top, brick_loads):
+        model.load(int(tag), *map(float, force))
+
+
+def column_in_bulk(model):
+    model.nDMaterial("ElasticIsotropic", 1, 30000.0, 0.2)
+    model.timeSeries("Linear", 1)
+    model.pattern("Plain", 1, 1)
+    builder = builder_of(model)
+    builder.addNodes(brick_nodes, brick_coords)
+    builder.fixNodes(brick_base, np.ones((4, 3), dtype=np.int32))
+    builder.addElements("stdBrick", brick_tags, bricks, 1)
+    builder.addNodalLoads(1, brick_top, brick_loads)
+
+
+def analyze(model, tags, num_modes):
+    model.system("FullGeneral")
+    model.numberer("Plain")
+    model.constraints("Plain")
+    model.test("NormDispIncr", 1e-12, 10)
+    model.algorithm("Newton")
+    model.integrator("LoadControl", 0.5)
+    model.analysis("Static")
+    assert model.analyze(2) == 0
+    model.reactions()
+    state = {
+        "disp":     np.array([model.nodeDisp(int(tag)) for tag in tags]),
+        "reaction": np.array([model.nodeReaction(int(tag)) for tag in tags]),
+    }
+    if num_modes > 0:
+        state["eigen"] = np.array(model.eigen("-fullGenLapack", num_modes))
+    model.wipe()
+    return state
+
+
+for ndm, ndf, by_command, in_bulk, tags, num_modes in [
+        (2, 2, panel_by_command,  panel_in_bulk,  node_tags,   3),
+        (3, 3, column_by_command, column_in_bulk, brick_nodes, 0)]:
+
+    one = ops.Model("basic", ndm=ndm, ndf=ndf)
+    by_command(one)
+
+    two = ops.Model("basic", ndm=ndm, ndf=ndf)
+    in_bulk(two)
+
+    assert one.getNodeTags() == two.getNodeTags()
+    assert one.getEleTags()  == two.getEleTags()
+    for tag in tags:
+        assert one.nodeCoord(int(tag)) == two.nodeCoord(int(tag))
+
+    expected = analyze(one, tags, num_modes)
+    actual   = analyze(two, tags, num_modes)
+    assert np.any(expected["disp"] != 0.0)
+    for key in expected:
+        assert np.array_equal(expected[key], actual[key]), key
+
+
+# bad input is refused
+model = ops.Model("basic", ndm=2, ndf=2)
+builder = builder_of(model)
+for call in [lambda: builder.addNodes([1, 2], np.zeros((3, 2))),
+             lambda: builder.addElements("Beam", [1], [[1, 2]], 1)]:
+    try:
+        call()
+    except RuntimeError:
+        continue
+    raise AssertionError("bad input was accepted")
+
+print("models built in bulk match the models built by command")
@@ -0,0 +1,73 @@
+"""
+Record a short transient analysis of a truss with -binaryColumnar Node
+and Element recorders, read the files back with ColumnarOutput, and
+compare each column with the text output of the same recorders.
+"""
+import os
+import tempfile
+
+import numpy as np
+import opensees.openseespy as ops
+from opensees.recorder import ColumnarOutput
+
+
+def analyze(directory):
+    model = ops.Model("basic", ndm=2, ndf=2)
+    model.node(1,   0.0,  0.0)
+    model.node(2, 144.0,  0.0)
+    model.node(3, 168.0,  0.0)
+    model.node(4,  72.0, 96.0)
+    model.fix(1, 1, 1)
+    model.fix(2, 1, 1)
+    model.fix(3, 1, 1)
+    model.mass(4, 1.0, 1.0)
+    model.uniaxialMaterial("Elastic", 1, 3000.0)
+    model.element("truss", 1, 1, 4, 10.0, 1)
+    model.element("truss", 2, 2, 4,  5.0, 1)
+    model.element("truss", 3, 3, 4,  5.0, 1)
+    model.timeSeries("Linear", 1)
+    model.pattern("Plain", 1, 1)
+    model.load(4, 100.0, -50.0)
+
+    for kind, args in [("Node",    ["-node", 4, 2, "-dof", 2, 1, "disp"]),
+                       ("Element", ["-ele", 1, 3, "axialForce"])]:
+        model.recorder(kind, "-binaryColumnar", os.path.join(directory, f"{kind}.ocb"), "-time", *args)
+        model.recorder(kind, "-file", os.path.join(directory, f"{kind}.txt"), "-precision", 17, "-time", *args)
+
+    model.system("BandGeneral")
+    model.numberer("RCM")
+    model.constraints("Plain")
+    model.test("NormDispIncr", 1e-12, 10)
+    model.algorithm("Newton")
+    model.integrator("Newmark", 0.5, 0.25)
+    model.analysis("Transient")
+    model.analyze(25, 0.05)
+    model.wipe()
+
+
+with tempfile.TemporaryDirectory() as directory:
+    analyze(directory)
+
+    # Node: time, then dofs 2 and 1 of nodes 4 and 2
+    text = np.loadtxt(os.path.join(directory, "Node.txt"))
+    out  = ColumnarOutput(os.path.join(directory, "Node.ocb"))
+    assert out.num_rows == len(text) == 25
+    assert [c["name"] for c in out.columns] == ["time", "D1", "D2", "D1", "D2"]
+    assert [c["dof"]  for c in out.columns[1:]] == [2, 1, 2, 1]
+    assert np.array_equal(out.time, text[:, 0])
+    assert np.array_equal(out.column("D1", tag=4), text[:, 1])
+    assert np.array_equal(out.column("D2", tag=4), text[:, 2])
+    assert np.array_equal(out.column("D1", tag=2), text[:, 3])
+    assert np.all(out.column("D1", tag=2) == 0.0)
+    assert np.any(out.column("D1", tag=4) != 0.0)
+
+    # Element: time, then the axial force of elements 1 and 3
+    text = np.loadtxt(os.path.join(directory, "Element.txt"))
+    out  = ColumnarOutput(os.path.join(directory, "Element.ocb"))
+    assert out.num_rows == len(text) == 25
+    assert [c["name"] for c in out.columns] == ["time", "N", "N"]
+    assert np.array_equal(out.time, text[:, 0])
+    assert np.array_equal(out.column("N", tag=1), text[:, 1])
+    assert np.array_equal(out.column("N", tag=3), text[:, 2])
+
+print("columnar recorders match the text recorders")
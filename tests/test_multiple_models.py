@@ -92,3 +92,49 @@ analyze(system_2)
 system_2.printModel("node", 4)
 system_2.printModel("ele")
 
+
+
+# Build and analyze models on two threads at once. Each model is created
+# on the thread that analyzes it: the builder, domain and database belong
+# to the runtime of the model, but the analysis state read through globals
+# is kept per thread, so a model must not be handed to another thread. The models differ in their loads, so
+# arguments parsed for one model that leak into the other would change
+# its displacements from those of the same model analyzed alone.
+import threading
+
+def make_fan(system, load, numBars=200):
+    system.node(0, 0.0, -100.0)
+    for i in range(1, numBars+1):
+        system.node(i, 10.0*i - 5.0*numBars, 0.0)
+        system.fix(i, 1, 1)
+    system.uniaxialMaterial("Elastic", 1, 3000.0)
+    for i in range(1, numBars+1):
+        system.element("truss", i, i, 0, 1.0 + 0.01*i, 1)
+    system.timeSeries("Linear", 1)
+    system.pattern("Plain", 1, 1)
+    system.load(0, load, -2.0*load)
+
+def solve_fan(load):
+    system = ops.Model("basic", ndm=2, ndf=2)
+    make_fan(system, load)
+    analyze(system)
+    return system.nodeDisp(0)
+
+loads = [100.0, 250.0]
+alone = [solve_fan(load) for load in loads]
+
+for trial in range(5):
+    together = [None]*len(loads)
+    def run(i):
+        together[i] = solve_fan(loads[i])
+    threads = [threading.Thread(target=run, args=(i,)) for i in range(len(loads))]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    for u, v in zip(together, alone):
+        assert u is not None
+        assert max(abs(a - b) for a, b in zip(u, v)) <= 1e-12*max(abs(b) for b in v), (u, v)
+
+print("threaded models match:", alone)
@@ -0,0 +1,89 @@
+"""
+Fetch the displacements and reactions of every node of a truss as arrays
+with getNodeResponses, and compare them with nodeDisp and nodeReaction.
+With contiguous nodal storage the displacements are a read-only view that
+follows the analysis. An `out` array is filled in place, and one of the
+wrong dtype, layout or shape is refused.
+"""
+import numpy as np
+import opensees.openseespy as ops
+
+
+model = ops.Model("basic", ndm=2, ndf=2)
+model.node(1,   0.0,  0.0)
+model.node(2, 144.0,  0.0)
+model.node(3, 168.0,  0.0)
+model.node(4,  72.0, 96.0)
+model.fix(1, 1, 1)
+model.fix(2, 1, 1)
+model.fix(3, 1, 1)
+model.uniaxialMaterial("Elastic", 1, 3000.0)
+model.element("truss", 1, 1, 4, 10.0, 1)
+model.element("truss", 2, 2, 4,  5.0, 1)
+model.element("truss", 3, 3, 4,  5.0, 1)
+model.timeSeries("Linear", 1)
+model.pattern("Plain", 1, 1)
+model.load(4, 100.0, -50.0)
+
+model.system("BandGeneral")
+model.numberer("RCM")
+model.constraints("Plain")
+model.test("NormDispIncr", 1e-12, 10)
+model.algorithm("Newton")
+model.integrator("LoadControl", 0.5)
+model.analysis("Static")
+
+# OpenSeesPyRT may only be imported once Tcl has loaded the library
+from opensees import OpenSeesPyRT
+builder = OpenSeesPyRT.get_builder(model._openseespy._interp._tcl.interpaddr())
+domain  = builder.getDomain()
+
+def expected(command):
+    return np.array([getattr(model, command)(int(tag)) for tag in tags])
+
+tags = domain.getNodeTags()
+assert list(tags) == model.getNodeTags()
+
+# a copy without contiguous storage
+model.analyze(1)
+disp = domain.getNodeResponses("disp")
+assert disp.shape == (4, 2)
+assert np.array_equal(disp, expected("nodeDisp"))
+
+# a view of the contiguous storage, which follows the analysis
+domain.setNodalStateStorage(True)
+view = domain.getNodeResponses("disp")
+assert not view.flags.writeable
+assert np.array_equal(view, expected("nodeDisp"))
+try:
+    view[0, 0] = 1.0
+    raise AssertionError("the view of the nodal state is writeable")
+except ValueError:
+    pass
+
+model.analyze(1)
+assert np.array_equal(view, expected("nodeDisp"))
+assert np.any(view != disp)
+
+# reactions are gathered into out
+model.reactions()
+out = np.zeros((4, 2))
+assert domain.getNodeResponses("reaction", out=out) is out
+assert np.array_equal(out, expected("nodeReaction"))
+
+for bad, error in [(np.zeros((4, 2), dtype=np.float32), TypeError),
+                   (np.zeros((4, 2), order="F"),         ValueError),
+                   (np.zeros((3, 2)),                    ValueError),
+                   ([[0.0, 0.0]]*4,                      TypeError)]:
+    try:
+        domain.getNodeResponses("reaction", out=bad)
+    except error:
+        continue
+    raise AssertionError(f"out was accepted: {bad!r}")
+
+# the view stays valid once the storage is given back to the nodes
+domain.setNodalStateStorage(False)
+assert np.array_equal(view, expected("nodeDisp"))
+model.wipe()
+
+print("node response arrays match nodeDisp and nodeReaction")